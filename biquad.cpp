@@ -0,0 +1,102 @@
+/**********************************************************
+ * biquad.cpp - second order filter design
+ *
+ * The formulas are those of the Audio EQ Cookbook, with
+ * a0 divided out. Everything is computed in double and
+ * only rounded to 5.23 by biquad_words() (or by the
+ * set_* function the coefficients are given to).
+ **********************************************************/
+
+// includes
+ #include <math.h>
+ #include "dsputil.h"
+ #include "biquad.h"
+ #include "fixedpoint.h"
+
+// ************* functions *************************
+
+// the centre frequency must be below half the sample rate
+static int
+check_args(double fs, double f0, double q) {
+    if ((fs <= 0) || (f0 <= 0) || (f0 >= fs/2) || (q <= 0)) return(-1);
+    return(0);
+}
+
+// notch, or a cut of depth_db with the same bandwidth. With g the gain at f0
+// this is 1 - (1-g)*bandpass, so only the b0 and b2 terms depend on the depth
+int
+biquad_notch(double* coeff, double fs, double f0, double q, double depth_db) {
+    double w, k, g, a0;
+
+    if (check_args(fs, f0, q) != 0) return(-1);
+    w = 2*PI*f0/fs;
+    k = tan(w/(2*q));
+    g = (depth_db > 0) ? pow(10.0, -depth_db/20.0) : 0.0;
+    a0 = 1+k;
+    coeff[0] = (1+g*k)/a0;
+    coeff[1] = -2*cos(w)/a0;
+    coeff[2] = (1-g*k)/a0;
+    coeff[3] = coeff[1];
+    coeff[4] = (1-k)/a0;
+    return(0);
+}
+
+int
+biquad_peak(double* coeff, double fs, double f0, double q, double gain_db) {
+    double w, alpha, a, a0;
+
+    if (check_args(fs, f0, q) != 0) return(-1);
+    w = 2*PI*f0/fs;
+    alpha = sin(w)/(2*q);
+    a = pow(10.0, gain_db/40.0);
+    a0 = 1+(alpha/a);
+    coeff[0] = (1+(alpha*a))/a0;
+    coeff[1] = -2*cos(w)/a0;
+    coeff[2] = (1-(alpha*a))/a0;
+    coeff[3] = coeff[1];
+    coeff[4] = (1-(alpha/a))/a0;
+    return(0);
+}
+
+// sign is 1 for the low shelf and -1 for the high shelf, which in the
+// cookbook only differ in the sign of the cos(w) terms and of b1 and a1
+static int
+shelf(double* coeff, double fs, double f0, double q, double gain_db, int sign) {
+    double w, c, alpha, a, sq, a0;
+
+    if (check_args(fs, f0, q) != 0) return(-1);
+    w = 2*PI*f0/fs;
+    c = sign*cos(w);
+    alpha = sin(w)/(2*q);
+    a = pow(10.0, gain_db/40.0);
+    sq = 2*sqrt(a)*alpha;
+    a0 = (a+1) + (a-1)*c + sq;
+    coeff[0] = a*((a+1) - (a-1)*c + sq)/a0;
+    coeff[1] = sign*2*a*((a-1) - (a+1)*c)/a0;
+    coeff[2] = a*((a+1) - (a-1)*c - sq)/a0;
+    coeff[3] = sign*-2*((a-1) + (a+1)*c)/a0;
+    coeff[4] = ((a+1) + (a-1)*c - sq)/a0;
+    return(0);
+}
+
+int
+biquad_lowshelf(double* coeff, double fs, double f0, double q, double gain_db) {
+    return(shelf(coeff, fs, f0, q, gain_db, 1));
+}
+
+int
+biquad_highshelf(double* coeff, double fs, double f0, double q, double gain_db) {
+    return(shelf(coeff, fs, f0, q, gain_db, -1));
+}
+
+void
+biquad_words(const double* coeff, unsigned char* words) {
+    double c[5];
+
+    c[0] = coeff[0];
+    c[1] = coeff[1];
+    c[2] = coeff[2];
+    c[3] = 0-coeff[3]; // as stored by the DSP, see set_gen_2nd_order_filter
+    c[4] = 0-coeff[4];
+    fixed_5_23::encode_array(c, words, 5);
+}
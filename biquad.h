@@ -0,0 +1,39 @@
+#ifndef __BIQUAD_HEADER_FILE__
+#define __BIQUAD_HEADER_FILE__
+
+/**********************************************************
+ * biquad.h - second order filter design
+ *
+ * Computes the five coefficients b0, b1, b2, a1, a2 for
+ * set_gen_2nd_order_filter (the same layout as the rows
+ * of tests/notch.h), for a transfer function
+ *   H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+ * from the filter shapes in R. Bristow-Johnson's Audio EQ
+ * Cookbook. Frequencies are in Hz and may be fractional.
+ **********************************************************/
+
+#define BIQUAD_FS 48000.0       // DSP sample rate
+#define BIQUAD_NOTCH_Q 35.0     // Q of the tests/notch.h table
+
+// notch at f0 with quality factor q (centre frequency / bandwidth).
+// depth_db limits the attenuation at f0 (e.g. 20 for -20 dB); 0 gives a
+// complete notch. The bandwidth is set as k = tan(pi*f0/(fs*q)), the form
+// notch.h was made with, so the 5.23 words for q=BIQUAD_NOTCH_Q and whole
+// Hz from 40 to 4000 Hz are identical to the table's (checked by make check).
+// returns 0, or -1 if the parameters are out of range
+int biquad_notch(double* coeff, double fs, double f0, double q, double depth_db);
+
+// peaking EQ: gain_db at f0 (negative to cut), 0 dB far from it
+int biquad_peak(double* coeff, double fs, double f0, double q, double gain_db);
+
+// shelves: gain_db below (low shelf) or above (high shelf) f0, the midpoint
+// of the transition. q is the cookbook's, 0.7071 gives the steepest slope
+// without a bump
+int biquad_lowshelf(double* coeff, double fs, double f0, double q, double gain_db);
+int biquad_highshelf(double* coeff, double fs, double f0, double q, double gain_db);
+
+// converts a coefficient set to the 20 bytes that
+// set_gen_2nd_order_filter_words() sends (a1 and a2 negated, 5.23)
+void biquad_words(const double* coeff, unsigned char* words);
+
+#endif // __BIQUAD_HEADER_FILE__
@@ -0,0 +1,333 @@
+/*****************************************************
+ * dspbench - Control Path Benchmarks
+ * rev 1 - october 2026
+ *
+ * Times the host side of a parameter update: the number
+ * format conversions, the frame building in the set_*
+ * functions and the filter and notch coefficient
+ * calculations. The
+ * writes go to the null transport (see i2cfunc.h), so
+ * the results are the CPU cost per update without the
+ * bus. Set WAVEMINER_I2C to use
+ * another transport instead.
+ *
+ * The results are printed as JSON, with the time per
+ * operation (median and best of the runs) and the number
+ * of heap allocations per operation.
+ *
+ * Example (same as make bench):
+ *      ./dspbench -o bench.json
+ * Example with fewer iterations, on the fake bus:
+ *      WAVEMINER_I2C=fake ./dspbench -n 10000
+ *****************************************************/
+
+// includes
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <unistd.h>
+ #include <sys/utsname.h>
+ #include "options.h"
+ #include "dsputil.h"
+ #include "i2cfunc.h"
+ #include "fixedpoint.h"
+ #include "biquad.h"
+ #include "iir.h"
+
+// defines
+#define DEFAULT_ITERATIONS 200000
+#define RUNS 5              // each benchmark is timed this many times
+#define MAX_RESULTS 32
+#define BENCH_SHADOW "/tmp/dspbench-shadow"
+#define NOTCH_SETS 64       // notch coefficient sets the set_* benchmarks cycle through
+
+// consts, as used by notch4.bin and filter6.bin
+const int NOTCH_NODE = 0x0004;
+const int FILTER_NODE = 0x0000;
+
+// externs
+extern char do_log;
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t n, size_t size);
+extern "C" void* __libc_realloc(void* p, size_t size);
+
+// globals
+unsigned long long nallocs = 0; // heap allocations so far
+volatile double sink_d;         // results go here so the work isn't optimised away
+volatile int sink_i;
+double dfilter_coeff[15];
+double dfilter_b0;
+double notch_coeff[NOTCH_SETS][5];
+unsigned char notch_words[2][20]; // two notches as 5.23 words
+
+typedef struct {
+    const char* name;
+    int iterations;       // per run
+    double ns_per_op;     // median of the runs
+    double ns_per_op_min;
+    double allocs_per_op;
+} result_t;
+
+result_t results[MAX_RESULTS];
+int nresults = 0;
+
+// ************* allocation counting *************
+// new and delete use these as well
+
+extern "C" void*
+malloc(size_t size)
+{
+    nallocs++;
+    return(__libc_malloc(size));
+}
+
+extern "C" void*
+calloc(size_t n, size_t size)
+{
+    nallocs++;
+    return(__libc_calloc(n, size));
+}
+
+extern "C" void*
+realloc(void* p, size_t size)
+{
+    nallocs++;
+    return(__libc_realloc(p, size));
+}
+
+// ************* benchmarks *************
+// each runs operation i of n, and is given a different input each time
+
+void
+b_double_to_5_23(int i) {
+    char bytes[4];
+    double_to_5_23_format((i & 1023) / 64.0 - 8.0, bytes);
+    sink_i = bytes[3];
+}
+
+// a set_dfilter6 bank of 15 coefficients in one call
+void
+b_encode_bank(int i) {
+    unsigned char bytes[15*4];
+    fixed_5_23::encode_array(dfilter_coeff, bytes, 15);
+    sink_i = bytes[i % 60];
+}
+
+void
+b_5_19_to_double(int i) {
+    char bytes[3];
+    double v;
+    bytes[0] = (char)(i >> 8);
+    bytes[1] = (char)i;
+    bytes[2] = (char)(i << 4);
+    dsp_5_19_format_to_double(&v, bytes);
+    sink_d = v;
+}
+
+void
+b_swap_order(int i) {
+    char buf[2];
+    swap_order(buf, i & 0xffff);
+    sink_i = buf[0];
+}
+
+void
+b_gen_2nd_order(int i) {
+    set_gen_2nd_order_filter(NOTCH_NODE, notch_coeff[i % NOTCH_SETS]);
+}
+
+void
+b_gen_2nd_order_safeload(int i) {
+    set_gen_2nd_order_filter_safeload(NOTCH_NODE, notch_coeff[i % NOTCH_SETS]);
+}
+
+void
+b_gen_2nd_order_words(int i) {
+    set_gen_2nd_order_filter_words(NOTCH_NODE, notch_words[i & 1]);
+}
+
+void
+b_notch_design(int i) {
+    double coeff[5];
+    biquad_notch(coeff, BIQUAD_FS, 40 + (i % 39610)/10.0, BIQUAD_NOTCH_Q, 0);
+    sink_d = coeff[0] + coeff[4];
+}
+
+void
+b_iir_butter6(int i) {
+    double coeff[IIR_MAX_SECTIONS][5];
+    sink_i = iir_design(coeff, IIR_BUTTERWORTH, IIR_LOWPASS, 6, BIQUAD_FS, 25 + (i % 14975), 1, 60);
+}
+
+void
+b_iir_ellip12(int i) {
+    double coeff[IIR_MAX_SECTIONS][5];
+    sink_i = iir_design(coeff, IIR_ELLIPTIC, IIR_HIGHPASS, 12, BIQUAD_FS, 25 + (i % 14975), 1, 60);
+}
+
+void
+b_dfilter6(int i) {
+    dfilter_coeff[0] = dfilter_b0 * (1.0 - (i % 64)/1024.0); // a new value each time
+    set_dfilter6(FILTER_NODE, dfilter_coeff);
+}
+
+// everything notch does for a new pair of notch frequencies
+void
+b_notch_update(int i) {
+    double coeff1[5], coeff2[5];
+    unsigned char words1[20], words2[20];
+    biquad_notch(coeff1, BIQUAD_FS, 40 + (i % 3961), BIQUAD_NOTCH_Q, 0);
+    biquad_notch(coeff2, BIQUAD_FS, 40 + ((i*7) % 3961), BIQUAD_NOTCH_Q, 0);
+    biquad_words(coeff1, words1);
+    biquad_words(coeff2, words2);
+    dsp_batch_begin();
+    set_gen_2nd_order_filter_words_safeload(NOTCH_NODE+0, words1);
+    set_gen_2nd_order_filter_words_safeload(NOTCH_NODE+5, words1);
+    set_gen_2nd_order_filter_words_safeload(NOTCH_NODE+10, words2);
+    set_gen_2nd_order_filter_words_safeload(NOTCH_NODE+15, words2);
+    dsp_batch_end();
+}
+
+// everything filter does for a new bandpass
+void
+b_filter_update(int i) {
+    double coeff[IIR_MAX_SECTIONS][5];
+    int j;
+    iir_design(coeff, IIR_BUTTERWORTH, IIR_HIGHPASS, 6, BIQUAD_FS, 25 + (i % 600)*25, 1, 60);
+    iir_design(coeff+3, IIR_BUTTERWORTH, IIR_LOWPASS, 6, BIQUAD_FS, 25 + ((i*7) % 600)*25, 1, 60);
+    dsp_batch_begin();
+    for (j=0; j<6; j++) {
+        set_gen_2nd_order_filter_safeload(FILTER_NODE+(j*5), coeff[j]);
+    }
+    dsp_batch_end();
+}
+
+// the same filter again, which the shadow cache skips
+void
+b_gen_2nd_order_unchanged(int i) {
+    set_gen_2nd_order_filter(NOTCH_NODE, notch_coeff[0]);
+}
+
+// ************* timing *************
+
+int
+cmp_double(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return((x > y) - (x < y));
+}
+
+void
+run_bench(const char* name, void (*fn)(int), int n) {
+    double ns[RUNS];
+    unsigned long long t, allocs;
+    int r, i;
+    result_t* res;
+
+    if (nresults >= MAX_RESULTS) return;
+    for (i=0; i<n/10; i++) fn(i); // warm up the caches
+    allocs = nallocs;
+    for (r=0; r<RUNS; r++) {
+        t = monotonic_ns();
+        for (i=0; i<n; i++) fn(i);
+        ns[r] = (double)(monotonic_ns() - t) / n;
+    }
+    res = &results[nresults++];
+    res->name = name;
+    res->iterations = n;
+    res->allocs_per_op = (double)(nallocs - allocs) / ((double)n * RUNS);
+    qsort(ns, RUNS, sizeof(double), cmp_double);
+    res->ns_per_op = ns[RUNS/2];
+    res->ns_per_op_min = ns[0];
+}
+
+void
+print_json(FILE* fp) {
+    struct utsname u;
+    int i;
+
+    memset(&u, 0, sizeof(u));
+    uname(&u);
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"host\": \"%s\",\n", u.nodename);
+    fprintf(fp, "  \"machine\": \"%s\",\n", u.machine);
+    fprintf(fp, "  \"transport\": \"%s\",\n", i2c_transport()->name);
+    fprintf(fp, "  \"runs\": %d,\n", RUNS);
+    fprintf(fp, "  \"results\": [\n");
+    for (i=0; i<nresults; i++) {
+        fprintf(fp, "    { \"name\": \"%s\", \"iterations\": %d, \"ns_per_op\": %.2f, \"ns_per_op_min\": %.2f, \"allocs_per_op\": %.3f }%s\n",
+                results[i].name, results[i].iterations, results[i].ns_per_op, results[i].ns_per_op_min,
+                results[i].allocs_per_op, (i < nresults-1) ? "," : "");
+    }
+    fprintf(fp, "  ]\n");
+    fprintf(fp, "}\n");
+}
+
+// ************* main program **********************
+ int
+ main(int argc, char **argv)
+ {
+    char* sw; // used for command-line arguments
+    int n = DEFAULT_ITERATIONS;
+    FILE* fp = stdout;
+    double coeff[IIR_MAX_SECTIONS][5];
+    int i;
+
+    sw = getCmdOption(argv, argv + argc, "-n");
+    if (sw) {
+        sscanf(sw, "%d", &n);
+        if (n < 10) n = 10;
+    }
+    sw = getCmdOption(argv, argv + argc, "-o");
+    if (sw) {
+        if ((fp = fopen(sw, "w")) == NULL) {
+            printf("can't create '%s'!\n", sw);
+            return(1);
+        }
+    }
+
+    do_log = 0;
+    if (getenv("WAVEMINER_I2C") == NULL) i2c_set_transport(&i2c_null_transport);
+    // the coefficients come from the same design code the tools use
+    for (i=0; i<NOTCH_SETS; i++) {
+        biquad_notch(notch_coeff[i], BIQUAD_FS, 40 + i*61, BIQUAD_NOTCH_Q, 0);
+    }
+    biquad_words(notch_coeff[0], notch_words[0]);
+    biquad_words(notch_coeff[1], notch_words[1]);
+    iir_design(coeff, IIR_BUTTERWORTH, IIR_LOWPASS, 6, BIQUAD_FS, 2500, 1, 60);
+    for (i=0; i<15; i++) {
+        dfilter_coeff[i] = ((i % 5) < 3) ? coeff[i/5][i % 5] : 0-coeff[i/5][i % 5]; // a1, a2 as stored
+    }
+    dfilter_b0 = dfilter_coeff[0];
+
+    run_bench("double_to_5_23_format", b_double_to_5_23, n);
+    run_bench("fixed_5_23_encode_15", b_encode_bank, n);
+    run_bench("dsp_5_19_format_to_double", b_5_19_to_double, n);
+    run_bench("swap_order", b_swap_order, n);
+    run_bench("notch_design", b_notch_design, n);
+    run_bench("iir_design_butter6", b_iir_butter6, n/10);
+    run_bench("iir_design_ellip12", b_iir_ellip12, n/100);
+
+    // every write reaches the transport
+    setenv("WAVEMINER_SHADOW", "off", 1);
+    dsp_open();
+    run_bench("set_gen_2nd_order_filter", b_gen_2nd_order, n);
+    run_bench("set_gen_2nd_order_filter_safeload", b_gen_2nd_order_safeload, n);
+    run_bench("set_gen_2nd_order_filter_words", b_gen_2nd_order_words, n);
+    run_bench("set_dfilter6", b_dfilter6, n);
+    run_bench("notch_update", b_notch_update, n/4);
+    run_bench("filter_update", b_filter_update, n/100);
+    dsp_close();
+
+    // with the shadow cache, using a file of its own
+    setenv("WAVEMINER_SHADOW", BENCH_SHADOW, 1);
+    dsp_open();
+    run_bench("set_gen_2nd_order_filter_unchanged", b_gen_2nd_order_unchanged, n);
+    dsp_close();
+    unlink(BENCH_SHADOW);
+
+    print_json(fp);
+    if (fp != stdout) fclose(fp);
+
+    return(0);
+ }
@@ -0,0 +1,165 @@
+/*****************************************************
+ * dspd - DSP Control Daemon
+ * rev 1 - october 2026
+ *
+ * Keeps the I2C handle to the DSP open and accepts
+ * parameter commands over a Unix domain socket, so
+ * that clients (such as the web front-end) do not pay
+ * for a process start and dsp_open() per update.
+ * The packet format is described in dspd.h
+ *
+ * Works with any of the .bin apps, since the client
+ * supplies the parameter addresses.
+ *
+ * Example to start the daemon on the default socket:
+ *      ./dspd
+ * Example to use a different socket path, with logging:
+ *      ./dspd -s /run/dspd.sock -v
+ *****************************************************/
+
+// includes
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <errno.h>
+ #include <signal.h>
+ #include <unistd.h>
+ #include <poll.h>
+ #include <sys/socket.h>
+ #include <sys/un.h>
+ #include "options.h"
+ #include "dsputil.h"
+ #include "dspd.h"
+
+// defines
+
+// externs
+extern char do_log;
+
+// globals
+volatile sig_atomic_t do_quit = 0;
+
+// ************* functions *************************
+
+void
+sig_handler(int sig)
+{
+    do_quit = 1;
+}
+
+// create the listening socket, removing any stale one first
+int
+open_listener(const char* path)
+{
+    int fd;
+    struct sockaddr_un sa;
+
+    fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    if (fd < 0) {
+        fprintf(stderr, "dspd socket error: %s\n", strerror(errno));
+        return(-1);
+    }
+    memset(&sa, 0, sizeof(sa));
+    sa.sun_family = AF_UNIX;
+    strncpy(sa.sun_path, path, sizeof(sa.sun_path)-1);
+    unlink(path);
+    if (bind(fd, (struct sockaddr*)&sa, sizeof(sa)) < 0) {
+        fprintf(stderr, "dspd bind error: %s\n", strerror(errno));
+        close(fd);
+        return(-1);
+    }
+    if (listen(fd, DSPD_MAX_CLIENTS) < 0) {
+        fprintf(stderr, "dspd listen error: %s\n", strerror(errno));
+        close(fd);
+        return(-1);
+    }
+    return(fd);
+}
+
+// ************* main program **********************
+ int
+ main(int argc, char **argv)
+ {
+    char* sw; // used for command-line arguments
+    char sock_path[108] = DSPD_SOCK_PATH;
+    struct pollfd pfd[DSPD_MAX_CLIENTS+1];
+    int nfds = 1;
+    int listen_fd;
+    int fd, i, n;
+    unsigned char pkt[sizeof(dspd_req_t)+1];
+    dspd_resp_t resp;
+
+    do_log = 0; // per-write logging is off unless requested
+
+    // read in the command-line arguments
+    sw = getCmdOption(argv, argv + argc, "-s");
+    if (sw) {
+        strncpy(sock_path, sw, sizeof(sock_path)-1);
+    }
+
+    if (cmdOptionExists(argv, argv + argc, "-v")) {
+        do_log = 1;
+    }
+
+    signal(SIGINT, sig_handler);
+    signal(SIGTERM, sig_handler);
+    signal(SIGPIPE, SIG_IGN);
+
+    listen_fd = open_listener(sock_path);
+    if (listen_fd < 0) exit(1);
+
+    dsp_open(); // create I2C handle for the DSP, held for the life of the daemon
+    printf("dspd listening on %s\n", sock_path);
+
+    pfd[0].fd = listen_fd;
+    pfd[0].events = POLLIN;
+
+    while (!do_quit) {
+        if (poll(pfd, nfds, -1) < 0) {
+            if (errno == EINTR) continue;
+            fprintf(stderr, "dspd poll error: %s\n", strerror(errno));
+            break;
+        }
+        // new client
+        if (pfd[0].revents & POLLIN) {
+            fd = accept(listen_fd, NULL, NULL);
+            if (fd >= 0) {
+                if (nfds > DSPD_MAX_CLIENTS) {
+                    close(fd); // too many clients
+                } else {
+                    pfd[nfds].fd = fd;
+                    pfd[nfds].events = POLLIN;
+                    pfd[nfds].revents = 0;
+                    nfds++;
+                }
+            }
+        }
+        // requests from existing clients; one packet is one command
+        for (i=1; i<nfds; i++) {
+            if (pfd[i].revents == 0) continue;
+            n = -1;
+            if (pfd[i].revents & POLLIN) {
+                n = recv(pfd[i].fd, pkt, sizeof(pkt), 0);
+            }
+            if (n <= 0) { // client went away
+                close(pfd[i].fd);
+                pfd[i] = pfd[nfds-1];
+                nfds--;
+                i--;
+                continue;
+            }
+            n = dspd_dispatch(pkt, n, &resp);
+            send(pfd[i].fd, &resp, n, 0);
+        }
+    }
+
+    for (i=1; i<nfds; i++) {
+        close(pfd[i].fd);
+    }
+    close(listen_fd);
+    unlink(sock_path);
+
+    dsp_close(); // close the I2C resource for the DSP
+
+    return(0);
+ }
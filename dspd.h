@@ -0,0 +1,78 @@
+#ifndef __DSPD_HEADER_FILE__
+#define __DSPD_HEADER_FILE__
+
+/**********************************************************
+ * dspd.h - binary protocol used by the dspd control daemon
+ * rev 1 - october 2026
+ *
+ * Clients connect to a Unix domain socket of type
+ * SOCK_SEQPACKET, so each request and each response is
+ * exactly one packet. Multi-byte fields use the native
+ * byte order of the Pi (the socket never leaves the host).
+ **********************************************************/
+
+#include <stdint.h>
+
+#define DSPD_SOCK_PATH "/tmp/dspd.sock"
+#define DSPD_MAX_CLIENTS 16
+
+// commands, these map one-to-one onto the dsputil functions
+#define DSPD_PING 0x00
+#define DSPD_SET_FREQ 0x01                // i: frequency in Hz
+#define DSPD_SET_AMP 0x02                 // d: amplitude
+#define DSPD_SET_MUTE 0x03                // i: 1 to mute
+#define DSPD_SET_PITCH 0x04               // d: pitch
+#define DSPD_SET_GEN_2ND_ORDER_FILTER 0x05 // coeff[5]: b0, b1, b2, a1, a2
+#define DSPD_SET_DFILTER6 0x06            // coeff[15]
+#define DSPD_SET_DFILTER6_BYPASS 0x07     // no payload
+#define DSPD_SET_SWITCH 0x08              // i: 0=off, otherwise on
+#define DSPD_SET_SINPHASE_FREQ 0x09       // i: frequency in Hz
+#define DSPD_SET_SINPHASE_GAIN 0x0a       // d: gain
+#define DSPD_SET_SINPHASE_PHASE 0x0b      // i: angle in degrees
+#define DSPD_SET_DC_INT 0x0c              // i: 28-bit signed (saturated)
+#define DSPD_SET_DC_FLOAT 0x0d            // d: value
+#define DSPD_SET_DC_FLOAT_SAFELOAD 0x0e   // d: value
+#define DSPD_READBACK 0x0f                // i: node, response carries the value
+#define DSPD_READBACK_FAST 0x10           // i: node, as above using readback_fast
+#define DSPD_SET_GEN_2ND_ORDER_FILTER_SAFELOAD 0x11 // coeff[5]: b0, b1, b2, a1, a2
+#define DSPD_NUM_CMDS 0x12
+
+// response status values
+#define DSPD_OK 0
+#define DSPD_ERR_CMD 1  // unknown command
+#define DSPD_ERR_LEN 2  // packet length does not match the command
+#define DSPD_ERR_BUS 3  // an I2C transfer to the DSP failed
+
+// request header is 4 bytes, followed by the payload for the command
+typedef struct __attribute__((packed)) {
+    uint8_t cmd;
+    uint8_t seq;   // echoed back in the response, for use by the client
+    uint16_t addr; // DSP parameter address (or 0x081a/0x081b for readback)
+} dspd_hdr_t;
+
+typedef struct __attribute__((packed)) {
+    dspd_hdr_t hdr;
+    union __attribute__((packed)) {
+        int32_t i;
+        double d;
+        double coeff[15];
+    } u;
+} dspd_req_t;
+
+typedef struct __attribute__((packed)) {
+    uint8_t status;
+    uint8_t seq;
+    uint16_t reserved;
+    double value;  // only meaningful for DSPD_READBACK
+} dspd_resp_t;
+
+// size of a request packet for a given payload type
+#define DSPD_REQ_LEN(payload) (sizeof(dspd_hdr_t) + (payload))
+
+// decodes one request packet of len bytes and calls the matching dsputil
+// function (see dspdisp.cpp). The socket is not involved, so it can be
+// driven directly. dsp_open() must have been called.
+// returns the length of the response in resp
+int dspd_dispatch(const unsigned char* pkt, int len, dspd_resp_t* resp);
+
+#endif // __DSPD_HEADER_FILE__
@@ -0,0 +1,125 @@
+/**********************************************************
+ * dspdisp.cpp - request decoding for the dspd daemon
+ *
+ * Kept apart from the socket handling in dspd.cpp, so
+ * that the dispatcher can be linked into a test and run
+ * against the fake bus without a client.
+ **********************************************************/
+
+// includes
+ #include <string.h>
+ #include "dsputil.h"
+ #include "dspd.h"
+
+// externs
+extern char dsp_bus_error;
+
+// payload length expected for each command
+const int cmd_len[DSPD_NUM_CMDS] = {
+    0,                  // DSPD_PING
+    sizeof(int32_t),    // DSPD_SET_FREQ
+    sizeof(double),     // DSPD_SET_AMP
+    sizeof(int32_t),    // DSPD_SET_MUTE
+    sizeof(double),     // DSPD_SET_PITCH
+    5*sizeof(double),   // DSPD_SET_GEN_2ND_ORDER_FILTER
+    15*sizeof(double),  // DSPD_SET_DFILTER6
+    0,                  // DSPD_SET_DFILTER6_BYPASS
+    sizeof(int32_t),    // DSPD_SET_SWITCH
+    sizeof(int32_t),    // DSPD_SET_SINPHASE_FREQ
+    sizeof(double),     // DSPD_SET_SINPHASE_GAIN
+    sizeof(int32_t),    // DSPD_SET_SINPHASE_PHASE
+    sizeof(int32_t),    // DSPD_SET_DC_INT
+    sizeof(double),     // DSPD_SET_DC_FLOAT
+    sizeof(double),     // DSPD_SET_DC_FLOAT_SAFELOAD
+    sizeof(int32_t),    // DSPD_READBACK
+    sizeof(int32_t),    // DSPD_READBACK_FAST
+    5*sizeof(double)    // DSPD_SET_GEN_2ND_ORDER_FILTER_SAFELOAD
+};
+
+// ************* functions *************************
+
+// decode one request packet and call the matching dsputil function
+int
+dspd_dispatch(const unsigned char* pkt, int len, dspd_resp_t* resp)
+{
+    dspd_req_t req;
+    double coeff[15]; // aligned copy of the packed coefficients
+    int addr;
+
+    memset(resp, 0, sizeof(dspd_resp_t));
+    if (len < (int)sizeof(dspd_hdr_t)) {
+        resp->status = DSPD_ERR_LEN;
+        return(sizeof(dspd_resp_t));
+    }
+    memcpy(&req, pkt, (len > (int)sizeof(req)) ? sizeof(req) : len);
+    resp->seq = req.hdr.seq;
+    if (req.hdr.cmd >= DSPD_NUM_CMDS) {
+        resp->status = DSPD_ERR_CMD;
+        return(sizeof(dspd_resp_t));
+    }
+    if (len != (int)DSPD_REQ_LEN(cmd_len[req.hdr.cmd])) {
+        resp->status = DSPD_ERR_LEN;
+        return(sizeof(dspd_resp_t));
+    }
+
+    addr = req.hdr.addr;
+    dsp_bus_error = 0;
+    memcpy(coeff, (const void*)req.u.coeff, cmd_len[req.hdr.cmd] < (int)sizeof(coeff) ? cmd_len[req.hdr.cmd] : sizeof(coeff));
+    switch (req.hdr.cmd) {
+        case DSPD_PING:
+            break;
+        case DSPD_SET_FREQ:
+            set_freq(addr, req.u.i);
+            break;
+        case DSPD_SET_AMP:
+            set_amp(addr, req.u.d);
+            break;
+        case DSPD_SET_MUTE:
+            set_mute(addr, (char)req.u.i);
+            break;
+        case DSPD_SET_PITCH:
+            set_pitch(addr, req.u.d);
+            break;
+        case DSPD_SET_GEN_2ND_ORDER_FILTER:
+            set_gen_2nd_order_filter(addr, coeff);
+            break;
+        case DSPD_SET_DFILTER6:
+            set_dfilter6(addr, coeff);
+            break;
+        case DSPD_SET_DFILTER6_BYPASS:
+            set_dfilter6_bypass(addr);
+            break;
+        case DSPD_SET_SWITCH:
+            set_switch(addr, req.u.i);
+            break;
+        case DSPD_SET_SINPHASE_FREQ:
+            set_sinphase_freq(addr, req.u.i);
+            break;
+        case DSPD_SET_SINPHASE_GAIN:
+            set_sinphase_gain(addr, req.u.d);
+            break;
+        case DSPD_SET_SINPHASE_PHASE:
+            set_sinphase_phase(addr, req.u.i);
+            break;
+        case DSPD_SET_DC_INT:
+            set_dc_int(addr, req.u.i);
+            break;
+        case DSPD_SET_DC_FLOAT:
+            set_dc_float(addr, req.u.d);
+            break;
+        case DSPD_SET_DC_FLOAT_SAFELOAD:
+            set_dc_float_safeload(addr, req.u.d);
+            break;
+        case DSPD_READBACK:
+            resp->value = readback(addr, req.u.i);
+            break;
+        case DSPD_READBACK_FAST:
+            resp->value = readback_fast(addr, req.u.i);
+            break;
+        case DSPD_SET_GEN_2ND_ORDER_FILTER_SAFELOAD:
+            set_gen_2nd_order_filter_safeload(addr, coeff);
+            break;
+    }
+    resp->status = dsp_bus_error ? DSPD_ERR_BUS : DSPD_OK;
+    return(sizeof(dspd_resp_t));
+}
@@ -0,0 +1,285 @@
+/*******************************
+ * dsplog.c
+ * deferred logging through a
+ * lock-free ring
+ * rev 1 october 2026
+ *
+ * The ring is a bounded multi-producer, single-consumer queue.
+ * Each slot has a sequence number: a producer claims the slot
+ * for position pos when its sequence is pos, by moving head on
+ * with a compare-and-swap, and hands it over by setting the
+ * sequence to pos+1. The consumer takes it at that point and
+ * frees it for the next lap by setting it to pos+DSP_LOG_RING.
+ * Only the consumer side has a lock, for dsp_log_flush().
+ *******************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "i2cfunc.h"
+#include "dsplog.h"
+
+typedef union {
+  long long i;
+  double d;
+  const void* p;
+} log_arg_t;
+
+typedef struct {
+  uint64_t seq;
+  unsigned long long t_ns;
+  const char* fmt;
+  int level;
+  int nargs;
+  log_arg_t arg[DSP_LOG_MAX_ARGS];
+  char str[DSP_LOG_STR];
+} log_rec_t;
+
+uint64_t dsp_log_dropped=0;
+
+static log_rec_t ring[DSP_LOG_RING];
+static uint64_t head=0;          // next position for a producer
+static uint64_t tail=0;          // next position for the consumer
+static int log_level=-1;         // -1 until read from the environment
+static char log_time=0;
+static unsigned long long log_t0=0;
+static char started=0;            // set by the first message
+static char thread_running=0;
+static volatile char stopping=0;
+static pthread_t drain_thread;
+static pthread_mutex_t consumer_lock=PTHREAD_MUTEX_INITIALIZER;
+
+// ************* formatting (consumer side) *************
+
+// length of the conversion at fmt (which points at a '%'), and its type:
+// 'i' int, 'L' long, 'l' long long, 'd' double, 's' string, 'p' pointer, '%' none
+static int conv_len(const char* fmt, char* type)
+{
+  int n=1;
+  int longs=0;
+  while (fmt[n] && strchr("-+ #0", fmt[n])) n++;
+  while (((fmt[n]>='0') && (fmt[n]<='9')) || (fmt[n]=='.')) n++;
+  while ((fmt[n]=='l') || (fmt[n]=='h') || (fmt[n]=='z'))
+  {
+    if ((fmt[n]=='l') || (fmt[n]=='z')) longs++;
+    n++;
+  }
+  switch (fmt[n])
+  {
+    case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+      *type=(longs==0) ? 'i' : ((longs==1) ? 'L' : 'l');
+      break;
+    case 'f': case 'F': case 'g': case 'G': case 'e': case 'E':
+      *type='d';
+      break;
+    case 's':
+      *type='s';
+      break;
+    case 'p':
+      *type='p';
+      break;
+    case '%':
+      *type='%';
+      break;
+    default:
+      *type=0; // not supported, printed as it is
+      return(n);
+  }
+  return(n+1);
+}
+
+static void print_rec(log_rec_t* r)
+{
+  char spec[32];
+  const char* f=r->fmt;
+  char type;
+  int n, a=0;
+
+  if (log_time) printf("[%12.6f] ", (r->t_ns-log_t0)/1e9);
+  while (*f)
+  {
+    if (*f!='%')
+    {
+      putchar(*f++);
+      continue;
+    }
+    n=conv_len(f, &type);
+    if ((type==0) || (n>=(int)sizeof(spec)) || ((type!='%') && (a>=r->nargs)))
+    {
+      fwrite(f, 1, n, stdout);
+      f+=n;
+      continue;
+    }
+    memcpy(spec, f, n);
+    spec[n]=0;
+    switch (type)
+    {
+      case 'i': printf(spec, (int)r->arg[a++].i); break;
+      case 'L': printf(spec, (long)r->arg[a++].i); break;
+      case 'l': printf(spec, r->arg[a++].i); break;
+      case 'd': printf(spec, r->arg[a++].d); break;
+      case 'p': printf(spec, r->arg[a++].p); break;
+      case 's': printf(spec, r->str); a++; break;
+      default: putchar('%'); break;
+    }
+    f+=n;
+  }
+}
+
+// prints the messages that are ready. returns the number printed
+static int drain(void)
+{
+  log_rec_t* r;
+  int n=0;
+
+  pthread_mutex_lock(&consumer_lock);
+  for (;;)
+  {
+    r=&ring[tail & (DSP_LOG_RING-1)];
+    if (__atomic_load_n(&r->seq, __ATOMIC_ACQUIRE)!=tail+1) break;
+    if (r->level<=log_level) print_rec(r);
+    __atomic_store_n(&r->seq, tail+DSP_LOG_RING, __ATOMIC_RELEASE);
+    tail++;
+    n++;
+  }
+  if (n) fflush(stdout);
+  pthread_mutex_unlock(&consumer_lock);
+  return(n);
+}
+
+static void* drain_loop(void* arg)
+{
+  struct timespec a;
+  a.tv_sec=0;
+  a.tv_nsec=DSP_LOG_DRAIN_MS*1000000L;
+  while (!stopping)
+  {
+    if (drain()==0) nanosleep(&a, NULL);
+  }
+  return(NULL);
+}
+
+static void log_exit(void)
+{
+  stopping=1;
+  if (thread_running) pthread_join(drain_thread, NULL);
+  drain();
+  if (dsp_log_dropped) printf("%llu log messages were dropped\n", (unsigned long long)dsp_log_dropped);
+}
+
+// ************* logging (producer side) *************
+
+static void log_init(void)
+{
+  const char* names[]={"error", "warn", "info", "debug"};
+  const char* env;
+  int i;
+
+  log_level=LOG_DEBUG;
+  env=getenv("WAVEMINER_LOG_LEVEL");
+  if (env)
+  {
+    if ((env[0]>='0') && (env[0]<='9')) log_level=atoi(env);
+    for (i=0; i<4; i++)
+    {
+      if (strcmp(env, names[i])==0) log_level=i;
+    }
+  }
+  env=getenv("WAVEMINER_LOG_TIME");
+  log_time=(env && (strcmp(env, "1")==0));
+  for (i=0; i<DSP_LOG_RING; i++)
+  {
+    ring[i].seq=i;
+  }
+}
+
+int dsp_log_enabled(int level)
+{
+  if (log_level<0) log_init();
+  return(level<=log_level);
+}
+
+void dsp_log(int level, const char* fmt, ...)
+{
+  va_list ap;
+  log_rec_t* r;
+  uint64_t pos, seq;
+  const char* f;
+  const char* s;
+  char type;
+  int n;
+
+  if (!dsp_log_enabled(level)) return;
+  if (!started)
+  {
+    // first message, which in practice is from the main thread
+    // (if there's no thread, the messages are printed by dsp_log_flush or at exit)
+    started=1;
+    log_t0=monotonic_ns();
+    atexit(log_exit);
+    thread_running=(pthread_create(&drain_thread, NULL, drain_loop, NULL)==0);
+  }
+
+  // claim a slot
+  pos=__atomic_load_n(&head, __ATOMIC_RELAXED);
+  for (;;)
+  {
+    r=&ring[pos & (DSP_LOG_RING-1)];
+    seq=__atomic_load_n(&r->seq, __ATOMIC_ACQUIRE);
+    if (seq==pos)
+    {
+      if (__atomic_compare_exchange_n(&head, &pos, pos+1, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) break;
+    }
+    else if (seq<pos)
+    {
+      __atomic_fetch_add(&dsp_log_dropped, 1, __ATOMIC_RELAXED); // full
+      return;
+    }
+    else
+    {
+      pos=__atomic_load_n(&head, __ATOMIC_RELAXED);
+    }
+  }
+
+  r->t_ns=log_time ? monotonic_ns() : 0;
+  r->fmt=fmt;
+  r->level=level;
+  r->nargs=0;
+  r->str[0]=0;
+  va_start(ap, fmt);
+  for (f=fmt; *f && (r->nargs<DSP_LOG_MAX_ARGS); f++)
+  {
+    if (*f!='%') continue;
+    n=conv_len(f, &type);
+    switch (type)
+    {
+      case 'i': r->arg[r->nargs++].i=va_arg(ap, int); break;
+      case 'L': r->arg[r->nargs++].i=va_arg(ap, long); break;
+      case 'l': r->arg[r->nargs++].i=va_arg(ap, long long); break;
+      case 'd': r->arg[r->nargs++].d=va_arg(ap, double); break;
+      case 'p': r->arg[r->nargs++].p=va_arg(ap, void*); break;
+      case 's':
+        s=va_arg(ap, const char*);
+        if (r->str[0]==0)
+        {
+          strncpy(r->str, s ? s : "(null)", DSP_LOG_STR-1);
+          r->str[DSP_LOG_STR-1]=0;
+        }
+        r->nargs++;
+        break;
+      default:
+        break;
+    }
+    f+=n-1;
+  }
+  va_end(ap);
+  __atomic_store_n(&r->seq, pos+1, __ATOMIC_RELEASE);
+}
+
+void dsp_log_flush(void)
+{
+  drain();
+}
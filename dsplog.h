@@ -0,0 +1,50 @@
+/************************************
+ * dsplog.h
+ * deferred logging: messages are kept
+ * unformatted in a lock-free ring and
+ * printed by a background thread
+ *
+ * rev 1 october 2026
+ ************************************/
+
+#ifndef __DSPLOG_HEADER_FILE__
+#define __DSPLOG_HEADER_FILE__
+
+#include <stdint.h>
+
+// dsp_log() only stores the format pointer, the arguments and the time, so
+// the caller does no formatting and no I/O. A background thread (started on
+// the first message) formats and prints the messages on stdout soon after,
+// and whatever is left is printed at exit. If the ring fills up, messages
+// are dropped rather than making the caller wait; the number dropped is
+// printed at exit.
+//
+// WAVEMINER_LOG_LEVEL sets the most detailed level printed, as a name or
+// a number (default debug, everything). WAVEMINER_LOG_TIME=1 puts the time
+// of each message (in seconds since the first one) in front of it.
+
+#define LOG_ERROR 0
+#define LOG_WARN 1
+#define LOG_INFO 2
+#define LOG_DEBUG 3
+
+#define DSP_LOG_RING 4096      // messages, a power of 2
+#define DSP_LOG_MAX_ARGS 8
+#define DSP_LOG_STR 40         // bytes kept of a %s argument (only one per message)
+#define DSP_LOG_DRAIN_MS 5     // how often the background thread looks for messages
+
+// fmt must be a string literal (or otherwise last until exit), it is not copied.
+// The conversions supported are those of printf for integers (with l, ll, h, hh),
+// doubles, characters, pointers and a single string
+void dsp_log(int level, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+// returns 1 if messages of this level are printed
+int dsp_log_enabled(int level);
+
+// prints every message logged so far, before returning
+void dsp_log_flush(void);
+
+// messages dropped because the ring was full
+extern uint64_t dsp_log_dropped;
+
+#endif // __DSPLOG_HEADER_FILE__
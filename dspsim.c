@@ -0,0 +1,260 @@
+/*******************************
+ * dspsim.c
+ * behavioural model of the audio
+ * path of the ADAU1401 apps
+ * rev 1 october 2026
+ *
+ * Each app profile has an optional sine generator (the
+ * Sine Tone and volume parameters, see set_freq and set_amp)
+ * feeding the output, a loopback wire back to the input, and
+ * one or more paths from the input to a readback node. A path
+ * is a cascade of biquads (set_gen_2nd_order_filter and
+ * set_dfilter6 layout: b0, b1, b2, a1, a2 as stored in the DSP),
+ * a gain, and a mean square detector. The paths are independent,
+ * so long runs process them in parallel, one thread per path.
+ *******************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <pthread.h>
+#include "i2cfake.h"
+#include "dspsim.h"
+#include "fixedpoint.h"
+
+typedef struct {
+  int node;     // readback node
+  int nbiquads;
+  int biquad_addr[SIM_MAX_BIQUADS];
+  double gain;  // before the detector, the result is clipped to SIM_CLIP
+} sim_path_t;
+
+typedef struct {
+  const char* name;
+  int sin_addr; // -1 if the app has no generator (the input is then external)
+  int amp_addr;
+  int npaths;
+  sim_path_t path[SIM_MAX_PATHS];
+} sim_profile_t;
+
+// parameter addresses and nodes, as used by the tools
+static const sim_profile_t profiles[] = {
+  { "freqresp", 0x0000, 0x0003, 1, {
+      { 0x00fe, 0, {0}, 1.0 } } },
+  { "level", -1, -1, 1, {
+      { 0x010a, 0, {0}, 1.0 } } },
+  { "thd", 0x0000, 0x0003, 2, {
+      { 0x019e, 4, {0x0004, 0x0009, 0x000e, 0x0013}, 1.0 },
+      { 0x01da, 4, {0x0004, 0x0009, 0x000e, 0x0013}, 100.0 } } },
+  { "rms", -1, -1, 2, {
+      { 0x028a, 6, {0x0006, 0x000b, 0x0010, 0x0015, 0x001a, 0x001f}, 1.0 },
+      { 0x031e, 6, {0x0006, 0x000b, 0x0010, 0x0015, 0x001a, 0x001f}, 100.0 } } },
+};
+
+typedef struct {
+  const sim_path_t* p;
+  double z[SIM_MAX_BIQUADS][4]; // x1, x2, y1, y2 of each biquad
+  double coeff[SIM_MAX_BIQUADS][5];
+  double det1, det2;            // detector stages
+  const double* in;             // block being processed
+  int n;
+} path_state_t;
+
+static const sim_profile_t* prof=NULL;
+static path_state_t state[SIM_MAX_PATHS];
+static double gen_phase=0.0;    // generator phase, 2.0 is a full cycle
+static double in_phase=0.0;     // external input phase
+static double in_inc=2.0*SIM_INPUT_HZ/SIM_FS;
+static double in_amp=SIM_INPUT_AMP;
+static double sample_carry=0.0; // fraction of a sample left over from the last sleep
+static unsigned long long samples_run=0;
+static uint32_t noise_seed=12345;
+static double in_buf[SIM_BLOCK];
+static double det_k;            // detector smoothing factor per sample
+
+// parameter RAM word in 5.23 format, the top 4 bits of the 32 are unused
+static double param(int addr)
+{
+  return(fixed_5_23::decode(fake_state()->param[addr]));
+}
+
+// approximately normal noise, sum of uniform values
+static double noise(void)
+{
+  double s=0.0;
+  int i;
+  for (i=0; i<4; i++)
+  {
+    noise_seed=noise_seed*1664525u+1013904223u;
+    s+=(noise_seed>>8)/16777216.0-0.5;
+  }
+  return(s*1.7320508); // 4 uniforms have a variance of 1/3
+}
+
+int dspsim_init(const char* app)
+{
+  const char* env;
+  double hz;
+  unsigned int i;
+
+  for (i=0; i<sizeof(profiles)/sizeof(profiles[0]); i++)
+  {
+    if (strcmp(app, profiles[i].name)==0) prof=&profiles[i];
+  }
+  if (prof==NULL)
+  {
+    fprintf(stderr, "dspsim_init error: no model of app '%s'\n", app);
+    return(-1);
+  }
+  memset(state, 0, sizeof(state));
+  for (i=0; i<(unsigned int)prof->npaths; i++)
+  {
+    state[i].p=&prof->path[i];
+  }
+  det_k=1.0-exp(-1.0/(SIM_DETECT_TAU*SIM_FS));
+  env=getenv("WAVEMINER_SIM_INPUT");
+  if (env && (sscanf(env, "%lf:%lf", &hz, &in_amp)>=1))
+  {
+    in_inc=2.0*hz/SIM_FS;
+  }
+  return(0);
+}
+
+int dspsim_active(void)
+{
+  return(prof!=NULL);
+}
+
+// input samples for one block: the generator through the loopback, or the external input
+static void make_input(double* in, int n)
+{
+  double inc, amp, x;
+  int i;
+
+  if (prof->sin_addr>=0)
+  {
+    // Sine Tone: mask, increment (f/24000), on
+    inc=param(prof->sin_addr+1);
+    amp=param(prof->sin_addr+2)*param(prof->amp_addr);
+    for (i=0; i<n; i++)
+    {
+      in[i]=amp*sin(M_PI*(gen_phase+i*inc));
+    }
+    gen_phase=fmod(gen_phase+n*inc, 2.0);
+    for (i=0; i<n; i++)
+    {
+      x=in[i];
+      if (x>1.0) x=1.0; // DAC full scale
+      if (x<-1.0) x=-1.0;
+      in[i]=SIM_LOOP_GAIN*x + SIM_LOOP_H2*x*x + SIM_LOOP_H3*x*x*x;
+    }
+  }
+  else
+  {
+    for (i=0; i<n; i++)
+    {
+      in[i]=in_amp*sin(M_PI*(in_phase+i*in_inc));
+    }
+    in_phase=fmod(in_phase+n*in_inc, 2.0);
+  }
+  for (i=0; i<n; i++)
+  {
+    in[i]+=SIM_LOOP_NOISE*noise();
+  }
+}
+
+// biquads, gain and detector for one path over the current block
+static void* run_path(void* arg)
+{
+  path_state_t* s=(path_state_t*)arg;
+  const sim_path_t* p=s->p;
+  double x, y;
+  int i, b;
+
+  for (i=0; i<s->n; i++)
+  {
+    x=s->in[i];
+    for (b=0; b<p->nbiquads; b++)
+    {
+      // y = b0.x + b1.x1 + b2.x2 + a1.y1 + a2.y2, with a1 and a2 as stored in the DSP
+      y=s->coeff[b][0]*x + s->coeff[b][1]*s->z[b][0] + s->coeff[b][2]*s->z[b][1]
+        + s->coeff[b][3]*s->z[b][2] + s->coeff[b][4]*s->z[b][3];
+      s->z[b][1]=s->z[b][0];
+      s->z[b][0]=x;
+      s->z[b][3]=s->z[b][2];
+      s->z[b][2]=y;
+      x=y;
+    }
+    x*=p->gain;
+    if (x>SIM_CLIP) x=SIM_CLIP;
+    if (x<-SIM_CLIP) x=-SIM_CLIP;
+    s->det1+=det_k*(x*x-s->det1);
+    s->det2+=det_k*(s->det1-s->det2);
+  }
+  return(NULL);
+}
+
+static void run(unsigned long long nsamples)
+{
+  pthread_t th[SIM_MAX_PATHS];
+  char started[SIM_MAX_PATHS];
+  int n, i, b, k;
+
+  // parameters can only change between sleeps, so read them once
+  for (i=0; i<prof->npaths; i++)
+  {
+    for (b=0; b<state[i].p->nbiquads; b++)
+    {
+      for (k=0; k<5; k++)
+      {
+        state[i].coeff[b][k]=param(state[i].p->biquad_addr[b]+k);
+      }
+    }
+  }
+  while (nsamples>0)
+  {
+    n=(nsamples>SIM_BLOCK) ? SIM_BLOCK : (int)nsamples;
+    make_input(in_buf, n);
+    for (i=0; i<prof->npaths; i++)
+    {
+      state[i].in=in_buf;
+      state[i].n=n;
+      started[i]=(n>=SIM_THREAD_MIN) && (prof->npaths>1) &&
+                 (pthread_create(&th[i], NULL, run_path, &state[i])==0);
+      if (!started[i]) run_path(&state[i]);
+    }
+    for (i=0; i<prof->npaths; i++)
+    {
+      if (started[i]) pthread_join(th[i], NULL);
+    }
+    nsamples-=n;
+    samples_run+=n;
+  }
+}
+
+int dspsim_sleep(unsigned long long ns)
+{
+  double samples;
+
+  if (prof==NULL) return(0);
+  samples=sample_carry+((double)ns*SIM_FS)/1.0e9;
+  sample_carry=samples-floor(samples);
+  run((unsigned long long)floor(samples));
+  return(1);
+}
+
+double dspsim_probe(int node)
+{
+  unsigned long long warmup=(unsigned long long)SIM_WARMUP_MS*SIM_FS/1000;
+  int i;
+
+  if (prof==NULL) return(0.0);
+  if (samples_run<warmup) run(warmup-samples_run);
+  for (i=0; i<prof->npaths; i++)
+  {
+    if (prof->path[i].node==node) return(state[i].det2);
+  }
+  return(0.0);
+}
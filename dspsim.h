@@ -0,0 +1,53 @@
+/************************************
+ * dspsim.h
+ * behavioural model of the audio path
+ * of the ADAU1401 apps, driven by the
+ * parameter RAM of the fake DSP
+ *
+ * rev 1 october 2026
+ ************************************/
+
+#ifndef __DSPSIM_HEADER_FILE__
+#define __DSPSIM_HEADER_FILE__
+
+// The model is turned on by naming the app in WAVEMINER_SIM, with the
+// fake transport or i2cshim.so:
+//   freqresp, level, thd, rms
+// Load the app into the fake DSP first (eeload -r, with WAVEMINER_FAKE_STATE
+// set) so that parameter RAM holds its power-up values.
+// While the model is on, time is virtual: delay_ms() and delay_us() (or
+// nanosleep, with the shim) return straight away, after running the model
+// for the time that would have passed. Sweeps therefore run much faster than
+// on the board.
+
+#define SIM_FS 48000            // sample rate
+#define SIM_MAX_PATHS 4         // detector paths (channels) per app
+#define SIM_MAX_BIQUADS 8       // cascaded biquads per path
+#define SIM_BLOCK 65536         // samples processed per block (1.4 sec)
+#define SIM_THREAD_MIN 4800     // run the paths in parallel for this many samples or more
+#define SIM_DETECT_TAU 0.05     // time constant (sec) of each of the two detector averaging stages
+#define SIM_WARMUP_MS 500       // the DSP is taken to have been running this long when first read
+#define SIM_CLIP 16.0           // largest value in 5.23 format
+
+// loopback wire from the output to the input, and the converter imperfections
+#define SIM_LOOP_GAIN 1.0
+#define SIM_LOOP_H2 1.0e-4      // second harmonic, relative
+#define SIM_LOOP_H3 1.0e-4      // third harmonic, relative
+#define SIM_LOOP_NOISE 1.0e-6   // rms noise
+
+// external input for apps without a generator, override with
+// WAVEMINER_SIM_INPUT=<Hz>:<amplitude>
+#define SIM_INPUT_HZ 1000.0
+#define SIM_INPUT_AMP 0.5
+
+// turns the model on for an app. returns 0, or -1 for an unknown app
+int dspsim_init(const char* app);
+// returns 1 if the model is on
+int dspsim_active(void);
+// runs the model for ns nanoseconds of virtual time.
+// returns 1 if the model is on (so the caller should not really sleep), otherwise 0
+int dspsim_sleep(unsigned long long ns);
+// value of the detector at a readback node, 0 for a node the app doesn't have
+double dspsim_probe(int node);
+
+#endif // __DSPSIM_HEADER_FILE__
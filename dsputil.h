@@ -7,6 +7,11 @@
 #define I2CBUS 1
 #define WPGPIO 4
 #define BLOCKSIZE 32
+#define EE_SIZE 32768            // 24xx256 EEPROM
+#define EE_WRITE_TIMEOUT_MS 20   // longest a page write cycle may take
+#define EE_POLL_US 200           // time between ACK polls while the EEPROM is busy
+#define EE_PAGE_WRITE_MS 5       // typical page write cycle, for time saved estimates
+#define EE_READ_CHUNK 4096       // bytes per sequential read
 #define TWOPOW23 8388608.0
 #define SQROOT2 1.4142135623731
 #define PI 3.1415926535897932384626433832795
@@ -16,23 +21,109 @@
 #define SAFE_ADDR0 0x0815
 #define SAFE_INITIATE 0x081c
 #define SAFE_SET_IST 0x003c
-
+#define SAFE_SLOTS 5 // SAFE_DATA0-4 and SAFE_ADDR0-4
+
+// ADAU1401 core control register, and the value that the SigmaStudio
+// self-boot images write to it to hold the core while they load
+#define CORE_CTRL 0x081c
+#define CORE_CTRL_HOLD 0x0058
+
+// self-boot (EEPROM) image message types
+#define BOOT_END 0x00
+#define BOOT_WRITE 0x01
+#define BOOT_DELAY 0x02
+#define BOOT_NOP 0x03
+#define BOOT_END_IMAGE 0x06 // written after the last message by SigmaStudio
+
+// largest number of 4-byte parameter words sent in one burst write
+#define BURST_WORDS 64
+
+// readback settle time used by readback_fast() unless set per node.
+// The capture register is updated once per audio frame (20.8 usec at 48 kHz)
+#define READBACK_SETTLE_US 21
+#define READBACK_MAX_NODES 16 // nodes that can have their own settle time
+
+// phase timing, for latbench. If WAVEMINER_PHASES names a file, each run of
+// a tool appends one line to it at exit, with the monotonic_ns() times at
+// which main() was about to be called, dsp_open() was called and returned
+// (0 if it wasn't), and the exit started, followed by the time spent in I2C
+// transactions (in total, and inside dsp_open) and in delay_ms/delay_us
+#define DSP_PHASE_FORMAT "main %llu open %llu opened %llu exit %llu bus %llu open_bus %llu sleep %llu transactions %llu sleeps %llu\n"
+#define DSP_PHASE_FIELDS 9
 
 // functions to open and close I2C communication with the DSP
+// dsp_open() also maps the parameter shadow cache if it is on (see shadow.h),
+// and clears it if the DSP no longer holds every value it remembers
 void dsp_open(void);
 void dsp_close(void);
+void dsp_shadow_verify(void);
+
+// batched writes: between dsp_batch_begin() and dsp_batch_end() the
+// set_* functions queue their writes, and they are sent together in as
+// few I2C_RDWR calls as possible (see i2c_trans_submit). readback() and
+// dsp_close() send anything queued before they continue.
+void dsp_batch_begin(void);
+void dsp_batch_flush(void);
+void dsp_batch_end(void);
+
+// sends one DSP write (2-byte subaddress followed by data), or queues it
+// if a batch is open. Parameter RAM writes of unchanged words are skipped.
+// Returns -1 on error, otherwise the length.
+// Any failed transfer to the DSP (here, in a batch or in a readback) also
+// sets the global char dsp_bus_error, which is only ever cleared by the
+// caller, so it can check a whole sequence of set_* calls at once
+int dsp_write(unsigned char* buf, int len);
 
 // puts a 16-bit integer into a 2-byte array, most significant byte first
 void swap_order(char* res, int n);
 
 // programs the .bin file into the EEPROM on the DSP board
 // fname needs to be the complete filename (including any path if necessary)
-int ee_prog(char* fname);
+// If do_diff is set, the current EEPROM contents are read first and only the
+// pages (BLOCKSIZE bytes) that differ are written.
+// After each page the EEPROM is ACK polled until its write cycle completes,
+// and the whole image is read back and verified at the end.
+// returns 0 on success, otherwise 1
+int ee_prog(char* fname, char do_diff);
+
+// compares the current EEPROM contents cur with the image img, page by page.
+// dirty[i] is set to 1 for each page that needs writing, otherwise 0
+// returns the number of pages that need writing
+int ee_diff_pages(const unsigned char* cur, const unsigned char* img, int len, char* dirty);
+
+// loads a .bin self-boot image straight into the DSP over I2C (program RAM,
+// parameter RAM and control registers), without using the EEPROM or needing
+// a power cycle. The whole image is checked before anything is written, and
+// the core is held while the RAM is written (the images hold and release it
+// themselves; if an image does not start by holding the core, that is added)
+// returns 0 on success, otherwise 1 (including when a write to the DSP fails)
+int dsp_ram_load(char* fname);
+
+// waits until the EEPROM has finished its write cycle (it does not acknowledge
+// its address while busy). returns 0 when ready, or -1 on timeout
+int ee_wait_ready(int ee_handle);
+
+// sequential read of len bytes from the EEPROM, starting at addr
+// returns -1 on error, otherwise len
+int ee_read(int ee_handle, unsigned int addr, unsigned char* buf, int len);
 
 // 5.23 format used by DSP
 // parameters: v is the decimal input, bytes is a 4-byte array
+// v is rounded to the nearest step and saturated. To convert many values
+// at once, use fixed_5_23::encode_array (fixedpoint.h)
 void double_to_5_23_format(double v, char* bytes);
 
+// 5.19 format used by DSP (e.g. for Readback)
+// parameters: v is the decimal result, bytes is the 3-byte array to be converted
+void dsp_5_19_format_to_double(double *v, char* bytes);
+
+// writes nwords consecutive 4-byte parameter words starting at addr.
+// The DSP auto-increments the address, so this is sent as a single
+// burst (one I2C transaction per BURST_WORDS words) rather than one
+// transaction per word. words is an array of nwords*4 bytes, each
+// word most significant byte first (e.g. from double_to_5_23_format)
+void dsp_write_block(int addr, char* words, int nwords);
+
 // Sine Tone
 // (Sources->Oscillators->Sine Tone)
 // sets the frequency to an integer value
@@ -51,6 +142,17 @@ void set_pitch(int addr, double p);
 // coeff is pointer array of five double values b0, b1, b2, a1, a2
 void set_gen_2nd_order_filter(int addr, double* coeff);
 
+// safeload version of set_gen_2nd_order_filter
+// the five coefficients fill the five safeload slots, so the filter switches
+// from the old to the new coefficients in a single audio frame
+void set_gen_2nd_order_filter_safeload(int addr, double* coeff);
+
+// pre-encoded versions of the two above: words is 20 bytes, the five
+// coefficients as 5.23 words (most significant byte first) with a1 and a2
+// already negated, as stored by the DSP. biquad_words() (biquad.h) makes them
+void set_gen_2nd_order_filter_words(int addr, const unsigned char* words);
+void set_gen_2nd_order_filter_words_safeload(int addr, const unsigned char* words);
+
 // Double Precision Nth Order Filter (2-Channel)
 // (Filters->Nth Order->Double Precision->2 Channels->Nth Order Filter)
 // coeff is a pointer to array of 15 double values generated by SigmaStudio
@@ -79,21 +181,46 @@ void set_sinphase_phase(int addr, int ang);
 
 // set the DC integer (28.0) value for the DSP DC Input Entry object
 // (Sources->DC->DC Input Entry)
-// v is a value 0 to 0xffff
+// v is limited to the 28-bit signed range
 void set_dc_int(int addr, int v);
 // set the DC float (28.0) value for the DSP DC Input Entry object
 // (Sources->DC->DC Input Entry)
 // v is a double value
 void set_dc_float(int addr, double v);
 // safeload version of set_dc_float
+// joins the current safeload group if one has been started with safeload_begin
 void set_dc_float_safeload(int addr, double v);
 
+// Safeload groups. Parameters added between safeload_begin() and safeload_commit()
+// are transferred together, using all five safeload slots, so they change in the
+// same audio frame. A group larger than SAFE_SLOTS is split automatically.
+// word is a 4-byte value, most significant byte first (e.g. from double_to_5_23_format)
+void safeload_begin(void);
+void safeload_add(int addr, char* word);
+void safeload_commit(void);
+
 // performs DSP readback (data capture register)
 // addr should be 0x081a or 0x081b for ADAU1401 DSP
 // node is a 16-bit value
 // The code returns a decimal value based on the 5.19 format that was received
 double readback(int addr, int node);
 
+// low-latency version of readback. If the settle time for the node is no more
+// than READBACK_SETTLE_US then the capture address is written and the result read
+// back in one combined I2C transaction (the repeated start and subaddress take
+// longer than an audio frame, so the capture is always complete). Longer settle
+// times are waited for between the capture write and the read.
+double readback_fast(int addr, int node);
+
+// set the settle time in usec used by readback_fast for one node.
+// Use a node of -1 to change the default for all other nodes
+void readback_set_settle(int node, int usec);
+
+// find the shortest settle time for which readback_fast agrees with the slow
+// readback (within tol, as a fraction of the value) and store it for the node.
+// returns the settle time chosen in usec
+int readback_calibrate(int addr, int node, double tol);
+
 // performs mean square to V RMS conversion
 double ms_to_rms(double ms);
 
@@ -5,9 +5,21 @@
  * After use, remember to power-cycle the DSP board
  * for the EEPROM to be read by the DSP.
  *
+ * Only the pages that differ from the current EEPROM
+ * contents are written. Use -f to write every page.
+ *
  * Example:
  *      ./eeload -p tone_app.bin
  * (then power-cycle the DSP board)
+ * Example to rewrite the whole image:
+ *      ./eeload -p tone_app.bin -f
+ *
+ * An app can also be loaded straight into the DSP
+ * RAM with -r. It runs immediately, with no power
+ * cycle, but is lost at the next power cycle (when
+ * the DSP boots from the EEPROM again).
+ * Example:
+ *      ./eeload -r tone_app.bin
  *****************************************************/
 
 // includes
@@ -26,6 +38,8 @@
     char* sw; // used for command-line arguments
     char fname[256];
     char do_load=0;
+    char do_diff=1;
+    char do_ram=0;
 
 
     // read in the command-line arguments
@@ -40,7 +54,33 @@
     }
 
 
-    if (do_load) ee_prog(fname);
+    sw = getCmdOption(argv, argv + argc, "-r");
+    if (sw) {
+        sscanf(sw, "%s", fname);
+        if (strstr((const char*)fname, ".bin")==NULL) {
+            strcat(fname, ".bin");
+        }
+        printf("Requested file to load into DSP RAM: '%s'\n", fname);
+        do_ram=1;
+    }
+
+    if (cmdOptionExists(argv, argv + argc, "-f")) {
+        printf("Writing all pages\n");
+        do_diff=0;
+    }
+
+    if (do_load) {
+        if (ee_prog(fname, do_diff) != 0) return(1);
+    }
+
+    if (do_ram) {
+        dsp_open(); // create I2C handle for the DSP
+        if (dsp_ram_load(fname) != 0) {
+            dsp_close();
+            return(1);
+        }
+        dsp_close(); // close the I2C resource for the DSP
+    }
 
     return(0);
  }
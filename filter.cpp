@@ -1,11 +1,23 @@
 /*****************************************************
  * filter - Filter Tool
  * rev 1 - april 2022 - shabaz
+ * rev 2 - october 2026 - calculated coefficients
  *
  * uses filter6.bin
  * The filter tch tool can be used for applying 
  * lowpass, highpass and bandpass filters.
- * The range is 25 - 15000 Hz, in 25 Hz steps. 
+ * The cutoff can be any frequency below 24000 Hz.
+ * The coefficients are calculated (see iir.h), as a
+ * Butterworth filter unless -t is used, of the order
+ * given with -o (default 6). A lowpass or highpass on
+ * its own can use all six sections of filter6.bin
+ * (order up to 12), a bandpass has three sections for
+ * each edge (order up to 6). -r sets the passband
+ * ripple in dB for cheby1 and ellip (default 1) and
+ * -s the stopband attenuation in dB for cheby2 and
+ * ellip (default 60). Very low cutoffs only work with
+ * low orders, as the DSP's coefficients are not precise
+ * enough for the rest, and those filters are refused.
  * first program the DSP board EEPROM using:
  * ./eeload -p filter6.bin
  * then power-cycle the DSP board for the EEPROM
@@ -21,1230 +33,27 @@
  *      ./filter -b 1000 -w 500
  * the above is the same as:
  *      ./filter -b1 750 -b2 1250
+ * Example for a 12th order elliptic high-pass at 60 Hz:
+ *      ./filter -h 60 -t ellip -o 12
+ * Types are butter, cheby1, cheby2, bessel and ellip.
  *****************************************************/
 
 // includes
  #include <stdio.h>
  #include "options.h"
  #include "dsputil.h"
+ #include "biquad.h"
+ #include "iir.h"
 
 // defines
 #define LOW 0
 #define HIGH 1
+#define SECTIONS 6 // biquads in filter6.bin
 
 // consts used by notch.bin
 const int FILTER_NODE = 0x0000; // address of first filter node
 
-// each row contains coeff b0, b1, b2, a1, a2:
-const double butterlowcoeff[600][5] = {
-    { 2.671118191244215E-06, 5.342236382488430E-06, 2.671118191244215E-06, -1.995372005171181E+00, 9.953826896439464E-01 }, /* 25 Hz */
-    { 1.065983454073827E-05, 2.131966908147653E-05, 1.065983454073827E-05, -1.990744059505048E+00, 9.907866988432112E-01 }, /* 50 Hz */
-    { 2.392940496534490E-05, 4.785880993068981E-05, 2.392940496534490E-05, -1.986116211540889E+00, 9.862119291607508E-01 }, /* 75 Hz */
-    { 4.244336814021588E-05, 8.488673628043175E-05, 4.244336814021588E-05, -1.981488509144573E+00, 9.816582826171342E-01 }, /* 100 Hz */
-    { 6.616554353322535E-05, 1.323310870664507E-04, 6.616554353322535E-05, -1.976860999515798E+00, 9.771256616899304E-01 }, /* 125 Hz */
-    { 9.506002944922876E-05, 1.901200588984575E-04, 9.506002944922876E-05, -1.972233729195267E+00, 9.726139693130634E-01 }, /* 150 Hz */
-    { 1.290912010845635E-04, 2.581824021691270E-04, 1.290912010845635E-04, -1.967606744071793E+00, 9.681231088761313E-01 }, /* 175 Hz */
-    { 1.682237085914584E-04, 3.364474171829168E-04, 1.682237085914584E-04, -1.962980089389339E+00, 9.636529842237053E-01 }, /* 200 Hz */
-    { 2.124224751526016E-04, 4.248449503052032E-04, 2.124224751526016E-04, -1.958353809753975E+00, 9.592034996545856E-01 }, /* 225 Hz */
-    { 2.616526950658948E-04, 5.233053901317897E-04, 2.616526950658948E-04, -1.953727949140776E+00, 9.547745599210395E-01 }, /* 250 Hz */
-    { 3.158798318395051E-04, 6.317596636790102E-04, 3.158798318395051E-04, -1.949102550900650E+00, 9.503660702280081E-01 }, /* 275 Hz */
-    { 3.750696162969636E-04, 7.501392325939271E-04, 3.750696162969636E-04, -1.944477657767094E+00, 9.459779362322815E-01 }, /* 300 Hz */
-    { 4.391880446927010E-04, 8.783760893854020E-04, 4.391880446927010E-04, -1.939853311862882E+00, 9.416100640416533E-01 }, /* 325 Hz */
-    { 5.082013768378246E-04, 1.016402753675649E-03, 5.082013768378246E-04, -1.935229554706696E+00, 9.372623602140469E-01 }, /* 350 Hz */
-    { 5.820761342360259E-04, 1.164152268472052E-03, 5.820761342360259E-04, -1.930606427219668E+00, 9.329347317566122E-01 }, /* 375 Hz */
-    { 6.607790982303963E-04, 1.321558196460793E-03, 6.607790982303963E-04, -1.925983969731886E+00, 9.286270861248075E-01 }, /* 400 Hz */
-    { 7.442773081597354E-04, 1.488554616319471E-03, 7.442773081597354E-04, -1.921362221988807E+00, 9.243393312214456E-01 }, /* 425 Hz */
-    { 8.325380595262388E-04, 1.665076119052478E-03, 8.325380595262388E-04, -1.916741223157622E+00, 9.200713753957271E-01 }, /* 450 Hz */
-    { 9.255289021727064E-04, 1.851057804345413E-03, 9.255289021727064E-04, -1.912121011833552E+00, 9.158231274422427E-01 }, /* 475 Hz */
-    { 1.023217638470908E-03, 2.046435276941816E-03, 1.023217638470908E-03, -1.907501626046077E+00, 9.115944965999603E-01 }, /* 500 Hz */
-    { 1.125572321519691E-03, 2.251144643039382E-03, 1.125572321519691E-03, -1.902883103265104E+00, 9.073853925511829E-01 }, /* 525 Hz */
-    { 1.232561253354136E-03, 2.465122506708273E-03, 1.232561253354136E-03, -1.898265480407080E+00, 9.031957254204963E-01 }, /* 550 Hz */
-    { 1.344152983164870E-03, 2.688305966329740E-03, 1.344152983164870E-03, -1.893648793841025E+00, 8.990254057736846E-01 }, /* 575 Hz */
-    { 1.460316305527731E-03, 2.920632611055463E-03, 1.460316305527731E-03, -1.889033079394525E+00, 8.948743446166356E-01 }, /* 600 Hz */
-    { 1.581020258644233E-03, 3.162040517288467E-03, 1.581020258644233E-03, -1.884418372359644E+00, 8.907424533942211E-01 }, /* 625 Hz */
-    { 1.706234122592187E-03, 3.412468245184375E-03, 1.706234122592187E-03, -1.879804707498793E+00, 8.866296439891617E-01 }, /* 650 Hz */
-    { 1.835927417586897E-03, 3.671854835173793E-03, 1.835927417586897E-03, -1.875192119050525E+00, 8.825358287208728E-01 }, /* 675 Hz */
-    { 1.970069902252958E-03, 3.940139804505915E-03, 1.970069902252958E-03, -1.870580640735279E+00, 8.784609203442912E-01 }, /* 700 Hz */
-    { 2.108631571906272E-03, 4.217263143812544E-03, 2.108631571906272E-03, -1.865970305761065E+00, 8.744048320486899E-01 }, /* 725 Hz */
-    { 2.251582656846635E-03, 4.503165313693269E-03, 2.251582656846635E-03, -1.861361146829083E+00, 8.703674774564693E-01 }, /* 750 Hz */
-    { 2.398893620660869E-03, 4.797787241321738E-03, 2.398893620660869E-03, -1.856753196139296E+00, 8.663487706219397E-01 }, /* 775 Hz */
-    { 2.550535158536288E-03, 5.101070317072576E-03, 2.550535158536288E-03, -1.852146485395936E+00, 8.623486260300813E-01 }, /* 800 Hz */
-    { 2.706478195584588E-03, 5.412956391169177E-03, 2.706478195584588E-03, -1.847541045812958E+00, 8.583669585952959E-01 }, /* 825 Hz */
-    { 2.866693885176186E-03, 5.733387770352372E-03, 2.866693885176186E-03, -1.842936908119436E+00, 8.544036836601403E-01 }, /* 850 Hz */
-    { 3.031153607285092E-03, 6.062307214570184E-03, 3.031153607285092E-03, -1.838334102564905E+00, 8.504587169940457E-01 }, /* 875 Hz */
-    { 3.199828966843954E-03, 6.399657933687908E-03, 3.199828966843954E-03, -1.833732658924648E+00, 8.465319747920239E-01 }, /* 900 Hz */
-    { 3.372691792109694E-03, 6.745383584219389E-03, 3.372691792109694E-03, -1.829132606504924E+00, 8.426233736733628E-01 }, /* 925 Hz */
-    { 3.549714133039367E-03, 7.099428266078733E-03, 3.549714133039367E-03, -1.824533974148148E+00, 8.387328306803056E-01 }, /* 950 Hz */
-    { 3.730868259676418E-03, 7.461736519352835E-03, 3.730868259676418E-03, -1.819936790238015E+00, 8.348602632767207E-01 }, /* 975 Hz */
-    { 3.916126660547387E-03, 7.832253321094773E-03, 3.916126660547387E-03, -1.815341082704568E+00, 8.310055893467573E-01 }, /* 1000 Hz */
-    { 4.105462041068708E-03, 8.210924082137416E-03, 4.105462041068708E-03, -1.810746879029217E+00, 8.271687271934922E-01 }, /* 1025 Hz */
-    { 4.298847321963978E-03, 8.597694643927956E-03, 4.298847321963978E-03, -1.806154206249707E+00, 8.233495955375633E-01 }, /* 1050 Hz */
-    { 4.496255637691376E-03, 8.992511275382753E-03, 4.496255637691376E-03, -1.801563090965028E+00, 8.195481135157937E-01 }, /* 1075 Hz */
-    { 4.697660334881504E-03, 9.395320669763008E-03, 4.697660334881504E-03, -1.796973559340282E+00, 8.157642006798080E-01 }, /* 1100 Hz */
-    { 4.903034970785092E-03, 9.806069941570184E-03, 4.903034970785092E-03, -1.792385637111491E+00, 8.119977769946318E-01 }, /* 1125 Hz */
-    { 5.112353311731377E-03, 1.022470662346275E-02, 5.112353311731377E-03, -1.787799349590364E+00, 8.082487628372899E-01 }, /* 1150 Hz */
-    { 5.325589331596242E-03, 1.065117866319248E-02, 5.325589331596242E-03, -1.783214721669007E+00, 8.045170789953923E-01 }, /* 1175 Hz */
-    { 5.542717210280684E-03, 1.108543442056137E-02, 5.542717210280684E-03, -1.778631777824585E+00, 8.008026466657078E-01 }, /* 1200 Hz */
-    { 5.763711332199439E-03, 1.152742266439888E-02, 5.763711332199439E-03, -1.774050542123937E+00, 7.971053874527352E-01 }, /* 1225 Hz */
-    { 5.988546284779545E-03, 1.197709256955909E-02, 5.988546284779545E-03, -1.769471038228147E+00, 7.934252233672648E-01 }, /* 1250 Hz */
-    { 6.217196856969059E-03, 1.243439371393812E-02, 6.217196856969059E-03, -1.764893289397053E+00, 7.897620768249288E-01 }, /* 1275 Hz */
-    { 6.449638037755723E-03, 1.289927607551145E-02, 6.449638037755723E-03, -1.760317318493727E+00, 7.861158706447495E-01 }, /* 1300 Hz */
-    { 6.685845014695657E-03, 1.337169002939131E-02, 6.685845014695657E-03, -1.755743147988893E+00, 7.824865280476756E-01 }, /* 1325 Hz */
-    { 6.925793172452122E-03, 1.385158634490424E-02, 6.925793172452122E-03, -1.751170799965309E+00, 7.788739726551175E-01 }, /* 1350 Hz */
-    { 7.169458091343922E-03, 1.433891618268784E-02, 7.169458091343922E-03, -1.746600296122096E+00, 7.752781284874714E-01 }, /* 1375 Hz */
-    { 7.416815545904065E-03, 1.483363109180813E-02, 7.416815545904065E-03, -1.742031657779022E+00, 7.716989199626387E-01 }, /* 1400 Hz */
-    { 7.667841503447820E-03, 1.533568300689564E-02, 7.667841503447820E-03, -1.737464905880750E+00, 7.681362718945414E-01 }, /* 1425 Hz */
-    { 7.922512122651160E-03, 1.584502424530232E-02, 7.922512122651160E-03, -1.732900061001025E+00, 7.645901094916301E-01 }, /* 1450 Hz */
-    { 8.180803752138394E-03, 1.636160750427679E-02, 8.180803752138394E-03, -1.728337143346834E+00, 7.610603583553878E-01 }, /* 1475 Hz */
-    { 8.442692929079954E-03, 1.688538585815991E-02, 8.442692929079954E-03, -1.723776172762509E+00, 7.575469444788290E-01 }, /* 1500 Hz */
-    { 8.708156377799814E-03, 1.741631275559963E-02, 8.708156377799814E-03, -1.719217168733794E+00, 7.540497942449933E-01 }, /* 1525 Hz */
-    { 8.977171008392348E-03, 1.795434201678470E-02, 8.977171008392348E-03, -1.714660150391867E+00, 7.505688344254362E-01 }, /* 1550 Hz */
-    { 9.249713915349234E-03, 1.849942783069847E-02, 9.249713915349234E-03, -1.710105136517317E+00, 7.471039921787135E-01 }, /* 1575 Hz */
-    { 9.525762376195457E-03, 1.905152475239091E-02, 9.525762376195457E-03, -1.705552145544084E+00, 7.436551950488657E-01 }, /* 1600 Hz */
-    { 9.805293850135233E-03, 1.961058770027047E-02, 9.805293850135233E-03, -1.701001195563354E+00, 7.402223709638951E-01 }, /* 1625 Hz */
-    { 1.008828597670741E-02, 2.017657195341482E-02, 1.008828597670741E-02, -1.696452304327410E+00, 7.368054482342399E-01 }, /* 1650 Hz */
-    { 1.037471657445002E-02, 2.074943314890004E-02, 1.037471657445002E-02, -1.691905489253450E+00, 7.334043555512501E-01 }, /* 1675 Hz */
-    { 1.066456363957463E-02, 2.132912727914926E-02, 1.066456363957463E-02, -1.687360767427356E+00, 7.300190219856546E-01 }, /* 1700 Hz */
-    { 1.095780534465005E-02, 2.191561068930009E-02, 1.095780534465005E-02, -1.682818155607428E+00, 7.266493769860282E-01 }, /* 1725 Hz */
-    { 1.125442003729490E-02, 2.250884007458981E-02, 1.125442003729490E-02, -1.678277670228078E+00, 7.232953503772571E-01 }, /* 1750 Hz */
-    { 1.155438623888033E-02, 2.310877247776066E-02, 1.155438623888033E-02, -1.673739327403481E+00, 7.199568723590020E-01 }, /* 1775 Hz */
-    { 1.185768264324114E-02, 2.371536528648227E-02, 1.185768264324114E-02, -1.669203142931193E+00, 7.166338735041576E-01 }, /* 1800 Hz */
-    { 1.216428811539666E-02, 2.432857623079332E-02, 1.216428811539666E-02, -1.664669132295726E+00, 7.133262847573130E-01 }, /* 1825 Hz */
-    { 1.247418169028056E-02, 2.494836338056111E-02, 1.247418169028056E-02, -1.660137310672085E+00, 7.100340374332076E-01 }, /* 1850 Hz */
-    { 1.278734257147993E-02, 2.557468514295985E-02, 1.278734257147993E-02, -1.655607692929271E+00, 7.067570632151908E-01 }, /* 1875 Hz */
-    { 1.310375012998335E-02, 2.620750025996671E-02, 1.310375012998335E-02, -1.651080293633740E+00, 7.034952941536737E-01 }, /* 1900 Hz */
-    { 1.342338390293796E-02, 2.684676780587592E-02, 1.342338390293796E-02, -1.646555127052834E+00, 7.002486626645859E-01 }, /* 1925 Hz */
-    { 1.374622359241570E-02, 2.749244718483140E-02, 1.374622359241570E-02, -1.642032207158167E+00, 6.970171015278294E-01 }, /* 1950 Hz */
-    { 1.407224906418830E-02, 2.814449812837660E-02, 1.407224906418830E-02, -1.637511547628978E+00, 6.938005438857313E-01 }, /* 1975 Hz */
-    { 1.440144034651122E-02, 2.880288069302245E-02, 1.440144034651122E-02, -1.632993161855452E+00, 6.905989232414972E-01 }, /* 2000 Hz */
-    { 1.473377762891662E-02, 2.946755525783323E-02, 1.473377762891662E-02, -1.628477062941998E+00, 6.874121734576640E-01 }, /* 2025 Hz */
-    { 1.506924126101486E-02, 3.013848252202972E-02, 1.506924126101486E-02, -1.623963263710496E+00, 6.842402287545554E-01 }, /* 2050 Hz */
-    { 1.540781175130504E-02, 3.081562350261008E-02, 1.540781175130504E-02, -1.619451776703511E+00, 6.810830237087312E-01 }, /* 2075 Hz */
-    { 1.574946976599398E-02, 3.149893953198796E-02, 1.574946976599398E-02, -1.614942614187468E+00, 6.779404932514442E-01 }, /* 2100 Hz */
-    { 1.609419612782420E-02, 3.218839225564840E-02, 1.609419612782420E-02, -1.610435788155799E+00, 6.748125726670955E-01 }, /* 2125 Hz */
-    { 1.644197181491022E-02, 3.288394362982044E-02, 1.644197181491022E-02, -1.605931310332044E+00, 6.716991975916849E-01 }, /* 2150 Hz */
-    { 1.679277795958353E-02, 3.358555591916706E-02, 1.679277795958353E-02, -1.601429192172939E+00, 6.686003040112730E-01 }, /* 2175 Hz */
-    { 1.714659584724643E-02, 3.429319169449285E-02, 1.714659584724643E-02, -1.596929444871448E+00, 6.655158282604337E-01 }, /* 2200 Hz */
-    { 1.750340691523358E-02, 3.500681383046716E-02, 1.750340691523358E-02, -1.592432079359781E+00, 6.624457070207149E-01 }, /* 2225 Hz */
-    { 1.786319275168288E-02, 3.572638550336577E-02, 1.786319275168288E-02, -1.587937106312366E+00, 6.593898773190973E-01 }, /* 2250 Hz */
-    { 1.822593509441409E-02, 3.645187018882817E-02, 1.822593509441409E-02, -1.583444536148800E+00, 6.563482765264562E-01 }, /* 2275 Hz */
-    { 1.859161582981625E-02, 3.718323165963250E-02, 1.859161582981625E-02, -1.578954379036758E+00, 6.533208423560229E-01 }, /* 2300 Hz */
-    { 1.896021699174283E-02, 3.792043398348566E-02, 1.896021699174283E-02, -1.574466644894880E+00, 6.503075128618512E-01 }, /* 2325 Hz */
-    { 1.933172076041592E-02, 3.866344152083184E-02, 1.933172076041592E-02, -1.569981343395617E+00, 6.473082264372808E-01 }, /* 2350 Hz */
-    { 1.970610946133783E-02, 3.941221892267566E-02, 1.970610946133783E-02, -1.565498483968059E+00, 6.443229218134101E-01 }, /* 2375 Hz */
-    { 2.008336556421125E-02, 4.016673112842251E-02, 2.008336556421125E-02, -1.561018075800718E+00, 6.413515380575630E-01 }, /* 2400 Hz */
-    { 2.046347168186768E-02, 4.092694336373537E-02, 2.046347168186768E-02, -1.556540127844293E+00, 6.383940145717633E-01 }, /* 2425 Hz */
-    { 2.084641056920353E-02, 4.169282113840705E-02, 2.084641056920353E-02, -1.552064648814395E+00, 6.354502910912089E-01 }, /* 2450 Hz */
-    { 2.123216512212425E-02, 4.246433024424850E-02, 2.123216512212425E-02, -1.547591647194254E+00, 6.325203076827514E-01 }, /* 2475 Hz */
-    { 2.162071837649701E-02, 4.324143675299402E-02, 2.162071837649701E-02, -1.543121131237386E+00, 6.296040047433741E-01 }, /* 2500 Hz */
-    { 2.201205350711039E-02, 4.402410701422077E-02, 2.201205350711039E-02, -1.538653108970236E+00, 6.267013229986780E-01 }, /* 2525 Hz */
-    { 2.240615382664268E-02, 4.481230765328537E-02, 2.240615382664268E-02, -1.534187588194794E+00, 6.238122035013642E-01 }, /* 2550 Hz */
-    { 2.280300278463768E-02, 4.560600556927535E-02, 2.280300278463768E-02, -1.529724576491174E+00, 6.209365876297249E-01 }, /* 2575 Hz */
-    { 2.320258396648833E-02, 4.640516793297667E-02, 2.320258396648833E-02, -1.525264081220182E+00, 6.180744170861354E-01 }, /* 2600 Hz */
-    { 2.360488109242803E-02, 4.720976218485606E-02, 2.360488109242803E-02, -1.520806109525835E+00, 6.152256338955475E-01 }, /* 2625 Hz */
-    { 2.400987801652962E-02, 4.801975603305925E-02, 2.400987801652962E-02, -1.516350668337872E+00, 6.123901804039907E-01 }, /* 2650 Hz */
-    { 2.441755872571225E-02, 4.883511745142449E-02, 2.441755872571225E-02, -1.511897764374220E+00, 6.095679992770687E-01 }, /* 2675 Hz */
-    { 2.482790733875526E-02, 4.965581467751051E-02, 2.482790733875526E-02, -1.507447404143449E+00, 6.067590334984699E-01 }, /* 2700 Hz */
-    { 2.524090810532034E-02, 5.048181621064068E-02, 2.524090810532034E-02, -1.502999593947192E+00, 6.039632263684732E-01 }, /* 2725 Hz */
-    { 2.565654540498052E-02, 5.131309080996105E-02, 2.565654540498052E-02, -1.498554339882537E+00, 6.011805215024593E-01 }, /* 2750 Hz */
-    { 2.607480374625704E-02, 5.214960749251407E-02, 2.607480374625704E-02, -1.494111647844400E+00, 5.984108628294285E-01 }, /* 2775 Hz */
-    { 2.649566776566331E-02, 5.299133553132662E-02, 2.649566776566331E-02, -1.489671523527865E+00, 5.956541945905183E-01 }, /* 2800 Hz */
-    { 2.691912222675649E-02, 5.383824445351298E-02, 2.691912222675649E-02, -1.485233972430503E+00, 5.929104613375288E-01 }, /* 2825 Hz */
-    { 2.734515201919618E-02, 5.469030403839237E-02, 2.734515201919618E-02, -1.480798999854664E+00, 5.901796079314487E-01 }, /* 2850 Hz */
-    { 2.777374215781042E-02, 5.554748431562084E-02, 2.777374215781042E-02, -1.476366610909744E+00, 5.874615795409854E-01 }, /* 2875 Hz */
-    { 2.820487778166869E-02, 5.640975556333738E-02, 2.820487778166869E-02, -1.471936810514430E+00, 5.847563216411045E-01 }, /* 2900 Hz */
-    { 2.863854415316283E-02, 5.727708830632566E-02, 2.863854415316283E-02, -1.467509603398913E+00, 5.820637800115643E-01 }, /* 2925 Hz */
-    { 2.907472665709382E-02, 5.814945331418764E-02, 2.907472665709382E-02, -1.463084994107088E+00, 5.793839007354629E-01 }, /* 2950 Hz */
-    { 2.951341079976677E-02, 5.902682159953354E-02, 2.951341079976677E-02, -1.458662986998718E+00, 5.767166301977853E-01 }, /* 2975 Hz */
-    { 2.995458220809247E-02, 5.990916441618493E-02, 2.995458220809247E-02, -1.454243586251585E+00, 5.740619150839544E-01 }, /* 3000 Hz */
-    { 3.039822662869565E-02, 6.079645325739130E-02, 3.039822662869565E-02, -1.449826795863608E+00, 5.714197023783910E-01 }, /* 3025 Hz */
-    { 3.084432992703073E-02, 6.168865985406147E-02, 3.084432992703073E-02, -1.445412619654948E+00, 5.687899393630709E-01 }, /* 3050 Hz */
-    { 3.129287808650399E-02, 6.258575617300799E-02, 3.129287808650399E-02, -1.441001061270077E+00, 5.661725736160934E-01 }, /* 3075 Hz */
-    { 3.174385720760273E-02, 6.348771441520545E-02, 3.174385720760273E-02, -1.436592124179841E+00, 5.635675530102516E-01 }, /* 3100 Hz */
-    { 3.219725350703140E-02, 6.439450701406280E-02, 3.219725350703140E-02, -1.432185811683480E+00, 5.609748257116061E-01 }, /* 3125 Hz */
-    { 3.265305331685417E-02, 6.530610663370834E-02, 3.265305331685417E-02, -1.427782126910649E+00, 5.583943401780654E-01 }, /* 3150 Hz */
-    { 3.311124308364444E-02, 6.622248616728887E-02, 3.311124308364444E-02, -1.423381072823393E+00, 5.558260451579704E-01 }, /* 3175 Hz */
-    { 3.357180936764073E-02, 6.714361873528146E-02, 3.357180936764073E-02, -1.418982652218120E+00, 5.532698896886831E-01 }, /* 3200 Hz */
-    { 3.403473884190955E-02, 6.806947768381910E-02, 3.403473884190955E-02, -1.414586867727543E+00, 5.507258230951808E-01 }, /* 3225 Hz */
-    { 3.450001829151450E-02, 6.900003658302900E-02, 3.450001829151450E-02, -1.410193721822598E+00, 5.481937949886559E-01 }, /* 3250 Hz */
-    { 3.496763461269217E-02, 6.993526922538434E-02, 3.496763461269217E-02, -1.405803216814350E+00, 5.456737552651184E-01 }, /* 3275 Hz */
-    { 3.543757481203411E-02, 7.087514962406821E-02, 3.543757481203411E-02, -1.401415354855869E+00, 5.431656541040056E-01 }, /* 3300 Hz */
-    { 3.590982600567572E-02, 7.181965201135143E-02, 3.590982600567572E-02, -1.397030137944094E+00, 5.406694419667972E-01 }, /* 3325 Hz */
-    { 3.638437541849129E-02, 7.276875083698259E-02, 3.638437541849129E-02, -1.392647567921665E+00, 5.381850695956306E-01 }, /* 3350 Hz */
-    { 3.686121038329518E-02, 7.372242076659036E-02, 3.686121038329518E-02, -1.388267646478748E+00, 5.357124880119292E-01 }, /* 3375 Hz */
-    { 3.734031834004972E-02, 7.468063668009944E-02, 3.734031834004972E-02, -1.383890375154829E+00, 5.332516485150284E-01 }, /* 3400 Hz */
-    { 3.782168683507897E-02, 7.564337367015794E-02, 3.782168683507897E-02, -1.379515755340496E+00, 5.308025026808123E-01 }, /* 3425 Hz */
-    { 3.830530352028896E-02, 7.661060704057793E-02, 3.830530352028896E-02, -1.375143788279197E+00, 5.283650023603527E-01 }, /* 3450 Hz */
-    { 3.879115615239406E-02, 7.758231230478813E-02, 3.879115615239406E-02, -1.370774475068976E+00, 5.259390996785519E-01 }, /* 3475 Hz */
-    { 3.927923259214922E-02, 7.855846518429843E-02, 3.927923259214922E-02, -1.366407816664200E+00, 5.235247470327964E-01 }, /* 3500 Hz */
-    { 3.976952080358861E-02, 7.953904160717723E-02, 3.976952080358861E-02, -1.362043813877255E+00, 5.211218970916093E-01 }, /* 3525 Hz */
-    { 4.026200885327030E-02, 8.052401770654061E-02, 4.026200885327030E-02, -1.357682467380231E+00, 5.187305027933127E-01 }, /* 3550 Hz */
-    { 4.075668490952652E-02, 8.151336981905305E-02, 4.075668490952652E-02, -1.353323777706588E+00, 5.163505173446937E-01 }, /* 3575 Hz */
-    { 4.125353724172032E-02, 8.250707448344063E-02, 4.125353724172032E-02, -1.348967745252794E+00, 5.139818942196754E-01 }, /* 3600 Hz */
-    { 4.175255421950799E-02, 8.350510843901598E-02, 4.175255421950799E-02, -1.344614370279963E+00, 5.116245871579951E-01 }, /* 3625 Hz */
-    { 4.225372431210736E-02, 8.450744862421472E-02, 4.225372431210736E-02, -1.340263652915455E+00, 5.092785501638847E-01 }, /* 3650 Hz */
-    { 4.275703608757175E-02, 8.551407217514351E-02, 4.275703608757175E-02, -1.335915593154474E+00, 5.069437375047610E-01 }, /* 3675 Hz */
-    { 4.326247821207013E-02, 8.652495642414026E-02, 4.326247821207013E-02, -1.331570190861637E+00, 5.046201037099174E-01 }, /* 3700 Hz */
-    { 4.377003944917246E-02, 8.754007889834492E-02, 4.377003944917246E-02, -1.327227445772533E+00, 5.023076035692231E-01 }, /* 3725 Hz */
-    { 4.427970865914121E-02, 8.855941731828243E-02, 4.427970865914121E-02, -1.322887357495264E+00, 5.000061921318291E-01 }, /* 3750 Hz */
-    { 4.479147479822829E-02, 8.958294959645657E-02, 4.479147479822829E-02, -1.318549925511963E+00, 4.977158247048766E-01 }, /* 3775 Hz */
-    { 4.530532691797784E-02, 9.061065383595568E-02, 4.530532691797784E-02, -1.314215149180301E+00, 4.954364568522127E-01 }, /* 3800 Hz */
-    { 4.582125416453406E-02, 9.164250832906812E-02, 4.582125416453406E-02, -1.309883027734977E+00, 4.931680443931129E-01 }, /* 3825 Hz */
-    { 4.633924577795540E-02, 9.267849155591079E-02, 4.633924577795540E-02, -1.305553560289185E+00, 4.909105434010061E-01 }, /* 3850 Hz */
-    { 4.685929109153336E-02, 9.371858218306672E-02, 4.685929109153336E-02, -1.301226745836076E+00, 4.886639102022095E-01 }, /* 3875 Hz */
-    { 4.738137953111771E-02, 9.476275906223541E-02, 4.738137953111771E-02, -1.296902583250193E+00, 4.864281013746643E-01 }, /* 3900 Hz */
-    { 4.790550061444607E-02, 9.581100122889213E-02, 4.790550061444607E-02, -1.292581071288897E+00, 4.842030737466810E-01 }, /* 3925 Hz */
-    { 4.843164395047977E-02, 9.686328790095955E-02, 4.843164395047977E-02, -1.288262208593769E+00, 4.819887843956881E-01 }, /* 3950 Hz */
-    { 4.895979923874463E-02, 9.791959847748927E-02, 4.895979923874463E-02, -1.283945993692010E+00, 4.797851906469882E-01 }, /* 3975 Hz */
-    { 4.948995626867705E-02, 9.897991253735411E-02, 4.948995626867705E-02, -1.279632424997809E+00, 4.775922500725173E-01 }, /* 4000 Hz */
-    { 5.002210491897549E-02, 1.000442098379510E-01, 5.002210491897549E-02, -1.275321500813710E+00, 4.754099204896124E-01 }, /* 4025 Hz */
-    { 5.055623515695701E-02, 1.011124703139140E-01, 5.055623515695701E-02, -1.271013219331957E+00, 4.732381599597846E-01 }, /* 4050 Hz */
-    { 5.109233703791924E-02, 1.021846740758385E-01, 5.109233703791924E-02, -1.266707578635817E+00, 4.710769267874942E-01 }, /* 4075 Hz */
-    { 5.163040070450725E-02, 1.032608014090145E-01, 5.163040070450725E-02, -1.262404576700909E+00, 4.689261795189383E-01 }, /* 4100 Hz */
-    { 5.217041638608566E-02, 1.043408327721713E-01, 5.217041638608566E-02, -1.258104211396494E+00, 4.667858769408366E-01 }, /* 4125 Hz */
-    { 5.271237439811596E-02, 1.054247487962319E-01, 5.271237439811596E-02, -1.253806480486765E+00, 4.646559780792291E-01 }, /* 4150 Hz */
-    { 5.325626514153847E-02, 1.065125302830769E-01, 5.325626514153847E-02, -1.249511381632121E+00, 4.625364421982749E-01 }, /* 4175 Hz */
-    { 5.380207910215962E-02, 1.076041582043192E-01, 5.380207910215962E-02, -1.245218912390424E+00, 4.604272287990624E-01 }, /* 4200 Hz */
-    { 5.434980685004420E-02, 1.086996137000884E-01, 5.434980685004420E-02, -1.240929070218241E+00, 4.583282976184173E-01 }, /* 4225 Hz */
-    { 5.489943903891234E-02, 1.097988780778247E-01, 5.489943903891234E-02, -1.236641852472074E+00, 4.562396086277237E-01 }, /* 4250 Hz */
-    { 5.545096640554159E-02, 1.109019328110832E-01, 5.545096640554159E-02, -1.232357256409581E+00, 4.541611220317479E-01 }, /* 4275 Hz */
-    { 5.600437976917372E-02, 1.120087595383474E-01, 5.600437976917372E-02, -1.228075279190772E+00, 4.520927982674667E-01 }, /* 4300 Hz */
-    { 5.655967003092632E-02, 1.131193400618526E-01, 5.655967003092632E-02, -1.223795917879200E+00, 4.500345980029047E-01 }, /* 4325 Hz */
-    { 5.711682817320921E-02, 1.142336563464184E-01, 5.711682817320921E-02, -1.219519169443137E+00, 4.479864821359741E-01 }, /* 4350 Hz */
-    { 5.767584525914571E-02, 1.153516905182914E-01, 5.767584525914571E-02, -1.215245030756740E+00, 4.459484117933230E-01 }, /* 4375 Hz */
-    { 5.823671243199829E-02, 1.164734248639966E-01, 5.823671243199829E-02, -1.210973498601194E+00, 4.439203483291871E-01 }, /* 4400 Hz */
-    { 5.879942091459966E-02, 1.175988418291993E-01, 5.879942091459966E-02, -1.206704569665850E+00, 4.419022533242490E-01 }, /* 4425 Hz */
-    { 5.936396200878730E-02, 1.187279240175746E-01, 5.936396200878730E-02, -1.202438240549353E+00, 4.398940885845024E-01 }, /* 4450 Hz */
-    { 5.993032709484369E-02, 1.198606541896874E-01, 5.993032709484369E-02, -1.198174507760747E+00, 4.378958161401221E-01 }, /* 4475 Hz */
-    { 6.049850763094056E-02, 1.209970152618811E-01, 6.049850763094056E-02, -1.193913367720578E+00, 4.359073982443405E-01 }, /* 4500 Hz */
-    { 6.106849515258772E-02, 1.221369903051754E-01, 6.106849515258772E-02, -1.189654816761977E+00, 4.339287973723281E-01 }, /* 4525 Hz */
-    { 6.164028127208668E-02, 1.232805625441734E-01, 6.164028127208668E-02, -1.185398851131735E+00, 4.319599762200820E-01 }, /* 4550 Hz */
-    { 6.221385767798818E-02, 1.244277153559764E-01, 6.221385767798818E-02, -1.181145466991366E+00, 4.300008977033186E-01 }, /* 4575 Hz */
-    { 6.278921613455496E-02, 1.255784322691099E-01, 6.278921613455496E-02, -1.176894660418152E+00, 4.280515249563724E-01 }, /* 4600 Hz */
-    { 6.336634848122802E-02, 1.267326969624560E-01, 6.336634848122802E-02, -1.172646427406189E+00, 4.261118213311011E-01 }, /* 4625 Hz */
-    { 6.394524663209802E-02, 1.278904932641960E-01, 6.394524663209802E-02, -1.168400763867403E+00, 4.241817503957953E-01 }, /* 4650 Hz */
-    { 6.452590257538046E-02, 1.290518051507609E-01, 6.452590257538046E-02, -1.164157665632574E+00, 4.222612759340957E-01 }, /* 4675 Hz */
-    { 6.510830837289561E-02, 1.302166167457912E-01, 6.510830837289561E-02, -1.159917128452331E+00, 4.203503619439133E-01 }, /* 4700 Hz */
-    { 6.569245615955227E-02, 1.313849123191045E-01, 6.569245615955227E-02, -1.155679147998150E+00, 4.184489726363590E-01 }, /* 4725 Hz */
-    { 6.627833814283621E-02, 1.325566762856724E-01, 6.627833814283621E-02, -1.151443719863330E+00, 4.165570724346751E-01 }, /* 4750 Hz */
-    { 6.686594660230244E-02, 1.337318932046049E-01, 6.686594660230244E-02, -1.147210839563966E+00, 4.146746259731753E-01 }, /* 4775 Hz */
-    { 6.745527388907185E-02, 1.349105477781437E-01, 6.745527388907185E-02, -1.142980502539901E+00, 4.128015980961888E-01 }, /* 4800 Hz */
-    { 6.804631242533210E-02, 1.360926248506642E-01, 6.804631242533210E-02, -1.138752704155683E+00, 4.109379538570112E-01 }, /* 4825 Hz */
-    { 6.863905470384207E-02, 1.372781094076841E-01, 6.863905470384207E-02, -1.134527439701492E+00, 4.090836585168602E-01 }, /* 4850 Hz */
-    { 6.923349328744116E-02, 1.384669865748823E-01, 6.923349328744116E-02, -1.130304704394073E+00, 4.072386775438377E-01 }, /* 4875 Hz */
-    { 6.982962080856217E-02, 1.396592416171243E-01, 6.982962080856217E-02, -1.126084493377648E+00, 4.054029766118968E-01 }, /* 4900 Hz */
-    { 7.042742996874840E-02, 1.408548599374968E-01, 7.042742996874840E-02, -1.121866801724820E+00, 4.035765215998136E-01 }, /* 4925 Hz */
-    { 7.102691353817425E-02, 1.420538270763485E-01, 7.102691353817425E-02, -1.117651624437471E+00, 4.017592785901685E-01 }, /* 4950 Hz */
-    { 7.162806435517050E-02, 1.432561287103410E-01, 7.162806435517050E-02, -1.113438956447647E+00, 3.999512138683293E-01 }, /* 4975 Hz */
-    { 7.223087532575320E-02, 1.444617506515064E-01, 7.223087532575320E-02, -1.109228792618427E+00, 3.981522939214396E-01 }, /* 5000 Hz */
-    { 7.283533942315601E-02, 1.456706788463120E-01, 7.283533942315601E-02, -1.105021127744793E+00, 3.963624854374168E-01 }, /* 5025 Hz */
-    { 7.344144968736732E-02, 1.468828993747346E-01, 7.344144968736732E-02, -1.100815956554482E+00, 3.945817553039510E-01 }, /* 5050 Hz */
-    { 7.404919922467051E-02, 1.480983984493410E-01, 7.404919922467051E-02, -1.096613273708831E+00, 3.928100706075133E-01 }, /* 5075 Hz */
-    { 7.465858120718810E-02, 1.493171624143762E-01, 7.465858120718810E-02, -1.092413073803615E+00, 3.910473986323673E-01 }, /* 5100 Hz */
-    { 7.526958887242990E-02, 1.505391777448598E-01, 7.526958887242990E-02, -1.088215351369867E+00, 3.892937068595870E-01 }, /* 5125 Hz */
-    { 7.588221552284480E-02, 1.517644310456896E-01, 7.588221552284480E-02, -1.084020100874701E+00, 3.875489629660800E-01 }, /* 5150 Hz */
-    { 7.649645452537623E-02, 1.529929090507525E-01, 7.649645452537623E-02, -1.079827316722112E+00, 3.858131348236173E-01 }, /* 5175 Hz */
-    { 7.711229931102148E-02, 1.542245986220430E-01, 7.711229931102148E-02, -1.075636993253780E+00, 3.840861904978659E-01 }, /* 5200 Hz */
-    { 7.772974337439437E-02, 1.554594867487887E-01, 7.772974337439437E-02, -1.071449124749853E+00, 3.823680982474305E-01 }, /* 5225 Hz */
-    { 7.834878027329201E-02, 1.566975605465840E-01, 7.834878027329201E-02, -1.067263705429730E+00, 3.806588265228976E-01 }, /* 5250 Hz */
-    { 7.896940362826474E-02, 1.579388072565295E-01, 7.896940362826474E-02, -1.063080729452829E+00, 3.789583439658878E-01 }, /* 5275 Hz */
-    { 7.959160712218971E-02, 1.591832142443794E-01, 7.959160712218971E-02, -1.058900190919352E+00, 3.772666194081106E-01 }, /* 5300 Hz */
-    { 8.021538449984836E-02, 1.604307689996967E-01, 8.021538449984836E-02, -1.054722083871034E+00, 3.755836218704275E-01 }, /* 5325 Hz */
-    { 8.084072956750712E-02, 1.616814591350142E-01, 8.084072956750712E-02, -1.050546402291889E+00, 3.739093205619178E-01 }, /* 5350 Hz */
-    { 8.146763619250155E-02, 1.629352723850031E-01, 8.146763619250155E-02, -1.046373140108947E+00, 3.722436848789533E-01 }, /* 5375 Hz */
-    { 8.209609830282427E-02, 1.641921966056485E-01, 8.209609830282427E-02, -1.042202291192977E+00, 3.705866844042738E-01 }, /* 5400 Hz */
-    { 8.272610988671594E-02, 1.654522197734319E-01, 8.272610988671594E-02, -1.038033849359209E+00, 3.689382889060729E-01 }, /* 5425 Hz */
-    { 8.335766499226005E-02, 1.667153299845201E-01, 8.335766499226005E-02, -1.033867808368046E+00, 3.672984683370860E-01 }, /* 5450 Hz */
-    { 8.399075772698061E-02, 1.679815154539612E-01, 8.399075772698061E-02, -1.029704161925761E+00, 3.656671928336833E-01 }, /* 5475 Hz */
-    { 8.462538225744404E-02, 1.692507645148881E-01, 8.462538225744404E-02, -1.025542903685195E+00, 3.640444327149710E-01 }, /* 5500 Hz */
-    { 8.526153280886331E-02, 1.705230656177266E-01, 8.526153280886331E-02, -1.021384027246442E+00, 3.624301584818955E-01 }, /* 5525 Hz */
-    { 8.589920366470621E-02, 1.717984073294124E-01, 8.589920366470621E-02, -1.017227526157529E+00, 3.608243408163539E-01 }, /* 5550 Hz */
-    { 8.653838916630671E-02, 1.730767783326134E-01, 8.653838916630671E-02, -1.013073393915081E+00, 3.592269505803082E-01 }, /* 5575 Hz */
-    { 8.717908371247940E-02, 1.743581674249588E-01, 8.717908371247940E-02, -1.008921623964990E+00, 3.576379588149079E-01 }, /* 5600 Hz */
-    { 8.782128175913714E-02, 1.756425635182743E-01, 8.782128175913714E-02, -1.004772209703067E+00, 3.560573367396153E-01 }, /* 5625 Hz */
-    { 8.846497781891258E-02, 1.769299556378252E-01, 8.846497781891258E-02, -1.000625144475685E+00, 3.544850557513356E-01 }, /* 5650 Hz */
-    { 8.911016646078185E-02, 1.782203329215637E-01, 8.911016646078185E-02, -9.964804215804278E-01, 3.529210874235553E-01 }, /* 5675 Hz */
-    { 8.975684230969222E-02, 1.795136846193844E-01, 8.975684230969222E-02, -9.923380342667140E-01, 3.513654035054828E-01 }, /* 5700 Hz */
-    { 9.040500004619240E-02, 1.808100000923848E-01, 9.040500004619240E-02, -9.881979757364255E-01, 3.498179759211951E-01 }, /* 5725 Hz */
-    { 9.105463440606629E-02, 1.821092688121326E-01, 9.105463440606629E-02, -9.840602391445261E-01, 3.482787767687913E-01 }, /* 5750 Hz */
-    { 9.170574017996980E-02, 1.834114803599396E-01, 9.170574017996980E-02, -9.799248175996683E-01, 3.467477783195476E-01 }, /* 5775 Hz */
-    { 9.235831221307045E-02, 1.847166244261409E-01, 9.235831221307045E-02, -9.757917041648000E-01, 3.452249530170818E-01 }, /* 5800 Hz */
-    { 9.301234540469022E-02, 1.860246908093804E-01, 9.301234540469022E-02, -9.716608918577591E-01, 3.437102734765200E-01 }, /* 5825 Hz */
-    { 9.366783470795148E-02, 1.873356694159030E-01, 9.366783470795148E-02, -9.675323736518632E-01, 3.422037124836691E-01 }, /* 5850 Hz */
-    { 9.432477512942575E-02, 1.886495502588515E-01, 9.432477512942575E-02, -9.634061424764915E-01, 3.407052429941945E-01 }, /* 5875 Hz */
-    { 9.498316172878563E-02, 1.899663234575713E-01, 9.498316172878563E-02, -9.592821912176611E-01, 3.392148381328036E-01 }, /* 5900 Hz */
-    { 9.564298961845952E-02, 1.912859792369190E-01, 9.564298961845952E-02, -9.551605127185945E-01, 3.377324711924326E-01 }, /* 5925 Hz */
-    { 9.630425396328929E-02, 1.926085079265786E-01, 9.630425396328929E-02, -9.510410997802836E-01, 3.362581156334407E-01 }, /* 5950 Hz */
-    { 9.696694998019068E-02, 1.939338999603814E-01, 9.696694998019068E-02, -9.469239451620440E-01, 3.347917450828067E-01 }, /* 5975 Hz */
-    { 9.763107293781750E-02, 1.952621458756350E-01, 9.763107293781750E-02, -9.428090415820634E-01, 3.333333333333334E-01 }, /* 6000 Hz */
-    { 9.829661815622712E-02, 1.965932363124542E-01, 9.829661815622712E-02, -9.386963817179452E-01, 3.318828543428537E-01 }, /* 6025 Hz */
-    { 9.896358100655012E-02, 1.979271620131002E-01, 9.896358100655012E-02, -9.345859582072454E-01, 3.304402822334458E-01 }, /* 6050 Hz */
-    { 9.963195691066234E-02, 1.992639138213247E-01, 9.963195691066234E-02, -9.304777636479993E-01, 3.290055912906487E-01 }, /* 6075 Hz */
-    { 1.003017413408594E-01, 2.006034826817188E-01, 1.003017413408594E-01, -9.263717905992489E-01, 3.275787559626866E-01 }, /* 6100 Hz */
-    { 1.009729298195348E-01, 2.019458596390696E-01, 1.009729298195348E-01, -9.222680315815576E-01, 3.261597508596967E-01 }, /* 6125 Hz */
-    { 1.016455179188594E-01, 2.032910358377188E-01, 1.016455179188594E-01, -9.181664790775230E-01, 3.247485507529607E-01 }, /* 6150 Hz */
-    { 1.023195012604654E-01, 2.046390025209309E-01, 1.023195012604654E-01, -9.140671255322808E-01, 3.233451305741425E-01 }, /* 6175 Hz */
-    { 1.029948755151317E-01, 2.059897510302635E-01, 1.029948755151317E-01, -9.099699633540052E-01, 3.219494654145321E-01 }, /* 6200 Hz */
-    { 1.036716364024722E-01, 2.073432728049444E-01, 1.036716364024722E-01, -9.058749849144019E-01, 3.205615305242906E-01 }, /* 6225 Hz */
-    { 1.043497796906273E-01, 2.086995593812546E-01, 1.043497796906273E-01, -9.017821825491943E-01, 3.191813013117035E-01 }, /* 6250 Hz */
-    { 1.050293011959574E-01, 2.100586023919148E-01, 1.050293011959574E-01, -8.976915485586081E-01, 3.178087533424377E-01 }, /* 6275 Hz */
-    { 1.057101967827395E-01, 2.114203935654791E-01, 1.057101967827395E-01, -8.936030752078444E-01, 3.164438623388026E-01 }, /* 6300 Hz */
-    { 1.063924623628663E-01, 2.127849247257326E-01, 1.063924623628663E-01, -8.895167547275513E-01, 3.150866041790166E-01 }, /* 6325 Hz */
-    { 1.070760938955476E-01, 2.141521877910951E-01, 1.070760938955476E-01, -8.854325793142876E-01, 3.137369548964778E-01 }, /* 6350 Hz */
-    { 1.077610873870143E-01, 2.155221747740287E-01, 1.077610873870143E-01, -8.813505411309841E-01, 3.123948906790415E-01 }, /* 6375 Hz */
-    { 1.084474388902260E-01, 2.168948777804520E-01, 1.084474388902260E-01, -8.772706323073948E-01, 3.110603878682989E-01 }, /* 6400 Hz */
-    { 1.091351445045793E-01, 2.182702890091586E-01, 1.091351445045793E-01, -8.731928449405461E-01, 3.097334229588631E-01 }, /* 6425 Hz */
-    { 1.098242003756198E-01, 2.196484007512396E-01, 1.098242003756198E-01, -8.691171710951807E-01, 3.084139725976600E-01 }, /* 6450 Hz */
-    { 1.105146026947570E-01, 2.210292053895140E-01, 1.105146026947570E-01, -8.650436028041935E-01, 3.071020135832214E-01 }, /* 6475 Hz */
-    { 1.112063476989801E-01, 2.224126953979603E-01, 1.112063476989801E-01, -8.609721320690649E-01, 3.057975228649854E-01 }, /* 6500 Hz */
-    { 1.118994316705781E-01, 2.237988633411563E-01, 1.118994316705781E-01, -8.569027508602873E-01, 3.045004775425999E-01 }, /* 6525 Hz */
-    { 1.125938509368606E-01, 2.251877018737213E-01, 1.125938509368606E-01, -8.528354511177886E-01, 3.032108548652311E-01 }, /* 6550 Hz */
-    { 1.132896018698825E-01, 2.265792037397649E-01, 1.132896018698825E-01, -8.487702247513468E-01, 3.019286322308766E-01 }, /* 6575 Hz */
-    { 1.139866808861699E-01, 2.279733617723397E-01, 1.139866808861699E-01, -8.447070636410042E-01, 3.006537871856836E-01 }, /* 6600 Hz */
-    { 1.146850844464494E-01, 2.293701688928988E-01, 1.146850844464494E-01, -8.406459596374729E-01, 2.993862974232705E-01 }, /* 6625 Hz */
-    { 1.153848090553791E-01, 2.307696181107582E-01, 1.153848090553791E-01, -8.365869045625370E-01, 2.981261407840535E-01 }, /* 6650 Hz */
-    { 1.160858512612821E-01, 2.321717025225641E-01, 1.160858512612821E-01, -8.325298902094505E-01, 2.968732952545787E-01 }, /* 6675 Hz */
-    { 1.167882076558821E-01, 2.335764153117643E-01, 1.167882076558821E-01, -8.284749083433286E-01, 2.956277389668571E-01 }, /* 6700 Hz */
-    { 1.174918748740421E-01, 2.349837497480843E-01, 1.174918748740421E-01, -8.244219507015373E-01, 2.943894501977059E-01 }, /* 6725 Hz */
-    { 1.181968495935046E-01, 2.363936991870093E-01, 1.181968495935046E-01, -8.203710089940730E-01, 2.931584073680916E-01 }, /* 6750 Hz */
-    { 1.189031285346340E-01, 2.378062570692681E-01, 1.189031285346340E-01, -8.163220749039444E-01, 2.919345890424805E-01 }, /* 6775 Hz */
-    { 1.196107084601620E-01, 2.392214169203241E-01, 1.196107084601620E-01, -8.122751400875438E-01, 2.907179739281919E-01 }, /* 6800 Hz */
-    { 1.203195861749348E-01, 2.406391723498696E-01, 1.203195861749348E-01, -8.082301961750169E-01, 2.895085408747561E-01 }, /* 6825 Hz */
-    { 1.210297585256622E-01, 2.420595170513243E-01, 1.210297585256622E-01, -8.041872347706279E-01, 2.883062688732765E-01 }, /* 6850 Hz */
-    { 1.217412224006694E-01, 2.434824448013388E-01, 1.217412224006694E-01, -8.001462474531189E-01, 2.871111370557967E-01 }, /* 6875 Hz */
-    { 1.224539747296513E-01, 2.449079494593026E-01, 1.224539747296513E-01, -7.961072257760664E-01, 2.859231246946716E-01 }, /* 6900 Hz */
-    { 1.231680124834276E-01, 2.463360249668552E-01, 1.231680124834276E-01, -7.920701612682322E-01, 2.847422112019425E-01 }, /* 6925 Hz */
-    { 1.238833326737017E-01, 2.477666653474034E-01, 1.238833326737017E-01, -7.880350454339106E-01, 2.835683761287173E-01 }, /* 6950 Hz */
-    { 1.245999323528205E-01, 2.491998647056411E-01, 1.245999323528205E-01, -7.840018697532716E-01, 2.824015991645538E-01 }, /* 6975 Hz */
-    { 1.253178086135374E-01, 2.506356172270749E-01, 1.253178086135374E-01, -7.799706256826998E-01, 2.812418601368496E-01 }, /* 7000 Hz */
-    { 1.260369585887761E-01, 2.520739171775522E-01, 1.260369585887761E-01, -7.759413046551283E-01, 2.800891390102327E-01 }, /* 7025 Hz */
-    { 1.267573794513977E-01, 2.535147589027955E-01, 1.267573794513977E-01, -7.719138980803686E-01, 2.789434158859595E-01 }, /* 7050 Hz */
-    { 1.274790684139694E-01, 2.549581368279387E-01, 1.274790684139694E-01, -7.678883973454385E-01, 2.778046710013159E-01 }, /* 7075 Hz */
-    { 1.282020227285348E-01, 2.564040454570695E-01, 1.282020227285348E-01, -7.638647938148831E-01, 2.766728847290222E-01 }, /* 7100 Hz */
-    { 1.289262396863871E-01, 2.578524793727742E-01, 1.289262396863871E-01, -7.598430788310941E-01, 2.755480375766425E-01 }, /* 7125 Hz */
-    { 1.296517166178439E-01, 2.593034332356879E-01, 1.296517166178439E-01, -7.558232437146233E-01, 2.744301101859991E-01 }, /* 7150 Hz */
-    { 1.303784508920240E-01, 2.607569017840480E-01, 1.303784508920240E-01, -7.518052797644930E-01, 2.733190833325890E-01 }, /* 7175 Hz */
-    { 1.311064399166259E-01, 2.622128798332519E-01, 1.311064399166259E-01, -7.477891782585034E-01, 2.722149379250072E-01 }, /* 7200 Hz */
-    { 1.318356811377090E-01, 2.636713622754181E-01, 1.318356811377090E-01, -7.437749304535359E-01, 2.711176550043721E-01 }, /* 7225 Hz */
-    { 1.325661720394763E-01, 2.651323440789526E-01, 1.325661720394763E-01, -7.397625275858497E-01, 2.700272157437550E-01 }, /* 7250 Hz */
-    { 1.332979101440588E-01, 2.665958202881177E-01, 1.332979101440588E-01, -7.357519608713805E-01, 2.689436014476159E-01 }, /* 7275 Hz */
-    { 1.340308930113029E-01, 2.680617860226059E-01, 1.340308930113029E-01, -7.317432215060290E-01, 2.678667935512408E-01 }, /* 7300 Hz */
-    { 1.347651182385581E-01, 2.695302364771163E-01, 1.347651182385581E-01, -7.277363006659514E-01, 2.667967736201839E-01 }, /* 7325 Hz */
-    { 1.355005834604682E-01, 2.710011669209364E-01, 1.355005834604682E-01, -7.237311895078422E-01, 2.657335233497150E-01 }, /* 7350 Hz */
-    { 1.362372863487631E-01, 2.724745726975262E-01, 1.362372863487631E-01, -7.197278791692163E-01, 2.646770245642688E-01 }, /* 7375 Hz */
-    { 1.369752246120539E-01, 2.739504492241078E-01, 1.369752246120539E-01, -7.157263607686845E-01, 2.636272592169001E-01 }, /* 7400 Hz */
-    { 1.377143959956280E-01, 2.754287919912561E-01, 1.377143959956280E-01, -7.117266254062298E-01, 2.625842093887419E-01 }, /* 7425 Hz */
-    { 1.384547982812482E-01, 2.769095965624964E-01, 1.384547982812482E-01, -7.077286641634748E-01, 2.615478572884675E-01 }, /* 7450 Hz */
-    { 1.391964292869515E-01, 2.783928585739030E-01, 1.391964292869515E-01, -7.037324681039523E-01, 2.605181852517583E-01 }, /* 7475 Hz */
-    { 1.399392868668516E-01, 2.798785737337032E-01, 1.399392868668516E-01, -6.997380282733655E-01, 2.594951757407719E-01 }, /* 7500 Hz */
-    { 1.406833689109418E-01, 2.813667378218837E-01, 1.406833689109418E-01, -6.957453356998506E-01, 2.584788113436179E-01 }, /* 7525 Hz */
-    { 1.414286733449006E-01, 2.828573466898012E-01, 1.414286733449006E-01, -6.917543813942330E-01, 2.574690747738355E-01 }, /* 7550 Hz */
-    { 1.421751981298988E-01, 2.843503962597975E-01, 1.421751981298988E-01, -6.877651563502801E-01, 2.564659488698752E-01 }, /* 7575 Hz */
-    { 1.429229412624078E-01, 2.858458825248155E-01, 1.429229412624078E-01, -6.837776515449541E-01, 2.554694165945851E-01 }, /* 7600 Hz */
-    { 1.436719007740110E-01, 2.873438015480220E-01, 1.436719007740110E-01, -6.797918579386563E-01, 2.544794610347002E-01 }, /* 7625 Hz */
-    { 1.444220747312154E-01, 2.888441494624309E-01, 1.444220747312154E-01, -6.758077664754754E-01, 2.534960654003371E-01 }, /* 7650 Hz */
-    { 1.451734612352664E-01, 2.903469224705328E-01, 1.451734612352664E-01, -6.718253680834236E-01, 2.525192130244892E-01 }, /* 7675 Hz */
-    { 1.459260584219629E-01, 2.918521168439258E-01, 1.459260584219629E-01, -6.678446536746783E-01, 2.515488873625297E-01 }, /* 7700 Hz */
-    { 1.466798644614748E-01, 2.933597289229496E-01, 1.466798644614748E-01, -6.638656141458168E-01, 2.505850719917160E-01 }, /* 7725 Hz */
-    { 1.474348775581631E-01, 2.948697551163263E-01, 1.474348775581631E-01, -6.598882403780457E-01, 2.496277506106984E-01 }, /* 7750 Hz */
-    { 1.481910959504000E-01, 2.963821919008001E-01, 1.481910959504000E-01, -6.559125232374323E-01, 2.486769070390324E-01 }, /* 7775 Hz */
-    { 1.489485179103914E-01, 2.978970358207828E-01, 1.489485179103914E-01, -6.519384535751299E-01, 2.477325252166954E-01 }, /* 7800 Hz */
-    { 1.497071417440013E-01, 2.994142834880027E-01, 1.497071417440013E-01, -6.479660222276007E-01, 2.467945892036060E-01 }, /* 7825 Hz */
-    { 1.504669657905780E-01, 3.009339315811560E-01, 1.504669657905780E-01, -6.439952200168364E-01, 2.458630831791484E-01 }, /* 7850 Hz */
-    { 1.512279884227810E-01, 3.024559768455619E-01, 1.512279884227810E-01, -6.400260377505753E-01, 2.449379914416991E-01 }, /* 7875 Hz */
-    { 1.519902080464105E-01, 3.039804160928210E-01, 1.519902080464105E-01, -6.360584662225164E-01, 2.440192984081583E-01 }, /* 7900 Hz */
-    { 1.527536231002379E-01, 3.055072462004757E-01, 1.527536231002379E-01, -6.320924962125334E-01, 2.431069886134848E-01 }, /* 7925 Hz */
-    { 1.535182320558383E-01, 3.070364641116766E-01, 1.535182320558383E-01, -6.281281184868803E-01, 2.422010467102336E-01 }, /* 7950 Hz */
-    { 1.542840334174246E-01, 3.085680668348493E-01, 1.542840334174246E-01, -6.241653237984000E-01, 2.413014574680984E-01 }, /* 7975 Hz */
-    { 1.550510257216822E-01, 3.101020514433643E-01, 1.550510257216822E-01, -6.202041028867289E-01, 2.404082057734576E-01 }, /* 8000 Hz */
-    { 1.558192075376069E-01, 3.116384150752138E-01, 1.558192075376069E-01, -6.162444464784951E-01, 2.395212766289226E-01 }, /* 8025 Hz */
-    { 1.565885774663430E-01, 3.131771549326861E-01, 1.565885774663430E-01, -6.122863452875194E-01, 2.386406551528915E-01 }, /* 8050 Hz */
-    { 1.573591341410241E-01, 3.147182682820481E-01, 1.573591341410241E-01, -6.083297900150080E-01, 2.377663265791042E-01 }, /* 8075 Hz */
-    { 1.581308762266135E-01, 3.162617524532270E-01, 1.581308762266135E-01, -6.043747713497500E-01, 2.368982762562040E-01 }, /* 8100 Hz */
-    { 1.589038024197489E-01, 3.178076048394977E-01, 1.589038024197489E-01, -6.004212799683041E-01, 2.360364896472995E-01 }, /* 8125 Hz */
-    { 1.596779114485860E-01, 3.193558228971719E-01, 1.596779114485860E-01, -5.964693065351886E-01, 2.351809523295325E-01 }, /* 8150 Hz */
-    { 1.604532020726452E-01, 3.209064041452904E-01, 1.604532020726452E-01, -5.925188417030677E-01, 2.343316499936485E-01 }, /* 8175 Hz */
-    { 1.612296730826593E-01, 3.224593461653186E-01, 1.612296730826593E-01, -5.885698761129330E-01, 2.334885684435701E-01 }, /* 8200 Hz */
-    { 1.620073233004224E-01, 3.240146466008448E-01, 1.620073233004224E-01, -5.846224003942857E-01, 2.326516935959754E-01 }, /* 8225 Hz */
-    { 1.627861515786408E-01, 3.255723031572817E-01, 1.627861515786408E-01, -5.806764051653144E-01, 2.318210114798777E-01 }, /* 8250 Hz */
-    { 1.635661568007850E-01, 3.271323136015700E-01, 1.635661568007850E-01, -5.767318810330709E-01, 2.309965082362110E-01 }, /* 8275 Hz */
-    { 1.643473378809432E-01, 3.286946757618865E-01, 1.643473378809432E-01, -5.727888185936448E-01, 2.301781701174178E-01 }, /* 8300 Hz */
-    { 1.651296937636761E-01, 3.302593875273523E-01, 1.651296937636761E-01, -5.688472084323349E-01, 2.293659834870396E-01 }, /* 8325 Hz */
-    { 1.659132234238738E-01, 3.318264468477476E-01, 1.659132234238738E-01, -5.649070411238171E-01, 2.285599348193123E-01 }, /* 8350 Hz */
-    { 1.666979258666130E-01, 3.333958517332261E-01, 1.666979258666130E-01, -5.609683072323125E-01, 2.277600106987646E-01 }, /* 8375 Hz */
-    { 1.674838001270168E-01, 3.349676002540336E-01, 1.674838001270168E-01, -5.570309973117509E-01, 2.269661978198181E-01 }, /* 8400 Hz */
-    { 1.682708452701147E-01, 3.365416905402294E-01, 1.682708452701147E-01, -5.530951019059349E-01, 2.261784829863938E-01 }, /* 8425 Hz */
-    { 1.690590603907053E-01, 3.381181207814106E-01, 1.690590603907053E-01, -5.491606115486982E-01, 2.253968531115194E-01 }, /* 8450 Hz */
-    { 1.698484446132188E-01, 3.396968892264376E-01, 1.698484446132188E-01, -5.452275167640658E-01, 2.246212952169410E-01 }, /* 8475 Hz */
-    { 1.706389970915827E-01, 3.412779941831653E-01, 1.706389970915827E-01, -5.412958080664074E-01, 2.238517964327381E-01 }, /* 8500 Hz */
-    { 1.714307170090871E-01, 3.428614340181742E-01, 1.714307170090871E-01, -5.373654759605939E-01, 2.230883439969424E-01 }, /* 8525 Hz */
-    { 1.722236035782527E-01, 3.444472071565055E-01, 1.722236035782527E-01, -5.334365109421468E-01, 2.223309252551577E-01 }, /* 8550 Hz */
-    { 1.730176560406991E-01, 3.460353120813982E-01, 1.730176560406991E-01, -5.295089034973904E-01, 2.215795276601868E-01 }, /* 8575 Hz */
-    { 1.738128736670153E-01, 3.476257473340305E-01, 1.738128736670153E-01, -5.255826441035971E-01, 2.208341387716581E-01 }, /* 8600 Hz */
-    { 1.746092557566309E-01, 3.492185115132618E-01, 1.746092557566309E-01, -5.216577232291342E-01, 2.200947462556578E-01 }, /* 8625 Hz */
-    { 1.754068016376890E-01, 3.508136032753779E-01, 1.754068016376890E-01, -5.177341313336080E-01, 2.193613378843639E-01 }, /* 8650 Hz */
-    { 1.762055106669199E-01, 3.524110213338399E-01, 1.762055106669199E-01, -5.138118588680054E-01, 2.186339015356852E-01 }, /* 8675 Hz */
-    { 1.770053822295171E-01, 3.540107644590341E-01, 1.770053822295171E-01, -5.098908962748323E-01, 2.179124251929006E-01 }, /* 8700 Hz */
-    { 1.778064157390129E-01, 3.556128314780257E-01, 1.778064157390129E-01, -5.059712339882538E-01, 2.171968969443053E-01 }, /* 8725 Hz */
-    { 1.786086106371573E-01, 3.572172212743147E-01, 1.786086106371573E-01, -5.020528624342279E-01, 2.164873049828571E-01 }, /* 8750 Hz */
-    { 1.794119663937965E-01, 3.588239327875930E-01, 1.794119663937965E-01, -4.981357720306418E-01, 2.157836376058278E-01 }, /* 8775 Hz */
-    { 1.802164825067536E-01, 3.604329650135072E-01, 1.802164825067536E-01, -4.942199531874423E-01, 2.150858832144568E-01 }, /* 8800 Hz */
-    { 1.810221585017103E-01, 3.620443170034206E-01, 1.810221585017103E-01, -4.903053963067669E-01, 2.143940303136081E-01 }, /* 8825 Hz */
-    { 1.818289939320892E-01, 3.636579878641784E-01, 1.818289939320892E-01, -4.863920917830739E-01, 2.137080675114307E-01 }, /* 8850 Hz */
-    { 1.826369883789388E-01, 3.652739767578775E-01, 1.826369883789388E-01, -4.824800300032673E-01, 2.130279835190225E-01 }, /* 8875 Hz */
-    { 1.834461414508182E-01, 3.668922829016364E-01, 1.834461414508182E-01, -4.785692013468226E-01, 2.123537671500955E-01 }, /* 8900 Hz */
-    { 1.842564527836841E-01, 3.685129055673682E-01, 1.842564527836841E-01, -4.746595961859102E-01, 2.116854073206465E-01 }, /* 8925 Hz */
-    { 1.850679220407781E-01, 3.701358440815563E-01, 1.850679220407781E-01, -4.707512048855176E-01, 2.110228930486301E-01 }, /* 8950 Hz */
-    { 1.858805489125163E-01, 3.717610978250326E-01, 1.858805489125163E-01, -4.668440178035679E-01, 2.103662134536330E-01 }, /* 8975 Hz */
-    { 1.866943331163785E-01, 3.733886662327569E-01, 1.866943331163785E-01, -4.629380252910409E-01, 2.097153577565548E-01 }, /* 9000 Hz */
-    { 1.875092743968005E-01, 3.750185487936010E-01, 1.875092743968005E-01, -4.590332176920867E-01, 2.090703152792887E-01 }, /* 9025 Hz */
-    { 1.883253725250662E-01, 3.766507450501325E-01, 1.883253725250662E-01, -4.551295853441423E-01, 2.084310754444073E-01 }, /* 9050 Hz */
-    { 1.891426272992012E-01, 3.782852545984023E-01, 1.891426272992012E-01, -4.512271185780454E-01, 2.077976277748502E-01 }, /* 9075 Hz */
-    { 1.899610385438676E-01, 3.799220770877352E-01, 1.899610385438676E-01, -4.473258077181451E-01, 2.071699618936155E-01 }, /* 9100 Hz */
-    { 1.907806061102605E-01, 3.815612122205209E-01, 1.907806061102605E-01, -4.434256430824122E-01, 2.065480675234540E-01 }, /* 9125 Hz */
-    { 1.916013298760043E-01, 3.832026597520086E-01, 1.916013298760043E-01, -4.395266149825489E-01, 2.059319344865661E-01 }, /* 9150 Hz */
-    { 1.924232097450517E-01, 3.848464194901035E-01, 1.924232097450517E-01, -4.356287137240958E-01, 2.053215527043028E-01 }, /* 9175 Hz */
-    { 1.932462456475826E-01, 3.864924912951653E-01, 1.932462456475826E-01, -4.317319296065367E-01, 2.047169121968672E-01 }, /* 9200 Hz */
-    { 1.940704375399049E-01, 3.881408750798098E-01, 1.940704375399049E-01, -4.278362529234037E-01, 2.041180030830233E-01 }, /* 9225 Hz */
-    { 1.948957854043558E-01, 3.897915708087117E-01, 1.948957854043558E-01, -4.239416739623796E-01, 2.035248155798030E-01 }, /* 9250 Hz */
-    { 1.957222892492054E-01, 3.914445784984107E-01, 1.957222892492054E-01, -4.200481830053972E-01, 2.029373400022187E-01 }, /* 9275 Hz */
-    { 1.965499491085590E-01, 3.930998982171179E-01, 1.965499491085590E-01, -4.161557703287435E-01, 2.023555667629794E-01 }, /* 9300 Hz */
-    { 1.973787650422635E-01, 3.947575300845269E-01, 1.973787650422635E-01, -4.122644262031543E-01, 2.017794863722081E-01 }, /* 9325 Hz */
-    { 1.982087371358125E-01, 3.964174742716250E-01, 1.982087371358125E-01, -4.083741408939120E-01, 2.012090894371620E-01 }, /* 9350 Hz */
-    { 1.990398655002541E-01, 3.980797310005082E-01, 1.990398655002541E-01, -4.044849046609420E-01, 2.006443666619583E-01 }, /* 9375 Hz */
-    { 1.998721502720980E-01, 3.997443005441961E-01, 1.998721502720980E-01, -4.005967077589070E-01, 2.000853088472991E-01 }, /* 9400 Hz */
-    { 2.007055916132259E-01, 4.014111832264518E-01, 2.007055916132259E-01, -3.967095404372986E-01, 1.995319068902022E-01 }, /* 9425 Hz */
-    { 2.015401897108010E-01, 4.030803794216020E-01, 2.015401897108010E-01, -3.928233929405298E-01, 1.989841517837337E-01 }, /* 9450 Hz */
-    { 2.023759447771795E-01, 4.047518895543590E-01, 2.023759447771795E-01, -3.889382555080252E-01, 1.984420346167432E-01 }, /* 9475 Hz */
-    { 2.032128570498230E-01, 4.064257140996460E-01, 2.032128570498230E-01, -3.850541183743105E-01, 1.979055465736024E-01 }, /* 9500 Hz */
-    { 2.040509267912119E-01, 4.081018535824238E-01, 2.040509267912119E-01, -3.811709717690985E-01, 1.973746789339461E-01 }, /* 9525 Hz */
-    { 2.048901542887600E-01, 4.097803085775201E-01, 2.048901542887600E-01, -3.772888059173772E-01, 1.968494230724173E-01 }, /* 9550 Hz */
-    { 2.057305398547296E-01, 4.114610797094591E-01, 2.057305398547296E-01, -3.734076110394945E-01, 1.963297704584127E-01 }, /* 9575 Hz */
-    { 2.065720838261479E-01, 4.131441676522958E-01, 2.065720838261479E-01, -3.695273773512415E-01, 1.958157126558331E-01 }, /* 9600 Hz */
-    { 2.074147865647253E-01, 4.148295731294507E-01, 2.074147865647253E-01, -3.656480950639356E-01, 1.953072413228370E-01 }, /* 9625 Hz */
-    { 2.082586484567729E-01, 4.165172969135457E-01, 2.082586484567729E-01, -3.617697543845033E-01, 1.948043482115947E-01 }, /* 9650 Hz */
-    { 2.091036699131223E-01, 4.182073398262445E-01, 2.091036699131223E-01, -3.578923455155583E-01, 1.943070251680474E-01 }, /* 9675 Hz */
-    { 2.099498513690465E-01, 4.198997027380930E-01, 2.099498513690465E-01, -3.540158586554818E-01, 1.938152641316678E-01 }, /* 9700 Hz */
-    { 2.107971932841806E-01, 4.215943865683612E-01, 2.107971932841806E-01, -3.501402839985022E-01, 1.933290571352245E-01 }, /* 9725 Hz */
-    { 2.116456961424449E-01, 4.232913922848897E-01, 2.116456961424449E-01, -3.462656117347688E-01, 1.928483963045482E-01 }, /* 9750 Hz */
-    { 2.124953604519679E-01, 4.249907209039358E-01, 2.124953604519679E-01, -3.423918320504302E-01, 1.923732738583018E-01 }, /* 9775 Hz */
-    { 2.133461867450109E-01, 4.266923734900219E-01, 2.133461867450109E-01, -3.385189351277081E-01, 1.919036821077518E-01 }, /* 9800 Hz */
-    { 2.141981755778933E-01, 4.283963511557867E-01, 2.141981755778933E-01, -3.346469111449702E-01, 1.914396134565435E-01 }, /* 9825 Hz */
-    { 2.150513275309186E-01, 4.301026550618373E-01, 2.150513275309186E-01, -3.307757502768047E-01, 1.909810604004792E-01 }, /* 9850 Hz */
-    { 2.159056432083020E-01, 4.318112864166039E-01, 2.159056432083020E-01, -3.269054426940905E-01, 1.905280155272984E-01 }, /* 9875 Hz */
-    { 2.167611232380982E-01, 4.335222464761965E-01, 2.167611232380982E-01, -3.230359785640680E-01, 1.900804715164609E-01 }, /* 9900 Hz */
-    { 2.176177682721313E-01, 4.352355365442625E-01, 2.176177682721313E-01, -3.191673480504078E-01, 1.896384211389329E-01 }, /* 9925 Hz */
-    { 2.184755789859237E-01, 4.369511579718475E-01, 2.184755789859237E-01, -3.152995413132808E-01, 1.892018572569757E-01 }, /* 9950 Hz */
-    { 2.193345560786281E-01, 4.386691121572562E-01, 2.193345560786281E-01, -3.114325485094245E-01, 1.887707728239369E-01 }, /* 9975 Hz */
-    { 2.201947002729587E-01, 4.403894005459174E-01, 2.201947002729587E-01, -3.075663597922099E-01, 1.883451608840446E-01 }, /* 10000 Hz */
-    { 2.210560123151243E-01, 4.421120246302487E-01, 2.210560123151243E-01, -3.037009653117070E-01, 1.879250145722043E-01 }, /* 10025 Hz */
-    { 2.219184929747624E-01, 4.438369859495248E-01, 2.219184929747624E-01, -2.998363552147488E-01, 1.875103271137983E-01 }, /* 10050 Hz */
-    { 2.227821430448725E-01, 4.455642860897450E-01, 2.227821430448725E-01, -2.959725196449972E-01, 1.871010918244872E-01 }, /* 10075 Hz */
-    { 2.236469633417535E-01, 4.472939266835070E-01, 2.236469633417535E-01, -2.921094487430028E-01, 1.866973021100167E-01 }, /* 10100 Hz */
-    { 2.245129547049387E-01, 4.490259094098774E-01, 2.245129547049387E-01, -2.882471326462676E-01, 1.862989514660224E-01 }, /* 10125 Hz */
-    { 2.253801179971335E-01, 4.507602359942671E-01, 2.253801179971335E-01, -2.843855614893083E-01, 1.859060334778424E-01 }, /* 10150 Hz */
-    { 2.262484541041538E-01, 4.524969082083076E-01, 2.262484541041538E-01, -2.805247254037130E-01, 1.855185418203282E-01 }, /* 10175 Hz */
-    { 2.271179639348647E-01, 4.542359278697294E-01, 2.271179639348647E-01, -2.766646145182032E-01, 1.851364702576621E-01 }, /* 10200 Hz */
-    { 2.279886484211207E-01, 4.559772968422414E-01, 2.279886484211207E-01, -2.728052189586906E-01, 1.847598126431734E-01 }, /* 10225 Hz */
-    { 2.288605085177065E-01, 4.577210170354129E-01, 2.288605085177065E-01, -2.689465288483345E-01, 1.843885629191603E-01 }, /* 10250 Hz */
-    { 2.297335452022782E-01, 4.594670904045565E-01, 2.297335452022782E-01, -2.650885343076002E-01, 1.840227151167131E-01 }, /* 10275 Hz */
-    { 2.306077594753070E-01, 4.612155189506139E-01, 2.306077594753070E-01, -2.612312254543125E-01, 1.836622633555404E-01 }, /* 10300 Hz */
-    { 2.314831523600209E-01, 4.629663047200417E-01, 2.314831523600209E-01, -2.573745924037132E-01, 1.833072018437966E-01 }, /* 10325 Hz */
-    { 2.323597249023501E-01, 4.647194498047003E-01, 2.323597249023501E-01, -2.535186252685147E-01, 1.829575248779151E-01 }, /* 10350 Hz */
-    { 2.332374781708719E-01, 4.664749563417437E-01, 2.332374781708719E-01, -2.496633141589525E-01, 1.826132268424400E-01 }, /* 10375 Hz */
-    { 2.341164132567563E-01, 4.682328265135126E-01, 2.341164132567563E-01, -2.458086491828392E-01, 1.822743022098643E-01 }, /* 10400 Hz */
-    { 2.349965312737126E-01, 4.699930625474251E-01, 2.349965312737126E-01, -2.419546204456173E-01, 1.819407455404675E-01 }, /* 10425 Hz */
-    { 2.358778333579377E-01, 4.717556667158753E-01, 2.358778333579377E-01, -2.381012180504072E-01, 1.816125514821578E-01 }, /* 10450 Hz */
-    { 2.367603206680637E-01, 4.735206413361273E-01, 2.367603206680637E-01, -2.342484320980627E-01, 1.812897147703173E-01 }, /* 10475 Hz */
-    { 2.376439943851075E-01, 4.752879887702151E-01, 2.376439943851075E-01, -2.303962526872166E-01, 1.809722302276468E-01 }, /* 10500 Hz */
-    { 2.385288557124206E-01, 4.770577114248412E-01, 2.385288557124206E-01, -2.265446699143339E-01, 1.806600927640163E-01 }, /* 10525 Hz */
-    { 2.394149058756401E-01, 4.788298117512801E-01, 2.394149058756401E-01, -2.226936738737566E-01, 1.803532973763169E-01 }, /* 10550 Hz */
-    { 2.403021461226402E-01, 4.806042922452805E-01, 2.403021461226402E-01, -2.188432546577541E-01, 1.800518391483149E-01 }, /* 10575 Hz */
-    { 2.411905777234847E-01, 4.823811554469694E-01, 2.411905777234847E-01, -2.149934023565701E-01, 1.797557132505089E-01 }, /* 10600 Hz */
-    { 2.420802019703804E-01, 4.841604039407608E-01, 2.420802019703804E-01, -2.111441070584677E-01, 1.794649149399892E-01 }, /* 10625 Hz */
-    { 2.429710201776306E-01, 4.859420403552611E-01, 2.429710201776306E-01, -2.072953588497781E-01, 1.791794395603004E-01 }, /* 10650 Hz */
-    { 2.438630336815903E-01, 4.877260673631806E-01, 2.438630336815903E-01, -2.034471478149436E-01, 1.788992825413049E-01 }, /* 10675 Hz */
-    { 2.447562438406218E-01, 4.895124876812437E-01, 2.447562438406218E-01, -1.995994640365642E-01, 1.786244393990515E-01 }, /* 10700 Hz */
-    { 2.456506520350510E-01, 4.913013040701020E-01, 2.456506520350510E-01, -1.957522975954401E-01, 1.783549057356440E-01 }, /* 10725 Hz */
-    { 2.465462596671242E-01, 4.930925193342484E-01, 2.465462596671242E-01, -1.919056385706171E-01, 1.780906772391138E-01 }, /* 10750 Hz */
-    { 2.474430681609665E-01, 4.948861363219331E-01, 2.474430681609665E-01, -1.880594770394280E-01, 1.778317496832942E-01 }, /* 10775 Hz */
-    { 2.483410789625405E-01, 4.966821579250811E-01, 2.483410789625405E-01, -1.842138030775359E-01, 1.775781189276981E-01 }, /* 10800 Hz */
-    { 2.492402935396053E-01, 4.984805870792106E-01, 2.492402935396053E-01, -1.803686067589768E-01, 1.773297809173979E-01 }, /* 10825 Hz */
-    { 2.501407133816765E-01, 5.002814267633531E-01, 2.501407133816765E-01, -1.765238781562002E-01, 1.770867316829065E-01 }, /* 10850 Hz */
-    { 2.510423399999884E-01, 5.020846799999767E-01, 2.510423399999884E-01, -1.726796073401101E-01, 1.768489673400636E-01 }, /* 10875 Hz */
-    { 2.519451749274541E-01, 5.038903498549082E-01, 2.519451749274541E-01, -1.688357843801055E-01, 1.766164840899219E-01 }, /* 10900 Hz */
-    { 2.528492197186290E-01, 5.056984394372580E-01, 2.528492197186290E-01, -1.649923993441211E-01, 1.763892782186370E-01 }, /* 10925 Hz */
-    { 2.537544759496736E-01, 5.075089518993472E-01, 2.537544759496736E-01, -1.611494422986652E-01, 1.761673460973597E-01 }, /* 10950 Hz */
-    { 2.546609452183177E-01, 5.093218904366353E-01, 2.546609452183177E-01, -1.573069033088599E-01, 1.759506841821307E-01 }, /* 10975 Hz */
-    { 2.555686291438245E-01, 5.111372582876490E-01, 2.555686291438245E-01, -1.534647724384791E-01, 1.757392890137771E-01 }, /* 11000 Hz */
-    { 2.564775293669565E-01, 5.129550587339130E-01, 2.564775293669565E-01, -1.496230397499874E-01, 1.755331572178134E-01 }, /* 11025 Hz */
-    { 2.573876475499414E-01, 5.147752950998828E-01, 2.573876475499414E-01, -1.457816953045764E-01, 1.753322855043421E-01 }, /* 11050 Hz */
-    { 2.582989853764391E-01, 5.165979707528783E-01, 2.582989853764391E-01, -1.419407291622025E-01, 1.751366706679592E-01 }, /* 11075 Hz */
-    { 2.592115445515091E-01, 5.184230891030182E-01, 2.592115445515091E-01, -1.381001313816244E-01, 1.749463095876606E-01 }, /* 11100 Hz */
-    { 2.601253268015784E-01, 5.202506536031568E-01, 2.601253268015784E-01, -1.342598920204384E-01, 1.747611992267520E-01 }, /* 11125 Hz */
-    { 2.610403338744116E-01, 5.220806677488231E-01, 2.610403338744116E-01, -1.304200011351146E-01, 1.745813366327607E-01 }, /* 11150 Hz */
-    { 2.619565675390791E-01, 5.239131350781583E-01, 2.619565675390791E-01, -1.265804487810334E-01, 1.744067189373500E-01 }, /* 11175 Hz */
-    { 2.628740295859290E-01, 5.257480591718581E-01, 2.628740295859290E-01, -1.227412250125193E-01, 1.742373433562355E-01 }, /* 11200 Hz */
-    { 2.637927218265570E-01, 5.275854436531140E-01, 2.637927218265570E-01, -1.189023198828774E-01, 1.740732071891053E-01 }, /* 11225 Hz */
-    { 2.647126460937785E-01, 5.294252921875570E-01, 2.647126460937785E-01, -1.150637234444272E-01, 1.739143078195411E-01 }, /* 11250 Hz */
-    { 2.656338042416017E-01, 5.312676084832034E-01, 2.656338042416017E-01, -1.112254257485353E-01, 1.737606427149422E-01 }, /* 11275 Hz */
-    { 2.665561981452000E-01, 5.331123962904001E-01, 2.665561981452000E-01, -1.073874168456525E-01, 1.736122094264527E-01 }, /* 11300 Hz */
-    { 2.674798297008864E-01, 5.349596594017728E-01, 2.674798297008864E-01, -1.035496867853447E-01, 1.734690055888904E-01 }, /* 11325 Hz */
-    { 2.684047008260876E-01, 5.368094016521753E-01, 2.684047008260876E-01, -9.971222561632645E-02, 1.733310289206771E-01 }, /* 11350 Hz */
-    { 2.693308134593195E-01, 5.386616269186389E-01, 2.693308134593195E-01, -9.587502338649612E-02, 1.731982772237741E-01 }, /* 11375 Hz */
-    { 2.702581695601632E-01, 5.405163391203264E-01, 2.702581695601632E-01, -9.203807014296504E-02, 1.730707483836178E-01 }, /* 11400 Hz */
-    { 2.711867711092413E-01, 5.423735422184826E-01, 2.711867711092413E-01, -8.820135593209320E-02, 1.729484403690583E-01 }, /* 11425 Hz */
-    { 2.721166201081952E-01, 5.442332402163904E-01, 2.721166201081952E-01, -8.436487079951970E-02, 1.728313512323005E-01 }, /* 11450 Hz */
-    { 2.730477185796634E-01, 5.460954371593267E-01, 2.730477185796634E-01, -8.052860479019436E-02, 1.727194791088479E-01 }, /* 11475 Hz */
-    { 2.739800685672595E-01, 5.479601371345191E-01, 2.739800685672595E-01, -7.669254794841063E-02, 1.726128222174487E-01 }, /* 11500 Hz */
-    { 2.749136721355520E-01, 5.498273442711039E-01, 2.749136721355520E-01, -7.285669031783597E-02, 1.725113788600439E-01 }, /* 11525 Hz */
-    { 2.758485313700436E-01, 5.516970627400871E-01, 2.758485313700436E-01, -6.902102194154375E-02, 1.724151474217180E-01 }, /* 11550 Hz */
-    { 2.767846483771523E-01, 5.535692967543047E-01, 2.767846483771523E-01, -6.518553286204369E-02, 1.723241263706529E-01 }, /* 11575 Hz */
-    { 2.777220252841923E-01, 5.554440505683846E-01, 2.777220252841923E-01, -6.135021312131353E-02, 1.722383142580828E-01 }, /* 11600 Hz */
-    { 2.786606642393563E-01, 5.573213284787126E-01, 2.786606642393563E-01, -5.751505276082734E-02, 1.721577097182526E-01 }, /* 11625 Hz */
-    { 2.796005674116970E-01, 5.592011348233940E-01, 2.796005674116970E-01, -5.368004182159004E-02, 1.720823114683779E-01 }, /* 11650 Hz */
-    { 2.805417369911113E-01, 5.610834739822227E-01, 2.805417369911113E-01, -4.984517034416348E-02, 1.720121183086089E-01 }, /* 11675 Hz */
-    { 2.814841751883239E-01, 5.629683503766478E-01, 2.814841751883239E-01, -4.601042836869890E-02, 1.719471291219946E-01 }, /* 11700 Hz */
-    { 2.824278842348709E-01, 5.648557684697417E-01, 2.824278842348709E-01, -4.217580593496695E-02, 1.718873428744505E-01 }, /* 11725 Hz */
-    { 2.833728663830860E-01, 5.667457327661720E-01, 2.833728663830860E-01, -3.834129308238556E-02, 1.718327586147297E-01 }, /* 11750 Hz */
-    { 2.843191239060851E-01, 5.686382478121702E-01, 2.843191239060851E-01, -3.450687985005339E-02, 1.717833754743938E-01 }, /* 11775 Hz */
-    { 2.852666590977539E-01, 5.705333181955078E-01, 2.852666590977539E-01, -3.067255627677384E-02, 1.717391926677893E-01 }, /* 11800 Hz */
-    { 2.862154742727334E-01, 5.724309485454667E-01, 2.862154742727334E-01, -2.683831240109043E-02, 1.717002094920239E-01 }, /* 11825 Hz */
-    { 2.871655717664084E-01, 5.743311435328168E-01, 2.871655717664084E-01, -2.300413826131269E-02, 1.716664253269463E-01 }, /* 11850 Hz */
-    { 2.881169539348954E-01, 5.762339078697909E-01, 2.881169539348954E-01, -1.917002389554667E-02, 1.716378396351284E-01 }, /* 11875 Hz */
-    { 2.890696231550316E-01, 5.781392463100632E-01, 2.890696231550316E-01, -1.533595934172298E-02, 1.716144519618495E-01 }, /* 11900 Hz */
-    { 2.900235818243640E-01, 5.800471636487280E-01, 2.900235818243640E-01, -1.150193463762769E-02, 1.715962619350837E-01 }, /* 11925 Hz */
-    { 2.909788323611396E-01, 5.819576647222793E-01, 2.909788323611396E-01, -7.667939820929920E-03, 1.715832692654885E-01 }, /* 11950 Hz */
-    { 2.919353772042959E-01, 5.838707544085918E-01, 2.919353772042959E-01, -3.833964929212841E-03, 1.715754737463966E-01 }, /* 11975 Hz */
-    { 2.928932188134524E-01, 5.857864376269049E-01, 2.928932188134524E-01, -2.220446049250313E-16, 1.715728752538100E-01 }, /* 12000 Hz */
-    { 2.938523596689023E-01, 5.877047193378047E-01, 2.938523596689023E-01, 3.833964929212702E-03, 1.715754737463966E-01 }, /* 12025 Hz */
-    { 2.948128022716046E-01, 5.896256045432091E-01, 2.948128022716046E-01, 7.667939820929809E-03, 1.715832692654885E-01 }, /* 12050 Hz */
-    { 2.957745491431778E-01, 5.915490982863556E-01, 2.957745491431778E-01, 1.150193463762737E-02, 1.715962619350837E-01 }, /* 12075 Hz */
-    { 2.967376028258931E-01, 5.934752056517861E-01, 2.967376028258931E-01, 1.533595934172260E-02, 1.716144519618496E-01 }, /* 12100 Hz */
-    { 2.977019658826688E-01, 5.954039317653377E-01, 2.977019658826688E-01, 1.917002389554689E-02, 1.716378396351284E-01 }, /* 12125 Hz */
-    { 2.986676408970648E-01, 5.973352817941295E-01, 2.986676408970648E-01, 2.300413826131274E-02, 1.716664253269463E-01 }, /* 12150 Hz */
-    { 2.996346304732787E-01, 5.992692609465573E-01, 2.996346304732787E-01, 2.683831240109069E-02, 1.717002094920240E-01 }, /* 12175 Hz */
-    { 3.006029372361407E-01, 6.012058744722815E-01, 3.006029372361407E-01, 3.067255627677366E-02, 1.717391926677894E-01 }, /* 12200 Hz */
-    { 3.015725638311118E-01, 6.031451276622235E-01, 3.015725638311118E-01, 3.450687985005312E-02, 1.717833754743938E-01 }, /* 12225 Hz */
-    { 3.025435129242788E-01, 6.050870258485577E-01, 3.025435129242788E-01, 3.834129308238576E-02, 1.718327586147296E-01 }, /* 12250 Hz */
-    { 3.035157872023543E-01, 6.070315744047086E-01, 3.035157872023543E-01, 4.217580593496675E-02, 1.718873428744505E-01 }, /* 12275 Hz */
-    { 3.044893893726732E-01, 6.089787787453464E-01, 3.044893893726732E-01, 4.601042836869845E-02, 1.719471291219945E-01 }, /* 12300 Hz */
-    { 3.054643221631930E-01, 6.109286443263860E-01, 3.054643221631930E-01, 4.984517034416325E-02, 1.720121183086089E-01 }, /* 12325 Hz */
-    { 3.064405883224919E-01, 6.128811766449838E-01, 3.064405883224919E-01, 5.368004182158957E-02, 1.720823114683779E-01 }, /* 12350 Hz */
-    { 3.074181906197700E-01, 6.148363812395400E-01, 3.074181906197700E-01, 5.751505276082731E-02, 1.721577097182526E-01 }, /* 12375 Hz */
-    { 3.083971318448490E-01, 6.167942636896980E-01, 3.083971318448490E-01, 6.135021312131331E-02, 1.722383142580828E-01 }, /* 12400 Hz */
-    { 3.093774148081742E-01, 6.187548296163483E-01, 3.093774148081742E-01, 6.518553286204364E-02, 1.723241263706529E-01 }, /* 12425 Hz */
-    { 3.103590423408155E-01, 6.207180846816309E-01, 3.103590423408155E-01, 6.902102194154382E-02, 1.724151474217180E-01 }, /* 12450 Hz */
-    { 3.113420172944699E-01, 6.226840345889398E-01, 3.113420172944699E-01, 7.285669031783590E-02, 1.725113788600438E-01 }, /* 12475 Hz */
-    { 3.123263425414649E-01, 6.246526850829297E-01, 3.123263425414649E-01, 7.669254794841074E-02, 1.726128222174488E-01 }, /* 12500 Hz */
-    { 3.133120209747605E-01, 6.266240419495210E-01, 3.133120209747605E-01, 8.052860479019416E-02, 1.727194791088480E-01 }, /* 12525 Hz */
-    { 3.142990555079551E-01, 6.285981110159102E-01, 3.142990555079551E-01, 8.436487079951990E-02, 1.728313512323005E-01 }, /* 12550 Hz */
-    { 3.152874490752879E-01, 6.305748981505758E-01, 3.152874490752879E-01, 8.820135593209315E-02, 1.729484403690584E-01 }, /* 12575 Hz */
-    { 3.162772046316457E-01, 6.325544092632913E-01, 3.162772046316457E-01, 9.203807014296490E-02, 1.730707483836179E-01 }, /* 12600 Hz */
-    { 3.172683251525675E-01, 6.345366503051350E-01, 3.172683251525675E-01, 9.587502338649578E-02, 1.731982772237741E-01 }, /* 12625 Hz */
-    { 3.182608136342508E-01, 6.365216272685017E-01, 3.182608136342508E-01, 9.971222561632637E-02, 1.733310289206771E-01 }, /* 12650 Hz */
-    { 3.192546730935587E-01, 6.385093461871174E-01, 3.192546730935587E-01, 1.035496867853444E-01, 1.734690055888903E-01 }, /* 12675 Hz */
-    { 3.202499065680264E-01, 6.404998131360528E-01, 3.202499065680264E-01, 1.073874168456526E-01, 1.736122094264528E-01 }, /* 12700 Hz */
-    { 3.212465171158693E-01, 6.424930342317385E-01, 3.212465171158693E-01, 1.112254257485349E-01, 1.737606427149421E-01 }, /* 12725 Hz */
-    { 3.222445078159920E-01, 6.444890156319840E-01, 3.222445078159920E-01, 1.150637234444271E-01, 1.739143078195410E-01 }, /* 12750 Hz */
-    { 3.232438817679957E-01, 6.464877635359914E-01, 3.232438817679957E-01, 1.189023198828774E-01, 1.740732071891053E-01 }, /* 12775 Hz */
-    { 3.242446420921887E-01, 6.484892841843773E-01, 3.242446420921887E-01, 1.227412250125192E-01, 1.742373433562355E-01 }, /* 12800 Hz */
-    { 3.252467919295958E-01, 6.504935838591916E-01, 3.252467919295958E-01, 1.265804487810333E-01, 1.744067189373500E-01 }, /* 12825 Hz */
-    { 3.262503344419688E-01, 6.525006688839375E-01, 3.262503344419688E-01, 1.304200011351142E-01, 1.745813366327609E-01 }, /* 12850 Hz */
-    { 3.272552728117977E-01, 6.545105456235955E-01, 3.272552728117977E-01, 1.342598920204386E-01, 1.747611992267523E-01 }, /* 12875 Hz */
-    { 3.282616102423212E-01, 6.565232204846424E-01, 3.282616102423212E-01, 1.381001313816243E-01, 1.749463095876606E-01 }, /* 12900 Hz */
-    { 3.292693499575404E-01, 6.585386999150808E-01, 3.292693499575404E-01, 1.419407291622023E-01, 1.751366706679593E-01 }, /* 12925 Hz */
-    { 3.302784952022295E-01, 6.605569904044590E-01, 3.302784952022295E-01, 1.457816953045760E-01, 1.753322855043421E-01 }, /* 12950 Hz */
-    { 3.312890492419502E-01, 6.625780984839005E-01, 3.312890492419502E-01, 1.496230397499875E-01, 1.755331572178134E-01 }, /* 12975 Hz */
-    { 3.323010153630640E-01, 6.646020307261280E-01, 3.323010153630640E-01, 1.534647724384789E-01, 1.757392890137771E-01 }, /* 13000 Hz */
-    { 3.333143968727477E-01, 6.666287937454953E-01, 3.333143968727477E-01, 1.573069033088599E-01, 1.759506841821306E-01 }, /* 13025 Hz */
-    { 3.343291970990061E-01, 6.686583941980122E-01, 3.343291970990061E-01, 1.611494422986647E-01, 1.761673460973596E-01 }, /* 13050 Hz */
-    { 3.353454193906895E-01, 6.706908387813789E-01, 3.353454193906895E-01, 1.649923993441209E-01, 1.763892782186369E-01 }, /* 13075 Hz */
-    { 3.363630671175069E-01, 6.727261342350137E-01, 3.363630671175069E-01, 1.688357843801055E-01, 1.766164840899219E-01 }, /* 13100 Hz */
-    { 3.373821436700434E-01, 6.747642873400868E-01, 3.373821436700434E-01, 1.726796073401098E-01, 1.768489673400636E-01 }, /* 13125 Hz */
-    { 3.384026524597767E-01, 6.768053049195534E-01, 3.384026524597767E-01, 1.765238781562003E-01, 1.770867316829065E-01 }, /* 13150 Hz */
-    { 3.394245969190937E-01, 6.788491938381873E-01, 3.394245969190937E-01, 1.803686067589768E-01, 1.773297809173979E-01 }, /* 13175 Hz */
-    { 3.404479805013085E-01, 6.808959610026171E-01, 3.404479805013085E-01, 1.842138030775359E-01, 1.775781189276982E-01 }, /* 13200 Hz */
-    { 3.414728066806805E-01, 6.829456133613609E-01, 3.414728066806805E-01, 1.880594770394277E-01, 1.778317496832941E-01 }, /* 13225 Hz */
-    { 3.424990789524327E-01, 6.849981579048654E-01, 3.424990789524327E-01, 1.919056385706171E-01, 1.780906772391138E-01 }, /* 13250 Hz */
-    { 3.435268008327711E-01, 6.870536016655422E-01, 3.435268008327711E-01, 1.957522975954402E-01, 1.783549057356441E-01 }, /* 13275 Hz */
-    { 3.445559758589039E-01, 6.891119517178077E-01, 3.445559758589039E-01, 1.995994640365640E-01, 1.786244393990515E-01 }, /* 13300 Hz */
-    { 3.455866075890620E-01, 6.911732151781240E-01, 3.455866075890620E-01, 2.034471478149432E-01, 1.788992825413048E-01 }, /* 13325 Hz */
-    { 3.466186996025196E-01, 6.932373992050392E-01, 3.466186996025196E-01, 2.072953588497781E-01, 1.791794395603004E-01 }, /* 13350 Hz */
-    { 3.476522554996141E-01, 6.953045109992282E-01, 3.476522554996141E-01, 2.111441070584670E-01, 1.794649149399892E-01 }, /* 13375 Hz */
-    { 3.486872789017698E-01, 6.973745578035395E-01, 3.486872789017698E-01, 2.149934023565699E-01, 1.797557132505090E-01 }, /* 13400 Hz */
-    { 3.497237734515173E-01, 6.994475469030346E-01, 3.497237734515173E-01, 2.188432546577541E-01, 1.800518391483149E-01 }, /* 13425 Hz */
-    { 3.507617428125184E-01, 7.015234856250367E-01, 3.507617428125184E-01, 2.226936738737565E-01, 1.803532973763169E-01 }, /* 13450 Hz */
-    { 3.518011906695875E-01, 7.036023813391750E-01, 3.518011906695875E-01, 2.265446699143337E-01, 1.806600927640162E-01 }, /* 13475 Hz */
-    { 3.528421207287158E-01, 7.056842414574317E-01, 3.528421207287158E-01, 2.303962526872167E-01, 1.809722302276467E-01 }, /* 13500 Hz */
-    { 3.538845367170950E-01, 7.077690734341899E-01, 3.538845367170950E-01, 2.342484320980626E-01, 1.812897147703174E-01 }, /* 13525 Hz */
-    { 3.549284423831413E-01, 7.098568847662825E-01, 3.549284423831413E-01, 2.381012180504070E-01, 1.816125514821579E-01 }, /* 13550 Hz */
-    { 3.559738414965211E-01, 7.119476829930421E-01, 3.559738414965211E-01, 2.419546204456168E-01, 1.819407455404674E-01 }, /* 13575 Hz */
-    { 3.570207378481758E-01, 7.140414756963517E-01, 3.570207378481758E-01, 2.458086491828391E-01, 1.822743022098642E-01 }, /* 13600 Hz */
-    { 3.580691352503481E-01, 7.161382705006962E-01, 3.580691352503481E-01, 2.496633141589526E-01, 1.826132268424400E-01 }, /* 13625 Hz */
-    { 3.591190375366074E-01, 7.182380750732148E-01, 3.591190375366074E-01, 2.535186252685144E-01, 1.829575248779151E-01 }, /* 13650 Hz */
-    { 3.601704485618775E-01, 7.203408971237550E-01, 3.601704485618775E-01, 2.573745924037134E-01, 1.833072018437968E-01 }, /* 13675 Hz */
-    { 3.612233722024631E-01, 7.224467444049263E-01, 3.612233722024631E-01, 2.612312254543122E-01, 1.836622633555404E-01 }, /* 13700 Hz */
-    { 3.622778123560783E-01, 7.245556247121566E-01, 3.622778123560783E-01, 2.650885343076002E-01, 1.840227151167131E-01 }, /* 13725 Hz */
-    { 3.633337729418737E-01, 7.266675458837474E-01, 3.633337729418737E-01, 2.689465288483344E-01, 1.843885629191603E-01 }, /* 13750 Hz */
-    { 3.643912579004659E-01, 7.287825158009319E-01, 3.643912579004659E-01, 2.728052189586905E-01, 1.847598126431733E-01 }, /* 13775 Hz */
-    { 3.654502711939662E-01, 7.309005423879325E-01, 3.654502711939662E-01, 2.766646145182030E-01, 1.851364702576621E-01 }, /* 13800 Hz */
-    { 3.665108168060103E-01, 7.330216336120206E-01, 3.665108168060103E-01, 2.805247254037130E-01, 1.855185418203282E-01 }, /* 13825 Hz */
-    { 3.675728987417875E-01, 7.351457974835750E-01, 3.675728987417875E-01, 2.843855614893077E-01, 1.859060334778423E-01 }, /* 13850 Hz */
-    { 3.686365210280724E-01, 7.372730420561449E-01, 3.686365210280724E-01, 2.882471326462673E-01, 1.862989514660225E-01 }, /* 13875 Hz */
-    { 3.697016877132548E-01, 7.394033754265096E-01, 3.697016877132548E-01, 2.921094487430024E-01, 1.866973021100167E-01 }, /* 13900 Hz */
-    { 3.707684028673711E-01, 7.415368057347421E-01, 3.707684028673711E-01, 2.959725196449969E-01, 1.871010918244873E-01 }, /* 13925 Hz */
-    { 3.718366705821368E-01, 7.436733411642736E-01, 3.718366705821368E-01, 2.998363552147491E-01, 1.875103271137982E-01 }, /* 13950 Hz */
-    { 3.729064949709778E-01, 7.458129899419556E-01, 3.729064949709778E-01, 3.037009653117068E-01, 1.879250145722043E-01 }, /* 13975 Hz */
-    { 3.739778801690636E-01, 7.479557603381273E-01, 3.739778801690636E-01, 3.075663597922098E-01, 1.883451608840447E-01 }, /* 14000 Hz */
-    { 3.750508303333404E-01, 7.501016606666807E-01, 3.750508303333404E-01, 3.114325485094245E-01, 1.887707728239370E-01 }, /* 14025 Hz */
-    { 3.761253496425642E-01, 7.522506992851284E-01, 3.761253496425642E-01, 3.152995413132810E-01, 1.892018572569758E-01 }, /* 14050 Hz */
-    { 3.772014422973352E-01, 7.544028845946703E-01, 3.772014422973352E-01, 3.191673480504076E-01, 1.896384211389329E-01 }, /* 14075 Hz */
-    { 3.782791125201321E-01, 7.565582250402643E-01, 3.782791125201321E-01, 3.230359785640677E-01, 1.900804715164609E-01 }, /* 14100 Hz */
-    { 3.793583645553471E-01, 7.587167291106942E-01, 3.793583645553471E-01, 3.269054426940902E-01, 1.905280155272982E-01 }, /* 14125 Hz */
-    { 3.804392026693209E-01, 7.608784053386418E-01, 3.804392026693209E-01, 3.307757502768045E-01, 1.909810604004791E-01 }, /* 14150 Hz */
-    { 3.815216311503782E-01, 7.630432623007564E-01, 3.815216311503782E-01, 3.346469111449695E-01, 1.914396134565434E-01 }, /* 14175 Hz */
-    { 3.826056543088648E-01, 7.652113086177297E-01, 3.826056543088648E-01, 3.385189351277076E-01, 1.919036821077518E-01 }, /* 14200 Hz */
-    { 3.836912764771830E-01, 7.673825529543660E-01, 3.836912764771830E-01, 3.423918320504300E-01, 1.923732738583020E-01 }, /* 14225 Hz */
-    { 3.847785020098292E-01, 7.695570040196584E-01, 3.847785020098292E-01, 3.462656117347686E-01, 1.928483963045484E-01 }, /* 14250 Hz */
-    { 3.858673352834318E-01, 7.717346705668635E-01, 3.858673352834318E-01, 3.501402839985023E-01, 1.933290571352246E-01 }, /* 14275 Hz */
-    { 3.869577806967874E-01, 7.739155613935748E-01, 3.869577806967874E-01, 3.540158586554818E-01, 1.938152641316678E-01 }, /* 14300 Hz */
-    { 3.880498426709014E-01, 7.760996853418027E-01, 3.880498426709014E-01, 3.578923455155582E-01, 1.943070251680474E-01 }, /* 14325 Hz */
-    { 3.891435256490244E-01, 7.782870512980489E-01, 3.891435256490244E-01, 3.617697543845031E-01, 1.948043482115947E-01 }, /* 14350 Hz */
-    { 3.902388340966932E-01, 7.804776681933865E-01, 3.902388340966932E-01, 3.656480950639359E-01, 1.953072413228370E-01 }, /* 14375 Hz */
-    { 3.913357725017686E-01, 7.826715450035372E-01, 3.913357725017686E-01, 3.695273773512414E-01, 1.958157126558330E-01 }, /* 14400 Hz */
-    { 3.924343453744767E-01, 7.848686907489535E-01, 3.924343453744767E-01, 3.734076110394943E-01, 1.963297704584126E-01 }, /* 14425 Hz */
-    { 3.935345572474486E-01, 7.870691144948971E-01, 3.935345572474486E-01, 3.772888059173770E-01, 1.968494230724173E-01 }, /* 14450 Hz */
-    { 3.946364126757611E-01, 7.892728253515222E-01, 3.946364126757611E-01, 3.811709717690983E-01, 1.973746789339463E-01 }, /* 14475 Hz */
-    { 3.957399162369781E-01, 7.914798324739561E-01, 3.957399162369781E-01, 3.850541183743100E-01, 1.979055465736023E-01 }, /* 14500 Hz */
-    { 3.968450725311921E-01, 7.936901450623841E-01, 3.968450725311921E-01, 3.889382555080251E-01, 1.984420346167432E-01 }, /* 14525 Hz */
-    { 3.979518861810657E-01, 7.959037723621314E-01, 3.979518861810657E-01, 3.928233929405292E-01, 1.989841517837337E-01 }, /* 14550 Hz */
-    { 3.990603618318751E-01, 7.981207236637502E-01, 3.990603618318751E-01, 3.967095404372983E-01, 1.995319068902022E-01 }, /* 14575 Hz */
-    { 4.001705041515514E-01, 8.003410083031027E-01, 4.001705041515514E-01, 4.005967077589065E-01, 2.000853088472990E-01 }, /* 14600 Hz */
-    { 4.012823178307251E-01, 8.025646356614502E-01, 4.012823178307251E-01, 4.044849046609419E-01, 2.006443666619583E-01 }, /* 14625 Hz */
-    { 4.023958075827685E-01, 8.047916151655370E-01, 4.023958075827685E-01, 4.083741408939118E-01, 2.012090894371621E-01 }, /* 14650 Hz */
-    { 4.035109781438405E-01, 8.070219562876810E-01, 4.035109781438405E-01, 4.122644262031541E-01, 2.017794863722081E-01 }, /* 14675 Hz */
-    { 4.046278342729308E-01, 8.092556685458616E-01, 4.046278342729308E-01, 4.161557703287437E-01, 2.023555667629795E-01 }, /* 14700 Hz */
-    { 4.057463807519039E-01, 8.114927615038079E-01, 4.057463807519039E-01, 4.200481830053971E-01, 2.029373400022187E-01 }, /* 14725 Hz */
-    { 4.068666223855457E-01, 8.137332447710913E-01, 4.068666223855457E-01, 4.239416739623795E-01, 2.035248155798031E-01 }, /* 14750 Hz */
-    { 4.079885640016067E-01, 8.159771280032134E-01, 4.079885640016067E-01, 4.278362529234035E-01, 2.041180030830234E-01 }, /* 14775 Hz */
-    { 4.091122104508510E-01, 8.182244209017020E-01, 4.091122104508510E-01, 4.317319296065368E-01, 2.047169121968672E-01 }, /* 14800 Hz */
-    { 4.102375666070995E-01, 8.204751332141991E-01, 4.102375666070995E-01, 4.356287137240955E-01, 2.053215527043026E-01 }, /* 14825 Hz */
-    { 4.113646373672787E-01, 8.227292747345575E-01, 4.113646373672787E-01, 4.395266149825489E-01, 2.059319344865662E-01 }, /* 14850 Hz */
-    { 4.124934276514664E-01, 8.249868553029328E-01, 4.124934276514664E-01, 4.434256430824116E-01, 2.065480675234539E-01 }, /* 14875 Hz */
-    { 4.136239424029401E-01, 8.272478848058802E-01, 4.136239424029401E-01, 4.473258077181449E-01, 2.071699618936155E-01 }, /* 14900 Hz */
-    { 4.147561865882238E-01, 8.295123731764477E-01, 4.147561865882238E-01, 4.512271185780453E-01, 2.077976277748501E-01 }, /* 14925 Hz */
-    { 4.158901651971373E-01, 8.317803303942747E-01, 4.158901651971373E-01, 4.551295853441422E-01, 2.084310754444072E-01 }, /* 14950 Hz */
-    { 4.170258832428437E-01, 8.340517664856875E-01, 4.170258832428437E-01, 4.590332176920862E-01, 2.090703152792886E-01 }, /* 14975 Hz */
-    { 4.181633457618990E-01, 8.363266915237979E-01, 4.181633457618990E-01, 4.629380252910409E-01, 2.097153577565549E-01 }  /* 15000 Hz */
-};
-
-const double butterhighcoeff[600][5] = {
-    { 9.976886737037820E-01, -1.995377347407564E+00, 9.976886737037820E-01, -1.995372005171181E+00, 9.953826896439464E-01 }, /* 25 Hz */
-    { 9.953826895870649E-01, -1.990765379174130E+00, 9.953826895870649E-01, -1.990744059505048E+00, 9.907866988432112E-01 }, /* 50 Hz */
-    { 9.930820351754102E-01, -1.986164070350820E+00, 9.930820351754102E-01, -1.986116211540890E+00, 9.862119291607511E-01 }, /* 75 Hz */
-    { 9.907866979404268E-01, -1.981573395880854E+00, 9.907866979404268E-01, -1.981488509144573E+00, 9.816582826171342E-01 }, /* 100 Hz */
-    { 9.884966653014320E-01, -1.976993330602864E+00, 9.884966653014320E-01, -1.976860999515798E+00, 9.771256616899304E-01 }, /* 125 Hz */
-    { 9.862119246270823E-01, -1.972423849254165E+00, 9.862119246270823E-01, -1.972233729195266E+00, 9.726139693130630E-01 }, /* 150 Hz */
-    { 9.839324632369810E-01, -1.967864926473962E+00, 9.839324632369810E-01, -1.967606744071793E+00, 9.681231088761313E-01 }, /* 175 Hz */
-    { 9.816582684032612E-01, -1.963316536806522E+00, 9.816582684032612E-01, -1.962980089389339E+00, 9.636529842237053E-01 }, /* 200 Hz */
-    { 9.793893273521401E-01, -1.958778654704280E+00, 9.793893273521401E-01, -1.958353809753975E+00, 9.592034996545854E-01 }, /* 225 Hz */
-    { 9.771256272654538E-01, -1.954251254530908E+00, 9.771256272654538E-01, -1.953727949140776E+00, 9.547745599210395E-01 }, /* 250 Hz */
-    { 9.748671552821646E-01, -1.949734310564329E+00, 9.748671552821646E-01, -1.949102550900650E+00, 9.503660702280083E-01 }, /* 275 Hz */
-    { 9.726138984998438E-01, -1.945227796999688E+00, 9.726138984998438E-01, -1.944477657767094E+00, 9.459779362322815E-01 }, /* 300 Hz */
-    { 9.703658439761339E-01, -1.940731687952268E+00, 9.703658439761339E-01, -1.939853311862882E+00, 9.416100640416533E-01 }, /* 325 Hz */
-    { 9.681229787301855E-01, -1.936245957460371E+00, 9.681229787301855E-01, -1.935229554706695E+00, 9.372623602140466E-01 }, /* 350 Hz */
-    { 9.658852897440701E-01, -1.931770579488140E+00, 9.658852897440701E-01, -1.930606427219668E+00, 9.329347317566122E-01 }, /* 375 Hz */
-    { 9.636527639641733E-01, -1.927305527928347E+00, 9.636527639641733E-01, -1.925983969731886E+00, 9.286270861248075E-01 }, /* 400 Hz */
-    { 9.614253883025633E-01, -1.922850776605127E+00, 9.614253883025633E-01, -1.921362221988807E+00, 9.243393312214461E-01 }, /* 425 Hz */
-    { 9.592031496383375E-01, -1.918406299276675E+00, 9.592031496383375E-01, -1.916741223157623E+00, 9.200713753957276E-01 }, /* 450 Hz */
-    { 9.569860348189488E-01, -1.913972069637898E+00, 9.569860348189488E-01, -1.912121011833552E+00, 9.158231274422431E-01 }, /* 475 Hz */
-    { 9.547740306615090E-01, -1.909548061323018E+00, 9.547740306615090E-01, -1.907501626046076E+00, 9.115944965999598E-01 }, /* 500 Hz */
-    { 9.525671239540717E-01, -1.905134247908143E+00, 9.525671239540717E-01, -1.902883103265104E+00, 9.073853925511828E-01 }, /* 525 Hz */
-    { 9.503653014568938E-01, -1.900730602913788E+00, 9.503653014568938E-01, -1.898265480407079E+00, 9.031957254204959E-01 }, /* 550 Hz */
-    { 9.481685499036774E-01, -1.896337099807355E+00, 9.481685499036774E-01, -1.893648793841025E+00, 8.990254057736846E-01 }, /* 575 Hz */
-    { 9.459768560027901E-01, -1.891953712005580E+00, 9.459768560027901E-01, -1.889033079394525E+00, 8.948743446166356E-01 }, /* 600 Hz */
-    { 9.437902064384663E-01, -1.887580412876933E+00, 9.437902064384663E-01, -1.884418372359644E+00, 8.907424533942211E-01 }, /* 625 Hz */
-    { 9.416085878719889E-01, -1.883217175743978E+00, 9.416085878719889E-01, -1.879804707498793E+00, 8.866296439891621E-01 }, /* 650 Hz */
-    { 9.394319869428492E-01, -1.878863973885698E+00, 9.394319869428492E-01, -1.875192119050525E+00, 8.825358287208723E-01 }, /* 675 Hz */
-    { 9.372603902698926E-01, -1.874520780539785E+00, 9.372603902698926E-01, -1.870580640735279E+00, 8.784609203442912E-01 }, /* 700 Hz */
-    { 9.350937844524387E-01, -1.870187568904877E+00, 9.350937844524387E-01, -1.865970305761065E+00, 8.744048320486899E-01 }, /* 725 Hz */
-    { 9.329321560713880E-01, -1.865864312142776E+00, 9.329321560713880E-01, -1.861361146829083E+00, 8.703674774564693E-01 }, /* 750 Hz */
-    { 9.307754916903088E-01, -1.861550983380618E+00, 9.307754916903088E-01, -1.856753196139296E+00, 8.663487706219395E-01 }, /* 775 Hz */
-    { 9.286237778565044E-01, -1.857247555713009E+00, 9.286237778565044E-01, -1.852146485395936E+00, 8.623486260300813E-01 }, /* 800 Hz */
-    { 9.264770011020635E-01, -1.852954002204127E+00, 9.264770011020635E-01, -1.847541045812958E+00, 8.583669585952963E-01 }, /* 825 Hz */
-    { 9.243351479448940E-01, -1.848670295889788E+00, 9.243351479448940E-01, -1.842936908119436E+00, 8.544036836601403E-01 }, /* 850 Hz */
-    { 9.221982048897377E-01, -1.844396409779475E+00, 9.221982048897377E-01, -1.838334102564905E+00, 8.504587169940455E-01 }, /* 875 Hz */
-    { 9.200661584291681E-01, -1.840132316858336E+00, 9.200661584291681E-01, -1.833732658924648E+00, 8.465319747920239E-01 }, /* 900 Hz */
-    { 9.179389950445718E-01, -1.835877990089144E+00, 9.179389950445718E-01, -1.829132606504924E+00, 8.426233736733628E-01 }, /* 925 Hz */
-    { 9.158167012071134E-01, -1.831633402414227E+00, 9.158167012071134E-01, -1.824533974148148E+00, 8.387328306803056E-01 }, /* 950 Hz */
-    { 9.136992633786840E-01, -1.827398526757368E+00, 9.136992633786840E-01, -1.819936790238015E+00, 8.348602632767208E-01 }, /* 975 Hz */
-    { 9.115866680128315E-01, -1.823173336025663E+00, 9.115866680128315E-01, -1.815341082704568E+00, 8.310055893467577E-01 }, /* 1000 Hz */
-    { 9.094789015556775E-01, -1.818957803111355E+00, 9.094789015556775E-01, -1.810746879029217E+00, 8.271687271934922E-01 }, /* 1025 Hz */
-    { 9.073759504468176E-01, -1.814751900893635E+00, 9.073759504468176E-01, -1.806154206249707E+00, 8.233495955375633E-01 }, /* 1050 Hz */
-    { 9.052778011202055E-01, -1.810555602240411E+00, 9.052778011202055E-01, -1.801563090965028E+00, 8.195481135157937E-01 }, /* 1075 Hz */
-    { 9.031844400050225E-01, -1.806368880010045E+00, 9.031844400050225E-01, -1.796973559340282E+00, 8.157642006798080E-01 }, /* 1100 Hz */
-    { 9.010958535265308E-01, -1.802191707053062E+00, 9.010958535265308E-01, -1.792385637111491E+00, 8.119977769946318E-01 }, /* 1125 Hz */
-    { 8.990120281069138E-01, -1.798024056213828E+00, 8.990120281069138E-01, -1.787799349590365E+00, 8.082487628372905E-01 }, /* 1150 Hz */
-    { 8.969329501660999E-01, -1.793865900332200E+00, 8.969329501660999E-01, -1.783214721669007E+00, 8.045170789953923E-01 }, /* 1175 Hz */
-    { 8.948586061225732E-01, -1.789717212245146E+00, 8.948586061225732E-01, -1.778631777824585E+00, 8.008026466657078E-01 }, /* 1200 Hz */
-    { 8.927889823941683E-01, -1.785577964788337E+00, 8.927889823941683E-01, -1.774050542123938E+00, 7.971053874527354E-01 }, /* 1225 Hz */
-    { 8.907240653988528E-01, -1.781448130797706E+00, 8.907240653988528E-01, -1.769471038228147E+00, 7.934252233672648E-01 }, /* 1250 Hz */
-    { 8.886638415554955E-01, -1.777327683110991E+00, 8.886638415554955E-01, -1.764893289397053E+00, 7.897620768249290E-01 }, /* 1275 Hz */
-    { 8.866082972846190E-01, -1.773216594569238E+00, 8.866082972846190E-01, -1.760317318493727E+00, 7.861158706447495E-01 }, /* 1300 Hz */
-    { 8.845574190091421E-01, -1.769114838018284E+00, 8.845574190091421E-01, -1.755743147988893E+00, 7.824865280476756E-01 }, /* 1325 Hz */
-    { 8.825111931551066E-01, -1.765022386310213E+00, 8.825111931551066E-01, -1.751170799965309E+00, 7.788739726551175E-01 }, /* 1350 Hz */
-    { 8.804696061523918E-01, -1.760939212304784E+00, 8.804696061523918E-01, -1.746600296122096E+00, 7.752781284874714E-01 }, /* 1375 Hz */
-    { 8.784326444354154E-01, -1.756865288870831E+00, 8.784326444354154E-01, -1.742031657779023E+00, 7.716989199626388E-01 }, /* 1400 Hz */
-    { 8.764002944438228E-01, -1.752800588887646E+00, 8.764002944438228E-01, -1.737464905880750E+00, 7.681362718945414E-01 }, /* 1425 Hz */
-    { 8.743725426231639E-01, -1.748745085246328E+00, 8.743725426231639E-01, -1.732900061001025E+00, 7.645901094916301E-01 }, /* 1450 Hz */
-    { 8.723493754255555E-01, -1.744698750851111E+00, 8.723493754255555E-01, -1.728337143346834E+00, 7.610603583553878E-01 }, /* 1475 Hz */
-    { 8.703307793103345E-01, -1.740661558620669E+00, 8.703307793103345E-01, -1.723776172762509E+00, 7.575469444788290E-01 }, /* 1500 Hz */
-    { 8.683167407446968E-01, -1.736633481489394E+00, 8.683167407446968E-01, -1.719217168733794E+00, 7.540497942449933E-01 }, /* 1525 Hz */
-    { 8.663072462043258E-01, -1.732614492408652E+00, 8.663072462043258E-01, -1.714660150391867E+00, 7.505688344254362E-01 }, /* 1550 Hz */
-    { 8.643022821740075E-01, -1.728604564348015E+00, 8.643022821740075E-01, -1.710105136517317E+00, 7.471039921787135E-01 }, /* 1575 Hz */
-    { 8.623018351482374E-01, -1.724603670296475E+00, 8.623018351482374E-01, -1.705552145544084E+00, 7.436551950488657E-01 }, /* 1600 Hz */
-    { 8.603058916318123E-01, -1.720611783263625E+00, 8.603058916318123E-01, -1.701001195563354E+00, 7.402223709638950E-01 }, /* 1625 Hz */
-    { 8.583144381404125E-01, -1.716628876280825E+00, 8.583144381404125E-01, -1.696452304327410E+00, 7.368054482342399E-01 }, /* 1650 Hz */
-    { 8.563274612011750E-01, -1.712654922402350E+00, 8.563274612011750E-01, -1.691905489253450E+00, 7.334043555512501E-01 }, /* 1675 Hz */
-    { 8.543449473532526E-01, -1.708689894706505E+00, 8.543449473532526E-01, -1.687360767427356E+00, 7.300190219856545E-01 }, /* 1700 Hz */
-    { 8.523668831483640E-01, -1.704733766296728E+00, 8.523668831483640E-01, -1.682818155607428E+00, 7.266493769860281E-01 }, /* 1725 Hz */
-    { 8.503932551513336E-01, -1.700786510302667E+00, 8.503932551513336E-01, -1.678277670228077E+00, 7.232953503772570E-01 }, /* 1750 Hz */
-    { 8.484240499406206E-01, -1.696848099881241E+00, 8.484240499406206E-01, -1.673739327403481E+00, 7.199568723590020E-01 }, /* 1775 Hz */
-    { 8.464592541088377E-01, -1.692918508217675E+00, 8.464592541088377E-01, -1.669203142931193E+00, 7.166338735041577E-01 }, /* 1800 Hz */
-    { 8.444988542632599E-01, -1.688997708526520E+00, 8.444988542632599E-01, -1.664669132295726E+00, 7.133262847573130E-01 }, /* 1825 Hz */
-    { 8.425428370263233E-01, -1.685085674052647E+00, 8.425428370263233E-01, -1.660137310672085E+00, 7.100340374332076E-01 }, /* 1850 Hz */
-    { 8.405911890361155E-01, -1.681182378072231E+00, 8.405911890361155E-01, -1.655607692929271E+00, 7.067570632151908E-01 }, /* 1875 Hz */
-    { 8.386438969468535E-01, -1.677287793893707E+00, 8.386438969468535E-01, -1.651080293633740E+00, 7.034952941536736E-01 }, /* 1900 Hz */
-    { 8.367009474293551E-01, -1.673401894858710E+00, 8.367009474293551E-01, -1.646555127052834E+00, 7.002486626645861E-01 }, /* 1925 Hz */
-    { 8.347623271714990E-01, -1.669524654342998E+00, 8.347623271714990E-01, -1.642032207158167E+00, 6.970171015278294E-01 }, /* 1950 Hz */
-    { 8.328280228786773E-01, -1.665656045757355E+00, 8.328280228786773E-01, -1.637511547628978E+00, 6.938005438857311E-01 }, /* 1975 Hz */
-    { 8.308980212742372E-01, -1.661796042548474E+00, 8.308980212742372E-01, -1.632993161855452E+00, 6.905989232414969E-01 }, /* 2000 Hz */
-    { 8.289723090999154E-01, -1.657944618199831E+00, 8.289723090999154E-01, -1.628477062941998E+00, 6.874121734576640E-01 }, /* 2025 Hz */
-    { 8.270508731162627E-01, -1.654101746232525E+00, 8.270508731162627E-01, -1.623963263710496E+00, 6.842402287545551E-01 }, /* 2050 Hz */
-    { 8.251337001030605E-01, -1.650267400206121E+00, 8.251337001030605E-01, -1.619451776703511E+00, 6.810830237087312E-01 }, /* 2075 Hz */
-    { 8.232207768597282E-01, -1.646441553719456E+00, 8.232207768597282E-01, -1.614942614187468E+00, 6.779404932514442E-01 }, /* 2100 Hz */
-    { 8.213120902057234E-01, -1.642624180411447E+00, 8.213120902057234E-01, -1.610435788155798E+00, 6.748125726670950E-01 }, /* 2125 Hz */
-    { 8.194076269809323E-01, -1.638815253961865E+00, 8.194076269809323E-01, -1.605931310332044E+00, 6.716991975916849E-01 }, /* 2150 Hz */
-    { 8.175073740460530E-01, -1.635014748092106E+00, 8.175073740460530E-01, -1.601429192172939E+00, 6.686003040112730E-01 }, /* 2175 Hz */
-    { 8.156113182829704E-01, -1.631222636565941E+00, 8.156113182829704E-01, -1.596929444871448E+00, 6.655158282604337E-01 }, /* 2200 Hz */
-    { 8.137194465951239E-01, -1.627438893190248E+00, 8.137194465951239E-01, -1.592432079359781E+00, 6.624457070207149E-01 }, /* 2225 Hz */
-    { 8.118317459078659E-01, -1.623663491815732E+00, 8.118317459078659E-01, -1.587937106312366E+00, 6.593898773190976E-01 }, /* 2250 Hz */
-    { 8.099482031688141E-01, -1.619896406337628E+00, 8.099482031688141E-01, -1.583444536148800E+00, 6.563482765264562E-01 }, /* 2275 Hz */
-    { 8.080688053481953E-01, -1.616137610696391E+00, 8.080688053481953E-01, -1.578954379036758E+00, 6.533208423560228E-01 }, /* 2300 Hz */
-    { 8.061935394391826E-01, -1.612387078878365E+00, 8.061935394391826E-01, -1.574466644894879E+00, 6.503075128618507E-01 }, /* 2325 Hz */
-    { 8.043223924582245E-01, -1.608644784916449E+00, 8.043223924582245E-01, -1.569981343395617E+00, 6.473082264372807E-01 }, /* 2350 Hz */
-    { 8.024553514453672E-01, -1.604910702890734E+00, 8.024553514453672E-01, -1.565498483968059E+00, 6.443229218134101E-01 }, /* 2375 Hz */
-    { 8.005924034645704E-01, -1.601184806929141E+00, 8.005924034645704E-01, -1.561018075800718E+00, 6.413515380575633E-01 }, /* 2400 Hz */
-    { 7.987335356040139E-01, -1.597467071208028E+00, 7.987335356040139E-01, -1.556540127844293E+00, 6.383940145717633E-01 }, /* 2425 Hz */
-    { 7.968787349764009E-01, -1.593757469952802E+00, 7.968787349764009E-01, -1.552064648814395E+00, 6.354502910912089E-01 }, /* 2450 Hz */
-    { 7.950279887192513E-01, -1.590055977438503E+00, 7.950279887192513E-01, -1.547591647194254E+00, 6.325203076827510E-01 }, /* 2475 Hz */
-    { 7.931812839951901E-01, -1.586362567990380E+00, 7.931812839951901E-01, -1.543121131237386E+00, 6.296040047433742E-01 }, /* 2500 Hz */
-    { 7.913386079922287E-01, -1.582677215984457E+00, 7.913386079922287E-01, -1.538653108970236E+00, 6.267013229986780E-01 }, /* 2525 Hz */
-    { 7.894999479240394E-01, -1.578999895848079E+00, 7.894999479240394E-01, -1.534187588194794E+00, 6.238122035013642E-01 }, /* 2550 Hz */
-    { 7.876652910302248E-01, -1.575330582060450E+00, 7.876652910302248E-01, -1.529724576491174E+00, 6.209365876297249E-01 }, /* 2575 Hz */
-    { 7.858346245765794E-01, -1.571669249153159E+00, 7.858346245765794E-01, -1.525264081220182E+00, 6.180744170861354E-01 }, /* 2600 Hz */
-    { 7.840079358553458E-01, -1.568015871710692E+00, 7.840079358553458E-01, -1.520806109525835E+00, 6.152256338955475E-01 }, /* 2625 Hz */
-    { 7.821852121854658E-01, -1.564370424370932E+00, 7.821852121854658E-01, -1.516350668337872E+00, 6.123901804039907E-01 }, /* 2650 Hz */
-    { 7.803664409128221E-01, -1.560732881825644E+00, 7.803664409128221E-01, -1.511897764374220E+00, 6.095679992770686E-01 }, /* 2675 Hz */
-    { 7.785516094104799E-01, -1.557103218820960E+00, 7.785516094104799E-01, -1.507447404143449E+00, 6.067590334984702E-01 }, /* 2700 Hz */
-    { 7.767407050789162E-01, -1.553481410157832E+00, 7.767407050789162E-01, -1.502999593947192E+00, 6.039632263684732E-01 }, /* 2725 Hz */
-    { 7.749337153462491E-01, -1.549867430692498E+00, 7.749337153462491E-01, -1.498554339882537E+00, 6.011805215024594E-01 }, /* 2750 Hz */
-    { 7.731306276684572E-01, -1.546261255336914E+00, 7.731306276684572E-01, -1.494111647844400E+00, 5.984108628294285E-01 }, /* 2775 Hz */
-    { 7.713314295295959E-01, -1.542662859059192E+00, 7.713314295295959E-01, -1.489671523527865E+00, 5.956541945905183E-01 }, /* 2800 Hz */
-    { 7.695361084420078E-01, -1.539072216884016E+00, 7.695361084420078E-01, -1.485233972430503E+00, 5.929104613375288E-01 }, /* 2825 Hz */
-    { 7.677446519465280E-01, -1.535489303893056E+00, 7.677446519465280E-01, -1.480798999854664E+00, 5.901796079314484E-01 }, /* 2850 Hz */
-    { 7.659570476126825E-01, -1.531914095225365E+00, 7.659570476126825E-01, -1.476366610909744E+00, 5.874615795409858E-01 }, /* 2875 Hz */
-    { 7.641732830388834E-01, -1.528346566077767E+00, 7.641732830388834E-01, -1.471936810514429E+00, 5.847563216411042E-01 }, /* 2900 Hz */
-    { 7.623933458526192E-01, -1.524786691705238E+00, 7.623933458526192E-01, -1.467509603398913E+00, 5.820637800115641E-01 }, /* 2925 Hz */
-    { 7.606172237106378E-01, -1.521234447421276E+00, 7.606172237106378E-01, -1.463084994107088E+00, 5.793839007354632E-01 }, /* 2950 Hz */
-    { 7.588449042991259E-01, -1.517689808598252E+00, 7.588449042991259E-01, -1.458662986998718E+00, 5.767166301977853E-01 }, /* 2975 Hz */
-    { 7.570763753338847E-01, -1.514152750667769E+00, 7.570763753338847E-01, -1.454243586251585E+00, 5.740619150839545E-01 }, /* 3000 Hz */
-    { 7.553116245604998E-01, -1.510623249121000E+00, 7.553116245604998E-01, -1.449826795863608E+00, 5.714197023783910E-01 }, /* 3025 Hz */
-    { 7.535506397545046E-01, -1.507101279509009E+00, 7.535506397545046E-01, -1.445412619654948E+00, 5.687899393630709E-01 }, /* 3050 Hz */
-    { 7.517934087215428E-01, -1.503586817443086E+00, 7.517934087215428E-01, -1.441001061270078E+00, 5.661725736160934E-01 }, /* 3075 Hz */
-    { 7.500399192975231E-01, -1.500079838595046E+00, 7.500399192975231E-01, -1.436592124179841E+00, 5.635675530102516E-01 }, /* 3100 Hz */
-    { 7.482901593487716E-01, -1.496580318697543E+00, 7.482901593487716E-01, -1.432185811683481E+00, 5.609748257116062E-01 }, /* 3125 Hz */
-    { 7.465441167721786E-01, -1.493088233544357E+00, 7.465441167721786E-01, -1.427782126910649E+00, 5.583943401780656E-01 }, /* 3150 Hz */
-    { 7.448017794953408E-01, -1.489603558990682E+00, 7.448017794953408E-01, -1.423381072823393E+00, 5.558260451579704E-01 }, /* 3175 Hz */
-    { 7.430631354767008E-01, -1.486126270953402E+00, 7.430631354767008E-01, -1.418982652218120E+00, 5.532698896886831E-01 }, /* 3200 Hz */
-    { 7.413281727056807E-01, -1.482656345411361E+00, 7.413281727056807E-01, -1.414586867727542E+00, 5.507258230951806E-01 }, /* 3225 Hz */
-    { 7.395968792028134E-01, -1.479193758405627E+00, 7.395968792028134E-01, -1.410193721822598E+00, 5.481937949886557E-01 }, /* 3250 Hz */
-    { 7.378692430198670E-01, -1.475738486039734E+00, 7.378692430198670E-01, -1.405803216814350E+00, 5.456737552651184E-01 }, /* 3275 Hz */
-    { 7.361452522399687E-01, -1.472290504479937E+00, 7.361452522399687E-01, -1.401415354855869E+00, 5.431656541040056E-01 }, /* 3300 Hz */
-    { 7.344248949777227E-01, -1.468849789955445E+00, 7.344248949777227E-01, -1.397030137944094E+00, 5.406694419667969E-01 }, /* 3325 Hz */
-    { 7.327081593793240E-01, -1.465416318758648E+00, 7.327081593793240E-01, -1.392647567921665E+00, 5.381850695956306E-01 }, /* 3350 Hz */
-    { 7.309950336226694E-01, -1.461990067245339E+00, 7.309950336226694E-01, -1.388267646478748E+00, 5.357124880119292E-01 }, /* 3375 Hz */
-    { 7.292855059174644E-01, -1.458571011834929E+00, 7.292855059174644E-01, -1.383890375154829E+00, 5.332516485150284E-01 }, /* 3400 Hz */
-    { 7.275795645053273E-01, -1.455159129010655E+00, 7.275795645053273E-01, -1.379515755340497E+00, 5.308025026808126E-01 }, /* 3425 Hz */
-    { 7.258771976598872E-01, -1.451754395319774E+00, 7.258771976598872E-01, -1.375143788279197E+00, 5.283650023603526E-01 }, /* 3450 Hz */
-    { 7.241783936868820E-01, -1.448356787373764E+00, 7.241783936868820E-01, -1.370774475068976E+00, 5.259390996785520E-01 }, /* 3475 Hz */
-    { 7.224831409242489E-01, -1.444966281848498E+00, 7.224831409242489E-01, -1.366407816664200E+00, 5.235247470327964E-01 }, /* 3500 Hz */
-    { 7.207914277422161E-01, -1.441582855484432E+00, 7.207914277422161E-01, -1.362043813877255E+00, 5.211218970916093E-01 }, /* 3525 Hz */
-    { 7.191032425433861E-01, -1.438206485086772E+00, 7.191032425433861E-01, -1.357682467380232E+00, 5.187305027933129E-01 }, /* 3550 Hz */
-    { 7.174185737628205E-01, -1.434837147525641E+00, 7.174185737628205E-01, -1.353323777706588E+00, 5.163505173446939E-01 }, /* 3575 Hz */
-    { 7.157374098681176E-01, -1.431474819736235E+00, 7.157374098681176E-01, -1.348967745252795E+00, 5.139818942196758E-01 }, /* 3600 Hz */
-    { 7.140597393594897E-01, -1.428119478718979E+00, 7.140597393594897E-01, -1.344614370279964E+00, 5.116245871579953E-01 }, /* 3625 Hz */
-    { 7.123855507698350E-01, -1.424771101539670E+00, 7.123855507698350E-01, -1.340263652915455E+00, 5.092785501638847E-01 }, /* 3650 Hz */
-    { 7.107148326648087E-01, -1.421429665329617E+00, 7.107148326648087E-01, -1.335915593154474E+00, 5.069437375047610E-01 }, /* 3675 Hz */
-    { 7.090475736428885E-01, -1.418095147285777E+00, 7.090475736428885E-01, -1.331570190861637E+00, 5.046201037099174E-01 }, /* 3700 Hz */
-    { 7.073837623354391E-01, -1.414767524670878E+00, 7.073837623354391E-01, -1.327227445772533E+00, 5.023076035692231E-01 }, /* 3725 Hz */
-    { 7.057233874067733E-01, -1.411446774813547E+00, 7.057233874067733E-01, -1.322887357495264E+00, 5.000061921318292E-01 }, /* 3750 Hz */
-    { 7.040664375542099E-01, -1.408132875108420E+00, 7.040664375542099E-01, -1.318549925511963E+00, 4.977158247048765E-01 }, /* 3775 Hz */
-    { 7.024129015081285E-01, -1.404825803016257E+00, 7.024129015081285E-01, -1.314215149180301E+00, 4.954364568522127E-01 }, /* 3800 Hz */
-    { 7.007627680320222E-01, -1.401525536064044E+00, 7.007627680320222E-01, -1.309883027734976E+00, 4.931680443931125E-01 }, /* 3825 Hz */
-    { 6.991160259225478E-01, -1.398232051845096E+00, 6.991160259225478E-01, -1.305553560289185E+00, 4.909105434010065E-01 }, /* 3850 Hz */
-    { 6.974726640095714E-01, -1.394945328019143E+00, 6.974726640095714E-01, -1.301226745836076E+00, 4.886639102022097E-01 }, /* 3875 Hz */
-    { 6.958326711562145E-01, -1.391665342312429E+00, 6.958326711562145E-01, -1.296902583250194E+00, 4.864281013746644E-01 }, /* 3900 Hz */
-    { 6.941960362588944E-01, -1.388392072517789E+00, 6.941960362588944E-01, -1.292581071288897E+00, 4.842030737466810E-01 }, /* 3925 Hz */
-    { 6.925627482473642E-01, -1.385125496494728E+00, 6.925627482473642E-01, -1.288262208593769E+00, 4.819887843956881E-01 }, /* 3950 Hz */
-    { 6.909327960847494E-01, -1.381865592169499E+00, 6.909327960847494E-01, -1.283945993692010E+00, 4.797851906469881E-01 }, /* 3975 Hz */
-    { 6.893061687675817E-01, -1.378612337535163E+00, 6.893061687675817E-01, -1.279632424997809E+00, 4.775922500725173E-01 }, /* 4000 Hz */
-    { 6.876828553258307E-01, -1.375365710651661E+00, 6.876828553258307E-01, -1.275321500813711E+00, 4.754099204896126E-01 }, /* 4025 Hz */
-    { 6.860628448229353E-01, -1.372125689645871E+00, 6.860628448229353E-01, -1.271013219331957E+00, 4.732381599597846E-01 }, /* 4050 Hz */
-    { 6.844461263558279E-01, -1.368892252711656E+00, 6.844461263558279E-01, -1.266707578635817E+00, 4.710769267874942E-01 }, /* 4075 Hz */
-    { 6.828326890549621E-01, -1.365665378109924E+00, 6.828326890549621E-01, -1.262404576700910E+00, 4.689261795189384E-01 }, /* 4100 Hz */
-    { 6.812225220843326E-01, -1.362445044168665E+00, 6.812225220843326E-01, -1.258104211396494E+00, 4.667858769408366E-01 }, /* 4125 Hz */
-    { 6.796156146414987E-01, -1.359231229282997E+00, 6.796156146414987E-01, -1.253806480486765E+00, 4.646559780792291E-01 }, /* 4150 Hz */
-    { 6.780119559575990E-01, -1.356023911915198E+00, 6.780119559575990E-01, -1.249511381632121E+00, 4.625364421982749E-01 }, /* 4175 Hz */
-    { 6.764115352973716E-01, -1.352823070594743E+00, 6.764115352973716E-01, -1.245218912390424E+00, 4.604272287990624E-01 }, /* 4200 Hz */
-    { 6.748143419591645E-01, -1.349628683918329E+00, 6.748143419591645E-01, -1.240929070218241E+00, 4.583282976184172E-01 }, /* 4225 Hz */
-    { 6.732203652749496E-01, -1.346440730549899E+00, 6.732203652749496E-01, -1.236641852472074E+00, 4.562396086277237E-01 }, /* 4250 Hz */
-    { 6.716295946103321E-01, -1.343259189220664E+00, 6.716295946103321E-01, -1.232357256409581E+00, 4.541611220317476E-01 }, /* 4275 Hz */
-    { 6.700420193645596E-01, -1.340084038729119E+00, 6.700420193645596E-01, -1.228075279190772E+00, 4.520927982674668E-01 }, /* 4300 Hz */
-    { 6.684576289705261E-01, -1.336915257941052E+00, 6.684576289705261E-01, -1.223795917879200E+00, 4.500345980029048E-01 }, /* 4325 Hz */
-    { 6.668764128947778E-01, -1.333752825789556E+00, 6.668764128947778E-01, -1.219519169443137E+00, 4.479864821359741E-01 }, /* 4350 Hz */
-    { 6.652983606375158E-01, -1.330596721275032E+00, 6.652983606375158E-01, -1.215245030756740E+00, 4.459484117933230E-01 }, /* 4375 Hz */
-    { 6.637234617325953E-01, -1.327446923465191E+00, 6.637234617325953E-01, -1.210973498601194E+00, 4.439203483291874E-01 }, /* 4400 Hz */
-    { 6.621517057475248E-01, -1.324303411495050E+00, 6.621517057475248E-01, -1.206704569665850E+00, 4.419022533242490E-01 }, /* 4425 Hz */
-    { 6.605830822834637E-01, -1.321166164566927E+00, 6.605830822834637E-01, -1.202438240549353E+00, 4.398940885845021E-01 }, /* 4450 Hz */
-    { 6.590175809752175E-01, -1.318035161950435E+00, 6.590175809752175E-01, -1.198174507760748E+00, 4.378958161401223E-01 }, /* 4475 Hz */
-    { 6.574551914912297E-01, -1.314910382982459E+00, 6.574551914912297E-01, -1.193913367720578E+00, 4.359073982443405E-01 }, /* 4500 Hz */
-    { 6.558959035335763E-01, -1.311791807067153E+00, 6.558959035335763E-01, -1.189654816761977E+00, 4.339287973723279E-01 }, /* 4525 Hz */
-    { 6.543397068379544E-01, -1.308679413675909E+00, 6.543397068379544E-01, -1.185398851131735E+00, 4.319599762200821E-01 }, /* 4550 Hz */
-    { 6.527865911736711E-01, -1.305573182347342E+00, 6.527865911736711E-01, -1.181145466991366E+00, 4.300008977033186E-01 }, /* 4575 Hz */
-    { 6.512365463436312E-01, -1.302473092687262E+00, 6.512365463436312E-01, -1.176894660418152E+00, 4.280515249563723E-01 }, /* 4600 Hz */
-    { 6.496895621843225E-01, -1.299379124368645E+00, 6.496895621843225E-01, -1.172646427406189E+00, 4.261118213311011E-01 }, /* 4625 Hz */
-    { 6.481456285657996E-01, -1.296291257131599E+00, 6.481456285657996E-01, -1.168400763867403E+00, 4.241817503957953E-01 }, /* 4650 Hz */
-    { 6.466047353916674E-01, -1.293209470783335E+00, 6.466047353916674E-01, -1.164157665632574E+00, 4.222612759340957E-01 }, /* 4675 Hz */
-    { 6.450668725990611E-01, -1.290133745198122E+00, 6.450668725990611E-01, -1.159917128452331E+00, 4.203503619439135E-01 }, /* 4700 Hz */
-    { 6.435320301586273E-01, -1.287064060317255E+00, 6.435320301586273E-01, -1.155679147998150E+00, 4.184489726363591E-01 }, /* 4725 Hz */
-    { 6.420001980745014E-01, -1.284000396149003E+00, 6.420001980745014E-01, -1.151443719863330E+00, 4.165570724346752E-01 }, /* 4750 Hz */
-    { 6.404713663842851E-01, -1.280942732768570E+00, 6.404713663842851E-01, -1.147210839563965E+00, 4.146746259731752E-01 }, /* 4775 Hz */
-    { 6.389455251590224E-01, -1.277891050318045E+00, 6.389455251590224E-01, -1.142980502539901E+00, 4.128015980961885E-01 }, /* 4800 Hz */
-    { 6.374226645031734E-01, -1.274845329006347E+00, 6.374226645031734E-01, -1.138752704155683E+00, 4.109379538570110E-01 }, /* 4825 Hz */
-    { 6.359027745545880E-01, -1.271805549109176E+00, 6.359027745545880E-01, -1.134527439701492E+00, 4.090836585168602E-01 }, /* 4850 Hz */
-    { 6.343858454844777E-01, -1.268771690968955E+00, 6.343858454844777E-01, -1.130304704394073E+00, 4.072386775438377E-01 }, /* 4875 Hz */
-    { 6.328718674973862E-01, -1.265743734994772E+00, 6.328718674973862E-01, -1.126084493377648E+00, 4.054029766118968E-01 }, /* 4900 Hz */
-    { 6.313608308311583E-01, -1.262721661662317E+00, 6.313608308311583E-01, -1.121866801724820E+00, 4.035765215998136E-01 }, /* 4925 Hz */
-    { 6.298527257569100E-01, -1.259705451513820E+00, 6.298527257569100E-01, -1.117651624437471E+00, 4.017592785901685E-01 }, /* 4950 Hz */
-    { 6.283475425789942E-01, -1.256695085157988E+00, 6.283475425789942E-01, -1.113438956447647E+00, 3.999512138683293E-01 }, /* 4975 Hz */
-    { 6.268452716349666E-01, -1.253690543269933E+00, 6.268452716349666E-01, -1.109228792618427E+00, 3.981522939214396E-01 }, /* 5000 Hz */
-    { 6.253459032955524E-01, -1.250691806591105E+00, 6.253459032955524E-01, -1.105021127744793E+00, 3.963624854374168E-01 }, /* 5025 Hz */
-    { 6.238494279646082E-01, -1.247698855929216E+00, 6.238494279646082E-01, -1.100815956554482E+00, 3.945817553039510E-01 }, /* 5050 Hz */
-    { 6.223558360790862E-01, -1.244711672158172E+00, 6.223558360790862E-01, -1.096613273708831E+00, 3.928100706075133E-01 }, /* 5075 Hz */
-    { 6.208651181089955E-01, -1.241730236217991E+00, 6.208651181089955E-01, -1.092413073803615E+00, 3.910473986323672E-01 }, /* 5100 Hz */
-    { 6.193772645573636E-01, -1.238754529114727E+00, 6.193772645573636E-01, -1.088215351369867E+00, 3.892937068595870E-01 }, /* 5125 Hz */
-    { 6.178922659601953E-01, -1.235784531920391E+00, 6.178922659601953E-01, -1.084020100874701E+00, 3.875489629660803E-01 }, /* 5150 Hz */
-    { 6.164101128864324E-01, -1.232820225772865E+00, 6.164101128864324E-01, -1.079827316722112E+00, 3.858131348236173E-01 }, /* 5175 Hz */
-    { 6.149307959379114E-01, -1.229861591875823E+00, 6.149307959379114E-01, -1.075636993253780E+00, 3.840861904978657E-01 }, /* 5200 Hz */
-    { 6.134543057493209E-01, -1.226908611498642E+00, 6.134543057493209E-01, -1.071449124749853E+00, 3.823680982474305E-01 }, /* 5225 Hz */
-    { 6.119806329881570E-01, -1.223961265976314E+00, 6.119806329881570E-01, -1.067263705429730E+00, 3.806588265228978E-01 }, /* 5250 Hz */
-    { 6.105097683546792E-01, -1.221019536709358E+00, 6.105097683546792E-01, -1.063080729452829E+00, 3.789583439658879E-01 }, /* 5275 Hz */
-    { 6.090417025818657E-01, -1.218083405163731E+00, 6.090417025818657E-01, -1.058900190919352E+00, 3.772666194081107E-01 }, /* 5300 Hz */
-    { 6.075764264353654E-01, -1.215152852870731E+00, 6.075764264353654E-01, -1.054722083871034E+00, 3.755836218704275E-01 }, /* 5325 Hz */
-    { 6.061139307134518E-01, -1.212227861426904E+00, 6.061139307134518E-01, -1.050546402291889E+00, 3.739093205619178E-01 }, /* 5350 Hz */
-    { 6.046542062469751E-01, -1.209308412493950E+00, 6.046542062469751E-01, -1.046373140108947E+00, 3.722436848789533E-01 }, /* 5375 Hz */
-    { 6.031972438993127E-01, -1.206394487798625E+00, 6.031972438993127E-01, -1.042202291192977E+00, 3.705866844042739E-01 }, /* 5400 Hz */
-    { 6.017430345663205E-01, -1.203486069132641E+00, 6.017430345663205E-01, -1.038033849359209E+00, 3.689382889060729E-01 }, /* 5425 Hz */
-    { 6.002915691762829E-01, -1.200583138352566E+00, 6.002915691762829E-01, -1.033867808368046E+00, 3.672984683370860E-01 }, /* 5450 Hz */
-    { 5.988428386898611E-01, -1.197685677379722E+00, 5.988428386898611E-01, -1.029704161925761E+00, 3.656671928336834E-01 }, /* 5475 Hz */
-    { 5.973968341000415E-01, -1.194793668200083E+00, 5.973968341000415E-01, -1.025542903685195E+00, 3.640444327149710E-01 }, /* 5500 Hz */
-    { 5.959535464320844E-01, -1.191907092864169E+00, 5.959535464320844E-01, -1.021384027246442E+00, 3.624301584818955E-01 }, /* 5525 Hz */
-    { 5.945129667434705E-01, -1.189025933486941E+00, 5.945129667434705E-01, -1.017227526157529E+00, 3.608243408163537E-01 }, /* 5550 Hz */
-    { 5.930750861238474E-01, -1.186150172247695E+00, 5.930750861238474E-01, -1.013073393915081E+00, 3.592269505803082E-01 }, /* 5575 Hz */
-    { 5.916398956949747E-01, -1.183279791389949E+00, 5.916398956949747E-01, -1.008921623964991E+00, 3.576379588149080E-01 }, /* 5600 Hz */
-    { 5.902073866106705E-01, -1.180414773221341E+00, 5.902073866106705E-01, -1.004772209703067E+00, 3.560573367396153E-01 }, /* 5625 Hz */
-    { 5.887775500567551E-01, -1.177555100113510E+00, 5.887775500567551E-01, -1.000625144475685E+00, 3.544850557513355E-01 }, /* 5650 Hz */
-    { 5.873503772509958E-01, -1.174700754501992E+00, 5.873503772509958E-01, -9.964804215804279E-01, 3.529210874235553E-01 }, /* 5675 Hz */
-    { 5.859258594430492E-01, -1.171851718886098E+00, 5.859258594430492E-01, -9.923380342667139E-01, 3.513654035054827E-01 }, /* 5700 Hz */
-    { 5.845039879144052E-01, -1.169007975828810E+00, 5.845039879144052E-01, -9.881979757364255E-01, 3.498179759211951E-01 }, /* 5725 Hz */
-    { 5.830847539783293E-01, -1.166169507956659E+00, 5.830847539783293E-01, -9.840602391445259E-01, 3.482787767687912E-01 }, /* 5750 Hz */
-    { 5.816681489798039E-01, -1.163336297959608E+00, 5.816681489798039E-01, -9.799248175996681E-01, 3.467477783195475E-01 }, /* 5775 Hz */
-    { 5.802541642954704E-01, -1.160508328590941E+00, 5.802541642954704E-01, -9.757917041647999E-01, 3.452249530170817E-01 }, /* 5800 Hz */
-    { 5.788427913335698E-01, -1.157685582667140E+00, 5.788427913335698E-01, -9.716608918577591E-01, 3.437102734765199E-01 }, /* 5825 Hz */
-    { 5.774340215338830E-01, -1.154868043067766E+00, 5.774340215338830E-01, -9.675323736518632E-01, 3.422037124836691E-01 }, /* 5850 Hz */
-    { 5.760278463676715E-01, -1.152055692735343E+00, 5.760278463676715E-01, -9.634061424764916E-01, 3.407052429941945E-01 }, /* 5875 Hz */
-    { 5.746242573376161E-01, -1.149248514675232E+00, 5.746242573376161E-01, -9.592821912176611E-01, 3.392148381328036E-01 }, /* 5900 Hz */
-    { 5.732232459777568E-01, -1.146446491955514E+00, 5.732232459777568E-01, -9.551605127185946E-01, 3.377324711924327E-01 }, /* 5925 Hz */
-    { 5.718248038534310E-01, -1.143649607706862E+00, 5.718248038534310E-01, -9.510410997802837E-01, 3.362581156334407E-01 }, /* 5950 Hz */
-    { 5.704289225612127E-01, -1.140857845122425E+00, 5.704289225612127E-01, -9.469239451620441E-01, 3.347917450828069E-01 }, /* 5975 Hz */
-    { 5.690355937288493E-01, -1.138071187457699E+00, 5.690355937288493E-01, -9.428090415820635E-01, 3.333333333333334E-01 }, /* 6000 Hz */
-    { 5.676448090151998E-01, -1.135289618030400E+00, 5.676448090151998E-01, -9.386963817179452E-01, 3.318828543428536E-01 }, /* 6025 Hz */
-    { 5.662565601101728E-01, -1.132513120220346E+00, 5.662565601101728E-01, -9.345859582072453E-01, 3.304402822334457E-01 }, /* 6050 Hz */
-    { 5.648708387346619E-01, -1.129741677469324E+00, 5.648708387346619E-01, -9.304777636479993E-01, 3.290055912906485E-01 }, /* 6075 Hz */
-    { 5.634876366404840E-01, -1.126975273280968E+00, 5.634876366404840E-01, -9.263717905992489E-01, 3.275787559626868E-01 }, /* 6100 Hz */
-    { 5.621069456103136E-01, -1.124213891220627E+00, 5.621069456103136E-01, -9.222680315815576E-01, 3.261597508596967E-01 }, /* 6125 Hz */
-    { 5.607287574576210E-01, -1.121457514915242E+00, 5.607287574576210E-01, -9.181664790775230E-01, 3.247485507529606E-01 }, /* 6150 Hz */
-    { 5.593530640266058E-01, -1.118706128053212E+00, 5.593530640266058E-01, -9.140671255322808E-01, 3.233451305741425E-01 }, /* 6175 Hz */
-    { 5.579798571921343E-01, -1.115959714384269E+00, 5.579798571921343E-01, -9.099699633540052E-01, 3.219494654145321E-01 }, /* 6200 Hz */
-    { 5.566091288596730E-01, -1.113218257719346E+00, 5.566091288596730E-01, -9.058749849144014E-01, 3.205615305242903E-01 }, /* 6225 Hz */
-    { 5.552408709652245E-01, -1.110481741930449E+00, 5.552408709652245E-01, -9.017821825491943E-01, 3.191813013117035E-01 }, /* 6250 Hz */
-    { 5.538750754752615E-01, -1.107750150950523E+00, 5.538750754752615E-01, -8.976915485586081E-01, 3.178087533424377E-01 }, /* 6275 Hz */
-    { 5.525117343866618E-01, -1.105023468773324E+00, 5.525117343866618E-01, -8.936030752078445E-01, 3.164438623388026E-01 }, /* 6300 Hz */
-    { 5.511508397266419E-01, -1.102301679453284E+00, 5.511508397266419E-01, -8.895167547275512E-01, 3.150866041790165E-01 }, /* 6325 Hz */
-    { 5.497923835526914E-01, -1.099584767105383E+00, 5.497923835526914E-01, -8.854325793142876E-01, 3.137369548964779E-01 }, /* 6350 Hz */
-    { 5.484363579525064E-01, -1.096872715905013E+00, 5.484363579525064E-01, -8.813505411309841E-01, 3.123948906790415E-01 }, /* 6375 Hz */
-    { 5.470827550439233E-01, -1.094165510087847E+00, 5.470827550439233E-01, -8.772706323073948E-01, 3.110603878682988E-01 }, /* 6400 Hz */
-    { 5.457315669748523E-01, -1.091463133949705E+00, 5.457315669748523E-01, -8.731928449405461E-01, 3.097334229588631E-01 }, /* 6425 Hz */
-    { 5.443827859232102E-01, -1.088765571846420E+00, 5.443827859232102E-01, -8.691171710951806E-01, 3.084139725976599E-01 }, /* 6450 Hz */
-    { 5.430364040968537E-01, -1.086072808193707E+00, 5.430364040968537E-01, -8.650436028041935E-01, 3.071020135832214E-01 }, /* 6475 Hz */
-    { 5.416924137335124E-01, -1.083384827467025E+00, 5.416924137335124E-01, -8.609721320690644E-01, 3.057975228649852E-01 }, /* 6500 Hz */
-    { 5.403508071007218E-01, -1.080701614201444E+00, 5.403508071007218E-01, -8.569027508602873E-01, 3.045004775425999E-01 }, /* 6525 Hz */
-    { 5.390115764957549E-01, -1.078023152991510E+00, 5.390115764957549E-01, -8.528354511177886E-01, 3.032108548652311E-01 }, /* 6550 Hz */
-    { 5.376747142455559E-01, -1.075349428491112E+00, 5.376747142455559E-01, -8.487702247513468E-01, 3.019286322308767E-01 }, /* 6575 Hz */
-    { 5.363402127066720E-01, -1.072680425413344E+00, 5.363402127066720E-01, -8.447070636410042E-01, 3.006537871856836E-01 }, /* 6600 Hz */
-    { 5.350080642651859E-01, -1.070016128530372E+00, 5.350080642651859E-01, -8.406459596374729E-01, 2.993862974232705E-01 }, /* 6625 Hz */
-    { 5.336782613366476E-01, -1.067356522673295E+00, 5.336782613366476E-01, -8.365869045625369E-01, 2.981261407840535E-01 }, /* 6650 Hz */
-    { 5.323507963660072E-01, -1.064701592732014E+00, 5.323507963660072E-01, -8.325298902094505E-01, 2.968732952545787E-01 }, /* 6675 Hz */
-    { 5.310256618275464E-01, -1.062051323655093E+00, 5.310256618275464E-01, -8.284749083433287E-01, 2.956277389668571E-01 }, /* 6700 Hz */
-    { 5.297028502248108E-01, -1.059405700449622E+00, 5.297028502248108E-01, -8.244219507015372E-01, 2.943894501977058E-01 }, /* 6725 Hz */
-    { 5.283823540905411E-01, -1.056764708181082E+00, 5.283823540905411E-01, -8.203710089940730E-01, 2.931584073680916E-01 }, /* 6750 Hz */
-    { 5.270641659866062E-01, -1.054128331973212E+00, 5.270641659866062E-01, -8.163220749039444E-01, 2.919345890424805E-01 }, /* 6775 Hz */
-    { 5.257482785039339E-01, -1.051496557007868E+00, 5.257482785039339E-01, -8.122751400875436E-01, 2.907179739281920E-01 }, /* 6800 Hz */
-    { 5.244346842624432E-01, -1.048869368524886E+00, 5.244346842624432E-01, -8.082301961750169E-01, 2.895085408747562E-01 }, /* 6825 Hz */
-    { 5.231233759109761E-01, -1.046246751821952E+00, 5.231233759109761E-01, -8.041872347706279E-01, 2.883062688732765E-01 }, /* 6850 Hz */
-    { 5.218143461272290E-01, -1.043628692254458E+00, 5.218143461272290E-01, -8.001462474531191E-01, 2.871111370557968E-01 }, /* 6875 Hz */
-    { 5.205075876176845E-01, -1.041015175235369E+00, 5.205075876176845E-01, -7.961072257760664E-01, 2.859231246946715E-01 }, /* 6900 Hz */
-    { 5.192030931175436E-01, -1.038406186235087E+00, 5.192030931175436E-01, -7.920701612682322E-01, 2.847422112019425E-01 }, /* 6925 Hz */
-    { 5.179008553906570E-01, -1.035801710781314E+00, 5.179008553906570E-01, -7.880350454339105E-01, 2.835683761287172E-01 }, /* 6950 Hz */
-    { 5.166008672294563E-01, -1.033201734458913E+00, 5.166008672294563E-01, -7.840018697532715E-01, 2.824015991645538E-01 }, /* 6975 Hz */
-    { 5.153031214548873E-01, -1.030606242909775E+00, 5.153031214548873E-01, -7.799706256826999E-01, 2.812418601368495E-01 }, /* 7000 Hz */
-    { 5.140076109163403E-01, -1.028015221832681E+00, 5.140076109163403E-01, -7.759413046551283E-01, 2.800891390102327E-01 }, /* 7025 Hz */
-    { 5.127143284915819E-01, -1.025428656983164E+00, 5.127143284915819E-01, -7.719138980803685E-01, 2.789434158859594E-01 }, /* 7050 Hz */
-    { 5.114232670866886E-01, -1.022846534173377E+00, 5.114232670866886E-01, -7.678883973454383E-01, 2.778046710013159E-01 }, /* 7075 Hz */
-    { 5.101344196359763E-01, -1.020268839271953E+00, 5.101344196359763E-01, -7.638647938148831E-01, 2.766728847290222E-01 }, /* 7100 Hz */
-    { 5.088477791019342E-01, -1.017695558203868E+00, 5.088477791019342E-01, -7.598430788310944E-01, 2.755480375766425E-01 }, /* 7125 Hz */
-    { 5.075633384751557E-01, -1.015126676950311E+00, 5.075633384751557E-01, -7.558232437146233E-01, 2.744301101859991E-01 }, /* 7150 Hz */
-    { 5.062810907742705E-01, -1.012562181548541E+00, 5.062810907742705E-01, -7.518052797644930E-01, 2.733190833325890E-01 }, /* 7175 Hz */
-    { 5.050010290458777E-01, -1.010002058091755E+00, 5.050010290458777E-01, -7.477891782585036E-01, 2.722149379250074E-01 }, /* 7200 Hz */
-    { 5.037231463644770E-01, -1.007446292728954E+00, 5.037231463644770E-01, -7.437749304535359E-01, 2.711176550043721E-01 }, /* 7225 Hz */
-    { 5.024474358324011E-01, -1.004894871664802E+00, 5.024474358324011E-01, -7.397625275858497E-01, 2.700272157437550E-01 }, /* 7250 Hz */
-    { 5.011738905797491E-01, -1.002347781159498E+00, 5.011738905797491E-01, -7.357519608713805E-01, 2.689436014476159E-01 }, /* 7275 Hz */
-    { 4.999025037643175E-01, -9.998050075286350E-01, 4.999025037643175E-01, -7.317432215060291E-01, 2.678667935512408E-01 }, /* 7300 Hz */
-    { 4.986332685715338E-01, -9.972665371430677E-01, 4.986332685715338E-01, -7.277363006659514E-01, 2.667967736201839E-01 }, /* 7325 Hz */
-    { 4.973661782143893E-01, -9.947323564287787E-01, 4.973661782143893E-01, -7.237311895078423E-01, 2.657335233497151E-01 }, /* 7350 Hz */
-    { 4.961012259333712E-01, -9.922024518667425E-01, 4.961012259333712E-01, -7.197278791692163E-01, 2.646770245642687E-01 }, /* 7375 Hz */
-    { 4.948384049963961E-01, -9.896768099927922E-01, 4.948384049963961E-01, -7.157263607686845E-01, 2.636272592169000E-01 }, /* 7400 Hz */
-    { 4.935777086987427E-01, -9.871554173974855E-01, 4.935777086987427E-01, -7.117266254062293E-01, 2.625842093887416E-01 }, /* 7425 Hz */
-    { 4.923191303629856E-01, -9.846382607259712E-01, 4.923191303629856E-01, -7.077286641634748E-01, 2.615478572884675E-01 }, /* 7450 Hz */
-    { 4.910626633389276E-01, -9.821253266778552E-01, 4.910626633389276E-01, -7.037324681039523E-01, 2.605181852517583E-01 }, /* 7475 Hz */
-    { 4.898083010035343E-01, -9.796166020070687E-01, 4.898083010035343E-01, -6.997380282733655E-01, 2.594951757407719E-01 }, /* 7500 Hz */
-    { 4.885560367608672E-01, -9.771120735217343E-01, 4.885560367608672E-01, -6.957453356998506E-01, 2.584788113436180E-01 }, /* 7525 Hz */
-    { 4.873058640420171E-01, -9.746117280840343E-01, 4.873058640420171E-01, -6.917543813942331E-01, 2.574690747738354E-01 }, /* 7550 Hz */
-    { 4.860577763050389E-01, -9.721155526100778E-01, 4.860577763050389E-01, -6.877651563502801E-01, 2.564659488698752E-01 }, /* 7575 Hz */
-    { 4.848117670348848E-01, -9.696235340697696E-01, 4.848117670348848E-01, -6.837776515449541E-01, 2.554694165945851E-01 }, /* 7600 Hz */
-    { 4.835678297433392E-01, -9.671356594866783E-01, 4.835678297433392E-01, -6.797918579386564E-01, 2.544794610347003E-01 }, /* 7625 Hz */
-    { 4.823259579689531E-01, -9.646519159379062E-01, 4.823259579689531E-01, -6.758077664754754E-01, 2.534960654003371E-01 }, /* 7650 Hz */
-    { 4.810861452769781E-01, -9.621722905539563E-01, 4.810861452769781E-01, -6.718253680834235E-01, 2.525192130244892E-01 }, /* 7675 Hz */
-    { 4.798483852593020E-01, -9.596967705186040E-01, 4.798483852593020E-01, -6.678446536746783E-01, 2.515488873625297E-01 }, /* 7700 Hz */
-    { 4.786126715343832E-01, -9.572253430687665E-01, 4.786126715343832E-01, -6.638656141458167E-01, 2.505850719917161E-01 }, /* 7725 Hz */
-    { 4.773789977471860E-01, -9.547579954943720E-01, 4.773789977471860E-01, -6.598882403780457E-01, 2.496277506106984E-01 }, /* 7750 Hz */
-    { 4.761473575691162E-01, -9.522947151382324E-01, 4.761473575691162E-01, -6.559125232374323E-01, 2.486769070390325E-01 }, /* 7775 Hz */
-    { 4.749177446979564E-01, -9.498354893959128E-01, 4.749177446979564E-01, -6.519384535751300E-01, 2.477325252166955E-01 }, /* 7800 Hz */
-    { 4.736901528578017E-01, -9.473803057156035E-01, 4.736901528578017E-01, -6.479660222276009E-01, 2.467945892036062E-01 }, /* 7825 Hz */
-    { 4.724645757989962E-01, -9.449291515979924E-01, 4.724645757989962E-01, -6.439952200168364E-01, 2.458630831791483E-01 }, /* 7850 Hz */
-    { 4.712410072980686E-01, -9.424820145961371E-01, 4.712410072980686E-01, -6.400260377505751E-01, 2.449379914416991E-01 }, /* 7875 Hz */
-    { 4.700194411576687E-01, -9.400388823153374E-01, 4.700194411576687E-01, -6.360584662225164E-01, 2.440192984081584E-01 }, /* 7900 Hz */
-    { 4.687998712065046E-01, -9.375997424130091E-01, 4.687998712065046E-01, -6.320924962125334E-01, 2.431069886134848E-01 }, /* 7925 Hz */
-    { 4.675822912992784E-01, -9.351645825985567E-01, 4.675822912992784E-01, -6.281281184868799E-01, 2.422010467102335E-01 }, /* 7950 Hz */
-    { 4.663666953166247E-01, -9.327333906332493E-01, 4.663666953166247E-01, -6.241653237984001E-01, 2.413014574680984E-01 }, /* 7975 Hz */
-    { 4.651530771650466E-01, -9.303061543300932E-01, 4.651530771650466E-01, -6.202041028867289E-01, 2.404082057734576E-01 }, /* 8000 Hz */
-    { 4.639414307768545E-01, -9.278828615537089E-01, 4.639414307768545E-01, -6.162444464784951E-01, 2.395212766289226E-01 }, /* 8025 Hz */
-    { 4.627317501101027E-01, -9.254635002202054E-01, 4.627317501101027E-01, -6.122863452875192E-01, 2.386406551528914E-01 }, /* 8050 Hz */
-    { 4.615240291485281E-01, -9.230480582970562E-01, 4.615240291485281E-01, -6.083297900150081E-01, 2.377663265791042E-01 }, /* 8075 Hz */
-    { 4.603182619014885E-01, -9.206365238029770E-01, 4.603182619014885E-01, -6.043747713497500E-01, 2.368982762562040E-01 }, /* 8100 Hz */
-    { 4.591144424039009E-01, -9.182288848078017E-01, 4.591144424039009E-01, -6.004212799683040E-01, 2.360364896472995E-01 }, /* 8125 Hz */
-    { 4.579125647161802E-01, -9.158251294323605E-01, 4.579125647161802E-01, -5.964693065351886E-01, 2.351809523295325E-01 }, /* 8150 Hz */
-    { 4.567126229241790E-01, -9.134252458483580E-01, 4.567126229241790E-01, -5.925188417030677E-01, 2.343316499936485E-01 }, /* 8175 Hz */
-    { 4.555146111391258E-01, -9.110292222782516E-01, 4.555146111391258E-01, -5.885698761129330E-01, 2.334885684435701E-01 }, /* 8200 Hz */
-    { 4.543185234975653E-01, -9.086370469951306E-01, 4.543185234975653E-01, -5.846224003942857E-01, 2.326516935959754E-01 }, /* 8225 Hz */
-    { 4.531243541612979E-01, -9.062487083225959E-01, 4.531243541612979E-01, -5.806764051653142E-01, 2.318210114798776E-01 }, /* 8250 Hz */
-    { 4.519320973173205E-01, -9.038641946346410E-01, 4.519320973173205E-01, -5.767318810330708E-01, 2.309965082362112E-01 }, /* 8275 Hz */
-    { 4.507417471777656E-01, -9.014834943555312E-01, 4.507417471777656E-01, -5.727888185936447E-01, 2.301781701174177E-01 }, /* 8300 Hz */
-    { 4.495532979798437E-01, -8.991065959596873E-01, 4.495532979798437E-01, -5.688472084323349E-01, 2.293659834870396E-01 }, /* 8325 Hz */
-    { 4.483667439857824E-01, -8.967334879715647E-01, 4.483667439857824E-01, -5.649070411238171E-01, 2.285599348193124E-01 }, /* 8350 Hz */
-    { 4.471820794827692E-01, -8.943641589655384E-01, 4.471820794827692E-01, -5.609683072323124E-01, 2.277600106987646E-01 }, /* 8375 Hz */
-    { 4.459992987828922E-01, -8.919985975657845E-01, 4.459992987828922E-01, -5.570309973117509E-01, 2.269661978198181E-01 }, /* 8400 Hz */
-    { 4.448183962230822E-01, -8.896367924461644E-01, 4.448183962230822E-01, -5.530951019059349E-01, 2.261784829863939E-01 }, /* 8425 Hz */
-    { 4.436393661650544E-01, -8.872787323301089E-01, 4.436393661650544E-01, -5.491606115486984E-01, 2.253968531115194E-01 }, /* 8450 Hz */
-    { 4.424622029952517E-01, -8.849244059905035E-01, 4.424622029952517E-01, -5.452275167640659E-01, 2.246212952169410E-01 }, /* 8475 Hz */
-    { 4.412869011247864E-01, -8.825738022495728E-01, 4.412869011247864E-01, -5.412958080664074E-01, 2.238517964327381E-01 }, /* 8500 Hz */
-    { 4.401134549893840E-01, -8.802269099787681E-01, 4.401134549893840E-01, -5.373654759605938E-01, 2.230883439969423E-01 }, /* 8525 Hz */
-    { 4.389418590493262E-01, -8.778837180986524E-01, 4.389418590493262E-01, -5.334365109421471E-01, 2.223309252551577E-01 }, /* 8550 Hz */
-    { 4.377721077893942E-01, -8.755442155787885E-01, 4.377721077893942E-01, -5.295089034973903E-01, 2.215795276601867E-01 }, /* 8575 Hz */
-    { 4.366041957188138E-01, -8.732083914376275E-01, 4.366041957188138E-01, -5.255826441035969E-01, 2.208341387716580E-01 }, /* 8600 Hz */
-    { 4.354381173711980E-01, -8.708762347423959E-01, 4.354381173711980E-01, -5.216577232291342E-01, 2.200947462556578E-01 }, /* 8625 Hz */
-    { 4.342738673044930E-01, -8.685477346089859E-01, 4.342738673044930E-01, -5.177341313336079E-01, 2.193613378843640E-01 }, /* 8650 Hz */
-    { 4.331114401009226E-01, -8.662228802018452E-01, 4.331114401009226E-01, -5.138118588680054E-01, 2.186339015356851E-01 }, /* 8675 Hz */
-    { 4.319508303669332E-01, -8.639016607338664E-01, 4.319508303669332E-01, -5.098908962748323E-01, 2.179124251929006E-01 }, /* 8700 Hz */
-    { 4.307920327331398E-01, -8.615840654662795E-01, 4.307920327331398E-01, -5.059712339882538E-01, 2.171968969443052E-01 }, /* 8725 Hz */
-    { 4.296350418542713E-01, -8.592700837085425E-01, 4.296350418542713E-01, -5.020528624342279E-01, 2.164873049828571E-01 }, /* 8750 Hz */
-    { 4.284798524091175E-01, -8.569597048182349E-01, 4.284798524091175E-01, -4.981357720306418E-01, 2.157836376058279E-01 }, /* 8775 Hz */
-    { 4.273264591004748E-01, -8.546529182009496E-01, 4.273264591004748E-01, -4.942199531874423E-01, 2.150858832144568E-01 }, /* 8800 Hz */
-    { 4.261748566550937E-01, -8.523497133101874E-01, 4.261748566550937E-01, -4.903053963067668E-01, 2.143940303136081E-01 }, /* 8825 Hz */
-    { 4.250250398236262E-01, -8.500500796472523E-01, 4.250250398236262E-01, -4.863920917830740E-01, 2.137080675114308E-01 }, /* 8850 Hz */
-    { 4.238770033805724E-01, -8.477540067611449E-01, 4.238770033805724E-01, -4.824800300032673E-01, 2.130279835190225E-01 }, /* 8875 Hz */
-    { 4.227307421242295E-01, -8.454614842484589E-01, 4.227307421242295E-01, -4.785692013468225E-01, 2.123537671500954E-01 }, /* 8900 Hz */
-    { 4.215862508766391E-01, -8.431725017532783E-01, 4.215862508766391E-01, -4.746595961859102E-01, 2.116854073206465E-01 }, /* 8925 Hz */
-    { 4.204435244835369E-01, -8.408870489670738E-01, 4.204435244835369E-01, -4.707512048855175E-01, 2.110228930486300E-01 }, /* 8950 Hz */
-    { 4.193025578143003E-01, -8.386051156286005E-01, 4.193025578143003E-01, -4.668440178035679E-01, 2.103662134536330E-01 }, /* 8975 Hz */
-    { 4.181633457618989E-01, -8.363266915237978E-01, 4.181633457618989E-01, -4.629380252910409E-01, 2.097153577565546E-01 }, /* 9000 Hz */
-    { 4.170258832428438E-01, -8.340517664856876E-01, 4.170258832428438E-01, -4.590332176920867E-01, 2.090703152792887E-01 }, /* 9025 Hz */
-    { 4.158901651971375E-01, -8.317803303942749E-01, 4.158901651971375E-01, -4.551295853441426E-01, 2.084310754444072E-01 }, /* 9050 Hz */
-    { 4.147561865882239E-01, -8.295123731764478E-01, 4.147561865882239E-01, -4.512271185780453E-01, 2.077976277748501E-01 }, /* 9075 Hz */
-    { 4.136239424029402E-01, -8.272478848058804E-01, 4.136239424029402E-01, -4.473258077181452E-01, 2.071699618936156E-01 }, /* 9100 Hz */
-    { 4.124934276514666E-01, -8.249868553029331E-01, 4.124934276514666E-01, -4.434256430824122E-01, 2.065480675234540E-01 }, /* 9125 Hz */
-    { 4.113646373672788E-01, -8.227292747345576E-01, 4.113646373672788E-01, -4.395266149825489E-01, 2.059319344865662E-01 }, /* 9150 Hz */
-    { 4.102375666070996E-01, -8.204751332141992E-01, 4.102375666070996E-01, -4.356287137240958E-01, 2.053215527043026E-01 }, /* 9175 Hz */
-    { 4.091122104508510E-01, -8.182244209017020E-01, 4.091122104508510E-01, -4.317319296065367E-01, 2.047169121968672E-01 }, /* 9200 Hz */
-    { 4.079885640016068E-01, -8.159771280032135E-01, 4.079885640016068E-01, -4.278362529234038E-01, 2.041180030830232E-01 }, /* 9225 Hz */
-    { 4.068666223855456E-01, -8.137332447710912E-01, 4.068666223855456E-01, -4.239416739623794E-01, 2.035248155798030E-01 }, /* 9250 Hz */
-    { 4.057463807519040E-01, -8.114927615038080E-01, 4.057463807519040E-01, -4.200481830053972E-01, 2.029373400022187E-01 }, /* 9275 Hz */
-    { 4.046278342729308E-01, -8.092556685458615E-01, 4.046278342729308E-01, -4.161557703287435E-01, 2.023555667629794E-01 }, /* 9300 Hz */
-    { 4.035109781438406E-01, -8.070219562876811E-01, 4.035109781438406E-01, -4.122644262031543E-01, 2.017794863722081E-01 }, /* 9325 Hz */
-    { 4.023958075827685E-01, -8.047916151655370E-01, 4.023958075827685E-01, -4.083741408939120E-01, 2.012090894371620E-01 }, /* 9350 Hz */
-    { 4.012823178307251E-01, -8.025646356614502E-01, 4.012823178307251E-01, -4.044849046609420E-01, 2.006443666619583E-01 }, /* 9375 Hz */
-    { 4.001705041515515E-01, -8.003410083031031E-01, 4.001705041515515E-01, -4.005967077589070E-01, 2.000853088472991E-01 }, /* 9400 Hz */
-    { 3.990603618318752E-01, -7.981207236637503E-01, 3.990603618318752E-01, -3.967095404372986E-01, 1.995319068902021E-01 }, /* 9425 Hz */
-    { 3.979518861810659E-01, -7.959037723621318E-01, 3.979518861810659E-01, -3.928233929405298E-01, 1.989841517837338E-01 }, /* 9450 Hz */
-    { 3.968450725311922E-01, -7.936901450623843E-01, 3.968450725311922E-01, -3.889382555080254E-01, 1.984420346167431E-01 }, /* 9475 Hz */
-    { 3.957399162369782E-01, -7.914798324739565E-01, 3.957399162369782E-01, -3.850541183743105E-01, 1.979055465736023E-01 }, /* 9500 Hz */
-    { 3.946364126757612E-01, -7.892728253515224E-01, 3.946364126757612E-01, -3.811709717690986E-01, 1.973746789339462E-01 }, /* 9525 Hz */
-    { 3.935345572474487E-01, -7.870691144948974E-01, 3.935345572474487E-01, -3.772888059173772E-01, 1.968494230724173E-01 }, /* 9550 Hz */
-    { 3.924343453744768E-01, -7.848686907489536E-01, 3.924343453744768E-01, -3.734076110394945E-01, 1.963297704584126E-01 }, /* 9575 Hz */
-    { 3.913357725017687E-01, -7.826715450035373E-01, 3.913357725017687E-01, -3.695273773512414E-01, 1.958157126558333E-01 }, /* 9600 Hz */
-    { 3.902388340966932E-01, -7.804776681933865E-01, 3.902388340966932E-01, -3.656480950639360E-01, 1.953072413228370E-01 }, /* 9625 Hz */
-    { 3.891435256490245E-01, -7.782870512980491E-01, 3.891435256490245E-01, -3.617697543845034E-01, 1.948043482115948E-01 }, /* 9650 Hz */
-    { 3.880498426709015E-01, -7.760996853418030E-01, 3.880498426709015E-01, -3.578923455155585E-01, 1.943070251680473E-01 }, /* 9675 Hz */
-    { 3.869577806967874E-01, -7.739155613935749E-01, 3.869577806967874E-01, -3.540158586554819E-01, 1.938152641316678E-01 }, /* 9700 Hz */
-    { 3.858673352834316E-01, -7.717346705668633E-01, 3.858673352834316E-01, -3.501402839985023E-01, 1.933290571352245E-01 }, /* 9725 Hz */
-    { 3.847785020098293E-01, -7.695570040196585E-01, 3.847785020098293E-01, -3.462656117347687E-01, 1.928483963045483E-01 }, /* 9750 Hz */
-    { 3.836912764771832E-01, -7.673825529543663E-01, 3.836912764771832E-01, -3.423918320504306E-01, 1.923732738583019E-01 }, /* 9775 Hz */
-    { 3.826056543088648E-01, -7.652113086177297E-01, 3.826056543088648E-01, -3.385189351277079E-01, 1.919036821077517E-01 }, /* 9800 Hz */
-    { 3.815216311503784E-01, -7.630432623007568E-01, 3.815216311503784E-01, -3.346469111449702E-01, 1.914396134565434E-01 }, /* 9825 Hz */
-    { 3.804392026693210E-01, -7.608784053386419E-01, 3.804392026693210E-01, -3.307757502768047E-01, 1.909810604004791E-01 }, /* 9850 Hz */
-    { 3.793583645553473E-01, -7.587167291106947E-01, 3.793583645553473E-01, -3.269054426940907E-01, 1.905280155272985E-01 }, /* 9875 Hz */
-    { 3.782791125201322E-01, -7.565582250402645E-01, 3.782791125201322E-01, -3.230359785640680E-01, 1.900804715164609E-01 }, /* 9900 Hz */
-    { 3.772014422973351E-01, -7.544028845946702E-01, 3.772014422973351E-01, -3.191673480504077E-01, 1.896384211389329E-01 }, /* 9925 Hz */
-    { 3.761253496425642E-01, -7.522506992851283E-01, 3.761253496425642E-01, -3.152995413132808E-01, 1.892018572569757E-01 }, /* 9950 Hz */
-    { 3.750508303333404E-01, -7.501016606666808E-01, 3.750508303333404E-01, -3.114325485094247E-01, 1.887707728239370E-01 }, /* 9975 Hz */
-    { 3.739778801690636E-01, -7.479557603381273E-01, 3.739778801690636E-01, -3.075663597922097E-01, 1.883451608840446E-01 }, /* 10000 Hz */
-    { 3.729064949709778E-01, -7.458129899419557E-01, 3.729064949709778E-01, -3.037009653117070E-01, 1.879250145722043E-01 }, /* 10025 Hz */
-    { 3.718366705821368E-01, -7.436733411642735E-01, 3.718366705821368E-01, -2.998363552147488E-01, 1.875103271137983E-01 }, /* 10050 Hz */
-    { 3.707684028673711E-01, -7.415368057347422E-01, 3.707684028673711E-01, -2.959725196449970E-01, 1.871010918244873E-01 }, /* 10075 Hz */
-    { 3.697016877132548E-01, -7.394033754265097E-01, 3.697016877132548E-01, -2.921094487430027E-01, 1.866973021100166E-01 }, /* 10100 Hz */
-    { 3.686365210280725E-01, -7.372730420561451E-01, 3.686365210280725E-01, -2.882471326462676E-01, 1.862989514660224E-01 }, /* 10125 Hz */
-    { 3.675728987417877E-01, -7.351457974835753E-01, 3.675728987417877E-01, -2.843855614893084E-01, 1.859060334778425E-01 }, /* 10150 Hz */
-    { 3.665108168060103E-01, -7.330216336120207E-01, 3.665108168060103E-01, -2.805247254037130E-01, 1.855185418203283E-01 }, /* 10175 Hz */
-    { 3.654502711939663E-01, -7.309005423879327E-01, 3.654502711939663E-01, -2.766646145182033E-01, 1.851364702576621E-01 }, /* 10200 Hz */
-    { 3.643912579004659E-01, -7.287825158009319E-01, 3.643912579004659E-01, -2.728052189586905E-01, 1.847598126431734E-01 }, /* 10225 Hz */
-    { 3.633337729418737E-01, -7.266675458837475E-01, 3.633337729418737E-01, -2.689465288483345E-01, 1.843885629191603E-01 }, /* 10250 Hz */
-    { 3.622778123560783E-01, -7.245556247121566E-01, 3.622778123560783E-01, -2.650885343076002E-01, 1.840227151167131E-01 }, /* 10275 Hz */
-    { 3.612233722024633E-01, -7.224467444049265E-01, 3.612233722024633E-01, -2.612312254543125E-01, 1.836622633555404E-01 }, /* 10300 Hz */
-    { 3.601704485618775E-01, -7.203408971237549E-01, 3.601704485618775E-01, -2.573745924037132E-01, 1.833072018437967E-01 }, /* 10325 Hz */
-    { 3.591190375366075E-01, -7.182380750732149E-01, 3.591190375366075E-01, -2.535186252685147E-01, 1.829575248779152E-01 }, /* 10350 Hz */
-    { 3.580691352503482E-01, -7.161382705006963E-01, 3.580691352503482E-01, -2.496633141589525E-01, 1.826132268424401E-01 }, /* 10375 Hz */
-    { 3.570207378481760E-01, -7.140414756963519E-01, 3.570207378481760E-01, -2.458086491828394E-01, 1.822743022098643E-01 }, /* 10400 Hz */
-    { 3.559738414965212E-01, -7.119476829930425E-01, 3.559738414965212E-01, -2.419546204456173E-01, 1.819407455404675E-01 }, /* 10425 Hz */
-    { 3.549284423831413E-01, -7.098568847662826E-01, 3.549284423831413E-01, -2.381012180504072E-01, 1.816125514821579E-01 }, /* 10450 Hz */
-    { 3.538845367170950E-01, -7.077690734341899E-01, 3.538845367170950E-01, -2.342484320980627E-01, 1.812897147703173E-01 }, /* 10475 Hz */
-    { 3.528421207287159E-01, -7.056842414574318E-01, 3.528421207287159E-01, -2.303962526872169E-01, 1.809722302276468E-01 }, /* 10500 Hz */
-    { 3.518011906695875E-01, -7.036023813391751E-01, 3.518011906695875E-01, -2.265446699143339E-01, 1.806600927640162E-01 }, /* 10525 Hz */
-    { 3.507617428125184E-01, -7.015234856250367E-01, 3.507617428125184E-01, -2.226936738737566E-01, 1.803532973763168E-01 }, /* 10550 Hz */
-    { 3.497237734515173E-01, -6.994475469030346E-01, 3.497237734515173E-01, -2.188432546577541E-01, 1.800518391483149E-01 }, /* 10575 Hz */
-    { 3.486872789017698E-01, -6.973745578035395E-01, 3.486872789017698E-01, -2.149934023565701E-01, 1.797557132505090E-01 }, /* 10600 Hz */
-    { 3.476522554996143E-01, -6.953045109992286E-01, 3.476522554996143E-01, -2.111441070584678E-01, 1.794649149399893E-01 }, /* 10625 Hz */
-    { 3.466186996025196E-01, -6.932373992050392E-01, 3.466186996025196E-01, -2.072953588497781E-01, 1.791794395603004E-01 }, /* 10650 Hz */
-    { 3.455866075890622E-01, -6.911732151781244E-01, 3.455866075890622E-01, -2.034471478149438E-01, 1.788992825413048E-01 }, /* 10675 Hz */
-    { 3.445559758589039E-01, -6.891119517178078E-01, 3.445559758589039E-01, -1.995994640365642E-01, 1.786244393990515E-01 }, /* 10700 Hz */
-    { 3.435268008327710E-01, -6.870536016655420E-01, 3.435268008327710E-01, -1.957522975954401E-01, 1.783549057356440E-01 }, /* 10725 Hz */
-    { 3.424990789524328E-01, -6.849981579048655E-01, 3.424990789524328E-01, -1.919056385706173E-01, 1.780906772391138E-01 }, /* 10750 Hz */
-    { 3.414728066806805E-01, -6.829456133613609E-01, 3.414728066806805E-01, -1.880594770394277E-01, 1.778317496832941E-01 }, /* 10775 Hz */
-    { 3.404479805013085E-01, -6.808959610026171E-01, 3.404479805013085E-01, -1.842138030775359E-01, 1.775781189276981E-01 }, /* 10800 Hz */
-    { 3.394245969190936E-01, -6.788491938381872E-01, 3.394245969190936E-01, -1.803686067589768E-01, 1.773297809173978E-01 }, /* 10825 Hz */
-    { 3.384026524597767E-01, -6.768053049195534E-01, 3.384026524597767E-01, -1.765238781562002E-01, 1.770867316829065E-01 }, /* 10850 Hz */
-    { 3.373821436700435E-01, -6.747642873400870E-01, 3.373821436700435E-01, -1.726796073401101E-01, 1.768489673400636E-01 }, /* 10875 Hz */
-    { 3.363630671175069E-01, -6.727261342350137E-01, 3.363630671175069E-01, -1.688357843801055E-01, 1.766164840899218E-01 }, /* 10900 Hz */
-    { 3.353454193906895E-01, -6.706908387813790E-01, 3.353454193906895E-01, -1.649923993441211E-01, 1.763892782186370E-01 }, /* 10925 Hz */
-    { 3.343291970990062E-01, -6.686583941980124E-01, 3.343291970990062E-01, -1.611494422986653E-01, 1.761673460973596E-01 }, /* 10950 Hz */
-    { 3.333143968727477E-01, -6.666287937454953E-01, 3.333143968727477E-01, -1.573069033088599E-01, 1.759506841821307E-01 }, /* 10975 Hz */
-    { 3.323010153630641E-01, -6.646020307261281E-01, 3.323010153630641E-01, -1.534647724384790E-01, 1.757392890137771E-01 }, /* 11000 Hz */
-    { 3.312890492419502E-01, -6.625780984839005E-01, 3.312890492419502E-01, -1.496230397499875E-01, 1.755331572178134E-01 }, /* 11025 Hz */
-    { 3.302784952022297E-01, -6.605569904044594E-01, 3.302784952022297E-01, -1.457816953045765E-01, 1.753322855043421E-01 }, /* 11050 Hz */
-    { 3.292693499575404E-01, -6.585386999150808E-01, 3.292693499575404E-01, -1.419407291622025E-01, 1.751366706679592E-01 }, /* 11075 Hz */
-    { 3.282616102423213E-01, -6.565232204846425E-01, 3.282616102423213E-01, -1.381001313816245E-01, 1.749463095876606E-01 }, /* 11100 Hz */
-    { 3.272552728117976E-01, -6.545105456235952E-01, 3.272552728117976E-01, -1.342598920204384E-01, 1.747611992267522E-01 }, /* 11125 Hz */
-    { 3.262503344419688E-01, -6.525006688839375E-01, 3.262503344419688E-01, -1.304200011351145E-01, 1.745813366327607E-01 }, /* 11150 Hz */
-    { 3.252467919295958E-01, -6.504935838591916E-01, 3.252467919295958E-01, -1.265804487810334E-01, 1.744067189373500E-01 }, /* 11175 Hz */
-    { 3.242446420921887E-01, -6.484892841843773E-01, 3.242446420921887E-01, -1.227412250125193E-01, 1.742373433562354E-01 }, /* 11200 Hz */
-    { 3.232438817679957E-01, -6.464877635359914E-01, 3.232438817679957E-01, -1.189023198828774E-01, 1.740732071891053E-01 }, /* 11225 Hz */
-    { 3.222445078159921E-01, -6.444890156319841E-01, 3.222445078159921E-01, -1.150637234444272E-01, 1.739143078195410E-01 }, /* 11250 Hz */
-    { 3.212465171158693E-01, -6.424930342317386E-01, 3.212465171158693E-01, -1.112254257485352E-01, 1.737606427149421E-01 }, /* 11275 Hz */
-    { 3.202499065680263E-01, -6.404998131360526E-01, 3.202499065680263E-01, -1.073874168456525E-01, 1.736122094264527E-01 }, /* 11300 Hz */
-    { 3.192546730935587E-01, -6.385093461871174E-01, 3.192546730935587E-01, -1.035496867853445E-01, 1.734690055888904E-01 }, /* 11325 Hz */
-    { 3.182608136342509E-01, -6.365216272685018E-01, 3.182608136342509E-01, -9.971222561632648E-02, 1.733310289206772E-01 }, /* 11350 Hz */
-    { 3.172683251525675E-01, -6.345366503051350E-01, 3.172683251525675E-01, -9.587502338649606E-02, 1.731982772237740E-01 }, /* 11375 Hz */
-    { 3.162772046316457E-01, -6.325544092632914E-01, 3.162772046316457E-01, -9.203807014296515E-02, 1.730707483836179E-01 }, /* 11400 Hz */
-    { 3.152874490752879E-01, -6.305748981505758E-01, 3.152874490752879E-01, -8.820135593209320E-02, 1.729484403690583E-01 }, /* 11425 Hz */
-    { 3.142990555079550E-01, -6.285981110159100E-01, 3.142990555079550E-01, -8.436487079951951E-02, 1.728313512323005E-01 }, /* 11450 Hz */
-    { 3.133120209747605E-01, -6.266240419495210E-01, 3.133120209747605E-01, -8.052860479019436E-02, 1.727194791088479E-01 }, /* 11475 Hz */
-    { 3.123263425414649E-01, -6.246526850829297E-01, 3.123263425414649E-01, -7.669254794841063E-02, 1.726128222174487E-01 }, /* 11500 Hz */
-    { 3.113420172944699E-01, -6.226840345889398E-01, 3.113420172944699E-01, -7.285669031783590E-02, 1.725113788600439E-01 }, /* 11525 Hz */
-    { 3.103590423408154E-01, -6.207180846816308E-01, 3.103590423408154E-01, -6.902102194154375E-02, 1.724151474217180E-01 }, /* 11550 Hz */
-    { 3.093774148081742E-01, -6.187548296163483E-01, 3.093774148081742E-01, -6.518553286204366E-02, 1.723241263706529E-01 }, /* 11575 Hz */
-    { 3.083971318448491E-01, -6.167942636896981E-01, 3.083971318448491E-01, -6.135021312131354E-02, 1.722383142580827E-01 }, /* 11600 Hz */
-    { 3.074181906197700E-01, -6.148363812395400E-01, 3.074181906197700E-01, -5.751505276082751E-02, 1.721577097182526E-01 }, /* 11625 Hz */
-    { 3.064405883224920E-01, -6.128811766449840E-01, 3.064405883224920E-01, -5.368004182159002E-02, 1.720823114683780E-01 }, /* 11650 Hz */
-    { 3.054643221631931E-01, -6.109286443263862E-01, 3.054643221631931E-01, -4.984517034416344E-02, 1.720121183086089E-01 }, /* 11675 Hz */
-    { 3.044893893726733E-01, -6.089787787453467E-01, 3.044893893726733E-01, -4.601042836869895E-02, 1.719471291219945E-01 }, /* 11700 Hz */
-    { 3.035157872023543E-01, -6.070315744047087E-01, 3.035157872023543E-01, -4.217580593496692E-02, 1.718873428744505E-01 }, /* 11725 Hz */
-    { 3.025435129242788E-01, -6.050870258485577E-01, 3.025435129242788E-01, -3.834129308238556E-02, 1.718327586147297E-01 }, /* 11750 Hz */
-    { 3.015725638311118E-01, -6.031451276622236E-01, 3.015725638311118E-01, -3.450687985005343E-02, 1.717833754743937E-01 }, /* 11775 Hz */
-    { 3.006029372361408E-01, -6.012058744722816E-01, 3.006029372361408E-01, -3.067255627677389E-02, 1.717391926677893E-01 }, /* 11800 Hz */
-    { 2.996346304732786E-01, -5.992692609465572E-01, 2.996346304732786E-01, -2.683831240109047E-02, 1.717002094920240E-01 }, /* 11825 Hz */
-    { 2.986676408970649E-01, -5.973352817941298E-01, 2.986676408970649E-01, -2.300413826131306E-02, 1.716664253269464E-01 }, /* 11850 Hz */
-    { 2.977019658826687E-01, -5.954039317653375E-01, 2.977019658826687E-01, -1.917002389554649E-02, 1.716378396351284E-01 }, /* 11875 Hz */
-    { 2.967376028258931E-01, -5.934752056517862E-01, 2.967376028258931E-01, -1.533595934172294E-02, 1.716144519618495E-01 }, /* 11900 Hz */
-    { 2.957745491431778E-01, -5.915490982863556E-01, 2.957745491431778E-01, -1.150193463762761E-02, 1.715962619350838E-01 }, /* 11925 Hz */
-    { 2.948128022716047E-01, -5.896256045432093E-01, 2.948128022716047E-01, -7.667939820930197E-03, 1.715832692654884E-01 }, /* 11950 Hz */
-    { 2.938523596689024E-01, -5.877047193378048E-01, 2.938523596689024E-01, -3.833964929212952E-03, 1.715754737463965E-01 }, /* 11975 Hz */
-    { 2.928932188134526E-01, -5.857864376269052E-01, 2.928932188134526E-01, -3.608224830031759E-16, 1.715728752538099E-01 }, /* 12000 Hz */
-    { 2.919353772042959E-01, -5.838707544085918E-01, 2.919353772042959E-01, 3.833964929212730E-03, 1.715754737463965E-01 }, /* 12025 Hz */
-    { 2.909788323611397E-01, -5.819576647222795E-01, 2.909788323611397E-01, 7.667939820929698E-03, 1.715832692654885E-01 }, /* 12050 Hz */
-    { 2.900235818243641E-01, -5.800471636487282E-01, 2.900235818243641E-01, 1.150193463762730E-02, 1.715962619350837E-01 }, /* 12075 Hz */
-    { 2.890696231550317E-01, -5.781392463100634E-01, 2.890696231550317E-01, 1.533595934172291E-02, 1.716144519618495E-01 }, /* 12100 Hz */
-    { 2.881169539348954E-01, -5.762339078697908E-01, 2.881169539348954E-01, 1.917002389554680E-02, 1.716378396351284E-01 }, /* 12125 Hz */
-    { 2.871655717664084E-01, -5.743311435328168E-01, 2.871655717664084E-01, 2.300413826131256E-02, 1.716664253269463E-01 }, /* 12150 Hz */
-    { 2.862154742727333E-01, -5.724309485454666E-01, 2.862154742727333E-01, 2.683831240109059E-02, 1.717002094920239E-01 }, /* 12175 Hz */
-    { 2.852666590977539E-01, -5.705333181955078E-01, 2.852666590977539E-01, 3.067255627677377E-02, 1.717391926677893E-01 }, /* 12200 Hz */
-    { 2.843191239060852E-01, -5.686382478121703E-01, 2.843191239060852E-01, 3.450687985005307E-02, 1.717833754743938E-01 }, /* 12225 Hz */
-    { 2.833728663830860E-01, -5.667457327661719E-01, 2.833728663830860E-01, 3.834129308238578E-02, 1.718327586147296E-01 }, /* 12250 Hz */
-    { 2.824278842348709E-01, -5.648557684697418E-01, 2.824278842348709E-01, 4.217580593496684E-02, 1.718873428744506E-01 }, /* 12275 Hz */
-    { 2.814841751883240E-01, -5.629683503766479E-01, 2.814841751883240E-01, 4.601042836869852E-02, 1.719471291219946E-01 }, /* 12300 Hz */
-    { 2.805417369911115E-01, -5.610834739822229E-01, 2.805417369911115E-01, 4.984517034416321E-02, 1.720121183086090E-01 }, /* 12325 Hz */
-    { 2.796005674116971E-01, -5.592011348233942E-01, 2.796005674116971E-01, 5.368004182158979E-02, 1.720823114683780E-01 }, /* 12350 Hz */
-    { 2.786606642393563E-01, -5.573213284787126E-01, 2.786606642393563E-01, 5.751505276082726E-02, 1.721577097182525E-01 }, /* 12375 Hz */
-    { 2.777220252841924E-01, -5.554440505683848E-01, 2.777220252841924E-01, 6.135021312131327E-02, 1.722383142580829E-01 }, /* 12400 Hz */
-    { 2.767846483771523E-01, -5.535692967543047E-01, 2.767846483771523E-01, 6.518553286204376E-02, 1.723241263706530E-01 }, /* 12425 Hz */
-    { 2.758485313700436E-01, -5.516970627400871E-01, 2.758485313700436E-01, 6.902102194154386E-02, 1.724151474217181E-01 }, /* 12450 Hz */
-    { 2.749136721355520E-01, -5.498273442711039E-01, 2.749136721355520E-01, 7.285669031783594E-02, 1.725113788600439E-01 }, /* 12475 Hz */
-    { 2.739800685672595E-01, -5.479601371345190E-01, 2.739800685672595E-01, 7.669254794841077E-02, 1.726128222174487E-01 }, /* 12500 Hz */
-    { 2.730477185796634E-01, -5.460954371593268E-01, 2.730477185796634E-01, 8.052860479019440E-02, 1.727194791088480E-01 }, /* 12525 Hz */
-    { 2.721166201081952E-01, -5.442332402163903E-01, 2.721166201081952E-01, 8.436487079951990E-02, 1.728313512323005E-01 }, /* 12550 Hz */
-    { 2.711867711092413E-01, -5.423735422184826E-01, 2.711867711092413E-01, 8.820135593209329E-02, 1.729484403690584E-01 }, /* 12575 Hz */
-    { 2.702581695601632E-01, -5.405163391203265E-01, 2.702581695601632E-01, 9.203807014296495E-02, 1.730707483836180E-01 }, /* 12600 Hz */
-    { 2.693308134593196E-01, -5.386616269186393E-01, 2.693308134593196E-01, 9.587502338649562E-02, 1.731982772237740E-01 }, /* 12625 Hz */
-    { 2.684047008260876E-01, -5.368094016521753E-01, 2.684047008260876E-01, 9.971222561632662E-02, 1.733310289206771E-01 }, /* 12650 Hz */
-    { 2.674798297008865E-01, -5.349596594017729E-01, 2.674798297008865E-01, 1.035496867853444E-01, 1.734690055888902E-01 }, /* 12675 Hz */
-    { 2.665561981452000E-01, -5.331123962904000E-01, 2.665561981452000E-01, 1.073874168456528E-01, 1.736122094264528E-01 }, /* 12700 Hz */
-    { 2.656338042416018E-01, -5.312676084832036E-01, 2.656338042416018E-01, 1.112254257485350E-01, 1.737606427149422E-01 }, /* 12725 Hz */
-    { 2.647126460937784E-01, -5.294252921875569E-01, 2.647126460937784E-01, 1.150637234444272E-01, 1.739143078195409E-01 }, /* 12750 Hz */
-    { 2.637927218265570E-01, -5.275854436531140E-01, 2.637927218265570E-01, 1.189023198828774E-01, 1.740732071891053E-01 }, /* 12775 Hz */
-    { 2.628740295859291E-01, -5.257480591718582E-01, 2.628740295859291E-01, 1.227412250125191E-01, 1.742373433562354E-01 }, /* 12800 Hz */
-    { 2.619565675390792E-01, -5.239131350781584E-01, 2.619565675390792E-01, 1.265804487810332E-01, 1.744067189373500E-01 }, /* 12825 Hz */
-    { 2.610403338744117E-01, -5.220806677488233E-01, 2.610403338744117E-01, 1.304200011351141E-01, 1.745813366327608E-01 }, /* 12850 Hz */
-    { 2.601253268015785E-01, -5.202506536031569E-01, 2.601253268015785E-01, 1.342598920204384E-01, 1.747611992267521E-01 }, /* 12875 Hz */
-    { 2.592115445515091E-01, -5.184230891030182E-01, 2.592115445515091E-01, 1.381001313816243E-01, 1.749463095876606E-01 }, /* 12900 Hz */
-    { 2.582989853764392E-01, -5.165979707528784E-01, 2.582989853764392E-01, 1.419407291622023E-01, 1.751366706679592E-01 }, /* 12925 Hz */
-    { 2.573876475499415E-01, -5.147752950998831E-01, 2.573876475499415E-01, 1.457816953045760E-01, 1.753322855043421E-01 }, /* 12950 Hz */
-    { 2.564775293669565E-01, -5.129550587339130E-01, 2.564775293669565E-01, 1.496230397499874E-01, 1.755331572178134E-01 }, /* 12975 Hz */
-    { 2.555686291438246E-01, -5.111372582876492E-01, 2.555686291438246E-01, 1.534647724384787E-01, 1.757392890137771E-01 }, /* 13000 Hz */
-    { 2.546609452183177E-01, -5.093218904366353E-01, 2.546609452183177E-01, 1.573069033088599E-01, 1.759506841821306E-01 }, /* 13025 Hz */
-    { 2.537544759496737E-01, -5.075089518993473E-01, 2.537544759496737E-01, 1.611494422986650E-01, 1.761673460973597E-01 }, /* 13050 Hz */
-    { 2.528492197186289E-01, -5.056984394372579E-01, 2.528492197186289E-01, 1.649923993441210E-01, 1.763892782186370E-01 }, /* 13075 Hz */
-    { 2.519451749274541E-01, -5.038903498549082E-01, 2.519451749274541E-01, 1.688357843801054E-01, 1.766164840899219E-01 }, /* 13100 Hz */
-    { 2.510423399999884E-01, -5.020846799999769E-01, 2.510423399999884E-01, 1.726796073401100E-01, 1.768489673400637E-01 }, /* 13125 Hz */
-    { 2.501407133816765E-01, -5.002814267633531E-01, 2.501407133816765E-01, 1.765238781562004E-01, 1.770867316829066E-01 }, /* 13150 Hz */
-    { 2.492402935396053E-01, -4.984805870792106E-01, 2.492402935396053E-01, 1.803686067589768E-01, 1.773297809173979E-01 }, /* 13175 Hz */
-    { 2.483410789625406E-01, -4.966821579250811E-01, 2.483410789625406E-01, 1.842138030775359E-01, 1.775781189276982E-01 }, /* 13200 Hz */
-    { 2.474430681609666E-01, -4.948861363219332E-01, 2.474430681609666E-01, 1.880594770394278E-01, 1.778317496832941E-01 }, /* 13225 Hz */
-    { 2.465462596671241E-01, -4.930925193342482E-01, 2.465462596671241E-01, 1.919056385706173E-01, 1.780906772391139E-01 }, /* 13250 Hz */
-    { 2.456506520350510E-01, -4.913013040701020E-01, 2.456506520350510E-01, 1.957522975954402E-01, 1.783549057356441E-01 }, /* 13275 Hz */
-    { 2.447562438406218E-01, -4.895124876812437E-01, 2.447562438406218E-01, 1.995994640365641E-01, 1.786244393990515E-01 }, /* 13300 Hz */
-    { 2.438630336815904E-01, -4.877260673631807E-01, 2.438630336815904E-01, 2.034471478149434E-01, 1.788992825413049E-01 }, /* 13325 Hz */
-    { 2.429710201776306E-01, -4.859420403552612E-01, 2.429710201776306E-01, 2.072953588497781E-01, 1.791794395603005E-01 }, /* 13350 Hz */
-    { 2.420802019703805E-01, -4.841604039407611E-01, 2.420802019703805E-01, 2.111441070584670E-01, 1.794649149399892E-01 }, /* 13375 Hz */
-    { 2.411905777234847E-01, -4.823811554469695E-01, 2.411905777234847E-01, 2.149934023565700E-01, 1.797557132505090E-01 }, /* 13400 Hz */
-    { 2.403021461226402E-01, -4.806042922452804E-01, 2.403021461226402E-01, 2.188432546577542E-01, 1.800518391483149E-01 }, /* 13425 Hz */
-    { 2.394149058756402E-01, -4.788298117512803E-01, 2.394149058756402E-01, 2.226936738737565E-01, 1.803532973763171E-01 }, /* 13450 Hz */
-    { 2.385288557124206E-01, -4.770577114248412E-01, 2.385288557124206E-01, 2.265446699143339E-01, 1.806600927640162E-01 }, /* 13475 Hz */
-    { 2.376439943851075E-01, -4.752879887702149E-01, 2.376439943851075E-01, 2.303962526872167E-01, 1.809722302276467E-01 }, /* 13500 Hz */
-    { 2.367603206680637E-01, -4.735206413361274E-01, 2.367603206680637E-01, 2.342484320980625E-01, 1.812897147703173E-01 }, /* 13525 Hz */
-    { 2.358778333579377E-01, -4.717556667158754E-01, 2.358778333579377E-01, 2.381012180504069E-01, 1.816125514821578E-01 }, /* 13550 Hz */
-    { 2.349965312737126E-01, -4.699930625474252E-01, 2.349965312737126E-01, 2.419546204456171E-01, 1.819407455404675E-01 }, /* 13575 Hz */
-    { 2.341164132567563E-01, -4.682328265135126E-01, 2.341164132567563E-01, 2.458086491828391E-01, 1.822743022098642E-01 }, /* 13600 Hz */
-    { 2.332374781708719E-01, -4.664749563417438E-01, 2.332374781708719E-01, 2.496633141589525E-01, 1.826132268424402E-01 }, /* 13625 Hz */
-    { 2.323597249023502E-01, -4.647194498047003E-01, 2.323597249023502E-01, 2.535186252685145E-01, 1.829575248779151E-01 }, /* 13650 Hz */
-    { 2.314831523600208E-01, -4.629663047200416E-01, 2.314831523600208E-01, 2.573745924037134E-01, 1.833072018437967E-01 }, /* 13675 Hz */
-    { 2.306077594753071E-01, -4.612155189506141E-01, 2.306077594753071E-01, 2.612312254543122E-01, 1.836622633555404E-01 }, /* 13700 Hz */
-    { 2.297335452022783E-01, -4.594670904045566E-01, 2.297335452022783E-01, 2.650885343075999E-01, 1.840227151167131E-01 }, /* 13725 Hz */
-    { 2.288605085177065E-01, -4.577210170354129E-01, 2.288605085177065E-01, 2.689465288483345E-01, 1.843885629191603E-01 }, /* 13750 Hz */
-    { 2.279886484211207E-01, -4.559772968422414E-01, 2.279886484211207E-01, 2.728052189586904E-01, 1.847598126431733E-01 }, /* 13775 Hz */
-    { 2.271179639348648E-01, -4.542359278697295E-01, 2.271179639348648E-01, 2.766646145182031E-01, 1.851364702576621E-01 }, /* 13800 Hz */
-    { 2.262484541041538E-01, -4.524969082083076E-01, 2.262484541041538E-01, 2.805247254037131E-01, 1.855185418203283E-01 }, /* 13825 Hz */
-    { 2.253801179971337E-01, -4.507602359942673E-01, 2.253801179971337E-01, 2.843855614893075E-01, 1.859060334778423E-01 }, /* 13850 Hz */
-    { 2.245129547049388E-01, -4.490259094098775E-01, 2.245129547049388E-01, 2.882471326462674E-01, 1.862989514660225E-01 }, /* 13875 Hz */
-    { 2.236469633417536E-01, -4.472939266835072E-01, 2.236469633417536E-01, 2.921094487430023E-01, 1.866973021100166E-01 }, /* 13900 Hz */
-    { 2.227821430448726E-01, -4.455642860897451E-01, 2.227821430448726E-01, 2.959725196449968E-01, 1.871010918244872E-01 }, /* 13925 Hz */
-    { 2.219184929747623E-01, -4.438369859495245E-01, 2.219184929747623E-01, 2.998363552147491E-01, 1.875103271137982E-01 }, /* 13950 Hz */
-    { 2.210560123151244E-01, -4.421120246302488E-01, 2.210560123151244E-01, 3.037009653117068E-01, 1.879250145722044E-01 }, /* 13975 Hz */
-    { 2.201947002729586E-01, -4.403894005459173E-01, 2.201947002729586E-01, 3.075663597922101E-01, 1.883451608840448E-01 }, /* 14000 Hz */
-    { 2.193345560786282E-01, -4.386691121572563E-01, 2.193345560786282E-01, 3.114325485094245E-01, 1.887707728239371E-01 }, /* 14025 Hz */
-    { 2.184755789859238E-01, -4.369511579718475E-01, 2.184755789859238E-01, 3.152995413132808E-01, 1.892018572569757E-01 }, /* 14050 Hz */
-    { 2.176177682721314E-01, -4.352355365442627E-01, 2.176177682721314E-01, 3.191673480504076E-01, 1.896384211389329E-01 }, /* 14075 Hz */
-    { 2.167611232380983E-01, -4.335222464761965E-01, 2.167611232380983E-01, 3.230359785640677E-01, 1.900804715164609E-01 }, /* 14100 Hz */
-    { 2.159056432083020E-01, -4.318112864166040E-01, 2.159056432083020E-01, 3.269054426940904E-01, 1.905280155272983E-01 }, /* 14125 Hz */
-    { 2.150513275309186E-01, -4.301026550618373E-01, 2.150513275309186E-01, 3.307757502768046E-01, 1.909810604004792E-01 }, /* 14150 Hz */
-    { 2.141981755778934E-01, -4.283963511557869E-01, 2.141981755778934E-01, 3.346469111449697E-01, 1.914396134565434E-01 }, /* 14175 Hz */
-    { 2.133461867450110E-01, -4.266923734900220E-01, 2.133461867450110E-01, 3.385189351277077E-01, 1.919036821077518E-01 }, /* 14200 Hz */
-    { 2.124953604519680E-01, -4.249907209039360E-01, 2.124953604519680E-01, 3.423918320504301E-01, 1.923732738583020E-01 }, /* 14225 Hz */
-    { 2.116456961424449E-01, -4.232913922848899E-01, 2.116456961424449E-01, 3.462656117347685E-01, 1.928483963045482E-01 }, /* 14250 Hz */
-    { 2.107971932841805E-01, -4.215943865683611E-01, 2.107971932841805E-01, 3.501402839985023E-01, 1.933290571352245E-01 }, /* 14275 Hz */
-    { 2.099498513690465E-01, -4.198997027380931E-01, 2.099498513690465E-01, 3.540158586554816E-01, 1.938152641316677E-01 }, /* 14300 Hz */
-    { 2.091036699131223E-01, -4.182073398262445E-01, 2.091036699131223E-01, 3.578923455155584E-01, 1.943070251680474E-01 }, /* 14325 Hz */
-    { 2.082586484567729E-01, -4.165172969135458E-01, 2.082586484567729E-01, 3.617697543845031E-01, 1.948043482115946E-01 }, /* 14350 Hz */
-    { 2.074147865647253E-01, -4.148295731294505E-01, 2.074147865647253E-01, 3.656480950639359E-01, 1.953072413228370E-01 }, /* 14375 Hz */
-    { 2.065720838261479E-01, -4.131441676522958E-01, 2.065720838261479E-01, 3.695273773512414E-01, 1.958157126558331E-01 }, /* 14400 Hz */
-    { 2.057305398547296E-01, -4.114610797094591E-01, 2.057305398547296E-01, 3.734076110394944E-01, 1.963297704584127E-01 }, /* 14425 Hz */
-    { 2.048901542887601E-01, -4.097803085775201E-01, 2.048901542887601E-01, 3.772888059173769E-01, 1.968494230724172E-01 }, /* 14450 Hz */
-    { 2.040509267912120E-01, -4.081018535824240E-01, 2.040509267912120E-01, 3.811709717690983E-01, 1.973746789339463E-01 }, /* 14475 Hz */
-    { 2.032128570498231E-01, -4.064257140996461E-01, 2.032128570498231E-01, 3.850541183743099E-01, 1.979055465736022E-01 }, /* 14500 Hz */
-    { 2.023759447771795E-01, -4.047518895543590E-01, 2.023759447771795E-01, 3.889382555080251E-01, 1.984420346167430E-01 }, /* 14525 Hz */
-    { 2.015401897108011E-01, -4.030803794216022E-01, 2.015401897108011E-01, 3.928233929405294E-01, 1.989841517837338E-01 }, /* 14550 Hz */
-    { 2.007055916132259E-01, -4.014111832264519E-01, 2.007055916132259E-01, 3.967095404372984E-01, 1.995319068902022E-01 }, /* 14575 Hz */
-    { 1.998721502720981E-01, -3.997443005441962E-01, 1.998721502720981E-01, 4.005967077589064E-01, 2.000853088472989E-01 }, /* 14600 Hz */
-    { 1.990398655002541E-01, -3.980797310005082E-01, 1.990398655002541E-01, 4.044849046609420E-01, 2.006443666619584E-01 }, /* 14625 Hz */
-    { 1.982087371358126E-01, -3.964174742716252E-01, 1.982087371358126E-01, 4.083741408939118E-01, 2.012090894371621E-01 }, /* 14650 Hz */
-    { 1.973787650422635E-01, -3.947575300845270E-01, 1.973787650422635E-01, 4.122644262031541E-01, 2.017794863722081E-01 }, /* 14675 Hz */
-    { 1.965499491085589E-01, -3.930998982171179E-01, 1.965499491085589E-01, 4.161557703287437E-01, 2.023555667629795E-01 }, /* 14700 Hz */
-    { 1.957222892492054E-01, -3.914445784984109E-01, 1.957222892492054E-01, 4.200481830053970E-01, 2.029373400022186E-01 }, /* 14725 Hz */
-    { 1.948957854043559E-01, -3.897915708087119E-01, 1.948957854043559E-01, 4.239416739623793E-01, 2.035248155798030E-01 }, /* 14750 Hz */
-    { 1.940704375399049E-01, -3.881408750798099E-01, 1.940704375399049E-01, 4.278362529234037E-01, 2.041180030830234E-01 }, /* 14775 Hz */
-    { 1.932462456475826E-01, -3.864924912951652E-01, 1.932462456475826E-01, 4.317319296065369E-01, 2.047169121968673E-01 }, /* 14800 Hz */
-    { 1.924232097450517E-01, -3.848464194901035E-01, 1.924232097450517E-01, 4.356287137240956E-01, 2.053215527043025E-01 }, /* 14825 Hz */
-    { 1.916013298760044E-01, -3.832026597520088E-01, 1.916013298760044E-01, 4.395266149825489E-01, 2.059319344865663E-01 }, /* 14850 Hz */
-    { 1.907806061102606E-01, -3.815612122205213E-01, 1.907806061102606E-01, 4.434256430824114E-01, 2.065480675234538E-01 }, /* 14875 Hz */
-    { 1.899610385438676E-01, -3.799220770877353E-01, 1.899610385438676E-01, 4.473258077181448E-01, 2.071699618936154E-01 }, /* 14900 Hz */
-    { 1.891426272992013E-01, -3.782852545984025E-01, 1.891426272992013E-01, 4.512271185780453E-01, 2.077976277748503E-01 }, /* 14925 Hz */
-    { 1.883253725250662E-01, -3.766507450501324E-01, 1.883253725250662E-01, 4.551295853441424E-01, 2.084310754444073E-01 }, /* 14950 Hz */
-    { 1.875092743968006E-01, -3.750185487936012E-01, 1.875092743968006E-01, 4.590332176920862E-01, 2.090703152792885E-01 }, /* 14975 Hz */
-    { 1.866943331163785E-01, -3.733886662327569E-01, 1.866943331163785E-01, 4.629380252910409E-01, 2.097153577565548E-01 }  /* 15000 Hz */
-};
-
-
-
-
+const double passthrough[5] = {1, 0, 0, 0, 0};
 
 // externs
 extern char do_log;
@@ -1255,81 +64,73 @@ extern char do_log;
  {
     char* sw; // used for command-line arguments
 
-    int fhertz1=25;
-    int fhertz2=25;
-    int fhertz1idx = 0;
-    int fhertz2idx = 0;
+    double fhertz1=25;
+    double fhertz2=25;
     char mode1 = LOW;
     char mode2 = LOW;
     char do_freq1=0;
     char do_freq2=0;
-    int midhertz=0;
-    int width=0;
+    double midhertz=0;
+    double width=0;
     char b1param=0;
+    int type = IIR_BUTTERWORTH;
+    int order = 6;
+    double ripple = 1;
+    double atten = 60;
+    double coeff[SECTIONS][5];
+    int n1 = 0;
+    int n2 = 0;
+    int i;
+    char used;
 
     // read in the command-line arguments
     sw = getCmdOption(argv, argv + argc, "-l");
     if (sw) {
-        sscanf(sw, "%d", &fhertz1);
-        if (do_log) printf("Setting lowpass to %d Hz\n", fhertz1);
-        fhertz2 = fhertz1;
+        sscanf(sw, "%lf", &fhertz1);
+        if (do_log) printf("Setting lowpass to %g Hz\n", fhertz1);
         do_freq1=1;
-        do_freq2=1;
-        fhertz1idx = (fhertz1/25)-1;
-        fhertz2idx = (fhertz2/25)-1;
         mode1 = LOW;
-        mode2 = LOW;
     }
 
     sw = getCmdOption(argv, argv + argc, "-h");
     if (sw) {
-        sscanf(sw, "%d", &fhertz1);
-        if (do_log) printf("Setting highpass to %d Hz\n", fhertz1);
-        fhertz2 = fhertz1;
+        sscanf(sw, "%lf", &fhertz1);
+        if (do_log) printf("Setting highpass to %g Hz\n", fhertz1);
         do_freq1=1;
-        do_freq2=1;
-        fhertz1idx = (fhertz1/25)-1;
-        fhertz2idx = (fhertz2/25)-1;
         mode1 = HIGH;
-        mode2 = HIGH;
     }
 
     sw = getCmdOption(argv, argv + argc, "-b");
     if (sw) {
-        sscanf(sw, "%d", &midhertz);
-        if (do_log) printf("Setting bandpass center to %d Hz\n", midhertz);
+        sscanf(sw, "%lf", &midhertz);
+        if (do_log) printf("Setting bandpass center to %g Hz\n", midhertz);
     }
 
     sw = getCmdOption(argv, argv + argc, "-w");
     if ((sw) && (midhertz)) {
-        sscanf(sw, "%d", &width);
-        if (do_log) printf("Setting bandwidth to %d Hz\n", width);
+        sscanf(sw, "%lf", &width);
+        if (do_log) printf("Setting bandwidth to %g Hz\n", width);
         fhertz1 = midhertz - (width/2);
         fhertz2 = midhertz + (width/2);
         do_freq1=1;
         do_freq2=1;
-        fhertz1idx = (fhertz1/25)-1;
-        fhertz2idx = (fhertz2/25)-1;
         mode1 = HIGH;
         mode2 = LOW;
     }
 
     sw = getCmdOption(argv, argv + argc, "-b1");
     if (sw) {
-        sscanf(sw, "%d", &fhertz1);
-        fhertz1idx = (fhertz1/25)-1;
+        sscanf(sw, "%lf", &fhertz1);
         b1param=1;
     }
 
     sw = getCmdOption(argv, argv + argc, "-b2");
     if (sw) {
         if (b1param) {
-            sscanf(sw, "%d", &fhertz2);
-            if (do_log) printf("Setting bandpass to %d - %d Hz\n", fhertz1, fhertz2);
+            sscanf(sw, "%lf", &fhertz2);
+            if (do_log) printf("Setting bandpass to %g - %g Hz\n", fhertz1, fhertz2);
             do_freq1=1;
             do_freq2=1;
-            fhertz1idx = (fhertz1/25)-1;
-            fhertz2idx = (fhertz2/25)-1;
             mode1 = HIGH;
             mode2 = LOW;
         } else {
@@ -1337,41 +138,72 @@ extern char do_log;
         }
     }
 
+    sw = getCmdOption(argv, argv + argc, "-t");
+    if (sw) {
+        type = iir_type(sw);
+        if (type < 0) {
+            printf("*** Error - unknown filter type '%s' (butter, cheby1, cheby2, bessel, ellip) ***\n", sw);
+            exit(1);
+        }
+    }
+
+    sw = getCmdOption(argv, argv + argc, "-o");
+    if (sw) {
+        sscanf(sw, "%d", &order);
+    }
+
+    sw = getCmdOption(argv, argv + argc, "-r");
+    if (sw) {
+        sscanf(sw, "%lf", &ripple);
+    }
 
-    if ((fhertz1idx<0) || (fhertz1idx>=600) || (fhertz2idx<0) || (fhertz2idx>=600)) {
-        printf("*** Error - out of range (25-15000 Hz is supported) ***\n");
+    sw = getCmdOption(argv, argv + argc, "-s");
+    if (sw) {
+        sscanf(sw, "%lf", &atten);
+    }
+
+    if ((order<1) || (order>(do_freq2 ? SECTIONS : 2*SECTIONS))) {
+        printf("*** Error - order out of range (1-%d is supported) ***\n", do_freq2 ? SECTIONS : 2*SECTIONS);
+        exit(1);
+    }
+
+    // a lowpass or highpass alone gets all the sections, a bandpass
+    // has the highpass in the first three and the lowpass in the rest
+    if (do_freq1) {
+        n1 = iir_design(coeff, type, (mode1==LOW) ? IIR_LOWPASS : IIR_HIGHPASS, order,
+                        BIQUAD_FS, fhertz1, ripple, atten);
+    }
+    if ((do_freq2) && (n1 >= 0)) {
+        n2 = iir_design(coeff+(SECTIONS/2), type, (mode2==LOW) ? IIR_LOWPASS : IIR_HIGHPASS, order,
+                        BIQUAD_FS, fhertz2, ripple, atten);
+    }
+    if ((n1==IIR_ROUNDING) || (n2==IIR_ROUNDING)) {
+        printf("*** Error - the filter doesn't work with the DSP's 5.23 coefficients, try a lower order or a higher cutoff ***\n");
+        exit(1);
+    }
+    if ((n1<0) || (n2<0)) {
+        printf("*** Error - out of range (up to 24000 Hz is supported) ***\n");
         exit(1);
     }
 
     dsp_open(); // create I2C handle for the DSP
+    dsp_batch_begin(); // send the whole filter update in one go
 
     if (do_freq1) {
-        if (mode1==LOW) {
-            set_gen_2nd_order_filter(FILTER_NODE+0, (double*)(&butterlowcoeff[fhertz1idx][0]));
-            set_gen_2nd_order_filter(FILTER_NODE+5, (double*)(&butterlowcoeff[fhertz1idx][0]));
-            set_gen_2nd_order_filter(FILTER_NODE+10, (double*)(&butterlowcoeff[fhertz1idx][0]));
-        } else {
-            set_gen_2nd_order_filter(FILTER_NODE+0, (double*)(&butterhighcoeff[fhertz1idx][0]));
-            set_gen_2nd_order_filter(FILTER_NODE+5, (double*)(&butterhighcoeff[fhertz1idx][0]));
-            set_gen_2nd_order_filter(FILTER_NODE+10, (double*)(&butterhighcoeff[fhertz1idx][0]));   
-        }
-    }
-    if (do_freq2) {
-        if (mode2==LOW) {
-            set_gen_2nd_order_filter(FILTER_NODE+15, (double*)(&butterlowcoeff[fhertz2idx][0]));
-            set_gen_2nd_order_filter(FILTER_NODE+20, (double*)(&butterlowcoeff[fhertz2idx][0]));
-            set_gen_2nd_order_filter(FILTER_NODE+25, (double*)(&butterlowcoeff[fhertz2idx][0]));
-        } else {
-            set_gen_2nd_order_filter(FILTER_NODE+15, (double*)(&butterhighcoeff[fhertz2idx][0]));
-            set_gen_2nd_order_filter(FILTER_NODE+20, (double*)(&butterhighcoeff[fhertz2idx][0]));
-            set_gen_2nd_order_filter(FILTER_NODE+25, (double*)(&butterhighcoeff[fhertz2idx][0]));   
+        for (i=0; i<SECTIONS; i++) {
+            if (do_freq2) {
+                used = (i < (SECTIONS/2)) ? (i < n1) : ((i-(SECTIONS/2)) < n2);
+            } else {
+                used = (i < n1);
+            }
+            set_gen_2nd_order_filter_safeload(FILTER_NODE+(i*5), used ? coeff[i] : (double*)passthrough);
         }
     }
 
+    dsp_batch_end();
     dsp_close(); // close the I2C resource for the DSP
 
     if (do_log) printf("Applied.\n");
 
     return(0);
  }
-
@@ -0,0 +1,168 @@
+/************************************
+ * fixedpoint.h
+ * conversion between double and the
+ * DSP fixed-point number formats
+ * (5.23, 5.19, 28.0), one value or
+ * an array at a time
+ *
+ * rev 1 october 2026
+ ************************************/
+
+#ifndef __FIXEDPOINT_HEADER_FILE__
+#define __FIXEDPOINT_HEADER_FILE__
+
+#include <stdint.h>
+#include <math.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define FIXED_SSE2 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define FIXED_NEON 1
+#endif
+
+// fixed_codec<IBITS, FBITS, BYTES> converts between double and a two's complement
+// number with IBITS integer bits (including the sign) and FBITS fraction bits,
+// sent as BYTES bytes, most significant byte first. Any bits above IBITS+FBITS
+// are zero on the wire, and are ignored when decoding (as the DSP does).
+//
+// Encoding rounds to the nearest value (halfway cases to even) and saturates:
+// a value that is too large or too small becomes the largest or smallest value
+// the format holds, rather than wrapping around. NaN is encoded as zero.
+//
+// encode_array() converts n values into n*BYTES bytes ready to send, e.g. as a
+// dsp_write_block() burst. With SSE2 (x86) or NEON (64-bit ARM) 4-byte formats
+// are converted several values at a time; the result is the same as encode().
+// (32-bit ARM NEON has no double precision, so there it is one at a time.)
+template <int IBITS, int FBITS, int BYTES>
+struct fixed_codec {
+    static const int BITS = IBITS + FBITS;
+    static const int32_t MAXI = (int32_t)((1LL << (BITS-1)) - 1);
+    static const int32_t MINI = (int32_t)(-(1LL << (BITS-1)));
+
+    // one least significant bit is 1/scale()
+    static double scale(void) { return((double)(1LL << FBITS)); }
+    static double max_value(void) { return(MAXI / scale()); }
+    static double min_value(void) { return(MINI / scale()); }
+
+    // double to integer, rounded and saturated
+    static inline int32_t to_int(double v) {
+        double x = v * scale();
+        if (x != x) return(0); // NaN
+        if (x >= (double)MAXI) return(MAXI);
+        if (x <= (double)MINI) return(MINI);
+        return((int32_t)lrint(x));
+    }
+
+    // integer (as from the wire, sign-extended) to double
+    static inline double to_double(int32_t i) {
+        return(i / scale());
+    }
+
+    // stores an integer that is already in range (e.g. from to_int)
+    static inline void put(int32_t i, unsigned char* bytes) {
+        uint32_t u = (uint32_t)i;
+        int b;
+        if (BITS < 32) u &= (uint32_t)((1LL << BITS) - 1);
+        for (b=BYTES-1; b>=0; b--) {
+            bytes[b] = (unsigned char)(u & 0xff);
+            u >>= 8;
+        }
+    }
+
+    static inline int32_t get(const unsigned char* bytes) {
+        uint32_t u = 0;
+        int b;
+        for (b=0; b<BYTES; b++) u = (u << 8) | bytes[b];
+        // ignore any bits above BITS, and sign-extend from BITS
+        if (BITS < 32) {
+            u &= (uint32_t)((1LL << BITS) - 1);
+            u = (u ^ (1u << (BITS-1))) - (1u << (BITS-1));
+        }
+        return((int32_t)u);
+    }
+
+    static inline void encode(double v, unsigned char* bytes) {
+        put(to_int(v), bytes);
+    }
+
+    static inline void encode_int(int32_t i, unsigned char* bytes) {
+        put((i > MAXI) ? MAXI : ((i < MINI) ? MINI : i), bytes);
+    }
+
+    static inline double decode(const unsigned char* bytes) {
+        return(to_double(get(bytes)));
+    }
+
+    static void encode_array(const double* v, unsigned char* bytes, int n) {
+        int i = 0;
+#if defined(FIXED_SSE2)
+        if (BYTES == 4) {
+            const __m128d k = _mm_set1_pd(scale());
+            const __m128d hi = _mm_set1_pd((double)MAXI);
+            const __m128d lo = _mm_set1_pd((double)MINI);
+            const __m128i mask = _mm_set1_epi32((BITS < 32) ? (int32_t)((1LL << BITS) - 1) : -1);
+            const __m128i m8 = _mm_set1_epi32(0x00ff00ff);
+            __m128d a, b;
+            __m128i w;
+            for (; i+4<=n; i+=4) {
+                a = _mm_mul_pd(_mm_loadu_pd(&v[i]), k);
+                b = _mm_mul_pd(_mm_loadu_pd(&v[i+2]), k);
+                a = _mm_and_pd(a, _mm_cmpord_pd(a, a)); // NaN to 0
+                b = _mm_and_pd(b, _mm_cmpord_pd(b, b));
+                a = _mm_max_pd(_mm_min_pd(a, hi), lo);
+                b = _mm_max_pd(_mm_min_pd(b, hi), lo);
+                // rounds to nearest even, in the default rounding mode, as lrint
+                w = _mm_unpacklo_epi64(_mm_cvtpd_epi32(a), _mm_cvtpd_epi32(b));
+                w = _mm_and_si128(w, mask);
+                // to big-endian: swap the bytes in each 16-bit half, then the halves
+                w = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(w, 8), m8),
+                                 _mm_andnot_si128(m8, _mm_slli_epi16(w, 8)));
+                w = _mm_shufflehi_epi16(_mm_shufflelo_epi16(w, 0xb1), 0xb1);
+                _mm_storeu_si128((__m128i*)&bytes[i*4], w);
+            }
+        }
+#elif defined(FIXED_NEON)
+        if (BYTES == 4) {
+            const float64x2_t k = vdupq_n_f64(scale());
+            const float64x2_t hi = vdupq_n_f64((double)MAXI);
+            const float64x2_t lo = vdupq_n_f64((double)MINI);
+            const uint32x4_t mask = vdupq_n_u32((BITS < 32) ? (uint32_t)((1LL << BITS) - 1) : 0xffffffffu);
+            float64x2_t a, b;
+            uint32x4_t w;
+            for (; i+4<=n; i+=4) {
+                a = vmulq_f64(vld1q_f64(&v[i]), k);
+                b = vmulq_f64(vld1q_f64(&v[i+2]), k);
+                a = vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(a), vceqq_f64(a, a))); // NaN to 0
+                b = vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(b), vceqq_f64(b, b)));
+                a = vmaxq_f64(vminq_f64(a, hi), lo);
+                b = vmaxq_f64(vminq_f64(b, hi), lo);
+                w = vreinterpretq_u32_s32(vcombine_s32(vmovn_s64(vcvtnq_s64_f64(a)),
+                                                       vmovn_s64(vcvtnq_s64_f64(b))));
+                w = vandq_u32(w, mask);
+                vst1q_u8(&bytes[i*4], vrev32q_u8(vreinterpretq_u8_u32(w)));
+            }
+        }
+#endif
+        for (; i<n; i++) {
+            encode(v[i], &bytes[i*BYTES]);
+        }
+    }
+
+    static void decode_array(const unsigned char* bytes, double* v, int n) {
+        int i;
+        for (i=0; i<n; i++) {
+            v[i] = decode(&bytes[i*BYTES]);
+        }
+    }
+};
+
+// parameter RAM words (coefficients, gains, frequencies)
+typedef fixed_codec<5, 23, 4> fixed_5_23;
+// readback (data capture) values
+typedef fixed_codec<5, 19, 3> fixed_5_19;
+// integer parameters (DC Input Entry, switches)
+typedef fixed_codec<28, 0, 4> fixed_28_0;
+
+#endif // __FIXEDPOINT_HEADER_FILE__
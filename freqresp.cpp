@@ -89,10 +89,10 @@ extern char do_log;
     if (do_amp) set_amp(AMP_ADDR, amp);
     if (do_freq) set_freq(SIN_ADDR, fhertz);
 
-    delay_ms(600); // wait 100 msec before we take the level reading
+    delay_ms(700); // wait 700 msec before we take the level reading
 
     if (do_peak || do_rms || do_dbu) {
-        v = readback(LEVEL_ADDR, LEVEL_NODE);
+        v = readback_fast(LEVEL_ADDR, LEVEL_NODE);
         if (do_peak) {
             converted = ms_to_pp(v);
         } else if (do_rms) {
@@ -8,14 +8,36 @@
 #   http://192.168.1.88:8000/dspgen/f1000
 # Example, set amplitude to 0.1 (-20 dB)
 #   http://192.168.1.88:8000/dspgen/a0.1
+# If the dspd daemon is running, requests are sent to it
+# over its socket instead of running dspgen each time.
 
 
 import http.server
 import socketserver
 import os
+import socket
+import struct
 
 PORT = 8000
 PROGPATH="/home/pi/development/waveminer/"
+DSPD_SOCK_PATH = "/tmp/dspd.sock"
+
+# consts from dspd.h, and the addresses used by tone_app.bin
+DSPD_SET_FREQ = 0x01
+DSPD_SET_AMP = 0x02
+SIN_ADDR = 0x0000
+AMP_ADDR = 0x0003
+
+# send one command to dspd, returns False if the daemon is not available
+def dspd_send(cmd, addr, payload):
+    try:
+        with socket.socket(socket.AF_UNIX, socket.SOCK_SEQPACKET) as s:
+            s.connect(DSPD_SOCK_PATH)
+            s.send(struct.pack("=BBH", cmd, 0, addr) + payload)
+            status = s.recv(16)[0]
+            return status == 0
+    except OSError:
+        return False
 
 print(f"Using port {PORT} and path {PROGPATH}")
 
@@ -26,9 +48,11 @@ class myRequestHandlerClass(http.server.SimpleHTTPRequestHandler):
         torun = PROGPATH + "dspgen -" + p.removeprefix("/dspgen/")
         print(f"string is {torun}")
         if self.path.startswith('/dspgen/f'):
-            os.system(torun)
+            if not dspd_send(DSPD_SET_FREQ, SIN_ADDR, struct.pack("=i", int(p.removeprefix("/dspgen/f")))):
+                os.system(torun)
         elif self.path.startswith('/dspgen/a'):
-            os.system(torun)
+            if not dspd_send(DSPD_SET_AMP, AMP_ADDR, struct.pack("=d", float(p.removeprefix("/dspgen/a")))):
+                os.system(torun)
         else:
             print(f"unknown request path!")
 
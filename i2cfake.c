@@ -0,0 +1,408 @@
+/*******************************
+ * i2cfake.c
+ * in-memory ADAU1401 and 24xx256
+ * EEPROM, and the "fake" transport
+ * rev 1 october 2026
+ *******************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <linux/i2c.h>
+#include "i2cfunc.h"
+#include "i2cfake.h"
+#include "dspsim.h"
+#include "fixedpoint.h"
+
+static fake_state_t* fake=NULL;
+static unsigned long long ee_twr_ns=FAKE_EE_TWR_US*1000ULL;
+static unsigned long long latency_ns=0; // per transaction
+static unsigned long bus_clock_hz=0;    // 0 for no byte time
+
+// same as now_ns() in i2cfunc.c, repeated so that the
+// models can be built into i2cshim.so on their own
+static unsigned long long now_ns(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return(((unsigned long long)t.tv_sec)*1000000000ULL + t.tv_nsec);
+}
+
+static double no_probe(int node)
+{
+  return(0.0);
+}
+
+double (*fake_dsp_probe)(int node)=no_probe;
+
+void fake_reset(void)
+{
+  memset(fake, 0, sizeof(fake_state_t));
+  fake->magic=FAKE_STATE_MAGIC;
+  memset(fake->ee, 0xff, FAKE_EE_SIZE); // erased EEPROM
+}
+
+fake_state_t* fake_state(void)
+{
+  const char* path;
+  const char* env;
+  void* addr;
+  int fd;
+
+  if (fake) return(fake);
+  env=getenv("WAVEMINER_FAKE_EE_TWR_US");
+  if (env) ee_twr_ns=strtoull(env, NULL, 0)*1000ULL;
+  env=getenv("WAVEMINER_FAKE_LATENCY_US");
+  if (env) latency_ns=(unsigned long long)(strtod(env, NULL)*1000.0);
+  env=getenv("WAVEMINER_FAKE_CLOCK_HZ");
+  if (env) bus_clock_hz=strtoul(env, NULL, 0);
+  path=getenv("WAVEMINER_FAKE_STATE");
+  if (path)
+  {
+    fd=open(path, O_RDWR | O_CREAT, 0666);
+    if ((fd>=0) && (ftruncate(fd, sizeof(fake_state_t))==0))
+    {
+      addr=mmap(NULL, sizeof(fake_state_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      if (addr!=MAP_FAILED) fake=(fake_state_t*)addr;
+    }
+    if (fd>=0) close(fd);
+    if (fake==NULL)
+    {
+      fprintf(stderr, "fake_state error: can't map '%s', using memory\n", path);
+    }
+  }
+  if (fake==NULL)
+  {
+    fake=(fake_state_t*)malloc(sizeof(fake_state_t));
+    fake->magic=0;
+  }
+  if (fake->magic!=FAKE_STATE_MAGIC) fake_reset();
+  env=getenv("WAVEMINER_SIM");
+  if (env && (dspsim_init(env)==0)) fake_dsp_probe=dspsim_probe;
+  return(fake);
+}
+
+int fake_sleep(unsigned long long ns)
+{
+  if (fake==NULL) return(0); // the fake bus is not in use
+  return(dspsim_sleep(ns));
+}
+
+// ************* ADAU1401 *************
+
+// bytes per word at a subaddress. The data capture registers
+// take a 2-byte node address, but read back a 3-byte value
+static const unsigned char reg_size[FAKE_NUM_REGS] = {
+  4, 4, 4, 4, 4, 4, 4, 4,  // 0x0800 interface registers
+  2, 2, 2, 2, 2, 2, 2, 2,  // 0x0808 GPIO and auxiliary ADC
+  5, 5, 5, 5, 5,           // 0x0810 safeload data
+  2, 2, 2, 2, 2,           // 0x0815 safeload address
+  2, 2,                    // 0x081a data capture
+  2, 1, 2, 1,              // 0x081c core, 0x081d reserved, serial output and input
+  3, 3,                    // 0x0820 multipurpose pin configuration
+  2, 2, 2, 2, 2, 2         // 0x0822 auxiliary ADC, oscillator and so on
+};
+
+static int dsp_word_size(unsigned int addr, int is_read)
+{
+  if (addr<FAKE_PROG_BASE) return(4);
+  if (addr<FAKE_REG_BASE) return(5);
+  if (is_read && ((addr==FAKE_READBACK0) || (addr==FAKE_READBACK0+1))) return(3);
+  if (addr<FAKE_REG_BASE+FAKE_NUM_REGS) return(reg_size[addr-FAKE_REG_BASE]);
+  return(1);
+}
+
+static unsigned char* dsp_word(unsigned int addr)
+{
+  if (addr<FAKE_PROG_BASE) return(fake->param[addr]);
+  if (addr<FAKE_REG_BASE) return(fake->prog[addr-FAKE_PROG_BASE]);
+  if (addr<FAKE_REG_BASE+FAKE_NUM_REGS) return(fake->reg[addr-FAKE_REG_BASE]);
+  return(NULL);
+}
+
+static unsigned int reg16(unsigned int addr)
+{
+  unsigned char* r=fake->reg[addr-FAKE_REG_BASE];
+  return((r[0]<<8) | r[1]);
+}
+
+// the core copies each loaded safeload slot into parameter RAM
+static void dsp_safeload(void)
+{
+  int i;
+  unsigned int target;
+  for (i=0; i<FAKE_SAFE_SLOTS; i++)
+  {
+    if (!fake->safe_pending[i]) continue;
+    target=reg16(FAKE_SAFE_ADDR0+i);
+    if (target<FAKE_PARAM_WORDS)
+    {
+      memcpy(fake->param[target], &fake->reg[FAKE_SAFE_DATA0-FAKE_REG_BASE+i][1], 4);
+    }
+    fake->safe_pending[i]=0;
+  }
+}
+
+static int dsp_write(const unsigned char* buf, unsigned int len)
+{
+  unsigned int addr;
+  unsigned int i=2;
+  unsigned char* w;
+  int n;
+
+  if (len<2) return(0); // address-only probe
+  addr=(buf[0]<<8) | buf[1];
+  fake->dsp_ptr=addr;
+  while (i<len)
+  {
+    n=dsp_word_size(addr, 0);
+    w=dsp_word(addr);
+    if ((w==NULL) || (i+n>len)) return(-1); // no such register, or a partial word
+    memcpy(w, &buf[i], n);
+    if ((addr>=FAKE_SAFE_DATA0) && (addr<FAKE_SAFE_ADDR0))
+    {
+      fake->safe_pending[addr-FAKE_SAFE_DATA0]=1;
+    }
+    if ((addr==FAKE_CORE_CTRL) && (reg16(addr) & FAKE_CORE_IST))
+    {
+      dsp_safeload();
+    }
+    i+=n;
+    addr++;
+  }
+  return(0);
+}
+
+static int dsp_read(unsigned char* buf, unsigned int len)
+{
+  unsigned int addr=fake->dsp_ptr;
+  unsigned int i=0;
+  unsigned char* w;
+  unsigned char v[3];
+  int n;
+
+  while (i<len)
+  {
+    n=dsp_word_size(addr, 1);
+    if (n==3)
+    {
+      // 5.19 format, as dsp_5_19_format_to_double expects
+      fixed_5_19::encode(fake_dsp_probe(reg16(addr)), v);
+      memcpy(&buf[i], v, (i+n>len) ? len-i : n);
+    }
+    else
+    {
+      w=dsp_word(addr);
+      if (w==NULL) return(-1);
+      memcpy(&buf[i], w, (i+n>len) ? len-i : n);
+    }
+    i+=n;
+    addr++;
+  }
+  return(0);
+}
+
+// ************* 24xx256 EEPROM *************
+
+// the EEPROM does not ACK anything during its write cycle
+static int ee_busy(void)
+{
+  if (fake->ee_busy_until==0) return(0);
+  if (now_ns()<fake->ee_busy_until) return(1);
+  fake->ee_busy_until=0;
+  return(0);
+}
+
+static int ee_write(const unsigned char* buf, unsigned int len)
+{
+  unsigned int page;
+  unsigned int i;
+
+  if (ee_busy()) return(-1);
+  if (len<2) return(0);
+  fake->ee_ptr=((buf[0]<<8) | buf[1]) % FAKE_EE_SIZE;
+  if (len==2) return(0); // just sets the address, no write cycle
+  // data wraps around within the page
+  page=fake->ee_ptr & ~(FAKE_EE_PAGE-1);
+  for (i=2; i<len; i++)
+  {
+    fake->ee[fake->ee_ptr]=buf[i];
+    fake->ee_ptr=page | ((fake->ee_ptr+1) & (FAKE_EE_PAGE-1));
+  }
+  if (ee_twr_ns) fake->ee_busy_until=now_ns()+ee_twr_ns;
+  return(0);
+}
+
+static int ee_read(unsigned char* buf, unsigned int len)
+{
+  unsigned int i;
+
+  if (ee_busy()) return(-1);
+  for (i=0; i<len; i++)
+  {
+    buf[i]=fake->ee[fake->ee_ptr];
+    fake->ee_ptr=(fake->ee_ptr+1) % FAKE_EE_SIZE;
+  }
+  return(0);
+}
+
+// ************* bus *************
+
+int fake_bus_xfer(struct i2c_msg* msg)
+{
+  int ret=-1;
+
+  fake_state();
+  switch (msg->addr)
+  {
+    case FAKE_DSP_ADDR:
+      ret=(msg->flags & I2C_M_RD) ? dsp_read(msg->buf, msg->len) : dsp_write(msg->buf, msg->len);
+      break;
+    case FAKE_EE_ADDR:
+      ret=(msg->flags & I2C_M_RD) ? ee_read(msg->buf, msg->len) : ee_write(msg->buf, msg->len);
+      break;
+    default:
+      break;
+  }
+  if (ret<0)
+  {
+    errno=EREMOTEIO;
+    return(-1);
+  }
+  return(0);
+}
+
+// wait until a transaction that started at t_start would have finished on a real
+// bus: the per-transaction latency, then 9 clocks per byte (8 data bits and the ACK)
+// plus about 2 for each start or repeated start, and 1 for the stop
+static void bus_wait(unsigned long long t_start, struct i2c_msg* msgs, int nmsgs, int ndone)
+{
+  unsigned long long bits=1;
+  unsigned long long t_end;
+  struct timespec a;
+  int i;
+
+  for (i=0; i<nmsgs; i++)
+  {
+    if (i<ndone)
+    {
+      bits+=2+9*(1+msgs[i].len); // address byte and data
+    }
+    else if (i==ndone)
+    {
+      bits+=2+9; // the address byte that was not ACKed
+    }
+  }
+  t_end=t_start+latency_ns;
+  if (bus_clock_hz) t_end+=(bits*1000000000ULL)/bus_clock_hz;
+  // sleep for most of a long wait, and spin for the rest
+  if (t_end>now_ns()+200000ULL)
+  {
+    a.tv_sec=0;
+    a.tv_nsec=(long)(t_end-now_ns()-100000ULL);
+    if (a.tv_nsec>=1000000000L)
+    {
+      a.tv_sec=a.tv_nsec/1000000000L;
+      a.tv_nsec%=1000000000L;
+    }
+    nanosleep(&a, NULL);
+  }
+  while (now_ns()<t_end);
+}
+
+int fake_bus_transfer(struct i2c_msg* msgs, int nmsgs)
+{
+  unsigned long long t_start=now_ns();
+  int i;
+
+  fake_state();
+  for (i=0; i<nmsgs; i++)
+  {
+    if ((fake_bus_xfer(&msgs[i])<0) && !(msgs[i].flags & I2C_M_IGNORE_NAK)) break;
+  }
+  if (latency_ns || bus_clock_hz) bus_wait(t_start, msgs, nmsgs, i);
+  if (i<nmsgs)
+  {
+    errno=EREMOTEIO; // bus_wait may have changed it
+    return(-1);
+  }
+  return(nmsgs);
+}
+
+// ************* transport *************
+
+static unsigned char fake_slave[FAKE_MAX_HANDLES];
+static char fake_used[FAKE_MAX_HANDLES];
+
+static int fake_handle_addr(int handle)
+{
+  int i=handle-FAKE_HANDLE_BASE;
+  if ((i<0) || (i>=FAKE_MAX_HANDLES) || !fake_used[i])
+  {
+    errno=EBADF;
+    return(-1);
+  }
+  return(fake_slave[i]);
+}
+
+static int fake_open(i2c_transport_t* tp, unsigned char bus, unsigned char addr)
+{
+  int i;
+  fake_state();
+  for (i=0; i<FAKE_MAX_HANDLES; i++)
+  {
+    if (!fake_used[i])
+    {
+      fake_used[i]=1;
+      fake_slave[i]=addr;
+      return(FAKE_HANDLE_BASE+i);
+    }
+  }
+  errno=EMFILE;
+  return(-1);
+}
+
+static int fake_close(i2c_transport_t* tp, int handle)
+{
+  if (fake_handle_addr(handle)<0) return(-1);
+  fake_used[handle-FAKE_HANDLE_BASE]=0;
+  return(0);
+}
+
+static int fake_rw(int handle, unsigned char* buf, unsigned int length, int flags)
+{
+  struct i2c_msg msg;
+  int addr=fake_handle_addr(handle);
+  if (addr<0) return(-1);
+  msg.addr=addr;
+  msg.flags=flags;
+  msg.len=length;
+  msg.buf=buf;
+  if (fake_bus_transfer(&msg, 1)<0) return(-1);
+  return(length);
+}
+
+static int fake_write(i2c_transport_t* tp, int handle, const unsigned char* buf, unsigned int length)
+{
+  return(fake_rw(handle, (unsigned char*)buf, length, 0));
+}
+
+static int fake_read(i2c_transport_t* tp, int handle, unsigned char* buf, unsigned int length)
+{
+  return(fake_rw(handle, buf, length, I2C_M_RD));
+}
+
+static int fake_rdwr(i2c_transport_t* tp, int handle, struct i2c_msg* msgs, int nmsgs)
+{
+  if (fake_handle_addr(handle)<0) return(-1);
+  return(fake_bus_transfer(msgs, nmsgs));
+}
+
+i2c_transport_t i2c_fake_transport = {
+  "fake", fake_open, fake_close, fake_write, fake_read, fake_rdwr, NULL, NULL
+};
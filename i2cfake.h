@@ -0,0 +1,86 @@
+/************************************
+ * i2cfake.h
+ * in-memory models of the devices on
+ * the Wave Miner I2C bus, used by the
+ * "fake" transport (see i2cfunc.h)
+ *
+ * rev 1 october 2026
+ ************************************/
+
+#ifndef __I2CFAKE_HEADER_FILE__
+#define __I2CFAKE_HEADER_FILE__
+
+#include <stdint.h>
+#include <linux/i2c.h>
+
+#define FAKE_DSP_ADDR 0x34
+#define FAKE_EE_ADDR 0x50
+
+// ADAU1401 memory map
+#define FAKE_PARAM_WORDS 1024  // 0x0000-0x03ff, 4 bytes per word
+#define FAKE_PROG_BASE 0x0400
+#define FAKE_PROG_WORDS 1024   // 0x0400-0x07ff, 5 bytes per word
+#define FAKE_REG_BASE 0x0800
+#define FAKE_NUM_REGS 0x28     // 0x0800-0x0827, up to 5 bytes each
+#define FAKE_SAFE_DATA0 0x0810
+#define FAKE_SAFE_ADDR0 0x0815
+#define FAKE_SAFE_SLOTS 5
+#define FAKE_READBACK0 0x081a  // and 0x081b
+#define FAKE_CORE_CTRL 0x081c
+#define FAKE_CORE_IST 0x0020   // initiate safeload transfer
+
+// 24xx256 EEPROM
+#define FAKE_EE_SIZE 32768
+#define FAKE_EE_PAGE 64
+#define FAKE_EE_TWR_US 5000    // write cycle time, override with WAVEMINER_FAKE_EE_TWR_US
+
+#define FAKE_STATE_MAGIC 0x57464b31 // "WFK1"
+#define FAKE_MAX_HANDLES 16
+#define FAKE_HANDLE_BASE 1000  // fake handles can't be confused with real descriptors
+
+// The state of both devices. It normally lives in memory for the life of the
+// process, but if WAVEMINER_FAKE_STATE names a file the state is mapped from
+// there instead, so that (for example) an app loaded by eeload is still in the
+// fake DSP when dspgen runs next
+typedef struct {
+  uint32_t magic;
+  unsigned char param[FAKE_PARAM_WORDS][4];
+  unsigned char prog[FAKE_PROG_WORDS][5];
+  unsigned char reg[FAKE_NUM_REGS][5];
+  unsigned char safe_pending[FAKE_SAFE_SLOTS];
+  unsigned int dsp_ptr;   // subaddress for the next read
+  unsigned char ee[FAKE_EE_SIZE];
+  unsigned int ee_ptr;
+  unsigned long long ee_busy_until; // monotonic_ns() time the write cycle ends
+} fake_state_t;
+
+// returns the device state, creating it on first use
+fake_state_t* fake_state(void);
+// sets both devices back to their power-up state
+void fake_reset(void);
+
+// Called in place of a sleep. If the audio path model is on (see dspsim.h) time
+// is virtual, so the model is run for ns nanoseconds and 1 is returned.
+// Otherwise returns 0, and the caller should sleep as usual
+int fake_sleep(unsigned long long ns);
+
+// Value seen by the DSP readback (data capture) registers for a node. The
+// default returns 0; a signal model (for instance dspsim) can replace it
+extern double (*fake_dsp_probe)(int node);
+
+// Performs one I2C message (write, or read if I2C_M_RD is set) on the fake bus.
+// Returns 0, or -1 with errno set to EREMOTEIO if the device does not ACK
+int fake_bus_xfer(struct i2c_msg* msg);
+
+// Performs a combined transaction (messages separated by repeated starts),
+// stopping at the first message that is not ACKed unless it has I2C_M_IGNORE_NAK.
+// The call takes as long as the transaction would on a real bus, set by
+// WAVEMINER_FAKE_LATENCY_US (a fixed time per transaction, default 0) and
+// WAVEMINER_FAKE_CLOCK_HZ (the bus clock, default 0 for no byte time).
+// Returns nmsgs, or -1 with errno set to EREMOTEIO
+int fake_bus_transfer(struct i2c_msg* msgs, int nmsgs);
+
+// transport using the models above
+extern struct i2c_transport i2c_fake_transport;
+
+#endif // __I2CFAKE_HEADER_FILE__
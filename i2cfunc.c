@@ -15,7 +15,11 @@
 #include <unistd.h>
 #include <stdint.h>
 #include <sys/mman.h>
+#include <stdlib.h>
 #include "i2cfunc.h"
+#include "i2cfake.h"
+#include "stats.h"
+#include "timeline.h"
 
 typedef struct {
   uint32_t C;
@@ -54,19 +58,486 @@ int i2c_set_timeout(int val)
   return(0);
 }
 
-int i2c_open(unsigned char bus, unsigned char addr)
+// ************* i2c-dev transport *************
+
+static int dev_open(i2c_transport_t* tp, unsigned char bus, unsigned char addr)
 {
   int file;
   char filename[16];
   sprintf(filename,"/dev/i2c-%d", bus);
   if ((file = open(filename,O_RDWR)) < 0)
   {
-    fprintf(stderr, "i2c_open open error: %s\n", strerror(errno));
     return(file);
   }
   if (ioctl(file,I2C_SLAVE,addr) < 0)
   {
-    fprintf(stderr, "i2c_open ioctl error: %s\n", strerror(errno));
+    close(file);
+    return(-1);
+  }
+  return(file);
+}
+
+static int dev_close(i2c_transport_t* tp, int handle)
+{
+  return(close(handle));
+}
+
+static int dev_write(i2c_transport_t* tp, int handle, const unsigned char* buf, unsigned int length)
+{
+  return(write(handle, buf, length));
+}
+
+static int dev_read(i2c_transport_t* tp, int handle, unsigned char* buf, unsigned int length)
+{
+  return(read(handle, buf, length));
+}
+
+static int dev_rdwr(i2c_transport_t* tp, int handle, struct i2c_msg* msgs, int nmsgs)
+{
+  struct i2c_rdwr_ioctl_data msgset;
+  msgset.nmsgs=nmsgs;
+  msgset.msgs=msgs;
+  return(ioctl(handle,I2C_RDWR,(unsigned long)&msgset));
+}
+
+i2c_transport_t i2c_dev_transport = {
+  "dev", dev_open, dev_close, dev_write, dev_read, dev_rdwr, NULL, NULL
+};
+
+// ************* null transport *************
+
+// accepts everything and sends nothing, reads return zeros. For measuring
+// the CPU cost of the code above the bus (see dspbench.cpp)
+static int null_open(i2c_transport_t* tp, unsigned char bus, unsigned char addr)
+{
+  return(2000);
+}
+
+static int null_close(i2c_transport_t* tp, int handle)
+{
+  return(0);
+}
+
+static int null_write(i2c_transport_t* tp, int handle, const unsigned char* buf, unsigned int length)
+{
+  return(length);
+}
+
+static int null_read(i2c_transport_t* tp, int handle, unsigned char* buf, unsigned int length)
+{
+  memset(buf, 0, length);
+  return(length);
+}
+
+static int null_rdwr(i2c_transport_t* tp, int handle, struct i2c_msg* msgs, int nmsgs)
+{
+  int i;
+  for (i=0; i<nmsgs; i++)
+  {
+    if (msgs[i].flags & I2C_M_RD) memset(msgs[i].buf, 0, msgs[i].len);
+  }
+  return(nmsgs);
+}
+
+i2c_transport_t i2c_null_transport = {
+  "null", null_open, null_close, null_write, null_read, null_rdwr, NULL, NULL
+};
+
+// ************* counting decorator *************
+
+i2c_stats_t i2c_stats;
+
+static void count_op(i2c_transport_t* tp, int op, int ret, unsigned long long bytes, unsigned long long t_start)
+{
+  i2c_stats_t* st=(i2c_stats_t*)tp->priv;
+  st->ns[op]+=monotonic_ns()-t_start;
+  st->count[op]++;
+  if (ret<0)
+  {
+    st->errors[op]++;
+  }
+  else
+  {
+    st->bytes[op]+=bytes;
+  }
+}
+
+static int count_open(i2c_transport_t* tp, unsigned char bus, unsigned char addr)
+{
+  return(tp->inner->open(tp->inner, bus, addr));
+}
+
+static int count_close(i2c_transport_t* tp, int handle)
+{
+  return(tp->inner->close(tp->inner, handle));
+}
+
+static int count_write(i2c_transport_t* tp, int handle, const unsigned char* buf, unsigned int length)
+{
+  unsigned long long t=monotonic_ns();
+  int ret=tp->inner->write(tp->inner, handle, buf, length);
+  count_op(tp, I2C_OP_WRITE, ret, length, t);
+  return(ret);
+}
+
+static int count_read(i2c_transport_t* tp, int handle, unsigned char* buf, unsigned int length)
+{
+  unsigned long long t=monotonic_ns();
+  int ret=tp->inner->read(tp->inner, handle, buf, length);
+  count_op(tp, I2C_OP_READ, ret, length, t);
+  return(ret);
+}
+
+static int count_rdwr(i2c_transport_t* tp, int handle, struct i2c_msg* msgs, int nmsgs)
+{
+  unsigned long long t=monotonic_ns();
+  unsigned long long bytes=0;
+  int i, ret;
+  ret=tp->inner->rdwr(tp->inner, handle, msgs, nmsgs);
+  for (i=0; i<nmsgs; i++)
+  {
+    bytes+=msgs[i].len;
+  }
+  count_op(tp, I2C_OP_RDWR, ret, bytes, t);
+  return(ret);
+}
+
+i2c_transport_t* i2c_count_transport(i2c_transport_t* tp, i2c_stats_t* stats)
+{
+  i2c_transport_t* c=(i2c_transport_t*)malloc(sizeof(i2c_transport_t));
+  if (c==NULL) return(tp);
+  c->name="count";
+  c->open=count_open;
+  c->close=count_close;
+  c->write=count_write;
+  c->read=count_read;
+  c->rdwr=count_rdwr;
+  c->inner=tp;
+  c->priv=stats;
+  return(c);
+}
+
+static void print_stats(void)
+{
+  const char* op_name[I2C_NUM_OPS]={"write", "read", "rdwr"};
+  int op;
+  for (op=0; op<I2C_NUM_OPS; op++)
+  {
+    if (i2c_stats.count[op]==0) continue;
+    fprintf(stderr, "i2c %-5s: %llu calls, %llu bytes, %llu errors, %llu usec total, %.1f usec/call\n",
+            op_name[op], i2c_stats.count[op], i2c_stats.bytes[op], i2c_stats.errors[op],
+            i2c_stats.ns[op]/1000, (double)i2c_stats.ns[op]/1000.0/i2c_stats.count[op]);
+  }
+}
+
+// ************* trace recorder *************
+
+static FILE* trace_fp=NULL;
+static unsigned long long trace_t0;
+
+static void trace_finish(void)
+{
+  if (trace_fp) fclose(trace_fp);
+  trace_fp=NULL;
+}
+
+static void trace_rec(i2c_transport_t* tp, int op, int handle, int result,
+                      unsigned long long t_start, struct i2c_msg* msgs, int nmsgs)
+{
+  FILE* fp=(FILE*)tp->priv;
+  unsigned long long t_end=monotonic_ns();
+  i2c_trace_rec_t r;
+  i2c_trace_msg_t m;
+  int i;
+
+  r.op=op;
+  r.nmsgs=nmsgs;
+  r.reserved=0;
+  r.handle=handle;
+  r.result=(result<0) ? -errno : result;
+  r.t_ns=t_start-trace_t0;
+  r.dur_ns=(uint32_t)(t_end-t_start);
+  fwrite(&r, sizeof(r), 1, fp);
+  for (i=0; i<nmsgs; i++)
+  {
+    m.addr=msgs[i].addr;
+    m.flags=msgs[i].flags;
+    m.len=msgs[i].len;
+    fwrite(&m, sizeof(m), 1, fp);
+    fwrite(msgs[i].buf, 1, msgs[i].len, fp);
+  }
+}
+
+// sleeps are recorded too, since they are part of the workload. The result
+// is the time that really passed, which is 0 for a simulated sleep
+static void trace_sleep(unsigned long long t_start, unsigned long long ns)
+{
+  i2c_trace_rec_t r;
+  if (trace_fp==NULL) return;
+  r.op=I2C_TRACE_SLEEP;
+  r.nmsgs=0;
+  r.reserved=0;
+  r.handle=-1;
+  r.result=(int32_t)(monotonic_ns()-t_start);
+  r.t_ns=t_start-trace_t0;
+  r.dur_ns=(uint32_t)ns;
+  fwrite(&r, sizeof(r), 1, trace_fp);
+}
+
+// write or read on a handle is stored as a single message
+static void trace_rw(i2c_transport_t* tp, int op, int handle, int result,
+                     unsigned long long t_start, const unsigned char* buf, unsigned int length)
+{
+  struct i2c_msg msg;
+  msg.addr=I2C_TRACE_NO_ADDR;
+  msg.flags=(op==I2C_OP_READ) ? I2C_M_RD : 0;
+  msg.len=length;
+  msg.buf=(unsigned char*)buf;
+  trace_rec(tp, op, handle, result, t_start, &msg, 1);
+}
+
+static int trace_open(i2c_transport_t* tp, unsigned char bus, unsigned char addr)
+{
+  unsigned long long t=monotonic_ns();
+  struct i2c_msg msg;
+  int ret=tp->inner->open(tp->inner, bus, addr);
+  int err=errno;
+  msg.addr=addr;
+  msg.flags=bus;
+  msg.len=0;
+  msg.buf=NULL;
+  trace_rec(tp, I2C_TRACE_OPEN, ret, ret, t, &msg, 1);
+  errno=err;
+  return(ret);
+}
+
+static int trace_close(i2c_transport_t* tp, int handle)
+{
+  unsigned long long t=monotonic_ns();
+  int ret=tp->inner->close(tp->inner, handle);
+  int err=errno;
+  trace_rec(tp, I2C_TRACE_CLOSE, handle, ret, t, NULL, 0);
+  errno=err;
+  return(ret);
+}
+
+static int trace_write(i2c_transport_t* tp, int handle, const unsigned char* buf, unsigned int length)
+{
+  unsigned long long t=monotonic_ns();
+  int ret=tp->inner->write(tp->inner, handle, buf, length);
+  int err=errno;
+  trace_rw(tp, I2C_OP_WRITE, handle, ret, t, buf, length);
+  errno=err;
+  return(ret);
+}
+
+static int trace_read(i2c_transport_t* tp, int handle, unsigned char* buf, unsigned int length)
+{
+  unsigned long long t=monotonic_ns();
+  int ret=tp->inner->read(tp->inner, handle, buf, length);
+  int err=errno;
+  trace_rw(tp, I2C_OP_READ, handle, ret, t, buf, length);
+  errno=err;
+  return(ret);
+}
+
+static int trace_rdwr(i2c_transport_t* tp, int handle, struct i2c_msg* msgs, int nmsgs)
+{
+  unsigned long long t=monotonic_ns();
+  int ret=tp->inner->rdwr(tp->inner, handle, msgs, nmsgs);
+  int err=errno;
+  trace_rec(tp, I2C_OP_RDWR, handle, ret, t, msgs, nmsgs);
+  errno=err;
+  return(ret);
+}
+
+i2c_transport_t* i2c_trace_transport(i2c_transport_t* tp, const char* path)
+{
+  i2c_transport_t* c;
+  i2c_trace_hdr_t h;
+  FILE* fp=fopen(path, "wb");
+
+  if (fp==NULL)
+  {
+    fprintf(stderr, "i2c_trace_transport error: %s\n", strerror(errno));
+    return(tp);
+  }
+  c=(i2c_transport_t*)malloc(sizeof(i2c_transport_t));
+  if (c==NULL)
+  {
+    fclose(fp);
+    return(tp);
+  }
+  trace_t0=monotonic_ns();
+  h.magic=I2C_TRACE_MAGIC;
+  h.version=I2C_TRACE_VERSION;
+  h.reserved=0;
+  h.t0_ns=trace_t0;
+  fwrite(&h, sizeof(h), 1, fp);
+  c->name="trace";
+  c->open=trace_open;
+  c->close=trace_close;
+  c->write=trace_write;
+  c->read=trace_read;
+  c->rdwr=trace_rdwr;
+  c->inner=tp;
+  c->priv=fp;
+  trace_fp=fp;
+  atexit(trace_finish);
+  return(c);
+}
+
+// ************* timeline decorator *************
+
+// one span per transport call, see timeline.h. The wrappers below keep the
+// inner call's errno across it, as timeline_span() writes to a file
+static void timeline_op(const char* name, int handle, int addr, int ret, unsigned int bytes,
+                        int nmsgs, unsigned long long t_start)
+{
+  char args[128];
+  int n=snprintf(args, sizeof(args), "\"handle\": %d, ", handle);
+  if (addr>=0) n+=snprintf(&args[n], sizeof(args)-n, "\"addr\": \"0x%02x\", ", addr);
+  snprintf(&args[n], sizeof(args)-n, "\"msgs\": %d, \"bytes\": %u, \"result\": %d", nmsgs, bytes, ret);
+  timeline_span(name, TIMELINE_I2C, t_start, args);
+}
+
+static int timeline_open(i2c_transport_t* tp, unsigned char bus, unsigned char addr)
+{
+  unsigned long long t=monotonic_ns();
+  int ret=tp->inner->open(tp->inner, bus, addr);
+  int err=errno;
+  timeline_op("i2c_open", ret, addr, ret, 0, 0, t);
+  errno=err;
+  return(ret);
+}
+
+static int timeline_close(i2c_transport_t* tp, int handle)
+{
+  return(tp->inner->close(tp->inner, handle));
+}
+
+static int timeline_write(i2c_transport_t* tp, int handle, const unsigned char* buf, unsigned int length)
+{
+  unsigned long long t=monotonic_ns();
+  int ret=tp->inner->write(tp->inner, handle, buf, length);
+  int err=errno;
+  timeline_op("write", handle, -1, ret, length, 1, t);
+  errno=err;
+  return(ret);
+}
+
+static int timeline_read(i2c_transport_t* tp, int handle, unsigned char* buf, unsigned int length)
+{
+  unsigned long long t=monotonic_ns();
+  int ret=tp->inner->read(tp->inner, handle, buf, length);
+  int err=errno;
+  timeline_op("read", handle, -1, ret, length, 1, t);
+  errno=err;
+  return(ret);
+}
+
+static int timeline_rdwr(i2c_transport_t* tp, int handle, struct i2c_msg* msgs, int nmsgs)
+{
+  unsigned long long t=monotonic_ns();
+  unsigned int bytes=0;
+  int i, ret, err;
+  ret=tp->inner->rdwr(tp->inner, handle, msgs, nmsgs);
+  err=errno;
+  for (i=0; i<nmsgs; i++)
+  {
+    bytes+=msgs[i].len;
+  }
+  timeline_op("rdwr", handle, (nmsgs>0) ? msgs[0].addr : -1, ret, bytes, nmsgs, t);
+  errno=err;
+  return(ret);
+}
+
+i2c_transport_t* i2c_timeline_transport(i2c_transport_t* tp)
+{
+  i2c_transport_t* c=(i2c_transport_t*)malloc(sizeof(i2c_transport_t));
+  if (c==NULL) return(tp);
+  c->name="timeline";
+  c->open=timeline_open;
+  c->close=timeline_close;
+  c->write=timeline_write;
+  c->read=timeline_read;
+  c->rdwr=timeline_rdwr;
+  c->inner=tp;
+  c->priv=NULL;
+  return(c);
+}
+
+// ************* transport selection *************
+
+static i2c_transport_t* i2c_tp=NULL;
+
+i2c_transport_t* i2c_transport(void)
+{
+  const char* name;
+  char do_count=0;
+
+  if (i2c_tp) return(i2c_tp);
+  name=getenv("WAVEMINER_I2C");
+  if (name==NULL) name="dev";
+  if (strncmp(name, "count:", 6)==0)
+  {
+    do_count=1;
+    name+=6;
+  }
+  if (strcmp(name, "fake")==0)
+  {
+    i2c_tp=&i2c_fake_transport;
+  }
+  else if (strcmp(name, "null")==0)
+  {
+    i2c_tp=&i2c_null_transport;
+  }
+  else
+  {
+    if (strcmp(name, "dev")!=0)
+    {
+      fprintf(stderr, "unknown WAVEMINER_I2C transport '%s', using dev\n", name);
+    }
+    i2c_tp=&i2c_dev_transport;
+  }
+  if (do_count)
+  {
+    i2c_tp=i2c_count_transport(i2c_tp, &i2c_stats);
+    atexit(print_stats);
+  }
+  name=getenv("WAVEMINER_I2C_TRACE");
+  if (name)
+  {
+    i2c_tp=i2c_trace_transport(i2c_tp, name);
+  }
+  if (timeline_init())
+  {
+    i2c_tp=i2c_timeline_transport(i2c_tp);
+  }
+  return(i2c_tp);
+}
+
+void i2c_set_transport(i2c_transport_t* tp)
+{
+  i2c_tp=tp;
+}
+
+int i2c_transport_is_dev(void)
+{
+  i2c_transport_t* tp=i2c_transport();
+  while (tp->inner) tp=tp->inner;
+  return(tp==&i2c_dev_transport);
+}
+
+// ************* I2C functions *************
+
+int i2c_open(unsigned char bus, unsigned char addr)
+{
+  i2c_transport_t* tp=i2c_transport();
+  int file;
+  if ((file = tp->open(tp, bus, addr)) < 0)
+  {
+    fprintf(stderr, "i2c_open error: %s\n", strerror(errno));
     return(-1);
   }
   return(file);
@@ -74,19 +545,40 @@ int i2c_open(unsigned char bus, unsigned char addr)
 
 int i2c_write(int handle, unsigned char* buf, unsigned int length)
 {
+  i2c_transport_t* tp=i2c_transport();
   int ret;
-  ret = write(handle, buf, length);
+  unsigned long long t=stats_on ? monotonic_ns() : 0;
+  ret = tp->write(tp, handle, buf, length);
   if (ret != (int)length)
   {
+    if (stats_on) stats_io(-1, 0, 0, errno);
     fprintf(stderr, "i2c_write error%d: %s\n", errno, strerror(errno));
     return(-1);
   }
+  if (stats_on)
+  {
+    stats_record_since(STATS_I2C_WRITE, t);
+    stats_io(length, length, 0, 0);
+  }
+  return(length);
+}
+
+int i2c_write_quiet(int handle, unsigned char* buf, unsigned int length)
+{
+  i2c_transport_t* tp=i2c_transport();
+  if (tp->write(tp, handle, buf, length) != (int)length)
+  {
+    return(-1);
+  }
   return(length);
 }
 
 int i2c_write_byte(int handle, unsigned char val)
 {
-  if (write(handle, &val, 1) != 1)
+  i2c_transport_t* tp=i2c_transport();
+  int ret=tp->write(tp, handle, &val, 1);
+  if (stats_on) stats_io((ret==1) ? 1 : -1, 1, 0, errno);
+  if (ret != 1)
   {
     fprintf(stderr, "i2c_write_byte error: %s\n", strerror(errno));
     return(-1);
@@ -96,17 +588,28 @@ int i2c_write_byte(int handle, unsigned char val)
 
 int i2c_read(int handle, unsigned char* buf, unsigned int length)
 {
-  if (read(handle, buf, length) != (int)length)
+  i2c_transport_t* tp=i2c_transport();
+  unsigned long long t=stats_on ? monotonic_ns() : 0;
+  if (tp->read(tp, handle, buf, length) != (int)length)
   {
+    if (stats_on) stats_io(-1, 0, 0, errno);
     fprintf(stderr, "i2c_read error: %s\n", strerror(errno));
     return(-1);
   }
+  if (stats_on)
+  {
+    stats_record_since(STATS_I2C_READ, t);
+    stats_io(length, 0, length, 0);
+  }
   return(length);
 }
 
 int i2c_read_byte(int handle, unsigned char* val)
 {
-  if (read(handle, val, 1) != 1)
+  i2c_transport_t* tp=i2c_transport();
+  int ret=tp->read(tp, handle, val, 1);
+  if (stats_on) stats_io((ret==1) ? 1 : -1, 0, 1, errno);
+  if (ret != 1)
   {
     fprintf(stderr, "i2c_read_byte error: %s\n", strerror(errno));
     return(-1);
@@ -116,7 +619,8 @@ int i2c_read_byte(int handle, unsigned char* val)
 
 int i2c_close(int handle)
 {
-  if ((close(handle)) != 0)
+  i2c_transport_t* tp=i2c_transport();
+  if ((tp->close(tp, handle)) != 0)
   {
     fprintf(stderr, "i2c_close error: %s\n", strerror(errno));
     return(-1);
@@ -128,7 +632,7 @@ int i2c_write_read(int handle,
                    unsigned char addr_w, unsigned char *buf_w, unsigned int len_w,
                    unsigned char addr_r, unsigned char *buf_r, unsigned int len_r)
 {
-	struct i2c_rdwr_ioctl_data msgset;
+	i2c_transport_t* tp=i2c_transport();
 	struct i2c_msg msgs[2];
 	
 	msgs[0].addr=addr_w;
@@ -141,21 +645,25 @@ int i2c_write_read(int handle,
 	msgs[1].flags=1;
 	msgs[1].buf=buf_r;
 	
-	msgset.nmsgs=2;
-	msgset.msgs=msgs;
-	
-	if (ioctl(handle,I2C_RDWR,(unsigned long)&msgset)<0)
+	unsigned long long t=stats_on ? monotonic_ns() : 0;
+	if (tp->rdwr(tp, handle, msgs, 2)<0)
   {
+    if (stats_on) stats_io(-1, 0, 0, errno);
 		fprintf(stderr, "i2c_write_read error: %s\n",strerror(errno));
     return -1;
   } 
+  if (stats_on)
+  {
+    stats_record_since(STATS_I2C_WRITE_READ, t);
+    stats_io(len_r, len_w, len_r, 0);
+  }
   return(len_r);
 }
 
 int i2c_write_ignore_nack(int handle,
                           unsigned char addr_w, unsigned char* buf, unsigned int length)
 {
-	struct i2c_rdwr_ioctl_data msgset;
+	i2c_transport_t* tp=i2c_transport();
 	struct i2c_msg msgs[1];
 	
 	msgs[0].addr=addr_w;
@@ -163,21 +671,20 @@ int i2c_write_ignore_nack(int handle,
 	msgs[0].flags=0 | I2C_M_IGNORE_NAK;
 	msgs[0].buf=buf;
 	
-	msgset.nmsgs=1;
-	msgset.msgs=msgs;
-	
-	if (ioctl(handle,I2C_RDWR,(unsigned long)&msgset)<0)
+	if (tp->rdwr(tp, handle, msgs, 1)<0)
   {
+    if (stats_on) stats_io(-1, 0, 0, errno);
 		fprintf(stderr, "i2c_write_ignore_nack error: %s\n",strerror(errno));
     return -1;
   } 
+  if (stats_on) stats_io(length, length, 0, 0);
   return(length);
 }
 
 int i2c_read_no_ack(int handle, 
                     unsigned char addr_r, unsigned char* buf, unsigned int length)
 {
-	struct i2c_rdwr_ioctl_data msgset;
+	i2c_transport_t* tp=i2c_transport();
 	struct i2c_msg msgs[1];
 	
 	msgs[0].addr=addr_r;
@@ -185,31 +692,171 @@ int i2c_read_no_ack(int handle,
 	msgs[0].flags=I2C_M_RD | I2C_M_NO_RD_ACK;
 	msgs[0].buf=buf;
 	
-	msgset.nmsgs=1;
-	msgset.msgs=msgs;
-	
-	if (ioctl(handle,I2C_RDWR,(unsigned long)&msgset)<0)
+	if (tp->rdwr(tp, handle, msgs, 1)<0)
   {
+    if (stats_on) stats_io(-1, 0, 0, errno);
 		fprintf(stderr, "i2c_read_no_ack error: %s\n",strerror(errno));
     return -1;
   } 
+  if (stats_on) stats_io(length, 0, length, 0);
   return(length);
 }
 
+void i2c_trans_init(i2c_transaction_t* t)
+{
+  t->nmsgs=0;
+  t->buf_used=0;
+}
+
+int i2c_trans_write(i2c_transaction_t* t, unsigned char addr, unsigned char* buf, unsigned int length)
+{
+  int idx;
+  if ((t->nmsgs >= I2C_TRANS_MAX_MSGS) || (t->buf_used+length > I2C_TRANS_BUF_SIZE))
+  {
+    return(-1);
+  }
+  idx=t->nmsgs;
+  memcpy(&t->buf[t->buf_used], buf, length);
+  t->msgs[idx].addr=addr;
+  t->msgs[idx].len=length;
+  t->msgs[idx].flags=0;
+  t->msgs[idx].buf=&t->buf[t->buf_used];
+  t->status[idx]=-1;
+  t->buf_used+=length;
+  t->nmsgs++;
+  return(idx);
+}
+
+int i2c_trans_read(i2c_transaction_t* t, unsigned char addr, unsigned char* buf, unsigned int length)
+{
+  int idx;
+  if (t->nmsgs >= I2C_TRANS_MAX_MSGS)
+  {
+    return(-1);
+  }
+  idx=t->nmsgs;
+  t->msgs[idx].addr=addr;
+  t->msgs[idx].len=length;
+  t->msgs[idx].flags=I2C_M_RD;
+  t->msgs[idx].buf=buf;
+  t->status[idx]=-1;
+  t->nmsgs++;
+  return(idx);
+}
+
+int i2c_trans_submit(int handle, i2c_transaction_t* t)
+{
+  i2c_transport_t* tp=i2c_transport();
+  int i, n;
+  int first=0;
+  unsigned int written, read;
+  unsigned long long t_start=0;
+
+  for (i=0; i<t->nmsgs; i++)
+  {
+    t->status[i]=-1;
+  }
+  while (first < t->nmsgs)
+  {
+    n=t->nmsgs-first;
+    if (n > I2C_RDWR_MAX_MSGS) n=I2C_RDWR_MAX_MSGS;
+    if (stats_on) t_start=monotonic_ns();
+    if (tp->rdwr(tp, handle, &t->msgs[first], n)<0)
+    {
+      // the kernel does not say which message failed, so the whole
+      // group is marked as failed, and the rest is not sent
+      if (stats_on) stats_io(-1, 0, 0, errno);
+      fprintf(stderr, "i2c_trans_submit error: %s\n",strerror(errno));
+      return(-1);
+    }
+    written=0;
+    read=0;
+    for (i=first; i<first+n; i++)
+    {
+      t->status[i]=t->msgs[i].len;
+      if (t->msgs[i].flags & I2C_M_RD) read+=t->msgs[i].len; else written+=t->msgs[i].len;
+    }
+    if (stats_on)
+    {
+      stats_record_since(STATS_I2C_TRANS_SUBMIT, t_start);
+      stats_io(n, written, read, 0);
+    }
+    first+=n;
+  }
+  return(0);
+}
+
+unsigned long long i2c_sleep_ns=0;
+unsigned long long i2c_sleep_count=0;
+
+// called at the end of delay_ms and delay_us, which started at t_start
+static void sleep_done(int hist, unsigned long long t_start, unsigned long long ns)
+{
+  char args[32];
+  if (stats_on) stats_record_since(hist, t_start);
+  if (timeline_on)
+  {
+    snprintf(args, sizeof(args), "\"usec\": %llu", ns/1000);
+    timeline_span((hist==STATS_DELAY_MS) ? "delay_ms" : "delay_us", TIMELINE_SLEEP, t_start, args);
+  }
+  i2c_sleep_ns+=monotonic_ns()-t_start;
+  i2c_sleep_count++;
+  trace_sleep(t_start, ns);
+}
+
 int delay_ms(unsigned int msec)
 {
   int ret;
   struct timespec a;
+  unsigned long long t=monotonic_ns();
   if (msec>999)
   {
     fprintf(stderr, "delay_ms error: delay value needs to be less than 999\n");
     msec=999;
   }
+  if (fake_sleep(msec*1000000ULL)) // virtual time, see dspsim.h
+  {
+    sleep_done(STATS_DELAY_MS, t, msec*1000000ULL);
+    return(0);
+  }
   a.tv_nsec=((long)(msec))*1E6d;
   a.tv_sec=0;
   if ((ret = nanosleep(&a, NULL)) != 0)
   {
     fprintf(stderr, "delay_ms error: %s\n", strerror(errno));
   }
+  sleep_done(STATS_DELAY_MS, t, msec*1000000ULL);
+  return(0);
+}
+
+unsigned long long monotonic_ns(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return(((unsigned long long)t.tv_sec)*1000000000ULL + t.tv_nsec);
+}
+
+int delay_us(unsigned int usec)
+{
+  int ret;
+  struct timespec a;
+  unsigned long long t=monotonic_ns();
+  if (usec>999999)
+  {
+    fprintf(stderr, "delay_us error: delay value needs to be less than 999999\n");
+    usec=999999;
+  }
+  if (fake_sleep(usec*1000ULL))
+  {
+    sleep_done(STATS_DELAY_US, t, usec*1000ULL);
+    return(0);
+  }
+  a.tv_nsec=((long)(usec))*1000;
+  a.tv_sec=0;
+  if ((ret = nanosleep(&a, NULL)) != 0)
+  {
+    fprintf(stderr, "delay_us error: %s\n", strerror(errno));
+  }
+  sleep_done(STATS_DELAY_US, t, usec*1000ULL);
   return(0);
 }
@@ -14,6 +14,116 @@
 #define I2C_BASE (PERIPHERAL_BASE + 0x804000)
 // think this offset might need changing for different Pi models. To check!
 
+#include <stdint.h>
+#include <linux/i2c.h>
+
+// batched transactions (see i2c_trans_submit)
+#define I2C_TRANS_MAX_MSGS 128  // messages that can be queued in one transaction
+#define I2C_TRANS_BUF_SIZE 4096 // storage for the queued write data
+#define I2C_RDWR_MAX_MSGS 42    // kernel limit of messages per I2C_RDWR ioctl
+
+typedef struct {
+  int nmsgs;
+  unsigned int buf_used;
+  struct i2c_msg msgs[I2C_TRANS_MAX_MSGS];
+  int status[I2C_TRANS_MAX_MSGS]; // per message after submit: bytes transferred, or -1
+  unsigned char buf[I2C_TRANS_BUF_SIZE];
+} i2c_transaction_t;
+
+// Transports. Every function below goes through the selected transport, so the
+// tools can run against something other than /dev/i2c-N. The transport is
+// chosen on first use from the WAVEMINER_I2C environment variable:
+//   dev   - the Linux i2c-dev driver (the default)
+//   fake  - in-memory ADAU1401 and EEPROM models (see i2cfake.h)
+//   null  - accepts every transaction and does nothing, reads return zeros
+// Prefix the name with "count:" (for example count:fake) to count and time
+// every transaction; the totals are printed on stderr at exit.
+// If WAVEMINER_I2C_TRACE names a file, every transaction is recorded there
+// too (see i2c_trace_rec_t below, and the i2creplay tool). WAVEMINER_TIMELINE
+// does the same as a timeline that can be viewed (see timeline.h).
+// These decorators are only put in front of the transport when they are
+// asked for, so otherwise they cost nothing. The --stats counters (see
+// stats.h) and the timeline spans of the set_* calls, readbacks and delays
+// are in the code everywhere instead, behind the flags stats_on and
+// timeline_on: while a flag is off, an instrumented function only tests it,
+// so the hooks can be left in.
+// The functions follow the system calls they replace: write and read return
+// the byte count and rdwr returns the message count, or -1 with errno set.
+typedef struct i2c_transport {
+  const char* name;
+  int (*open)(struct i2c_transport* tp, unsigned char bus, unsigned char addr);
+  int (*close)(struct i2c_transport* tp, int handle);
+  int (*write)(struct i2c_transport* tp, int handle, const unsigned char* buf, unsigned int length);
+  int (*read)(struct i2c_transport* tp, int handle, unsigned char* buf, unsigned int length);
+  int (*rdwr)(struct i2c_transport* tp, int handle, struct i2c_msg* msgs, int nmsgs);
+  struct i2c_transport* inner; // the transport being decorated, if any
+  void* priv;
+} i2c_transport_t;
+
+// per-operation totals kept by the counting decorator
+#define I2C_OP_WRITE 0
+#define I2C_OP_READ 1
+#define I2C_OP_RDWR 2
+#define I2C_NUM_OPS 3
+typedef struct {
+  unsigned long long count[I2C_NUM_OPS];
+  unsigned long long bytes[I2C_NUM_OPS];
+  unsigned long long errors[I2C_NUM_OPS];
+  unsigned long long ns[I2C_NUM_OPS];
+} i2c_stats_t;
+
+// Trace file: an i2c_trace_hdr_t, then for each transport call an
+// i2c_trace_rec_t followed by nmsgs i2c_trace_msg_t, each followed by its
+// len data bytes (what was written, or what was read). Native byte order.
+#define I2C_TRACE_MAGIC 0x52544d57 // "WMTR"
+#define I2C_TRACE_VERSION 1
+#define I2C_TRACE_OPEN 0x10   // msg addr is the slave address, msg flags the bus
+#define I2C_TRACE_CLOSE 0x11  // no messages
+#define I2C_TRACE_SLEEP 0x12  // delay_ms or delay_us, dur_ns is the time asked for
+#define I2C_TRACE_NO_ADDR 0xffff // write or read on a handle, to its slave address
+
+typedef struct __attribute__((packed)) {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t reserved;
+  uint64_t t0_ns;    // monotonic_ns() when the trace started
+} i2c_trace_hdr_t;
+
+typedef struct __attribute__((packed)) {
+  uint8_t op;        // I2C_OP_WRITE, I2C_OP_READ, I2C_OP_RDWR or I2C_TRACE_*
+  uint8_t nmsgs;
+  uint16_t reserved;
+  int32_t handle;
+  int32_t result;    // return value, or -errno on failure
+  uint64_t t_ns;     // start time, relative to t0_ns
+  uint32_t dur_ns;
+} i2c_trace_rec_t;
+
+typedef struct __attribute__((packed)) {
+  uint16_t addr;
+  uint16_t flags;    // I2C_M_RD and so on
+  uint16_t len;
+} i2c_trace_msg_t;
+
+extern i2c_transport_t i2c_dev_transport;
+extern i2c_transport_t i2c_null_transport;
+// returns the transport in use, selecting it if needed
+i2c_transport_t* i2c_transport(void);
+// replaces the transport, for programs that want to choose it themselves
+void i2c_set_transport(i2c_transport_t* tp);
+// returns 1 if the transport (ignoring decorators) is real hardware
+int i2c_transport_is_dev(void);
+// wraps tp with the counting decorator, which totals into stats
+i2c_transport_t* i2c_count_transport(i2c_transport_t* tp, i2c_stats_t* stats);
+// wraps tp with the trace recorder, writing to the file at path.
+// returns tp unchanged if the file can't be created
+i2c_transport_t* i2c_trace_transport(i2c_transport_t* tp, const char* path);
+// wraps tp with the timeline recorder (see timeline.h), which is added
+// automatically when WAVEMINER_TIMELINE is set
+i2c_transport_t* i2c_timeline_transport(i2c_transport_t* tp);
+// totals kept by the "count:" decorator selected from WAVEMINER_I2C
+extern i2c_stats_t i2c_stats;
+
 // set timeout for clock stretching. Needed for Pi : (
 int i2c_set_timeout(int val);
 // bus=1 for interface I2C2 on BBB
@@ -35,11 +145,36 @@ int i2c_write_ignore_nack(int handle,
 int i2c_read_no_ack(int handle, 
                     unsigned char addr_r, unsigned char* buf, unsigned int length);
 int i2c_write_byte(int handle, unsigned char val);
+// same as i2c_write, but a failure is not reported on stderr. Use this where a
+// NACK is expected, for instance when polling an EEPROM that is busy writing
+int i2c_write_quiet(int handle, unsigned char* buf, unsigned int length);
 int i2c_read_byte(int handle, unsigned char* val);
 
+// Batched transactions. Messages are queued with i2c_trans_write/i2c_trans_read
+// and then sent with i2c_trans_submit, which uses as few I2C_RDWR calls as the
+// kernel limit allows (messages inside one call are separated by a repeated
+// start, not a stop, so don't batch writes to an EEPROM).
+// i2c_trans_write copies the data, so buf can be reused straight away.
+// i2c_trans_read stores the pointer, so buf must stay valid until the submit.
+// Both return the message index, or -1 if the transaction is full.
+void i2c_trans_init(i2c_transaction_t* t);
+int i2c_trans_write(i2c_transaction_t* t, unsigned char addr, unsigned char* buf, unsigned int length);
+int i2c_trans_read(i2c_transaction_t* t, unsigned char addr, unsigned char* buf, unsigned int length);
+// returns -1 if any message failed, otherwise 0. t->status has the result of
+// each message. The transaction is left intact; call i2c_trans_init to reuse it.
+int i2c_trans_submit(int handle, i2c_transaction_t* t);
+
 // These functions return -1 on error, otherwise return 0 on success
 int i2c_close(int handle);
 // Provides an inaccurate delay (may be useful for waiting for ADC etc).
 // The maximum delay is 999msec
 int delay_ms(unsigned int msec);
+// returns a monotonic time in nanoseconds, for measuring elapsed time
+unsigned long long monotonic_ns(void);
+// Microsecond version of delay_ms, for short waits such as an audio frame.
+// The maximum delay is 999999usec
+int delay_us(unsigned int usec);
+// total time spent in delay_ms and delay_us so far, and the number of calls
+extern unsigned long long i2c_sleep_ns;
+extern unsigned long long i2c_sleep_count;
 
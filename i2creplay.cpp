@@ -0,0 +1,210 @@
+/*****************************************************
+ * i2creplay - I2C Trace Replayer
+ * rev 1 - october 2026
+ *
+ * Sends the transactions in a trace file (recorded by
+ * running any tool with WAVEMINER_I2C_TRACE=file) to
+ * the bus again. The bus is chosen with WAVEMINER_I2C
+ * as for the other tools, so a trace from the board
+ * can be replayed against the fake bus, and the other
+ * way round. Results and read data that differ from
+ * the trace are reported.
+ *
+ * Without -t the transactions are sent as fast as
+ * possible. With -t the original timing is kept (as
+ * virtual time, if the audio path model is on).
+ *
+ * Example to record a measurement and replay it:
+ *      WAVEMINER_I2C_TRACE=thd.trace ./thd -i 6 -c
+ *      ./i2creplay -f thd.trace -t
+ * Example to list the transactions as they are sent:
+ *      ./i2creplay -f thd.trace -v
+ *****************************************************/
+
+// includes
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <errno.h>
+ #include <time.h>
+ #include "options.h"
+ #include "i2cfunc.h"
+ #include "i2cfake.h"
+
+// defines
+#define MAX_MSGS 128
+#define MAX_HANDLES 64
+#define MAX_DATA 65536
+
+// externs
+extern char do_log;
+
+// globals
+int handle_from[MAX_HANDLES]; // handle in the trace
+int handle_to[MAX_HANDLES];   // handle it was opened as now
+int nhandles = 0;
+
+// ************* functions *************************
+
+int
+map_handle(int h)
+{
+    int i;
+    for (i=0; i<nhandles; i++) {
+        if (handle_from[i] == h) return(handle_to[i]);
+    }
+    return(-1);
+}
+
+// sleep until a monotonic time
+void
+wait_until(unsigned long long t_ns)
+{
+    struct timespec a;
+    a.tv_sec = t_ns / 1000000000ULL;
+    a.tv_nsec = t_ns % 1000000000ULL;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &a, NULL) == EINTR);
+}
+
+// ************* main program **********************
+ int
+ main(int argc, char **argv)
+ {
+    char* sw; // used for command-line arguments
+    char fname[256];
+    char do_timed = 0;
+    FILE* fp;
+    i2c_transport_t* tp;
+    i2c_trace_hdr_t hdr;
+    i2c_trace_rec_t rec;
+    i2c_trace_msg_t tm[MAX_MSGS];
+    struct i2c_msg msgs[MAX_MSGS];
+    static unsigned char data[MAX_DATA];  // as recorded
+    static unsigned char rdata[MAX_DATA]; // read back now
+    unsigned int used;
+    int i, h, ret;
+    int nrec = 0, nfail = 0, nresult = 0, ndata = 0;
+    unsigned long long t_start, t_call, bus_ns = 0, trace_ns = 0, trace_end = 0;
+    unsigned long long skipped_ns = 0; // real sleeps in the trace that were simulated here
+
+    sw = getCmdOption(argv, argv + argc, "-f");
+    if (sw == NULL) {
+        printf("usage: %s -f tracefile [-t] [-v]\n", argv[0]);
+        return(1);
+    }
+    do_log = 0;
+    strncpy(fname, sw, sizeof(fname)-1);
+    fname[sizeof(fname)-1] = 0;
+    if (cmdOptionExists(argv, argv + argc, "-t")) {
+        do_timed = 1;
+    }
+    if (cmdOptionExists(argv, argv + argc, "-v")) {
+        do_log = 1;
+    }
+
+    if ((fp = fopen(fname, "rb")) == NULL) {
+        printf("file '%s' not found!\n", fname);
+        return(1);
+    }
+    if ((fread(&hdr, sizeof(hdr), 1, fp) != 1) || (hdr.magic != I2C_TRACE_MAGIC) ||
+        (hdr.version != I2C_TRACE_VERSION)) {
+        printf("file '%s' is not an I2C trace!\n", fname);
+        fclose(fp);
+        return(1);
+    }
+
+    tp = i2c_transport();
+    t_start = monotonic_ns();
+    while (fread(&rec, sizeof(rec), 1, fp) == 1) {
+        // read the messages, and point them at the recorded data
+        used = 0;
+        for (i=0; i<rec.nmsgs; i++) {
+            if ((i >= MAX_MSGS) || (fread(&tm[i], sizeof(tm[i]), 1, fp) != 1) ||
+                (used+tm[i].len > MAX_DATA) || (fread(&data[used], 1, tm[i].len, fp) != tm[i].len)) {
+                printf("trace is truncated or corrupt at record %d\n", nrec);
+                fclose(fp);
+                return(1);
+            }
+            msgs[i].addr = tm[i].addr;
+            msgs[i].flags = tm[i].flags;
+            msgs[i].len = tm[i].len;
+            // reads go into rdata so they can be compared with the trace
+            msgs[i].buf = (tm[i].flags & I2C_M_RD) ? &rdata[used] : &data[used];
+            used += tm[i].len;
+        }
+        if (rec.op == I2C_TRACE_SLEEP) {
+            // with the audio path model on (see dspsim.h) the sleep is simulated, in both
+            // modes. Otherwise it is already in the timing of the next record
+            if (fake_sleep(rec.dur_ns)) skipped_ns += rec.result;
+            if (do_log) printf("%10.3f msec sleep %.1f usec\n", rec.t_ns/1e6, rec.dur_ns/1e3);
+            nrec++;
+            continue;
+        }
+
+        if (do_timed) wait_until(t_start + rec.t_ns - skipped_ns);
+        h = map_handle(rec.handle);
+        t_call = monotonic_ns();
+        switch (rec.op) {
+            case I2C_TRACE_OPEN:
+                ret = tp->open(tp, msgs[0].flags, msgs[0].addr);
+                if ((ret >= 0) && (nhandles < MAX_HANDLES)) {
+                    handle_from[nhandles] = rec.handle;
+                    handle_to[nhandles] = ret;
+                    nhandles++;
+                }
+                if ((ret >= 0) && (rec.result >= 0)) ret = rec.result; // handles differ between runs
+                break;
+            case I2C_TRACE_CLOSE:
+                ret = tp->close(tp, h);
+                break;
+            case I2C_OP_WRITE:
+                ret = tp->write(tp, h, msgs[0].buf, msgs[0].len);
+                break;
+            case I2C_OP_READ:
+                ret = tp->read(tp, h, msgs[0].buf, msgs[0].len);
+                break;
+            case I2C_OP_RDWR:
+                ret = tp->rdwr(tp, h, msgs, rec.nmsgs);
+                break;
+            default:
+                printf("unknown operation 0x%02x at record %d\n", rec.op, nrec);
+                fclose(fp);
+                return(1);
+        }
+        if (ret < 0) ret = -errno;
+        bus_ns += monotonic_ns() - t_call;
+        trace_ns += rec.dur_ns;
+        trace_end = rec.t_ns + rec.dur_ns;
+
+        if (ret < 0) nfail++;
+        if (ret != rec.result) {
+            nresult++;
+            if (do_log) printf("record %d: result %d, trace has %d\n", nrec, ret, rec.result);
+        }
+        // compare what was read, if the read worked both times
+        if ((ret >= 0) && (rec.result >= 0)) {
+            used = 0;
+            for (i=0; i<rec.nmsgs; i++) {
+                if ((tm[i].flags & I2C_M_RD) && (memcmp(&rdata[used], &data[used], tm[i].len) != 0)) {
+                    ndata++;
+                    if (do_log) printf("record %d: read data differs from the trace\n", nrec);
+                    break;
+                }
+                used += tm[i].len;
+            }
+        }
+        if (do_log) {
+            printf("%10.3f msec op 0x%02x, %d msgs, result %d, %.1f usec (trace %.1f usec)\n",
+                   rec.t_ns/1e6, rec.op, rec.nmsgs, ret, (monotonic_ns()-t_call)/1e3, rec.dur_ns/1e3);
+        }
+        nrec++;
+    }
+    fclose(fp);
+
+    printf("replayed %d records in %.3f msec (trace took %.3f msec)\n",
+           nrec, (monotonic_ns()-t_start)/1e6, trace_end/1e6);
+    printf("time in transactions %.3f msec (trace %.3f msec)\n", bus_ns/1e6, trace_ns/1e6);
+    printf("%d failed, %d results and %d reads differ from the trace\n", nfail, nresult, ndata);
+
+    return((nresult || ndata) ? 2 : 0);
+ }
@@ -0,0 +1,210 @@
+/*******************************
+ * i2cshim.c
+ * LD_PRELOAD library that runs the
+ * unmodified tools against the
+ * models in i2cfake.c
+ * rev 1 october 2026
+ *
+ * open("/dev/i2c-N") returns a real descriptor (on /dev/null) so
+ * that the numbers stay unique, and the I2C_SLAVE and I2C_RDWR
+ * ioctls, write and read on it are sent to the fake bus. Everything
+ * else goes to the C library as usual. The wiringPi calls used by
+ * ee_prog() are replaced too (libwiringPi.so still has to exist for
+ * the tools to start).
+ *
+ * The bus timing is set with WAVEMINER_FAKE_LATENCY_US and
+ * WAVEMINER_FAKE_CLOCK_HZ, and the state can be kept in a file
+ * with WAVEMINER_FAKE_STATE (see i2cfake.h). nanosleep is replaced
+ * too, for the virtual time of the audio path model (WAVEMINER_SIM,
+ * see dspsim.h). Example:
+ *      WAVEMINER_FAKE_CLOCK_HZ=100000 LD_PRELOAD=./i2cshim.so ./thd
+ *******************************/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <dlfcn.h>
+#include <unistd.h>
+#include <time.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include "i2cfake.h"
+
+#define SHIM_MAX_FDS 1024
+
+static int shim_slave[SHIM_MAX_FDS]; // 0 if the descriptor is not an I2C bus, else 0x100 | slave address
+
+static int (*real_open)(const char*, int, ...)=NULL;
+static int (*real_open64)(const char*, int, ...)=NULL;
+static int (*real_close)(int)=NULL;
+static int (*real_ioctl)(int, unsigned long, ...)=NULL;
+static ssize_t (*real_write)(int, const void*, size_t)=NULL;
+static ssize_t (*real_read)(int, void*, size_t)=NULL;
+static int (*real_nanosleep)(const struct timespec*, struct timespec*)=NULL;
+
+static void shim_init(void)
+{
+  if (real_open) return;
+  real_open=(int (*)(const char*, int, ...))dlsym(RTLD_NEXT, "open");
+  real_open64=(int (*)(const char*, int, ...))dlsym(RTLD_NEXT, "open64");
+  real_close=(int (*)(int))dlsym(RTLD_NEXT, "close");
+  real_ioctl=(int (*)(int, unsigned long, ...))dlsym(RTLD_NEXT, "ioctl");
+  real_write=(ssize_t (*)(int, const void*, size_t))dlsym(RTLD_NEXT, "write");
+  real_read=(ssize_t (*)(int, void*, size_t))dlsym(RTLD_NEXT, "read");
+  real_nanosleep=(int (*)(const struct timespec*, struct timespec*))dlsym(RTLD_NEXT, "nanosleep");
+}
+
+static int is_i2c(int fd)
+{
+  return((fd>=0) && (fd<SHIM_MAX_FDS) && shim_slave[fd]);
+}
+
+static int is_i2c_path(const char* path)
+{
+  return(strncmp(path, "/dev/i2c-", 9)==0);
+}
+
+static int open_i2c(void)
+{
+  int fd;
+  fake_state();
+  fd=real_open("/dev/null", O_RDWR);
+  if (fd>=SHIM_MAX_FDS)
+  {
+    real_close(fd);
+    errno=EMFILE;
+    return(-1);
+  }
+  if (fd>=0) shim_slave[fd]=0x100;
+  return(fd);
+}
+
+// one message to the slave address set with I2C_SLAVE
+static ssize_t shim_rw(int fd, void* buf, size_t len, int flags)
+{
+  struct i2c_msg msg;
+  msg.addr=shim_slave[fd] & 0xff;
+  msg.flags=flags;
+  msg.len=len;
+  msg.buf=(unsigned char*)buf;
+  if (fake_bus_transfer(&msg, 1)<0) return(-1);
+  return(len);
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int open(const char* path, int flags, ...)
+{
+  va_list ap;
+  mode_t mode=0;
+
+  shim_init();
+  if (is_i2c_path(path)) return(open_i2c());
+  if (flags & O_CREAT)
+  {
+    va_start(ap, flags);
+    mode=va_arg(ap, int);
+    va_end(ap);
+  }
+  return(real_open(path, flags, mode));
+}
+
+int open64(const char* path, int flags, ...)
+{
+  va_list ap;
+  mode_t mode=0;
+
+  shim_init();
+  if (is_i2c_path(path)) return(open_i2c());
+  if (flags & O_CREAT)
+  {
+    va_start(ap, flags);
+    mode=va_arg(ap, int);
+    va_end(ap);
+  }
+  return(real_open64(path, flags, mode));
+}
+
+int close(int fd)
+{
+  shim_init();
+  if (is_i2c(fd)) shim_slave[fd]=0;
+  return(real_close(fd));
+}
+
+int ioctl(int fd, unsigned long request, ...)
+{
+  va_list ap;
+  void* arg;
+  struct i2c_rdwr_ioctl_data* rdwr;
+
+  shim_init();
+  va_start(ap, request);
+  arg=va_arg(ap, void*);
+  va_end(ap);
+  if (!is_i2c(fd)) return(real_ioctl(fd, request, arg));
+  switch (request)
+  {
+    case I2C_SLAVE:
+    case I2C_SLAVE_FORCE:
+      shim_slave[fd]=0x100 | ((unsigned long)arg & 0x7f);
+      return(0);
+    case I2C_RDWR:
+      rdwr=(struct i2c_rdwr_ioctl_data*)arg;
+      return(fake_bus_transfer(rdwr->msgs, rdwr->nmsgs));
+    case I2C_FUNCS:
+      *(unsigned long*)arg=I2C_FUNC_I2C | I2C_FUNC_PROTOCOL_MANGLING;
+      return(0);
+    default: // timeouts, retries and so on have no effect
+      return(0);
+  }
+}
+
+ssize_t write(int fd, const void* buf, size_t len)
+{
+  shim_init();
+  if (is_i2c(fd)) return(shim_rw(fd, (void*)buf, len, 0));
+  return(real_write(fd, buf, len));
+}
+
+ssize_t read(int fd, void* buf, size_t len)
+{
+  shim_init();
+  if (is_i2c(fd)) return(shim_rw(fd, buf, len, I2C_M_RD));
+  return(real_read(fd, buf, len));
+}
+
+// delay_ms() and delay_us() use nanosleep, which becomes virtual
+// time when the audio path model is on (see dspsim.h)
+int nanosleep(const struct timespec* req, struct timespec* rem)
+{
+  shim_init();
+  if (fake_sleep(req->tv_sec*1000000000ULL+req->tv_nsec))
+  {
+    if (rem) memset(rem, 0, sizeof(struct timespec));
+    return(0);
+  }
+  return(real_nanosleep(req, rem));
+}
+
+// wiringPi, as used by ee_prog(). There's no WP pin to drive
+int wiringPiSetupGpio(void)
+{
+  return(0);
+}
+
+void pinMode(int pin, int mode)
+{
+}
+
+void digitalWrite(int pin, int value)
+{
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,430 @@
+/**********************************************************
+ * iir.cpp - lowpass and highpass IIR filter design
+ *
+ * The prototypes are lowpass filters with their edge at
+ * 1 rad/s, given as poles and zeros. The elliptic one
+ * uses the Landen transformation to evaluate the Jacobi
+ * elliptic functions, as in S. J. Orfanidis, "Lecture
+ * Notes on Elliptic Filter Design" (2006).
+ **********************************************************/
+
+// includes
+ #include <math.h>
+ #include <string.h>
+ #include <complex>
+ #include "dsputil.h"
+ #include "fixedpoint.h"
+ #include "iir.h"
+
+// defines
+#define MAX_ORDER (2*IIR_MAX_SECTIONS)
+#define LANDEN_MAX 32     // Landen steps, far more than double precision needs
+#define GRID_POINTS 256   // log-spaced frequencies for the headroom scaling
+#define COEFF_LIMIT 16.0  // 5.23 range
+
+typedef std::complex<double> cplx;
+
+static const cplx J(0.0, 1.0);
+
+static const char* type_name[IIR_TYPES] = {
+    "butter", "cheby1", "cheby2", "bessel", "ellip"
+};
+
+// ************* elliptic functions *************************
+
+// descending Landen sequence of moduli for k, ending when they no longer
+// affect a double. returns the number of moduli in v
+static int
+landen(double k, double* v) {
+    int n = 0;
+
+    while ((k > 1e-16) && (n < LANDEN_MAX)) {
+        k = k/(1+sqrt(1-k*k));
+        k = k*k;
+        v[n++] = k;
+    }
+    return(n);
+}
+
+// complete elliptic integral of the first kind, K(k)
+static double
+ellipk(double k) {
+    double v[LANDEN_MAX];
+    double kk = 1;
+    int i, n;
+
+    n = landen(k, v);
+    for (i=0; i<n; i++) kk *= 1+v[i];
+    return(kk*PI/2);
+}
+
+// cd(u*K, k) and sn(u*K, k), u in units of the quarter period K
+static cplx
+cde(cplx u, double k) {
+    double v[LANDEN_MAX];
+    cplx w = cos(u*PI/2.0);
+    int n;
+
+    for (n=landen(k, v)-1; n>=0; n--) w = (1+v[n])*w/(1.0+v[n]*w*w);
+    return(w);
+}
+
+static cplx
+sne(cplx u, double k) {
+    double v[LANDEN_MAX];
+    cplx w = sin(u*PI/2.0);
+    int n;
+
+    for (n=landen(k, v)-1; n>=0; n--) w = (1+v[n])*w/(1.0+v[n]*w*w);
+    return(w);
+}
+
+// remainder of x/y in -y/2 to y/2
+static double
+srem(double x, double y) {
+    return(x - y*floor(x/y + 0.5));
+}
+
+// inverses of cde and sne, in units of K
+static cplx
+acde(cplx w, double k) {
+    double v[LANDEN_MAX];
+    double v1, r;
+    cplx u;
+    int i, n;
+
+    n = landen(k, v);
+    for (i=0; i<n; i++) {
+        v1 = (i == 0) ? k : v[i-1];
+        w = w/(1.0+sqrt(1.0-w*w*v1*v1)) * 2.0/(1+v[i]);
+    }
+    u = 2.0/PI*acos(w);
+    r = ellipk(sqrt(1-k*k))/ellipk(k);
+    return(cplx(srem(u.real(), 4), srem(u.imag(), 2*r)));
+}
+
+static cplx
+asne(cplx w, double k) {
+    return(1.0 - acde(w, k));
+}
+
+// the modulus k for an order n elliptic filter with discrimination k1
+static double
+ellipdeg(int n, double k1) {
+    double k1p = sqrt(1-k1*k1);
+    double kp, prod = 1;
+    int i;
+
+    for (i=1; i<=n/2; i++) prod *= sne((2*i-1)/(double)n, k1p).real();
+    kp = pow(k1p, n)*pow(prod, 4);
+    return(sqrt(1-kp*kp));
+}
+
+// ************* prototypes *************************
+// each fills p with the n poles and z with the finite zeros, and returns
+// the number of zeros
+
+static int
+proto_butterworth(int n, cplx* p) {
+    int i;
+    for (i=0; i<n; i++) p[i] = exp(J*(PI*(2*i+1+n)/(2*n)));
+    return(0);
+}
+
+static int
+proto_chebyshev1(int n, double ripple_db, cplx* p) {
+    double eps = sqrt(pow(10.0, ripple_db/10)-1);
+    double mu = asinh(1/eps)/n;
+    double th;
+    int i;
+
+    for (i=0; i<n; i++) {
+        th = PI*(2*i+1)/(2*n);
+        p[i] = cplx(-sinh(mu)*sin(th), cosh(mu)*cos(th));
+    }
+    return(0);
+}
+
+// the poles of a type I filter with ripple 1/eps, inverted, and zeros
+// on the imaginary axis where the type I response has its peaks
+static int
+proto_chebyshev2(int n, double atten_db, cplx* p, cplx* z) {
+    double eps = 1/sqrt(pow(10.0, atten_db/10)-1);
+    double mu = asinh(1/eps)/n;
+    double th;
+    int i, nz = 0;
+
+    for (i=0; i<n; i++) {
+        th = PI*(2*i+1)/(2*n);
+        p[i] = 1.0/cplx(-sinh(mu)*sin(th), cosh(mu)*cos(th));
+        if (2*i+1 != n) z[nz++] = J/cos(th);
+    }
+    return(nz);
+}
+
+// roots of the reverse Bessel polynomial (Durand-Kerner iteration), scaled
+// so that the response is -3 dB at 1 rad/s
+static int
+proto_bessel(int n, cplx* p) {
+    double a[MAX_ORDER+1];
+    double lo, hi, w, step;
+    cplx s, num, den, h;
+    int i, j, it;
+
+    // a[k] = (2n-k)! / (2^(n-k) k! (n-k)!), a[n] = 1
+    a[n] = 1;
+    for (i=n-1; i>=0; i--) a[i] = a[i+1]*(2.0*n-i)*(i+1)/(2.0*(n-i));
+    for (i=0; i<n; i++) p[i] = pow(cplx(0.4, 0.9), i);
+    for (it=0; it<500; it++) {
+        step = 0;
+        for (i=0; i<n; i++) {
+            num = 0;
+            for (j=n; j>=0; j--) num = num*p[i] + a[j];
+            den = 1;
+            for (j=0; j<n; j++) {
+                if (j != i) den *= p[i]-p[j];
+            }
+            p[i] -= num/den;
+            if (abs(num/den) > step) step = abs(num/den);
+        }
+        if (step < 1e-14) break;
+    }
+    // |H(jw)| = a[0]/|theta(jw)| falls steadily, find where it is 1/sqrt(2)
+    lo = 0;
+    hi = 2*n+2;
+    for (it=0; it<100; it++) {
+        w = (lo+hi)/2;
+        s = J*w;
+        h = 0;
+        for (j=n; j>=0; j--) h = h*s + a[j];
+        if (a[0]/abs(h) > sqrt(0.5)) lo = w; else hi = w;
+    }
+    for (i=0; i<n; i++) p[i] /= lo;
+    return(0);
+}
+
+static int
+proto_elliptic(int n, double ripple_db, double atten_db, cplx* p, cplx* z) {
+    double ep = sqrt(pow(10.0, ripple_db/10)-1);
+    double es = sqrt(pow(10.0, atten_db/10)-1);
+    double k1 = ep/es;
+    double k = ellipdeg(n, k1);
+    double v0, u, zeta;
+    int i, np = 0, nz = 0;
+
+    v0 = (-J*asne(J/ep, k1)/(double)n).real();
+    for (i=1; i<=n/2; i++) {
+        u = (2*i-1)/(double)n;
+        zeta = cde(u, k).real();
+        z[nz++] = J/(k*zeta);
+        z[nz++] = -J/(k*zeta);
+        p[np] = J*cde(u-J*v0, k);
+        p[np+1] = conj(p[np]);
+        np += 2;
+    }
+    if (n & 1) p[np] = J*sne(J*v0, k);
+    return(nz);
+}
+
+// ************* digital sections *************************
+
+// response of a section at z, given z1 = z^-1
+static cplx
+section_response(const double* c, cplx z1) {
+    cplx z2 = z1*z1;
+    return((c[0] + c[1]*z1 + c[2]*z2) / (1.0 + c[3]*z1 + c[4]*z2));
+}
+
+int
+iir_design(double coeff[][5], int type, int pass, int order, double fs, double fc,
+           double ripple_db, double atten_db) {
+    cplx p[MAX_ORDER], z[MAX_ORDER];
+    cplx pd[IIR_MAX_SECTIONS], zd[IIR_MAX_SECTIONS]; // one of each pair, digital
+    cplx hcum[GRID_POINTS+IIR_MAX_SECTIONS];
+    cplx grid[GRID_POINTS+IIR_MAX_SECTIONS]; // z^-1 at each frequency
+    double limit[IIR_MAX_SECTIONS], mag[IIR_MAX_SECTIONS];
+    double gain, peak, wc, t, k_i;
+    char used[IIR_MAX_SECTIONS];
+    cplx s, best, ref_z, z_fc, h_ref, h_fc;
+    int nz, npairs = 0, nzpairs = 0, nsec, ngrid, i, j, b, k;
+    int real_pole = -1;
+
+    if ((order < 1) || (order > MAX_ORDER) || (fs <= 0) || (fc <= 0) || (fc >= fs/2)) return(-1);
+    if ((type == IIR_CHEBYSHEV1) || (type == IIR_ELLIPTIC)) {
+        if (ripple_db <= 0) return(-1);
+    }
+    if ((type == IIR_CHEBYSHEV2) || (type == IIR_ELLIPTIC)) {
+        if (atten_db <= 0) return(-1);
+    }
+    if ((type == IIR_ELLIPTIC) && (atten_db <= ripple_db)) return(-1);
+
+    switch (type) {
+        case IIR_BUTTERWORTH: nz = proto_butterworth(order, p); break;
+        case IIR_CHEBYSHEV1: nz = proto_chebyshev1(order, ripple_db, p); break;
+        case IIR_CHEBYSHEV2: nz = proto_chebyshev2(order, atten_db, p, z); break;
+        case IIR_BESSEL: nz = proto_bessel(order, p); break;
+        case IIR_ELLIPTIC: nz = proto_elliptic(order, ripple_db, atten_db, p, z); break;
+        default: return(-1);
+    }
+
+    // to the cutoff (pre-warped, lowpass s*wc or highpass wc/s) and then to
+    // the z plane. Only one of each conjugate pair is kept
+    wc = 2*fs*tan(PI*fc/fs);
+    nsec = (order+1)/2;
+    for (i=0; i<order; i++) {
+        s = (pass == IIR_HIGHPASS) ? wc/p[i] : p[i]*wc;
+        s = (2*fs + s)/(2*fs - s);
+        if (fabs(p[i].imag()) < 1e-9*abs(p[i])) {
+            real_pole = npairs;
+            pd[npairs++] = cplx(s.real(), 0);
+        } else if (p[i].imag() > 0) {
+            pd[npairs++] = s;
+        }
+    }
+    for (i=0; i<nz; i++) {
+        if (z[i].imag() <= 0) continue; // zeros are on the imaginary axis
+        s = (pass == IIR_HIGHPASS) ? wc/z[i] : z[i]*wc;
+        zd[nzpairs++] = (2*fs + s)/(2*fs - s);
+    }
+    // the zeros at infinity go to z=-1 (lowpass) or z=+1 (highpass),
+    // a real zero with the real pole and pairs with the others
+    while (nzpairs < nsec) zd[nzpairs++] = cplx((pass == IIR_HIGHPASS) ? 1 : -1, 0);
+
+    // the real pole (if any) gets a single real zero, and then the poles
+    // nearest the unit circle choose their zeros first
+    memset(used, 0, sizeof(used));
+    for (i=0; i<nsec; i++) {
+        b = real_pole;
+        if ((b < 0) || used[b]) {
+            b = -1;
+            for (j=0; j<nsec; j++) {
+                if ((j == real_pole) || used[j]) continue;
+                if ((b < 0) || (abs(pd[j]) > abs(pd[b]))) b = j;
+            }
+        }
+        used[b] = 1;
+        k = -1;
+        for (j=0; j<nzpairs; j++) {
+            if ((b == real_pole) && (zd[j].imag() != 0)) continue;
+            if ((k < 0) || (abs(zd[j]-pd[b]) < abs(zd[k]-pd[b]))) k = j;
+        }
+        best = zd[k];
+        zd[k] = zd[--nzpairs]; // taken
+        // 1 - 2 Re(x) z^-1 + |x|^2 z^-2, or 1 - x z^-1 when single
+        if (b == real_pole) {
+            coeff[b][0] = 1; coeff[b][1] = -best.real(); coeff[b][2] = 0;
+            coeff[b][3] = -pd[b].real(); coeff[b][4] = 0;
+        } else {
+            coeff[b][0] = 1; coeff[b][1] = -2*best.real(); coeff[b][2] = norm(best);
+            coeff[b][3] = -2*pd[b].real(); coeff[b][4] = norm(pd[b]);
+        }
+    }
+
+    // lowest Q first: sort by pole radius
+    for (i=1; i<nsec; i++) {
+        for (j=i; (j > 0) && (abs(pd[j]) < abs(pd[j-1])); j--) {
+            s = pd[j]; pd[j] = pd[j-1]; pd[j-1] = s;
+            for (b=0; b<5; b++) {
+                t = coeff[j][b]; coeff[j][b] = coeff[j-1][b]; coeff[j-1][b] = t;
+            }
+        }
+    }
+
+    // frequencies for the peak search: log-spaced from 1 Hz to fs/2, and each
+    // pole's angle, where its peak is
+    ngrid = 0;
+    for (i=0; i<GRID_POINTS; i++) {
+        grid[ngrid++] = exp(-J*(2*PI/fs * pow(fs/2, i/(double)(GRID_POINTS-1))));
+    }
+    for (i=0; i<nsec; i++) {
+        if (arg(pd[i]) > 0) grid[ngrid++] = exp(-J*arg(pd[i]));
+    }
+    for (i=0; i<ngrid; i++) hcum[i] = 1;
+
+    // the most gain the sections up to each one can have between them, for
+    // the signal after it to stay below 0 dB, and the largest numerator
+    // coefficient of each section
+    for (i=0; i<nsec; i++) {
+        peak = 0;
+        for (j=0; j<ngrid; j++) {
+            hcum[j] *= section_response(coeff[i], grid[j]);
+            if (abs(hcum[j]) > peak) peak = abs(hcum[j]);
+        }
+        limit[i] = 1/peak;
+        mag[i] = 0;
+        for (b=0; b<3; b++) {
+            if (fabs(coeff[i][b]) > mag[i]) mag[i] = fabs(coeff[i][b]);
+        }
+    }
+
+    // the gain for the passband: 1 at DC (lowpass) or fs/2 (highpass),
+    // except for even order filters with ripple, which start at the bottom
+    // of it
+    ref_z = (pass == IIR_HIGHPASS) ? -1 : 1;
+    gain = 1;
+    if ((order % 2 == 0) && ((type == IIR_CHEBYSHEV1) || (type == IIR_ELLIPTIC))) {
+        gain = pow(10.0, -ripple_db/20);
+    }
+    s = 1;
+    for (i=0; i<nsec; i++) s *= section_response(coeff[i], ref_z);
+    if (!(s.real() > 0)) return(-1);
+    gain = gain/s.real();
+
+    // share the gain out so that the numerators are all the same size, as
+    // the smallest one loses the most when rounded to 5.23, but no more
+    // than the headroom allows. Each section takes its share of what the
+    // ones before it left, and the last section gets the rest
+    peak = 1; // gain so far
+    for (i=0; i<nsec; i++) {
+        if (i == nsec-1) {
+            k_i = gain/peak;
+        } else {
+            t = gain/peak;
+            for (j=i; j<nsec; j++) t *= mag[j];
+            k_i = pow(t, 1.0/(nsec-i))/mag[i];
+            if (peak*k_i > limit[i]) k_i = limit[i]/peak;
+        }
+        for (b=0; b<3; b++) coeff[i][b] *= k_i;
+        peak *= k_i;
+    }
+
+    // round to the 5.23 values the DSP will use, and check that it is still
+    // a working filter: each section stable and passing something, and the
+    // response in the passband and at the cutoff still as designed
+    for (i=0; i<nsec; i++) {
+        for (b=0; b<5; b++) {
+            if (!(fabs(coeff[i][b]) < COEFF_LIMIT)) return(IIR_ROUNDING);
+        }
+    }
+    z_fc = exp(-J*(2*PI*fc/fs));
+    h_ref = 1;
+    h_fc = 1;
+    for (i=0; i<nsec; i++) {
+        h_ref *= section_response(coeff[i], ref_z);
+        h_fc *= section_response(coeff[i], z_fc);
+        for (b=0; b<5; b++) {
+            coeff[i][b] = fixed_5_23::to_double(fixed_5_23::to_int(coeff[i][b]));
+        }
+        if ((coeff[i][0] == 0) && (coeff[i][1] == 0) && (coeff[i][2] == 0)) return(IIR_ROUNDING);
+        if (!(fabs(coeff[i][4]) < 1) || !(fabs(coeff[i][3]) < 1+coeff[i][4])) return(IIR_ROUNDING);
+    }
+    s = 1;
+    best = 1;
+    for (i=0; i<nsec; i++) {
+        s *= section_response(coeff[i], ref_z);
+        best *= section_response(coeff[i], z_fc);
+    }
+    if (fabs(20*log10(abs(s)/abs(h_ref))) > IIR_MAX_ERROR_DB) return(IIR_ROUNDING);
+    if (fabs(20*log10(abs(best)/abs(h_fc))) > IIR_MAX_ERROR_DB) return(IIR_ROUNDING);
+    return(nsec);
+}
+
+int
+iir_type(const char* name) {
+    int i;
+
+    for (i=0; i<IIR_TYPES; i++) {
+        if (strcmp(name, type_name[i]) == 0) return(i);
+    }
+    return(-1);
+}
@@ -0,0 +1,63 @@
+#ifndef __IIR_HEADER_FILE__
+#define __IIR_HEADER_FILE__
+
+/**********************************************************
+ * iir.h - lowpass and highpass IIR filter design
+ *
+ * Designs a Butterworth, Chebyshev (type I or II), Bessel
+ * or elliptic filter of any order up to 2*IIR_MAX_SECTIONS
+ * and returns it as a cascade of second order sections,
+ * each five coefficients b0, b1, b2, a1, a2 in the layout
+ * of set_gen_2nd_order_filter (see biquad.h).
+ *
+ * The analog prototype is mapped to the cutoff with the
+ * bilinear transform (pre-warped, so the cutoff is exact).
+ * Each pair of poles is given the nearest pair of zeros,
+ * and the sections are ordered from the lowest Q to the
+ * highest. The gain is shared out so the numerators are
+ * of a similar size, as long as the response up to each
+ * section stays below 0 dB (its peak is found on a
+ * frequency grid), and the last section sets the overall
+ * passband gain. That keeps the signal between sections
+ * within the DSP's range when the later sections have
+ * resonant peaks.
+ *
+ * The coefficients are returned rounded to 5.23, and the
+ * design is refused if the rounding spoils it, which
+ * happens with high orders at very low cutoffs.
+ **********************************************************/
+
+#define IIR_MAX_SECTIONS 6
+
+// filter types
+#define IIR_BUTTERWORTH 0
+#define IIR_CHEBYSHEV1 1   // ripple_db of equiripple in the passband
+#define IIR_CHEBYSHEV2 2   // at least atten_db of attenuation in the stopband
+#define IIR_BESSEL 3       // flattest group delay
+#define IIR_ELLIPTIC 4     // both of the above
+#define IIR_TYPES 5
+
+#define IIR_LOWPASS 0
+#define IIR_HIGHPASS 1
+
+#define IIR_ROUNDING -2       // iir_design result, see below
+#define IIR_MAX_ERROR_DB 0.5  // allowed change in the response from rounding
+
+// the cutoff fc is where the response is
+//   Butterworth, Bessel:  -3 dB
+//   Chebyshev I, elliptic: -ripple_db (the edge of the passband)
+//   Chebyshev II:          -atten_db (the edge of the stopband)
+// ripple_db and atten_db are only used by the types that need them.
+// coeff has room for IIR_MAX_SECTIONS sections.
+// returns the number of sections (order/2, rounded up), -1 if the
+// parameters are out of range, or IIR_ROUNDING if the filter does not
+// survive rounding to 5.23: a coefficient is 16 or more, a section is
+// unstable or has a numerator of zero, or the gain in the passband or at
+// fc has moved by more than IIR_MAX_ERROR_DB
+int iir_design(double coeff[][5], int type, int pass, int order, double fs, double fc,
+               double ripple_db, double atten_db);
+
+// type from its name (butter, cheby1, cheby2, bessel, ellip), or -1
+int iir_type(const char* name);
+
+#endif // __IIR_HEADER_FILE__
@@ -31,6 +31,7 @@
  #include "dsputil.h"
  #include "math.h"
 #include "i2cfunc.h" // so we can use the delay_ms function
+#include "dsplog.h"
 
 // defines
 #define FTABLE_SIZE 4
@@ -52,6 +53,7 @@ const int LEVEL_Q = 0x06a2; // node for Q measurement (vimag)
 const int LEVEL_Q_X10 = 0x06de;
 const int LEVEL_Q_X100 = 0x06ea;
 const int LEVEL_TOP = 0x03ea; // node for ref level of potential divider 
+const int SUB_SETTLE_US = 100000; // the X10 and X100 nodes need this long to follow DC_SUB_I/Q
 const int GAIN_READ_BLOCK[] = {0x0047, 0x0049, 0x0048, 0x004a};
 
 
@@ -83,6 +85,7 @@ void
 reset_dsp_settings(void)
 {
     PAUSE_LOGGING;
+    safeload_begin(); // all of the reset takes effect together
     unfreeze_meas();
     //for (i=0; i<GAIN_ARRAY_SIZE; i++) {
     //    set_amp(GAIN_READ_BLOCK[i], 1);
@@ -90,6 +93,7 @@ reset_dsp_settings(void)
 
     set_dc_float_safeload(DC_SUB_I, 0.0);    // subtract zero from the measurements
     set_dc_float_safeload(DC_SUB_Q, 0.0);
+    safeload_commit();
     RESUME_LOGGING;
 }
 
@@ -136,7 +140,7 @@ main(int argc, char **argv)
             exit(1);
         }
         freqhz = ftable[fidx-1];
-        if (do_log) printf("Selecting frequency %lf Hz\n", freqhz);
+        if (do_log) dsp_log(LOG_INFO, "Selecting frequency %lf Hz\n", freqhz);
         do_freq=1;
         do_dsp_reset=1;
     }
@@ -148,7 +152,7 @@ main(int argc, char **argv)
             printf("error, display format selection is invalid!\n");
             exit(1);
         }
-        if (do_log) printf("Selecting display format #%d\n", dformat);
+        if (do_log) dsp_log(LOG_INFO, "Selecting display format #%d\n", dformat);
         do_meas=1;
         do_dsp_reset=1;
     }
@@ -156,10 +160,13 @@ main(int argc, char **argv)
     do_log_store = do_log;
 
     dsp_open(); // create I2C handle for the DSP
+    readback_set_settle(LEVEL_I_X10, SUB_SETTLE_US);
+    readback_set_settle(LEVEL_Q_X10, SUB_SETTLE_US);
+    readback_set_settle(LEVEL_I_X100, SUB_SETTLE_US);
+    readback_set_settle(LEVEL_Q_X100, SUB_SETTLE_US);
 
     if (do_dsp_reset) {
         reset_dsp_settings();
-        //delay_ms(500);
     }
 
     if (do_freq) {  // program the quadrature source selection
@@ -173,63 +180,60 @@ main(int argc, char **argv)
         PAUSE_LOGGING;
         freeze_meas();
 
-        v_complex[0] = readback(LEVEL_ADDR, LEVEL_I); 
-        v_complex[1] = readback(LEVEL_ADDR, LEVEL_Q); 
-        if (do_log) printf("frozen real, imag is [%.8lf, %.8lf]\n", v_complex[0], v_complex[1]);
+        v_complex[0] = readback_fast(LEVEL_ADDR, LEVEL_I); 
+        v_complex[1] = readback_fast(LEVEL_ADDR, LEVEL_Q); 
+        if (do_log) dsp_log(LOG_INFO, "frozen real, imag is [%.8lf, %.8lf]\n", v_complex[0], v_complex[1]);
         RESUME_LOGGING;
 
         // now we subtract the integer value, so that we can zoom into the fractional part
         intportion_real = (int)v_complex[0];
         intportion_imag = (int)v_complex[1];
         PAUSE_LOGGING;
+        safeload_begin();
         set_dc_float_safeload(DC_SUB_I, (double)intportion_real);
         set_dc_float_safeload(DC_SUB_Q, (double)intportion_imag);
+        safeload_commit();
         RESUME_LOGGING;
-        //delay_ms(100);
         // now read the fractional part with the X10 registers
         PAUSE_LOGGING;
-        v_complex[0] = readback(LEVEL_ADDR, LEVEL_I_X10) / 10;
-        //delay_ms(100);
-        v_complex[1] = readback(LEVEL_ADDR, LEVEL_Q_X10) / 10;
-        //delay_ms(100);
+        v_complex[0] = readback_fast(LEVEL_ADDR, LEVEL_I_X10) / 10;
+        v_complex[1] = readback_fast(LEVEL_ADDR, LEVEL_Q_X10) / 10;
         RESUME_LOGGING;
 
         // check if we can read the X10 registers for more resolution
         if (v_complex[0]<0.1) {
             PAUSE_LOGGING;
-            v_complex[0] = readback(LEVEL_ADDR, LEVEL_I_X100) / 100;
+            v_complex[0] = readback_fast(LEVEL_ADDR, LEVEL_I_X100) / 100;
             RESUME_LOGGING;
-            //delay_ms(100);
         }
 
         if (v_complex[1]<0.1) {
             PAUSE_LOGGING;
-            v_complex[1] = readback(LEVEL_ADDR, LEVEL_Q_X100) / 100;
+            v_complex[1] = readback_fast(LEVEL_ADDR, LEVEL_Q_X100) / 100;
             RESUME_LOGGING;
-            //delay_ms(100);
         }
 
         //printf("enhanced fractions are [%.8lf, %.8lf]\n", v_complex[0], v_complex[1]);
         v_complex[0] = v_complex[0] + (double)intportion_real;
         v_complex[1] = v_complex[1] + (double)intportion_imag;
-        if (do_log) printf("hi-res real, imag are now [%.8lf, %.8lf]\n", v_complex[0], v_complex[1]);
+        if (do_log) dsp_log(LOG_INFO, "hi-res real, imag are now [%.8lf, %.8lf]\n", v_complex[0], v_complex[1]);
 
         v_complex[0] = ms_to_pp(v_complex[0]);
         v_complex[1] = ms_to_pp(v_complex[1]);
 
         PAUSE_LOGGING;
-        vstimpeak = readback(LEVEL_ADDR, LEVEL_TOP);
+        vstimpeak = readback_fast(LEVEL_ADDR, LEVEL_TOP);
         RESUME_LOGGING;
 
         vstimpeak = ms_to_pp(vstimpeak);
 
-        if (do_log) printf("Raw vreal, vimag values (Vpp): [%lf, %lf]\n", v_complex[0], v_complex[1]);
+        if (do_log) dsp_log(LOG_INFO, "Raw vreal, vimag values (Vpp): [%lf, %lf]\n", v_complex[0], v_complex[1]);
 
         // correction to scale the cartesian values
         v_complex[0]=v_complex[0]/70.45;
         v_complex[1]=v_complex[1]/70.45;
 
-        if (do_log) printf("Scaled vreal, vimag values: [%lf, %lf]\n", v_complex[0], v_complex[1]);
+        if (do_log) dsp_log(LOG_INFO, "Scaled vreal, vimag values: [%lf, %lf]\n", v_complex[0], v_complex[1]);
 
         // raw phase:
         mag = sqrt( pow(v_complex[0], 2) + pow(v_complex[1], 2) );
@@ -238,7 +242,7 @@ main(int argc, char **argv)
         } else {
             phase = (0.0 - (PI/2)) - atan(v_complex[0]/v_complex[1]);
         }
-        if (do_log) printf("mag, phase (rad) is [%lf, %lf]\n", mag, phase);
+        if (do_log) dsp_log(LOG_INFO, "mag, phase (rad) is [%lf, %lf]\n", mag, phase);
         // phase and mag correction done by using a known 10 ohm resistor
         // i.e. assume it has pure 10 ohm resistance and no reactance
         // phase correction
@@ -246,19 +250,19 @@ main(int argc, char **argv)
         phase = 0 - phase;
         // mag correction
         //mag = mag / 45.5;
-        if (do_log) printf("Corrected mag, phase (rad) is [%lf, %lf]\n", mag, phase);
+        if (do_log) dsp_log(LOG_INFO, "Corrected mag, phase (rad) is [%lf, %lf]\n", mag, phase);
         v_complex[0] = mag * cos(phase);
         v_complex[1] = mag * sin(phase);
-        if (do_log) printf("Corrected vreal, vimag is [%lf, %lf]\n", v_complex[0], v_complex[1]);
+        if (do_log) dsp_log(LOG_INFO, "Corrected vreal, vimag is [%lf, %lf]\n", v_complex[0], v_complex[1]);
 
-        if (do_log) printf("Stim: %.2lf Hz source voltage: %lf V peak\n", freqhz, vstimpeak);
+        if (do_log) dsp_log(LOG_INFO, "Stim: %.2lf Hz source voltage: %lf V peak\n", freqhz, vstimpeak);
 
         // aim: find current through the circuit.
         // current through top resistor (phasor subtraction then magnitude via pythag):
         vtop = sqrt(pow(vstimpeak-v_complex[0], 2) + pow(v_complex[1], 2));
-        if (do_log) printf("voltage across source resistor is %lf V peak (%lf V rms)\n", vtop, vtop/SQROOT2);
+        if (do_log) dsp_log(LOG_INFO, "voltage across source resistor is %lf V peak (%lf V rms)\n", vtop, vtop/SQROOT2);
         itop = vtop/restop;
-        if (do_log) printf("current through circuit is %lf mA peak (%lf mA RMS)\n", itop*1000.0, (itop/SQROOT2)*1000.0);
+        if (do_log) dsp_log(LOG_INFO, "current through circuit is %lf mA peak (%lf mA RMS)\n", itop*1000.0, (itop/SQROOT2)*1000.0);
         reactdut_parallel = mag / (itop * sin(phase)); // use this to compute capacitance and inductance
         // DUT impedance (Z) use the same current. We don't need this to calculate the parallel resistance and parallel reactance.
         impdut = mag / itop;
@@ -278,7 +282,8 @@ main(int argc, char **argv)
             inddut_parallel = reactdut_parallel / (2*PI*freqhz);
         }
 
-        // print out results
+        // print out results, after the log messages from above
+        dsp_log_flush();
         printf("Phase               (phi) : %.3lf rad\n", phase);
         printf("Impedance             (Z) : %.3lf ohm\n", impdut);
         printf("Reactance             (X) : %.3lf ohm\n", reactdut);
@@ -0,0 +1,250 @@
+/*****************************************************
+ * latbench - Tool Latency Breakdown
+ * rev 1 - october 2026
+ *
+ * Runs the command-line tools many times, as a separate
+ * process each time (the way a web front end would call
+ * them), and shows where the time of each run goes:
+ *   startup  - fork, exec and library loading, up to main()
+ *   setup    - main() up to dsp_open(): options, wiringPi
+ *   dsp_open - opening the bus, and the shadow cache check
+ *   bus      - I2C transactions after dsp_open()
+ *   sleep    - delay_ms() and delay_us()
+ *   cpu      - the rest of the time up to exit()
+ *   exit     - exit handlers and process teardown
+ * as percentiles over the runs. The times are recorded by
+ * the tools themselves (see DSP_PHASE_FORMAT in dsputil.h).
+ *
+ * The tools run against the fake bus, with the app loaded
+ * into the fake DSP first (eeload -r). Set WAVEMINER_I2C
+ * to use another transport, e.g. dev for the real board.
+ * The sleeps are real unless WAVEMINER_SIM is set.
+ *
+ * Example to measure freqresp, rms, imp and level:
+ *      ./latbench
+ * Example to measure one command 50 times:
+ *      ./latbench -r 50 -a freqresp.bin -c "freqresp -f 1000 -p -m"
+ *****************************************************/
+
+// includes
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <unistd.h>
+ #include <fcntl.h>
+ #include <sys/wait.h>
+ #include "options.h"
+ #include "dsputil.h"
+ #include "i2cfunc.h"
+
+// defines
+#define DEFAULT_RUNS 20
+#define MAX_RUNS 10000
+#define MAX_ARGS 32
+#define NUM_PHASES 8
+#define PHASE_TOTAL 7
+
+// the commands measured when -c isn't given, with the app each needs
+typedef struct {
+    const char* app;
+    const char* cmd;
+} bench_cmd_t;
+
+const bench_cmd_t default_cmds[] = {
+    { "freqresp.bin", "freqresp -f 1000 -p -m" },
+    { "rms.bin", "rms -v -m" },
+    { "imp.bin", "imp -i 3 -d 1 -m" },
+    { "levelread.bin", "level -p" },
+};
+
+const char* phase_name[NUM_PHASES] = {
+    "startup", "setup", "dsp_open", "bus", "sleep", "cpu", "exit", "total"
+};
+
+// globals
+char state_path[64];
+char phase_path[64];
+char shadow_path[64];
+double phase_ms[NUM_PHASES][MAX_RUNS];
+
+// ************* functions *************************
+
+// runs a command line (tool name and options, separated by spaces) from
+// the current directory with its output discarded.
+// t_start and t_end are set to the monotonic_ns() times around the run.
+// returns the exit status, or -1 if it didn't exit normally
+int
+run_cmd(const char* cmd, unsigned long long* t_start, unsigned long long* t_end) {
+    char line[256];
+    char path[280];
+    char* argv[MAX_ARGS+1];
+    char* tok;
+    int argc = 0;
+    int status, fd;
+    pid_t pid;
+
+    strncpy(line, cmd, sizeof(line)-1);
+    line[sizeof(line)-1] = 0;
+    for (tok = strtok(line, " "); tok && (argc < MAX_ARGS); tok = strtok(NULL, " ")) {
+        argv[argc++] = tok;
+    }
+    argv[argc] = NULL;
+    if (argc == 0) return(-1);
+    snprintf(path, sizeof(path), "./%s", argv[0]);
+
+    fflush(stdout);
+    *t_start = monotonic_ns();
+    pid = fork();
+    if (pid == 0) {
+        fd = open("/dev/null", O_WRONLY);
+        if (fd >= 0) {
+            dup2(fd, 1);
+            dup2(fd, 2);
+            close(fd);
+        }
+        execv(path, argv);
+        _exit(127);
+    }
+    if (pid < 0) {
+        perror("fork");
+        return(-1);
+    }
+    while (waitpid(pid, &status, 0) < 0);
+    *t_end = monotonic_ns();
+    if (!WIFEXITED(status)) return(-1);
+    return(WEXITSTATUS(status));
+}
+
+int
+cmp_double(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return((x > y) - (x < y));
+}
+
+// nearest-rank percentile of n sorted values
+double
+percentile(double* v, int n, double p) {
+    int i = (int)((p/100.0)*n + 0.999999) - 1;
+    if (i < 0) i = 0;
+    if (i >= n) i = n-1;
+    return(v[i]);
+}
+
+// measures one command, and prints its breakdown.
+// returns 0 on success, otherwise 1
+int
+bench(const char* app, const char* cmd, int runs) {
+    char load[128];
+    unsigned long long t_start, t_end;
+    unsigned long long main_ns, open_ns, opened_ns, exit_ns, bus_ns, open_bus_ns, sleep_ns;
+    unsigned long long transactions, sleeps, tot_transactions = 0, tot_sleeps = 0;
+    double sum, tot = 0;
+    FILE* fp;
+    int r, p, n = 0, fails = 0;
+
+    // every command starts from the power-up state of its app
+    unlink(state_path);
+    unlink(shadow_path);
+    if (app) {
+        snprintf(load, sizeof(load), "eeload -r %s", app);
+        if (run_cmd(load, &t_start, &t_end) != 0) {
+            printf("%s: could not load %s\n", cmd, app);
+            return(1);
+        }
+    }
+
+    for (r=0; r<runs; r++) {
+        unlink(phase_path);
+        if (run_cmd(cmd, &t_start, &t_end) != 0) {
+            fails++;
+            continue;
+        }
+        fp = fopen(phase_path, "r");
+        if (fp == NULL) {
+            fails++;
+            continue;
+        }
+        if (fscanf(fp, DSP_PHASE_FORMAT, &main_ns, &open_ns, &opened_ns, &exit_ns, &bus_ns,
+                   &open_bus_ns, &sleep_ns, &transactions, &sleeps) != DSP_PHASE_FIELDS) {
+            fclose(fp);
+            fails++;
+            continue;
+        }
+        fclose(fp);
+        if (open_ns == 0) {
+            // no dsp_open(), e.g. eeload
+            open_ns = opened_ns = exit_ns;
+            open_bus_ns = 0;
+        }
+        phase_ms[0][n] = (main_ns - t_start) / 1e6;
+        phase_ms[1][n] = (open_ns - main_ns) / 1e6;
+        phase_ms[2][n] = (opened_ns - open_ns) / 1e6;
+        phase_ms[3][n] = (bus_ns - open_bus_ns) / 1e6;
+        phase_ms[4][n] = sleep_ns / 1e6;
+        phase_ms[5][n] = ((double)(exit_ns - opened_ns) - (bus_ns - open_bus_ns) - sleep_ns) / 1e6;
+        phase_ms[6][n] = (t_end - exit_ns) / 1e6;
+        phase_ms[PHASE_TOTAL][n] = (t_end - t_start) / 1e6;
+        tot_transactions += transactions;
+        tot_sleeps += sleeps;
+        n++;
+    }
+
+    printf("%s: %d runs", cmd, n);
+    if (fails) printf(", %d failed", fails);
+    printf("\n");
+    if (n == 0) return(1);
+    printf("  %llu I2C transactions and %llu sleeps per run\n", tot_transactions/n, tot_sleeps/n);
+    printf("  %-10s %10s %10s %10s %10s %10s\n", "msec", "p50", "p90", "p99", "max", "share");
+    for (r=0; r<n; r++) tot += phase_ms[PHASE_TOTAL][r];
+    for (p=0; p<NUM_PHASES; p++) {
+        sum = 0;
+        for (r=0; r<n; r++) sum += phase_ms[p][r];
+        qsort(phase_ms[p], n, sizeof(double), cmp_double);
+        printf("  %-10s %10.3f %10.3f %10.3f %10.3f %9.1f%%\n", phase_name[p],
+               percentile(phase_ms[p], n, 50), percentile(phase_ms[p], n, 90),
+               percentile(phase_ms[p], n, 99), phase_ms[p][n-1], 100.0*sum/tot);
+    }
+    return(0);
+}
+
+// ************* main program **********************
+ int
+ main(int argc, char **argv)
+ {
+    char* sw; // used for command-line arguments
+    char* app = NULL;
+    int runs = DEFAULT_RUNS;
+    int ret = 0;
+    unsigned int i;
+
+    sw = getCmdOption(argv, argv + argc, "-r");
+    if (sw) {
+        sscanf(sw, "%d", &runs);
+        if (runs < 1) runs = 1;
+        if (runs > MAX_RUNS) runs = MAX_RUNS;
+    }
+    app = getCmdOption(argv, argv + argc, "-a");
+
+    snprintf(state_path, sizeof(state_path), "/tmp/latbench-%d.state", (int)getpid());
+    snprintf(phase_path, sizeof(phase_path), "/tmp/latbench-%d.phases", (int)getpid());
+    snprintf(shadow_path, sizeof(shadow_path), "/tmp/latbench-%d.shadow", (int)getpid());
+    setenv("WAVEMINER_I2C", "fake", 0);
+    setenv("WAVEMINER_FAKE_STATE", state_path, 1);
+    setenv("WAVEMINER_SHADOW", shadow_path, 1);
+    setenv("WAVEMINER_PHASES", phase_path, 1);
+
+    sw = getCmdOption(argv, argv + argc, "-c");
+    if (sw) {
+        ret |= bench(app, sw, runs);
+    } else {
+        for (i=0; i<sizeof(default_cmds)/sizeof(default_cmds[0]); i++) {
+            ret |= bench(default_cmds[i].app, default_cmds[i].cmd, runs);
+        }
+    }
+
+    unlink(state_path);
+    unlink(phase_path);
+    unlink(shadow_path);
+    return(ret);
+ }
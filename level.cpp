@@ -39,7 +39,7 @@ const int LEVEL_NODE = 0x010a; // node is a 16-bit value
     dsp_open(); // create I2C handle for the DSP
 
     if (do_peak) {
-        v = readback(LEVEL_ADDR, LEVEL_NODE); 
+        v = readback_fast(LEVEL_ADDR, LEVEL_NODE); 
         printf("read a value of %lf\n", v);
     } 
 
@@ -0,0 +1,275 @@
+/*****************************************************
+ * loadgen - Parameter Update Load Generator
+ * rev 1 - october 2026
+ *
+ * Sends a mix of parameter updates and readbacks through
+ * dsputil at a target rate, to the fake DSP in this
+ * process (see i2cfake.h), and reports the rate that was
+ * achieved and the latency of each operation.
+ *
+ * The load is open loop: operation n is due at n/rate
+ * seconds after the start, whether or not the ones before
+ * it have finished. Operations run one at a time, as they
+ * would on one bus, so when the stack can't keep up they
+ * queue. For each operation:
+ *   queueing - time from when it was due until it started
+ *   service  - time it took to run
+ *   latency  - the two together
+ * Use -r 0 to send operations back to back, which gives
+ * the most the stack can sustain.
+ *
+ * The mix is a list of operation:weight pairs, from
+ *   amp      - set_amp
+ *   freq     - set_freq
+ *   filter   - set_gen_2nd_order_filter
+ *   safeload - set_gen_2nd_order_filter_safeload
+ *   dfilter6 - set_dfilter6
+ *   readback - readback_fast
+ * and the bus speed is set with -k (clock in Hz, each byte
+ * takes 9 clocks) and -l (fixed time per transaction).
+ * The shadow cache is off, so every update is sent.
+ *
+ * Example, 500 updates per second on a 100 kHz bus:
+ *      ./loadgen -r 500 -d 5 -k 100000 -m amp:4,freq:2,filter:2,readback:1
+ * Example to find the highest rate on a 400 kHz bus:
+ *      ./loadgen -r 0 -k 400000
+ *****************************************************/
+
+// includes
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <errno.h>
+ #include <time.h>
+ #include "options.h"
+ #include "dsputil.h"
+ #include "i2cfunc.h"
+ #include "i2cfake.h"
+ #include "stats.h"
+ #include "biquad.h"
+ #include "iir.h"
+
+// defines
+#define OP_AMP 0
+#define OP_FREQ 1
+#define OP_FILTER 2
+#define OP_SAFELOAD 3
+#define OP_DFILTER6 4
+#define OP_READBACK 5
+#define NUM_OPS 6
+
+#define DEFAULT_RATE 1000       // operations per second
+#define DEFAULT_DURATION 5.0    // seconds
+#define DEFAULT_CLOCK_HZ 100000 // standard mode I2C
+#define DEFAULT_MIX "amp:4,freq:2,filter:2,readback:1"
+
+// consts, as used by notch4.bin and freqresp.bin
+const int SIN_ADDR = 0x0000;
+const int AMP_ADDR = 0x0003;
+const int FILTER_NODE = 0x0004;
+const int LEVEL_ADDR = 0x081a;
+const int LEVEL_NODE = 0x00fe;
+
+const char* op_name[NUM_OPS] = {
+    "amp", "freq", "filter", "safeload", "dfilter6", "readback"
+};
+
+// externs
+extern char do_log;
+
+// globals
+int op_weight[NUM_OPS];
+stats_hist_t h_latency, h_service, h_queueing;
+stats_hist_t h_op[NUM_OPS]; // service time of each operation
+unsigned int seed = 1;
+
+// ************* functions *************************
+
+// pseudo-random number from 0 to n-1
+int
+rnd(int n) {
+    seed = seed*1103515245u + 12345u;
+    return((int)((seed >> 8) % (unsigned int)n));
+}
+
+// parses the mix, e.g. "amp:4,readback:1". returns 0, or -1 if it's invalid
+int
+parse_mix(const char* mix) {
+    char buf[256];
+    char* tok;
+    char* colon;
+    int i, w, total = 0;
+
+    memset(op_weight, 0, sizeof(op_weight));
+    strncpy(buf, mix, sizeof(buf)-1);
+    buf[sizeof(buf)-1] = 0;
+    for (tok = strtok(buf, ","); tok; tok = strtok(NULL, ",")) {
+        colon = strchr(tok, ':');
+        w = 1;
+        if (colon) {
+            *colon = 0;
+            w = atoi(colon+1);
+        }
+        for (i=0; i<NUM_OPS; i++) {
+            if (strcmp(tok, op_name[i]) == 0) break;
+        }
+        if ((i == NUM_OPS) || (w < 0)) {
+            printf("unknown operation '%s' in the mix\n", tok);
+            return(-1);
+        }
+        op_weight[i] += w;
+        total += w;
+    }
+    return((total > 0) ? 0 : -1);
+}
+
+// picks an operation according to the mix
+int
+pick_op(void) {
+    int total = 0, r, i;
+
+    for (i=0; i<NUM_OPS; i++) total += op_weight[i];
+    r = rnd(total);
+    for (i=0; i<NUM_OPS; i++) {
+        if (r < op_weight[i]) break;
+        r -= op_weight[i];
+    }
+    return(i);
+}
+
+// The filter operations design their coefficients first, as the notch,
+// filter and rms tools do
+void
+run_op(int op) {
+    double coeff[15];
+    double sec[IIR_MAX_SECTIONS][5];
+    int i;
+
+    switch (op) {
+        case OP_AMP:
+            set_amp(AMP_ADDR, rnd(1000)/1000.0);
+            break;
+        case OP_FREQ:
+            set_freq(SIN_ADDR, 20 + rnd(20000));
+            break;
+        case OP_FILTER:
+            biquad_notch(coeff, BIQUAD_FS, 40 + rnd(3961), BIQUAD_NOTCH_Q, 0);
+            set_gen_2nd_order_filter(FILTER_NODE, coeff);
+            break;
+        case OP_SAFELOAD:
+            biquad_notch(coeff, BIQUAD_FS, 40 + rnd(3961), BIQUAD_NOTCH_Q, 0);
+            set_gen_2nd_order_filter_safeload(FILTER_NODE, coeff);
+            break;
+        case OP_DFILTER6:
+            // 100 Hz to 15 kHz, a 6th order Butterworth survives rounding across all of it
+            if (iir_design(sec, IIR_BUTTERWORTH, IIR_LOWPASS, 6, BIQUAD_FS, 100 + rnd(597)*25, 1, 60) != 3) break;
+            for (i=0; i<15; i++) {
+                coeff[i] = ((i % 5) < 3) ? sec[i/5][i % 5] : 0-sec[i/5][i % 5]; // a1, a2 as stored
+            }
+            set_dfilter6(FILTER_NODE, coeff);
+            break;
+        case OP_READBACK:
+            readback_fast(LEVEL_ADDR, LEVEL_NODE);
+            break;
+    }
+}
+
+// sleep until a monotonic time
+void
+wait_until(unsigned long long t_ns) {
+    struct timespec a;
+    a.tv_sec = t_ns / 1000000000ULL;
+    a.tv_nsec = t_ns % 1000000000ULL;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &a, NULL) == EINTR);
+}
+
+void
+print_hist(const char* name, stats_hist_t* h) {
+    if (h->count == 0) return;
+    printf("  %-10s %8llu %10.1f %10.1f %10.1f %10.1f %10.1f\n", name, (unsigned long long)h->count,
+           h->sum/1e3/h->count, stats_percentile(h, 50)/1e3, stats_percentile(h, 99)/1e3,
+           stats_percentile(h, 99.9)/1e3, h->max/1e3);
+}
+
+// ************* main program **********************
+ int
+ main(int argc, char **argv)
+ {
+    char* sw; // used for command-line arguments
+    char env[32];
+    const char* mix = DEFAULT_MIX;
+    double rate = DEFAULT_RATE;
+    double duration = DEFAULT_DURATION;
+    double latency_us = 0;
+    long clock_hz = DEFAULT_CLOCK_HZ;
+    unsigned long long t_start, t_due, t_begin, t_end, n, nops;
+    int op, i;
+
+    sw = getCmdOption(argv, argv + argc, "-r");
+    if (sw) sscanf(sw, "%lf", &rate);
+    sw = getCmdOption(argv, argv + argc, "-d");
+    if (sw) sscanf(sw, "%lf", &duration);
+    sw = getCmdOption(argv, argv + argc, "-k");
+    if (sw) sscanf(sw, "%ld", &clock_hz);
+    sw = getCmdOption(argv, argv + argc, "-l");
+    if (sw) sscanf(sw, "%lf", &latency_us);
+    sw = getCmdOption(argv, argv + argc, "-m");
+    if (sw) mix = sw;
+    if ((rate < 0) || (duration <= 0) || (clock_hz < 0) || (latency_us < 0) || (parse_mix(mix) != 0)) {
+        printf("usage: %s [-r ops/sec] [-d sec] [-k bus Hz] [-l usec] [-m op:weight,...]\n", argv[0]);
+        return(1);
+    }
+
+    // the fake DSP, in memory, with the bus timing asked for
+    snprintf(env, sizeof(env), "%ld", clock_hz);
+    setenv("WAVEMINER_FAKE_CLOCK_HZ", env, 1);
+    snprintf(env, sizeof(env), "%f", latency_us);
+    setenv("WAVEMINER_FAKE_LATENCY_US", env, 1);
+    unsetenv("WAVEMINER_FAKE_STATE");
+    unsetenv("WAVEMINER_SIM");
+    setenv("WAVEMINER_SHADOW", "off", 1);
+    i2c_set_transport(&i2c_fake_transport);
+    do_log = 0;
+    dsp_open();
+
+    // with -r 0 there's no schedule, the next operation is due when the last ends
+    nops = (rate > 0) ? (unsigned long long)(rate*duration) : 0;
+    t_start = monotonic_ns();
+    t_end = t_start;
+    for (n=0; ; n++) {
+        if (rate > 0) {
+            if (n >= nops) break;
+            t_due = t_start + (unsigned long long)(n*1e9/rate);
+            if (t_due > monotonic_ns()) wait_until(t_due);
+        } else {
+            t_due = t_end;
+            if (t_due - t_start >= (unsigned long long)(duration*1e9)) break;
+        }
+        op = pick_op();
+        t_begin = monotonic_ns();
+        run_op(op);
+        t_end = monotonic_ns();
+        stats_hist_add(&h_queueing, t_begin - t_due);
+        stats_hist_add(&h_service, t_end - t_begin);
+        stats_hist_add(&h_latency, t_end - t_due);
+        stats_hist_add(&h_op[op], t_end - t_begin);
+    }
+    dsp_close();
+
+    if (rate > 0) {
+        printf("offered %.1f ops/sec for %.1f sec, ", rate, duration);
+    } else {
+        printf("back to back for %.1f sec, ", duration);
+    }
+    printf("achieved %.1f ops/sec (%llu ops)\n", n*1e9/(t_end - t_start), n);
+    printf("bus %ld Hz, %.1f usec per transaction, mix %s\n", clock_hz, latency_us, mix);
+    printf("  %-10s %8s %10s %10s %10s %10s %10s\n", "usec", "count", "mean", "p50", "p99", "p99.9", "max");
+    print_hist("latency", &h_latency);
+    print_hist("queueing", &h_queueing);
+    print_hist("service", &h_service);
+    for (i=0; i<NUM_OPS; i++) {
+        print_hist(op_name[i], &h_op[i]);
+    }
+
+    return(0);
+ }
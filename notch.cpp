@@ -1,11 +1,15 @@
 /*****************************************************
  * notch - Notch Tool
  * rev 1 - april 2022 - shabaz
+ * rev 2 - october 2026 - calculated coefficients
  *
  * uses notch4.bin
  * The notch tool can be used for applying up to two
  * notches to the input signal. The notch frequency
- * range is 40-4000 Hz, in 1 Hz steps. 
+ * can be anything below 24000 Hz, including fractions
+ * of a Hz. The coefficients are calculated (see biquad.h)
+ * with a Q of 35 unless -q is used, and -d limits the
+ * depth of the notches to that many dB.
  * first program the DSP board EEPROM using:
  * ./eeload -p notch4.bin
  * then power-cycle the DSP board for the EEPROM
@@ -20,12 +24,17 @@
  *      ./notch -n1 50 -n2 100
  * Example to notch out just 50 Hz twice (i.e. very deep notch):
  *      ./notch -n 50
+ * Example to notch out 16.7 Hz rail interference, wider:
+ *      ./notch -n 16.7 -q 10
+ * Example for a 20 dB dip at 5 kHz:
+ *      ./notch -n 5000 -d 20
  *****************************************************/
 
 // includes
  #include <stdio.h>
  #include "options.h"
  #include "dsputil.h"
+ #include "biquad.h"
 
 // defines
 
@@ -34,3972 +43,6 @@ const int SIN_ADDR = 0x0000;
 const int AMP_ADDR = 0x0003;
 const int FILTER_NODE = 0x0004; // address of first filter node
 
-// each row contains coeff b0, b1, b2, a1, a2:
-const double notchfiltcoeff[4000][5] = {
-    { 9.999252057693703E-01, -1.999822998084116E+00, 9.999252057693703E-01, -1.999822998084116E+00, 9.998504115387405E-01 }, /* 40 Hz */
-    { 9.999233360569481E-01, -1.999817870910316E+00, 9.999233360569481E-01, -1.999817870910316E+00, 9.998466721138961E-01 }, /* 41 Hz */
-    { 9.999214663515170E-01, -1.999812709489414E+00, 9.999214663515170E-01, -1.999812709489414E+00, 9.998429327030340E-01 }, /* 42 Hz */
-    { 9.999195966530779E-01, -1.999807513821627E+00, 9.999195966530779E-01, -1.999807513821627E+00, 9.998391933061559E-01 }, /* 43 Hz */
-    { 9.999177269616301E-01, -1.999802283907171E+00, 9.999177269616301E-01, -1.999802283907171E+00, 9.998354539232601E-01 }, /* 44 Hz */
-    { 9.999158572771737E-01, -1.999797019746264E+00, 9.999158572771737E-01, -1.999797019746264E+00, 9.998317145543474E-01 }, /* 45 Hz */
-    { 9.999139875997090E-01, -1.999791721339126E+00, 9.999139875997090E-01, -1.999791721339126E+00, 9.998279751994179E-01 }, /* 46 Hz */
-    { 9.999121179292355E-01, -1.999786388685973E+00, 9.999121179292355E-01, -1.999786388685973E+00, 9.998242358584710E-01 }, /* 47 Hz */
-    { 9.999102482657534E-01, -1.999781021787026E+00, 9.999102482657534E-01, -1.999781021787026E+00, 9.998204965315067E-01 }, /* 48 Hz */
-    { 9.999083786092623E-01, -1.999775620642504E+00, 9.999083786092623E-01, -1.999775620642504E+00, 9.998167572185246E-01 }, /* 49 Hz */
-    { 9.999065089597625E-01, -1.999770185252628E+00, 9.999065089597625E-01, -1.999770185252628E+00, 9.998130179195250E-01 }, /* 50 Hz */
-    { 9.999046393172538E-01, -1.999764715617620E+00, 9.999046393172538E-01, -1.999764715617620E+00, 9.998092786345076E-01 }, /* 51 Hz */
-    { 9.999027696817365E-01, -1.999759211737701E+00, 9.999027696817365E-01, -1.999759211737701E+00, 9.998055393634731E-01 }, /* 52 Hz */
-    { 9.999009000532101E-01, -1.999753673613093E+00, 9.999009000532101E-01, -1.999753673613093E+00, 9.998018001064202E-01 }, /* 53 Hz */
-    { 9.998990304316746E-01, -1.999748101244019E+00, 9.998990304316746E-01, -1.999748101244019E+00, 9.997980608633492E-01 }, /* 54 Hz */
-    { 9.998971608171301E-01, -1.999742494630703E+00, 9.998971608171301E-01, -1.999742494630703E+00, 9.997943216342602E-01 }, /* 55 Hz */
-    { 9.998952912095765E-01, -1.999736853773370E+00, 9.998952912095765E-01, -1.999736853773370E+00, 9.997905824191531E-01 }, /* 56 Hz */
-    { 9.998934216090136E-01, -1.999731178672241E+00, 9.998934216090136E-01, -1.999731178672241E+00, 9.997868432180272E-01 }, /* 57 Hz */
-    { 9.998915520154417E-01, -1.999725469327545E+00, 9.998915520154417E-01, -1.999725469327545E+00, 9.997831040308833E-01 }, /* 58 Hz */
-    { 9.998896824288604E-01, -1.999719725739506E+00, 9.998896824288604E-01, -1.999719725739506E+00, 9.997793648577209E-01 }, /* 59 Hz */
-    { 9.998878128492699E-01, -1.999713947908351E+00, 9.998878128492699E-01, -1.999713947908351E+00, 9.997756256985397E-01 }, /* 60 Hz */
-    { 9.998859432766700E-01, -1.999708135834307E+00, 9.998859432766700E-01, -1.999708135834307E+00, 9.997718865533400E-01 }, /* 61 Hz */
-    { 9.998840737110606E-01, -1.999702289517601E+00, 9.998840737110606E-01, -1.999702289517601E+00, 9.997681474221212E-01 }, /* 62 Hz */
-    { 9.998822041524417E-01, -1.999696408958462E+00, 9.998822041524417E-01, -1.999696408958462E+00, 9.997644083048833E-01 }, /* 63 Hz */
-    { 9.998803346008134E-01, -1.999690494157118E+00, 9.998803346008134E-01, -1.999690494157118E+00, 9.997606692016268E-01 }, /* 64 Hz */
-    { 9.998784650561755E-01, -1.999684545113799E+00, 9.998784650561755E-01, -1.999684545113799E+00, 9.997569301123510E-01 }, /* 65 Hz */
-    { 9.998765955185279E-01, -1.999678561828734E+00, 9.998765955185279E-01, -1.999678561828734E+00, 9.997531910370558E-01 }, /* 66 Hz */
-    { 9.998747259878705E-01, -1.999672544302154E+00, 9.998747259878705E-01, -1.999672544302154E+00, 9.997494519757411E-01 }, /* 67 Hz */
-    { 9.998728564642035E-01, -1.999666492534290E+00, 9.998728564642035E-01, -1.999666492534290E+00, 9.997457129284071E-01 }, /* 68 Hz */
-    { 9.998709869475269E-01, -1.999660406525374E+00, 9.998709869475269E-01, -1.999660406525374E+00, 9.997419738950537E-01 }, /* 69 Hz */
-    { 9.998691174378402E-01, -1.999654286275639E+00, 9.998691174378402E-01, -1.999654286275639E+00, 9.997382348756805E-01 }, /* 70 Hz */
-    { 9.998672479351437E-01, -1.999648131785316E+00, 9.998672479351437E-01, -1.999648131785316E+00, 9.997344958702874E-01 }, /* 71 Hz */
-    { 9.998653784394372E-01, -1.999641943054639E+00, 9.998653784394372E-01, -1.999641943054639E+00, 9.997307568788745E-01 }, /* 72 Hz */
-    { 9.998635089507206E-01, -1.999635720083843E+00, 9.998635089507206E-01, -1.999635720083843E+00, 9.997270179014413E-01 }, /* 73 Hz */
-    { 9.998616394689943E-01, -1.999629462873162E+00, 9.998616394689943E-01, -1.999629462873162E+00, 9.997232789379886E-01 }, /* 74 Hz */
-    { 9.998597699942576E-01, -1.999623171422831E+00, 9.998597699942576E-01, -1.999623171422831E+00, 9.997195399885153E-01 }, /* 75 Hz */
-    { 9.998579005265108E-01, -1.999616845733086E+00, 9.998579005265108E-01, -1.999616845733086E+00, 9.997158010530216E-01 }, /* 76 Hz */
-    { 9.998560310657537E-01, -1.999610485804163E+00, 9.998560310657537E-01, -1.999610485804163E+00, 9.997120621315074E-01 }, /* 77 Hz */
-    { 9.998541616119866E-01, -1.999604091636299E+00, 9.998541616119866E-01, -1.999604091636299E+00, 9.997083232239732E-01 }, /* 78 Hz */
-    { 9.998522921652091E-01, -1.999597663229733E+00, 9.998522921652091E-01, -1.999597663229733E+00, 9.997045843304182E-01 }, /* 79 Hz */
-    { 9.998504227254211E-01, -1.999591200584700E+00, 9.998504227254211E-01, -1.999591200584700E+00, 9.997008454508423E-01 }, /* 80 Hz */
-    { 9.998485532926229E-01, -1.999584703701442E+00, 9.998485532926229E-01, -1.999584703701442E+00, 9.996971065852458E-01 }, /* 81 Hz */
-    { 9.998466838668141E-01, -1.999578172580196E+00, 9.998466838668141E-01, -1.999578172580196E+00, 9.996933677336282E-01 }, /* 82 Hz */
-    { 9.998448144479948E-01, -1.999571607221203E+00, 9.998448144479948E-01, -1.999571607221203E+00, 9.996896288959896E-01 }, /* 83 Hz */
-    { 9.998429450361649E-01, -1.999565007624703E+00, 9.998429450361649E-01, -1.999565007624703E+00, 9.996858900723298E-01 }, /* 84 Hz */
-    { 9.998410756313243E-01, -1.999558373790937E+00, 9.998410756313243E-01, -1.999558373790937E+00, 9.996821512626486E-01 }, /* 85 Hz */
-    { 9.998392062334731E-01, -1.999551705720147E+00, 9.998392062334731E-01, -1.999551705720147E+00, 9.996784124669462E-01 }, /* 86 Hz */
-    { 9.998373368426111E-01, -1.999545003412575E+00, 9.998373368426111E-01, -1.999545003412575E+00, 9.996746736852222E-01 }, /* 87 Hz */
-    { 9.998354674587384E-01, -1.999538266868464E+00, 9.998354674587384E-01, -1.999538266868464E+00, 9.996709349174768E-01 }, /* 88 Hz */
-    { 9.998335980818549E-01, -1.999531496088057E+00, 9.998335980818549E-01, -1.999531496088057E+00, 9.996671961637098E-01 }, /* 89 Hz */
-    { 9.998317287119606E-01, -1.999524691071598E+00, 9.998317287119606E-01, -1.999524691071598E+00, 9.996634574239212E-01 }, /* 90 Hz */
-    { 9.998298593490552E-01, -1.999517851819332E+00, 9.998298593490552E-01, -1.999517851819332E+00, 9.996597186981104E-01 }, /* 91 Hz */
-    { 9.998279899931388E-01, -1.999510978331504E+00, 9.998279899931388E-01, -1.999510978331504E+00, 9.996559799862776E-01 }, /* 92 Hz */
-    { 9.998261206442114E-01, -1.999504070608359E+00, 9.998261206442114E-01, -1.999504070608359E+00, 9.996522412884228E-01 }, /* 93 Hz */
-    { 9.998242513022728E-01, -1.999497128650144E+00, 9.998242513022728E-01, -1.999497128650144E+00, 9.996485026045456E-01 }, /* 94 Hz */
-    { 9.998223819673233E-01, -1.999490152457106E+00, 9.998223819673233E-01, -1.999490152457106E+00, 9.996447639346466E-01 }, /* 95 Hz */
-    { 9.998205126393623E-01, -1.999483142029492E+00, 9.998205126393623E-01, -1.999483142029492E+00, 9.996410252787247E-01 }, /* 96 Hz */
-    { 9.998186433183903E-01, -1.999476097367550E+00, 9.998186433183903E-01, -1.999476097367550E+00, 9.996372866367806E-01 }, /* 97 Hz */
-    { 9.998167740044068E-01, -1.999469018471529E+00, 9.998167740044068E-01, -1.999469018471529E+00, 9.996335480088137E-01 }, /* 98 Hz */
-    { 9.998149046974122E-01, -1.999461905341679E+00, 9.998149046974122E-01, -1.999461905341679E+00, 9.996298093948244E-01 }, /* 99 Hz */
-    { 9.998130353974061E-01, -1.999454757978248E+00, 9.998130353974061E-01, -1.999454757978248E+00, 9.996260707948121E-01 }, /* 100 Hz */
-    { 9.998111661043884E-01, -1.999447576381488E+00, 9.998111661043884E-01, -1.999447576381488E+00, 9.996223322087767E-01 }, /* 101 Hz */
-    { 9.998092968183593E-01, -1.999440360551649E+00, 9.998092968183593E-01, -1.999440360551649E+00, 9.996185936367186E-01 }, /* 102 Hz */
-    { 9.998074275393185E-01, -1.999433110488983E+00, 9.998074275393185E-01, -1.999433110488983E+00, 9.996148550786370E-01 }, /* 103 Hz */
-    { 9.998055582672661E-01, -1.999425826193742E+00, 9.998055582672661E-01, -1.999425826193742E+00, 9.996111165345323E-01 }, /* 104 Hz */
-    { 9.998036890022022E-01, -1.999418507666179E+00, 9.998036890022022E-01, -1.999418507666179E+00, 9.996073780044044E-01 }, /* 105 Hz */
-    { 9.998018197441264E-01, -1.999411154906547E+00, 9.998018197441264E-01, -1.999411154906547E+00, 9.996036394882528E-01 }, /* 106 Hz */
-    { 9.997999504930389E-01, -1.999403767915100E+00, 9.997999504930389E-01, -1.999403767915100E+00, 9.995999009860779E-01 }, /* 107 Hz */
-    { 9.997980812489397E-01, -1.999396346692093E+00, 9.997980812489397E-01, -1.999396346692093E+00, 9.995961624978793E-01 }, /* 108 Hz */
-    { 9.997962120118282E-01, -1.999388891237780E+00, 9.997962120118282E-01, -1.999388891237780E+00, 9.995924240236564E-01 }, /* 109 Hz */
-    { 9.997943427817053E-01, -1.999381401552418E+00, 9.997943427817053E-01, -1.999381401552418E+00, 9.995886855634106E-01 }, /* 110 Hz */
-    { 9.997924735585701E-01, -1.999373877636262E+00, 9.997924735585701E-01, -1.999373877636262E+00, 9.995849471171403E-01 }, /* 111 Hz */
-    { 9.997906043424230E-01, -1.999366319489569E+00, 9.997906043424230E-01, -1.999366319489569E+00, 9.995812086848459E-01 }, /* 112 Hz */
-    { 9.997887351332637E-01, -1.999358727112598E+00, 9.997887351332637E-01, -1.999358727112598E+00, 9.995774702665274E-01 }, /* 113 Hz */
-    { 9.997868659310923E-01, -1.999351100505605E+00, 9.997868659310923E-01, -1.999351100505605E+00, 9.995737318621847E-01 }, /* 114 Hz */
-    { 9.997849967359087E-01, -1.999343439668849E+00, 9.997849967359087E-01, -1.999343439668849E+00, 9.995699934718174E-01 }, /* 115 Hz */
-    { 9.997831275477129E-01, -1.999335744602591E+00, 9.997831275477129E-01, -1.999335744602591E+00, 9.995662550954258E-01 }, /* 116 Hz */
-    { 9.997812583665047E-01, -1.999328015307088E+00, 9.997812583665047E-01, -1.999328015307088E+00, 9.995625167330093E-01 }, /* 117 Hz */
-    { 9.997793891922843E-01, -1.999320251782603E+00, 9.997793891922843E-01, -1.999320251782603E+00, 9.995587783845685E-01 }, /* 118 Hz */
-    { 9.997775200250514E-01, -1.999312454029394E+00, 9.997775200250514E-01, -1.999312454029394E+00, 9.995550400501028E-01 }, /* 119 Hz */
-    { 9.997756508648061E-01, -1.999304622047726E+00, 9.997756508648061E-01, -1.999304622047726E+00, 9.995513017296123E-01 }, /* 120 Hz */
-    { 9.997737817115483E-01, -1.999296755837858E+00, 9.997737817115483E-01, -1.999296755837858E+00, 9.995475634230966E-01 }, /* 121 Hz */
-    { 9.997719125652780E-01, -1.999288855400054E+00, 9.997719125652780E-01, -1.999288855400054E+00, 9.995438251305560E-01 }, /* 122 Hz */
-    { 9.997700434259948E-01, -1.999280920734578E+00, 9.997700434259948E-01, -1.999280920734578E+00, 9.995400868519897E-01 }, /* 123 Hz */
-    { 9.997681742936991E-01, -1.999272951841692E+00, 9.997681742936991E-01, -1.999272951841692E+00, 9.995363485873983E-01 }, /* 124 Hz */
-    { 9.997663051683907E-01, -1.999264948721662E+00, 9.997663051683907E-01, -1.999264948721662E+00, 9.995326103367814E-01 }, /* 125 Hz */
-    { 9.997644360500697E-01, -1.999256911374753E+00, 9.997644360500697E-01, -1.999256911374753E+00, 9.995288721001394E-01 }, /* 126 Hz */
-    { 9.997625669387357E-01, -1.999248839801230E+00, 9.997625669387357E-01, -1.999248839801230E+00, 9.995251338774713E-01 }, /* 127 Hz */
-    { 9.997606978343888E-01, -1.999240734001359E+00, 9.997606978343888E-01, -1.999240734001359E+00, 9.995213956687776E-01 }, /* 128 Hz */
-    { 9.997588287370290E-01, -1.999232593975408E+00, 9.997588287370290E-01, -1.999232593975408E+00, 9.995176574740581E-01 }, /* 129 Hz */
-    { 9.997569596466561E-01, -1.999224419723642E+00, 9.997569596466561E-01, -1.999224419723642E+00, 9.995139192933122E-01 }, /* 130 Hz */
-    { 9.997550905632704E-01, -1.999216211246332E+00, 9.997550905632704E-01, -1.999216211246332E+00, 9.995101811265408E-01 }, /* 131 Hz */
-    { 9.997532214868717E-01, -1.999207968543744E+00, 9.997532214868717E-01, -1.999207968543744E+00, 9.995064429737435E-01 }, /* 132 Hz */
-    { 9.997513524174596E-01, -1.999199691616149E+00, 9.997513524174596E-01, -1.999199691616149E+00, 9.995027048349192E-01 }, /* 133 Hz */
-    { 9.997494833550346E-01, -1.999191380463816E+00, 9.997494833550346E-01, -1.999191380463816E+00, 9.994989667100691E-01 }, /* 134 Hz */
-    { 9.997476142995960E-01, -1.999183035087014E+00, 9.997476142995960E-01, -1.999183035087014E+00, 9.994952285991920E-01 }, /* 135 Hz */
-    { 9.997457452511443E-01, -1.999174655486015E+00, 9.997457452511443E-01, -1.999174655486015E+00, 9.994914905022887E-01 }, /* 136 Hz */
-    { 9.997438762096793E-01, -1.999166241661091E+00, 9.997438762096793E-01, -1.999166241661091E+00, 9.994877524193586E-01 }, /* 137 Hz */
-    { 9.997420071752008E-01, -1.999157793612514E+00, 9.997420071752008E-01, -1.999157793612514E+00, 9.994840143504016E-01 }, /* 138 Hz */
-    { 9.997401381477089E-01, -1.999149311340555E+00, 9.997401381477089E-01, -1.999149311340555E+00, 9.994802762954178E-01 }, /* 139 Hz */
-    { 9.997382691272035E-01, -1.999140794845490E+00, 9.997382691272035E-01, -1.999140794845490E+00, 9.994765382544071E-01 }, /* 140 Hz */
-    { 9.997364001136845E-01, -1.999132244127590E+00, 9.997364001136845E-01, -1.999132244127590E+00, 9.994728002273690E-01 }, /* 141 Hz */
-    { 9.997345311071520E-01, -1.999123659187131E+00, 9.997345311071520E-01, -1.999123659187131E+00, 9.994690622143041E-01 }, /* 142 Hz */
-    { 9.997326621076059E-01, -1.999115040024387E+00, 9.997326621076059E-01, -1.999115040024387E+00, 9.994653242152118E-01 }, /* 143 Hz */
-    { 9.997307931150460E-01, -1.999106386639634E+00, 9.997307931150460E-01, -1.999106386639634E+00, 9.994615862300920E-01 }, /* 144 Hz */
-    { 9.997289241294722E-01, -1.999097699033149E+00, 9.997289241294722E-01, -1.999097699033149E+00, 9.994578482589445E-01 }, /* 145 Hz */
-    { 9.997270551508848E-01, -1.999088977205207E+00, 9.997270551508848E-01, -1.999088977205207E+00, 9.994541103017696E-01 }, /* 146 Hz */
-    { 9.997251861792833E-01, -1.999080221156087E+00, 9.997251861792833E-01, -1.999080221156087E+00, 9.994503723585666E-01 }, /* 147 Hz */
-    { 9.997233172146681E-01, -1.999071430886066E+00, 9.997233172146681E-01, -1.999071430886066E+00, 9.994466344293362E-01 }, /* 148 Hz */
-    { 9.997214482570388E-01, -1.999062606395423E+00, 9.997214482570388E-01, -1.999062606395423E+00, 9.994428965140776E-01 }, /* 149 Hz */
-    { 9.997195793063955E-01, -1.999053747684436E+00, 9.997195793063955E-01, -1.999053747684436E+00, 9.994391586127911E-01 }, /* 150 Hz */
-    { 9.997177103627384E-01, -1.999044854753386E+00, 9.997177103627384E-01, -1.999044854753386E+00, 9.994354207254768E-01 }, /* 151 Hz */
-    { 9.997158414260667E-01, -1.999035927602552E+00, 9.997158414260667E-01, -1.999035927602552E+00, 9.994316828521335E-01 }, /* 152 Hz */
-    { 9.997139724963812E-01, -1.999026966232216E+00, 9.997139724963812E-01, -1.999026966232216E+00, 9.994279449927623E-01 }, /* 153 Hz */
-    { 9.997121035736812E-01, -1.999017970642659E+00, 9.997121035736812E-01, -1.999017970642659E+00, 9.994242071473625E-01 }, /* 154 Hz */
-    { 9.997102346579672E-01, -1.999008940834162E+00, 9.997102346579672E-01, -1.999008940834162E+00, 9.994204693159343E-01 }, /* 155 Hz */
-    { 9.997083657492386E-01, -1.998999876807009E+00, 9.997083657492386E-01, -1.998999876807009E+00, 9.994167314984772E-01 }, /* 156 Hz */
-    { 9.997064968474957E-01, -1.998990778561482E+00, 9.997064968474957E-01, -1.998990778561482E+00, 9.994129936949914E-01 }, /* 157 Hz */
-    { 9.997046279527384E-01, -1.998981646097866E+00, 9.997046279527384E-01, -1.998981646097866E+00, 9.994092559054768E-01 }, /* 158 Hz */
-    { 9.997027590649666E-01, -1.998972479416445E+00, 9.997027590649666E-01, -1.998972479416445E+00, 9.994055181299333E-01 }, /* 159 Hz */
-    { 9.997008901841803E-01, -1.998963278517502E+00, 9.997008901841803E-01, -1.998963278517502E+00, 9.994017803683606E-01 }, /* 160 Hz */
-    { 9.996990213103794E-01, -1.998954043401326E+00, 9.996990213103794E-01, -1.998954043401326E+00, 9.993980426207587E-01 }, /* 161 Hz */
-    { 9.996971524435637E-01, -1.998944774068199E+00, 9.996971524435637E-01, -1.998944774068199E+00, 9.993943048871274E-01 }, /* 162 Hz */
-    { 9.996952835837334E-01, -1.998935470518411E+00, 9.996952835837334E-01, -1.998935470518411E+00, 9.993905671674668E-01 }, /* 163 Hz */
-    { 9.996934147308884E-01, -1.998926132752248E+00, 9.996934147308884E-01, -1.998926132752248E+00, 9.993868294617767E-01 }, /* 164 Hz */
-    { 9.996915458850286E-01, -1.998916760769998E+00, 9.996915458850286E-01, -1.998916760769998E+00, 9.993830917700572E-01 }, /* 165 Hz */
-    { 9.996896770461536E-01, -1.998907354571949E+00, 9.996896770461536E-01, -1.998907354571949E+00, 9.993793540923073E-01 }, /* 166 Hz */
-    { 9.996878082142643E-01, -1.998897914158390E+00, 9.996878082142643E-01, -1.998897914158390E+00, 9.993756164285286E-01 }, /* 167 Hz */
-    { 9.996859393893597E-01, -1.998888439529612E+00, 9.996859393893597E-01, -1.998888439529612E+00, 9.993718787787194E-01 }, /* 168 Hz */
-    { 9.996840705714399E-01, -1.998878930685903E+00, 9.996840705714399E-01, -1.998878930685903E+00, 9.993681411428799E-01 }, /* 169 Hz */
-    { 9.996822017605052E-01, -1.998869387627555E+00, 9.996822017605052E-01, -1.998869387627555E+00, 9.993644035210103E-01 }, /* 170 Hz */
-    { 9.996803329565556E-01, -1.998859810354860E+00, 9.996803329565556E-01, -1.998859810354860E+00, 9.993606659131111E-01 }, /* 171 Hz */
-    { 9.996784641595905E-01, -1.998850198868108E+00, 9.996784641595905E-01, -1.998850198868108E+00, 9.993569283191810E-01 }, /* 172 Hz */
-    { 9.996765953696103E-01, -1.998840553167593E+00, 9.996765953696103E-01, -1.998840553167593E+00, 9.993531907392206E-01 }, /* 173 Hz */
-    { 9.996747265866149E-01, -1.998830873253608E+00, 9.996747265866149E-01, -1.998830873253608E+00, 9.993494531732299E-01 }, /* 174 Hz */
-    { 9.996728578106041E-01, -1.998821159126447E+00, 9.996728578106041E-01, -1.998821159126447E+00, 9.993457156212082E-01 }, /* 175 Hz */
-    { 9.996709890415779E-01, -1.998811410786403E+00, 9.996709890415779E-01, -1.998811410786403E+00, 9.993419780831558E-01 }, /* 176 Hz */
-    { 9.996691202795362E-01, -1.998801628233771E+00, 9.996691202795362E-01, -1.998801628233771E+00, 9.993382405590725E-01 }, /* 177 Hz */
-    { 9.996672515244793E-01, -1.998791811468848E+00, 9.996672515244793E-01, -1.998791811468848E+00, 9.993345030489587E-01 }, /* 178 Hz */
-    { 9.996653827764067E-01, -1.998781960491929E+00, 9.996653827764067E-01, -1.998781960491929E+00, 9.993307655528134E-01 }, /* 179 Hz */
-    { 9.996635140353183E-01, -1.998772075303309E+00, 9.996635140353183E-01, -1.998772075303309E+00, 9.993270280706366E-01 }, /* 180 Hz */
-    { 9.996616453012145E-01, -1.998762155903288E+00, 9.996616453012145E-01, -1.998762155903288E+00, 9.993232906024290E-01 }, /* 181 Hz */
-    { 9.996597765740951E-01, -1.998752202292164E+00, 9.996597765740951E-01, -1.998752202292164E+00, 9.993195531481902E-01 }, /* 182 Hz */
-    { 9.996579078539597E-01, -1.998742214470232E+00, 9.996579078539597E-01, -1.998742214470232E+00, 9.993158157079194E-01 }, /* 183 Hz */
-    { 9.996560391408086E-01, -1.998732192437793E+00, 9.996560391408086E-01, -1.998732192437793E+00, 9.993120782816172E-01 }, /* 184 Hz */
-    { 9.996541704346417E-01, -1.998722136195147E+00, 9.996541704346417E-01, -1.998722136195147E+00, 9.993083408692833E-01 }, /* 185 Hz */
-    { 9.996523017354588E-01, -1.998712045742594E+00, 9.996523017354588E-01, -1.998712045742594E+00, 9.993046034709177E-01 }, /* 186 Hz */
-    { 9.996504330432600E-01, -1.998701921080433E+00, 9.996504330432600E-01, -1.998701921080433E+00, 9.993008660865199E-01 }, /* 187 Hz */
-    { 9.996485643580452E-01, -1.998691762208967E+00, 9.996485643580452E-01, -1.998691762208967E+00, 9.992971287160903E-01 }, /* 188 Hz */
-    { 9.996466956798143E-01, -1.998681569128498E+00, 9.996466956798143E-01, -1.998681569128498E+00, 9.992933913596287E-01 }, /* 189 Hz */
-    { 9.996448270085674E-01, -1.998671341839328E+00, 9.996448270085674E-01, -1.998671341839328E+00, 9.992896540171348E-01 }, /* 190 Hz */
-    { 9.996429583443043E-01, -1.998661080341759E+00, 9.996429583443043E-01, -1.998661080341759E+00, 9.992859166886086E-01 }, /* 191 Hz */
-    { 9.996410896870248E-01, -1.998650784636096E+00, 9.996410896870248E-01, -1.998650784636096E+00, 9.992821793740496E-01 }, /* 192 Hz */
-    { 9.996392210367292E-01, -1.998640454722642E+00, 9.996392210367292E-01, -1.998640454722642E+00, 9.992784420734584E-01 }, /* 193 Hz */
-    { 9.996373523934173E-01, -1.998630090601704E+00, 9.996373523934173E-01, -1.998630090601704E+00, 9.992747047868347E-01 }, /* 194 Hz */
-    { 9.996354837570891E-01, -1.998619692273585E+00, 9.996354837570891E-01, -1.998619692273585E+00, 9.992709675141782E-01 }, /* 195 Hz */
-    { 9.996336151277442E-01, -1.998609259738592E+00, 9.996336151277442E-01, -1.998609259738592E+00, 9.992672302554884E-01 }, /* 196 Hz */
-    { 9.996317465053831E-01, -1.998598792997031E+00, 9.996317465053831E-01, -1.998598792997031E+00, 9.992634930107662E-01 }, /* 197 Hz */
-    { 9.996298778900052E-01, -1.998588292049210E+00, 9.996298778900052E-01, -1.998588292049210E+00, 9.992597557800105E-01 }, /* 198 Hz */
-    { 9.996280092816109E-01, -1.998577756895436E+00, 9.996280092816109E-01, -1.998577756895436E+00, 9.992560185632218E-01 }, /* 199 Hz */
-    { 9.996261406802001E-01, -1.998567187536018E+00, 9.996261406802001E-01, -1.998567187536018E+00, 9.992522813604001E-01 }, /* 200 Hz */
-    { 9.996242720857723E-01, -1.998556583971264E+00, 9.996242720857723E-01, -1.998556583971264E+00, 9.992485441715446E-01 }, /* 201 Hz */
-    { 9.996224034983280E-01, -1.998545946201484E+00, 9.996224034983280E-01, -1.998545946201484E+00, 9.992448069966560E-01 }, /* 202 Hz */
-    { 9.996205349178668E-01, -1.998535274226988E+00, 9.996205349178668E-01, -1.998535274226988E+00, 9.992410698357337E-01 }, /* 203 Hz */
-    { 9.996186663443889E-01, -1.998524568048086E+00, 9.996186663443889E-01, -1.998524568048086E+00, 9.992373326887778E-01 }, /* 204 Hz */
-    { 9.996167977778940E-01, -1.998513827665091E+00, 9.996167977778940E-01, -1.998513827665091E+00, 9.992335955557881E-01 }, /* 205 Hz */
-    { 9.996149292183820E-01, -1.998503053078312E+00, 9.996149292183820E-01, -1.998503053078312E+00, 9.992298584367640E-01 }, /* 206 Hz */
-    { 9.996130606658532E-01, -1.998492244288064E+00, 9.996130606658532E-01, -1.998492244288064E+00, 9.992261213317064E-01 }, /* 207 Hz */
-    { 9.996111921203072E-01, -1.998481401294659E+00, 9.996111921203072E-01, -1.998481401294659E+00, 9.992223842406145E-01 }, /* 208 Hz */
-    { 9.996093235817444E-01, -1.998470524098411E+00, 9.996093235817444E-01, -1.998470524098411E+00, 9.992186471634887E-01 }, /* 209 Hz */
-    { 9.996074550501642E-01, -1.998459612699633E+00, 9.996074550501642E-01, -1.998459612699633E+00, 9.992149101003285E-01 }, /* 210 Hz */
-    { 9.996055865255667E-01, -1.998448667098640E+00, 9.996055865255667E-01, -1.998448667098640E+00, 9.992111730511335E-01 }, /* 211 Hz */
-    { 9.996037180079521E-01, -1.998437687295749E+00, 9.996037180079521E-01, -1.998437687295749E+00, 9.992074360159042E-01 }, /* 212 Hz */
-    { 9.996018494973202E-01, -1.998426673291274E+00, 9.996018494973202E-01, -1.998426673291274E+00, 9.992036989946405E-01 }, /* 213 Hz */
-    { 9.995999809936710E-01, -1.998415625085532E+00, 9.995999809936710E-01, -1.998415625085532E+00, 9.991999619873420E-01 }, /* 214 Hz */
-    { 9.995981124970041E-01, -1.998404542678840E+00, 9.995981124970041E-01, -1.998404542678840E+00, 9.991962249940083E-01 }, /* 215 Hz */
-    { 9.995962440073199E-01, -1.998393426071516E+00, 9.995962440073199E-01, -1.998393426071516E+00, 9.991924880146399E-01 }, /* 216 Hz */
-    { 9.995943755246183E-01, -1.998382275263878E+00, 9.995943755246183E-01, -1.998382275263878E+00, 9.991887510492365E-01 }, /* 217 Hz */
-    { 9.995925070488989E-01, -1.998371090256245E+00, 9.995925070488989E-01, -1.998371090256245E+00, 9.991850140977978E-01 }, /* 218 Hz */
-    { 9.995906385801621E-01, -1.998359871048936E+00, 9.995906385801621E-01, -1.998359871048936E+00, 9.991812771603241E-01 }, /* 219 Hz */
-    { 9.995887701184074E-01, -1.998348617642271E+00, 9.995887701184074E-01, -1.998348617642271E+00, 9.991775402368148E-01 }, /* 220 Hz */
-    { 9.995869016636352E-01, -1.998337330036572E+00, 9.995869016636352E-01, -1.998337330036572E+00, 9.991738033272703E-01 }, /* 221 Hz */
-    { 9.995850332158449E-01, -1.998326008232158E+00, 9.995850332158449E-01, -1.998326008232158E+00, 9.991700664316898E-01 }, /* 222 Hz */
-    { 9.995831647750372E-01, -1.998314652229352E+00, 9.995831647750372E-01, -1.998314652229352E+00, 9.991663295500743E-01 }, /* 223 Hz */
-    { 9.995812963412112E-01, -1.998303262028476E+00, 9.995812963412112E-01, -1.998303262028476E+00, 9.991625926824224E-01 }, /* 224 Hz */
-    { 9.995794279143676E-01, -1.998291837629853E+00, 9.995794279143676E-01, -1.998291837629853E+00, 9.991588558287352E-01 }, /* 225 Hz */
-    { 9.995775594945057E-01, -1.998280379033807E+00, 9.995775594945057E-01, -1.998280379033807E+00, 9.991551189890113E-01 }, /* 226 Hz */
-    { 9.995756910816260E-01, -1.998268886240661E+00, 9.995756910816260E-01, -1.998268886240661E+00, 9.991513821632521E-01 }, /* 227 Hz */
-    { 9.995738226757280E-01, -1.998257359250740E+00, 9.995738226757280E-01, -1.998257359250740E+00, 9.991476453514561E-01 }, /* 228 Hz */
-    { 9.995719542768120E-01, -1.998245798064370E+00, 9.995719542768120E-01, -1.998245798064370E+00, 9.991439085536240E-01 }, /* 229 Hz */
-    { 9.995700858848777E-01, -1.998234202681875E+00, 9.995700858848777E-01, -1.998234202681875E+00, 9.991401717697554E-01 }, /* 230 Hz */
-    { 9.995682174999253E-01, -1.998222573103584E+00, 9.995682174999253E-01, -1.998222573103584E+00, 9.991364349998506E-01 }, /* 231 Hz */
-    { 9.995663491219545E-01, -1.998210909329823E+00, 9.995663491219545E-01, -1.998210909329823E+00, 9.991326982439090E-01 }, /* 232 Hz */
-    { 9.995644807509655E-01, -1.998199211360918E+00, 9.995644807509655E-01, -1.998199211360918E+00, 9.991289615019310E-01 }, /* 233 Hz */
-    { 9.995626123869580E-01, -1.998187479197199E+00, 9.995626123869580E-01, -1.998187479197199E+00, 9.991252247739160E-01 }, /* 234 Hz */
-    { 9.995607440299319E-01, -1.998175712838995E+00, 9.995607440299319E-01, -1.998175712838995E+00, 9.991214880598638E-01 }, /* 235 Hz */
-    { 9.995588756798873E-01, -1.998163912286633E+00, 9.995588756798873E-01, -1.998163912286633E+00, 9.991177513597747E-01 }, /* 236 Hz */
-    { 9.995570073368242E-01, -1.998152077540445E+00, 9.995570073368242E-01, -1.998152077540445E+00, 9.991140146736484E-01 }, /* 237 Hz */
-    { 9.995551390007424E-01, -1.998140208600761E+00, 9.995551390007424E-01, -1.998140208600761E+00, 9.991102780014849E-01 }, /* 238 Hz */
-    { 9.995532706716422E-01, -1.998128305467913E+00, 9.995532706716422E-01, -1.998128305467913E+00, 9.991065413432845E-01 }, /* 239 Hz */
-    { 9.995514023495230E-01, -1.998116368142230E+00, 9.995514023495230E-01, -1.998116368142230E+00, 9.991028046990460E-01 }, /* 240 Hz */
-    { 9.995495340343852E-01, -1.998104396624047E+00, 9.995495340343852E-01, -1.998104396624047E+00, 9.990990680687704E-01 }, /* 241 Hz */
-    { 9.995476657262284E-01, -1.998092390913696E+00, 9.995476657262284E-01, -1.998092390913696E+00, 9.990953314524569E-01 }, /* 242 Hz */
-    { 9.995457974250528E-01, -1.998080351011509E+00, 9.995457974250528E-01, -1.998080351011509E+00, 9.990915948501056E-01 }, /* 243 Hz */
-    { 9.995439291308584E-01, -1.998068276917823E+00, 9.995439291308584E-01, -1.998068276917823E+00, 9.990878582617169E-01 }, /* 244 Hz */
-    { 9.995420608436447E-01, -1.998056168632969E+00, 9.995420608436447E-01, -1.998056168632969E+00, 9.990841216872894E-01 }, /* 245 Hz */
-    { 9.995401925634123E-01, -1.998044026157285E+00, 9.995401925634123E-01, -1.998044026157285E+00, 9.990803851268246E-01 }, /* 246 Hz */
-    { 9.995383242901607E-01, -1.998031849491106E+00, 9.995383242901607E-01, -1.998031849491106E+00, 9.990766485803213E-01 }, /* 247 Hz */
-    { 9.995364560238899E-01, -1.998019638634768E+00, 9.995364560238899E-01, -1.998019638634768E+00, 9.990729120477797E-01 }, /* 248 Hz */
-    { 9.995345877645999E-01, -1.998007393588608E+00, 9.995345877645999E-01, -1.998007393588608E+00, 9.990691755291998E-01 }, /* 249 Hz */
-    { 9.995327195122906E-01, -1.997995114352963E+00, 9.995327195122906E-01, -1.997995114352963E+00, 9.990654390245812E-01 }, /* 250 Hz */
-    { 9.995308512669623E-01, -1.997982800928172E+00, 9.995308512669623E-01, -1.997982800928172E+00, 9.990617025339246E-01 }, /* 251 Hz */
-    { 9.995289830286145E-01, -1.997970453314574E+00, 9.995289830286145E-01, -1.997970453314574E+00, 9.990579660572290E-01 }, /* 252 Hz */
-    { 9.995271147972471E-01, -1.997958071512506E+00, 9.995271147972471E-01, -1.997958071512506E+00, 9.990542295944942E-01 }, /* 253 Hz */
-    { 9.995252465728605E-01, -1.997945655522311E+00, 9.995252465728605E-01, -1.997945655522311E+00, 9.990504931457209E-01 }, /* 254 Hz */
-    { 9.995233783554542E-01, -1.997933205344327E+00, 9.995233783554542E-01, -1.997933205344327E+00, 9.990467567109085E-01 }, /* 255 Hz */
-    { 9.995215101450285E-01, -1.997920720978897E+00, 9.995215101450285E-01, -1.997920720978897E+00, 9.990430202900571E-01 }, /* 256 Hz */
-    { 9.995196419415832E-01, -1.997908202426360E+00, 9.995196419415832E-01, -1.997908202426360E+00, 9.990392838831663E-01 }, /* 257 Hz */
-    { 9.995177737451182E-01, -1.997895649687061E+00, 9.995177737451182E-01, -1.997895649687061E+00, 9.990355474902364E-01 }, /* 258 Hz */
-    { 9.995159055556334E-01, -1.997883062761341E+00, 9.995159055556334E-01, -1.997883062761341E+00, 9.990318111112668E-01 }, /* 259 Hz */
-    { 9.995140373731290E-01, -1.997870441649544E+00, 9.995140373731290E-01, -1.997870441649544E+00, 9.990280747462581E-01 }, /* 260 Hz */
-    { 9.995121691976048E-01, -1.997857786352013E+00, 9.995121691976048E-01, -1.997857786352013E+00, 9.990243383952095E-01 }, /* 261 Hz */
-    { 9.995103010290604E-01, -1.997845096869094E+00, 9.995103010290604E-01, -1.997845096869094E+00, 9.990206020581207E-01 }, /* 262 Hz */
-    { 9.995084328674962E-01, -1.997832373201130E+00, 9.995084328674962E-01, -1.997832373201130E+00, 9.990168657349925E-01 }, /* 263 Hz */
-    { 9.995065647129122E-01, -1.997819615348470E+00, 9.995065647129122E-01, -1.997819615348470E+00, 9.990131294258244E-01 }, /* 264 Hz */
-    { 9.995046965653082E-01, -1.997806823311458E+00, 9.995046965653082E-01, -1.997806823311458E+00, 9.990093931306163E-01 }, /* 265 Hz */
-    { 9.995028284246841E-01, -1.997793997090441E+00, 9.995028284246841E-01, -1.997793997090441E+00, 9.990056568493682E-01 }, /* 266 Hz */
-    { 9.995009602910397E-01, -1.997781136685766E+00, 9.995009602910397E-01, -1.997781136685766E+00, 9.990019205820795E-01 }, /* 267 Hz */
-    { 9.994990921643753E-01, -1.997768242097782E+00, 9.994990921643753E-01, -1.997768242097782E+00, 9.989981843287505E-01 }, /* 268 Hz */
-    { 9.994972240446904E-01, -1.997755313326837E+00, 9.994972240446904E-01, -1.997755313326837E+00, 9.989944480893809E-01 }, /* 269 Hz */
-    { 9.994953559319855E-01, -1.997742350373281E+00, 9.994953559319855E-01, -1.997742350373281E+00, 9.989907118639709E-01 }, /* 270 Hz */
-    { 9.994934878262600E-01, -1.997729353237463E+00, 9.994934878262600E-01, -1.997729353237463E+00, 9.989869756525200E-01 }, /* 271 Hz */
-    { 9.994916197275143E-01, -1.997716321919734E+00, 9.994916197275143E-01, -1.997716321919734E+00, 9.989832394550286E-01 }, /* 272 Hz */
-    { 9.994897516357480E-01, -1.997703256420444E+00, 9.994897516357480E-01, -1.997703256420444E+00, 9.989795032714961E-01 }, /* 273 Hz */
-    { 9.994878835509614E-01, -1.997690156739946E+00, 9.994878835509614E-01, -1.997690156739946E+00, 9.989757671019228E-01 }, /* 274 Hz */
-    { 9.994860154731541E-01, -1.997677022878590E+00, 9.994860154731541E-01, -1.997677022878590E+00, 9.989720309463082E-01 }, /* 275 Hz */
-    { 9.994841474023264E-01, -1.997663854836731E+00, 9.994841474023264E-01, -1.997663854836731E+00, 9.989682948046528E-01 }, /* 276 Hz */
-    { 9.994822793384780E-01, -1.997650652614721E+00, 9.994822793384780E-01, -1.997650652614721E+00, 9.989645586769560E-01 }, /* 277 Hz */
-    { 9.994804112816086E-01, -1.997637416212913E+00, 9.994804112816086E-01, -1.997637416212913E+00, 9.989608225632172E-01 }, /* 278 Hz */
-    { 9.994785432317186E-01, -1.997624145631663E+00, 9.994785432317186E-01, -1.997624145631663E+00, 9.989570864634372E-01 }, /* 279 Hz */
-    { 9.994766751888079E-01, -1.997610840871326E+00, 9.994766751888079E-01, -1.997610840871326E+00, 9.989533503776158E-01 }, /* 280 Hz */
-    { 9.994748071528764E-01, -1.997597501932257E+00, 9.994748071528764E-01, -1.997597501932257E+00, 9.989496143057528E-01 }, /* 281 Hz */
-    { 9.994729391239237E-01, -1.997584128814812E+00, 9.994729391239237E-01, -1.997584128814812E+00, 9.989458782478473E-01 }, /* 282 Hz */
-    { 9.994710711019501E-01, -1.997570721519349E+00, 9.994710711019501E-01, -1.997570721519349E+00, 9.989421422039002E-01 }, /* 283 Hz */
-    { 9.994692030869557E-01, -1.997557280046224E+00, 9.994692030869557E-01, -1.997557280046224E+00, 9.989384061739115E-01 }, /* 284 Hz */
-    { 9.994673350789401E-01, -1.997543804395795E+00, 9.994673350789401E-01, -1.997543804395795E+00, 9.989346701578803E-01 }, /* 285 Hz */
-    { 9.994654670779035E-01, -1.997530294568422E+00, 9.994654670779035E-01, -1.997530294568422E+00, 9.989309341558070E-01 }, /* 286 Hz */
-    { 9.994635990838455E-01, -1.997516750564462E+00, 9.994635990838455E-01, -1.997516750564462E+00, 9.989271981676910E-01 }, /* 287 Hz */
-    { 9.994617310967664E-01, -1.997503172384276E+00, 9.994617310967664E-01, -1.997503172384276E+00, 9.989234621935328E-01 }, /* 288 Hz */
-    { 9.994598631166659E-01, -1.997489560028224E+00, 9.994598631166659E-01, -1.997489560028224E+00, 9.989197262333318E-01 }, /* 289 Hz */
-    { 9.994579951435444E-01, -1.997475913496668E+00, 9.994579951435444E-01, -1.997475913496668E+00, 9.989159902870888E-01 }, /* 290 Hz */
-    { 9.994561271774012E-01, -1.997462232789968E+00, 9.994561271774012E-01, -1.997462232789968E+00, 9.989122543548024E-01 }, /* 291 Hz */
-    { 9.994542592182367E-01, -1.997448517908486E+00, 9.994542592182367E-01, -1.997448517908486E+00, 9.989085184364734E-01 }, /* 292 Hz */
-    { 9.994523912660507E-01, -1.997434768852585E+00, 9.994523912660507E-01, -1.997434768852585E+00, 9.989047825321014E-01 }, /* 293 Hz */
-    { 9.994505233208429E-01, -1.997420985622629E+00, 9.994505233208429E-01, -1.997420985622629E+00, 9.989010466416859E-01 }, /* 294 Hz */
-    { 9.994486553826137E-01, -1.997407168218980E+00, 9.994486553826137E-01, -1.997407168218980E+00, 9.988973107652275E-01 }, /* 295 Hz */
-    { 9.994467874513630E-01, -1.997393316642005E+00, 9.994467874513630E-01, -1.997393316642005E+00, 9.988935749027259E-01 }, /* 296 Hz */
-    { 9.994449195270906E-01, -1.997379430892066E+00, 9.994449195270906E-01, -1.997379430892066E+00, 9.988898390541812E-01 }, /* 297 Hz */
-    { 9.994430516097964E-01, -1.997365510969531E+00, 9.994430516097964E-01, -1.997365510969531E+00, 9.988861032195928E-01 }, /* 298 Hz */
-    { 9.994411836994802E-01, -1.997351556874764E+00, 9.994411836994802E-01, -1.997351556874764E+00, 9.988823673989604E-01 }, /* 299 Hz */
-    { 9.994393157961424E-01, -1.997337568608134E+00, 9.994393157961424E-01, -1.997337568608134E+00, 9.988786315922848E-01 }, /* 300 Hz */
-    { 9.994374478997825E-01, -1.997323546170006E+00, 9.994374478997825E-01, -1.997323546170006E+00, 9.988748957995650E-01 }, /* 301 Hz */
-    { 9.994355800104007E-01, -1.997309489560749E+00, 9.994355800104007E-01, -1.997309489560749E+00, 9.988711600208013E-01 }, /* 302 Hz */
-    { 9.994337121279970E-01, -1.997295398780732E+00, 9.994337121279970E-01, -1.997295398780732E+00, 9.988674242559941E-01 }, /* 303 Hz */
-    { 9.994318442525713E-01, -1.997281273830324E+00, 9.994318442525713E-01, -1.997281273830324E+00, 9.988636885051425E-01 }, /* 304 Hz */
-    { 9.994299763841233E-01, -1.997267114709893E+00, 9.994299763841233E-01, -1.997267114709893E+00, 9.988599527682467E-01 }, /* 305 Hz */
-    { 9.994281085226532E-01, -1.997252921419811E+00, 9.994281085226532E-01, -1.997252921419811E+00, 9.988562170453064E-01 }, /* 306 Hz */
-    { 9.994262406681607E-01, -1.997238693960447E+00, 9.994262406681607E-01, -1.997238693960447E+00, 9.988524813363213E-01 }, /* 307 Hz */
-    { 9.994243728206461E-01, -1.997224432332174E+00, 9.994243728206461E-01, -1.997224432332174E+00, 9.988487456412922E-01 }, /* 308 Hz */
-    { 9.994225049801093E-01, -1.997210136535364E+00, 9.994225049801093E-01, -1.997210136535364E+00, 9.988450099602186E-01 }, /* 309 Hz */
-    { 9.994206371465499E-01, -1.997195806570389E+00, 9.994206371465499E-01, -1.997195806570389E+00, 9.988412742930999E-01 }, /* 310 Hz */
-    { 9.994187693199681E-01, -1.997181442437621E+00, 9.994187693199681E-01, -1.997181442437621E+00, 9.988375386399362E-01 }, /* 311 Hz */
-    { 9.994169015003640E-01, -1.997167044137436E+00, 9.994169015003640E-01, -1.997167044137436E+00, 9.988338030007280E-01 }, /* 312 Hz */
-    { 9.994150336877373E-01, -1.997152611670207E+00, 9.994150336877373E-01, -1.997152611670207E+00, 9.988300673754746E-01 }, /* 313 Hz */
-    { 9.994131658820881E-01, -1.997138145036308E+00, 9.994131658820881E-01, -1.997138145036308E+00, 9.988263317641761E-01 }, /* 314 Hz */
-    { 9.994112980834160E-01, -1.997123644236116E+00, 9.994112980834160E-01, -1.997123644236116E+00, 9.988225961668320E-01 }, /* 315 Hz */
-    { 9.994094302917214E-01, -1.997109109270006E+00, 9.994094302917214E-01, -1.997109109270006E+00, 9.988188605834427E-01 }, /* 316 Hz */
-    { 9.994075625070040E-01, -1.997094540138356E+00, 9.994075625070040E-01, -1.997094540138356E+00, 9.988151250140080E-01 }, /* 317 Hz */
-    { 9.994056947292640E-01, -1.997079936841542E+00, 9.994056947292640E-01, -1.997079936841542E+00, 9.988113894585280E-01 }, /* 318 Hz */
-    { 9.994038269585009E-01, -1.997065299379942E+00, 9.994038269585009E-01, -1.997065299379942E+00, 9.988076539170019E-01 }, /* 319 Hz */
-    { 9.994019591947150E-01, -1.997050627753935E+00, 9.994019591947150E-01, -1.997050627753935E+00, 9.988039183894299E-01 }, /* 320 Hz */
-    { 9.994000914379061E-01, -1.997035921963899E+00, 9.994000914379061E-01, -1.997035921963899E+00, 9.988001828758122E-01 }, /* 321 Hz */
-    { 9.993982236880743E-01, -1.997021182010214E+00, 9.993982236880743E-01, -1.997021182010214E+00, 9.987964473761486E-01 }, /* 322 Hz */
-    { 9.993963559452194E-01, -1.997006407893260E+00, 9.993963559452194E-01, -1.997006407893260E+00, 9.987927118904387E-01 }, /* 323 Hz */
-    { 9.993944882093412E-01, -1.996991599613418E+00, 9.993944882093412E-01, -1.996991599613418E+00, 9.987889764186824E-01 }, /* 324 Hz */
-    { 9.993926204804402E-01, -1.996976757171069E+00, 9.993926204804402E-01, -1.996976757171069E+00, 9.987852409608804E-01 }, /* 325 Hz */
-    { 9.993907527585157E-01, -1.996961880566596E+00, 9.993907527585157E-01, -1.996961880566596E+00, 9.987815055170315E-01 }, /* 326 Hz */
-    { 9.993888850435680E-01, -1.996946969800379E+00, 9.993888850435680E-01, -1.996946969800379E+00, 9.987777700871361E-01 }, /* 327 Hz */
-    { 9.993870173355972E-01, -1.996932024872804E+00, 9.993870173355972E-01, -1.996932024872804E+00, 9.987740346711944E-01 }, /* 328 Hz */
-    { 9.993851496346028E-01, -1.996917045784252E+00, 9.993851496346028E-01, -1.996917045784252E+00, 9.987702992692056E-01 }, /* 329 Hz */
-    { 9.993832819405850E-01, -1.996902032535109E+00, 9.993832819405850E-01, -1.996902032535109E+00, 9.987665638811700E-01 }, /* 330 Hz */
-    { 9.993814142535439E-01, -1.996886985125759E+00, 9.993814142535439E-01, -1.996886985125759E+00, 9.987628285070878E-01 }, /* 331 Hz */
-    { 9.993795465734792E-01, -1.996871903556588E+00, 9.993795465734792E-01, -1.996871903556588E+00, 9.987590931469583E-01 }, /* 332 Hz */
-    { 9.993776789003910E-01, -1.996856787827981E+00, 9.993776789003910E-01, -1.996856787827981E+00, 9.987553578007820E-01 }, /* 333 Hz */
-    { 9.993758112342790E-01, -1.996841637940326E+00, 9.993758112342790E-01, -1.996841637940326E+00, 9.987516224685580E-01 }, /* 334 Hz */
-    { 9.993739435751433E-01, -1.996826453894008E+00, 9.993739435751433E-01, -1.996826453894008E+00, 9.987478871502866E-01 }, /* 335 Hz */
-    { 9.993720759229840E-01, -1.996811235689417E+00, 9.993720759229840E-01, -1.996811235689417E+00, 9.987441518459681E-01 }, /* 336 Hz */
-    { 9.993702082778008E-01, -1.996795983326939E+00, 9.993702082778008E-01, -1.996795983326939E+00, 9.987404165556015E-01 }, /* 337 Hz */
-    { 9.993683406395939E-01, -1.996780696806965E+00, 9.993683406395939E-01, -1.996780696806965E+00, 9.987366812791878E-01 }, /* 338 Hz */
-    { 9.993664730083630E-01, -1.996765376129884E+00, 9.993664730083630E-01, -1.996765376129884E+00, 9.987329460167260E-01 }, /* 339 Hz */
-    { 9.993646053841082E-01, -1.996750021296085E+00, 9.993646053841082E-01, -1.996750021296085E+00, 9.987292107682164E-01 }, /* 340 Hz */
-    { 9.993627377668295E-01, -1.996734632305959E+00, 9.993627377668295E-01, -1.996734632305959E+00, 9.987254755336590E-01 }, /* 341 Hz */
-    { 9.993608701565266E-01, -1.996719209159898E+00, 9.993608701565266E-01, -1.996719209159898E+00, 9.987217403130533E-01 }, /* 342 Hz */
-    { 9.993590025531998E-01, -1.996703751858293E+00, 9.993590025531998E-01, -1.996703751858293E+00, 9.987180051063995E-01 }, /* 343 Hz */
-    { 9.993571349568489E-01, -1.996688260401537E+00, 9.993571349568489E-01, -1.996688260401537E+00, 9.987142699136977E-01 }, /* 344 Hz */
-    { 9.993552673674735E-01, -1.996672734790022E+00, 9.993552673674735E-01, -1.996672734790022E+00, 9.987105347349470E-01 }, /* 345 Hz */
-    { 9.993533997850740E-01, -1.996657175024143E+00, 9.993533997850740E-01, -1.996657175024143E+00, 9.987067995701480E-01 }, /* 346 Hz */
-    { 9.993515322096503E-01, -1.996641581104293E+00, 9.993515322096503E-01, -1.996641581104293E+00, 9.987030644193007E-01 }, /* 347 Hz */
-    { 9.993496646412021E-01, -1.996625953030867E+00, 9.993496646412021E-01, -1.996625953030867E+00, 9.986993292824042E-01 }, /* 348 Hz */
-    { 9.993477970797295E-01, -1.996610290804260E+00, 9.993477970797295E-01, -1.996610290804260E+00, 9.986955941594591E-01 }, /* 349 Hz */
-    { 9.993459295252325E-01, -1.996594594424869E+00, 9.993459295252325E-01, -1.996594594424869E+00, 9.986918590504650E-01 }, /* 350 Hz */
-    { 9.993440619777109E-01, -1.996578863893089E+00, 9.993440619777109E-01, -1.996578863893089E+00, 9.986881239554217E-01 }, /* 351 Hz */
-    { 9.993421944371648E-01, -1.996563099209318E+00, 9.993421944371648E-01, -1.996563099209318E+00, 9.986843888743295E-01 }, /* 352 Hz */
-    { 9.993403269035940E-01, -1.996547300373953E+00, 9.993403269035940E-01, -1.996547300373953E+00, 9.986806538071880E-01 }, /* 353 Hz */
-    { 9.993384593769987E-01, -1.996531467387393E+00, 9.993384593769987E-01, -1.996531467387393E+00, 9.986769187539974E-01 }, /* 354 Hz */
-    { 9.993365918573786E-01, -1.996515600250036E+00, 9.993365918573786E-01, -1.996515600250036E+00, 9.986731837147571E-01 }, /* 355 Hz */
-    { 9.993347243447337E-01, -1.996499698962281E+00, 9.993347243447337E-01, -1.996499698962281E+00, 9.986694486894674E-01 }, /* 356 Hz */
-    { 9.993328568390639E-01, -1.996483763524530E+00, 9.993328568390639E-01, -1.996483763524530E+00, 9.986657136781278E-01 }, /* 357 Hz */
-    { 9.993309893403693E-01, -1.996467793937182E+00, 9.993309893403693E-01, -1.996467793937182E+00, 9.986619786807387E-01 }, /* 358 Hz */
-    { 9.993291218486497E-01, -1.996451790200638E+00, 9.993291218486497E-01, -1.996451790200638E+00, 9.986582436972995E-01 }, /* 359 Hz */
-    { 9.993272543639055E-01, -1.996435752315301E+00, 9.993272543639055E-01, -1.996435752315301E+00, 9.986545087278109E-01 }, /* 360 Hz */
-    { 9.993253868861358E-01, -1.996419680281571E+00, 9.993253868861358E-01, -1.996419680281571E+00, 9.986507737722716E-01 }, /* 361 Hz */
-    { 9.993235194153413E-01, -1.996403574099853E+00, 9.993235194153413E-01, -1.996403574099853E+00, 9.986470388306825E-01 }, /* 362 Hz */
-    { 9.993216519515213E-01, -1.996387433770549E+00, 9.993216519515213E-01, -1.996387433770549E+00, 9.986433039030427E-01 }, /* 363 Hz */
-    { 9.993197844946764E-01, -1.996371259294065E+00, 9.993197844946764E-01, -1.996371259294065E+00, 9.986395689893528E-01 }, /* 364 Hz */
-    { 9.993179170448062E-01, -1.996355050670804E+00, 9.993179170448062E-01, -1.996355050670804E+00, 9.986358340896124E-01 }, /* 365 Hz */
-    { 9.993160496019107E-01, -1.996338807901171E+00, 9.993160496019107E-01, -1.996338807901171E+00, 9.986320992038213E-01 }, /* 366 Hz */
-    { 9.993141821659899E-01, -1.996322530985573E+00, 9.993141821659899E-01, -1.996322530985573E+00, 9.986283643319798E-01 }, /* 367 Hz */
-    { 9.993123147370436E-01, -1.996306219924416E+00, 9.993123147370436E-01, -1.996306219924416E+00, 9.986246294740873E-01 }, /* 368 Hz */
-    { 9.993104473150721E-01, -1.996289874718107E+00, 9.993104473150721E-01, -1.996289874718107E+00, 9.986208946301443E-01 }, /* 369 Hz */
-    { 9.993085799000748E-01, -1.996273495367052E+00, 9.993085799000748E-01, -1.996273495367052E+00, 9.986171598001496E-01 }, /* 370 Hz */
-    { 9.993067124920521E-01, -1.996257081871661E+00, 9.993067124920521E-01, -1.996257081871661E+00, 9.986134249841041E-01 }, /* 371 Hz */
-    { 9.993048450910037E-01, -1.996240634232342E+00, 9.993048450910037E-01, -1.996240634232342E+00, 9.986096901820074E-01 }, /* 372 Hz */
-    { 9.993029776969297E-01, -1.996224152449505E+00, 9.993029776969297E-01, -1.996224152449505E+00, 9.986059553938593E-01 }, /* 373 Hz */
-    { 9.993011103098299E-01, -1.996207636523559E+00, 9.993011103098299E-01, -1.996207636523559E+00, 9.986022206196599E-01 }, /* 374 Hz */
-    { 9.992992429297044E-01, -1.996191086454915E+00, 9.992992429297044E-01, -1.996191086454915E+00, 9.985984858594088E-01 }, /* 375 Hz */
-    { 9.992973755565532E-01, -1.996174502243984E+00, 9.992973755565532E-01, -1.996174502243984E+00, 9.985947511131064E-01 }, /* 376 Hz */
-    { 9.992955081903759E-01, -1.996157883891177E+00, 9.992955081903759E-01, -1.996157883891177E+00, 9.985910163807519E-01 }, /* 377 Hz */
-    { 9.992936408311730E-01, -1.996141231396907E+00, 9.992936408311730E-01, -1.996141231396907E+00, 9.985872816623460E-01 }, /* 378 Hz */
-    { 9.992917734789438E-01, -1.996124544761586E+00, 9.992917734789438E-01, -1.996124544761586E+00, 9.985835469578876E-01 }, /* 379 Hz */
-    { 9.992899061336887E-01, -1.996107823985628E+00, 9.992899061336887E-01, -1.996107823985628E+00, 9.985798122673775E-01 }, /* 380 Hz */
-    { 9.992880387954076E-01, -1.996091069069447E+00, 9.992880387954076E-01, -1.996091069069447E+00, 9.985760775908152E-01 }, /* 381 Hz */
-    { 9.992861714641003E-01, -1.996074280013457E+00, 9.992861714641003E-01, -1.996074280013457E+00, 9.985723429282005E-01 }, /* 382 Hz */
-    { 9.992843041397669E-01, -1.996057456818073E+00, 9.992843041397669E-01, -1.996057456818073E+00, 9.985686082795338E-01 }, /* 383 Hz */
-    { 9.992824368224071E-01, -1.996040599483712E+00, 9.992824368224071E-01, -1.996040599483712E+00, 9.985648736448143E-01 }, /* 384 Hz */
-    { 9.992805695120213E-01, -1.996023708010789E+00, 9.992805695120213E-01, -1.996023708010789E+00, 9.985611390240425E-01 }, /* 385 Hz */
-    { 9.992787022086089E-01, -1.996006782399721E+00, 9.992787022086089E-01, -1.996006782399721E+00, 9.985574044172179E-01 }, /* 386 Hz */
-    { 9.992768349121701E-01, -1.995989822650926E+00, 9.992768349121701E-01, -1.995989822650926E+00, 9.985536698243402E-01 }, /* 387 Hz */
-    { 9.992749676227050E-01, -1.995972828764822E+00, 9.992749676227050E-01, -1.995972828764822E+00, 9.985499352454099E-01 }, /* 388 Hz */
-    { 9.992731003402133E-01, -1.995955800741828E+00, 9.992731003402133E-01, -1.995955800741828E+00, 9.985462006804267E-01 }, /* 389 Hz */
-    { 9.992712330646952E-01, -1.995938738582362E+00, 9.992712330646952E-01, -1.995938738582362E+00, 9.985424661293905E-01 }, /* 390 Hz */
-    { 9.992693657961503E-01, -1.995921642286844E+00, 9.992693657961503E-01, -1.995921642286844E+00, 9.985387315923007E-01 }, /* 391 Hz */
-    { 9.992674985345790E-01, -1.995904511855696E+00, 9.992674985345790E-01, -1.995904511855696E+00, 9.985349970691579E-01 }, /* 392 Hz */
-    { 9.992656312799807E-01, -1.995887347289336E+00, 9.992656312799807E-01, -1.995887347289336E+00, 9.985312625599614E-01 }, /* 393 Hz */
-    { 9.992637640323560E-01, -1.995870148588188E+00, 9.992637640323560E-01, -1.995870148588188E+00, 9.985275280647119E-01 }, /* 394 Hz */
-    { 9.992618967917042E-01, -1.995852915752674E+00, 9.992618967917042E-01, -1.995852915752674E+00, 9.985237935834084E-01 }, /* 395 Hz */
-    { 9.992600295580256E-01, -1.995835648783216E+00, 9.992600295580256E-01, -1.995835648783216E+00, 9.985200591160512E-01 }, /* 396 Hz */
-    { 9.992581623313200E-01, -1.995818347680236E+00, 9.992581623313200E-01, -1.995818347680236E+00, 9.985163246626401E-01 }, /* 397 Hz */
-    { 9.992562951115878E-01, -1.995801012444161E+00, 9.992562951115878E-01, -1.995801012444161E+00, 9.985125902231755E-01 }, /* 398 Hz */
-    { 9.992544278988282E-01, -1.995783643075413E+00, 9.992544278988282E-01, -1.995783643075413E+00, 9.985088557976565E-01 }, /* 399 Hz */
-    { 9.992525606930418E-01, -1.995766239574418E+00, 9.992525606930418E-01, -1.995766239574418E+00, 9.985051213860836E-01 }, /* 400 Hz */
-    { 9.992506934942280E-01, -1.995748801941601E+00, 9.992506934942280E-01, -1.995748801941601E+00, 9.985013869884560E-01 }, /* 401 Hz */
-    { 9.992488263023872E-01, -1.995731330177388E+00, 9.992488263023872E-01, -1.995731330177388E+00, 9.984976526047744E-01 }, /* 402 Hz */
-    { 9.992469591175193E-01, -1.995713824282207E+00, 9.992469591175193E-01, -1.995713824282207E+00, 9.984939182350385E-01 }, /* 403 Hz */
-    { 9.992450919396239E-01, -1.995696284256485E+00, 9.992450919396239E-01, -1.995696284256485E+00, 9.984901838792477E-01 }, /* 404 Hz */
-    { 9.992432247687013E-01, -1.995678710100649E+00, 9.992432247687013E-01, -1.995678710100649E+00, 9.984864495374026E-01 }, /* 405 Hz */
-    { 9.992413576047512E-01, -1.995661101815128E+00, 9.992413576047512E-01, -1.995661101815128E+00, 9.984827152095024E-01 }, /* 406 Hz */
-    { 9.992394904477738E-01, -1.995643459400352E+00, 9.992394904477738E-01, -1.995643459400352E+00, 9.984789808955477E-01 }, /* 407 Hz */
-    { 9.992376232977688E-01, -1.995625782856749E+00, 9.992376232977688E-01, -1.995625782856749E+00, 9.984752465955375E-01 }, /* 408 Hz */
-    { 9.992357561547366E-01, -1.995608072184752E+00, 9.992357561547366E-01, -1.995608072184752E+00, 9.984715123094732E-01 }, /* 409 Hz */
-    { 9.992338890186765E-01, -1.995590327384788E+00, 9.992338890186765E-01, -1.995590327384788E+00, 9.984677780373530E-01 }, /* 410 Hz */
-    { 9.992320218895886E-01, -1.995572548457291E+00, 9.992320218895886E-01, -1.995572548457291E+00, 9.984640437791772E-01 }, /* 411 Hz */
-    { 9.992301547674733E-01, -1.995554735402694E+00, 9.992301547674733E-01, -1.995554735402694E+00, 9.984603095349467E-01 }, /* 412 Hz */
-    { 9.992282876523301E-01, -1.995536888221427E+00, 9.992282876523301E-01, -1.995536888221427E+00, 9.984565753046601E-01 }, /* 413 Hz */
-    { 9.992264205441591E-01, -1.995519006913924E+00, 9.992264205441591E-01, -1.995519006913924E+00, 9.984528410883182E-01 }, /* 414 Hz */
-    { 9.992245534429605E-01, -1.995501091480620E+00, 9.992245534429605E-01, -1.995501091480620E+00, 9.984491068859209E-01 }, /* 415 Hz */
-    { 9.992226863487337E-01, -1.995483141921948E+00, 9.992226863487337E-01, -1.995483141921948E+00, 9.984453726974674E-01 }, /* 416 Hz */
-    { 9.992208192614792E-01, -1.995465158238344E+00, 9.992208192614792E-01, -1.995465158238344E+00, 9.984416385229584E-01 }, /* 417 Hz */
-    { 9.992189521811965E-01, -1.995447140430243E+00, 9.992189521811965E-01, -1.995447140430243E+00, 9.984379043623930E-01 }, /* 418 Hz */
-    { 9.992170851078859E-01, -1.995429088498080E+00, 9.992170851078859E-01, -1.995429088498080E+00, 9.984341702157717E-01 }, /* 419 Hz */
-    { 9.992152180415471E-01, -1.995411002442294E+00, 9.992152180415471E-01, -1.995411002442294E+00, 9.984304360830942E-01 }, /* 420 Hz */
-    { 9.992133509821801E-01, -1.995392882263320E+00, 9.992133509821801E-01, -1.995392882263320E+00, 9.984267019643602E-01 }, /* 421 Hz */
-    { 9.992114839297849E-01, -1.995374727961597E+00, 9.992114839297849E-01, -1.995374727961597E+00, 9.984229678595697E-01 }, /* 422 Hz */
-    { 9.992096168843616E-01, -1.995356539537564E+00, 9.992096168843616E-01, -1.995356539537564E+00, 9.984192337687232E-01 }, /* 423 Hz */
-    { 9.992077498459097E-01, -1.995338316991659E+00, 9.992077498459097E-01, -1.995338316991659E+00, 9.984154996918193E-01 }, /* 424 Hz */
-    { 9.992058828144297E-01, -1.995320060324322E+00, 9.992058828144297E-01, -1.995320060324322E+00, 9.984117656288594E-01 }, /* 425 Hz */
-    { 9.992040157899210E-01, -1.995301769535992E+00, 9.992040157899210E-01, -1.995301769535992E+00, 9.984080315798420E-01 }, /* 426 Hz */
-    { 9.992021487723841E-01, -1.995283444627112E+00, 9.992021487723841E-01, -1.995283444627112E+00, 9.984042975447682E-01 }, /* 427 Hz */
-    { 9.992002817618184E-01, -1.995265085598122E+00, 9.992002817618184E-01, -1.995265085598122E+00, 9.984005635236368E-01 }, /* 428 Hz */
-    { 9.991984147582244E-01, -1.995246692449464E+00, 9.991984147582244E-01, -1.995246692449464E+00, 9.983968295164487E-01 }, /* 429 Hz */
-    { 9.991965477616016E-01, -1.995228265181581E+00, 9.991965477616016E-01, -1.995228265181581E+00, 9.983930955232032E-01 }, /* 430 Hz */
-    { 9.991946807719503E-01, -1.995209803794916E+00, 9.991946807719503E-01, -1.995209803794916E+00, 9.983893615439006E-01 }, /* 431 Hz */
-    { 9.991928137892701E-01, -1.995191308289911E+00, 9.991928137892701E-01, -1.995191308289911E+00, 9.983856275785401E-01 }, /* 432 Hz */
-    { 9.991909468135609E-01, -1.995172778667012E+00, 9.991909468135609E-01, -1.995172778667012E+00, 9.983818936271218E-01 }, /* 433 Hz */
-    { 9.991890798448233E-01, -1.995154214926665E+00, 9.991890798448233E-01, -1.995154214926665E+00, 9.983781596896466E-01 }, /* 434 Hz */
-    { 9.991872128830566E-01, -1.995135617069313E+00, 9.991872128830566E-01, -1.995135617069313E+00, 9.983744257661131E-01 }, /* 435 Hz */
-    { 9.991853459282609E-01, -1.995116985095403E+00, 9.991853459282609E-01, -1.995116985095403E+00, 9.983706918565218E-01 }, /* 436 Hz */
-    { 9.991834789804361E-01, -1.995098319005381E+00, 9.991834789804361E-01, -1.995098319005381E+00, 9.983669579608723E-01 }, /* 437 Hz */
-    { 9.991816120395826E-01, -1.995079618799696E+00, 9.991816120395826E-01, -1.995079618799696E+00, 9.983632240791651E-01 }, /* 438 Hz */
-    { 9.991797451056998E-01, -1.995060884478794E+00, 9.991797451056998E-01, -1.995060884478794E+00, 9.983594902113997E-01 }, /* 439 Hz */
-    { 9.991778781787880E-01, -1.995042116043123E+00, 9.991778781787880E-01, -1.995042116043123E+00, 9.983557563575760E-01 }, /* 440 Hz */
-    { 9.991760112588468E-01, -1.995023313493133E+00, 9.991760112588468E-01, -1.995023313493133E+00, 9.983520225176936E-01 }, /* 441 Hz */
-    { 9.991741443458765E-01, -1.995004476829274E+00, 9.991741443458765E-01, -1.995004476829274E+00, 9.983482886917530E-01 }, /* 442 Hz */
-    { 9.991722774398768E-01, -1.994985606051995E+00, 9.991722774398768E-01, -1.994985606051995E+00, 9.983445548797536E-01 }, /* 443 Hz */
-    { 9.991704105408478E-01, -1.994966701161746E+00, 9.991704105408478E-01, -1.994966701161746E+00, 9.983408210816955E-01 }, /* 444 Hz */
-    { 9.991685436487892E-01, -1.994947762158980E+00, 9.991685436487892E-01, -1.994947762158980E+00, 9.983370872975783E-01 }, /* 445 Hz */
-    { 9.991666767637013E-01, -1.994928789044148E+00, 9.991666767637013E-01, -1.994928789044148E+00, 9.983333535274026E-01 }, /* 446 Hz */
-    { 9.991648098855838E-01, -1.994909781817702E+00, 9.991648098855838E-01, -1.994909781817702E+00, 9.983296197711675E-01 }, /* 447 Hz */
-    { 9.991629430144368E-01, -1.994890740480096E+00, 9.991629430144368E-01, -1.994890740480096E+00, 9.983258860288735E-01 }, /* 448 Hz */
-    { 9.991610761502603E-01, -1.994871665031783E+00, 9.991610761502603E-01, -1.994871665031783E+00, 9.983221523005206E-01 }, /* 449 Hz */
-    { 9.991592092930539E-01, -1.994852555473217E+00, 9.991592092930539E-01, -1.994852555473217E+00, 9.983184185861078E-01 }, /* 450 Hz */
-    { 9.991573424428177E-01, -1.994833411804853E+00, 9.991573424428177E-01, -1.994833411804853E+00, 9.983146848856355E-01 }, /* 451 Hz */
-    { 9.991554755995520E-01, -1.994814234027147E+00, 9.991554755995520E-01, -1.994814234027147E+00, 9.983109511991040E-01 }, /* 452 Hz */
-    { 9.991536087632564E-01, -1.994795022140553E+00, 9.991536087632564E-01, -1.994795022140553E+00, 9.983072175265129E-01 }, /* 453 Hz */
-    { 9.991517419339310E-01, -1.994775776145530E+00, 9.991517419339310E-01, -1.994775776145530E+00, 9.983034838678619E-01 }, /* 454 Hz */
-    { 9.991498751115756E-01, -1.994756496042533E+00, 9.991498751115756E-01, -1.994756496042533E+00, 9.982997502231512E-01 }, /* 455 Hz */
-    { 9.991480082961901E-01, -1.994737181832020E+00, 9.991480082961901E-01, -1.994737181832020E+00, 9.982960165923802E-01 }, /* 456 Hz */
-    { 9.991461414877746E-01, -1.994717833514450E+00, 9.991461414877746E-01, -1.994717833514450E+00, 9.982922829755492E-01 }, /* 457 Hz */
-    { 9.991442746863292E-01, -1.994698451090281E+00, 9.991442746863292E-01, -1.994698451090281E+00, 9.982885493726583E-01 }, /* 458 Hz */
-    { 9.991424078918534E-01, -1.994679034559973E+00, 9.991424078918534E-01, -1.994679034559973E+00, 9.982848157837068E-01 }, /* 459 Hz */
-    { 9.991405411043474E-01, -1.994659583923986E+00, 9.991405411043474E-01, -1.994659583923986E+00, 9.982810822086947E-01 }, /* 460 Hz */
-    { 9.991386743238114E-01, -1.994640099182781E+00, 9.991386743238114E-01, -1.994640099182781E+00, 9.982773486476229E-01 }, /* 461 Hz */
-    { 9.991368075502449E-01, -1.994620580336817E+00, 9.991368075502449E-01, -1.994620580336817E+00, 9.982736151004898E-01 }, /* 462 Hz */
-    { 9.991349407836482E-01, -1.994601027386558E+00, 9.991349407836482E-01, -1.994601027386558E+00, 9.982698815672963E-01 }, /* 463 Hz */
-    { 9.991330740240209E-01, -1.994581440332466E+00, 9.991330740240209E-01, -1.994581440332466E+00, 9.982661480480417E-01 }, /* 464 Hz */
-    { 9.991312072713633E-01, -1.994561819175003E+00, 9.991312072713633E-01, -1.994561819175003E+00, 9.982624145427266E-01 }, /* 465 Hz */
-    { 9.991293405256751E-01, -1.994542163914633E+00, 9.991293405256751E-01, -1.994542163914633E+00, 9.982586810513503E-01 }, /* 466 Hz */
-    { 9.991274737869564E-01, -1.994522474551820E+00, 9.991274737869564E-01, -1.994522474551820E+00, 9.982549475739129E-01 }, /* 467 Hz */
-    { 9.991256070552070E-01, -1.994502751087029E+00, 9.991256070552070E-01, -1.994502751087029E+00, 9.982512141104141E-01 }, /* 468 Hz */
-    { 9.991237403304273E-01, -1.994482993520725E+00, 9.991237403304273E-01, -1.994482993520725E+00, 9.982474806608546E-01 }, /* 469 Hz */
-    { 9.991218736126166E-01, -1.994463201853373E+00, 9.991218736126166E-01, -1.994463201853373E+00, 9.982437472252332E-01 }, /* 470 Hz */
-    { 9.991200069017752E-01, -1.994443376085441E+00, 9.991200069017752E-01, -1.994443376085441E+00, 9.982400138035503E-01 }, /* 471 Hz */
-    { 9.991181401979028E-01, -1.994423516217394E+00, 9.991181401979028E-01, -1.994423516217394E+00, 9.982362803958056E-01 }, /* 472 Hz */
-    { 9.991162735009997E-01, -1.994403622249701E+00, 9.991162735009997E-01, -1.994403622249701E+00, 9.982325470019995E-01 }, /* 473 Hz */
-    { 9.991144068110654E-01, -1.994383694182829E+00, 9.991144068110654E-01, -1.994383694182829E+00, 9.982288136221309E-01 }, /* 474 Hz */
-    { 9.991125401281005E-01, -1.994363732017248E+00, 9.991125401281005E-01, -1.994363732017248E+00, 9.982250802562009E-01 }, /* 475 Hz */
-    { 9.991106734521045E-01, -1.994343735753427E+00, 9.991106734521045E-01, -1.994343735753427E+00, 9.982213469042089E-01 }, /* 476 Hz */
-    { 9.991088067830773E-01, -1.994323705391835E+00, 9.991088067830773E-01, -1.994323705391835E+00, 9.982176135661547E-01 }, /* 477 Hz */
-    { 9.991069401210192E-01, -1.994303640932944E+00, 9.991069401210192E-01, -1.994303640932944E+00, 9.982138802420384E-01 }, /* 478 Hz */
-    { 9.991050734659296E-01, -1.994283542377223E+00, 9.991050734659296E-01, -1.994283542377223E+00, 9.982101469318592E-01 }, /* 479 Hz */
-    { 9.991032068178091E-01, -1.994263409725145E+00, 9.991032068178091E-01, -1.994263409725145E+00, 9.982064136356181E-01 }, /* 480 Hz */
-    { 9.991013401766571E-01, -1.994243242977183E+00, 9.991013401766571E-01, -1.994243242977183E+00, 9.982026803533142E-01 }, /* 481 Hz */
-    { 9.990994735424736E-01, -1.994223042133807E+00, 9.990994735424736E-01, -1.994223042133807E+00, 9.981989470849473E-01 }, /* 482 Hz */
-    { 9.990976069152591E-01, -1.994202807195493E+00, 9.990976069152591E-01, -1.994202807195493E+00, 9.981952138305181E-01 }, /* 483 Hz */
-    { 9.990957402950129E-01, -1.994182538162714E+00, 9.990957402950129E-01, -1.994182538162714E+00, 9.981914805900258E-01 }, /* 484 Hz */
-    { 9.990938736817352E-01, -1.994162235035944E+00, 9.990938736817352E-01, -1.994162235035944E+00, 9.981877473634704E-01 }, /* 485 Hz */
-    { 9.990920070754260E-01, -1.994141897815660E+00, 9.990920070754260E-01, -1.994141897815660E+00, 9.981840141508520E-01 }, /* 486 Hz */
-    { 9.990901404760851E-01, -1.994121526502335E+00, 9.990901404760851E-01, -1.994121526502335E+00, 9.981802809521703E-01 }, /* 487 Hz */
-    { 9.990882738837128E-01, -1.994101121096447E+00, 9.990882738837128E-01, -1.994101121096447E+00, 9.981765477674256E-01 }, /* 488 Hz */
-    { 9.990864072983086E-01, -1.994080681598473E+00, 9.990864072983086E-01, -1.994080681598473E+00, 9.981728145966171E-01 }, /* 489 Hz */
-    { 9.990845407198726E-01, -1.994060208008889E+00, 9.990845407198726E-01, -1.994060208008889E+00, 9.981690814397453E-01 }, /* 490 Hz */
-    { 9.990826741484049E-01, -1.994039700328175E+00, 9.990826741484049E-01, -1.994039700328175E+00, 9.981653482968098E-01 }, /* 491 Hz */
-    { 9.990808075839055E-01, -1.994019158556809E+00, 9.990808075839055E-01, -1.994019158556809E+00, 9.981616151678110E-01 }, /* 492 Hz */
-    { 9.990789410263740E-01, -1.993998582695268E+00, 9.990789410263740E-01, -1.993998582695268E+00, 9.981578820527479E-01 }, /* 493 Hz */
-    { 9.990770744758105E-01, -1.993977972744035E+00, 9.990770744758105E-01, -1.993977972744035E+00, 9.981541489516210E-01 }, /* 494 Hz */
-    { 9.990752079322150E-01, -1.993957328703589E+00, 9.990752079322150E-01, -1.993957328703589E+00, 9.981504158644301E-01 }, /* 495 Hz */
-    { 9.990733413955876E-01, -1.993936650574410E+00, 9.990733413955876E-01, -1.993936650574410E+00, 9.981466827911751E-01 }, /* 496 Hz */
-    { 9.990714748659280E-01, -1.993915938356981E+00, 9.990714748659280E-01, -1.993915938356981E+00, 9.981429497318559E-01 }, /* 497 Hz */
-    { 9.990696083432360E-01, -1.993895192051783E+00, 9.990696083432360E-01, -1.993895192051783E+00, 9.981392166864720E-01 }, /* 498 Hz */
-    { 9.990677418275120E-01, -1.993874411659299E+00, 9.990677418275120E-01, -1.993874411659299E+00, 9.981354836550240E-01 }, /* 499 Hz */
-    { 9.990658753187557E-01, -1.993853597180013E+00, 9.990658753187557E-01, -1.993853597180013E+00, 9.981317506375114E-01 }, /* 500 Hz */
-    { 9.990640088169670E-01, -1.993832748614408E+00, 9.990640088169670E-01, -1.993832748614408E+00, 9.981280176339340E-01 }, /* 501 Hz */
-    { 9.990621423221461E-01, -1.993811865962969E+00, 9.990621423221461E-01, -1.993811865962969E+00, 9.981242846442921E-01 }, /* 502 Hz */
-    { 9.990602758342926E-01, -1.993790949226180E+00, 9.990602758342926E-01, -1.993790949226180E+00, 9.981205516685852E-01 }, /* 503 Hz */
-    { 9.990584093534067E-01, -1.993769998404528E+00, 9.990584093534067E-01, -1.993769998404528E+00, 9.981168187068135E-01 }, /* 504 Hz */
-    { 9.990565428794882E-01, -1.993749013498498E+00, 9.990565428794882E-01, -1.993749013498498E+00, 9.981130857589764E-01 }, /* 505 Hz */
-    { 9.990546764125371E-01, -1.993727994508577E+00, 9.990546764125371E-01, -1.993727994508577E+00, 9.981093528250742E-01 }, /* 506 Hz */
-    { 9.990528099525533E-01, -1.993706941435253E+00, 9.990528099525533E-01, -1.993706941435253E+00, 9.981056199051066E-01 }, /* 507 Hz */
-    { 9.990509434995370E-01, -1.993685854279013E+00, 9.990509434995370E-01, -1.993685854279013E+00, 9.981018869990741E-01 }, /* 508 Hz */
-    { 9.990490770534878E-01, -1.993664733040346E+00, 9.990490770534878E-01, -1.993664733040346E+00, 9.980981541069756E-01 }, /* 509 Hz */
-    { 9.990472106144059E-01, -1.993643577719742E+00, 9.990472106144059E-01, -1.993643577719742E+00, 9.980944212288119E-01 }, /* 510 Hz */
-    { 9.990453441822911E-01, -1.993622388317688E+00, 9.990453441822911E-01, -1.993622388317688E+00, 9.980906883645821E-01 }, /* 511 Hz */
-    { 9.990434777571434E-01, -1.993601164834677E+00, 9.990434777571434E-01, -1.993601164834677E+00, 9.980869555142868E-01 }, /* 512 Hz */
-    { 9.990416113389627E-01, -1.993579907271199E+00, 9.990416113389627E-01, -1.993579907271199E+00, 9.980832226779255E-01 }, /* 513 Hz */
-    { 9.990397449277491E-01, -1.993558615627745E+00, 9.990397449277491E-01, -1.993558615627745E+00, 9.980794898554981E-01 }, /* 514 Hz */
-    { 9.990378785235025E-01, -1.993537289904807E+00, 9.990378785235025E-01, -1.993537289904807E+00, 9.980757570470049E-01 }, /* 515 Hz */
-    { 9.990360121262225E-01, -1.993515930102877E+00, 9.990360121262225E-01, -1.993515930102877E+00, 9.980720242524450E-01 }, /* 516 Hz */
-    { 9.990341457359095E-01, -1.993494536222450E+00, 9.990341457359095E-01, -1.993494536222450E+00, 9.980682914718191E-01 }, /* 517 Hz */
-    { 9.990322793525634E-01, -1.993473108264018E+00, 9.990322793525634E-01, -1.993473108264018E+00, 9.980645587051269E-01 }, /* 518 Hz */
-    { 9.990304129761839E-01, -1.993451646228076E+00, 9.990304129761839E-01, -1.993451646228076E+00, 9.980608259523678E-01 }, /* 519 Hz */
-    { 9.990285466067712E-01, -1.993430150115119E+00, 9.990285466067712E-01, -1.993430150115119E+00, 9.980570932135424E-01 }, /* 520 Hz */
-    { 9.990266802443249E-01, -1.993408619925642E+00, 9.990266802443249E-01, -1.993408619925642E+00, 9.980533604886499E-01 }, /* 521 Hz */
-    { 9.990248138888456E-01, -1.993387055660142E+00, 9.990248138888456E-01, -1.993387055660142E+00, 9.980496277776911E-01 }, /* 522 Hz */
-    { 9.990229475403324E-01, -1.993365457319114E+00, 9.990229475403324E-01, -1.993365457319114E+00, 9.980458950806648E-01 }, /* 523 Hz */
-    { 9.990210811987859E-01, -1.993343824903057E+00, 9.990210811987859E-01, -1.993343824903057E+00, 9.980421623975717E-01 }, /* 524 Hz */
-    { 9.990192148642058E-01, -1.993322158412467E+00, 9.990192148642058E-01, -1.993322158412467E+00, 9.980384297284115E-01 }, /* 525 Hz */
-    { 9.990173485365919E-01, -1.993300457847844E+00, 9.990173485365919E-01, -1.993300457847844E+00, 9.980346970731837E-01 }, /* 526 Hz */
-    { 9.990154822159444E-01, -1.993278723209687E+00, 9.990154822159444E-01, -1.993278723209687E+00, 9.980309644318888E-01 }, /* 527 Hz */
-    { 9.990136159022632E-01, -1.993256954498494E+00, 9.990136159022632E-01, -1.993256954498494E+00, 9.980272318045265E-01 }, /* 528 Hz */
-    { 9.990117495955483E-01, -1.993235151714767E+00, 9.990117495955483E-01, -1.993235151714767E+00, 9.980234991910966E-01 }, /* 529 Hz */
-    { 9.990098832957995E-01, -1.993213314859005E+00, 9.990098832957995E-01, -1.993213314859005E+00, 9.980197665915991E-01 }, /* 530 Hz */
-    { 9.990080170030168E-01, -1.993191443931711E+00, 9.990080170030168E-01, -1.993191443931711E+00, 9.980160340060336E-01 }, /* 531 Hz */
-    { 9.990061507172001E-01, -1.993169538933385E+00, 9.990061507172001E-01, -1.993169538933385E+00, 9.980123014344002E-01 }, /* 532 Hz */
-    { 9.990042844383495E-01, -1.993147599864530E+00, 9.990042844383495E-01, -1.993147599864530E+00, 9.980085688766991E-01 }, /* 533 Hz */
-    { 9.990024181664647E-01, -1.993125626725650E+00, 9.990024181664647E-01, -1.993125626725650E+00, 9.980048363329295E-01 }, /* 534 Hz */
-    { 9.990005519015459E-01, -1.993103619517248E+00, 9.990005519015459E-01, -1.993103619517248E+00, 9.980011038030918E-01 }, /* 535 Hz */
-    { 9.989986856435932E-01, -1.993081578239829E+00, 9.989986856435932E-01, -1.993081578239829E+00, 9.979973712871864E-01 }, /* 536 Hz */
-    { 9.989968193926059E-01, -1.993059502893896E+00, 9.989968193926059E-01, -1.993059502893896E+00, 9.979936387852117E-01 }, /* 537 Hz */
-    { 9.989949531485846E-01, -1.993037393479956E+00, 9.989949531485846E-01, -1.993037393479956E+00, 9.979899062971691E-01 }, /* 538 Hz */
-    { 9.989930869115288E-01, -1.993015249998514E+00, 9.989930869115288E-01, -1.993015249998514E+00, 9.979861738230575E-01 }, /* 539 Hz */
-    { 9.989912206814388E-01, -1.992993072450077E+00, 9.989912206814388E-01, -1.992993072450077E+00, 9.979824413628775E-01 }, /* 540 Hz */
-    { 9.989893544583143E-01, -1.992970860835152E+00, 9.989893544583143E-01, -1.992970860835152E+00, 9.979787089166285E-01 }, /* 541 Hz */
-    { 9.989874882421553E-01, -1.992948615154246E+00, 9.989874882421553E-01, -1.992948615154246E+00, 9.979749764843107E-01 }, /* 542 Hz */
-    { 9.989856220329618E-01, -1.992926335407868E+00, 9.989856220329618E-01, -1.992926335407868E+00, 9.979712440659236E-01 }, /* 543 Hz */
-    { 9.989837558307338E-01, -1.992904021596528E+00, 9.989837558307338E-01, -1.992904021596528E+00, 9.979675116614677E-01 }, /* 544 Hz */
-    { 9.989818896354713E-01, -1.992881673720733E+00, 9.989818896354713E-01, -1.992881673720733E+00, 9.979637792709426E-01 }, /* 545 Hz */
-    { 9.989800234471741E-01, -1.992859291780995E+00, 9.989800234471741E-01, -1.992859291780995E+00, 9.979600468943481E-01 }, /* 546 Hz */
-    { 9.989781572658420E-01, -1.992836875777823E+00, 9.989781572658420E-01, -1.992836875777823E+00, 9.979563145316841E-01 }, /* 547 Hz */
-    { 9.989762910914750E-01, -1.992814425711730E+00, 9.989762910914750E-01, -1.992814425711730E+00, 9.979525821829500E-01 }, /* 548 Hz */
-    { 9.989744249240735E-01, -1.992791941583226E+00, 9.989744249240735E-01, -1.992791941583226E+00, 9.979488498481470E-01 }, /* 549 Hz */
-    { 9.989725587636370E-01, -1.992769423392824E+00, 9.989725587636370E-01, -1.992769423392824E+00, 9.979451175272740E-01 }, /* 550 Hz */
-    { 9.989706926101655E-01, -1.992746871141037E+00, 9.989706926101655E-01, -1.992746871141037E+00, 9.979413852203309E-01 }, /* 551 Hz */
-    { 9.989688264636591E-01, -1.992724284828379E+00, 9.989688264636591E-01, -1.992724284828379E+00, 9.979376529273183E-01 }, /* 552 Hz */
-    { 9.989669603241176E-01, -1.992701664455363E+00, 9.989669603241176E-01, -1.992701664455363E+00, 9.979339206482352E-01 }, /* 553 Hz */
-    { 9.989650941915412E-01, -1.992679010022505E+00, 9.989650941915412E-01, -1.992679010022505E+00, 9.979301883830825E-01 }, /* 554 Hz */
-    { 9.989632280659294E-01, -1.992656321530319E+00, 9.989632280659294E-01, -1.992656321530319E+00, 9.979264561318588E-01 }, /* 555 Hz */
-    { 9.989613619472826E-01, -1.992633598979322E+00, 9.989613619472826E-01, -1.992633598979322E+00, 9.979227238945652E-01 }, /* 556 Hz */
-    { 9.989594958356004E-01, -1.992610842370029E+00, 9.989594958356004E-01, -1.992610842370029E+00, 9.979189916712008E-01 }, /* 557 Hz */
-    { 9.989576297308830E-01, -1.992588051702958E+00, 9.989576297308830E-01, -1.992588051702958E+00, 9.979152594617660E-01 }, /* 558 Hz */
-    { 9.989557636331303E-01, -1.992565226978626E+00, 9.989557636331303E-01, -1.992565226978626E+00, 9.979115272662606E-01 }, /* 559 Hz */
-    { 9.989538975423421E-01, -1.992542368197552E+00, 9.989538975423421E-01, -1.992542368197552E+00, 9.979077950846842E-01 }, /* 560 Hz */
-    { 9.989520314585185E-01, -1.992519475360253E+00, 9.989520314585185E-01, -1.992519475360253E+00, 9.979040629170370E-01 }, /* 561 Hz */
-    { 9.989501653816594E-01, -1.992496548467251E+00, 9.989501653816594E-01, -1.992496548467251E+00, 9.979003307633187E-01 }, /* 562 Hz */
-    { 9.989482993117647E-01, -1.992473587519063E+00, 9.989482993117647E-01, -1.992473587519063E+00, 9.978965986235293E-01 }, /* 563 Hz */
-    { 9.989464332488345E-01, -1.992450592516212E+00, 9.989464332488345E-01, -1.992450592516212E+00, 9.978928664976690E-01 }, /* 564 Hz */
-    { 9.989445671928686E-01, -1.992427563459217E+00, 9.989445671928686E-01, -1.992427563459217E+00, 9.978891343857372E-01 }, /* 565 Hz */
-    { 9.989427011438667E-01, -1.992404500348601E+00, 9.989427011438667E-01, -1.992404500348601E+00, 9.978854022877335E-01 }, /* 566 Hz */
-    { 9.989408351018295E-01, -1.992381403184886E+00, 9.989408351018295E-01, -1.992381403184886E+00, 9.978816702036590E-01 }, /* 567 Hz */
-    { 9.989389690667563E-01, -1.992358271968595E+00, 9.989389690667563E-01, -1.992358271968595E+00, 9.978779381335126E-01 }, /* 568 Hz */
-    { 9.989371030386470E-01, -1.992335106700249E+00, 9.989371030386470E-01, -1.992335106700249E+00, 9.978742060772940E-01 }, /* 569 Hz */
-    { 9.989352370175020E-01, -1.992311907380375E+00, 9.989352370175020E-01, -1.992311907380375E+00, 9.978704740350040E-01 }, /* 570 Hz */
-    { 9.989333710033209E-01, -1.992288674009497E+00, 9.989333710033209E-01, -1.992288674009497E+00, 9.978667420066418E-01 }, /* 571 Hz */
-    { 9.989315049961039E-01, -1.992265406588139E+00, 9.989315049961039E-01, -1.992265406588139E+00, 9.978630099922079E-01 }, /* 572 Hz */
-    { 9.989296389958509E-01, -1.992242105116828E+00, 9.989296389958509E-01, -1.992242105116828E+00, 9.978592779917017E-01 }, /* 573 Hz */
-    { 9.989277730025617E-01, -1.992218769596089E+00, 9.989277730025617E-01, -1.992218769596089E+00, 9.978555460051235E-01 }, /* 574 Hz */
-    { 9.989259070162363E-01, -1.992195400026449E+00, 9.989259070162363E-01, -1.992195400026449E+00, 9.978518140324726E-01 }, /* 575 Hz */
-    { 9.989240410368747E-01, -1.992171996408437E+00, 9.989240410368747E-01, -1.992171996408437E+00, 9.978480820737494E-01 }, /* 576 Hz */
-    { 9.989221750644769E-01, -1.992148558742579E+00, 9.989221750644769E-01, -1.992148558742579E+00, 9.978443501289538E-01 }, /* 577 Hz */
-    { 9.989203090990424E-01, -1.992125087029404E+00, 9.989203090990424E-01, -1.992125087029404E+00, 9.978406181980848E-01 }, /* 578 Hz */
-    { 9.989184431405719E-01, -1.992101581269443E+00, 9.989184431405719E-01, -1.992101581269443E+00, 9.978368862811438E-01 }, /* 579 Hz */
-    { 9.989165771890649E-01, -1.992078041463224E+00, 9.989165771890649E-01, -1.992078041463224E+00, 9.978331543781298E-01 }, /* 580 Hz */
-    { 9.989147112445211E-01, -1.992054467611278E+00, 9.989147112445211E-01, -1.992054467611278E+00, 9.978294224890423E-01 }, /* 581 Hz */
-    { 9.989128453069410E-01, -1.992030859714135E+00, 9.989128453069410E-01, -1.992030859714135E+00, 9.978256906138820E-01 }, /* 582 Hz */
-    { 9.989109793763243E-01, -1.992007217772328E+00, 9.989109793763243E-01, -1.992007217772328E+00, 9.978219587526487E-01 }, /* 583 Hz */
-    { 9.989091134526710E-01, -1.991983541786388E+00, 9.989091134526710E-01, -1.991983541786388E+00, 9.978182269053419E-01 }, /* 584 Hz */
-    { 9.989072475359809E-01, -1.991959831756849E+00, 9.989072475359809E-01, -1.991959831756849E+00, 9.978144950719618E-01 }, /* 585 Hz */
-    { 9.989053816262542E-01, -1.991936087684242E+00, 9.989053816262542E-01, -1.991936087684242E+00, 9.978107632525084E-01 }, /* 586 Hz */
-    { 9.989035157234905E-01, -1.991912309569103E+00, 9.989035157234905E-01, -1.991912309569103E+00, 9.978070314469809E-01 }, /* 587 Hz */
-    { 9.989016498276900E-01, -1.991888497411965E+00, 9.989016498276900E-01, -1.991888497411965E+00, 9.978032996553801E-01 }, /* 588 Hz */
-    { 9.988997839388527E-01, -1.991864651213364E+00, 9.988997839388527E-01, -1.991864651213364E+00, 9.977995678777054E-01 }, /* 589 Hz */
-    { 9.988979180569783E-01, -1.991840770973835E+00, 9.988979180569783E-01, -1.991840770973835E+00, 9.977958361139565E-01 }, /* 590 Hz */
-    { 9.988960521820670E-01, -1.991816856693915E+00, 9.988960521820670E-01, -1.991816856693915E+00, 9.977921043641340E-01 }, /* 591 Hz */
-    { 9.988941863141186E-01, -1.991792908374139E+00, 9.988941863141186E-01, -1.991792908374139E+00, 9.977883726282373E-01 }, /* 592 Hz */
-    { 9.988923204531331E-01, -1.991768926015046E+00, 9.988923204531331E-01, -1.991768926015046E+00, 9.977846409062663E-01 }, /* 593 Hz */
-    { 9.988904545991104E-01, -1.991744909617173E+00, 9.988904545991104E-01, -1.991744909617173E+00, 9.977809091982208E-01 }, /* 594 Hz */
-    { 9.988885887520504E-01, -1.991720859181059E+00, 9.988885887520504E-01, -1.991720859181059E+00, 9.977771775041009E-01 }, /* 595 Hz */
-    { 9.988867229119530E-01, -1.991696774707242E+00, 9.988867229119530E-01, -1.991696774707242E+00, 9.977734458239060E-01 }, /* 596 Hz */
-    { 9.988848570788186E-01, -1.991672656196263E+00, 9.988848570788186E-01, -1.991672656196263E+00, 9.977697141576372E-01 }, /* 597 Hz */
-    { 9.988829912526467E-01, -1.991648503648662E+00, 9.988829912526467E-01, -1.991648503648662E+00, 9.977659825052934E-01 }, /* 598 Hz */
-    { 9.988811254334373E-01, -1.991624317064979E+00, 9.988811254334373E-01, -1.991624317064979E+00, 9.977622508668746E-01 }, /* 599 Hz */
-    { 9.988792596211906E-01, -1.991600096445757E+00, 9.988792596211906E-01, -1.991600096445757E+00, 9.977585192423812E-01 }, /* 600 Hz */
-    { 9.988773938159061E-01, -1.991575841791535E+00, 9.988773938159061E-01, -1.991575841791535E+00, 9.977547876318122E-01 }, /* 601 Hz */
-    { 9.988755280175843E-01, -1.991551553102859E+00, 9.988755280175843E-01, -1.991551553102859E+00, 9.977510560351686E-01 }, /* 602 Hz */
-    { 9.988736622262248E-01, -1.991527230380270E+00, 9.988736622262248E-01, -1.991527230380270E+00, 9.977473244524495E-01 }, /* 603 Hz */
-    { 9.988717964418273E-01, -1.991502873624312E+00, 9.988717964418273E-01, -1.991502873624312E+00, 9.977435928836547E-01 }, /* 604 Hz */
-    { 9.988699306643924E-01, -1.991478482835530E+00, 9.988699306643924E-01, -1.991478482835530E+00, 9.977398613287849E-01 }, /* 605 Hz */
-    { 9.988680648939198E-01, -1.991454058014468E+00, 9.988680648939198E-01, -1.991454058014468E+00, 9.977361297878395E-01 }, /* 606 Hz */
-    { 9.988661991304090E-01, -1.991429599161672E+00, 9.988661991304090E-01, -1.991429599161672E+00, 9.977323982608179E-01 }, /* 607 Hz */
-    { 9.988643333738605E-01, -1.991405106277688E+00, 9.988643333738605E-01, -1.991405106277688E+00, 9.977286667477210E-01 }, /* 608 Hz */
-    { 9.988624676242740E-01, -1.991380579363062E+00, 9.988624676242740E-01, -1.991380579363062E+00, 9.977249352485480E-01 }, /* 609 Hz */
-    { 9.988606018816495E-01, -1.991356018418343E+00, 9.988606018816495E-01, -1.991356018418343E+00, 9.977212037632990E-01 }, /* 610 Hz */
-    { 9.988587361459870E-01, -1.991331423444076E+00, 9.988587361459870E-01, -1.991331423444076E+00, 9.977174722919739E-01 }, /* 611 Hz */
-    { 9.988568704172864E-01, -1.991306794440812E+00, 9.988568704172864E-01, -1.991306794440812E+00, 9.977137408345729E-01 }, /* 612 Hz */
-    { 9.988550046955477E-01, -1.991282131409098E+00, 9.988550046955477E-01, -1.991282131409098E+00, 9.977100093910953E-01 }, /* 613 Hz */
-    { 9.988531389807707E-01, -1.991257434349485E+00, 9.988531389807707E-01, -1.991257434349485E+00, 9.977062779615413E-01 }, /* 614 Hz */
-    { 9.988512732729553E-01, -1.991232703262521E+00, 9.988512732729553E-01, -1.991232703262521E+00, 9.977025465459106E-01 }, /* 615 Hz */
-    { 9.988494075721016E-01, -1.991207938148759E+00, 9.988494075721016E-01, -1.991207938148759E+00, 9.976988151442032E-01 }, /* 616 Hz */
-    { 9.988475418782098E-01, -1.991183139008750E+00, 9.988475418782098E-01, -1.991183139008750E+00, 9.976950837564196E-01 }, /* 617 Hz */
-    { 9.988456761912794E-01, -1.991158305843044E+00, 9.988456761912794E-01, -1.991158305843044E+00, 9.976913523825588E-01 }, /* 618 Hz */
-    { 9.988438105113104E-01, -1.991133438652195E+00, 9.988438105113104E-01, -1.991133438652195E+00, 9.976876210226209E-01 }, /* 619 Hz */
-    { 9.988419448383032E-01, -1.991108537436756E+00, 9.988419448383032E-01, -1.991108537436756E+00, 9.976838896766065E-01 }, /* 620 Hz */
-    { 9.988400791722573E-01, -1.991083602197280E+00, 9.988400791722573E-01, -1.991083602197280E+00, 9.976801583445145E-01 }, /* 621 Hz */
-    { 9.988382135131726E-01, -1.991058632934321E+00, 9.988382135131726E-01, -1.991058632934321E+00, 9.976764270263452E-01 }, /* 622 Hz */
-    { 9.988363478610496E-01, -1.991033629648434E+00, 9.988363478610496E-01, -1.991033629648434E+00, 9.976726957220992E-01 }, /* 623 Hz */
-    { 9.988344822158877E-01, -1.991008592340175E+00, 9.988344822158877E-01, -1.991008592340175E+00, 9.976689644317753E-01 }, /* 624 Hz */
-    { 9.988326165776868E-01, -1.990983521010099E+00, 9.988326165776868E-01, -1.990983521010099E+00, 9.976652331553737E-01 }, /* 625 Hz */
-    { 9.988307509464472E-01, -1.990958415658762E+00, 9.988307509464472E-01, -1.990958415658762E+00, 9.976615018928945E-01 }, /* 626 Hz */
-    { 9.988288853221687E-01, -1.990933276286722E+00, 9.988288853221687E-01, -1.990933276286722E+00, 9.976577706443375E-01 }, /* 627 Hz */
-    { 9.988270197048514E-01, -1.990908102894537E+00, 9.988270197048514E-01, -1.990908102894537E+00, 9.976540394097029E-01 }, /* 628 Hz */
-    { 9.988251540944950E-01, -1.990882895482765E+00, 9.988251540944950E-01, -1.990882895482765E+00, 9.976503081889900E-01 }, /* 629 Hz */
-    { 9.988232884910995E-01, -1.990857654051964E+00, 9.988232884910995E-01, -1.990857654051964E+00, 9.976465769821989E-01 }, /* 630 Hz */
-    { 9.988214228946651E-01, -1.990832378602694E+00, 9.988214228946651E-01, -1.990832378602694E+00, 9.976428457893303E-01 }, /* 631 Hz */
-    { 9.988195573051915E-01, -1.990807069135515E+00, 9.988195573051915E-01, -1.990807069135515E+00, 9.976391146103829E-01 }, /* 632 Hz */
-    { 9.988176917226786E-01, -1.990781725650987E+00, 9.988176917226786E-01, -1.990781725650987E+00, 9.976353834453573E-01 }, /* 633 Hz */
-    { 9.988158261471264E-01, -1.990756348149672E+00, 9.988158261471264E-01, -1.990756348149672E+00, 9.976316522942528E-01 }, /* 634 Hz */
-    { 9.988139605785351E-01, -1.990730936632131E+00, 9.988139605785351E-01, -1.990730936632131E+00, 9.976279211570702E-01 }, /* 635 Hz */
-    { 9.988120950169042E-01, -1.990705491098926E+00, 9.988120950169042E-01, -1.990705491098926E+00, 9.976241900338083E-01 }, /* 636 Hz */
-    { 9.988102294622341E-01, -1.990680011550621E+00, 9.988102294622341E-01, -1.990680011550621E+00, 9.976204589244682E-01 }, /* 637 Hz */
-    { 9.988083639145245E-01, -1.990654497987779E+00, 9.988083639145245E-01, -1.990654497987779E+00, 9.976167278290491E-01 }, /* 638 Hz */
-    { 9.988064983737753E-01, -1.990628950410964E+00, 9.988064983737753E-01, -1.990628950410964E+00, 9.976129967475507E-01 }, /* 639 Hz */
-    { 9.988046328399867E-01, -1.990603368820739E+00, 9.988046328399867E-01, -1.990603368820739E+00, 9.976092656799733E-01 }, /* 640 Hz */
-    { 9.988027673131584E-01, -1.990577753217672E+00, 9.988027673131584E-01, -1.990577753217672E+00, 9.976055346263168E-01 }, /* 641 Hz */
-    { 9.988009017932904E-01, -1.990552103602327E+00, 9.988009017932904E-01, -1.990552103602327E+00, 9.976018035865808E-01 }, /* 642 Hz */
-    { 9.987990362803826E-01, -1.990526419975271E+00, 9.987990362803826E-01, -1.990526419975271E+00, 9.975980725607652E-01 }, /* 643 Hz */
-    { 9.987971707744352E-01, -1.990500702337070E+00, 9.987971707744352E-01, -1.990500702337070E+00, 9.975943415488704E-01 }, /* 644 Hz */
-    { 9.987953052754478E-01, -1.990474950688293E+00, 9.987953052754478E-01, -1.990474950688293E+00, 9.975906105508956E-01 }, /* 645 Hz */
-    { 9.987934397834207E-01, -1.990449165029507E+00, 9.987934397834207E-01, -1.990449165029507E+00, 9.975868795668414E-01 }, /* 646 Hz */
-    { 9.987915742983535E-01, -1.990423345361280E+00, 9.987915742983535E-01, -1.990423345361280E+00, 9.975831485967070E-01 }, /* 647 Hz */
-    { 9.987897088202466E-01, -1.990397491684184E+00, 9.987897088202466E-01, -1.990397491684184E+00, 9.975794176404933E-01 }, /* 648 Hz */
-    { 9.987878433490994E-01, -1.990371603998786E+00, 9.987878433490994E-01, -1.990371603998786E+00, 9.975756866981988E-01 }, /* 649 Hz */
-    { 9.987859778849123E-01, -1.990345682305657E+00, 9.987859778849123E-01, -1.990345682305657E+00, 9.975719557698246E-01 }, /* 650 Hz */
-    { 9.987841124276851E-01, -1.990319726605369E+00, 9.987841124276851E-01, -1.990319726605369E+00, 9.975682248553701E-01 }, /* 651 Hz */
-    { 9.987822469774175E-01, -1.990293736898493E+00, 9.987822469774175E-01, -1.990293736898493E+00, 9.975644939548349E-01 }, /* 652 Hz */
-    { 9.987803815341098E-01, -1.990267713185601E+00, 9.987803815341098E-01, -1.990267713185601E+00, 9.975607630682195E-01 }, /* 653 Hz */
-    { 9.987785160977618E-01, -1.990241655467266E+00, 9.987785160977618E-01, -1.990241655467266E+00, 9.975570321955236E-01 }, /* 654 Hz */
-    { 9.987766506683734E-01, -1.990215563744061E+00, 9.987766506683734E-01, -1.990215563744061E+00, 9.975533013367468E-01 }, /* 655 Hz */
-    { 9.987747852459445E-01, -1.990189438016560E+00, 9.987747852459445E-01, -1.990189438016560E+00, 9.975495704918891E-01 }, /* 656 Hz */
-    { 9.987729198304754E-01, -1.990163278285338E+00, 9.987729198304754E-01, -1.990163278285338E+00, 9.975458396609509E-01 }, /* 657 Hz */
-    { 9.987710544219657E-01, -1.990137084550969E+00, 9.987710544219657E-01, -1.990137084550969E+00, 9.975421088439314E-01 }, /* 658 Hz */
-    { 9.987691890204157E-01, -1.990110856814030E+00, 9.987691890204157E-01, -1.990110856814030E+00, 9.975383780408313E-01 }, /* 659 Hz */
-    { 9.987673236258247E-01, -1.990084595075095E+00, 9.987673236258247E-01, -1.990084595075095E+00, 9.975346472516493E-01 }, /* 660 Hz */
-    { 9.987654582381932E-01, -1.990058299334743E+00, 9.987654582381932E-01, -1.990058299334743E+00, 9.975309164763864E-01 }, /* 661 Hz */
-    { 9.987635928575210E-01, -1.990031969593551E+00, 9.987635928575210E-01, -1.990031969593551E+00, 9.975271857150421E-01 }, /* 662 Hz */
-    { 9.987617274838080E-01, -1.990005605852096E+00, 9.987617274838080E-01, -1.990005605852096E+00, 9.975234549676160E-01 }, /* 663 Hz */
-    { 9.987598621170543E-01, -1.989979208110958E+00, 9.987598621170543E-01, -1.989979208110958E+00, 9.975197242341085E-01 }, /* 664 Hz */
-    { 9.987579967572597E-01, -1.989952776370714E+00, 9.987579967572597E-01, -1.989952776370714E+00, 9.975159935145195E-01 }, /* 665 Hz */
-    { 9.987561314044241E-01, -1.989926310631945E+00, 9.987561314044241E-01, -1.989926310631945E+00, 9.975122628088482E-01 }, /* 666 Hz */
-    { 9.987542660585476E-01, -1.989899810895231E+00, 9.987542660585476E-01, -1.989899810895231E+00, 9.975085321170951E-01 }, /* 667 Hz */
-    { 9.987524007196300E-01, -1.989873277161154E+00, 9.987524007196300E-01, -1.989873277161154E+00, 9.975048014392600E-01 }, /* 668 Hz */
-    { 9.987505353876716E-01, -1.989846709430294E+00, 9.987505353876716E-01, -1.989846709430294E+00, 9.975010707753431E-01 }, /* 669 Hz */
-    { 9.987486700626718E-01, -1.989820107703233E+00, 9.987486700626718E-01, -1.989820107703233E+00, 9.974973401253435E-01 }, /* 670 Hz */
-    { 9.987468047446310E-01, -1.989793471980554E+00, 9.987468047446310E-01, -1.989793471980554E+00, 9.974936094892619E-01 }, /* 671 Hz */
-    { 9.987449394335488E-01, -1.989766802262840E+00, 9.987449394335488E-01, -1.989766802262840E+00, 9.974898788670976E-01 }, /* 672 Hz */
-    { 9.987430741294253E-01, -1.989740098550675E+00, 9.987430741294253E-01, -1.989740098550675E+00, 9.974861482588506E-01 }, /* 673 Hz */
-    { 9.987412088322606E-01, -1.989713360844644E+00, 9.987412088322606E-01, -1.989713360844644E+00, 9.974824176645212E-01 }, /* 674 Hz */
-    { 9.987393435420546E-01, -1.989686589145331E+00, 9.987393435420546E-01, -1.989686589145331E+00, 9.974786870841093E-01 }, /* 675 Hz */
-    { 9.987374782588070E-01, -1.989659783453321E+00, 9.987374782588070E-01, -1.989659783453321E+00, 9.974749565176140E-01 }, /* 676 Hz */
-    { 9.987356129825180E-01, -1.989632943769201E+00, 9.987356129825180E-01, -1.989632943769201E+00, 9.974712259650360E-01 }, /* 677 Hz */
-    { 9.987337477131876E-01, -1.989606070093557E+00, 9.987337477131876E-01, -1.989606070093557E+00, 9.974674954263751E-01 }, /* 678 Hz */
-    { 9.987318824508152E-01, -1.989579162426977E+00, 9.987318824508152E-01, -1.989579162426977E+00, 9.974637649016305E-01 }, /* 679 Hz */
-    { 9.987300171954014E-01, -1.989552220770048E+00, 9.987300171954014E-01, -1.989552220770048E+00, 9.974600343908029E-01 }, /* 680 Hz */
-    { 9.987281519469460E-01, -1.989525245123359E+00, 9.987281519469460E-01, -1.989525245123359E+00, 9.974563038938919E-01 }, /* 681 Hz */
-    { 9.987262867054488E-01, -1.989498235487499E+00, 9.987262867054488E-01, -1.989498235487499E+00, 9.974525734108977E-01 }, /* 682 Hz */
-    { 9.987244214709097E-01, -1.989471191863056E+00, 9.987244214709097E-01, -1.989471191863056E+00, 9.974488429418193E-01 }, /* 683 Hz */
-    { 9.987225562433290E-01, -1.989444114250623E+00, 9.987225562433290E-01, -1.989444114250623E+00, 9.974451124866579E-01 }, /* 684 Hz */
-    { 9.987206910227062E-01, -1.989417002650788E+00, 9.987206910227062E-01, -1.989417002650788E+00, 9.974413820454124E-01 }, /* 685 Hz */
-    { 9.987188258090414E-01, -1.989389857064144E+00, 9.987188258090414E-01, -1.989389857064144E+00, 9.974376516180827E-01 }, /* 686 Hz */
-    { 9.987169606023347E-01, -1.989362677491282E+00, 9.987169606023347E-01, -1.989362677491282E+00, 9.974339212046694E-01 }, /* 687 Hz */
-    { 9.987150954025860E-01, -1.989335463932795E+00, 9.987150954025860E-01, -1.989335463932795E+00, 9.974301908051719E-01 }, /* 688 Hz */
-    { 9.987132302097951E-01, -1.989308216389276E+00, 9.987132302097951E-01, -1.989308216389276E+00, 9.974264604195902E-01 }, /* 689 Hz */
-    { 9.987113650239621E-01, -1.989280934861318E+00, 9.987113650239621E-01, -1.989280934861318E+00, 9.974227300479241E-01 }, /* 690 Hz */
-    { 9.987094998450868E-01, -1.989253619349515E+00, 9.987094998450868E-01, -1.989253619349515E+00, 9.974189996901737E-01 }, /* 691 Hz */
-    { 9.987076346731691E-01, -1.989226269854463E+00, 9.987076346731691E-01, -1.989226269854463E+00, 9.974152693463383E-01 }, /* 692 Hz */
-    { 9.987057695082094E-01, -1.989198886376756E+00, 9.987057695082094E-01, -1.989198886376756E+00, 9.974115390164189E-01 }, /* 693 Hz */
-    { 9.987039043502071E-01, -1.989171468916991E+00, 9.987039043502071E-01, -1.989171468916991E+00, 9.974078087004141E-01 }, /* 694 Hz */
-    { 9.987020391991625E-01, -1.989144017475764E+00, 9.987020391991625E-01, -1.989144017475764E+00, 9.974040783983249E-01 }, /* 695 Hz */
-    { 9.987001740550753E-01, -1.989116532053672E+00, 9.987001740550753E-01, -1.989116532053672E+00, 9.974003481101505E-01 }, /* 696 Hz */
-    { 9.986983089179456E-01, -1.989089012651313E+00, 9.986983089179456E-01, -1.989089012651313E+00, 9.973966178358913E-01 }, /* 697 Hz */
-    { 9.986964437877734E-01, -1.989061459269284E+00, 9.986964437877734E-01, -1.989061459269284E+00, 9.973928875755469E-01 }, /* 698 Hz */
-    { 9.986945786645587E-01, -1.989033871908186E+00, 9.986945786645587E-01, -1.989033871908186E+00, 9.973891573291174E-01 }, /* 699 Hz */
-    { 9.986927135483012E-01, -1.989006250568617E+00, 9.986927135483012E-01, -1.989006250568617E+00, 9.973854270966025E-01 }, /* 700 Hz */
-    { 9.986908484390009E-01, -1.988978595251177E+00, 9.986908484390009E-01, -1.988978595251177E+00, 9.973816968780018E-01 }, /* 701 Hz */
-    { 9.986889833366578E-01, -1.988950905956467E+00, 9.986889833366578E-01, -1.988950905956467E+00, 9.973779666733156E-01 }, /* 702 Hz */
-    { 9.986871182412720E-01, -1.988923182685087E+00, 9.986871182412720E-01, -1.988923182685087E+00, 9.973742364825440E-01 }, /* 703 Hz */
-    { 9.986852531528432E-01, -1.988895425437641E+00, 9.986852531528432E-01, -1.988895425437641E+00, 9.973705063056864E-01 }, /* 704 Hz */
-    { 9.986833880713715E-01, -1.988867634214729E+00, 9.986833880713715E-01, -1.988867634214729E+00, 9.973667761427429E-01 }, /* 705 Hz */
-    { 9.986815229968569E-01, -1.988839809016955E+00, 9.986815229968569E-01, -1.988839809016955E+00, 9.973630459937137E-01 }, /* 706 Hz */
-    { 9.986796579292991E-01, -1.988811949844923E+00, 9.986796579292991E-01, -1.988811949844923E+00, 9.973593158585983E-01 }, /* 707 Hz */
-    { 9.986777928686983E-01, -1.988784056699236E+00, 9.986777928686983E-01, -1.988784056699236E+00, 9.973555857373966E-01 }, /* 708 Hz */
-    { 9.986759278150542E-01, -1.988756129580498E+00, 9.986759278150542E-01, -1.988756129580498E+00, 9.973518556301084E-01 }, /* 709 Hz */
-    { 9.986740627683671E-01, -1.988728168489316E+00, 9.986740627683671E-01, -1.988728168489316E+00, 9.973481255367342E-01 }, /* 710 Hz */
-    { 9.986721977286367E-01, -1.988700173426294E+00, 9.986721977286367E-01, -1.988700173426294E+00, 9.973443954572734E-01 }, /* 711 Hz */
-    { 9.986703326958629E-01, -1.988672144392040E+00, 9.986703326958629E-01, -1.988672144392040E+00, 9.973406653917258E-01 }, /* 712 Hz */
-    { 9.986684676700458E-01, -1.988644081387160E+00, 9.986684676700458E-01, -1.988644081387160E+00, 9.973369353400916E-01 }, /* 713 Hz */
-    { 9.986666026511853E-01, -1.988615984412262E+00, 9.986666026511853E-01, -1.988615984412262E+00, 9.973332053023707E-01 }, /* 714 Hz */
-    { 9.986647376392813E-01, -1.988587853467953E+00, 9.986647376392813E-01, -1.988587853467953E+00, 9.973294752785626E-01 }, /* 715 Hz */
-    { 9.986628726343338E-01, -1.988559688554843E+00, 9.986628726343338E-01, -1.988559688554843E+00, 9.973257452686677E-01 }, /* 716 Hz */
-    { 9.986610076363429E-01, -1.988531489673540E+00, 9.986610076363429E-01, -1.988531489673540E+00, 9.973220152726858E-01 }, /* 717 Hz */
-    { 9.986591426453082E-01, -1.988503256824655E+00, 9.986591426453082E-01, -1.988503256824655E+00, 9.973182852906164E-01 }, /* 718 Hz */
-    { 9.986572776612298E-01, -1.988474990008798E+00, 9.986572776612298E-01, -1.988474990008798E+00, 9.973145553224596E-01 }, /* 719 Hz */
-    { 9.986554126841077E-01, -1.988446689226580E+00, 9.986554126841077E-01, -1.988446689226580E+00, 9.973108253682155E-01 }, /* 720 Hz */
-    { 9.986535477139421E-01, -1.988418354478612E+00, 9.986535477139421E-01, -1.988418354478612E+00, 9.973070954278842E-01 }, /* 721 Hz */
-    { 9.986516827507325E-01, -1.988389985765507E+00, 9.986516827507325E-01, -1.988389985765507E+00, 9.973033655014649E-01 }, /* 722 Hz */
-    { 9.986498177944788E-01, -1.988361583087877E+00, 9.986498177944788E-01, -1.988361583087877E+00, 9.972996355889576E-01 }, /* 723 Hz */
-    { 9.986479528451814E-01, -1.988333146446336E+00, 9.986479528451814E-01, -1.988333146446336E+00, 9.972959056903627E-01 }, /* 724 Hz */
-    { 9.986460879028399E-01, -1.988304675841497E+00, 9.986460879028399E-01, -1.988304675841497E+00, 9.972921758056799E-01 }, /* 725 Hz */
-    { 9.986442229674546E-01, -1.988276171273976E+00, 9.986442229674546E-01, -1.988276171273976E+00, 9.972884459349092E-01 }, /* 726 Hz */
-    { 9.986423580390250E-01, -1.988247632744387E+00, 9.986423580390250E-01, -1.988247632744387E+00, 9.972847160780500E-01 }, /* 727 Hz */
-    { 9.986404931175514E-01, -1.988219060253344E+00, 9.986404931175514E-01, -1.988219060253344E+00, 9.972809862351029E-01 }, /* 728 Hz */
-    { 9.986386282030335E-01, -1.988190453801466E+00, 9.986386282030335E-01, -1.988190453801466E+00, 9.972772564060670E-01 }, /* 729 Hz */
-    { 9.986367632954714E-01, -1.988161813389369E+00, 9.986367632954714E-01, -1.988161813389369E+00, 9.972735265909427E-01 }, /* 730 Hz */
-    { 9.986348983948650E-01, -1.988133139017669E+00, 9.986348983948650E-01, -1.988133139017669E+00, 9.972697967897299E-01 }, /* 731 Hz */
-    { 9.986330335012142E-01, -1.988104430686986E+00, 9.986330335012142E-01, -1.988104430686986E+00, 9.972660670024285E-01 }, /* 732 Hz */
-    { 9.986311686145191E-01, -1.988075688397936E+00, 9.986311686145191E-01, -1.988075688397936E+00, 9.972623372290381E-01 }, /* 733 Hz */
-    { 9.986293037347795E-01, -1.988046912151141E+00, 9.986293037347795E-01, -1.988046912151141E+00, 9.972586074695591E-01 }, /* 734 Hz */
-    { 9.986274388619953E-01, -1.988018101947218E+00, 9.986274388619953E-01, -1.988018101947218E+00, 9.972548777239907E-01 }, /* 735 Hz */
-    { 9.986255739961669E-01, -1.987989257786789E+00, 9.986255739961669E-01, -1.987989257786789E+00, 9.972511479923338E-01 }, /* 736 Hz */
-    { 9.986237091372937E-01, -1.987960379670475E+00, 9.986237091372937E-01, -1.987960379670475E+00, 9.972474182745874E-01 }, /* 737 Hz */
-    { 9.986218442853757E-01, -1.987931467598896E+00, 9.986218442853757E-01, -1.987931467598896E+00, 9.972436885707514E-01 }, /* 738 Hz */
-    { 9.986199794404130E-01, -1.987902521572674E+00, 9.986199794404130E-01, -1.987902521572674E+00, 9.972399588808261E-01 }, /* 739 Hz */
-    { 9.986181146024058E-01, -1.987873541592433E+00, 9.986181146024058E-01, -1.987873541592433E+00, 9.972362292048116E-01 }, /* 740 Hz */
-    { 9.986162497713537E-01, -1.987844527658796E+00, 9.986162497713537E-01, -1.987844527658796E+00, 9.972324995427073E-01 }, /* 741 Hz */
-    { 9.986143849472565E-01, -1.987815479772385E+00, 9.986143849472565E-01, -1.987815479772385E+00, 9.972287698945130E-01 }, /* 742 Hz */
-    { 9.986125201301147E-01, -1.987786397933826E+00, 9.986125201301147E-01, -1.987786397933826E+00, 9.972250402602294E-01 }, /* 743 Hz */
-    { 9.986106553199277E-01, -1.987757282143743E+00, 9.986106553199277E-01, -1.987757282143743E+00, 9.972213106398553E-01 }, /* 744 Hz */
-    { 9.986087905166957E-01, -1.987728132402762E+00, 9.986087905166957E-01, -1.987728132402762E+00, 9.972175810333914E-01 }, /* 745 Hz */
-    { 9.986069257204186E-01, -1.987698948711509E+00, 9.986069257204186E-01, -1.987698948711509E+00, 9.972138514408373E-01 }, /* 746 Hz */
-    { 9.986050609310967E-01, -1.987669731070611E+00, 9.986050609310967E-01, -1.987669731070611E+00, 9.972101218621934E-01 }, /* 747 Hz */
-    { 9.986031961487294E-01, -1.987640479480694E+00, 9.986031961487294E-01, -1.987640479480694E+00, 9.972063922974588E-01 }, /* 748 Hz */
-    { 9.986013313733169E-01, -1.987611193942386E+00, 9.986013313733169E-01, -1.987611193942386E+00, 9.972026627466337E-01 }, /* 749 Hz */
-    { 9.985994666048590E-01, -1.987581874456317E+00, 9.985994666048590E-01, -1.987581874456317E+00, 9.971989332097180E-01 }, /* 750 Hz */
-    { 9.985976018433559E-01, -1.987552521023114E+00, 9.985976018433559E-01, -1.987552521023114E+00, 9.971952036867118E-01 }, /* 751 Hz */
-    { 9.985957370888073E-01, -1.987523133643406E+00, 9.985957370888073E-01, -1.987523133643406E+00, 9.971914741776147E-01 }, /* 752 Hz */
-    { 9.985938723412134E-01, -1.987493712317826E+00, 9.985938723412134E-01, -1.987493712317826E+00, 9.971877446824269E-01 }, /* 753 Hz */
-    { 9.985920076005741E-01, -1.987464257047003E+00, 9.985920076005741E-01, -1.987464257047003E+00, 9.971840152011482E-01 }, /* 754 Hz */
-    { 9.985901428668890E-01, -1.987434767831568E+00, 9.985901428668890E-01, -1.987434767831568E+00, 9.971802857337779E-01 }, /* 755 Hz */
-    { 9.985882781401584E-01, -1.987405244672153E+00, 9.985882781401584E-01, -1.987405244672153E+00, 9.971765562803168E-01 }, /* 756 Hz */
-    { 9.985864134203822E-01, -1.987375687569390E+00, 9.985864134203822E-01, -1.987375687569390E+00, 9.971728268407645E-01 }, /* 757 Hz */
-    { 9.985845487075604E-01, -1.987346096523913E+00, 9.985845487075604E-01, -1.987346096523913E+00, 9.971690974151208E-01 }, /* 758 Hz */
-    { 9.985826840016927E-01, -1.987316471536355E+00, 9.985826840016927E-01, -1.987316471536355E+00, 9.971653680033854E-01 }, /* 759 Hz */
-    { 9.985808193027793E-01, -1.987286812607351E+00, 9.985808193027793E-01, -1.987286812607351E+00, 9.971616386055586E-01 }, /* 760 Hz */
-    { 9.985789546108200E-01, -1.987257119737534E+00, 9.985789546108200E-01, -1.987257119737534E+00, 9.971579092216400E-01 }, /* 761 Hz */
-    { 9.985770899258148E-01, -1.987227392927541E+00, 9.985770899258148E-01, -1.987227392927541E+00, 9.971541798516297E-01 }, /* 762 Hz */
-    { 9.985752252477637E-01, -1.987197632178006E+00, 9.985752252477637E-01, -1.987197632178006E+00, 9.971504504955273E-01 }, /* 763 Hz */
-    { 9.985733605766665E-01, -1.987167837489567E+00, 9.985733605766665E-01, -1.987167837489567E+00, 9.971467211533329E-01 }, /* 764 Hz */
-    { 9.985714959125233E-01, -1.987138008862861E+00, 9.985714959125233E-01, -1.987138008862861E+00, 9.971429918250465E-01 }, /* 765 Hz */
-    { 9.985696312553338E-01, -1.987108146298525E+00, 9.985696312553338E-01, -1.987108146298525E+00, 9.971392625106676E-01 }, /* 766 Hz */
-    { 9.985677666050984E-01, -1.987078249797198E+00, 9.985677666050984E-01, -1.987078249797198E+00, 9.971355332101968E-01 }, /* 767 Hz */
-    { 9.985659019618167E-01, -1.987048319359518E+00, 9.985659019618167E-01, -1.987048319359518E+00, 9.971318039236334E-01 }, /* 768 Hz */
-    { 9.985640373254888E-01, -1.987018354986124E+00, 9.985640373254888E-01, -1.987018354986124E+00, 9.971280746509776E-01 }, /* 769 Hz */
-    { 9.985621726961145E-01, -1.986988356677657E+00, 9.985621726961145E-01, -1.986988356677657E+00, 9.971243453922289E-01 }, /* 770 Hz */
-    { 9.985603080736938E-01, -1.986958324434757E+00, 9.985603080736938E-01, -1.986958324434757E+00, 9.971206161473876E-01 }, /* 771 Hz */
-    { 9.985584434582269E-01, -1.986928258258065E+00, 9.985584434582269E-01, -1.986928258258065E+00, 9.971168869164537E-01 }, /* 772 Hz */
-    { 9.985565788497133E-01, -1.986898158148223E+00, 9.985565788497133E-01, -1.986898158148223E+00, 9.971131576994265E-01 }, /* 773 Hz */
-    { 9.985547142481533E-01, -1.986868024105873E+00, 9.985547142481533E-01, -1.986868024105873E+00, 9.971094284963067E-01 }, /* 774 Hz */
-    { 9.985528496535464E-01, -1.986837856131657E+00, 9.985528496535464E-01, -1.986837856131657E+00, 9.971056993070928E-01 }, /* 775 Hz */
-    { 9.985509850658933E-01, -1.986807654226221E+00, 9.985509850658933E-01, -1.986807654226221E+00, 9.971019701317867E-01 }, /* 776 Hz */
-    { 9.985491204851932E-01, -1.986777418390206E+00, 9.985491204851932E-01, -1.986777418390206E+00, 9.970982409703864E-01 }, /* 777 Hz */
-    { 9.985472559114466E-01, -1.986747148624258E+00, 9.985472559114466E-01, -1.986747148624258E+00, 9.970945118228931E-01 }, /* 778 Hz */
-    { 9.985453913446530E-01, -1.986716844929022E+00, 9.985453913446530E-01, -1.986716844929022E+00, 9.970907826893061E-01 }, /* 779 Hz */
-    { 9.985435267848127E-01, -1.986686507305143E+00, 9.985435267848127E-01, -1.986686507305143E+00, 9.970870535696255E-01 }, /* 780 Hz */
-    { 9.985416622319258E-01, -1.986656135753270E+00, 9.985416622319258E-01, -1.986656135753270E+00, 9.970833244638515E-01 }, /* 781 Hz */
-    { 9.985397976859915E-01, -1.986625730274046E+00, 9.985397976859915E-01, -1.986625730274046E+00, 9.970795953719831E-01 }, /* 782 Hz */
-    { 9.985379331470103E-01, -1.986595290868121E+00, 9.985379331470103E-01, -1.986595290868121E+00, 9.970758662940207E-01 }, /* 783 Hz */
-    { 9.985360686149821E-01, -1.986564817536142E+00, 9.985360686149821E-01, -1.986564817536142E+00, 9.970721372299642E-01 }, /* 784 Hz */
-    { 9.985342040899069E-01, -1.986534310278758E+00, 9.985342040899069E-01, -1.986534310278758E+00, 9.970684081798138E-01 }, /* 785 Hz */
-    { 9.985323395717846E-01, -1.986503769096619E+00, 9.985323395717846E-01, -1.986503769096619E+00, 9.970646791435691E-01 }, /* 786 Hz */
-    { 9.985304750606149E-01, -1.986473193990373E+00, 9.985304750606149E-01, -1.986473193990373E+00, 9.970609501212297E-01 }, /* 787 Hz */
-    { 9.985286105563981E-01, -1.986442584960671E+00, 9.985286105563981E-01, -1.986442584960671E+00, 9.970572211127962E-01 }, /* 788 Hz */
-    { 9.985267460591337E-01, -1.986411942008165E+00, 9.985267460591337E-01, -1.986411942008165E+00, 9.970534921182674E-01 }, /* 789 Hz */
-    { 9.985248815688224E-01, -1.986381265133505E+00, 9.985248815688224E-01, -1.986381265133505E+00, 9.970497631376447E-01 }, /* 790 Hz */
-    { 9.985230170854633E-01, -1.986350554337344E+00, 9.985230170854633E-01, -1.986350554337344E+00, 9.970460341709266E-01 }, /* 791 Hz */
-    { 9.985211526090569E-01, -1.986319809620334E+00, 9.985211526090569E-01, -1.986319809620334E+00, 9.970423052181139E-01 }, /* 792 Hz */
-    { 9.985192881396030E-01, -1.986289030983130E+00, 9.985192881396030E-01, -1.986289030983130E+00, 9.970385762792060E-01 }, /* 793 Hz */
-    { 9.985174236771016E-01, -1.986258218426384E+00, 9.985174236771016E-01, -1.986258218426384E+00, 9.970348473542032E-01 }, /* 794 Hz */
-    { 9.985155592215526E-01, -1.986227371950750E+00, 9.985155592215526E-01, -1.986227371950750E+00, 9.970311184431051E-01 }, /* 795 Hz */
-    { 9.985136947729557E-01, -1.986196491556884E+00, 9.985136947729557E-01, -1.986196491556884E+00, 9.970273895459114E-01 }, /* 796 Hz */
-    { 9.985118303313112E-01, -1.986165577245442E+00, 9.985118303313112E-01, -1.986165577245442E+00, 9.970236606626224E-01 }, /* 797 Hz */
-    { 9.985099658966189E-01, -1.986134629017079E+00, 9.985099658966189E-01, -1.986134629017079E+00, 9.970199317932378E-01 }, /* 798 Hz */
-    { 9.985081014688788E-01, -1.986103646872452E+00, 9.985081014688788E-01, -1.986103646872452E+00, 9.970162029377576E-01 }, /* 799 Hz */
-    { 9.985062370480908E-01, -1.986072630812219E+00, 9.985062370480908E-01, -1.986072630812219E+00, 9.970124740961817E-01 }, /* 800 Hz */
-    { 9.985043726342550E-01, -1.986041580837038E+00, 9.985043726342550E-01, -1.986041580837038E+00, 9.970087452685099E-01 }, /* 801 Hz */
-    { 9.985025082273711E-01, -1.986010496947566E+00, 9.985025082273711E-01, -1.986010496947566E+00, 9.970050164547422E-01 }, /* 802 Hz */
-    { 9.985006438274393E-01, -1.985979379144464E+00, 9.985006438274393E-01, -1.985979379144464E+00, 9.970012876548786E-01 }, /* 803 Hz */
-    { 9.984987794344593E-01, -1.985948227428389E+00, 9.984987794344593E-01, -1.985948227428389E+00, 9.969975588689186E-01 }, /* 804 Hz */
-    { 9.984969150484312E-01, -1.985917041800003E+00, 9.984969150484312E-01, -1.985917041800003E+00, 9.969938300968624E-01 }, /* 805 Hz */
-    { 9.984950506693550E-01, -1.985885822259967E+00, 9.984950506693550E-01, -1.985885822259967E+00, 9.969901013387099E-01 }, /* 806 Hz */
-    { 9.984931862972305E-01, -1.985854568808941E+00, 9.984931862972305E-01, -1.985854568808941E+00, 9.969863725944610E-01 }, /* 807 Hz */
-    { 9.984913219320575E-01, -1.985823281447588E+00, 9.984913219320575E-01, -1.985823281447588E+00, 9.969826438641149E-01 }, /* 808 Hz */
-    { 9.984894575738363E-01, -1.985791960176569E+00, 9.984894575738363E-01, -1.985791960176569E+00, 9.969789151476727E-01 }, /* 809 Hz */
-    { 9.984875932225667E-01, -1.985760604996550E+00, 9.984875932225667E-01, -1.985760604996550E+00, 9.969751864451335E-01 }, /* 810 Hz */
-    { 9.984857288782488E-01, -1.985729215908192E+00, 9.984857288782488E-01, -1.985729215908192E+00, 9.969714577564976E-01 }, /* 811 Hz */
-    { 9.984838645408823E-01, -1.985697792912160E+00, 9.984838645408823E-01, -1.985697792912160E+00, 9.969677290817647E-01 }, /* 812 Hz */
-    { 9.984820002104673E-01, -1.985666336009119E+00, 9.984820002104673E-01, -1.985666336009119E+00, 9.969640004209346E-01 }, /* 813 Hz */
-    { 9.984801358870037E-01, -1.985634845199734E+00, 9.984801358870037E-01, -1.985634845199734E+00, 9.969602717740074E-01 }, /* 814 Hz */
-    { 9.984782715704913E-01, -1.985603320484671E+00, 9.984782715704913E-01, -1.985603320484671E+00, 9.969565431409826E-01 }, /* 815 Hz */
-    { 9.984764072609302E-01, -1.985571761864597E+00, 9.984764072609302E-01, -1.985571761864597E+00, 9.969528145218605E-01 }, /* 816 Hz */
-    { 9.984745429583205E-01, -1.985540169340180E+00, 9.984745429583205E-01, -1.985540169340180E+00, 9.969490859166410E-01 }, /* 817 Hz */
-    { 9.984726786626619E-01, -1.985508542912085E+00, 9.984726786626619E-01, -1.985508542912085E+00, 9.969453573253237E-01 }, /* 818 Hz */
-    { 9.984708143739545E-01, -1.985476882580982E+00, 9.984708143739545E-01, -1.985476882580982E+00, 9.969416287479089E-01 }, /* 819 Hz */
-    { 9.984689500921982E-01, -1.985445188347540E+00, 9.984689500921982E-01, -1.985445188347540E+00, 9.969379001843963E-01 }, /* 820 Hz */
-    { 9.984670858173929E-01, -1.985413460212428E+00, 9.984670858173929E-01, -1.985413460212428E+00, 9.969341716347857E-01 }, /* 821 Hz */
-    { 9.984652215495385E-01, -1.985381698176316E+00, 9.984652215495385E-01, -1.985381698176316E+00, 9.969304430990771E-01 }, /* 822 Hz */
-    { 9.984633572886350E-01, -1.985349902239875E+00, 9.984633572886350E-01, -1.985349902239875E+00, 9.969267145772700E-01 }, /* 823 Hz */
-    { 9.984614930346825E-01, -1.985318072403775E+00, 9.984614930346825E-01, -1.985318072403775E+00, 9.969229860693649E-01 }, /* 824 Hz */
-    { 9.984596287876809E-01, -1.985286208668690E+00, 9.984596287876809E-01, -1.985286208668690E+00, 9.969192575753618E-01 }, /* 825 Hz */
-    { 9.984577645476297E-01, -1.985254311035289E+00, 9.984577645476297E-01, -1.985254311035289E+00, 9.969155290952594E-01 }, /* 826 Hz */
-    { 9.984559003145297E-01, -1.985222379504248E+00, 9.984559003145297E-01, -1.985222379504248E+00, 9.969118006290594E-01 }, /* 827 Hz */
-    { 9.984540360883800E-01, -1.985190414076239E+00, 9.984540360883800E-01, -1.985190414076239E+00, 9.969080721767600E-01 }, /* 828 Hz */
-    { 9.984521718691812E-01, -1.985158414751937E+00, 9.984521718691812E-01, -1.985158414751937E+00, 9.969043437383625E-01 }, /* 829 Hz */
-    { 9.984503076569329E-01, -1.985126381532015E+00, 9.984503076569329E-01, -1.985126381532015E+00, 9.969006153138658E-01 }, /* 830 Hz */
-    { 9.984484434516350E-01, -1.985094314417149E+00, 9.984484434516350E-01, -1.985094314417149E+00, 9.968968869032699E-01 }, /* 831 Hz */
-    { 9.984465792532876E-01, -1.985062213408015E+00, 9.984465792532876E-01, -1.985062213408015E+00, 9.968931585065752E-01 }, /* 832 Hz */
-    { 9.984447150618906E-01, -1.985030078505289E+00, 9.984447150618906E-01, -1.985030078505289E+00, 9.968894301237812E-01 }, /* 833 Hz */
-    { 9.984428508774440E-01, -1.984997909709649E+00, 9.984428508774440E-01, -1.984997909709649E+00, 9.968857017548880E-01 }, /* 834 Hz */
-    { 9.984409866999477E-01, -1.984965707021772E+00, 9.984409866999477E-01, -1.984965707021772E+00, 9.968819733998955E-01 }, /* 835 Hz */
-    { 9.984391225294017E-01, -1.984933470442335E+00, 9.984391225294017E-01, -1.984933470442335E+00, 9.968782450588034E-01 }, /* 836 Hz */
-    { 9.984372583658058E-01, -1.984901199972017E+00, 9.984372583658058E-01, -1.984901199972017E+00, 9.968745167316115E-01 }, /* 837 Hz */
-    { 9.984353942091601E-01, -1.984868895611499E+00, 9.984353942091601E-01, -1.984868895611499E+00, 9.968707884183201E-01 }, /* 838 Hz */
-    { 9.984335300594646E-01, -1.984836557361459E+00, 9.984335300594646E-01, -1.984836557361459E+00, 9.968670601189291E-01 }, /* 839 Hz */
-    { 9.984316659167189E-01, -1.984804185222578E+00, 9.984316659167189E-01, -1.984804185222578E+00, 9.968633318334379E-01 }, /* 840 Hz */
-    { 9.984298017809233E-01, -1.984771779195536E+00, 9.984298017809233E-01, -1.984771779195536E+00, 9.968596035618467E-01 }, /* 841 Hz */
-    { 9.984279376520779E-01, -1.984739339281017E+00, 9.984279376520779E-01, -1.984739339281017E+00, 9.968558753041559E-01 }, /* 842 Hz */
-    { 9.984260735301823E-01, -1.984706865479701E+00, 9.984260735301823E-01, -1.984706865479701E+00, 9.968521470603646E-01 }, /* 843 Hz */
-    { 9.984242094152364E-01, -1.984674357792271E+00, 9.984242094152364E-01, -1.984674357792271E+00, 9.968484188304727E-01 }, /* 844 Hz */
-    { 9.984223453072402E-01, -1.984641816219411E+00, 9.984223453072402E-01, -1.984641816219411E+00, 9.968446906144803E-01 }, /* 845 Hz */
-    { 9.984204812061940E-01, -1.984609240761805E+00, 9.984204812061940E-01, -1.984609240761805E+00, 9.968409624123880E-01 }, /* 846 Hz */
-    { 9.984186171120973E-01, -1.984576631420136E+00, 9.984186171120973E-01, -1.984576631420136E+00, 9.968372342241947E-01 }, /* 847 Hz */
-    { 9.984167530249503E-01, -1.984543988195090E+00, 9.984167530249503E-01, -1.984543988195090E+00, 9.968335060499005E-01 }, /* 848 Hz */
-    { 9.984148889447528E-01, -1.984511311087353E+00, 9.984148889447528E-01, -1.984511311087353E+00, 9.968297778895057E-01 }, /* 849 Hz */
-    { 9.984130248715050E-01, -1.984478600097611E+00, 9.984130248715050E-01, -1.984478600097611E+00, 9.968260497430099E-01 }, /* 850 Hz */
-    { 9.984111608052063E-01, -1.984445855226550E+00, 9.984111608052063E-01, -1.984445855226550E+00, 9.968223216104126E-01 }, /* 851 Hz */
-    { 9.984092967458573E-01, -1.984413076474858E+00, 9.984092967458573E-01, -1.984413076474858E+00, 9.968185934917146E-01 }, /* 852 Hz */
-    { 9.984074326934578E-01, -1.984380263843224E+00, 9.984074326934578E-01, -1.984380263843224E+00, 9.968148653869155E-01 }, /* 853 Hz */
-    { 9.984055686480073E-01, -1.984347417332333E+00, 9.984055686480073E-01, -1.984347417332333E+00, 9.968111372960147E-01 }, /* 854 Hz */
-    { 9.984037046095063E-01, -1.984314536942878E+00, 9.984037046095063E-01, -1.984314536942878E+00, 9.968074092190127E-01 }, /* 855 Hz */
-    { 9.984018405779546E-01, -1.984281622675547E+00, 9.984018405779546E-01, -1.984281622675547E+00, 9.968036811559091E-01 }, /* 856 Hz */
-    { 9.983999765533518E-01, -1.984248674531029E+00, 9.983999765533518E-01, -1.984248674531029E+00, 9.967999531067036E-01 }, /* 857 Hz */
-    { 9.983981125356983E-01, -1.984215692510017E+00, 9.983981125356983E-01, -1.984215692510017E+00, 9.967962250713966E-01 }, /* 858 Hz */
-    { 9.983962485249938E-01, -1.984182676613201E+00, 9.983962485249938E-01, -1.984182676613201E+00, 9.967924970499875E-01 }, /* 859 Hz */
-    { 9.983943845212384E-01, -1.984149626841273E+00, 9.983943845212384E-01, -1.984149626841273E+00, 9.967887690424768E-01 }, /* 860 Hz */
-    { 9.983925205244318E-01, -1.984116543194927E+00, 9.983925205244318E-01, -1.984116543194927E+00, 9.967850410488637E-01 }, /* 861 Hz */
-    { 9.983906565345744E-01, -1.984083425674854E+00, 9.983906565345744E-01, -1.984083425674854E+00, 9.967813130691487E-01 }, /* 862 Hz */
-    { 9.983887925516655E-01, -1.984050274281749E+00, 9.983887925516655E-01, -1.984050274281749E+00, 9.967775851033309E-01 }, /* 863 Hz */
-    { 9.983869285757055E-01, -1.984017089016306E+00, 9.983869285757055E-01, -1.984017089016306E+00, 9.967738571514111E-01 }, /* 864 Hz */
-    { 9.983850646066944E-01, -1.983983869879219E+00, 9.983850646066944E-01, -1.983983869879219E+00, 9.967701292133888E-01 }, /* 865 Hz */
-    { 9.983832006446317E-01, -1.983950616871185E+00, 9.983832006446317E-01, -1.983950616871185E+00, 9.967664012892634E-01 }, /* 866 Hz */
-    { 9.983813366895179E-01, -1.983917329992899E+00, 9.983813366895179E-01, -1.983917329992899E+00, 9.967626733790358E-01 }, /* 867 Hz */
-    { 9.983794727413526E-01, -1.983884009245057E+00, 9.983794727413526E-01, -1.983884009245057E+00, 9.967589454827053E-01 }, /* 868 Hz */
-    { 9.983776088001360E-01, -1.983850654628358E+00, 9.983776088001360E-01, -1.983850654628358E+00, 9.967552176002721E-01 }, /* 869 Hz */
-    { 9.983757448658677E-01, -1.983817266143498E+00, 9.983757448658677E-01, -1.983817266143498E+00, 9.967514897317353E-01 }, /* 870 Hz */
-    { 9.983738809385481E-01, -1.983783843791177E+00, 9.983738809385481E-01, -1.983783843791177E+00, 9.967477618770961E-01 }, /* 871 Hz */
-    { 9.983720170181767E-01, -1.983750387572092E+00, 9.983720170181767E-01, -1.983750387572092E+00, 9.967440340363534E-01 }, /* 872 Hz */
-    { 9.983701531047534E-01, -1.983716897486943E+00, 9.983701531047534E-01, -1.983716897486943E+00, 9.967403062095068E-01 }, /* 873 Hz */
-    { 9.983682891982786E-01, -1.983683373536430E+00, 9.983682891982786E-01, -1.983683373536430E+00, 9.967365783965572E-01 }, /* 874 Hz */
-    { 9.983664252987521E-01, -1.983649815721255E+00, 9.983664252987521E-01, -1.983649815721255E+00, 9.967328505975042E-01 }, /* 875 Hz */
-    { 9.983645614061737E-01, -1.983616224042117E+00, 9.983645614061737E-01, -1.983616224042117E+00, 9.967291228123474E-01 }, /* 876 Hz */
-    { 9.983626975205435E-01, -1.983582598499720E+00, 9.983626975205435E-01, -1.983582598499720E+00, 9.967253950410870E-01 }, /* 877 Hz */
-    { 9.983608336418615E-01, -1.983548939094765E+00, 9.983608336418615E-01, -1.983548939094765E+00, 9.967216672837229E-01 }, /* 878 Hz */
-    { 9.983589697701273E-01, -1.983515245827955E+00, 9.983589697701273E-01, -1.983515245827955E+00, 9.967179395402546E-01 }, /* 879 Hz */
-    { 9.983571059053410E-01, -1.983481518699993E+00, 9.983571059053410E-01, -1.983481518699993E+00, 9.967142118106820E-01 }, /* 880 Hz */
-    { 9.983552420475028E-01, -1.983447757711584E+00, 9.983552420475028E-01, -1.983447757711584E+00, 9.967104840950056E-01 }, /* 881 Hz */
-    { 9.983533781966125E-01, -1.983413962863433E+00, 9.983533781966125E-01, -1.983413962863433E+00, 9.967067563932250E-01 }, /* 882 Hz */
-    { 9.983515143526698E-01, -1.983380134156244E+00, 9.983515143526698E-01, -1.983380134156244E+00, 9.967030287053396E-01 }, /* 883 Hz */
-    { 9.983496505156750E-01, -1.983346271590724E+00, 9.983496505156750E-01, -1.983346271590724E+00, 9.966993010313501E-01 }, /* 884 Hz */
-    { 9.983477866856280E-01, -1.983312375167579E+00, 9.983477866856280E-01, -1.983312375167579E+00, 9.966955733712559E-01 }, /* 885 Hz */
-    { 9.983459228625284E-01, -1.983278444887515E+00, 9.983459228625284E-01, -1.983278444887515E+00, 9.966918457250569E-01 }, /* 886 Hz */
-    { 9.983440590463768E-01, -1.983244480751241E+00, 9.983440590463768E-01, -1.983244480751241E+00, 9.966881180927536E-01 }, /* 887 Hz */
-    { 9.983421952371725E-01, -1.983210482759463E+00, 9.983421952371725E-01, -1.983210482759463E+00, 9.966843904743450E-01 }, /* 888 Hz */
-    { 9.983403314349157E-01, -1.983176450912893E+00, 9.983403314349157E-01, -1.983176450912893E+00, 9.966806628698315E-01 }, /* 889 Hz */
-    { 9.983384676396063E-01, -1.983142385212237E+00, 9.983384676396063E-01, -1.983142385212237E+00, 9.966769352792126E-01 }, /* 890 Hz */
-    { 9.983366038512445E-01, -1.983108285658207E+00, 9.983366038512445E-01, -1.983108285658207E+00, 9.966732077024889E-01 }, /* 891 Hz */
-    { 9.983347400698299E-01, -1.983074152251512E+00, 9.983347400698299E-01, -1.983074152251512E+00, 9.966694801396598E-01 }, /* 892 Hz */
-    { 9.983328762953627E-01, -1.983039984992864E+00, 9.983328762953627E-01, -1.983039984992864E+00, 9.966657525907254E-01 }, /* 893 Hz */
-    { 9.983310125278426E-01, -1.983005783882975E+00, 9.983310125278426E-01, -1.983005783882975E+00, 9.966620250556852E-01 }, /* 894 Hz */
-    { 9.983291487672699E-01, -1.982971548922556E+00, 9.983291487672699E-01, -1.982971548922556E+00, 9.966582975345397E-01 }, /* 895 Hz */
-    { 9.983272850136441E-01, -1.982937280112320E+00, 9.983272850136441E-01, -1.982937280112320E+00, 9.966545700272882E-01 }, /* 896 Hz */
-    { 9.983254212669656E-01, -1.982902977452980E+00, 9.983254212669656E-01, -1.982902977452980E+00, 9.966508425339311E-01 }, /* 897 Hz */
-    { 9.983235575272341E-01, -1.982868640945251E+00, 9.983235575272341E-01, -1.982868640945251E+00, 9.966471150544682E-01 }, /* 898 Hz */
-    { 9.983216937944493E-01, -1.982834270589846E+00, 9.983216937944493E-01, -1.982834270589846E+00, 9.966433875888987E-01 }, /* 899 Hz */
-    { 9.983198300686119E-01, -1.982799866387481E+00, 9.983198300686119E-01, -1.982799866387481E+00, 9.966396601372238E-01 }, /* 900 Hz */
-    { 9.983179663497210E-01, -1.982765428338872E+00, 9.983179663497210E-01, -1.982765428338872E+00, 9.966359326994421E-01 }, /* 901 Hz */
-    { 9.983161026377771E-01, -1.982730956444734E+00, 9.983161026377771E-01, -1.982730956444734E+00, 9.966322052755543E-01 }, /* 902 Hz */
-    { 9.983142389327799E-01, -1.982696450705785E+00, 9.983142389327799E-01, -1.982696450705785E+00, 9.966284778655599E-01 }, /* 903 Hz */
-    { 9.983123752347297E-01, -1.982661911122741E+00, 9.983123752347297E-01, -1.982661911122741E+00, 9.966247504694594E-01 }, /* 904 Hz */
-    { 9.983105115436258E-01, -1.982627337696321E+00, 9.983105115436258E-01, -1.982627337696321E+00, 9.966210230872516E-01 }, /* 905 Hz */
-    { 9.983086478594687E-01, -1.982592730427244E+00, 9.983086478594687E-01, -1.982592730427244E+00, 9.966172957189374E-01 }, /* 906 Hz */
-    { 9.983067841822582E-01, -1.982558089316227E+00, 9.983067841822582E-01, -1.982558089316227E+00, 9.966135683645163E-01 }, /* 907 Hz */
-    { 9.983049205119942E-01, -1.982523414363992E+00, 9.983049205119942E-01, -1.982523414363992E+00, 9.966098410239883E-01 }, /* 908 Hz */
-    { 9.983030568486768E-01, -1.982488705571258E+00, 9.983030568486768E-01, -1.982488705571258E+00, 9.966061136973536E-01 }, /* 909 Hz */
-    { 9.983011931923057E-01, -1.982453962938746E+00, 9.983011931923057E-01, -1.982453962938746E+00, 9.966023863846114E-01 }, /* 910 Hz */
-    { 9.982993295428808E-01, -1.982419186467176E+00, 9.982993295428808E-01, -1.982419186467176E+00, 9.965986590857616E-01 }, /* 911 Hz */
-    { 9.982974659004022E-01, -1.982384376157272E+00, 9.982974659004022E-01, -1.982384376157272E+00, 9.965949318008045E-01 }, /* 912 Hz */
-    { 9.982956022648701E-01, -1.982349532009757E+00, 9.982956022648701E-01, -1.982349532009757E+00, 9.965912045297403E-01 }, /* 913 Hz */
-    { 9.982937386362841E-01, -1.982314654025351E+00, 9.982937386362841E-01, -1.982314654025351E+00, 9.965874772725682E-01 }, /* 914 Hz */
-    { 9.982918750146444E-01, -1.982279742204781E+00, 9.982918750146444E-01, -1.982279742204781E+00, 9.965837500292889E-01 }, /* 915 Hz */
-    { 9.982900113999507E-01, -1.982244796548770E+00, 9.982900113999507E-01, -1.982244796548770E+00, 9.965800227999013E-01 }, /* 916 Hz */
-    { 9.982881477922029E-01, -1.982209817058042E+00, 9.982881477922029E-01, -1.982209817058042E+00, 9.965762955844057E-01 }, /* 917 Hz */
-    { 9.982862841914013E-01, -1.982174803733323E+00, 9.982862841914013E-01, -1.982174803733323E+00, 9.965725683828026E-01 }, /* 918 Hz */
-    { 9.982844205975455E-01, -1.982139756575340E+00, 9.982844205975455E-01, -1.982139756575340E+00, 9.965688411950910E-01 }, /* 919 Hz */
-    { 9.982825570106356E-01, -1.982104675584818E+00, 9.982825570106356E-01, -1.982104675584818E+00, 9.965651140212712E-01 }, /* 920 Hz */
-    { 9.982806934306716E-01, -1.982069560762485E+00, 9.982806934306716E-01, -1.982069560762485E+00, 9.965613868613432E-01 }, /* 921 Hz */
-    { 9.982788298576535E-01, -1.982034412109068E+00, 9.982788298576535E-01, -1.982034412109068E+00, 9.965576597153070E-01 }, /* 922 Hz */
-    { 9.982769662915811E-01, -1.981999229625297E+00, 9.982769662915811E-01, -1.981999229625297E+00, 9.965539325831623E-01 }, /* 923 Hz */
-    { 9.982751027324543E-01, -1.981964013311899E+00, 9.982751027324543E-01, -1.981964013311899E+00, 9.965502054649087E-01 }, /* 924 Hz */
-    { 9.982732391802731E-01, -1.981928763169605E+00, 9.982732391802731E-01, -1.981928763169605E+00, 9.965464783605462E-01 }, /* 925 Hz */
-    { 9.982713756350378E-01, -1.981893479199144E+00, 9.982713756350378E-01, -1.981893479199144E+00, 9.965427512700755E-01 }, /* 926 Hz */
-    { 9.982695120967476E-01, -1.981858161401247E+00, 9.982695120967476E-01, -1.981858161401247E+00, 9.965390241934953E-01 }, /* 927 Hz */
-    { 9.982676485654031E-01, -1.981822809776645E+00, 9.982676485654031E-01, -1.981822809776645E+00, 9.965352971308061E-01 }, /* 928 Hz */
-    { 9.982657850410042E-01, -1.981787424326070E+00, 9.982657850410042E-01, -1.981787424326070E+00, 9.965315700820083E-01 }, /* 929 Hz */
-    { 9.982639215235503E-01, -1.981752005050253E+00, 9.982639215235503E-01, -1.981752005050253E+00, 9.965278430471005E-01 }, /* 930 Hz */
-    { 9.982620580130419E-01, -1.981716551949929E+00, 9.982620580130419E-01, -1.981716551949929E+00, 9.965241160260838E-01 }, /* 931 Hz */
-    { 9.982601945094788E-01, -1.981681065025830E+00, 9.982601945094788E-01, -1.981681065025830E+00, 9.965203890189576E-01 }, /* 932 Hz */
-    { 9.982583310128611E-01, -1.981645544278692E+00, 9.982583310128611E-01, -1.981645544278692E+00, 9.965166620257222E-01 }, /* 933 Hz */
-    { 9.982564675231883E-01, -1.981609989709247E+00, 9.982564675231883E-01, -1.981609989709247E+00, 9.965129350463766E-01 }, /* 934 Hz */
-    { 9.982546040404607E-01, -1.981574401318232E+00, 9.982546040404607E-01, -1.981574401318232E+00, 9.965092080809215E-01 }, /* 935 Hz */
-    { 9.982527405646782E-01, -1.981538779106382E+00, 9.982527405646782E-01, -1.981538779106382E+00, 9.965054811293563E-01 }, /* 936 Hz */
-    { 9.982508770958407E-01, -1.981503123074434E+00, 9.982508770958407E-01, -1.981503123074434E+00, 9.965017541916814E-01 }, /* 937 Hz */
-    { 9.982490136339481E-01, -1.981467433223124E+00, 9.982490136339481E-01, -1.981467433223124E+00, 9.964980272678963E-01 }, /* 938 Hz */
-    { 9.982471501790006E-01, -1.981431709553191E+00, 9.982471501790006E-01, -1.981431709553191E+00, 9.964943003580011E-01 }, /* 939 Hz */
-    { 9.982452867309978E-01, -1.981395952065371E+00, 9.982452867309978E-01, -1.981395952065371E+00, 9.964905734619955E-01 }, /* 940 Hz */
-    { 9.982434232899399E-01, -1.981360160760405E+00, 9.982434232899399E-01, -1.981360160760405E+00, 9.964868465798797E-01 }, /* 941 Hz */
-    { 9.982415598558265E-01, -1.981324335639031E+00, 9.982415598558265E-01, -1.981324335639031E+00, 9.964831197116530E-01 }, /* 942 Hz */
-    { 9.982396964286581E-01, -1.981288476701989E+00, 9.982396964286581E-01, -1.981288476701989E+00, 9.964793928573161E-01 }, /* 943 Hz */
-    { 9.982378330084343E-01, -1.981252583950019E+00, 9.982378330084343E-01, -1.981252583950019E+00, 9.964756660168685E-01 }, /* 944 Hz */
-    { 9.982359695951550E-01, -1.981216657383863E+00, 9.982359695951550E-01, -1.981216657383863E+00, 9.964719391903101E-01 }, /* 945 Hz */
-    { 9.982341061888204E-01, -1.981180697004261E+00, 9.982341061888204E-01, -1.981180697004261E+00, 9.964682123776407E-01 }, /* 946 Hz */
-    { 9.982322427894300E-01, -1.981144702811957E+00, 9.982322427894300E-01, -1.981144702811957E+00, 9.964644855788600E-01 }, /* 947 Hz */
-    { 9.982303793969843E-01, -1.981108674807692E+00, 9.982303793969843E-01, -1.981108674807692E+00, 9.964607587939687E-01 }, /* 948 Hz */
-    { 9.982285160114830E-01, -1.981072612992211E+00, 9.982285160114830E-01, -1.981072612992211E+00, 9.964570320229660E-01 }, /* 949 Hz */
-    { 9.982266526329260E-01, -1.981036517366257E+00, 9.982266526329260E-01, -1.981036517366257E+00, 9.964533052658520E-01 }, /* 950 Hz */
-    { 9.982247892613132E-01, -1.981000387930573E+00, 9.982247892613132E-01, -1.981000387930573E+00, 9.964495785226264E-01 }, /* 951 Hz */
-    { 9.982229258966447E-01, -1.980964224685906E+00, 9.982229258966447E-01, -1.980964224685906E+00, 9.964458517932895E-01 }, /* 952 Hz */
-    { 9.982210625389204E-01, -1.980928027633001E+00, 9.982210625389204E-01, -1.980928027633001E+00, 9.964421250778408E-01 }, /* 953 Hz */
-    { 9.982191991881401E-01, -1.980891796772605E+00, 9.982191991881401E-01, -1.980891796772605E+00, 9.964383983762801E-01 }, /* 954 Hz */
-    { 9.982173358443041E-01, -1.980855532105463E+00, 9.982173358443041E-01, -1.980855532105463E+00, 9.964346716886081E-01 }, /* 955 Hz */
-    { 9.982154725074119E-01, -1.980819233632323E+00, 9.982154725074119E-01, -1.980819233632323E+00, 9.964309450148239E-01 }, /* 956 Hz */
-    { 9.982136091774638E-01, -1.980782901353934E+00, 9.982136091774638E-01, -1.980782901353934E+00, 9.964272183549276E-01 }, /* 957 Hz */
-    { 9.982117458544598E-01, -1.980746535271043E+00, 9.982117458544598E-01, -1.980746535271043E+00, 9.964234917089196E-01 }, /* 958 Hz */
-    { 9.982098825383995E-01, -1.980710135384399E+00, 9.982098825383995E-01, -1.980710135384399E+00, 9.964197650767990E-01 }, /* 959 Hz */
-    { 9.982080192292830E-01, -1.980673701694754E+00, 9.982080192292830E-01, -1.980673701694754E+00, 9.964160384585661E-01 }, /* 960 Hz */
-    { 9.982061559271103E-01, -1.980637234202854E+00, 9.982061559271103E-01, -1.980637234202854E+00, 9.964123118542205E-01 }, /* 961 Hz */
-    { 9.982042926318814E-01, -1.980600732909454E+00, 9.982042926318814E-01, -1.980600732909454E+00, 9.964085852637627E-01 }, /* 962 Hz */
-    { 9.982024293435962E-01, -1.980564197815303E+00, 9.982024293435962E-01, -1.980564197815303E+00, 9.964048586871923E-01 }, /* 963 Hz */
-    { 9.982005660622544E-01, -1.980527628921154E+00, 9.982005660622544E-01, -1.980527628921154E+00, 9.964011321245088E-01 }, /* 964 Hz */
-    { 9.981987027878564E-01, -1.980491026227759E+00, 9.981987027878564E-01, -1.980491026227759E+00, 9.963974055757128E-01 }, /* 965 Hz */
-    { 9.981968395204016E-01, -1.980454389735870E+00, 9.981968395204016E-01, -1.980454389735870E+00, 9.963936790408032E-01 }, /* 966 Hz */
-    { 9.981949762598905E-01, -1.980417719446243E+00, 9.981949762598905E-01, -1.980417719446243E+00, 9.963899525197810E-01 }, /* 967 Hz */
-    { 9.981931130063229E-01, -1.980381015359630E+00, 9.981931130063229E-01, -1.980381015359630E+00, 9.963862260126457E-01 }, /* 968 Hz */
-    { 9.981912497596983E-01, -1.980344277476787E+00, 9.981912497596983E-01, -1.980344277476787E+00, 9.963824995193966E-01 }, /* 969 Hz */
-    { 9.981893865200173E-01, -1.980307505798469E+00, 9.981893865200173E-01, -1.980307505798469E+00, 9.963787730400346E-01 }, /* 970 Hz */
-    { 9.981875232872796E-01, -1.980270700325433E+00, 9.981875232872796E-01, -1.980270700325433E+00, 9.963750465745591E-01 }, /* 971 Hz */
-    { 9.981856600614848E-01, -1.980233861058434E+00, 9.981856600614848E-01, -1.980233861058434E+00, 9.963713201229696E-01 }, /* 972 Hz */
-    { 9.981837968426334E-01, -1.980196987998230E+00, 9.981837968426334E-01, -1.980196987998230E+00, 9.963675936852667E-01 }, /* 973 Hz */
-    { 9.981819336307249E-01, -1.980160081145578E+00, 9.981819336307249E-01, -1.980160081145578E+00, 9.963638672614499E-01 }, /* 974 Hz */
-    { 9.981800704257595E-01, -1.980123140501236E+00, 9.981800704257595E-01, -1.980123140501236E+00, 9.963601408515190E-01 }, /* 975 Hz */
-    { 9.981782072277372E-01, -1.980086166065965E+00, 9.981782072277372E-01, -1.980086166065965E+00, 9.963564144554744E-01 }, /* 976 Hz */
-    { 9.981763440366579E-01, -1.980049157840522E+00, 9.981763440366579E-01, -1.980049157840522E+00, 9.963526880733158E-01 }, /* 977 Hz */
-    { 9.981744808525214E-01, -1.980012115825668E+00, 9.981744808525214E-01, -1.980012115825668E+00, 9.963489617050427E-01 }, /* 978 Hz */
-    { 9.981726176753276E-01, -1.979975040022164E+00, 9.981726176753276E-01, -1.979975040022164E+00, 9.963452353506552E-01 }, /* 979 Hz */
-    { 9.981707545050769E-01, -1.979937930430770E+00, 9.981707545050769E-01, -1.979937930430770E+00, 9.963415090101537E-01 }, /* 980 Hz */
-    { 9.981688913417687E-01, -1.979900787052249E+00, 9.981688913417687E-01, -1.979900787052249E+00, 9.963377826835373E-01 }, /* 981 Hz */
-    { 9.981670281854031E-01, -1.979863609887362E+00, 9.981670281854031E-01, -1.979863609887362E+00, 9.963340563708063E-01 }, /* 982 Hz */
-    { 9.981651650359803E-01, -1.979826398936873E+00, 9.981651650359803E-01, -1.979826398936873E+00, 9.963303300719606E-01 }, /* 983 Hz */
-    { 9.981633018935001E-01, -1.979789154201545E+00, 9.981633018935001E-01, -1.979789154201545E+00, 9.963266037870002E-01 }, /* 984 Hz */
-    { 9.981614387579623E-01, -1.979751875682141E+00, 9.981614387579623E-01, -1.979751875682141E+00, 9.963228775159245E-01 }, /* 985 Hz */
-    { 9.981595756293671E-01, -1.979714563379427E+00, 9.981595756293671E-01, -1.979714563379427E+00, 9.963191512587342E-01 }, /* 986 Hz */
-    { 9.981577125077141E-01, -1.979677217294168E+00, 9.981577125077141E-01, -1.979677217294168E+00, 9.963154250154282E-01 }, /* 987 Hz */
-    { 9.981558493930036E-01, -1.979639837427129E+00, 9.981558493930036E-01, -1.979639837427129E+00, 9.963116987860072E-01 }, /* 988 Hz */
-    { 9.981539862852354E-01, -1.979602423779077E+00, 9.981539862852354E-01, -1.979602423779077E+00, 9.963079725704709E-01 }, /* 989 Hz */
-    { 9.981521231844096E-01, -1.979564976350779E+00, 9.981521231844096E-01, -1.979564976350779E+00, 9.963042463688192E-01 }, /* 990 Hz */
-    { 9.981502600905261E-01, -1.979527495143002E+00, 9.981502600905261E-01, -1.979527495143002E+00, 9.963005201810522E-01 }, /* 991 Hz */
-    { 9.981483970035846E-01, -1.979489980156514E+00, 9.981483970035846E-01, -1.979489980156514E+00, 9.962967940071692E-01 }, /* 992 Hz */
-    { 9.981465339235852E-01, -1.979452431392084E+00, 9.981465339235852E-01, -1.979452431392084E+00, 9.962930678471704E-01 }, /* 993 Hz */
-    { 9.981446708505278E-01, -1.979414848850481E+00, 9.981446708505278E-01, -1.979414848850481E+00, 9.962893417010557E-01 }, /* 994 Hz */
-    { 9.981428077844126E-01, -1.979377232532474E+00, 9.981428077844126E-01, -1.979377232532474E+00, 9.962856155688251E-01 }, /* 995 Hz */
-    { 9.981409447252392E-01, -1.979339582438835E+00, 9.981409447252392E-01, -1.979339582438835E+00, 9.962818894504784E-01 }, /* 996 Hz */
-    { 9.981390816730077E-01, -1.979301898570334E+00, 9.981390816730077E-01, -1.979301898570334E+00, 9.962781633460154E-01 }, /* 997 Hz */
-    { 9.981372186277181E-01, -1.979264180927742E+00, 9.981372186277181E-01, -1.979264180927742E+00, 9.962744372554362E-01 }, /* 998 Hz */
-    { 9.981353555893704E-01, -1.979226429511832E+00, 9.981353555893704E-01, -1.979226429511832E+00, 9.962707111787408E-01 }, /* 999 Hz */
-    { 9.981334925579642E-01, -1.979188644323376E+00, 9.981334925579642E-01, -1.979188644323376E+00, 9.962669851159285E-01 }, /* 1000 Hz */
-    { 9.981316295334999E-01, -1.979150825363148E+00, 9.981316295334999E-01, -1.979150825363148E+00, 9.962632590669998E-01 }, /* 1001 Hz */
-    { 9.981297665159772E-01, -1.979112972631921E+00, 9.981297665159772E-01, -1.979112972631921E+00, 9.962595330319544E-01 }, /* 1002 Hz */
-    { 9.981279035053959E-01, -1.979075086130469E+00, 9.981279035053959E-01, -1.979075086130469E+00, 9.962558070107919E-01 }, /* 1003 Hz */
-    { 9.981260405017564E-01, -1.979037165859568E+00, 9.981260405017564E-01, -1.979037165859568E+00, 9.962520810035127E-01 }, /* 1004 Hz */
-    { 9.981241775050583E-01, -1.978999211819993E+00, 9.981241775050583E-01, -1.978999211819993E+00, 9.962483550101167E-01 }, /* 1005 Hz */
-    { 9.981223145153016E-01, -1.978961224012521E+00, 9.981223145153016E-01, -1.978961224012521E+00, 9.962446290306033E-01 }, /* 1006 Hz */
-    { 9.981204515324865E-01, -1.978923202437928E+00, 9.981204515324865E-01, -1.978923202437928E+00, 9.962409030649730E-01 }, /* 1007 Hz */
-    { 9.981185885566126E-01, -1.978885147096990E+00, 9.981185885566126E-01, -1.978885147096990E+00, 9.962371771132252E-01 }, /* 1008 Hz */
-    { 9.981167255876799E-01, -1.978847057990487E+00, 9.981167255876799E-01, -1.978847057990487E+00, 9.962334511753599E-01 }, /* 1009 Hz */
-    { 9.981148626256885E-01, -1.978808935119196E+00, 9.981148626256885E-01, -1.978808935119196E+00, 9.962297252513770E-01 }, /* 1010 Hz */
-    { 9.981129996706383E-01, -1.978770778483896E+00, 9.981129996706383E-01, -1.978770778483896E+00, 9.962259993412765E-01 }, /* 1011 Hz */
-    { 9.981111367225293E-01, -1.978732588085367E+00, 9.981111367225293E-01, -1.978732588085367E+00, 9.962222734450585E-01 }, /* 1012 Hz */
-    { 9.981092737813611E-01, -1.978694363924389E+00, 9.981092737813611E-01, -1.978694363924389E+00, 9.962185475627221E-01 }, /* 1013 Hz */
-    { 9.981074108471341E-01, -1.978656106001743E+00, 9.981074108471341E-01, -1.978656106001743E+00, 9.962148216942681E-01 }, /* 1014 Hz */
-    { 9.981055479198482E-01, -1.978617814318210E+00, 9.981055479198482E-01, -1.978617814318210E+00, 9.962110958396964E-01 }, /* 1015 Hz */
-    { 9.981036849995029E-01, -1.978579488874572E+00, 9.981036849995029E-01, -1.978579488874572E+00, 9.962073699990057E-01 }, /* 1016 Hz */
-    { 9.981018220860988E-01, -1.978541129671611E+00, 9.981018220860988E-01, -1.978541129671611E+00, 9.962036441721975E-01 }, /* 1017 Hz */
-    { 9.980999591796353E-01, -1.978502736710111E+00, 9.980999591796353E-01, -1.978502736710111E+00, 9.961999183592707E-01 }, /* 1018 Hz */
-    { 9.980980962801127E-01, -1.978464309990854E+00, 9.980980962801127E-01, -1.978464309990854E+00, 9.961961925602254E-01 }, /* 1019 Hz */
-    { 9.980962333875307E-01, -1.978425849514626E+00, 9.980962333875307E-01, -1.978425849514626E+00, 9.961924667750615E-01 }, /* 1020 Hz */
-    { 9.980943705018895E-01, -1.978387355282210E+00, 9.980943705018895E-01, -1.978387355282210E+00, 9.961887410037791E-01 }, /* 1021 Hz */
-    { 9.980925076231887E-01, -1.978348827294391E+00, 9.980925076231887E-01, -1.978348827294391E+00, 9.961850152463774E-01 }, /* 1022 Hz */
-    { 9.980906447514287E-01, -1.978310265551958E+00, 9.980906447514287E-01, -1.978310265551958E+00, 9.961812895028574E-01 }, /* 1023 Hz */
-    { 9.980887818866090E-01, -1.978271670055694E+00, 9.980887818866090E-01, -1.978271670055694E+00, 9.961775637732180E-01 }, /* 1024 Hz */
-    { 9.980869190287299E-01, -1.978233040806388E+00, 9.980869190287299E-01, -1.978233040806388E+00, 9.961738380574598E-01 }, /* 1025 Hz */
-    { 9.980850561777910E-01, -1.978194377804827E+00, 9.980850561777910E-01, -1.978194377804827E+00, 9.961701123555819E-01 }, /* 1026 Hz */
-    { 9.980831933337928E-01, -1.978155681051799E+00, 9.980831933337928E-01, -1.978155681051799E+00, 9.961663866675856E-01 }, /* 1027 Hz */
-    { 9.980813304967345E-01, -1.978116950548093E+00, 9.980813304967345E-01, -1.978116950548093E+00, 9.961626609934691E-01 }, /* 1028 Hz */
-    { 9.980794676666167E-01, -1.978078186294498E+00, 9.980794676666167E-01, -1.978078186294498E+00, 9.961589353332334E-01 }, /* 1029 Hz */
-    { 9.980776048434391E-01, -1.978039388291805E+00, 9.980776048434391E-01, -1.978039388291805E+00, 9.961552096868782E-01 }, /* 1030 Hz */
-    { 9.980757420272014E-01, -1.978000556540803E+00, 9.980757420272014E-01, -1.978000556540803E+00, 9.961514840544028E-01 }, /* 1031 Hz */
-    { 9.980738792179040E-01, -1.977961691042283E+00, 9.980738792179040E-01, -1.977961691042283E+00, 9.961477584358081E-01 }, /* 1032 Hz */
-    { 9.980720164155468E-01, -1.977922791797039E+00, 9.980720164155468E-01, -1.977922791797039E+00, 9.961440328310935E-01 }, /* 1033 Hz */
-    { 9.980701536201293E-01, -1.977883858805860E+00, 9.980701536201293E-01, -1.977883858805860E+00, 9.961403072402586E-01 }, /* 1034 Hz */
-    { 9.980682908316519E-01, -1.977844892069541E+00, 9.980682908316519E-01, -1.977844892069541E+00, 9.961365816633039E-01 }, /* 1035 Hz */
-    { 9.980664280501141E-01, -1.977805891588875E+00, 9.980664280501141E-01, -1.977805891588875E+00, 9.961328561002283E-01 }, /* 1036 Hz */
-    { 9.980645652755166E-01, -1.977766857364655E+00, 9.980645652755166E-01, -1.977766857364655E+00, 9.961291305510331E-01 }, /* 1037 Hz */
-    { 9.980627025078584E-01, -1.977727789397676E+00, 9.980627025078584E-01, -1.977727789397676E+00, 9.961254050157169E-01 }, /* 1038 Hz */
-    { 9.980608397471403E-01, -1.977688687688734E+00, 9.980608397471403E-01, -1.977688687688734E+00, 9.961216794942807E-01 }, /* 1039 Hz */
-    { 9.980589769933618E-01, -1.977649552238623E+00, 9.980589769933618E-01, -1.977649552238623E+00, 9.961179539867235E-01 }, /* 1040 Hz */
-    { 9.980571142465229E-01, -1.977610383048140E+00, 9.980571142465229E-01, -1.977610383048140E+00, 9.961142284930458E-01 }, /* 1041 Hz */
-    { 9.980552515066233E-01, -1.977571180118082E+00, 9.980552515066233E-01, -1.977571180118082E+00, 9.961105030132467E-01 }, /* 1042 Hz */
-    { 9.980533887736635E-01, -1.977531943449246E+00, 9.980533887736635E-01, -1.977531943449246E+00, 9.961067775473269E-01 }, /* 1043 Hz */
-    { 9.980515260476431E-01, -1.977492673042430E+00, 9.980515260476431E-01, -1.977492673042430E+00, 9.961030520952863E-01 }, /* 1044 Hz */
-    { 9.980496633285622E-01, -1.977453368898433E+00, 9.980496633285622E-01, -1.977453368898433E+00, 9.960993266571243E-01 }, /* 1045 Hz */
-    { 9.980478006164206E-01, -1.977414031018054E+00, 9.980478006164206E-01, -1.977414031018054E+00, 9.960956012328412E-01 }, /* 1046 Hz */
-    { 9.980459379112182E-01, -1.977374659402092E+00, 9.980459379112182E-01, -1.977374659402092E+00, 9.960918758224364E-01 }, /* 1047 Hz */
-    { 9.980440752129554E-01, -1.977335254051349E+00, 9.980440752129554E-01, -1.977335254051349E+00, 9.960881504259107E-01 }, /* 1048 Hz */
-    { 9.980422125216314E-01, -1.977295814966623E+00, 9.980422125216314E-01, -1.977295814966623E+00, 9.960844250432628E-01 }, /* 1049 Hz */
-    { 9.980403498372468E-01, -1.977256342148717E+00, 9.980403498372468E-01, -1.977256342148717E+00, 9.960806996744935E-01 }, /* 1050 Hz */
-    { 9.980384871598011E-01, -1.977216835598433E+00, 9.980384871598011E-01, -1.977216835598433E+00, 9.960769743196023E-01 }, /* 1051 Hz */
-    { 9.980366244892949E-01, -1.977177295316574E+00, 9.980366244892949E-01, -1.977177295316574E+00, 9.960732489785897E-01 }, /* 1052 Hz */
-    { 9.980347618257274E-01, -1.977137721303942E+00, 9.980347618257274E-01, -1.977137721303942E+00, 9.960695236514547E-01 }, /* 1053 Hz */
-    { 9.980328991690988E-01, -1.977098113561342E+00, 9.980328991690988E-01, -1.977098113561342E+00, 9.960657983381975E-01 }, /* 1054 Hz */
-    { 9.980310365194092E-01, -1.977058472089577E+00, 9.980310365194092E-01, -1.977058472089577E+00, 9.960620730388183E-01 }, /* 1055 Hz */
-    { 9.980291738766583E-01, -1.977018796889452E+00, 9.980291738766583E-01, -1.977018796889452E+00, 9.960583477533167E-01 }, /* 1056 Hz */
-    { 9.980273112408464E-01, -1.976979087961773E+00, 9.980273112408464E-01, -1.976979087961773E+00, 9.960546224816929E-01 }, /* 1057 Hz */
-    { 9.980254486119731E-01, -1.976939345307346E+00, 9.980254486119731E-01, -1.976939345307346E+00, 9.960508972239461E-01 }, /* 1058 Hz */
-    { 9.980235859900387E-01, -1.976899568926977E+00, 9.980235859900387E-01, -1.976899568926977E+00, 9.960471719800774E-01 }, /* 1059 Hz */
-    { 9.980217233750426E-01, -1.976859758821473E+00, 9.980217233750426E-01, -1.976859758821473E+00, 9.960434467500852E-01 }, /* 1060 Hz */
-    { 9.980198607669853E-01, -1.976819914991643E+00, 9.980198607669853E-01, -1.976819914991643E+00, 9.960397215339707E-01 }, /* 1061 Hz */
-    { 9.980179981658666E-01, -1.976780037438295E+00, 9.980179981658666E-01, -1.976780037438295E+00, 9.960359963317331E-01 }, /* 1062 Hz */
-    { 9.980161355716862E-01, -1.976740126162236E+00, 9.980161355716862E-01, -1.976740126162236E+00, 9.960322711433724E-01 }, /* 1063 Hz */
-    { 9.980142729844445E-01, -1.976700181164278E+00, 9.980142729844445E-01, -1.976700181164278E+00, 9.960285459688889E-01 }, /* 1064 Hz */
-    { 9.980124104041409E-01, -1.976660202445229E+00, 9.980124104041409E-01, -1.976660202445229E+00, 9.960248208082818E-01 }, /* 1065 Hz */
-    { 9.980105478307757E-01, -1.976620190005900E+00, 9.980105478307757E-01, -1.976620190005900E+00, 9.960210956615514E-01 }, /* 1066 Hz */
-    { 9.980086852643489E-01, -1.976580143847103E+00, 9.980086852643489E-01, -1.976580143847103E+00, 9.960173705286979E-01 }, /* 1067 Hz */
-    { 9.980068227048601E-01, -1.976540063969649E+00, 9.980068227048601E-01, -1.976540063969649E+00, 9.960136454097201E-01 }, /* 1068 Hz */
-    { 9.980049601523097E-01, -1.976499950374351E+00, 9.980049601523097E-01, -1.976499950374351E+00, 9.960099203046193E-01 }, /* 1069 Hz */
-    { 9.980030976066974E-01, -1.976459803062022E+00, 9.980030976066974E-01, -1.976459803062022E+00, 9.960061952133947E-01 }, /* 1070 Hz */
-    { 9.980012350680231E-01, -1.976419622033474E+00, 9.980012350680231E-01, -1.976419622033474E+00, 9.960024701360461E-01 }, /* 1071 Hz */
-    { 9.979993725362869E-01, -1.976379407289522E+00, 9.979993725362869E-01, -1.976379407289522E+00, 9.959987450725738E-01 }, /* 1072 Hz */
-    { 9.979975100114885E-01, -1.976339158830981E+00, 9.979975100114885E-01, -1.976339158830981E+00, 9.959950200229770E-01 }, /* 1073 Hz */
-    { 9.979956474936282E-01, -1.976298876658665E+00, 9.979956474936282E-01, -1.976298876658665E+00, 9.959912949872565E-01 }, /* 1074 Hz */
-    { 9.979937849827056E-01, -1.976258560773391E+00, 9.979937849827056E-01, -1.976258560773391E+00, 9.959875699654113E-01 }, /* 1075 Hz */
-    { 9.979919224787210E-01, -1.976218211175975E+00, 9.979919224787210E-01, -1.976218211175975E+00, 9.959838449574421E-01 }, /* 1076 Hz */
-    { 9.979900599816740E-01, -1.976177827867234E+00, 9.979900599816740E-01, -1.976177827867234E+00, 9.959801199633480E-01 }, /* 1077 Hz */
-    { 9.979881974915648E-01, -1.976137410847984E+00, 9.979881974915648E-01, -1.976137410847984E+00, 9.959763949831295E-01 }, /* 1078 Hz */
-    { 9.979863350083933E-01, -1.976096960119045E+00, 9.979863350083933E-01, -1.976096960119045E+00, 9.959726700167866E-01 }, /* 1079 Hz */
-    { 9.979844725321593E-01, -1.976056475681235E+00, 9.979844725321593E-01, -1.976056475681235E+00, 9.959689450643185E-01 }, /* 1080 Hz */
-    { 9.979826100628628E-01, -1.976015957535373E+00, 9.979826100628628E-01, -1.976015957535373E+00, 9.959652201257256E-01 }, /* 1081 Hz */
-    { 9.979807476005039E-01, -1.975975405682279E+00, 9.979807476005039E-01, -1.975975405682279E+00, 9.959614952010079E-01 }, /* 1082 Hz */
-    { 9.979788851450825E-01, -1.975934820122773E+00, 9.979788851450825E-01, -1.975934820122773E+00, 9.959577702901650E-01 }, /* 1083 Hz */
-    { 9.979770226965984E-01, -1.975894200857676E+00, 9.979770226965984E-01, -1.975894200857676E+00, 9.959540453931968E-01 }, /* 1084 Hz */
-    { 9.979751602550515E-01, -1.975853547887810E+00, 9.979751602550515E-01, -1.975853547887810E+00, 9.959503205101030E-01 }, /* 1085 Hz */
-    { 9.979732978204420E-01, -1.975812861213996E+00, 9.979732978204420E-01, -1.975812861213996E+00, 9.959465956408839E-01 }, /* 1086 Hz */
-    { 9.979714353927700E-01, -1.975772140837058E+00, 9.979714353927700E-01, -1.975772140837058E+00, 9.959428707855400E-01 }, /* 1087 Hz */
-    { 9.979695729720348E-01, -1.975731386757818E+00, 9.979695729720348E-01, -1.975731386757818E+00, 9.959391459440696E-01 }, /* 1088 Hz */
-    { 9.979677105582372E-01, -1.975690598977101E+00, 9.979677105582372E-01, -1.975690598977101E+00, 9.959354211164744E-01 }, /* 1089 Hz */
-    { 9.979658481513763E-01, -1.975649777495731E+00, 9.979658481513763E-01, -1.975649777495731E+00, 9.959316963027527E-01 }, /* 1090 Hz */
-    { 9.979639857514526E-01, -1.975608922314532E+00, 9.979639857514526E-01, -1.975608922314532E+00, 9.959279715029052E-01 }, /* 1091 Hz */
-    { 9.979621233584659E-01, -1.975568033434330E+00, 9.979621233584659E-01, -1.975568033434330E+00, 9.959242467169318E-01 }, /* 1092 Hz */
-    { 9.979602609724160E-01, -1.975527110855951E+00, 9.979602609724160E-01, -1.975527110855951E+00, 9.959205219448319E-01 }, /* 1093 Hz */
-    { 9.979583985933030E-01, -1.975486154580223E+00, 9.979583985933030E-01, -1.975486154580223E+00, 9.959167971866061E-01 }, /* 1094 Hz */
-    { 9.979565362211270E-01, -1.975445164607972E+00, 9.979565362211270E-01, -1.975445164607972E+00, 9.959130724422540E-01 }, /* 1095 Hz */
-    { 9.979546738558877E-01, -1.975404140940025E+00, 9.979546738558877E-01, -1.975404140940025E+00, 9.959093477117753E-01 }, /* 1096 Hz */
-    { 9.979528114975849E-01, -1.975363083577211E+00, 9.979528114975849E-01, -1.975363083577211E+00, 9.959056229951697E-01 }, /* 1097 Hz */
-    { 9.979509491462190E-01, -1.975321992520360E+00, 9.979509491462190E-01, -1.975321992520360E+00, 9.959018982924379E-01 }, /* 1098 Hz */
-    { 9.979490868017895E-01, -1.975280867770301E+00, 9.979490868017895E-01, -1.975280867770301E+00, 9.958981736035790E-01 }, /* 1099 Hz */
-    { 9.979472244642970E-01, -1.975239709327864E+00, 9.979472244642970E-01, -1.975239709327864E+00, 9.958944489285939E-01 }, /* 1100 Hz */
-    { 9.979453621337407E-01, -1.975198517193880E+00, 9.979453621337407E-01, -1.975198517193880E+00, 9.958907242674815E-01 }, /* 1101 Hz */
-    { 9.979434998101210E-01, -1.975157291369179E+00, 9.979434998101210E-01, -1.975157291369179E+00, 9.958869996202420E-01 }, /* 1102 Hz */
-    { 9.979416374934377E-01, -1.975116031854594E+00, 9.979416374934377E-01, -1.975116031854594E+00, 9.958832749868753E-01 }, /* 1103 Hz */
-    { 9.979397751836906E-01, -1.975074738650957E+00, 9.979397751836906E-01, -1.975074738650957E+00, 9.958795503673812E-01 }, /* 1104 Hz */
-    { 9.979379128808800E-01, -1.975033411759102E+00, 9.979379128808800E-01, -1.975033411759102E+00, 9.958758257617599E-01 }, /* 1105 Hz */
-    { 9.979360505850056E-01, -1.974992051179860E+00, 9.979360505850056E-01, -1.974992051179860E+00, 9.958721011700111E-01 }, /* 1106 Hz */
-    { 9.979341882960672E-01, -1.974950656914067E+00, 9.979341882960672E-01, -1.974950656914067E+00, 9.958683765921343E-01 }, /* 1107 Hz */
-    { 9.979323260140651E-01, -1.974909228962558E+00, 9.979323260140651E-01, -1.974909228962558E+00, 9.958646520281302E-01 }, /* 1108 Hz */
-    { 9.979304637389991E-01, -1.974867767326168E+00, 9.979304637389991E-01, -1.974867767326168E+00, 9.958609274779981E-01 }, /* 1109 Hz */
-    { 9.979286014708693E-01, -1.974826272005732E+00, 9.979286014708693E-01, -1.974826272005732E+00, 9.958572029417385E-01 }, /* 1110 Hz */
-    { 9.979267392096753E-01, -1.974784743002087E+00, 9.979267392096753E-01, -1.974784743002087E+00, 9.958534784193507E-01 }, /* 1111 Hz */
-    { 9.979248769554174E-01, -1.974743180316070E+00, 9.979248769554174E-01, -1.974743180316070E+00, 9.958497539108349E-01 }, /* 1112 Hz */
-    { 9.979230147080954E-01, -1.974701583948519E+00, 9.979230147080954E-01, -1.974701583948519E+00, 9.958460294161908E-01 }, /* 1113 Hz */
-    { 9.979211524677092E-01, -1.974659953900271E+00, 9.979211524677092E-01, -1.974659953900271E+00, 9.958423049354184E-01 }, /* 1114 Hz */
-    { 9.979192902342586E-01, -1.974618290172165E+00, 9.979192902342586E-01, -1.974618290172165E+00, 9.958385804685173E-01 }, /* 1115 Hz */
-    { 9.979174280077440E-01, -1.974576592765041E+00, 9.979174280077440E-01, -1.974576592765041E+00, 9.958348560154879E-01 }, /* 1116 Hz */
-    { 9.979155657881649E-01, -1.974534861679738E+00, 9.979155657881649E-01, -1.974534861679738E+00, 9.958311315763297E-01 }, /* 1117 Hz */
-    { 9.979137035755214E-01, -1.974493096917097E+00, 9.979137035755214E-01, -1.974493096917097E+00, 9.958274071510429E-01 }, /* 1118 Hz */
-    { 9.979118413698138E-01, -1.974451298477960E+00, 9.979118413698138E-01, -1.974451298477960E+00, 9.958236827396276E-01 }, /* 1119 Hz */
-    { 9.979099791710415E-01, -1.974409466363167E+00, 9.979099791710415E-01, -1.974409466363167E+00, 9.958199583420830E-01 }, /* 1120 Hz */
-    { 9.979081169792048E-01, -1.974367600573560E+00, 9.979081169792048E-01, -1.974367600573560E+00, 9.958162339584096E-01 }, /* 1121 Hz */
-    { 9.979062547943035E-01, -1.974325701109983E+00, 9.979062547943035E-01, -1.974325701109983E+00, 9.958125095886070E-01 }, /* 1122 Hz */
-    { 9.979043926163375E-01, -1.974283767973278E+00, 9.979043926163375E-01, -1.974283767973278E+00, 9.958087852326749E-01 }, /* 1123 Hz */
-    { 9.979025304453067E-01, -1.974241801164290E+00, 9.979025304453067E-01, -1.974241801164290E+00, 9.958050608906135E-01 }, /* 1124 Hz */
-    { 9.979006682812116E-01, -1.974199800683863E+00, 9.979006682812116E-01, -1.974199800683863E+00, 9.958013365624232E-01 }, /* 1125 Hz */
-    { 9.978988061240514E-01, -1.974157766532842E+00, 9.978988061240514E-01, -1.974157766532842E+00, 9.957976122481027E-01 }, /* 1126 Hz */
-    { 9.978969439738264E-01, -1.974115698712072E+00, 9.978969439738264E-01, -1.974115698712072E+00, 9.957938879476529E-01 }, /* 1127 Hz */
-    { 9.978950818305365E-01, -1.974073597222400E+00, 9.978950818305365E-01, -1.974073597222400E+00, 9.957901636610731E-01 }, /* 1128 Hz */
-    { 9.978932196941819E-01, -1.974031462064673E+00, 9.978932196941819E-01, -1.974031462064673E+00, 9.957864393883638E-01 }, /* 1129 Hz */
-    { 9.978913575647621E-01, -1.973989293239737E+00, 9.978913575647621E-01, -1.973989293239737E+00, 9.957827151295242E-01 }, /* 1130 Hz */
-    { 9.978894954422773E-01, -1.973947090748441E+00, 9.978894954422773E-01, -1.973947090748441E+00, 9.957789908845547E-01 }, /* 1131 Hz */
-    { 9.978876333267275E-01, -1.973904854591633E+00, 9.978876333267275E-01, -1.973904854591633E+00, 9.957752666534549E-01 }, /* 1132 Hz */
-    { 9.978857712181124E-01, -1.973862584770162E+00, 9.978857712181124E-01, -1.973862584770162E+00, 9.957715424362248E-01 }, /* 1133 Hz */
-    { 9.978839091164322E-01, -1.973820281284878E+00, 9.978839091164322E-01, -1.973820281284878E+00, 9.957678182328644E-01 }, /* 1134 Hz */
-    { 9.978820470216868E-01, -1.973777944136631E+00, 9.978820470216868E-01, -1.973777944136631E+00, 9.957640940433736E-01 }, /* 1135 Hz */
-    { 9.978801849338761E-01, -1.973735573326272E+00, 9.978801849338761E-01, -1.973735573326272E+00, 9.957603698677522E-01 }, /* 1136 Hz */
-    { 9.978783228529999E-01, -1.973693168854651E+00, 9.978783228529999E-01, -1.973693168854651E+00, 9.957566457059999E-01 }, /* 1137 Hz */
-    { 9.978764607790584E-01, -1.973650730722621E+00, 9.978764607790584E-01, -1.973650730722621E+00, 9.957529215581169E-01 }, /* 1138 Hz */
-    { 9.978745987120514E-01, -1.973608258931035E+00, 9.978745987120514E-01, -1.973608258931035E+00, 9.957491974241028E-01 }, /* 1139 Hz */
-    { 9.978727366519791E-01, -1.973565753480745E+00, 9.978727366519791E-01, -1.973565753480745E+00, 9.957454733039581E-01 }, /* 1140 Hz */
-    { 9.978708745988411E-01, -1.973523214372605E+00, 9.978708745988411E-01, -1.973523214372605E+00, 9.957417491976821E-01 }, /* 1141 Hz */
-    { 9.978690125526373E-01, -1.973480641607469E+00, 9.978690125526373E-01, -1.973480641607469E+00, 9.957380251052745E-01 }, /* 1142 Hz */
-    { 9.978671505133682E-01, -1.973438035186193E+00, 9.978671505133682E-01, -1.973438035186193E+00, 9.957343010267363E-01 }, /* 1143 Hz */
-    { 9.978652884810332E-01, -1.973395395109630E+00, 9.978652884810332E-01, -1.973395395109630E+00, 9.957305769620663E-01 }, /* 1144 Hz */
-    { 9.978634264556323E-01, -1.973352721378638E+00, 9.978634264556323E-01, -1.973352721378638E+00, 9.957268529112646E-01 }, /* 1145 Hz */
-    { 9.978615644371659E-01, -1.973310013994072E+00, 9.978615644371659E-01, -1.973310013994072E+00, 9.957231288743318E-01 }, /* 1146 Hz */
-    { 9.978597024256334E-01, -1.973267272956790E+00, 9.978597024256334E-01, -1.973267272956790E+00, 9.957194048512668E-01 }, /* 1147 Hz */
-    { 9.978578404210352E-01, -1.973224498267650E+00, 9.978578404210352E-01, -1.973224498267650E+00, 9.957156808420704E-01 }, /* 1148 Hz */
-    { 9.978559784233708E-01, -1.973181689927509E+00, 9.978559784233708E-01, -1.973181689927509E+00, 9.957119568467416E-01 }, /* 1149 Hz */
-    { 9.978541164326405E-01, -1.973138847937226E+00, 9.978541164326405E-01, -1.973138847937226E+00, 9.957082328652811E-01 }, /* 1150 Hz */
-    { 9.978522544488441E-01, -1.973095972297661E+00, 9.978522544488441E-01, -1.973095972297661E+00, 9.957045088976881E-01 }, /* 1151 Hz */
-    { 9.978503924719817E-01, -1.973053063009674E+00, 9.978503924719817E-01, -1.973053063009674E+00, 9.957007849439634E-01 }, /* 1152 Hz */
-    { 9.978485305020530E-01, -1.973010120074125E+00, 9.978485305020530E-01, -1.973010120074125E+00, 9.956970610041060E-01 }, /* 1153 Hz */
-    { 9.978466685390581E-01, -1.972967143491874E+00, 9.978466685390581E-01, -1.972967143491874E+00, 9.956933370781162E-01 }, /* 1154 Hz */
-    { 9.978448065829968E-01, -1.972924133263785E+00, 9.978448065829968E-01, -1.972924133263785E+00, 9.956896131659936E-01 }, /* 1155 Hz */
-    { 9.978429446338695E-01, -1.972881089390718E+00, 9.978429446338695E-01, -1.972881089390718E+00, 9.956858892677389E-01 }, /* 1156 Hz */
-    { 9.978410826916754E-01, -1.972838011873537E+00, 9.978410826916754E-01, -1.972838011873537E+00, 9.956821653833507E-01 }, /* 1157 Hz */
-    { 9.978392207564152E-01, -1.972794900713106E+00, 9.978392207564152E-01, -1.972794900713106E+00, 9.956784415128304E-01 }, /* 1158 Hz */
-    { 9.978373588280884E-01, -1.972751755910287E+00, 9.978373588280884E-01, -1.972751755910287E+00, 9.956747176561769E-01 }, /* 1159 Hz */
-    { 9.978354969066950E-01, -1.972708577465946E+00, 9.978354969066950E-01, -1.972708577465946E+00, 9.956709938133901E-01 }, /* 1160 Hz */
-    { 9.978336349922350E-01, -1.972665365380948E+00, 9.978336349922350E-01, -1.972665365380948E+00, 9.956672699844700E-01 }, /* 1161 Hz */
-    { 9.978317730847086E-01, -1.972622119656158E+00, 9.978317730847086E-01, -1.972622119656158E+00, 9.956635461694172E-01 }, /* 1162 Hz */
-    { 9.978299111841151E-01, -1.972578840292442E+00, 9.978299111841151E-01, -1.972578840292442E+00, 9.956598223682303E-01 }, /* 1163 Hz */
-    { 9.978280492904553E-01, -1.972535527290668E+00, 9.978280492904553E-01, -1.972535527290668E+00, 9.956560985809106E-01 }, /* 1164 Hz */
-    { 9.978261874037284E-01, -1.972492180651702E+00, 9.978261874037284E-01, -1.972492180651702E+00, 9.956523748074568E-01 }, /* 1165 Hz */
-    { 9.978243255239347E-01, -1.972448800376412E+00, 9.978243255239347E-01, -1.972448800376412E+00, 9.956486510478695E-01 }, /* 1166 Hz */
-    { 9.978224636510743E-01, -1.972405386465668E+00, 9.978224636510743E-01, -1.972405386465668E+00, 9.956449273021486E-01 }, /* 1167 Hz */
-    { 9.978206017851466E-01, -1.972361938920338E+00, 9.978206017851466E-01, -1.972361938920338E+00, 9.956412035702933E-01 }, /* 1168 Hz */
-    { 9.978187399261521E-01, -1.972318457741291E+00, 9.978187399261521E-01, -1.972318457741291E+00, 9.956374798523042E-01 }, /* 1169 Hz */
-    { 9.978168780740906E-01, -1.972274942929399E+00, 9.978168780740906E-01, -1.972274942929399E+00, 9.956337561481812E-01 }, /* 1170 Hz */
-    { 9.978150162289620E-01, -1.972231394485532E+00, 9.978150162289620E-01, -1.972231394485532E+00, 9.956300324579239E-01 }, /* 1171 Hz */
-    { 9.978131543907662E-01, -1.972187812410561E+00, 9.978131543907662E-01, -1.972187812410561E+00, 9.956263087815325E-01 }, /* 1172 Hz */
-    { 9.978112925595032E-01, -1.972144196705357E+00, 9.978112925595032E-01, -1.972144196705357E+00, 9.956225851190064E-01 }, /* 1173 Hz */
-    { 9.978094307351729E-01, -1.972100547370795E+00, 9.978094307351729E-01, -1.972100547370795E+00, 9.956188614703458E-01 }, /* 1174 Hz */
-    { 9.978075689177751E-01, -1.972056864407746E+00, 9.978075689177751E-01, -1.972056864407746E+00, 9.956151378355502E-01 }, /* 1175 Hz */
-    { 9.978057071073102E-01, -1.972013147817085E+00, 9.978057071073102E-01, -1.972013147817085E+00, 9.956114142146204E-01 }, /* 1176 Hz */
-    { 9.978038453037777E-01, -1.971969397599685E+00, 9.978038453037777E-01, -1.971969397599685E+00, 9.956076906075555E-01 }, /* 1177 Hz */
-    { 9.978019835071781E-01, -1.971925613756423E+00, 9.978019835071781E-01, -1.971925613756423E+00, 9.956039670143562E-01 }, /* 1178 Hz */
-    { 9.978001217175106E-01, -1.971881796288171E+00, 9.978001217175106E-01, -1.971881796288171E+00, 9.956002434350213E-01 }, /* 1179 Hz */
-    { 9.977982599347756E-01, -1.971837945195807E+00, 9.977982599347756E-01, -1.971837945195807E+00, 9.955965198695511E-01 }, /* 1180 Hz */
-    { 9.977963981589731E-01, -1.971794060480208E+00, 9.977963981589731E-01, -1.971794060480208E+00, 9.955927963179463E-01 }, /* 1181 Hz */
-    { 9.977945363901028E-01, -1.971750142142250E+00, 9.977945363901028E-01, -1.971750142142250E+00, 9.955890727802057E-01 }, /* 1182 Hz */
-    { 9.977926746281649E-01, -1.971706190182812E+00, 9.977926746281649E-01, -1.971706190182812E+00, 9.955853492563298E-01 }, /* 1183 Hz */
-    { 9.977908128731592E-01, -1.971662204602770E+00, 9.977908128731592E-01, -1.971662204602770E+00, 9.955816257463184E-01 }, /* 1184 Hz */
-    { 9.977889511250856E-01, -1.971618185403005E+00, 9.977889511250856E-01, -1.971618185403005E+00, 9.955779022501712E-01 }, /* 1185 Hz */
-    { 9.977870893839441E-01, -1.971574132584395E+00, 9.977870893839441E-01, -1.971574132584395E+00, 9.955741787678882E-01 }, /* 1186 Hz */
-    { 9.977852276497348E-01, -1.971530046147821E+00, 9.977852276497348E-01, -1.971530046147821E+00, 9.955704552994695E-01 }, /* 1187 Hz */
-    { 9.977833659224573E-01, -1.971485926094162E+00, 9.977833659224573E-01, -1.971485926094162E+00, 9.955667318449146E-01 }, /* 1188 Hz */
-    { 9.977815042021120E-01, -1.971441772424301E+00, 9.977815042021120E-01, -1.971441772424301E+00, 9.955630084042240E-01 }, /* 1189 Hz */
-    { 9.977796424886983E-01, -1.971397585139118E+00, 9.977796424886983E-01, -1.971397585139118E+00, 9.955592849773967E-01 }, /* 1190 Hz */
-    { 9.977777807822168E-01, -1.971353364239497E+00, 9.977777807822168E-01, -1.971353364239497E+00, 9.955555615644336E-01 }, /* 1191 Hz */
-    { 9.977759190826668E-01, -1.971309109726319E+00, 9.977759190826668E-01, -1.971309109726319E+00, 9.955518381653337E-01 }, /* 1192 Hz */
-    { 9.977740573900488E-01, -1.971264821600469E+00, 9.977740573900488E-01, -1.971264821600469E+00, 9.955481147800975E-01 }, /* 1193 Hz */
-    { 9.977721957043624E-01, -1.971220499862830E+00, 9.977721957043624E-01, -1.971220499862830E+00, 9.955443914087247E-01 }, /* 1194 Hz */
-    { 9.977703340256078E-01, -1.971176144514286E+00, 9.977703340256078E-01, -1.971176144514286E+00, 9.955406680512155E-01 }, /* 1195 Hz */
-    { 9.977684723537846E-01, -1.971131755555724E+00, 9.977684723537846E-01, -1.971131755555724E+00, 9.955369447075693E-01 }, /* 1196 Hz */
-    { 9.977666106888928E-01, -1.971087332988027E+00, 9.977666106888928E-01, -1.971087332988027E+00, 9.955332213777857E-01 }, /* 1197 Hz */
-    { 9.977647490309329E-01, -1.971042876812084E+00, 9.977647490309329E-01, -1.971042876812084E+00, 9.955294980618659E-01 }, /* 1198 Hz */
-    { 9.977628873799042E-01, -1.970998387028780E+00, 9.977628873799042E-01, -1.970998387028780E+00, 9.955257747598083E-01 }, /* 1199 Hz */
-    { 9.977610257358069E-01, -1.970953863639003E+00, 9.977610257358069E-01, -1.970953863639003E+00, 9.955220514716139E-01 }, /* 1200 Hz */
-    { 9.977591640986410E-01, -1.970909306643641E+00, 9.977591640986410E-01, -1.970909306643641E+00, 9.955183281972819E-01 }, /* 1201 Hz */
-    { 9.977573024684064E-01, -1.970864716043583E+00, 9.977573024684064E-01, -1.970864716043583E+00, 9.955146049368129E-01 }, /* 1202 Hz */
-    { 9.977554408451031E-01, -1.970820091839718E+00, 9.977554408451031E-01, -1.970820091839718E+00, 9.955108816902063E-01 }, /* 1203 Hz */
-    { 9.977535792287310E-01, -1.970775434032934E+00, 9.977535792287310E-01, -1.970775434032934E+00, 9.955071584574620E-01 }, /* 1204 Hz */
-    { 9.977517176192899E-01, -1.970730742624123E+00, 9.977517176192899E-01, -1.970730742624123E+00, 9.955034352385799E-01 }, /* 1205 Hz */
-    { 9.977498560167799E-01, -1.970686017614176E+00, 9.977498560167799E-01, -1.970686017614176E+00, 9.954997120335598E-01 }, /* 1206 Hz */
-    { 9.977479944212010E-01, -1.970641259003983E+00, 9.977479944212010E-01, -1.970641259003983E+00, 9.954959888424020E-01 }, /* 1207 Hz */
-    { 9.977461328325530E-01, -1.970596466794437E+00, 9.977461328325530E-01, -1.970596466794437E+00, 9.954922656651060E-01 }, /* 1208 Hz */
-    { 9.977442712508359E-01, -1.970551640986431E+00, 9.977442712508359E-01, -1.970551640986431E+00, 9.954885425016717E-01 }, /* 1209 Hz */
-    { 9.977424096760498E-01, -1.970506781580856E+00, 9.977424096760498E-01, -1.970506781580856E+00, 9.954848193520995E-01 }, /* 1210 Hz */
-    { 9.977405481081943E-01, -1.970461888578608E+00, 9.977405481081943E-01, -1.970461888578608E+00, 9.954810962163887E-01 }, /* 1211 Hz */
-    { 9.977386865472698E-01, -1.970416961980580E+00, 9.977386865472698E-01, -1.970416961980580E+00, 9.954773730945397E-01 }, /* 1212 Hz */
-    { 9.977368249932761E-01, -1.970372001787668E+00, 9.977368249932761E-01, -1.970372001787668E+00, 9.954736499865522E-01 }, /* 1213 Hz */
-    { 9.977349634462129E-01, -1.970327008000766E+00, 9.977349634462129E-01, -1.970327008000766E+00, 9.954699268924259E-01 }, /* 1214 Hz */
-    { 9.977331019060804E-01, -1.970281980620771E+00, 9.977331019060804E-01, -1.970281980620771E+00, 9.954662038121609E-01 }, /* 1215 Hz */
-    { 9.977312403728784E-01, -1.970236919648578E+00, 9.977312403728784E-01, -1.970236919648578E+00, 9.954624807457568E-01 }, /* 1216 Hz */
-    { 9.977293788466068E-01, -1.970191825085086E+00, 9.977293788466068E-01, -1.970191825085086E+00, 9.954587576932137E-01 }, /* 1217 Hz */
-    { 9.977275173272659E-01, -1.970146696931192E+00, 9.977275173272659E-01, -1.970146696931192E+00, 9.954550346545319E-01 }, /* 1218 Hz */
-    { 9.977256558148553E-01, -1.970101535187794E+00, 9.977256558148553E-01, -1.970101535187794E+00, 9.954513116297106E-01 }, /* 1219 Hz */
-    { 9.977237943093751E-01, -1.970056339855791E+00, 9.977237943093751E-01, -1.970056339855791E+00, 9.954475886187502E-01 }, /* 1220 Hz */
-    { 9.977219328108250E-01, -1.970011110936082E+00, 9.977219328108250E-01, -1.970011110936082E+00, 9.954438656216500E-01 }, /* 1221 Hz */
-    { 9.977200713192055E-01, -1.969965848429569E+00, 9.977200713192055E-01, -1.969965848429569E+00, 9.954401426384110E-01 }, /* 1222 Hz */
-    { 9.977182098345159E-01, -1.969920552337149E+00, 9.977182098345159E-01, -1.969920552337149E+00, 9.954364196690317E-01 }, /* 1223 Hz */
-    { 9.977163483567567E-01, -1.969875222659726E+00, 9.977163483567567E-01, -1.969875222659726E+00, 9.954326967135134E-01 }, /* 1224 Hz */
-    { 9.977144868859275E-01, -1.969829859398201E+00, 9.977144868859275E-01, -1.969829859398201E+00, 9.954289737718549E-01 }, /* 1225 Hz */
-    { 9.977126254220282E-01, -1.969784462553476E+00, 9.977126254220282E-01, -1.969784462553476E+00, 9.954252508440564E-01 }, /* 1226 Hz */
-    { 9.977107639650591E-01, -1.969739032126454E+00, 9.977107639650591E-01, -1.969739032126454E+00, 9.954215279301182E-01 }, /* 1227 Hz */
-    { 9.977089025150199E-01, -1.969693568118038E+00, 9.977089025150199E-01, -1.969693568118038E+00, 9.954178050300397E-01 }, /* 1228 Hz */
-    { 9.977070410719104E-01, -1.969648070529131E+00, 9.977070410719104E-01, -1.969648070529131E+00, 9.954140821438209E-01 }, /* 1229 Hz */
-    { 9.977051796357310E-01, -1.969602539360641E+00, 9.977051796357310E-01, -1.969602539360641E+00, 9.954103592714620E-01 }, /* 1230 Hz */
-    { 9.977033182064814E-01, -1.969556974613470E+00, 9.977033182064814E-01, -1.969556974613470E+00, 9.954066364129628E-01 }, /* 1231 Hz */
-    { 9.977014567841614E-01, -1.969511376288524E+00, 9.977014567841614E-01, -1.969511376288524E+00, 9.954029135683229E-01 }, /* 1232 Hz */
-    { 9.976995953687711E-01, -1.969465744386711E+00, 9.976995953687711E-01, -1.969465744386711E+00, 9.953991907375421E-01 }, /* 1233 Hz */
-    { 9.976977339603105E-01, -1.969420078908936E+00, 9.976977339603105E-01, -1.969420078908936E+00, 9.953954679206209E-01 }, /* 1234 Hz */
-    { 9.976958725587793E-01, -1.969374379856107E+00, 9.976958725587793E-01, -1.969374379856107E+00, 9.953917451175587E-01 }, /* 1235 Hz */
-    { 9.976940111641780E-01, -1.969328647229133E+00, 9.976940111641780E-01, -1.969328647229133E+00, 9.953880223283560E-01 }, /* 1236 Hz */
-    { 9.976921497765058E-01, -1.969282881028920E+00, 9.976921497765058E-01, -1.969282881028920E+00, 9.953842995530116E-01 }, /* 1237 Hz */
-    { 9.976902883957632E-01, -1.969237081256380E+00, 9.976902883957632E-01, -1.969237081256380E+00, 9.953805767915265E-01 }, /* 1238 Hz */
-    { 9.976884270219500E-01, -1.969191247912422E+00, 9.976884270219500E-01, -1.969191247912422E+00, 9.953768540439001E-01 }, /* 1239 Hz */
-    { 9.976865656550661E-01, -1.969145380997955E+00, 9.976865656550661E-01, -1.969145380997955E+00, 9.953731313101322E-01 }, /* 1240 Hz */
-    { 9.976847042951112E-01, -1.969099480513890E+00, 9.976847042951112E-01, -1.969099480513890E+00, 9.953694085902225E-01 }, /* 1241 Hz */
-    { 9.976828429420859E-01, -1.969053546461140E+00, 9.976828429420859E-01, -1.969053546461140E+00, 9.953656858841717E-01 }, /* 1242 Hz */
-    { 9.976809815959897E-01, -1.969007578840616E+00, 9.976809815959897E-01, -1.969007578840616E+00, 9.953619631919794E-01 }, /* 1243 Hz */
-    { 9.976791202568226E-01, -1.968961577653230E+00, 9.976791202568226E-01, -1.968961577653230E+00, 9.953582405136452E-01 }, /* 1244 Hz */
-    { 9.976772589245845E-01, -1.968915542899896E+00, 9.976772589245845E-01, -1.968915542899896E+00, 9.953545178491690E-01 }, /* 1245 Hz */
-    { 9.976753975992755E-01, -1.968869474581527E+00, 9.976753975992755E-01, -1.968869474581527E+00, 9.953507951985510E-01 }, /* 1246 Hz */
-    { 9.976735362808953E-01, -1.968823372699037E+00, 9.976735362808953E-01, -1.968823372699037E+00, 9.953470725617906E-01 }, /* 1247 Hz */
-    { 9.976716749694441E-01, -1.968777237253342E+00, 9.976716749694441E-01, -1.968777237253342E+00, 9.953433499388882E-01 }, /* 1248 Hz */
-    { 9.976698136649219E-01, -1.968731068245358E+00, 9.976698136649219E-01, -1.968731068245358E+00, 9.953396273298438E-01 }, /* 1249 Hz */
-    { 9.976679523673284E-01, -1.968684865675999E+00, 9.976679523673284E-01, -1.968684865675999E+00, 9.953359047346568E-01 }, /* 1250 Hz */
-    { 9.976660910766636E-01, -1.968638629546182E+00, 9.976660910766636E-01, -1.968638629546182E+00, 9.953321821533272E-01 }, /* 1251 Hz */
-    { 9.976642297929275E-01, -1.968592359856824E+00, 9.976642297929275E-01, -1.968592359856824E+00, 9.953284595858549E-01 }, /* 1252 Hz */
-    { 9.976623685161201E-01, -1.968546056608844E+00, 9.976623685161201E-01, -1.968546056608844E+00, 9.953247370322402E-01 }, /* 1253 Hz */
-    { 9.976605072462413E-01, -1.968499719803160E+00, 9.976605072462413E-01, -1.968499719803160E+00, 9.953210144924827E-01 }, /* 1254 Hz */
-    { 9.976586459832910E-01, -1.968453349440689E+00, 9.976586459832910E-01, -1.968453349440689E+00, 9.953172919665820E-01 }, /* 1255 Hz */
-    { 9.976567847272693E-01, -1.968406945522352E+00, 9.976567847272693E-01, -1.968406945522352E+00, 9.953135694545385E-01 }, /* 1256 Hz */
-    { 9.976549234781761E-01, -1.968360508049069E+00, 9.976549234781761E-01, -1.968360508049069E+00, 9.953098469563522E-01 }, /* 1257 Hz */
-    { 9.976530622360111E-01, -1.968314037021760E+00, 9.976530622360111E-01, -1.968314037021760E+00, 9.953061244720223E-01 }, /* 1258 Hz */
-    { 9.976512010007745E-01, -1.968267532441347E+00, 9.976512010007745E-01, -1.968267532441347E+00, 9.953024020015491E-01 }, /* 1259 Hz */
-    { 9.976493397724663E-01, -1.968220994308750E+00, 9.976493397724663E-01, -1.968220994308750E+00, 9.952986795449326E-01 }, /* 1260 Hz */
-    { 9.976474785510863E-01, -1.968174422624893E+00, 9.976474785510863E-01, -1.968174422624893E+00, 9.952949571021725E-01 }, /* 1261 Hz */
-    { 9.976456173366344E-01, -1.968127817390698E+00, 9.976456173366344E-01, -1.968127817390698E+00, 9.952912346732687E-01 }, /* 1262 Hz */
-    { 9.976437561291106E-01, -1.968081178607088E+00, 9.976437561291106E-01, -1.968081178607088E+00, 9.952875122582212E-01 }, /* 1263 Hz */
-    { 9.976418949285150E-01, -1.968034506274988E+00, 9.976418949285150E-01, -1.968034506274988E+00, 9.952837898570299E-01 }, /* 1264 Hz */
-    { 9.976400337348473E-01, -1.967987800395321E+00, 9.976400337348473E-01, -1.967987800395321E+00, 9.952800674696947E-01 }, /* 1265 Hz */
-    { 9.976381725481077E-01, -1.967941060969014E+00, 9.976381725481077E-01, -1.967941060969014E+00, 9.952763450962154E-01 }, /* 1266 Hz */
-    { 9.976363113682960E-01, -1.967894287996992E+00, 9.976363113682960E-01, -1.967894287996992E+00, 9.952726227365920E-01 }, /* 1267 Hz */
-    { 9.976344501954123E-01, -1.967847481480181E+00, 9.976344501954123E-01, -1.967847481480181E+00, 9.952689003908246E-01 }, /* 1268 Hz */
-    { 9.976325890294563E-01, -1.967800641419508E+00, 9.976325890294563E-01, -1.967800641419508E+00, 9.952651780589126E-01 }, /* 1269 Hz */
-    { 9.976307278704281E-01, -1.967753767815900E+00, 9.976307278704281E-01, -1.967753767815900E+00, 9.952614557408561E-01 }, /* 1270 Hz */
-    { 9.976288667183275E-01, -1.967706860670285E+00, 9.976288667183275E-01, -1.967706860670285E+00, 9.952577334366550E-01 }, /* 1271 Hz */
-    { 9.976270055731548E-01, -1.967659919983592E+00, 9.976270055731548E-01, -1.967659919983592E+00, 9.952540111463095E-01 }, /* 1272 Hz */
-    { 9.976251444349095E-01, -1.967612945756750E+00, 9.976251444349095E-01, -1.967612945756750E+00, 9.952502888698189E-01 }, /* 1273 Hz */
-    { 9.976232833035918E-01, -1.967565937990689E+00, 9.976232833035918E-01, -1.967565937990689E+00, 9.952465666071837E-01 }, /* 1274 Hz */
-    { 9.976214221792018E-01, -1.967518896686339E+00, 9.976214221792018E-01, -1.967518896686339E+00, 9.952428443584036E-01 }, /* 1275 Hz */
-    { 9.976195610617391E-01, -1.967471821844630E+00, 9.976195610617391E-01, -1.967471821844630E+00, 9.952391221234782E-01 }, /* 1276 Hz */
-    { 9.976176999512038E-01, -1.967424713466494E+00, 9.976176999512038E-01, -1.967424713466494E+00, 9.952353999024075E-01 }, /* 1277 Hz */
-    { 9.976158388475959E-01, -1.967377571552863E+00, 9.976158388475959E-01, -1.967377571552863E+00, 9.952316776951917E-01 }, /* 1278 Hz */
-    { 9.976139777509153E-01, -1.967330396104670E+00, 9.976139777509153E-01, -1.967330396104670E+00, 9.952279555018306E-01 }, /* 1279 Hz */
-    { 9.976121166611621E-01, -1.967283187122848E+00, 9.976121166611621E-01, -1.967283187122848E+00, 9.952242333223242E-01 }, /* 1280 Hz */
-    { 9.976102555783359E-01, -1.967235944608330E+00, 9.976102555783359E-01, -1.967235944608330E+00, 9.952205111566719E-01 }, /* 1281 Hz */
-    { 9.976083945024369E-01, -1.967188668562050E+00, 9.976083945024369E-01, -1.967188668562050E+00, 9.952167890048738E-01 }, /* 1282 Hz */
-    { 9.976065334334652E-01, -1.967141358984945E+00, 9.976065334334652E-01, -1.967141358984945E+00, 9.952130668669303E-01 }, /* 1283 Hz */
-    { 9.976046723714203E-01, -1.967094015877947E+00, 9.976046723714203E-01, -1.967094015877947E+00, 9.952093447428405E-01 }, /* 1284 Hz */
-    { 9.976028113163025E-01, -1.967046639241995E+00, 9.976028113163025E-01, -1.967046639241995E+00, 9.952056226326049E-01 }, /* 1285 Hz */
-    { 9.976009502681116E-01, -1.966999229078024E+00, 9.976009502681116E-01, -1.966999229078024E+00, 9.952019005362231E-01 }, /* 1286 Hz */
-    { 9.975990892268477E-01, -1.966951785386971E+00, 9.975990892268477E-01, -1.966951785386971E+00, 9.951981784536954E-01 }, /* 1287 Hz */
-    { 9.975972281925106E-01, -1.966904308169774E+00, 9.975972281925106E-01, -1.966904308169774E+00, 9.951944563850212E-01 }, /* 1288 Hz */
-    { 9.975953671651001E-01, -1.966856797427372E+00, 9.975953671651001E-01, -1.966856797427372E+00, 9.951907343302002E-01 }, /* 1289 Hz */
-    { 9.975935061446165E-01, -1.966809253160702E+00, 9.975935061446165E-01, -1.966809253160702E+00, 9.951870122892330E-01 }, /* 1290 Hz */
-    { 9.975916451310596E-01, -1.966761675370706E+00, 9.975916451310596E-01, -1.966761675370706E+00, 9.951832902621192E-01 }, /* 1291 Hz */
-    { 9.975897841244293E-01, -1.966714064058321E+00, 9.975897841244293E-01, -1.966714064058321E+00, 9.951795682488587E-01 }, /* 1292 Hz */
-    { 9.975879231247257E-01, -1.966666419224490E+00, 9.975879231247257E-01, -1.966666419224490E+00, 9.951758462494513E-01 }, /* 1293 Hz */
-    { 9.975860621319483E-01, -1.966618740870152E+00, 9.975860621319483E-01, -1.966618740870152E+00, 9.951721242638967E-01 }, /* 1294 Hz */
-    { 9.975842011460978E-01, -1.966571028996251E+00, 9.975842011460978E-01, -1.966571028996251E+00, 9.951684022921956E-01 }, /* 1295 Hz */
-    { 9.975823401671735E-01, -1.966523283603728E+00, 9.975823401671735E-01, -1.966523283603728E+00, 9.951646803343470E-01 }, /* 1296 Hz */
-    { 9.975804791951757E-01, -1.966475504693525E+00, 9.975804791951757E-01, -1.966475504693525E+00, 9.951609583903513E-01 }, /* 1297 Hz */
-    { 9.975786182301041E-01, -1.966427692266586E+00, 9.975786182301041E-01, -1.966427692266586E+00, 9.951572364602081E-01 }, /* 1298 Hz */
-    { 9.975767572719588E-01, -1.966379846323856E+00, 9.975767572719588E-01, -1.966379846323856E+00, 9.951535145439176E-01 }, /* 1299 Hz */
-    { 9.975748963207399E-01, -1.966331966866278E+00, 9.975748963207399E-01, -1.966331966866278E+00, 9.951497926414798E-01 }, /* 1300 Hz */
-    { 9.975730353764470E-01, -1.966284053894797E+00, 9.975730353764470E-01, -1.966284053894797E+00, 9.951460707528941E-01 }, /* 1301 Hz */
-    { 9.975711744390803E-01, -1.966236107410360E+00, 9.975711744390803E-01, -1.966236107410360E+00, 9.951423488781606E-01 }, /* 1302 Hz */
-    { 9.975693135086394E-01, -1.966188127413913E+00, 9.975693135086394E-01, -1.966188127413913E+00, 9.951386270172788E-01 }, /* 1303 Hz */
-    { 9.975674525851248E-01, -1.966140113906402E+00, 9.975674525851248E-01, -1.966140113906402E+00, 9.951349051702496E-01 }, /* 1304 Hz */
-    { 9.975655916685361E-01, -1.966092066888775E+00, 9.975655916685361E-01, -1.966092066888775E+00, 9.951311833370722E-01 }, /* 1305 Hz */
-    { 9.975637307588733E-01, -1.966043986361979E+00, 9.975637307588733E-01, -1.966043986361979E+00, 9.951274615177466E-01 }, /* 1306 Hz */
-    { 9.975618698561365E-01, -1.965995872326964E+00, 9.975618698561365E-01, -1.965995872326964E+00, 9.951237397122730E-01 }, /* 1307 Hz */
-    { 9.975600089603254E-01, -1.965947724784678E+00, 9.975600089603254E-01, -1.965947724784678E+00, 9.951200179206507E-01 }, /* 1308 Hz */
-    { 9.975581480714399E-01, -1.965899543736071E+00, 9.975581480714399E-01, -1.965899543736071E+00, 9.951162961428799E-01 }, /* 1309 Hz */
-    { 9.975562871894802E-01, -1.965851329182092E+00, 9.975562871894802E-01, -1.965851329182092E+00, 9.951125743789604E-01 }, /* 1310 Hz */
-    { 9.975544263144462E-01, -1.965803081123694E+00, 9.975544263144462E-01, -1.965803081123694E+00, 9.951088526288925E-01 }, /* 1311 Hz */
-    { 9.975525654463379E-01, -1.965754799561827E+00, 9.975525654463379E-01, -1.965754799561827E+00, 9.951051308926757E-01 }, /* 1312 Hz */
-    { 9.975507045851549E-01, -1.965706484497443E+00, 9.975507045851549E-01, -1.965706484497443E+00, 9.951014091703099E-01 }, /* 1313 Hz */
-    { 9.975488437308976E-01, -1.965658135931496E+00, 9.975488437308976E-01, -1.965658135931496E+00, 9.950976874617952E-01 }, /* 1314 Hz */
-    { 9.975469828835657E-01, -1.965609753864936E+00, 9.975469828835657E-01, -1.965609753864936E+00, 9.950939657671314E-01 }, /* 1315 Hz */
-    { 9.975451220431591E-01, -1.965561338298719E+00, 9.975451220431591E-01, -1.965561338298719E+00, 9.950902440863183E-01 }, /* 1316 Hz */
-    { 9.975432612096781E-01, -1.965512889233799E+00, 9.975432612096781E-01, -1.965512889233799E+00, 9.950865224193561E-01 }, /* 1317 Hz */
-    { 9.975414003831221E-01, -1.965464406671130E+00, 9.975414003831221E-01, -1.965464406671130E+00, 9.950828007662442E-01 }, /* 1318 Hz */
-    { 9.975395395634916E-01, -1.965415890611668E+00, 9.975395395634916E-01, -1.965415890611668E+00, 9.950790791269832E-01 }, /* 1319 Hz */
-    { 9.975376787507862E-01, -1.965367341056369E+00, 9.975376787507862E-01, -1.965367341056369E+00, 9.950753575015725E-01 }, /* 1320 Hz */
-    { 9.975358179450059E-01, -1.965318758006188E+00, 9.975358179450059E-01, -1.965318758006188E+00, 9.950716358900118E-01 }, /* 1321 Hz */
-    { 9.975339571461506E-01, -1.965270141462084E+00, 9.975339571461506E-01, -1.965270141462084E+00, 9.950679142923011E-01 }, /* 1322 Hz */
-    { 9.975320963542206E-01, -1.965221491425014E+00, 9.975320963542206E-01, -1.965221491425014E+00, 9.950641927084412E-01 }, /* 1323 Hz */
-    { 9.975302355692152E-01, -1.965172807895935E+00, 9.975302355692152E-01, -1.965172807895935E+00, 9.950604711384303E-01 }, /* 1324 Hz */
-    { 9.975283747911351E-01, -1.965124090875808E+00, 9.975283747911351E-01, -1.965124090875808E+00, 9.950567495822702E-01 }, /* 1325 Hz */
-    { 9.975265140199795E-01, -1.965075340365590E+00, 9.975265140199795E-01, -1.965075340365590E+00, 9.950530280399590E-01 }, /* 1326 Hz */
-    { 9.975246532557489E-01, -1.965026556366242E+00, 9.975246532557489E-01, -1.965026556366242E+00, 9.950493065114978E-01 }, /* 1327 Hz */
-    { 9.975227924984433E-01, -1.964977738878726E+00, 9.975227924984433E-01, -1.964977738878726E+00, 9.950455849968867E-01 }, /* 1328 Hz */
-    { 9.975209317480622E-01, -1.964928887904000E+00, 9.975209317480622E-01, -1.964928887904000E+00, 9.950418634961244E-01 }, /* 1329 Hz */
-    { 9.975190710046057E-01, -1.964880003443028E+00, 9.975190710046057E-01, -1.964880003443028E+00, 9.950381420092114E-01 }, /* 1330 Hz */
-    { 9.975172102680741E-01, -1.964831085496771E+00, 9.975172102680741E-01, -1.964831085496771E+00, 9.950344205361481E-01 }, /* 1331 Hz */
-    { 9.975153495384669E-01, -1.964782134066193E+00, 9.975153495384669E-01, -1.964782134066193E+00, 9.950306990769338E-01 }, /* 1332 Hz */
-    { 9.975134888157841E-01, -1.964733149152255E+00, 9.975134888157841E-01, -1.964733149152255E+00, 9.950269776315681E-01 }, /* 1333 Hz */
-    { 9.975116281000258E-01, -1.964684130755923E+00, 9.975116281000258E-01, -1.964684130755923E+00, 9.950232562000516E-01 }, /* 1334 Hz */
-    { 9.975097673911921E-01, -1.964635078878161E+00, 9.975097673911921E-01, -1.964635078878161E+00, 9.950195347823843E-01 }, /* 1335 Hz */
-    { 9.975079066892827E-01, -1.964585993519933E+00, 9.975079066892827E-01, -1.964585993519933E+00, 9.950158133785654E-01 }, /* 1336 Hz */
-    { 9.975060459942976E-01, -1.964536874682206E+00, 9.975060459942976E-01, -1.964536874682206E+00, 9.950120919885952E-01 }, /* 1337 Hz */
-    { 9.975041853062366E-01, -1.964487722365946E+00, 9.975041853062366E-01, -1.964487722365946E+00, 9.950083706124733E-01 }, /* 1338 Hz */
-    { 9.975023246251000E-01, -1.964438536572119E+00, 9.975023246251000E-01, -1.964438536572119E+00, 9.950046492502000E-01 }, /* 1339 Hz */
-    { 9.975004639508877E-01, -1.964389317301693E+00, 9.975004639508877E-01, -1.964389317301693E+00, 9.950009279017753E-01 }, /* 1340 Hz */
-    { 9.974986032835991E-01, -1.964340064555634E+00, 9.974986032835991E-01, -1.964340064555634E+00, 9.949972065671981E-01 }, /* 1341 Hz */
-    { 9.974967426232347E-01, -1.964290778334914E+00, 9.974967426232347E-01, -1.964290778334914E+00, 9.949934852464695E-01 }, /* 1342 Hz */
-    { 9.974948819697944E-01, -1.964241458640499E+00, 9.974948819697944E-01, -1.964241458640499E+00, 9.949897639395888E-01 }, /* 1343 Hz */
-    { 9.974930213232781E-01, -1.964192105473360E+00, 9.974930213232781E-01, -1.964192105473360E+00, 9.949860426465562E-01 }, /* 1344 Hz */
-    { 9.974911606836855E-01, -1.964142718834466E+00, 9.974911606836855E-01, -1.964142718834466E+00, 9.949823213673710E-01 }, /* 1345 Hz */
-    { 9.974893000510168E-01, -1.964093298724789E+00, 9.974893000510168E-01, -1.964093298724789E+00, 9.949786001020335E-01 }, /* 1346 Hz */
-    { 9.974874394252720E-01, -1.964043845145299E+00, 9.974874394252720E-01, -1.964043845145299E+00, 9.949748788505439E-01 }, /* 1347 Hz */
-    { 9.974855788064509E-01, -1.963994358096970E+00, 9.974855788064509E-01, -1.963994358096970E+00, 9.949711576129019E-01 }, /* 1348 Hz */
-    { 9.974837181945534E-01, -1.963944837580772E+00, 9.974837181945534E-01, -1.963944837580772E+00, 9.949674363891068E-01 }, /* 1349 Hz */
-    { 9.974818575895796E-01, -1.963895283597680E+00, 9.974818575895796E-01, -1.963895283597680E+00, 9.949637151791593E-01 }, /* 1350 Hz */
-    { 9.974799969915294E-01, -1.963845696148666E+00, 9.974799969915294E-01, -1.963845696148666E+00, 9.949599939830589E-01 }, /* 1351 Hz */
-    { 9.974781364004028E-01, -1.963796075234705E+00, 9.974781364004028E-01, -1.963796075234705E+00, 9.949562728008057E-01 }, /* 1352 Hz */
-    { 9.974762758161996E-01, -1.963746420856772E+00, 9.974762758161996E-01, -1.963746420856772E+00, 9.949525516323992E-01 }, /* 1353 Hz */
-    { 9.974744152389198E-01, -1.963696733015841E+00, 9.974744152389198E-01, -1.963696733015841E+00, 9.949488304778396E-01 }, /* 1354 Hz */
-    { 9.974725546685635E-01, -1.963647011712889E+00, 9.974725546685635E-01, -1.963647011712889E+00, 9.949451093371271E-01 }, /* 1355 Hz */
-    { 9.974706941051306E-01, -1.963597256948893E+00, 9.974706941051306E-01, -1.963597256948893E+00, 9.949413882102611E-01 }, /* 1356 Hz */
-    { 9.974688335486208E-01, -1.963547468724828E+00, 9.974688335486208E-01, -1.963547468724828E+00, 9.949376670972416E-01 }, /* 1357 Hz */
-    { 9.974669729990342E-01, -1.963497647041673E+00, 9.974669729990342E-01, -1.963497647041673E+00, 9.949339459980684E-01 }, /* 1358 Hz */
-    { 9.974651124563708E-01, -1.963447791900405E+00, 9.974651124563708E-01, -1.963447791900405E+00, 9.949302249127416E-01 }, /* 1359 Hz */
-    { 9.974632519206307E-01, -1.963397903302004E+00, 9.974632519206307E-01, -1.963397903302004E+00, 9.949265038412614E-01 }, /* 1360 Hz */
-    { 9.974613913918134E-01, -1.963347981247449E+00, 9.974613913918134E-01, -1.963347981247449E+00, 9.949227827836269E-01 }, /* 1361 Hz */
-    { 9.974595308699195E-01, -1.963298025737720E+00, 9.974595308699195E-01, -1.963298025737720E+00, 9.949190617398389E-01 }, /* 1362 Hz */
-    { 9.974576703549481E-01, -1.963248036773796E+00, 9.974576703549481E-01, -1.963248036773796E+00, 9.949153407098963E-01 }, /* 1363 Hz */
-    { 9.974558098468999E-01, -1.963198014356659E+00, 9.974558098468999E-01, -1.963198014356659E+00, 9.949116196937997E-01 }, /* 1364 Hz */
-    { 9.974539493457745E-01, -1.963147958487292E+00, 9.974539493457745E-01, -1.963147958487292E+00, 9.949078986915489E-01 }, /* 1365 Hz */
-    { 9.974520888515720E-01, -1.963097869166674E+00, 9.974520888515720E-01, -1.963097869166674E+00, 9.949041777031440E-01 }, /* 1366 Hz */
-    { 9.974502283642921E-01, -1.963047746395790E+00, 9.974502283642921E-01, -1.963047746395790E+00, 9.949004567285842E-01 }, /* 1367 Hz */
-    { 9.974483678839349E-01, -1.962997590175622E+00, 9.974483678839349E-01, -1.962997590175622E+00, 9.948967357678697E-01 }, /* 1368 Hz */
-    { 9.974465074105004E-01, -1.962947400507155E+00, 9.974465074105004E-01, -1.962947400507155E+00, 9.948930148210009E-01 }, /* 1369 Hz */
-    { 9.974446469439886E-01, -1.962897177391373E+00, 9.974446469439886E-01, -1.962897177391373E+00, 9.948892938879772E-01 }, /* 1370 Hz */
-    { 9.974427864843993E-01, -1.962846920829260E+00, 9.974427864843993E-01, -1.962846920829260E+00, 9.948855729687986E-01 }, /* 1371 Hz */
-    { 9.974409260317326E-01, -1.962796630821803E+00, 9.974409260317326E-01, -1.962796630821803E+00, 9.948818520634652E-01 }, /* 1372 Hz */
-    { 9.974390655859883E-01, -1.962746307369987E+00, 9.974390655859883E-01, -1.962746307369987E+00, 9.948781311719765E-01 }, /* 1373 Hz */
-    { 9.974372051471663E-01, -1.962695950474798E+00, 9.974372051471663E-01, -1.962695950474798E+00, 9.948744102943325E-01 }, /* 1374 Hz */
-    { 9.974353447152666E-01, -1.962645560137225E+00, 9.974353447152666E-01, -1.962645560137225E+00, 9.948706894305333E-01 }, /* 1375 Hz */
-    { 9.974334842902896E-01, -1.962595136358256E+00, 9.974334842902896E-01, -1.962595136358256E+00, 9.948669685805791E-01 }, /* 1376 Hz */
-    { 9.974316238722344E-01, -1.962544679138878E+00, 9.974316238722344E-01, -1.962544679138878E+00, 9.948632477444688E-01 }, /* 1377 Hz */
-    { 9.974297634611016E-01, -1.962494188480080E+00, 9.974297634611016E-01, -1.962494188480080E+00, 9.948595269222031E-01 }, /* 1378 Hz */
-    { 9.974279030568908E-01, -1.962443664382852E+00, 9.974279030568908E-01, -1.962443664382852E+00, 9.948558061137815E-01 }, /* 1379 Hz */
-    { 9.974260426596022E-01, -1.962393106848184E+00, 9.974260426596022E-01, -1.962393106848184E+00, 9.948520853192044E-01 }, /* 1380 Hz */
-    { 9.974241822692356E-01, -1.962342515877066E+00, 9.974241822692356E-01, -1.962342515877066E+00, 9.948483645384711E-01 }, /* 1381 Hz */
-    { 9.974223218857909E-01, -1.962291891470490E+00, 9.974223218857909E-01, -1.962291891470490E+00, 9.948446437715819E-01 }, /* 1382 Hz */
-    { 9.974204615092683E-01, -1.962241233629448E+00, 9.974204615092683E-01, -1.962241233629448E+00, 9.948409230185367E-01 }, /* 1383 Hz */
-    { 9.974186011396675E-01, -1.962190542354932E+00, 9.974186011396675E-01, -1.962190542354932E+00, 9.948372022793350E-01 }, /* 1384 Hz */
-    { 9.974167407769886E-01, -1.962139817647935E+00, 9.974167407769886E-01, -1.962139817647935E+00, 9.948334815539772E-01 }, /* 1385 Hz */
-    { 9.974148804212314E-01, -1.962089059509450E+00, 9.974148804212314E-01, -1.962089059509450E+00, 9.948297608424628E-01 }, /* 1386 Hz */
-    { 9.974130200723961E-01, -1.962038267940472E+00, 9.974130200723961E-01, -1.962038267940472E+00, 9.948260401447921E-01 }, /* 1387 Hz */
-    { 9.974111597304821E-01, -1.961987442941995E+00, 9.974111597304821E-01, -1.961987442941995E+00, 9.948223194609642E-01 }, /* 1388 Hz */
-    { 9.974092993954902E-01, -1.961936584515014E+00, 9.974092993954902E-01, -1.961936584515014E+00, 9.948185987909803E-01 }, /* 1389 Hz */
-    { 9.974074390674196E-01, -1.961885692660525E+00, 9.974074390674196E-01, -1.961885692660525E+00, 9.948148781348392E-01 }, /* 1390 Hz */
-    { 9.974055787462704E-01, -1.961834767379524E+00, 9.974055787462704E-01, -1.961834767379524E+00, 9.948111574925409E-01 }, /* 1391 Hz */
-    { 9.974037184320430E-01, -1.961783808673009E+00, 9.974037184320430E-01, -1.961783808673009E+00, 9.948074368640860E-01 }, /* 1392 Hz */
-    { 9.974018581247367E-01, -1.961732816541977E+00, 9.974018581247367E-01, -1.961732816541977E+00, 9.948037162494734E-01 }, /* 1393 Hz */
-    { 9.973999978243521E-01, -1.961681790987425E+00, 9.973999978243521E-01, -1.961681790987425E+00, 9.947999956487041E-01 }, /* 1394 Hz */
-    { 9.973981375308886E-01, -1.961630732010353E+00, 9.973981375308886E-01, -1.961630732010353E+00, 9.947962750617771E-01 }, /* 1395 Hz */
-    { 9.973962772443463E-01, -1.961579639611759E+00, 9.973962772443463E-01, -1.961579639611759E+00, 9.947925544886926E-01 }, /* 1396 Hz */
-    { 9.973944169647253E-01, -1.961528513792643E+00, 9.973944169647253E-01, -1.961528513792643E+00, 9.947888339294506E-01 }, /* 1397 Hz */
-    { 9.973925566920255E-01, -1.961477354554007E+00, 9.973925566920255E-01, -1.961477354554007E+00, 9.947851133840511E-01 }, /* 1398 Hz */
-    { 9.973906964262468E-01, -1.961426161896849E+00, 9.973906964262468E-01, -1.961426161896849E+00, 9.947813928524936E-01 }, /* 1399 Hz */
-    { 9.973888361673892E-01, -1.961374935822173E+00, 9.973888361673892E-01, -1.961374935822173E+00, 9.947776723347783E-01 }, /* 1400 Hz */
-    { 9.973869759154523E-01, -1.961323676330979E+00, 9.973869759154523E-01, -1.961323676330979E+00, 9.947739518309047E-01 }, /* 1401 Hz */
-    { 9.973851156704366E-01, -1.961272383424272E+00, 9.973851156704366E-01, -1.961272383424272E+00, 9.947702313408733E-01 }, /* 1402 Hz */
-    { 9.973832554323417E-01, -1.961221057103052E+00, 9.973832554323417E-01, -1.961221057103052E+00, 9.947665108646835E-01 }, /* 1403 Hz */
-    { 9.973813952011679E-01, -1.961169697368326E+00, 9.973813952011679E-01, -1.961169697368326E+00, 9.947627904023357E-01 }, /* 1404 Hz */
-    { 9.973795349769147E-01, -1.961118304221096E+00, 9.973795349769147E-01, -1.961118304221096E+00, 9.947590699538293E-01 }, /* 1405 Hz */
-    { 9.973776747595823E-01, -1.961066877662368E+00, 9.973776747595823E-01, -1.961066877662368E+00, 9.947553495191646E-01 }, /* 1406 Hz */
-    { 9.973758145491707E-01, -1.961015417693147E+00, 9.973758145491707E-01, -1.961015417693147E+00, 9.947516290983414E-01 }, /* 1407 Hz */
-    { 9.973739543456794E-01, -1.960963924314439E+00, 9.973739543456794E-01, -1.960963924314439E+00, 9.947479086913589E-01 }, /* 1408 Hz */
-    { 9.973720941491091E-01, -1.960912397527250E+00, 9.973720941491091E-01, -1.960912397527250E+00, 9.947441882982182E-01 }, /* 1409 Hz */
-    { 9.973702339594592E-01, -1.960860837332589E+00, 9.973702339594592E-01, -1.960860837332589E+00, 9.947404679189185E-01 }, /* 1410 Hz */
-    { 9.973683737767296E-01, -1.960809243731461E+00, 9.973683737767296E-01, -1.960809243731461E+00, 9.947367475534592E-01 }, /* 1411 Hz */
-    { 9.973665136009207E-01, -1.960757616724877E+00, 9.973665136009207E-01, -1.960757616724877E+00, 9.947330272018413E-01 }, /* 1412 Hz */
-    { 9.973646534320320E-01, -1.960705956313844E+00, 9.973646534320320E-01, -1.960705956313844E+00, 9.947293068640639E-01 }, /* 1413 Hz */
-    { 9.973627932700637E-01, -1.960654262499371E+00, 9.973627932700637E-01, -1.960654262499371E+00, 9.947255865401274E-01 }, /* 1414 Hz */
-    { 9.973609331150157E-01, -1.960602535282471E+00, 9.973609331150157E-01, -1.960602535282471E+00, 9.947218662300314E-01 }, /* 1415 Hz */
-    { 9.973590729668881E-01, -1.960550774664151E+00, 9.973590729668881E-01, -1.960550774664151E+00, 9.947181459337762E-01 }, /* 1416 Hz */
-    { 9.973572128256805E-01, -1.960498980645424E+00, 9.973572128256805E-01, -1.960498980645424E+00, 9.947144256513609E-01 }, /* 1417 Hz */
-    { 9.973553526913929E-01, -1.960447153227301E+00, 9.973553526913929E-01, -1.960447153227301E+00, 9.947107053827857E-01 }, /* 1418 Hz */
-    { 9.973534925640254E-01, -1.960395292410795E+00, 9.973534925640254E-01, -1.960395292410795E+00, 9.947069851280508E-01 }, /* 1419 Hz */
-    { 9.973516324435782E-01, -1.960343398196918E+00, 9.973516324435782E-01, -1.960343398196918E+00, 9.947032648871563E-01 }, /* 1420 Hz */
-    { 9.973497723300507E-01, -1.960291470586684E+00, 9.973497723300507E-01, -1.960291470586684E+00, 9.946995446601015E-01 }, /* 1421 Hz */
-    { 9.973479122234433E-01, -1.960239509581106E+00, 9.973479122234433E-01, -1.960239509581106E+00, 9.946958244468866E-01 }, /* 1422 Hz */
-    { 9.973460521237556E-01, -1.960187515181200E+00, 9.973460521237556E-01, -1.960187515181200E+00, 9.946921042475112E-01 }, /* 1423 Hz */
-    { 9.973441920309879E-01, -1.960135487387980E+00, 9.973441920309879E-01, -1.960135487387980E+00, 9.946883840619758E-01 }, /* 1424 Hz */
-    { 9.973423319451399E-01, -1.960083426202462E+00, 9.973423319451399E-01, -1.960083426202462E+00, 9.946846638902798E-01 }, /* 1425 Hz */
-    { 9.973404718662114E-01, -1.960031331625662E+00, 9.973404718662114E-01, -1.960031331625662E+00, 9.946809437324229E-01 }, /* 1426 Hz */
-    { 9.973386117942028E-01, -1.959979203658597E+00, 9.973386117942028E-01, -1.959979203658597E+00, 9.946772235884056E-01 }, /* 1427 Hz */
-    { 9.973367517291138E-01, -1.959927042302284E+00, 9.973367517291138E-01, -1.959927042302284E+00, 9.946735034582277E-01 }, /* 1428 Hz */
-    { 9.973348916709445E-01, -1.959874847557742E+00, 9.973348916709445E-01, -1.959874847557742E+00, 9.946697833418889E-01 }, /* 1429 Hz */
-    { 9.973330316196943E-01, -1.959822619425988E+00, 9.973330316196943E-01, -1.959822619425988E+00, 9.946660632393887E-01 }, /* 1430 Hz */
-    { 9.973311715753638E-01, -1.959770357908042E+00, 9.973311715753638E-01, -1.959770357908042E+00, 9.946623431507275E-01 }, /* 1431 Hz */
-    { 9.973293115379527E-01, -1.959718063004924E+00, 9.973293115379527E-01, -1.959718063004924E+00, 9.946586230759054E-01 }, /* 1432 Hz */
-    { 9.973274515074610E-01, -1.959665734717653E+00, 9.973274515074610E-01, -1.959665734717653E+00, 9.946549030149221E-01 }, /* 1433 Hz */
-    { 9.973255914838886E-01, -1.959613373047250E+00, 9.973255914838886E-01, -1.959613373047250E+00, 9.946511829677771E-01 }, /* 1434 Hz */
-    { 9.973237314672354E-01, -1.959560977994738E+00, 9.973237314672354E-01, -1.959560977994738E+00, 9.946474629344708E-01 }, /* 1435 Hz */
-    { 9.973218714575013E-01, -1.959508549561137E+00, 9.973218714575013E-01, -1.959508549561137E+00, 9.946437429150026E-01 }, /* 1436 Hz */
-    { 9.973200114546865E-01, -1.959456087747470E+00, 9.973200114546865E-01, -1.959456087747470E+00, 9.946400229093730E-01 }, /* 1437 Hz */
-    { 9.973181514587908E-01, -1.959403592554760E+00, 9.973181514587908E-01, -1.959403592554760E+00, 9.946363029175815E-01 }, /* 1438 Hz */
-    { 9.973162914698140E-01, -1.959351063984031E+00, 9.973162914698140E-01, -1.959351063984031E+00, 9.946325829396281E-01 }, /* 1439 Hz */
-    { 9.973144314877563E-01, -1.959298502036307E+00, 9.973144314877563E-01, -1.959298502036307E+00, 9.946288629755127E-01 }, /* 1440 Hz */
-    { 9.973125715126174E-01, -1.959245906712612E+00, 9.973125715126174E-01, -1.959245906712612E+00, 9.946251430252349E-01 }, /* 1441 Hz */
-    { 9.973107115443975E-01, -1.959193278013972E+00, 9.973107115443975E-01, -1.959193278013972E+00, 9.946214230887951E-01 }, /* 1442 Hz */
-    { 9.973088515830966E-01, -1.959140615941414E+00, 9.973088515830966E-01, -1.959140615941414E+00, 9.946177031661931E-01 }, /* 1443 Hz */
-    { 9.973069916287143E-01, -1.959087920495962E+00, 9.973069916287143E-01, -1.959087920495962E+00, 9.946139832574286E-01 }, /* 1444 Hz */
-    { 9.973051316812508E-01, -1.959035191678645E+00, 9.973051316812508E-01, -1.959035191678645E+00, 9.946102633625016E-01 }, /* 1445 Hz */
-    { 9.973032717407060E-01, -1.958982429490490E+00, 9.973032717407060E-01, -1.958982429490490E+00, 9.946065434814120E-01 }, /* 1446 Hz */
-    { 9.973014118070795E-01, -1.958929633932524E+00, 9.973014118070795E-01, -1.958929633932524E+00, 9.946028236141591E-01 }, /* 1447 Hz */
-    { 9.972995518803721E-01, -1.958876805005778E+00, 9.972995518803721E-01, -1.958876805005778E+00, 9.945991037607442E-01 }, /* 1448 Hz */
-    { 9.972976919605829E-01, -1.958823942711279E+00, 9.972976919605829E-01, -1.958823942711279E+00, 9.945953839211659E-01 }, /* 1449 Hz */
-    { 9.972958320477121E-01, -1.958771047050059E+00, 9.972958320477121E-01, -1.958771047050059E+00, 9.945916640954242E-01 }, /* 1450 Hz */
-    { 9.972939721417601E-01, -1.958718118023146E+00, 9.972939721417601E-01, -1.958718118023146E+00, 9.945879442835202E-01 }, /* 1451 Hz */
-    { 9.972921122427263E-01, -1.958665155631573E+00, 9.972921122427263E-01, -1.958665155631573E+00, 9.945842244854526E-01 }, /* 1452 Hz */
-    { 9.972902523506106E-01, -1.958612159876371E+00, 9.972902523506106E-01, -1.958612159876371E+00, 9.945805047012213E-01 }, /* 1453 Hz */
-    { 9.972883924654135E-01, -1.958559130758571E+00, 9.972883924654135E-01, -1.958559130758571E+00, 9.945767849308269E-01 }, /* 1454 Hz */
-    { 9.972865325871344E-01, -1.958506068279207E+00, 9.972865325871344E-01, -1.958506068279207E+00, 9.945730651742688E-01 }, /* 1455 Hz */
-    { 9.972846727157734E-01, -1.958452972439312E+00, 9.972846727157734E-01, -1.958452972439312E+00, 9.945693454315467E-01 }, /* 1456 Hz */
-    { 9.972828128513307E-01, -1.958399843239920E+00, 9.972828128513307E-01, -1.958399843239920E+00, 9.945656257026614E-01 }, /* 1457 Hz */
-    { 9.972809529938060E-01, -1.958346680682065E+00, 9.972809529938060E-01, -1.958346680682065E+00, 9.945619059876121E-01 }, /* 1458 Hz */
-    { 9.972790931431994E-01, -1.958293484766782E+00, 9.972790931431994E-01, -1.958293484766782E+00, 9.945581862863988E-01 }, /* 1459 Hz */
-    { 9.972772332995107E-01, -1.958240255495106E+00, 9.972772332995107E-01, -1.958240255495106E+00, 9.945544665990214E-01 }, /* 1460 Hz */
-    { 9.972753734627399E-01, -1.958186992868074E+00, 9.972753734627399E-01, -1.958186992868074E+00, 9.945507469254797E-01 }, /* 1461 Hz */
-    { 9.972735136328869E-01, -1.958133696886722E+00, 9.972735136328869E-01, -1.958133696886722E+00, 9.945470272657737E-01 }, /* 1462 Hz */
-    { 9.972716538099518E-01, -1.958080367552088E+00, 9.972716538099518E-01, -1.958080367552088E+00, 9.945433076199035E-01 }, /* 1463 Hz */
-    { 9.972697939939345E-01, -1.958027004865209E+00, 9.972697939939345E-01, -1.958027004865209E+00, 9.945395879878689E-01 }, /* 1464 Hz */
-    { 9.972679341848346E-01, -1.957973608827124E+00, 9.972679341848346E-01, -1.957973608827124E+00, 9.945358683696692E-01 }, /* 1465 Hz */
-    { 9.972660743826526E-01, -1.957920179438871E+00, 9.972660743826526E-01, -1.957920179438871E+00, 9.945321487653052E-01 }, /* 1466 Hz */
-    { 9.972642145873881E-01, -1.957866716701490E+00, 9.972642145873881E-01, -1.957866716701490E+00, 9.945284291747762E-01 }, /* 1467 Hz */
-    { 9.972623547990411E-01, -1.957813220616022E+00, 9.972623547990411E-01, -1.957813220616022E+00, 9.945247095980823E-01 }, /* 1468 Hz */
-    { 9.972604950176117E-01, -1.957759691183506E+00, 9.972604950176117E-01, -1.957759691183506E+00, 9.945209900352234E-01 }, /* 1469 Hz */
-    { 9.972586352430999E-01, -1.957706128404984E+00, 9.972586352430999E-01, -1.957706128404984E+00, 9.945172704861998E-01 }, /* 1470 Hz */
-    { 9.972567754755053E-01, -1.957652532281498E+00, 9.972567754755053E-01, -1.957652532281498E+00, 9.945135509510106E-01 }, /* 1471 Hz */
-    { 9.972549157148280E-01, -1.957598902814090E+00, 9.972549157148280E-01, -1.957598902814090E+00, 9.945098314296561E-01 }, /* 1472 Hz */
-    { 9.972530559610682E-01, -1.957545240003803E+00, 9.972530559610682E-01, -1.957545240003803E+00, 9.945061119221363E-01 }, /* 1473 Hz */
-    { 9.972511962142253E-01, -1.957491543851680E+00, 9.972511962142253E-01, -1.957491543851680E+00, 9.945023924284506E-01 }, /* 1474 Hz */
-    { 9.972493364742998E-01, -1.957437814358765E+00, 9.972493364742998E-01, -1.957437814358765E+00, 9.944986729485996E-01 }, /* 1475 Hz */
-    { 9.972474767412914E-01, -1.957384051526104E+00, 9.972474767412914E-01, -1.957384051526104E+00, 9.944949534825829E-01 }, /* 1476 Hz */
-    { 9.972456170152001E-01, -1.957330255354741E+00, 9.972456170152001E-01, -1.957330255354741E+00, 9.944912340304002E-01 }, /* 1477 Hz */
-    { 9.972437572960260E-01, -1.957276425845722E+00, 9.972437572960260E-01, -1.957276425845722E+00, 9.944875145920520E-01 }, /* 1478 Hz */
-    { 9.972418975837687E-01, -1.957222563000093E+00, 9.972418975837687E-01, -1.957222563000093E+00, 9.944837951675374E-01 }, /* 1479 Hz */
-    { 9.972400378784284E-01, -1.957168666818901E+00, 9.972400378784284E-01, -1.957168666818901E+00, 9.944800757568568E-01 }, /* 1480 Hz */
-    { 9.972381781800047E-01, -1.957114737303193E+00, 9.972381781800047E-01, -1.957114737303193E+00, 9.944763563600094E-01 }, /* 1481 Hz */
-    { 9.972363184884981E-01, -1.957060774454018E+00, 9.972363184884981E-01, -1.957060774454018E+00, 9.944726369769963E-01 }, /* 1482 Hz */
-    { 9.972344588039082E-01, -1.957006778272424E+00, 9.972344588039082E-01, -1.957006778272424E+00, 9.944689176078163E-01 }, /* 1483 Hz */
-    { 9.972325991262351E-01, -1.956952748759460E+00, 9.972325991262351E-01, -1.956952748759460E+00, 9.944651982524702E-01 }, /* 1484 Hz */
-    { 9.972307394554787E-01, -1.956898685916177E+00, 9.972307394554787E-01, -1.956898685916177E+00, 9.944614789109574E-01 }, /* 1485 Hz */
-    { 9.972288797916388E-01, -1.956844589743623E+00, 9.972288797916388E-01, -1.956844589743623E+00, 9.944577595832775E-01 }, /* 1486 Hz */
-    { 9.972270201347153E-01, -1.956790460242850E+00, 9.972270201347153E-01, -1.956790460242850E+00, 9.944540402694306E-01 }, /* 1487 Hz */
-    { 9.972251604847086E-01, -1.956736297414909E+00, 9.972251604847086E-01, -1.956736297414909E+00, 9.944503209694171E-01 }, /* 1488 Hz */
-    { 9.972233008416181E-01, -1.956682101260853E+00, 9.972233008416181E-01, -1.956682101260853E+00, 9.944466016832363E-01 }, /* 1489 Hz */
-    { 9.972214412054443E-01, -1.956627871781734E+00, 9.972214412054443E-01, -1.956627871781734E+00, 9.944428824108886E-01 }, /* 1490 Hz */
-    { 9.972195815761868E-01, -1.956573608978605E+00, 9.972195815761868E-01, -1.956573608978605E+00, 9.944391631523737E-01 }, /* 1491 Hz */
-    { 9.972177219538455E-01, -1.956519312852519E+00, 9.972177219538455E-01, -1.956519312852519E+00, 9.944354439076910E-01 }, /* 1492 Hz */
-    { 9.972158623384205E-01, -1.956464983404531E+00, 9.972158623384205E-01, -1.956464983404531E+00, 9.944317246768410E-01 }, /* 1493 Hz */
-    { 9.972140027299117E-01, -1.956410620635695E+00, 9.972140027299117E-01, -1.956410620635695E+00, 9.944280054598233E-01 }, /* 1494 Hz */
-    { 9.972121431283190E-01, -1.956356224547068E+00, 9.972121431283190E-01, -1.956356224547068E+00, 9.944242862566379E-01 }, /* 1495 Hz */
-    { 9.972102835336427E-01, -1.956301795139705E+00, 9.972102835336427E-01, -1.956301795139705E+00, 9.944205670672854E-01 }, /* 1496 Hz */
-    { 9.972084239458822E-01, -1.956247332414662E+00, 9.972084239458822E-01, -1.956247332414662E+00, 9.944168478917643E-01 }, /* 1497 Hz */
-    { 9.972065643650375E-01, -1.956192836372996E+00, 9.972065643650375E-01, -1.956192836372996E+00, 9.944131287300750E-01 }, /* 1498 Hz */
-    { 9.972047047911090E-01, -1.956138307015766E+00, 9.972047047911090E-01, -1.956138307015766E+00, 9.944094095822180E-01 }, /* 1499 Hz */
-    { 9.972028452240963E-01, -1.956083744344029E+00, 9.972028452240963E-01, -1.956083744344029E+00, 9.944056904481926E-01 }, /* 1500 Hz */
-    { 9.972009856639995E-01, -1.956029148358844E+00, 9.972009856639995E-01, -1.956029148358844E+00, 9.944019713279990E-01 }, /* 1501 Hz */
-    { 9.971991261108186E-01, -1.955974519061271E+00, 9.971991261108186E-01, -1.955974519061271E+00, 9.943982522216372E-01 }, /* 1502 Hz */
-    { 9.971972665645533E-01, -1.955919856452369E+00, 9.971972665645533E-01, -1.955919856452369E+00, 9.943945331291066E-01 }, /* 1503 Hz */
-    { 9.971954070252038E-01, -1.955865160533198E+00, 9.971954070252038E-01, -1.955865160533198E+00, 9.943908140504076E-01 }, /* 1504 Hz */
-    { 9.971935474927699E-01, -1.955810431304820E+00, 9.971935474927699E-01, -1.955810431304820E+00, 9.943870949855398E-01 }, /* 1505 Hz */
-    { 9.971916879672515E-01, -1.955755668768297E+00, 9.971916879672515E-01, -1.955755668768297E+00, 9.943833759345031E-01 }, /* 1506 Hz */
-    { 9.971898284486488E-01, -1.955700872924691E+00, 9.971898284486488E-01, -1.955700872924691E+00, 9.943796568972976E-01 }, /* 1507 Hz */
-    { 9.971879689369615E-01, -1.955646043775063E+00, 9.971879689369615E-01, -1.955646043775063E+00, 9.943759378739230E-01 }, /* 1508 Hz */
-    { 9.971861094321895E-01, -1.955591181320478E+00, 9.971861094321895E-01, -1.955591181320478E+00, 9.943722188643791E-01 }, /* 1509 Hz */
-    { 9.971842499343330E-01, -1.955536285561999E+00, 9.971842499343330E-01, -1.955536285561999E+00, 9.943684998686659E-01 }, /* 1510 Hz */
-    { 9.971823904433917E-01, -1.955481356500691E+00, 9.971823904433917E-01, -1.955481356500691E+00, 9.943647808867835E-01 }, /* 1511 Hz */
-    { 9.971805309593658E-01, -1.955426394137620E+00, 9.971805309593658E-01, -1.955426394137620E+00, 9.943610619187315E-01 }, /* 1512 Hz */
-    { 9.971786714822550E-01, -1.955371398473849E+00, 9.971786714822550E-01, -1.955371398473849E+00, 9.943573429645101E-01 }, /* 1513 Hz */
-    { 9.971768120120598E-01, -1.955316369510447E+00, 9.971768120120598E-01, -1.955316369510447E+00, 9.943536240241195E-01 }, /* 1514 Hz */
-    { 9.971749525487792E-01, -1.955261307248477E+00, 9.971749525487792E-01, -1.955261307248477E+00, 9.943499050975584E-01 }, /* 1515 Hz */
-    { 9.971730930924140E-01, -1.955206211689010E+00, 9.971730930924140E-01, -1.955206211689010E+00, 9.943461861848280E-01 }, /* 1516 Hz */
-    { 9.971712336429636E-01, -1.955151082833112E+00, 9.971712336429636E-01, -1.955151082833112E+00, 9.943424672859271E-01 }, /* 1517 Hz */
-    { 9.971693742004282E-01, -1.955095920681851E+00, 9.971693742004282E-01, -1.955095920681851E+00, 9.943387484008563E-01 }, /* 1518 Hz */
-    { 9.971675147648079E-01, -1.955040725236298E+00, 9.971675147648079E-01, -1.955040725236298E+00, 9.943350295296158E-01 }, /* 1519 Hz */
-    { 9.971656553361024E-01, -1.954985496497520E+00, 9.971656553361024E-01, -1.954985496497520E+00, 9.943313106722047E-01 }, /* 1520 Hz */
-    { 9.971637959143116E-01, -1.954930234466589E+00, 9.971637959143116E-01, -1.954930234466589E+00, 9.943275918286232E-01 }, /* 1521 Hz */
-    { 9.971619364994356E-01, -1.954874939144574E+00, 9.971619364994356E-01, -1.954874939144574E+00, 9.943238729988713E-01 }, /* 1522 Hz */
-    { 9.971600770914744E-01, -1.954819610532548E+00, 9.971600770914744E-01, -1.954819610532548E+00, 9.943201541829487E-01 }, /* 1523 Hz */
-    { 9.971582176904278E-01, -1.954764248631581E+00, 9.971582176904278E-01, -1.954764248631581E+00, 9.943164353808556E-01 }, /* 1524 Hz */
-    { 9.971563582962958E-01, -1.954708853442747E+00, 9.971563582962958E-01, -1.954708853442747E+00, 9.943127165925916E-01 }, /* 1525 Hz */
-    { 9.971544989090784E-01, -1.954653424967118E+00, 9.971544989090784E-01, -1.954653424967118E+00, 9.943089978181567E-01 }, /* 1526 Hz */
-    { 9.971526395287753E-01, -1.954597963205767E+00, 9.971526395287753E-01, -1.954597963205767E+00, 9.943052790575506E-01 }, /* 1527 Hz */
-    { 9.971507801553867E-01, -1.954542468159769E+00, 9.971507801553867E-01, -1.954542468159769E+00, 9.943015603107734E-01 }, /* 1528 Hz */
-    { 9.971489207889128E-01, -1.954486939830198E+00, 9.971489207889128E-01, -1.954486939830198E+00, 9.942978415778256E-01 }, /* 1529 Hz */
-    { 9.971470614293531E-01, -1.954431378218130E+00, 9.971470614293531E-01, -1.954431378218130E+00, 9.942941228587061E-01 }, /* 1530 Hz */
-    { 9.971452020767075E-01, -1.954375783324640E+00, 9.971452020767075E-01, -1.954375783324640E+00, 9.942904041534151E-01 }, /* 1531 Hz */
-    { 9.971433427309764E-01, -1.954320155150805E+00, 9.971433427309764E-01, -1.954320155150805E+00, 9.942866854619528E-01 }, /* 1532 Hz */
-    { 9.971414833921592E-01, -1.954264493697700E+00, 9.971414833921592E-01, -1.954264493697700E+00, 9.942829667843185E-01 }, /* 1533 Hz */
-    { 9.971396240602565E-01, -1.954208798966405E+00, 9.971396240602565E-01, -1.954208798966405E+00, 9.942792481205129E-01 }, /* 1534 Hz */
-    { 9.971377647352677E-01, -1.954153070957997E+00, 9.971377647352677E-01, -1.954153070957997E+00, 9.942755294705354E-01 }, /* 1535 Hz */
-    { 9.971359054171931E-01, -1.954097309673554E+00, 9.971359054171931E-01, -1.954097309673554E+00, 9.942718108343862E-01 }, /* 1536 Hz */
-    { 9.971340461060323E-01, -1.954041515114156E+00, 9.971340461060323E-01, -1.954041515114156E+00, 9.942680922120646E-01 }, /* 1537 Hz */
-    { 9.971321868017853E-01, -1.953985687280881E+00, 9.971321868017853E-01, -1.953985687280881E+00, 9.942643736035706E-01 }, /* 1538 Hz */
-    { 9.971303275044524E-01, -1.953929826174812E+00, 9.971303275044524E-01, -1.953929826174812E+00, 9.942606550089048E-01 }, /* 1539 Hz */
-    { 9.971284682140334E-01, -1.953873931797028E+00, 9.971284682140334E-01, -1.953873931797028E+00, 9.942569364280669E-01 }, /* 1540 Hz */
-    { 9.971266089305280E-01, -1.953818004148610E+00, 9.971266089305280E-01, -1.953818004148610E+00, 9.942532178610559E-01 }, /* 1541 Hz */
-    { 9.971247496539364E-01, -1.953762043230641E+00, 9.971247496539364E-01, -1.953762043230641E+00, 9.942494993078728E-01 }, /* 1542 Hz */
-    { 9.971228903842585E-01, -1.953706049044204E+00, 9.971228903842585E-01, -1.953706049044204E+00, 9.942457807685170E-01 }, /* 1543 Hz */
-    { 9.971210311214944E-01, -1.953650021590381E+00, 9.971210311214944E-01, -1.953650021590381E+00, 9.942420622429888E-01 }, /* 1544 Hz */
-    { 9.971191718656436E-01, -1.953593960870256E+00, 9.971191718656436E-01, -1.953593960870256E+00, 9.942383437312872E-01 }, /* 1545 Hz */
-    { 9.971173126167063E-01, -1.953537866884913E+00, 9.971173126167063E-01, -1.953537866884913E+00, 9.942346252334127E-01 }, /* 1546 Hz */
-    { 9.971154533746827E-01, -1.953481739635437E+00, 9.971154533746827E-01, -1.953481739635437E+00, 9.942309067493653E-01 }, /* 1547 Hz */
-    { 9.971135941395723E-01, -1.953425579122914E+00, 9.971135941395723E-01, -1.953425579122914E+00, 9.942271882791447E-01 }, /* 1548 Hz */
-    { 9.971117349113754E-01, -1.953369385348429E+00, 9.971117349113754E-01, -1.953369385348429E+00, 9.942234698227508E-01 }, /* 1549 Hz */
-    { 9.971098756900919E-01, -1.953313158313069E+00, 9.971098756900919E-01, -1.953313158313069E+00, 9.942197513801838E-01 }, /* 1550 Hz */
-    { 9.971080164757214E-01, -1.953256898017921E+00, 9.971080164757214E-01, -1.953256898017921E+00, 9.942160329514429E-01 }, /* 1551 Hz */
-    { 9.971061572682643E-01, -1.953200604464072E+00, 9.971061572682643E-01, -1.953200604464072E+00, 9.942123145365287E-01 }, /* 1552 Hz */
-    { 9.971042980677205E-01, -1.953144277652612E+00, 9.971042980677205E-01, -1.953144277652612E+00, 9.942085961354410E-01 }, /* 1553 Hz */
-    { 9.971024388740896E-01, -1.953087917584627E+00, 9.971024388740896E-01, -1.953087917584627E+00, 9.942048777481791E-01 }, /* 1554 Hz */
-    { 9.971005796873719E-01, -1.953031524261208E+00, 9.971005796873719E-01, -1.953031524261208E+00, 9.942011593747437E-01 }, /* 1555 Hz */
-    { 9.970987205075671E-01, -1.952975097683445E+00, 9.970987205075671E-01, -1.952975097683445E+00, 9.941974410151342E-01 }, /* 1556 Hz */
-    { 9.970968613346751E-01, -1.952918637852428E+00, 9.970968613346751E-01, -1.952918637852428E+00, 9.941937226693502E-01 }, /* 1557 Hz */
-    { 9.970950021686963E-01, -1.952862144769248E+00, 9.970950021686963E-01, -1.952862144769248E+00, 9.941900043373926E-01 }, /* 1558 Hz */
-    { 9.970931430096303E-01, -1.952805618434997E+00, 9.970931430096303E-01, -1.952805618434997E+00, 9.941862860192605E-01 }, /* 1559 Hz */
-    { 9.970912838574770E-01, -1.952749058850767E+00, 9.970912838574770E-01, -1.952749058850767E+00, 9.941825677149541E-01 }, /* 1560 Hz */
-    { 9.970894247122365E-01, -1.952692466017650E+00, 9.970894247122365E-01, -1.952692466017650E+00, 9.941788494244730E-01 }, /* 1561 Hz */
-    { 9.970875655739085E-01, -1.952635839936740E+00, 9.970875655739085E-01, -1.952635839936740E+00, 9.941751311478171E-01 }, /* 1562 Hz */
-    { 9.970857064424934E-01, -1.952579180609131E+00, 9.970857064424934E-01, -1.952579180609131E+00, 9.941714128849868E-01 }, /* 1563 Hz */
-    { 9.970838473179909E-01, -1.952522488035917E+00, 9.970838473179909E-01, -1.952522488035917E+00, 9.941676946359819E-01 }, /* 1564 Hz */
-    { 9.970819882004009E-01, -1.952465762218193E+00, 9.970819882004009E-01, -1.952465762218193E+00, 9.941639764008019E-01 }, /* 1565 Hz */
-    { 9.970801290897232E-01, -1.952409003157054E+00, 9.970801290897232E-01, -1.952409003157054E+00, 9.941602581794464E-01 }, /* 1566 Hz */
-    { 9.970782699859582E-01, -1.952352210853598E+00, 9.970782699859582E-01, -1.952352210853598E+00, 9.941565399719163E-01 }, /* 1567 Hz */
-    { 9.970764108891054E-01, -1.952295385308919E+00, 9.970764108891054E-01, -1.952295385308919E+00, 9.941528217782107E-01 }, /* 1568 Hz */
-    { 9.970745517991650E-01, -1.952238526524116E+00, 9.970745517991650E-01, -1.952238526524116E+00, 9.941491035983301E-01 }, /* 1569 Hz */
-    { 9.970726927161370E-01, -1.952181634500287E+00, 9.970726927161370E-01, -1.952181634500287E+00, 9.941453854322739E-01 }, /* 1570 Hz */
-    { 9.970708336400211E-01, -1.952124709238529E+00, 9.970708336400211E-01, -1.952124709238529E+00, 9.941416672800423E-01 }, /* 1571 Hz */
-    { 9.970689745708176E-01, -1.952067750739942E+00, 9.970689745708176E-01, -1.952067750739942E+00, 9.941379491416351E-01 }, /* 1572 Hz */
-    { 9.970671155085260E-01, -1.952010759005625E+00, 9.970671155085260E-01, -1.952010759005625E+00, 9.941342310170520E-01 }, /* 1573 Hz */
-    { 9.970652564531465E-01, -1.951953734036679E+00, 9.970652564531465E-01, -1.951953734036679E+00, 9.941305129062930E-01 }, /* 1574 Hz */
-    { 9.970633974046792E-01, -1.951896675834203E+00, 9.970633974046792E-01, -1.951896675834203E+00, 9.941267948093584E-01 }, /* 1575 Hz */
-    { 9.970615383631235E-01, -1.951839584399299E+00, 9.970615383631235E-01, -1.951839584399299E+00, 9.941230767262470E-01 }, /* 1576 Hz */
-    { 9.970596793284802E-01, -1.951782459733069E+00, 9.970596793284802E-01, -1.951782459733069E+00, 9.941193586569603E-01 }, /* 1577 Hz */
-    { 9.970578203007485E-01, -1.951725301836615E+00, 9.970578203007485E-01, -1.951725301836615E+00, 9.941156406014970E-01 }, /* 1578 Hz */
-    { 9.970559612799287E-01, -1.951668110711041E+00, 9.970559612799287E-01, -1.951668110711041E+00, 9.941119225598574E-01 }, /* 1579 Hz */
-    { 9.970541022660205E-01, -1.951610886357448E+00, 9.970541022660205E-01, -1.951610886357448E+00, 9.941082045320411E-01 }, /* 1580 Hz */
-    { 9.970522432590242E-01, -1.951553628776942E+00, 9.970522432590242E-01, -1.951553628776942E+00, 9.941044865180484E-01 }, /* 1581 Hz */
-    { 9.970503842589395E-01, -1.951496337970626E+00, 9.970503842589395E-01, -1.951496337970626E+00, 9.941007685178791E-01 }, /* 1582 Hz */
-    { 9.970485252657665E-01, -1.951439013939607E+00, 9.970485252657665E-01, -1.951439013939607E+00, 9.940970505315330E-01 }, /* 1583 Hz */
-    { 9.970466662795051E-01, -1.951381656684991E+00, 9.970466662795051E-01, -1.951381656684991E+00, 9.940933325590102E-01 }, /* 1584 Hz */
-    { 9.970448073001550E-01, -1.951324266207881E+00, 9.970448073001550E-01, -1.951324266207881E+00, 9.940896146003100E-01 }, /* 1585 Hz */
-    { 9.970429483277166E-01, -1.951266842509387E+00, 9.970429483277166E-01, -1.951266842509387E+00, 9.940858966554331E-01 }, /* 1586 Hz */
-    { 9.970410893621893E-01, -1.951209385590615E+00, 9.970410893621893E-01, -1.951209385590615E+00, 9.940821787243785E-01 }, /* 1587 Hz */
-    { 9.970392304035736E-01, -1.951151895452674E+00, 9.970392304035736E-01, -1.951151895452674E+00, 9.940784608071471E-01 }, /* 1588 Hz */
-    { 9.970373714518692E-01, -1.951094372096672E+00, 9.970373714518692E-01, -1.951094372096672E+00, 9.940747429037384E-01 }, /* 1589 Hz */
-    { 9.970355125070760E-01, -1.951036815523717E+00, 9.970355125070760E-01, -1.951036815523717E+00, 9.940710250141520E-01 }, /* 1590 Hz */
-    { 9.970336535691940E-01, -1.950979225734920E+00, 9.970336535691940E-01, -1.950979225734920E+00, 9.940673071383881E-01 }, /* 1591 Hz */
-    { 9.970317946382232E-01, -1.950921602731390E+00, 9.970317946382232E-01, -1.950921602731390E+00, 9.940635892764464E-01 }, /* 1592 Hz */
-    { 9.970299357141633E-01, -1.950863946514239E+00, 9.970299357141633E-01, -1.950863946514239E+00, 9.940598714283266E-01 }, /* 1593 Hz */
-    { 9.970280767970147E-01, -1.950806257084578E+00, 9.970280767970147E-01, -1.950806257084578E+00, 9.940561535940293E-01 }, /* 1594 Hz */
-    { 9.970262178867769E-01, -1.950748534443519E+00, 9.970262178867769E-01, -1.950748534443519E+00, 9.940524357735538E-01 }, /* 1595 Hz */
-    { 9.970243589834504E-01, -1.950690778592175E+00, 9.970243589834504E-01, -1.950690778592175E+00, 9.940487179669009E-01 }, /* 1596 Hz */
-    { 9.970225000870345E-01, -1.950632989531658E+00, 9.970225000870345E-01, -1.950632989531658E+00, 9.940450001740690E-01 }, /* 1597 Hz */
-    { 9.970206411975295E-01, -1.950575167263082E+00, 9.970206411975295E-01, -1.950575167263082E+00, 9.940412823950591E-01 }, /* 1598 Hz */
-    { 9.970187823149353E-01, -1.950517311787560E+00, 9.970187823149353E-01, -1.950517311787560E+00, 9.940375646298707E-01 }, /* 1599 Hz */
-    { 9.970169234392517E-01, -1.950459423106209E+00, 9.970169234392517E-01, -1.950459423106209E+00, 9.940338468785035E-01 }, /* 1600 Hz */
-    { 9.970150645704791E-01, -1.950401501220143E+00, 9.970150645704791E-01, -1.950401501220143E+00, 9.940301291409581E-01 }, /* 1601 Hz */
-    { 9.970132057086168E-01, -1.950343546130478E+00, 9.970132057086168E-01, -1.950343546130478E+00, 9.940264114172337E-01 }, /* 1602 Hz */
-    { 9.970113468536653E-01, -1.950285557838330E+00, 9.970113468536653E-01, -1.950285557838330E+00, 9.940226937073307E-01 }, /* 1603 Hz */
-    { 9.970094880056242E-01, -1.950227536344817E+00, 9.970094880056242E-01, -1.950227536344817E+00, 9.940189760112483E-01 }, /* 1604 Hz */
-    { 9.970076291644936E-01, -1.950169481651056E+00, 9.970076291644936E-01, -1.950169481651056E+00, 9.940152583289872E-01 }, /* 1605 Hz */
-    { 9.970057703302736E-01, -1.950111393758166E+00, 9.970057703302736E-01, -1.950111393758166E+00, 9.940115406605472E-01 }, /* 1606 Hz */
-    { 9.970039115029640E-01, -1.950053272667264E+00, 9.970039115029640E-01, -1.950053272667264E+00, 9.940078230059279E-01 }, /* 1607 Hz */
-    { 9.970020526825645E-01, -1.949995118379470E+00, 9.970020526825645E-01, -1.949995118379470E+00, 9.940041053651290E-01 }, /* 1608 Hz */
-    { 9.970001938690752E-01, -1.949936930895904E+00, 9.970001938690752E-01, -1.949936930895904E+00, 9.940003877381505E-01 }, /* 1609 Hz */
-    { 9.969983350624964E-01, -1.949878710217686E+00, 9.969983350624964E-01, -1.949878710217686E+00, 9.939966701249927E-01 }, /* 1610 Hz */
-    { 9.969964762628277E-01, -1.949820456345938E+00, 9.969964762628277E-01, -1.949820456345938E+00, 9.939929525256554E-01 }, /* 1611 Hz */
-    { 9.969946174700691E-01, -1.949762169281780E+00, 9.969946174700691E-01, -1.949762169281780E+00, 9.939892349401382E-01 }, /* 1612 Hz */
-    { 9.969927586842205E-01, -1.949703849026335E+00, 9.969927586842205E-01, -1.949703849026335E+00, 9.939855173684411E-01 }, /* 1613 Hz */
-    { 9.969908999052820E-01, -1.949645495580725E+00, 9.969908999052820E-01, -1.949645495580725E+00, 9.939817998105640E-01 }, /* 1614 Hz */
-    { 9.969890411332535E-01, -1.949587108946075E+00, 9.969890411332535E-01, -1.949587108946075E+00, 9.939780822665070E-01 }, /* 1615 Hz */
-    { 9.969871823681349E-01, -1.949528689123506E+00, 9.969871823681349E-01, -1.949528689123506E+00, 9.939743647362698E-01 }, /* 1616 Hz */
-    { 9.969853236099259E-01, -1.949470236114144E+00, 9.969853236099259E-01, -1.949470236114144E+00, 9.939706472198517E-01 }, /* 1617 Hz */
-    { 9.969834648586271E-01, -1.949411749919114E+00, 9.969834648586271E-01, -1.949411749919114E+00, 9.939669297172542E-01 }, /* 1618 Hz */
-    { 9.969816061142378E-01, -1.949353230539541E+00, 9.969816061142378E-01, -1.949353230539541E+00, 9.939632122284756E-01 }, /* 1619 Hz */
-    { 9.969797473767584E-01, -1.949294677976552E+00, 9.969797473767584E-01, -1.949294677976552E+00, 9.939594947535169E-01 }, /* 1620 Hz */
-    { 9.969778886461884E-01, -1.949236092231271E+00, 9.969778886461884E-01, -1.949236092231271E+00, 9.939557772923768E-01 }, /* 1621 Hz */
-    { 9.969760299225282E-01, -1.949177473304828E+00, 9.969760299225282E-01, -1.949177473304828E+00, 9.939520598450564E-01 }, /* 1622 Hz */
-    { 9.969741712057775E-01, -1.949118821198349E+00, 9.969741712057775E-01, -1.949118821198349E+00, 9.939483424115549E-01 }, /* 1623 Hz */
-    { 9.969723124959364E-01, -1.949060135912963E+00, 9.969723124959364E-01, -1.949060135912963E+00, 9.939446249918729E-01 }, /* 1624 Hz */
-    { 9.969704537930046E-01, -1.949001417449799E+00, 9.969704537930046E-01, -1.949001417449799E+00, 9.939409075860093E-01 }, /* 1625 Hz */
-    { 9.969685950969822E-01, -1.948942665809985E+00, 9.969685950969822E-01, -1.948942665809985E+00, 9.939371901939644E-01 }, /* 1626 Hz */
-    { 9.969667364078694E-01, -1.948883880994653E+00, 9.969667364078694E-01, -1.948883880994653E+00, 9.939334728157387E-01 }, /* 1627 Hz */
-    { 9.969648777256657E-01, -1.948825063004933E+00, 9.969648777256657E-01, -1.948825063004933E+00, 9.939297554513313E-01 }, /* 1628 Hz */
-    { 9.969630190503713E-01, -1.948766211841955E+00, 9.969630190503713E-01, -1.948766211841955E+00, 9.939260381007426E-01 }, /* 1629 Hz */
-    { 9.969611603819861E-01, -1.948707327506851E+00, 9.969611603819861E-01, -1.948707327506851E+00, 9.939223207639722E-01 }, /* 1630 Hz */
-    { 9.969593017205097E-01, -1.948648410000754E+00, 9.969593017205097E-01, -1.948648410000754E+00, 9.939186034410195E-01 }, /* 1631 Hz */
-    { 9.969574430659428E-01, -1.948589459324796E+00, 9.969574430659428E-01, -1.948589459324796E+00, 9.939148861318856E-01 }, /* 1632 Hz */
-    { 9.969555844182849E-01, -1.948530475480111E+00, 9.969555844182849E-01, -1.948530475480111E+00, 9.939111688365698E-01 }, /* 1633 Hz */
-    { 9.969537257775360E-01, -1.948471458467833E+00, 9.969537257775360E-01, -1.948471458467833E+00, 9.939074515550721E-01 }, /* 1634 Hz */
-    { 9.969518671436959E-01, -1.948412408289095E+00, 9.969518671436959E-01, -1.948412408289095E+00, 9.939037342873918E-01 }, /* 1635 Hz */
-    { 9.969500085167647E-01, -1.948353324945034E+00, 9.969500085167647E-01, -1.948353324945034E+00, 9.939000170335295E-01 }, /* 1636 Hz */
-    { 9.969481498967423E-01, -1.948294208436784E+00, 9.969481498967423E-01, -1.948294208436784E+00, 9.938962997934846E-01 }, /* 1637 Hz */
-    { 9.969462912836289E-01, -1.948235058765482E+00, 9.969462912836289E-01, -1.948235058765482E+00, 9.938925825672578E-01 }, /* 1638 Hz */
-    { 9.969444326774239E-01, -1.948175875932265E+00, 9.969444326774239E-01, -1.948175875932265E+00, 9.938888653548479E-01 }, /* 1639 Hz */
-    { 9.969425740781279E-01, -1.948116659938270E+00, 9.969425740781279E-01, -1.948116659938270E+00, 9.938851481562558E-01 }, /* 1640 Hz */
-    { 9.969407154857403E-01, -1.948057410784634E+00, 9.969407154857403E-01, -1.948057410784634E+00, 9.938814309714805E-01 }, /* 1641 Hz */
-    { 9.969388569002614E-01, -1.947998128472497E+00, 9.969388569002614E-01, -1.947998128472497E+00, 9.938777138005228E-01 }, /* 1642 Hz */
-    { 9.969369983216909E-01, -1.947938813002996E+00, 9.969369983216909E-01, -1.947938813002996E+00, 9.938739966433818E-01 }, /* 1643 Hz */
-    { 9.969351397500291E-01, -1.947879464377273E+00, 9.969351397500291E-01, -1.947879464377273E+00, 9.938702795000582E-01 }, /* 1644 Hz */
-    { 9.969332811852757E-01, -1.947820082596467E+00, 9.969332811852757E-01, -1.947820082596467E+00, 9.938665623705514E-01 }, /* 1645 Hz */
-    { 9.969314226274303E-01, -1.947760667661717E+00, 9.969314226274303E-01, -1.947760667661717E+00, 9.938628452548606E-01 }, /* 1646 Hz */
-    { 9.969295640764936E-01, -1.947701219574167E+00, 9.969295640764936E-01, -1.947701219574167E+00, 9.938591281529872E-01 }, /* 1647 Hz */
-    { 9.969277055324650E-01, -1.947641738334957E+00, 9.969277055324650E-01, -1.947641738334957E+00, 9.938554110649300E-01 }, /* 1648 Hz */
-    { 9.969258469953447E-01, -1.947582223945230E+00, 9.969258469953447E-01, -1.947582223945230E+00, 9.938516939906894E-01 }, /* 1649 Hz */
-    { 9.969239884651324E-01, -1.947522676406129E+00, 9.969239884651324E-01, -1.947522676406129E+00, 9.938479769302648E-01 }, /* 1650 Hz */
-    { 9.969221299418285E-01, -1.947463095718797E+00, 9.969221299418285E-01, -1.947463095718797E+00, 9.938442598836570E-01 }, /* 1651 Hz */
-    { 9.969202714254324E-01, -1.947403481884379E+00, 9.969202714254324E-01, -1.947403481884379E+00, 9.938405428508648E-01 }, /* 1652 Hz */
-    { 9.969184129159444E-01, -1.947343834904018E+00, 9.969184129159444E-01, -1.947343834904018E+00, 9.938368258318888E-01 }, /* 1653 Hz */
-    { 9.969165544133642E-01, -1.947284154778861E+00, 9.969165544133642E-01, -1.947284154778861E+00, 9.938331088267285E-01 }, /* 1654 Hz */
-    { 9.969146959176921E-01, -1.947224441510052E+00, 9.969146959176921E-01, -1.947224441510052E+00, 9.938293918353842E-01 }, /* 1655 Hz */
-    { 9.969128374289279E-01, -1.947164695098739E+00, 9.969128374289279E-01, -1.947164695098739E+00, 9.938256748578558E-01 }, /* 1656 Hz */
-    { 9.969109789470715E-01, -1.947104915546068E+00, 9.969109789470715E-01, -1.947104915546068E+00, 9.938219578941430E-01 }, /* 1657 Hz */
-    { 9.969091204721227E-01, -1.947045102853187E+00, 9.969091204721227E-01, -1.947045102853187E+00, 9.938182409442453E-01 }, /* 1658 Hz */
-    { 9.969072620040816E-01, -1.946985257021243E+00, 9.969072620040816E-01, -1.946985257021243E+00, 9.938145240081633E-01 }, /* 1659 Hz */
-    { 9.969054035429482E-01, -1.946925378051385E+00, 9.969054035429482E-01, -1.946925378051385E+00, 9.938108070858964E-01 }, /* 1660 Hz */
-    { 9.969035450887224E-01, -1.946865465944762E+00, 9.969035450887224E-01, -1.946865465944762E+00, 9.938070901774447E-01 }, /* 1661 Hz */
-    { 9.969016866414042E-01, -1.946805520702525E+00, 9.969016866414042E-01, -1.946805520702525E+00, 9.938033732828084E-01 }, /* 1662 Hz */
-    { 9.968998282009933E-01, -1.946745542325822E+00, 9.968998282009933E-01, -1.946745542325822E+00, 9.937996564019866E-01 }, /* 1663 Hz */
-    { 9.968979697674901E-01, -1.946685530815806E+00, 9.968979697674901E-01, -1.946685530815806E+00, 9.937959395349802E-01 }, /* 1664 Hz */
-    { 9.968961113408943E-01, -1.946625486173626E+00, 9.968961113408943E-01, -1.946625486173626E+00, 9.937922226817886E-01 }, /* 1665 Hz */
-    { 9.968942529212056E-01, -1.946565408400436E+00, 9.968942529212056E-01, -1.946565408400436E+00, 9.937885058424112E-01 }, /* 1666 Hz */
-    { 9.968923945084244E-01, -1.946505297497388E+00, 9.968923945084244E-01, -1.946505297497388E+00, 9.937847890168487E-01 }, /* 1667 Hz */
-    { 9.968905361025503E-01, -1.946445153465635E+00, 9.968905361025503E-01, -1.946445153465635E+00, 9.937810722051006E-01 }, /* 1668 Hz */
-    { 9.968886777035835E-01, -1.946384976306330E+00, 9.968886777035835E-01, -1.946384976306330E+00, 9.937773554071669E-01 }, /* 1669 Hz */
-    { 9.968868193115238E-01, -1.946324766020628E+00, 9.968868193115238E-01, -1.946324766020628E+00, 9.937736386230476E-01 }, /* 1670 Hz */
-    { 9.968849609263710E-01, -1.946264522609683E+00, 9.968849609263710E-01, -1.946264522609683E+00, 9.937699218527420E-01 }, /* 1671 Hz */
-    { 9.968831025481254E-01, -1.946204246074651E+00, 9.968831025481254E-01, -1.946204246074651E+00, 9.937662050962508E-01 }, /* 1672 Hz */
-    { 9.968812441767867E-01, -1.946143936416687E+00, 9.968812441767867E-01, -1.946143936416687E+00, 9.937624883535734E-01 }, /* 1673 Hz */
-    { 9.968793858123550E-01, -1.946083593636949E+00, 9.968793858123550E-01, -1.946083593636949E+00, 9.937587716247100E-01 }, /* 1674 Hz */
-    { 9.968775274548302E-01, -1.946023217736592E+00, 9.968775274548302E-01, -1.946023217736592E+00, 9.937550549096603E-01 }, /* 1675 Hz */
-    { 9.968756691042122E-01, -1.945962808716776E+00, 9.968756691042122E-01, -1.945962808716776E+00, 9.937513382084244E-01 }, /* 1676 Hz */
-    { 9.968738107605010E-01, -1.945902366578657E+00, 9.968738107605010E-01, -1.945902366578657E+00, 9.937476215210019E-01 }, /* 1677 Hz */
-    { 9.968719524236964E-01, -1.945841891323394E+00, 9.968719524236964E-01, -1.945841891323394E+00, 9.937439048473928E-01 }, /* 1678 Hz */
-    { 9.968700940937985E-01, -1.945781382952147E+00, 9.968700940937985E-01, -1.945781382952147E+00, 9.937401881875969E-01 }, /* 1679 Hz */
-    { 9.968682357708074E-01, -1.945720841466076E+00, 9.968682357708074E-01, -1.945720841466076E+00, 9.937364715416148E-01 }, /* 1680 Hz */
-    { 9.968663774547226E-01, -1.945660266866341E+00, 9.968663774547226E-01, -1.945660266866341E+00, 9.937327549094452E-01 }, /* 1681 Hz */
-    { 9.968645191455445E-01, -1.945599659154102E+00, 9.968645191455445E-01, -1.945599659154102E+00, 9.937290382910891E-01 }, /* 1682 Hz */
-    { 9.968626608432728E-01, -1.945539018330522E+00, 9.968626608432728E-01, -1.945539018330522E+00, 9.937253216865456E-01 }, /* 1683 Hz */
-    { 9.968608025479074E-01, -1.945478344396762E+00, 9.968608025479074E-01, -1.945478344396762E+00, 9.937216050958149E-01 }, /* 1684 Hz */
-    { 9.968589442594485E-01, -1.945417637353985E+00, 9.968589442594485E-01, -1.945417637353985E+00, 9.937178885188971E-01 }, /* 1685 Hz */
-    { 9.968570859778960E-01, -1.945356897203355E+00, 9.968570859778960E-01, -1.945356897203355E+00, 9.937141719557920E-01 }, /* 1686 Hz */
-    { 9.968552277032495E-01, -1.945296123946034E+00, 9.968552277032495E-01, -1.945296123946034E+00, 9.937104554064990E-01 }, /* 1687 Hz */
-    { 9.968533694355095E-01, -1.945235317583188E+00, 9.968533694355095E-01, -1.945235317583188E+00, 9.937067388710190E-01 }, /* 1688 Hz */
-    { 9.968515111746754E-01, -1.945174478115981E+00, 9.968515111746754E-01, -1.945174478115981E+00, 9.937030223493508E-01 }, /* 1689 Hz */
-    { 9.968496529207477E-01, -1.945113605545579E+00, 9.968496529207477E-01, -1.945113605545579E+00, 9.936993058414954E-01 }, /* 1690 Hz */
-    { 9.968477946737258E-01, -1.945052699873147E+00, 9.968477946737258E-01, -1.945052699873147E+00, 9.936955893474515E-01 }, /* 1691 Hz */
-    { 9.968459364336099E-01, -1.944991761099853E+00, 9.968459364336099E-01, -1.944991761099853E+00, 9.936918728672197E-01 }, /* 1692 Hz */
-    { 9.968440782004001E-01, -1.944930789226863E+00, 9.968440782004001E-01, -1.944930789226863E+00, 9.936881564008002E-01 }, /* 1693 Hz */
-    { 9.968422199740959E-01, -1.944869784255344E+00, 9.968422199740959E-01, -1.944869784255344E+00, 9.936844399481919E-01 }, /* 1694 Hz */
-    { 9.968403617546978E-01, -1.944808746186466E+00, 9.968403617546978E-01, -1.944808746186466E+00, 9.936807235093956E-01 }, /* 1695 Hz */
-    { 9.968385035422055E-01, -1.944747675021398E+00, 9.968385035422055E-01, -1.944747675021398E+00, 9.936770070844110E-01 }, /* 1696 Hz */
-    { 9.968366453366190E-01, -1.944686570761307E+00, 9.968366453366190E-01, -1.944686570761307E+00, 9.936732906732380E-01 }, /* 1697 Hz */
-    { 9.968347871379380E-01, -1.944625433407366E+00, 9.968347871379380E-01, -1.944625433407366E+00, 9.936695742758761E-01 }, /* 1698 Hz */
-    { 9.968329289461627E-01, -1.944564262960743E+00, 9.968329289461627E-01, -1.944564262960743E+00, 9.936658578923254E-01 }, /* 1699 Hz */
-    { 9.968310707612930E-01, -1.944503059422610E+00, 9.968310707612930E-01, -1.944503059422610E+00, 9.936621415225859E-01 }, /* 1700 Hz */
-    { 9.968292125833288E-01, -1.944441822794139E+00, 9.968292125833288E-01, -1.944441822794139E+00, 9.936584251666576E-01 }, /* 1701 Hz */
-    { 9.968273544122702E-01, -1.944380553076501E+00, 9.968273544122702E-01, -1.944380553076501E+00, 9.936547088245404E-01 }, /* 1702 Hz */
-    { 9.968254962481170E-01, -1.944319250270870E+00, 9.968254962481170E-01, -1.944319250270870E+00, 9.936509924962340E-01 }, /* 1703 Hz */
-    { 9.968236380908692E-01, -1.944257914378419E+00, 9.968236380908692E-01, -1.944257914378419E+00, 9.936472761817383E-01 }, /* 1704 Hz */
-    { 9.968217799405267E-01, -1.944196545400322E+00, 9.968217799405267E-01, -1.944196545400322E+00, 9.936435598810534E-01 }, /* 1705 Hz */
-    { 9.968199217970893E-01, -1.944135143337753E+00, 9.968199217970893E-01, -1.944135143337753E+00, 9.936398435941787E-01 }, /* 1706 Hz */
-    { 9.968180636605573E-01, -1.944073708191887E+00, 9.968180636605573E-01, -1.944073708191887E+00, 9.936361273211145E-01 }, /* 1707 Hz */
-    { 9.968162055309305E-01, -1.944012239963900E+00, 9.968162055309305E-01, -1.944012239963900E+00, 9.936324110618611E-01 }, /* 1708 Hz */
-    { 9.968143474082088E-01, -1.943950738654968E+00, 9.968143474082088E-01, -1.943950738654968E+00, 9.936286948164177E-01 }, /* 1709 Hz */
-    { 9.968124892923922E-01, -1.943889204266268E+00, 9.968124892923922E-01, -1.943889204266268E+00, 9.936249785847844E-01 }, /* 1710 Hz */
-    { 9.968106311834805E-01, -1.943827636798976E+00, 9.968106311834805E-01, -1.943827636798976E+00, 9.936212623669609E-01 }, /* 1711 Hz */
-    { 9.968087730814739E-01, -1.943766036254271E+00, 9.968087730814739E-01, -1.943766036254271E+00, 9.936175461629477E-01 }, /* 1712 Hz */
-    { 9.968069149863722E-01, -1.943704402633331E+00, 9.968069149863722E-01, -1.943704402633331E+00, 9.936138299727444E-01 }, /* 1713 Hz */
-    { 9.968050568981753E-01, -1.943642735937334E+00, 9.968050568981753E-01, -1.943642735937334E+00, 9.936101137963507E-01 }, /* 1714 Hz */
-    { 9.968031988168833E-01, -1.943581036167462E+00, 9.968031988168833E-01, -1.943581036167462E+00, 9.936063976337666E-01 }, /* 1715 Hz */
-    { 9.968013407424960E-01, -1.943519303324893E+00, 9.968013407424960E-01, -1.943519303324893E+00, 9.936026814849921E-01 }, /* 1716 Hz */
-    { 9.967994826750135E-01, -1.943457537410807E+00, 9.967994826750135E-01, -1.943457537410807E+00, 9.935989653500270E-01 }, /* 1717 Hz */
-    { 9.967976246144356E-01, -1.943395738426388E+00, 9.967976246144356E-01, -1.943395738426388E+00, 9.935952492288711E-01 }, /* 1718 Hz */
-    { 9.967957665607622E-01, -1.943333906372815E+00, 9.967957665607622E-01, -1.943333906372815E+00, 9.935915331215244E-01 }, /* 1719 Hz */
-    { 9.967939085139936E-01, -1.943272041251272E+00, 9.967939085139936E-01, -1.943272041251272E+00, 9.935878170279873E-01 }, /* 1720 Hz */
-    { 9.967920504741293E-01, -1.943210143062940E+00, 9.967920504741293E-01, -1.943210143062940E+00, 9.935841009482587E-01 }, /* 1721 Hz */
-    { 9.967901924411694E-01, -1.943148211809005E+00, 9.967901924411694E-01, -1.943148211809005E+00, 9.935803848823388E-01 }, /* 1722 Hz */
-    { 9.967883344151142E-01, -1.943086247490649E+00, 9.967883344151142E-01, -1.943086247490649E+00, 9.935766688302283E-01 }, /* 1723 Hz */
-    { 9.967864763959633E-01, -1.943024250109058E+00, 9.967864763959633E-01, -1.943024250109058E+00, 9.935729527919266E-01 }, /* 1724 Hz */
-    { 9.967846183837165E-01, -1.942962219665415E+00, 9.967846183837165E-01, -1.942962219665415E+00, 9.935692367674329E-01 }, /* 1725 Hz */
-    { 9.967827603783739E-01, -1.942900156160908E+00, 9.967827603783739E-01, -1.942900156160908E+00, 9.935655207567478E-01 }, /* 1726 Hz */
-    { 9.967809023799357E-01, -1.942838059596722E+00, 9.967809023799357E-01, -1.942838059596722E+00, 9.935618047598713E-01 }, /* 1727 Hz */
-    { 9.967790443884017E-01, -1.942775929974044E+00, 9.967790443884017E-01, -1.942775929974044E+00, 9.935580887768034E-01 }, /* 1728 Hz */
-    { 9.967771864037716E-01, -1.942713767294061E+00, 9.967771864037716E-01, -1.942713767294061E+00, 9.935543728075431E-01 }, /* 1729 Hz */
-    { 9.967753284260457E-01, -1.942651571557962E+00, 9.967753284260457E-01, -1.942651571557962E+00, 9.935506568520913E-01 }, /* 1730 Hz */
-    { 9.967734704552235E-01, -1.942589342766933E+00, 9.967734704552235E-01, -1.942589342766933E+00, 9.935469409104469E-01 }, /* 1731 Hz */
-    { 9.967716124913055E-01, -1.942527080922167E+00, 9.967716124913055E-01, -1.942527080922167E+00, 9.935432249826111E-01 }, /* 1732 Hz */
-    { 9.967697545342914E-01, -1.942464786024851E+00, 9.967697545342914E-01, -1.942464786024851E+00, 9.935395090685828E-01 }, /* 1733 Hz */
-    { 9.967678965841812E-01, -1.942402458076175E+00, 9.967678965841812E-01, -1.942402458076175E+00, 9.935357931683624E-01 }, /* 1734 Hz */
-    { 9.967660386409745E-01, -1.942340097077331E+00, 9.967660386409745E-01, -1.942340097077331E+00, 9.935320772819489E-01 }, /* 1735 Hz */
-    { 9.967641807046717E-01, -1.942277703029509E+00, 9.967641807046717E-01, -1.942277703029509E+00, 9.935283614093433E-01 }, /* 1736 Hz */
-    { 9.967623227752727E-01, -1.942215275933902E+00, 9.967623227752727E-01, -1.942215275933902E+00, 9.935246455505453E-01 }, /* 1737 Hz */
-    { 9.967604648527770E-01, -1.942152815791701E+00, 9.967604648527770E-01, -1.942152815791701E+00, 9.935209297055541E-01 }, /* 1738 Hz */
-    { 9.967586069371852E-01, -1.942090322604101E+00, 9.967586069371852E-01, -1.942090322604101E+00, 9.935172138743704E-01 }, /* 1739 Hz */
-    { 9.967567490284969E-01, -1.942027796372294E+00, 9.967567490284969E-01, -1.942027796372294E+00, 9.935134980569937E-01 }, /* 1740 Hz */
-    { 9.967548911267119E-01, -1.941965237097474E+00, 9.967548911267119E-01, -1.941965237097474E+00, 9.935097822534238E-01 }, /* 1741 Hz */
-    { 9.967530332318304E-01, -1.941902644780837E+00, 9.967530332318304E-01, -1.941902644780837E+00, 9.935060664636608E-01 }, /* 1742 Hz */
-    { 9.967511753438525E-01, -1.941840019423577E+00, 9.967511753438525E-01, -1.941840019423577E+00, 9.935023506877050E-01 }, /* 1743 Hz */
-    { 9.967493174627775E-01, -1.941777361026890E+00, 9.967493174627775E-01, -1.941777361026890E+00, 9.934986349255550E-01 }, /* 1744 Hz */
-    { 9.967474595886060E-01, -1.941714669591972E+00, 9.967474595886060E-01, -1.941714669591972E+00, 9.934949191772120E-01 }, /* 1745 Hz */
-    { 9.967456017213377E-01, -1.941651945120022E+00, 9.967456017213377E-01, -1.941651945120022E+00, 9.934912034426755E-01 }, /* 1746 Hz */
-    { 9.967437438609728E-01, -1.941589187612235E+00, 9.967437438609728E-01, -1.941589187612235E+00, 9.934874877219455E-01 }, /* 1747 Hz */
-    { 9.967418860075107E-01, -1.941526397069810E+00, 9.967418860075107E-01, -1.941526397069810E+00, 9.934837720150214E-01 }, /* 1748 Hz */
-    { 9.967400281609519E-01, -1.941463573493945E+00, 9.967400281609519E-01, -1.941463573493945E+00, 9.934800563219037E-01 }, /* 1749 Hz */
-    { 9.967381703212957E-01, -1.941400716885840E+00, 9.967381703212957E-01, -1.941400716885840E+00, 9.934763406425915E-01 }, /* 1750 Hz */
-    { 9.967363124885430E-01, -1.941337827246695E+00, 9.967363124885430E-01, -1.941337827246695E+00, 9.934726249770860E-01 }, /* 1751 Hz */
-    { 9.967344546626928E-01, -1.941274904577709E+00, 9.967344546626928E-01, -1.941274904577709E+00, 9.934689093253857E-01 }, /* 1752 Hz */
-    { 9.967325968437457E-01, -1.941211948880083E+00, 9.967325968437457E-01, -1.941211948880083E+00, 9.934651936874914E-01 }, /* 1753 Hz */
-    { 9.967307390317014E-01, -1.941148960155020E+00, 9.967307390317014E-01, -1.941148960155020E+00, 9.934614780634028E-01 }, /* 1754 Hz */
-    { 9.967288812265596E-01, -1.941085938403720E+00, 9.967288812265596E-01, -1.941085938403720E+00, 9.934577624531191E-01 }, /* 1755 Hz */
-    { 9.967270234283209E-01, -1.941022883627386E+00, 9.967270234283209E-01, -1.941022883627386E+00, 9.934540468566417E-01 }, /* 1756 Hz */
-    { 9.967251656369844E-01, -1.940959795827222E+00, 9.967251656369844E-01, -1.940959795827222E+00, 9.934503312739689E-01 }, /* 1757 Hz */
-    { 9.967233078525508E-01, -1.940896675004431E+00, 9.967233078525508E-01, -1.940896675004431E+00, 9.934466157051016E-01 }, /* 1758 Hz */
-    { 9.967214500750198E-01, -1.940833521160217E+00, 9.967214500750198E-01, -1.940833521160217E+00, 9.934429001500396E-01 }, /* 1759 Hz */
-    { 9.967195923043911E-01, -1.940770334295785E+00, 9.967195923043911E-01, -1.940770334295785E+00, 9.934391846087822E-01 }, /* 1760 Hz */
-    { 9.967177345406651E-01, -1.940707114412341E+00, 9.967177345406651E-01, -1.940707114412341E+00, 9.934354690813303E-01 }, /* 1761 Hz */
-    { 9.967158767838412E-01, -1.940643861511090E+00, 9.967158767838412E-01, -1.940643861511090E+00, 9.934317535676824E-01 }, /* 1762 Hz */
-    { 9.967140190339198E-01, -1.940580575593238E+00, 9.967140190339198E-01, -1.940580575593238E+00, 9.934280380678395E-01 }, /* 1763 Hz */
-    { 9.967121612909007E-01, -1.940517256659993E+00, 9.967121612909007E-01, -1.940517256659993E+00, 9.934243225818014E-01 }, /* 1764 Hz */
-    { 9.967103035547837E-01, -1.940453904712562E+00, 9.967103035547837E-01, -1.940453904712562E+00, 9.934206071095675E-01 }, /* 1765 Hz */
-    { 9.967084458255693E-01, -1.940390519752154E+00, 9.967084458255693E-01, -1.940390519752154E+00, 9.934168916511386E-01 }, /* 1766 Hz */
-    { 9.967065881032566E-01, -1.940327101779976E+00, 9.967065881032566E-01, -1.940327101779976E+00, 9.934131762065133E-01 }, /* 1767 Hz */
-    { 9.967047303878461E-01, -1.940263650797239E+00, 9.967047303878461E-01, -1.940263650797239E+00, 9.934094607756923E-01 }, /* 1768 Hz */
-    { 9.967028726793378E-01, -1.940200166805151E+00, 9.967028726793378E-01, -1.940200166805151E+00, 9.934057453586755E-01 }, /* 1769 Hz */
-    { 9.967010149777313E-01, -1.940136649804925E+00, 9.967010149777313E-01, -1.940136649804925E+00, 9.934020299554627E-01 }, /* 1770 Hz */
-    { 9.966991572830267E-01, -1.940073099797769E+00, 9.966991572830267E-01, -1.940073099797769E+00, 9.933983145660534E-01 }, /* 1771 Hz */
-    { 9.966972995952241E-01, -1.940009516784896E+00, 9.966972995952241E-01, -1.940009516784896E+00, 9.933945991904483E-01 }, /* 1772 Hz */
-    { 9.966954419143234E-01, -1.939945900767519E+00, 9.966954419143234E-01, -1.939945900767519E+00, 9.933908838286467E-01 }, /* 1773 Hz */
-    { 9.966935842403245E-01, -1.939882251746849E+00, 9.966935842403245E-01, -1.939882251746849E+00, 9.933871684806490E-01 }, /* 1774 Hz */
-    { 9.966917265732272E-01, -1.939818569724099E+00, 9.966917265732272E-01, -1.939818569724099E+00, 9.933834531464545E-01 }, /* 1775 Hz */
-    { 9.966898689130315E-01, -1.939754854700483E+00, 9.966898689130315E-01, -1.939754854700483E+00, 9.933797378260629E-01 }, /* 1776 Hz */
-    { 9.966880112597376E-01, -1.939691106677217E+00, 9.966880112597376E-01, -1.939691106677217E+00, 9.933760225194752E-01 }, /* 1777 Hz */
-    { 9.966861536133451E-01, -1.939627325655514E+00, 9.966861536133451E-01, -1.939627325655514E+00, 9.933723072266902E-01 }, /* 1778 Hz */
-    { 9.966842959738542E-01, -1.939563511636590E+00, 9.966842959738542E-01, -1.939563511636590E+00, 9.933685919477084E-01 }, /* 1779 Hz */
-    { 9.966824383412649E-01, -1.939499664621661E+00, 9.966824383412649E-01, -1.939499664621661E+00, 9.933648766825298E-01 }, /* 1780 Hz */
-    { 9.966805807155770E-01, -1.939435784611944E+00, 9.966805807155770E-01, -1.939435784611944E+00, 9.933611614311539E-01 }, /* 1781 Hz */
-    { 9.966787230967901E-01, -1.939371871608654E+00, 9.966787230967901E-01, -1.939371871608654E+00, 9.933574461935801E-01 }, /* 1782 Hz */
-    { 9.966768654849049E-01, -1.939307925613011E+00, 9.966768654849049E-01, -1.939307925613011E+00, 9.933537309698097E-01 }, /* 1783 Hz */
-    { 9.966750078799208E-01, -1.939243946626233E+00, 9.966750078799208E-01, -1.939243946626233E+00, 9.933500157598416E-01 }, /* 1784 Hz */
-    { 9.966731502818380E-01, -1.939179934649537E+00, 9.966731502818380E-01, -1.939179934649537E+00, 9.933463005636760E-01 }, /* 1785 Hz */
-    { 9.966712926906565E-01, -1.939115889684145E+00, 9.966712926906565E-01, -1.939115889684145E+00, 9.933425853813129E-01 }, /* 1786 Hz */
-    { 9.966694351063757E-01, -1.939051811731274E+00, 9.966694351063757E-01, -1.939051811731274E+00, 9.933388702127515E-01 }, /* 1787 Hz */
-    { 9.966675775289962E-01, -1.938987700792146E+00, 9.966675775289962E-01, -1.938987700792146E+00, 9.933351550579923E-01 }, /* 1788 Hz */
-    { 9.966657199585177E-01, -1.938923556867982E+00, 9.966657199585177E-01, -1.938923556867982E+00, 9.933314399170354E-01 }, /* 1789 Hz */
-    { 9.966638623949403E-01, -1.938859379960004E+00, 9.966638623949403E-01, -1.938859379960004E+00, 9.933277247898806E-01 }, /* 1790 Hz */
-    { 9.966620048382636E-01, -1.938795170069433E+00, 9.966620048382636E-01, -1.938795170069433E+00, 9.933240096765272E-01 }, /* 1791 Hz */
-    { 9.966601472884877E-01, -1.938730927197492E+00, 9.966601472884877E-01, -1.938730927197492E+00, 9.933202945769755E-01 }, /* 1792 Hz */
-    { 9.966582897456128E-01, -1.938666651345406E+00, 9.966582897456128E-01, -1.938666651345406E+00, 9.933165794912255E-01 }, /* 1793 Hz */
-    { 9.966564322096386E-01, -1.938602342514396E+00, 9.966564322096386E-01, -1.938602342514396E+00, 9.933128644192772E-01 }, /* 1794 Hz */
-    { 9.966545746805652E-01, -1.938538000705688E+00, 9.966545746805652E-01, -1.938538000705688E+00, 9.933091493611304E-01 }, /* 1795 Hz */
-    { 9.966527171583923E-01, -1.938473625920507E+00, 9.966527171583923E-01, -1.938473625920507E+00, 9.933054343167846E-01 }, /* 1796 Hz */
-    { 9.966508596431199E-01, -1.938409218160078E+00, 9.966508596431199E-01, -1.938409218160078E+00, 9.933017192862399E-01 }, /* 1797 Hz */
-    { 9.966490021347481E-01, -1.938344777425627E+00, 9.966490021347481E-01, -1.938344777425627E+00, 9.932980042694961E-01 }, /* 1798 Hz */
-    { 9.966471446332770E-01, -1.938280303718381E+00, 9.966471446332770E-01, -1.938280303718381E+00, 9.932942892665539E-01 }, /* 1799 Hz */
-    { 9.966452871387060E-01, -1.938215797039566E+00, 9.966452871387060E-01, -1.938215797039566E+00, 9.932905742774121E-01 }, /* 1800 Hz */
-    { 9.966434296510357E-01, -1.938151257390412E+00, 9.966434296510357E-01, -1.938151257390412E+00, 9.932868593020714E-01 }, /* 1801 Hz */
-    { 9.966415721702655E-01, -1.938086684772145E+00, 9.966415721702655E-01, -1.938086684772145E+00, 9.932831443405310E-01 }, /* 1802 Hz */
-    { 9.966397146963959E-01, -1.938022079185996E+00, 9.966397146963959E-01, -1.938022079185996E+00, 9.932794293927918E-01 }, /* 1803 Hz */
-    { 9.966378572294263E-01, -1.937957440633193E+00, 9.966378572294263E-01, -1.937957440633193E+00, 9.932757144588527E-01 }, /* 1804 Hz */
-    { 9.966359997693570E-01, -1.937892769114966E+00, 9.966359997693570E-01, -1.937892769114966E+00, 9.932719995387140E-01 }, /* 1805 Hz */
-    { 9.966341423161876E-01, -1.937828064632545E+00, 9.966341423161876E-01, -1.937828064632545E+00, 9.932682846323753E-01 }, /* 1806 Hz */
-    { 9.966322848699184E-01, -1.937763327187163E+00, 9.966322848699184E-01, -1.937763327187163E+00, 9.932645697398368E-01 }, /* 1807 Hz */
-    { 9.966304274305493E-01, -1.937698556780050E+00, 9.966304274305493E-01, -1.937698556780050E+00, 9.932608548610986E-01 }, /* 1808 Hz */
-    { 9.966285699980801E-01, -1.937633753412439E+00, 9.966285699980801E-01, -1.937633753412439E+00, 9.932571399961603E-01 }, /* 1809 Hz */
-    { 9.966267125725110E-01, -1.937568917085563E+00, 9.966267125725110E-01, -1.937568917085563E+00, 9.932534251450220E-01 }, /* 1810 Hz */
-    { 9.966248551538417E-01, -1.937504047800654E+00, 9.966248551538417E-01, -1.937504047800654E+00, 9.932497103076834E-01 }, /* 1811 Hz */
-    { 9.966229977420721E-01, -1.937439145558947E+00, 9.966229977420721E-01, -1.937439145558947E+00, 9.932459954841442E-01 }, /* 1812 Hz */
-    { 9.966211403372024E-01, -1.937374210361677E+00, 9.966211403372024E-01, -1.937374210361677E+00, 9.932422806744048E-01 }, /* 1813 Hz */
-    { 9.966192829392323E-01, -1.937309242210077E+00, 9.966192829392323E-01, -1.937309242210077E+00, 9.932385658784646E-01 }, /* 1814 Hz */
-    { 9.966174255481620E-01, -1.937244241105385E+00, 9.966174255481620E-01, -1.937244241105385E+00, 9.932348510963240E-01 }, /* 1815 Hz */
-    { 9.966155681639912E-01, -1.937179207048835E+00, 9.966155681639912E-01, -1.937179207048835E+00, 9.932311363279824E-01 }, /* 1816 Hz */
-    { 9.966137107867200E-01, -1.937114140041665E+00, 9.966137107867200E-01, -1.937114140041665E+00, 9.932274215734400E-01 }, /* 1817 Hz */
-    { 9.966118534163485E-01, -1.937049040085112E+00, 9.966118534163485E-01, -1.937049040085112E+00, 9.932237068326970E-01 }, /* 1818 Hz */
-    { 9.966099960528764E-01, -1.936983907180413E+00, 9.966099960528764E-01, -1.936983907180413E+00, 9.932199921057527E-01 }, /* 1819 Hz */
-    { 9.966081386963036E-01, -1.936918741328808E+00, 9.966081386963036E-01, -1.936918741328808E+00, 9.932162773926072E-01 }, /* 1820 Hz */
-    { 9.966062813466300E-01, -1.936853542531533E+00, 9.966062813466300E-01, -1.936853542531533E+00, 9.932125626932600E-01 }, /* 1821 Hz */
-    { 9.966044240038560E-01, -1.936788310789832E+00, 9.966044240038560E-01, -1.936788310789832E+00, 9.932088480077119E-01 }, /* 1822 Hz */
-    { 9.966025666679811E-01, -1.936723046104941E+00, 9.966025666679811E-01, -1.936723046104941E+00, 9.932051333359622E-01 }, /* 1823 Hz */
-    { 9.966007093390055E-01, -1.936657748478102E+00, 9.966007093390055E-01, -1.936657748478102E+00, 9.932014186780109E-01 }, /* 1824 Hz */
-    { 9.965988520169289E-01, -1.936592417910557E+00, 9.965988520169289E-01, -1.936592417910557E+00, 9.931977040338578E-01 }, /* 1825 Hz */
-    { 9.965969947017516E-01, -1.936527054403547E+00, 9.965969947017516E-01, -1.936527054403547E+00, 9.931939894035031E-01 }, /* 1826 Hz */
-    { 9.965951373934732E-01, -1.936461657958314E+00, 9.965951373934732E-01, -1.936461657958314E+00, 9.931902747869463E-01 }, /* 1827 Hz */
-    { 9.965932800920939E-01, -1.936396228576101E+00, 9.965932800920939E-01, -1.936396228576101E+00, 9.931865601841878E-01 }, /* 1828 Hz */
-    { 9.965914227976136E-01, -1.936330766258151E+00, 9.965914227976136E-01, -1.936330766258151E+00, 9.931828455952272E-01 }, /* 1829 Hz */
-    { 9.965895655100320E-01, -1.936265271005710E+00, 9.965895655100320E-01, -1.936265271005710E+00, 9.931791310200639E-01 }, /* 1830 Hz */
-    { 9.965877082293495E-01, -1.936199742820020E+00, 9.965877082293495E-01, -1.936199742820020E+00, 9.931754164586990E-01 }, /* 1831 Hz */
-    { 9.965858509555655E-01, -1.936134181702327E+00, 9.965858509555655E-01, -1.936134181702327E+00, 9.931717019111310E-01 }, /* 1832 Hz */
-    { 9.965839936886804E-01, -1.936068587653877E+00, 9.965839936886804E-01, -1.936068587653877E+00, 9.931679873773609E-01 }, /* 1833 Hz */
-    { 9.965821364286941E-01, -1.936002960675916E+00, 9.965821364286941E-01, -1.936002960675916E+00, 9.931642728573882E-01 }, /* 1834 Hz */
-    { 9.965802791756064E-01, -1.935937300769691E+00, 9.965802791756064E-01, -1.935937300769691E+00, 9.931605583512129E-01 }, /* 1835 Hz */
-    { 9.965784219294173E-01, -1.935871607936448E+00, 9.965784219294173E-01, -1.935871607936448E+00, 9.931568438588345E-01 }, /* 1836 Hz */
-    { 9.965765646901266E-01, -1.935805882177437E+00, 9.965765646901266E-01, -1.935805882177437E+00, 9.931531293802531E-01 }, /* 1837 Hz */
-    { 9.965747074577344E-01, -1.935740123493904E+00, 9.965747074577344E-01, -1.935740123493904E+00, 9.931494149154687E-01 }, /* 1838 Hz */
-    { 9.965728502322408E-01, -1.935674331887101E+00, 9.965728502322408E-01, -1.935674331887101E+00, 9.931457004644817E-01 }, /* 1839 Hz */
-    { 9.965709930136453E-01, -1.935608507358275E+00, 9.965709930136453E-01, -1.935608507358275E+00, 9.931419860272905E-01 }, /* 1840 Hz */
-    { 9.965691358019485E-01, -1.935542649908677E+00, 9.965691358019485E-01, -1.935542649908677E+00, 9.931382716038970E-01 }, /* 1841 Hz */
-    { 9.965672785971498E-01, -1.935476759539558E+00, 9.965672785971498E-01, -1.935476759539558E+00, 9.931345571942995E-01 }, /* 1842 Hz */
-    { 9.965654213992492E-01, -1.935410836252168E+00, 9.965654213992492E-01, -1.935410836252168E+00, 9.931308427984984E-01 }, /* 1843 Hz */
-    { 9.965635642082469E-01, -1.935344880047760E+00, 9.965635642082469E-01, -1.935344880047760E+00, 9.931271284164938E-01 }, /* 1844 Hz */
-    { 9.965617070241427E-01, -1.935278890927587E+00, 9.965617070241427E-01, -1.935278890927587E+00, 9.931234140482854E-01 }, /* 1845 Hz */
-    { 9.965598498469367E-01, -1.935212868892900E+00, 9.965598498469367E-01, -1.935212868892900E+00, 9.931196996938734E-01 }, /* 1846 Hz */
-    { 9.965579926766286E-01, -1.935146813944954E+00, 9.965579926766286E-01, -1.935146813944954E+00, 9.931159853532572E-01 }, /* 1847 Hz */
-    { 9.965561355132184E-01, -1.935080726085002E+00, 9.965561355132184E-01, -1.935080726085002E+00, 9.931122710264368E-01 }, /* 1848 Hz */
-    { 9.965542783567062E-01, -1.935014605314299E+00, 9.965542783567062E-01, -1.935014605314299E+00, 9.931085567134124E-01 }, /* 1849 Hz */
-    { 9.965524212070921E-01, -1.934948451634100E+00, 9.965524212070921E-01, -1.934948451634100E+00, 9.931048424141842E-01 }, /* 1850 Hz */
-    { 9.965505640643755E-01, -1.934882265045661E+00, 9.965505640643755E-01, -1.934882265045661E+00, 9.931011281287510E-01 }, /* 1851 Hz */
-    { 9.965487069285567E-01, -1.934816045550238E+00, 9.965487069285567E-01, -1.934816045550238E+00, 9.930974138571134E-01 }, /* 1852 Hz */
-    { 9.965468497996358E-01, -1.934749793149089E+00, 9.965468497996358E-01, -1.934749793149089E+00, 9.930936995992716E-01 }, /* 1853 Hz */
-    { 9.965449926776124E-01, -1.934683507843469E+00, 9.965449926776124E-01, -1.934683507843469E+00, 9.930899853552249E-01 }, /* 1854 Hz */
-    { 9.965431355624867E-01, -1.934617189634638E+00, 9.965431355624867E-01, -1.934617189634638E+00, 9.930862711249735E-01 }, /* 1855 Hz */
-    { 9.965412784542584E-01, -1.934550838523853E+00, 9.965412784542584E-01, -1.934550838523853E+00, 9.930825569085169E-01 }, /* 1856 Hz */
-    { 9.965394213529279E-01, -1.934484454512375E+00, 9.965394213529279E-01, -1.934484454512375E+00, 9.930788427058559E-01 }, /* 1857 Hz */
-    { 9.965375642584947E-01, -1.934418037601461E+00, 9.965375642584947E-01, -1.934418037601461E+00, 9.930751285169894E-01 }, /* 1858 Hz */
-    { 9.965357071709589E-01, -1.934351587792374E+00, 9.965357071709589E-01, -1.934351587792374E+00, 9.930714143419177E-01 }, /* 1859 Hz */
-    { 9.965338500903204E-01, -1.934285105086372E+00, 9.965338500903204E-01, -1.934285105086372E+00, 9.930677001806407E-01 }, /* 1860 Hz */
-    { 9.965319930165794E-01, -1.934218589484718E+00, 9.965319930165794E-01, -1.934218589484718E+00, 9.930639860331587E-01 }, /* 1861 Hz */
-    { 9.965301359497355E-01, -1.934152040988674E+00, 9.965301359497355E-01, -1.934152040988674E+00, 9.930602718994710E-01 }, /* 1862 Hz */
-    { 9.965282788897888E-01, -1.934085459599501E+00, 9.965282788897888E-01, -1.934085459599501E+00, 9.930565577795776E-01 }, /* 1863 Hz */
-    { 9.965264218367391E-01, -1.934018845318463E+00, 9.965264218367391E-01, -1.934018845318463E+00, 9.930528436734782E-01 }, /* 1864 Hz */
-    { 9.965245647905868E-01, -1.933952198146824E+00, 9.965245647905868E-01, -1.933952198146824E+00, 9.930491295811736E-01 }, /* 1865 Hz */
-    { 9.965227077513314E-01, -1.933885518085847E+00, 9.965227077513314E-01, -1.933885518085847E+00, 9.930454155026629E-01 }, /* 1866 Hz */
-    { 9.965208507189731E-01, -1.933818805136798E+00, 9.965208507189731E-01, -1.933818805136798E+00, 9.930417014379462E-01 }, /* 1867 Hz */
-    { 9.965189936935117E-01, -1.933752059300940E+00, 9.965189936935117E-01, -1.933752059300940E+00, 9.930379873870234E-01 }, /* 1868 Hz */
-    { 9.965171366749471E-01, -1.933685280579540E+00, 9.965171366749471E-01, -1.933685280579540E+00, 9.930342733498942E-01 }, /* 1869 Hz */
-    { 9.965152796632795E-01, -1.933618468973865E+00, 9.965152796632795E-01, -1.933618468973865E+00, 9.930305593265589E-01 }, /* 1870 Hz */
-    { 9.965134226585084E-01, -1.933551624485181E+00, 9.965134226585084E-01, -1.933551624485181E+00, 9.930268453170168E-01 }, /* 1871 Hz */
-    { 9.965115656606344E-01, -1.933484747114756E+00, 9.965115656606344E-01, -1.933484747114756E+00, 9.930231313212687E-01 }, /* 1872 Hz */
-    { 9.965097086696568E-01, -1.933417836863857E+00, 9.965097086696568E-01, -1.933417836863857E+00, 9.930194173393136E-01 }, /* 1873 Hz */
-    { 9.965078516855760E-01, -1.933350893733753E+00, 9.965078516855760E-01, -1.933350893733753E+00, 9.930157033711520E-01 }, /* 1874 Hz */
-    { 9.965059947083919E-01, -1.933283917725714E+00, 9.965059947083919E-01, -1.933283917725714E+00, 9.930119894167837E-01 }, /* 1875 Hz */
-    { 9.965041377381041E-01, -1.933216908841008E+00, 9.965041377381041E-01, -1.933216908841008E+00, 9.930082754762082E-01 }, /* 1876 Hz */
-    { 9.965022807747127E-01, -1.933149867080907E+00, 9.965022807747127E-01, -1.933149867080907E+00, 9.930045615494254E-01 }, /* 1877 Hz */
-    { 9.965004238182178E-01, -1.933082792446680E+00, 9.965004238182178E-01, -1.933082792446680E+00, 9.930008476364356E-01 }, /* 1878 Hz */
-    { 9.964985668686195E-01, -1.933015684939600E+00, 9.964985668686195E-01, -1.933015684939600E+00, 9.929971337372390E-01 }, /* 1879 Hz */
-    { 9.964967099259172E-01, -1.932948544560938E+00, 9.964967099259172E-01, -1.932948544560938E+00, 9.929934198518344E-01 }, /* 1880 Hz */
-    { 9.964948529901114E-01, -1.932881371311967E+00, 9.964948529901114E-01, -1.932881371311967E+00, 9.929897059802228E-01 }, /* 1881 Hz */
-    { 9.964929960612019E-01, -1.932814165193959E+00, 9.964929960612019E-01, -1.932814165193959E+00, 9.929859921224038E-01 }, /* 1882 Hz */
-    { 9.964911391391884E-01, -1.932746926208189E+00, 9.964911391391884E-01, -1.932746926208189E+00, 9.929822782783768E-01 }, /* 1883 Hz */
-    { 9.964892822240712E-01, -1.932679654355930E+00, 9.964892822240712E-01, -1.932679654355930E+00, 9.929785644481424E-01 }, /* 1884 Hz */
-    { 9.964874253158499E-01, -1.932612349638456E+00, 9.964874253158499E-01, -1.932612349638456E+00, 9.929748506316998E-01 }, /* 1885 Hz */
-    { 9.964855684145247E-01, -1.932545012057045E+00, 9.964855684145247E-01, -1.932545012057045E+00, 9.929711368290495E-01 }, /* 1886 Hz */
-    { 9.964837115200954E-01, -1.932477641612970E+00, 9.964837115200954E-01, -1.932477641612970E+00, 9.929674230401908E-01 }, /* 1887 Hz */
-    { 9.964818546325620E-01, -1.932410238307508E+00, 9.964818546325620E-01, -1.932410238307508E+00, 9.929637092651240E-01 }, /* 1888 Hz */
-    { 9.964799977519245E-01, -1.932342802141937E+00, 9.964799977519245E-01, -1.932342802141937E+00, 9.929599955038491E-01 }, /* 1889 Hz */
-    { 9.964781408781829E-01, -1.932275333117534E+00, 9.964781408781829E-01, -1.932275333117534E+00, 9.929562817563657E-01 }, /* 1890 Hz */
-    { 9.964762840113369E-01, -1.932207831235577E+00, 9.964762840113369E-01, -1.932207831235577E+00, 9.929525680226738E-01 }, /* 1891 Hz */
-    { 9.964744271513869E-01, -1.932140296497344E+00, 9.964744271513869E-01, -1.932140296497344E+00, 9.929488543027738E-01 }, /* 1892 Hz */
-    { 9.964725702983322E-01, -1.932072728904114E+00, 9.964725702983322E-01, -1.932072728904114E+00, 9.929451405966645E-01 }, /* 1893 Hz */
-    { 9.964707134521733E-01, -1.932005128457168E+00, 9.964707134521733E-01, -1.932005128457168E+00, 9.929414269043466E-01 }, /* 1894 Hz */
-    { 9.964688566129101E-01, -1.931937495157786E+00, 9.964688566129101E-01, -1.931937495157786E+00, 9.929377132258201E-01 }, /* 1895 Hz */
-    { 9.964669997805422E-01, -1.931869829007247E+00, 9.964669997805422E-01, -1.931869829007247E+00, 9.929339995610844E-01 }, /* 1896 Hz */
-    { 9.964651429550697E-01, -1.931802130006835E+00, 9.964651429550697E-01, -1.931802130006835E+00, 9.929302859101394E-01 }, /* 1897 Hz */
-    { 9.964632861364928E-01, -1.931734398157830E+00, 9.964632861364928E-01, -1.931734398157830E+00, 9.929265722729856E-01 }, /* 1898 Hz */
-    { 9.964614293248112E-01, -1.931666633461516E+00, 9.964614293248112E-01, -1.931666633461516E+00, 9.929228586496224E-01 }, /* 1899 Hz */
-    { 9.964595725200247E-01, -1.931598835919174E+00, 9.964595725200247E-01, -1.931598835919174E+00, 9.929191450400494E-01 }, /* 1900 Hz */
-    { 9.964577157221336E-01, -1.931531005532090E+00, 9.964577157221336E-01, -1.931531005532090E+00, 9.929154314442672E-01 }, /* 1901 Hz */
-    { 9.964558589311376E-01, -1.931463142301546E+00, 9.964558589311376E-01, -1.931463142301546E+00, 9.929117178622753E-01 }, /* 1902 Hz */
-    { 9.964540021470368E-01, -1.931395246228829E+00, 9.964540021470368E-01, -1.931395246228829E+00, 9.929080042940737E-01 }, /* 1903 Hz */
-    { 9.964521453698312E-01, -1.931327317315222E+00, 9.964521453698312E-01, -1.931327317315222E+00, 9.929042907396624E-01 }, /* 1904 Hz */
-    { 9.964502885995207E-01, -1.931259355562012E+00, 9.964502885995207E-01, -1.931259355562012E+00, 9.929005771990413E-01 }, /* 1905 Hz */
-    { 9.964484318361051E-01, -1.931191360970486E+00, 9.964484318361051E-01, -1.931191360970486E+00, 9.928968636722102E-01 }, /* 1906 Hz */
-    { 9.964465750795843E-01, -1.931123333541930E+00, 9.964465750795843E-01, -1.931123333541930E+00, 9.928931501591687E-01 }, /* 1907 Hz */
-    { 9.964447183299585E-01, -1.931055273277631E+00, 9.964447183299585E-01, -1.931055273277631E+00, 9.928894366599170E-01 }, /* 1908 Hz */
-    { 9.964428615872277E-01, -1.930987180178878E+00, 9.964428615872277E-01, -1.930987180178878E+00, 9.928857231744554E-01 }, /* 1909 Hz */
-    { 9.964410048513914E-01, -1.930919054246960E+00, 9.964410048513914E-01, -1.930919054246960E+00, 9.928820097027828E-01 }, /* 1910 Hz */
-    { 9.964391481224498E-01, -1.930850895483165E+00, 9.964391481224498E-01, -1.930850895483165E+00, 9.928782962448996E-01 }, /* 1911 Hz */
-    { 9.964372914004030E-01, -1.930782703888783E+00, 9.964372914004030E-01, -1.930782703888783E+00, 9.928745828008061E-01 }, /* 1912 Hz */
-    { 9.964354346852511E-01, -1.930714479465106E+00, 9.964354346852511E-01, -1.930714479465106E+00, 9.928708693705022E-01 }, /* 1913 Hz */
-    { 9.964335779769936E-01, -1.930646222213423E+00, 9.964335779769936E-01, -1.930646222213423E+00, 9.928671559539872E-01 }, /* 1914 Hz */
-    { 9.964317212756305E-01, -1.930577932135025E+00, 9.964317212756305E-01, -1.930577932135025E+00, 9.928634425512610E-01 }, /* 1915 Hz */
-    { 9.964298645811619E-01, -1.930509609231206E+00, 9.964298645811619E-01, -1.930509609231206E+00, 9.928597291623238E-01 }, /* 1916 Hz */
-    { 9.964280078935877E-01, -1.930441253503257E+00, 9.964280078935877E-01, -1.930441253503257E+00, 9.928560157871753E-01 }, /* 1917 Hz */
-    { 9.964261512129081E-01, -1.930372864952471E+00, 9.964261512129081E-01, -1.930372864952471E+00, 9.928523024258162E-01 }, /* 1918 Hz */
-    { 9.964242945391227E-01, -1.930304443580143E+00, 9.964242945391227E-01, -1.930304443580143E+00, 9.928485890782455E-01 }, /* 1919 Hz */
-    { 9.964224378722315E-01, -1.930235989387566E+00, 9.964224378722315E-01, -1.930235989387566E+00, 9.928448757444630E-01 }, /* 1920 Hz */
-    { 9.964205812122344E-01, -1.930167502376035E+00, 9.964205812122344E-01, -1.930167502376035E+00, 9.928411624244688E-01 }, /* 1921 Hz */
-    { 9.964187245591318E-01, -1.930098982546846E+00, 9.964187245591318E-01, -1.930098982546846E+00, 9.928374491182637E-01 }, /* 1922 Hz */
-    { 9.964168679129232E-01, -1.930030429901294E+00, 9.964168679129232E-01, -1.930030429901294E+00, 9.928337358258463E-01 }, /* 1923 Hz */
-    { 9.964150112736087E-01, -1.929961844440675E+00, 9.964150112736087E-01, -1.929961844440675E+00, 9.928300225472173E-01 }, /* 1924 Hz */
-    { 9.964131546411881E-01, -1.929893226166287E+00, 9.964131546411881E-01, -1.929893226166287E+00, 9.928263092823761E-01 }, /* 1925 Hz */
-    { 9.964112980156614E-01, -1.929824575079428E+00, 9.964112980156614E-01, -1.929824575079428E+00, 9.928225960313228E-01 }, /* 1926 Hz */
-    { 9.964094413970288E-01, -1.929755891181395E+00, 9.964094413970288E-01, -1.929755891181395E+00, 9.928188827940576E-01 }, /* 1927 Hz */
-    { 9.964075847852899E-01, -1.929687174473486E+00, 9.964075847852899E-01, -1.929687174473486E+00, 9.928151695705798E-01 }, /* 1928 Hz */
-    { 9.964057281804448E-01, -1.929618424957002E+00, 9.964057281804448E-01, -1.929618424957002E+00, 9.928114563608896E-01 }, /* 1929 Hz */
-    { 9.964038715824935E-01, -1.929549642633242E+00, 9.964038715824935E-01, -1.929549642633242E+00, 9.928077431649871E-01 }, /* 1930 Hz */
-    { 9.964020149914362E-01, -1.929480827503507E+00, 9.964020149914362E-01, -1.929480827503507E+00, 9.928040299828724E-01 }, /* 1931 Hz */
-    { 9.964001584072721E-01, -1.929411979569096E+00, 9.964001584072721E-01, -1.929411979569096E+00, 9.928003168145443E-01 }, /* 1932 Hz */
-    { 9.963983018300019E-01, -1.929343098831312E+00, 9.963983018300019E-01, -1.929343098831312E+00, 9.927966036600038E-01 }, /* 1933 Hz */
-    { 9.963964452596252E-01, -1.929274185291457E+00, 9.963964452596252E-01, -1.929274185291457E+00, 9.927928905192505E-01 }, /* 1934 Hz */
-    { 9.963945886961419E-01, -1.929205238950833E+00, 9.963945886961419E-01, -1.929205238950833E+00, 9.927891773922839E-01 }, /* 1935 Hz */
-    { 9.963927321395522E-01, -1.929136259810743E+00, 9.963927321395522E-01, -1.929136259810743E+00, 9.927854642791043E-01 }, /* 1936 Hz */
-    { 9.963908755898558E-01, -1.929067247872491E+00, 9.963908755898558E-01, -1.929067247872491E+00, 9.927817511797117E-01 }, /* 1937 Hz */
-    { 9.963890190470528E-01, -1.928998203137381E+00, 9.963890190470528E-01, -1.928998203137381E+00, 9.927780380941056E-01 }, /* 1938 Hz */
-    { 9.963871625111431E-01, -1.928929125606719E+00, 9.963871625111431E-01, -1.928929125606719E+00, 9.927743250222862E-01 }, /* 1939 Hz */
-    { 9.963853059821265E-01, -1.928860015281808E+00, 9.963853059821265E-01, -1.928860015281808E+00, 9.927706119642530E-01 }, /* 1940 Hz */
-    { 9.963834494600031E-01, -1.928790872163956E+00, 9.963834494600031E-01, -1.928790872163956E+00, 9.927668989200062E-01 }, /* 1941 Hz */
-    { 9.963815929447729E-01, -1.928721696254468E+00, 9.963815929447729E-01, -1.928721696254468E+00, 9.927631858895458E-01 }, /* 1942 Hz */
-    { 9.963797364364360E-01, -1.928652487554652E+00, 9.963797364364360E-01, -1.928652487554652E+00, 9.927594728728719E-01 }, /* 1943 Hz */
-    { 9.963778799349919E-01, -1.928583246065815E+00, 9.963778799349919E-01, -1.928583246065815E+00, 9.927557598699839E-01 }, /* 1944 Hz */
-    { 9.963760234404410E-01, -1.928513971789266E+00, 9.963760234404410E-01, -1.928513971789266E+00, 9.927520468808819E-01 }, /* 1945 Hz */
-    { 9.963741669527828E-01, -1.928444664726312E+00, 9.963741669527828E-01, -1.928444664726312E+00, 9.927483339055656E-01 }, /* 1946 Hz */
-    { 9.963723104720175E-01, -1.928375324878264E+00, 9.963723104720175E-01, -1.928375324878264E+00, 9.927446209440349E-01 }, /* 1947 Hz */
-    { 9.963704539981452E-01, -1.928305952246431E+00, 9.963704539981452E-01, -1.928305952246431E+00, 9.927409079962903E-01 }, /* 1948 Hz */
-    { 9.963685975311656E-01, -1.928236546832123E+00, 9.963685975311656E-01, -1.928236546832123E+00, 9.927371950623312E-01 }, /* 1949 Hz */
-    { 9.963667410710786E-01, -1.928167108636651E+00, 9.963667410710786E-01, -1.928167108636651E+00, 9.927334821421572E-01 }, /* 1950 Hz */
-    { 9.963648846178843E-01, -1.928097637661327E+00, 9.963648846178843E-01, -1.928097637661327E+00, 9.927297692357686E-01 }, /* 1951 Hz */
-    { 9.963630281715828E-01, -1.928028133907463E+00, 9.963630281715828E-01, -1.928028133907463E+00, 9.927260563431657E-01 }, /* 1952 Hz */
-    { 9.963611717321738E-01, -1.927958597376371E+00, 9.963611717321738E-01, -1.927958597376371E+00, 9.927223434643475E-01 }, /* 1953 Hz */
-    { 9.963593152996574E-01, -1.927889028069365E+00, 9.963593152996574E-01, -1.927889028069365E+00, 9.927186305993148E-01 }, /* 1954 Hz */
-    { 9.963574588740334E-01, -1.927819425987758E+00, 9.963574588740334E-01, -1.927819425987758E+00, 9.927149177480667E-01 }, /* 1955 Hz */
-    { 9.963556024553017E-01, -1.927749791132864E+00, 9.963556024553017E-01, -1.927749791132864E+00, 9.927112049106035E-01 }, /* 1956 Hz */
-    { 9.963537460434625E-01, -1.927680123505998E+00, 9.963537460434625E-01, -1.927680123505998E+00, 9.927074920869250E-01 }, /* 1957 Hz */
-    { 9.963518896385157E-01, -1.927610423108476E+00, 9.963518896385157E-01, -1.927610423108476E+00, 9.927037792770315E-01 }, /* 1958 Hz */
-    { 9.963500332404610E-01, -1.927540689941613E+00, 9.963500332404610E-01, -1.927540689941613E+00, 9.927000664809220E-01 }, /* 1959 Hz */
-    { 9.963481768492986E-01, -1.927470924006726E+00, 9.963481768492986E-01, -1.927470924006726E+00, 9.926963536985971E-01 }, /* 1960 Hz */
-    { 9.963463204650285E-01, -1.927401125305132E+00, 9.963463204650285E-01, -1.927401125305132E+00, 9.926926409300569E-01 }, /* 1961 Hz */
-    { 9.963444640876503E-01, -1.927331293838148E+00, 9.963444640876503E-01, -1.927331293838148E+00, 9.926889281753006E-01 }, /* 1962 Hz */
-    { 9.963426077171641E-01, -1.927261429607093E+00, 9.963426077171641E-01, -1.927261429607093E+00, 9.926852154343282E-01 }, /* 1963 Hz */
-    { 9.963407513535701E-01, -1.927191532613286E+00, 9.963407513535701E-01, -1.927191532613286E+00, 9.926815027071403E-01 }, /* 1964 Hz */
-    { 9.963388949968680E-01, -1.927121602858044E+00, 9.963388949968680E-01, -1.927121602858044E+00, 9.926777899937360E-01 }, /* 1965 Hz */
-    { 9.963370386470579E-01, -1.927051640342690E+00, 9.963370386470579E-01, -1.927051640342690E+00, 9.926740772941158E-01 }, /* 1966 Hz */
-    { 9.963351823041394E-01, -1.926981645068541E+00, 9.963351823041394E-01, -1.926981645068541E+00, 9.926703646082788E-01 }, /* 1967 Hz */
-    { 9.963333259681130E-01, -1.926911617036921E+00, 9.963333259681130E-01, -1.926911617036921E+00, 9.926666519362259E-01 }, /* 1968 Hz */
-    { 9.963314696389782E-01, -1.926841556249149E+00, 9.963314696389782E-01, -1.926841556249149E+00, 9.926629392779565E-01 }, /* 1969 Hz */
-    { 9.963296133167352E-01, -1.926771462706549E+00, 9.963296133167352E-01, -1.926771462706549E+00, 9.926592266334704E-01 }, /* 1970 Hz */
-    { 9.963277570013839E-01, -1.926701336410443E+00, 9.963277570013839E-01, -1.926701336410443E+00, 9.926555140027677E-01 }, /* 1971 Hz */
-    { 9.963259006929240E-01, -1.926631177362153E+00, 9.963259006929240E-01, -1.926631177362153E+00, 9.926518013858481E-01 }, /* 1972 Hz */
-    { 9.963240443913557E-01, -1.926560985563003E+00, 9.963240443913557E-01, -1.926560985563003E+00, 9.926480887827114E-01 }, /* 1973 Hz */
-    { 9.963221880966791E-01, -1.926490761014319E+00, 9.963221880966791E-01, -1.926490761014319E+00, 9.926443761933581E-01 }, /* 1974 Hz */
-    { 9.963203318088937E-01, -1.926420503717424E+00, 9.963203318088937E-01, -1.926420503717424E+00, 9.926406636177874E-01 }, /* 1975 Hz */
-    { 9.963184755279998E-01, -1.926350213673644E+00, 9.963184755279998E-01, -1.926350213673644E+00, 9.926369510559996E-01 }, /* 1976 Hz */
-    { 9.963166192539972E-01, -1.926279890884305E+00, 9.963166192539972E-01, -1.926279890884305E+00, 9.926332385079943E-01 }, /* 1977 Hz */
-    { 9.963147629868859E-01, -1.926209535350732E+00, 9.963147629868859E-01, -1.926209535350732E+00, 9.926295259737719E-01 }, /* 1978 Hz */
-    { 9.963129067266659E-01, -1.926139147074255E+00, 9.963129067266659E-01, -1.926139147074255E+00, 9.926258134533319E-01 }, /* 1979 Hz */
-    { 9.963110504733369E-01, -1.926068726056199E+00, 9.963110504733369E-01, -1.926068726056199E+00, 9.926221009466738E-01 }, /* 1980 Hz */
-    { 9.963091942268993E-01, -1.925998272297894E+00, 9.963091942268993E-01, -1.925998272297894E+00, 9.926183884537987E-01 }, /* 1981 Hz */
-    { 9.963073379873526E-01, -1.925927785800666E+00, 9.963073379873526E-01, -1.925927785800666E+00, 9.926146759747052E-01 }, /* 1982 Hz */
-    { 9.963054817546970E-01, -1.925857266565848E+00, 9.963054817546970E-01, -1.925857266565848E+00, 9.926109635093940E-01 }, /* 1983 Hz */
-    { 9.963036255289324E-01, -1.925786714594766E+00, 9.963036255289324E-01, -1.925786714594766E+00, 9.926072510578647E-01 }, /* 1984 Hz */
-    { 9.963017693100586E-01, -1.925716129888754E+00, 9.963017693100586E-01, -1.925716129888754E+00, 9.926035386201173E-01 }, /* 1985 Hz */
-    { 9.962999130980761E-01, -1.925645512449140E+00, 9.962999130980761E-01, -1.925645512449140E+00, 9.925998261961522E-01 }, /* 1986 Hz */
-    { 9.962980568929840E-01, -1.925574862277257E+00, 9.962980568929840E-01, -1.925574862277257E+00, 9.925961137859680E-01 }, /* 1987 Hz */
-    { 9.962962006947828E-01, -1.925504179374436E+00, 9.962962006947828E-01, -1.925504179374436E+00, 9.925924013895655E-01 }, /* 1988 Hz */
-    { 9.962943445034723E-01, -1.925433463742010E+00, 9.962943445034723E-01, -1.925433463742010E+00, 9.925886890069446E-01 }, /* 1989 Hz */
-    { 9.962924883190525E-01, -1.925362715381312E+00, 9.962924883190525E-01, -1.925362715381312E+00, 9.925849766381050E-01 }, /* 1990 Hz */
-    { 9.962906321415234E-01, -1.925291934293677E+00, 9.962906321415234E-01, -1.925291934293677E+00, 9.925812642830467E-01 }, /* 1991 Hz */
-    { 9.962887759708849E-01, -1.925221120480439E+00, 9.962887759708849E-01, -1.925221120480439E+00, 9.925775519417699E-01 }, /* 1992 Hz */
-    { 9.962869198071368E-01, -1.925150273942930E+00, 9.962869198071368E-01, -1.925150273942930E+00, 9.925738396142736E-01 }, /* 1993 Hz */
-    { 9.962850636502792E-01, -1.925079394682488E+00, 9.962850636502792E-01, -1.925079394682488E+00, 9.925701273005585E-01 }, /* 1994 Hz */
-    { 9.962832075003120E-01, -1.925008482700449E+00, 9.962832075003120E-01, -1.925008482700449E+00, 9.925664150006239E-01 }, /* 1995 Hz */
-    { 9.962813513572352E-01, -1.924937537998148E+00, 9.962813513572352E-01, -1.924937537998148E+00, 9.925627027144703E-01 }, /* 1996 Hz */
-    { 9.962794952210486E-01, -1.924866560576923E+00, 9.962794952210486E-01, -1.924866560576923E+00, 9.925589904420973E-01 }, /* 1997 Hz */
-    { 9.962776390917525E-01, -1.924795550438112E+00, 9.962776390917525E-01, -1.924795550438112E+00, 9.925552781835050E-01 }, /* 1998 Hz */
-    { 9.962757829693465E-01, -1.924724507583052E+00, 9.962757829693465E-01, -1.924724507583052E+00, 9.925515659386930E-01 }, /* 1999 Hz */
-    { 9.962739268538306E-01, -1.924653432013082E+00, 9.962739268538306E-01, -1.924653432013082E+00, 9.925478537076613E-01 }, /* 2000 Hz */
-    { 9.962720707452050E-01, -1.924582323729542E+00, 9.962720707452050E-01, -1.924582323729542E+00, 9.925441414904099E-01 }, /* 2001 Hz */
-    { 9.962702146434692E-01, -1.924511182733771E+00, 9.962702146434692E-01, -1.924511182733771E+00, 9.925404292869384E-01 }, /* 2002 Hz */
-    { 9.962683585486236E-01, -1.924440009027109E+00, 9.962683585486236E-01, -1.924440009027109E+00, 9.925367170972472E-01 }, /* 2003 Hz */
-    { 9.962665024606679E-01, -1.924368802610899E+00, 9.962665024606679E-01, -1.924368802610899E+00, 9.925330049213359E-01 }, /* 2004 Hz */
-    { 9.962646463796020E-01, -1.924297563486479E+00, 9.962646463796020E-01, -1.924297563486479E+00, 9.925292927592040E-01 }, /* 2005 Hz */
-    { 9.962627903054262E-01, -1.924226291655195E+00, 9.962627903054262E-01, -1.924226291655195E+00, 9.925255806108524E-01 }, /* 2006 Hz */
-    { 9.962609342381400E-01, -1.924154987118386E+00, 9.962609342381400E-01, -1.924154987118386E+00, 9.925218684762800E-01 }, /* 2007 Hz */
-    { 9.962590781777437E-01, -1.924083649877397E+00, 9.962590781777437E-01, -1.924083649877397E+00, 9.925181563554875E-01 }, /* 2008 Hz */
-    { 9.962572221242371E-01, -1.924012279933572E+00, 9.962572221242371E-01, -1.924012279933572E+00, 9.925144442484741E-01 }, /* 2009 Hz */
-    { 9.962553660776199E-01, -1.923940877288254E+00, 9.962553660776199E-01, -1.923940877288254E+00, 9.925107321552398E-01 }, /* 2010 Hz */
-    { 9.962535100378924E-01, -1.923869441942789E+00, 9.962535100378924E-01, -1.923869441942789E+00, 9.925070200757848E-01 }, /* 2011 Hz */
-    { 9.962516540050546E-01, -1.923797973898521E+00, 9.962516540050546E-01, -1.923797973898521E+00, 9.925033080101091E-01 }, /* 2012 Hz */
-    { 9.962497979791061E-01, -1.923726473156797E+00, 9.962497979791061E-01, -1.923726473156797E+00, 9.924995959582121E-01 }, /* 2013 Hz */
-    { 9.962479419600472E-01, -1.923654939718964E+00, 9.962479419600472E-01, -1.923654939718964E+00, 9.924958839200944E-01 }, /* 2014 Hz */
-    { 9.962460859478777E-01, -1.923583373586367E+00, 9.962460859478777E-01, -1.923583373586367E+00, 9.924921718957553E-01 }, /* 2015 Hz */
-    { 9.962442299425973E-01, -1.923511774760355E+00, 9.962442299425973E-01, -1.923511774760355E+00, 9.924884598851946E-01 }, /* 2016 Hz */
-    { 9.962423739442064E-01, -1.923440143242276E+00, 9.962423739442064E-01, -1.923440143242276E+00, 9.924847478884129E-01 }, /* 2017 Hz */
-    { 9.962405179527049E-01, -1.923368479033479E+00, 9.962405179527049E-01, -1.923368479033479E+00, 9.924810359054097E-01 }, /* 2018 Hz */
-    { 9.962386619680923E-01, -1.923296782135312E+00, 9.962386619680923E-01, -1.923296782135312E+00, 9.924773239361846E-01 }, /* 2019 Hz */
-    { 9.962368059903690E-01, -1.923225052549126E+00, 9.962368059903690E-01, -1.923225052549126E+00, 9.924736119807380E-01 }, /* 2020 Hz */
-    { 9.962349500195347E-01, -1.923153290276270E+00, 9.962349500195347E-01, -1.923153290276270E+00, 9.924699000390693E-01 }, /* 2021 Hz */
-    { 9.962330940555894E-01, -1.923081495318097E+00, 9.962330940555894E-01, -1.923081495318097E+00, 9.924661881111787E-01 }, /* 2022 Hz */
-    { 9.962312380985331E-01, -1.923009667675956E+00, 9.962312380985331E-01, -1.923009667675956E+00, 9.924624761970662E-01 }, /* 2023 Hz */
-    { 9.962293821483659E-01, -1.922937807351201E+00, 9.962293821483659E-01, -1.922937807351201E+00, 9.924587642967317E-01 }, /* 2024 Hz */
-    { 9.962275262050873E-01, -1.922865914345184E+00, 9.962275262050873E-01, -1.922865914345184E+00, 9.924550524101745E-01 }, /* 2025 Hz */
-    { 9.962256702686976E-01, -1.922793988659257E+00, 9.962256702686976E-01, -1.922793988659257E+00, 9.924513405373951E-01 }, /* 2026 Hz */
-    { 9.962238143391967E-01, -1.922722030294775E+00, 9.962238143391967E-01, -1.922722030294775E+00, 9.924476286783934E-01 }, /* 2027 Hz */
-    { 9.962219584165847E-01, -1.922650039253092E+00, 9.962219584165847E-01, -1.922650039253092E+00, 9.924439168331693E-01 }, /* 2028 Hz */
-    { 9.962201025008612E-01, -1.922578015535563E+00, 9.962201025008612E-01, -1.922578015535563E+00, 9.924402050017225E-01 }, /* 2029 Hz */
-    { 9.962182465920264E-01, -1.922505959143542E+00, 9.962182465920264E-01, -1.922505959143542E+00, 9.924364931840528E-01 }, /* 2030 Hz */
-    { 9.962163906900802E-01, -1.922433870078387E+00, 9.962163906900802E-01, -1.922433870078387E+00, 9.924327813801603E-01 }, /* 2031 Hz */
-    { 9.962145347950223E-01, -1.922361748341452E+00, 9.962145347950223E-01, -1.922361748341452E+00, 9.924290695900446E-01 }, /* 2032 Hz */
-    { 9.962126789068532E-01, -1.922289593934096E+00, 9.962126789068532E-01, -1.922289593934096E+00, 9.924253578137063E-01 }, /* 2033 Hz */
-    { 9.962108230255723E-01, -1.922217406857675E+00, 9.962108230255723E-01, -1.922217406857675E+00, 9.924216460511446E-01 }, /* 2034 Hz */
-    { 9.962089671511798E-01, -1.922145187113548E+00, 9.962089671511798E-01, -1.922145187113548E+00, 9.924179343023596E-01 }, /* 2035 Hz */
-    { 9.962071112836755E-01, -1.922072934703074E+00, 9.962071112836755E-01, -1.922072934703074E+00, 9.924142225673509E-01 }, /* 2036 Hz */
-    { 9.962052554230597E-01, -1.922000649627612E+00, 9.962052554230597E-01, -1.922000649627612E+00, 9.924105108461194E-01 }, /* 2037 Hz */
-    { 9.962033995693319E-01, -1.921928331888521E+00, 9.962033995693319E-01, -1.921928331888521E+00, 9.924067991386638E-01 }, /* 2038 Hz */
-    { 9.962015437224923E-01, -1.921855981487162E+00, 9.962015437224923E-01, -1.921855981487162E+00, 9.924030874449845E-01 }, /* 2039 Hz */
-    { 9.961996878825410E-01, -1.921783598424896E+00, 9.961996878825410E-01, -1.921783598424896E+00, 9.923993757650820E-01 }, /* 2040 Hz */
-    { 9.961978320494776E-01, -1.921711182703084E+00, 9.961978320494776E-01, -1.921711182703084E+00, 9.923956640989553E-01 }, /* 2041 Hz */
-    { 9.961959762233022E-01, -1.921638734323088E+00, 9.961959762233022E-01, -1.921638734323088E+00, 9.923919524466045E-01 }, /* 2042 Hz */
-    { 9.961941204040147E-01, -1.921566253286270E+00, 9.961941204040147E-01, -1.921566253286270E+00, 9.923882408080293E-01 }, /* 2043 Hz */
-    { 9.961922645916151E-01, -1.921493739593995E+00, 9.961922645916151E-01, -1.921493739593995E+00, 9.923845291832303E-01 }, /* 2044 Hz */
-    { 9.961904087861035E-01, -1.921421193247625E+00, 9.961904087861035E-01, -1.921421193247625E+00, 9.923808175722071E-01 }, /* 2045 Hz */
-    { 9.961885529874798E-01, -1.921348614248524E+00, 9.961885529874798E-01, -1.921348614248524E+00, 9.923771059749595E-01 }, /* 2046 Hz */
-    { 9.961866971957437E-01, -1.921276002598058E+00, 9.961866971957437E-01, -1.921276002598058E+00, 9.923733943914874E-01 }, /* 2047 Hz */
-    { 9.961848414108951E-01, -1.921203358297591E+00, 9.961848414108951E-01, -1.921203358297591E+00, 9.923696828217903E-01 }, /* 2048 Hz */
-    { 9.961829856329345E-01, -1.921130681348491E+00, 9.961829856329345E-01, -1.921130681348491E+00, 9.923659712658690E-01 }, /* 2049 Hz */
-    { 9.961811298618614E-01, -1.921057971752121E+00, 9.961811298618614E-01, -1.921057971752121E+00, 9.923622597237227E-01 }, /* 2050 Hz */
-    { 9.961792740976756E-01, -1.920985229509851E+00, 9.961792740976756E-01, -1.920985229509851E+00, 9.923585481953512E-01 }, /* 2051 Hz */
-    { 9.961774183403777E-01, -1.920912454623048E+00, 9.961774183403777E-01, -1.920912454623048E+00, 9.923548366807553E-01 }, /* 2052 Hz */
-    { 9.961755625899668E-01, -1.920839647093078E+00, 9.961755625899668E-01, -1.920839647093078E+00, 9.923511251799335E-01 }, /* 2053 Hz */
-    { 9.961737068464436E-01, -1.920766806921313E+00, 9.961737068464436E-01, -1.920766806921313E+00, 9.923474136928871E-01 }, /* 2054 Hz */
-    { 9.961718511098077E-01, -1.920693934109119E+00, 9.961718511098077E-01, -1.920693934109119E+00, 9.923437022196153E-01 }, /* 2055 Hz */
-    { 9.961699953800588E-01, -1.920621028657867E+00, 9.961699953800588E-01, -1.920621028657867E+00, 9.923399907601176E-01 }, /* 2056 Hz */
-    { 9.961681396571975E-01, -1.920548090568928E+00, 9.961681396571975E-01, -1.920548090568928E+00, 9.923362793143951E-01 }, /* 2057 Hz */
-    { 9.961662839412232E-01, -1.920475119843672E+00, 9.961662839412232E-01, -1.920475119843672E+00, 9.923325678824464E-01 }, /* 2058 Hz */
-    { 9.961644282321360E-01, -1.920402116483470E+00, 9.961644282321360E-01, -1.920402116483470E+00, 9.923288564642720E-01 }, /* 2059 Hz */
-    { 9.961625725299360E-01, -1.920329080489695E+00, 9.961625725299360E-01, -1.920329080489695E+00, 9.923251450598720E-01 }, /* 2060 Hz */
-    { 9.961607168346230E-01, -1.920256011863720E+00, 9.961607168346230E-01, -1.920256011863720E+00, 9.923214336692461E-01 }, /* 2061 Hz */
-    { 9.961588611461970E-01, -1.920182910606916E+00, 9.961588611461970E-01, -1.920182910606916E+00, 9.923177222923940E-01 }, /* 2062 Hz */
-    { 9.961570054646579E-01, -1.920109776720658E+00, 9.961570054646579E-01, -1.920109776720658E+00, 9.923140109293158E-01 }, /* 2063 Hz */
-    { 9.961551497900057E-01, -1.920036610206320E+00, 9.961551497900057E-01, -1.920036610206320E+00, 9.923102995800115E-01 }, /* 2064 Hz */
-    { 9.961532941222404E-01, -1.919963411065276E+00, 9.961532941222404E-01, -1.919963411065276E+00, 9.923065882444808E-01 }, /* 2065 Hz */
-    { 9.961514384613618E-01, -1.919890179298903E+00, 9.961514384613618E-01, -1.919890179298903E+00, 9.923028769227236E-01 }, /* 2066 Hz */
-    { 9.961495828073698E-01, -1.919816914908575E+00, 9.961495828073698E-01, -1.919816914908575E+00, 9.922991656147395E-01 }, /* 2067 Hz */
-    { 9.961477271602647E-01, -1.919743617895669E+00, 9.961477271602647E-01, -1.919743617895669E+00, 9.922954543205293E-01 }, /* 2068 Hz */
-    { 9.961458715200461E-01, -1.919670288261563E+00, 9.961458715200461E-01, -1.919670288261563E+00, 9.922917430400922E-01 }, /* 2069 Hz */
-    { 9.961440158867139E-01, -1.919596926007632E+00, 9.961440158867139E-01, -1.919596926007632E+00, 9.922880317734277E-01 }, /* 2070 Hz */
-    { 9.961421602602684E-01, -1.919523531135257E+00, 9.961421602602684E-01, -1.919523531135257E+00, 9.922843205205367E-01 }, /* 2071 Hz */
-    { 9.961403046407094E-01, -1.919450103645814E+00, 9.961403046407094E-01, -1.919450103645814E+00, 9.922806092814187E-01 }, /* 2072 Hz */
-    { 9.961384490280367E-01, -1.919376643540684E+00, 9.961384490280367E-01, -1.919376643540684E+00, 9.922768980560734E-01 }, /* 2073 Hz */
-    { 9.961365934222505E-01, -1.919303150821246E+00, 9.961365934222505E-01, -1.919303150821246E+00, 9.922731868445009E-01 }, /* 2074 Hz */
-    { 9.961347378233506E-01, -1.919229625488880E+00, 9.961347378233506E-01, -1.919229625488880E+00, 9.922694756467012E-01 }, /* 2075 Hz */
-    { 9.961328822313370E-01, -1.919156067544968E+00, 9.961328822313370E-01, -1.919156067544968E+00, 9.922657644626740E-01 }, /* 2076 Hz */
-    { 9.961310266462094E-01, -1.919082476990889E+00, 9.961310266462094E-01, -1.919082476990889E+00, 9.922620532924189E-01 }, /* 2077 Hz */
-    { 9.961291710679682E-01, -1.919008853828027E+00, 9.961291710679682E-01, -1.919008853828027E+00, 9.922583421359363E-01 }, /* 2078 Hz */
-    { 9.961273154966128E-01, -1.918935198057764E+00, 9.961273154966128E-01, -1.918935198057764E+00, 9.922546309932256E-01 }, /* 2079 Hz */
-    { 9.961254599321437E-01, -1.918861509681483E+00, 9.961254599321437E-01, -1.918861509681483E+00, 9.922509198642875E-01 }, /* 2080 Hz */
-    { 9.961236043745607E-01, -1.918787788700567E+00, 9.961236043745607E-01, -1.918787788700567E+00, 9.922472087491214E-01 }, /* 2081 Hz */
-    { 9.961217488238635E-01, -1.918714035116400E+00, 9.961217488238635E-01, -1.918714035116400E+00, 9.922434976477270E-01 }, /* 2082 Hz */
-    { 9.961198932800521E-01, -1.918640248930368E+00, 9.961198932800521E-01, -1.918640248930368E+00, 9.922397865601043E-01 }, /* 2083 Hz */
-    { 9.961180377431266E-01, -1.918566430143855E+00, 9.961180377431266E-01, -1.918566430143855E+00, 9.922360754862531E-01 }, /* 2084 Hz */
-    { 9.961161822130870E-01, -1.918492578758248E+00, 9.961161822130870E-01, -1.918492578758248E+00, 9.922323644261739E-01 }, /* 2085 Hz */
-    { 9.961143266899330E-01, -1.918418694774932E+00, 9.961143266899330E-01, -1.918418694774932E+00, 9.922286533798661E-01 }, /* 2086 Hz */
-    { 9.961124711736650E-01, -1.918344778195295E+00, 9.961124711736650E-01, -1.918344778195295E+00, 9.922249423473299E-01 }, /* 2087 Hz */
-    { 9.961106156642824E-01, -1.918270829020723E+00, 9.961106156642824E-01, -1.918270829020723E+00, 9.922212313285648E-01 }, /* 2088 Hz */
-    { 9.961087601617854E-01, -1.918196847252605E+00, 9.961087601617854E-01, -1.918196847252605E+00, 9.922175203235708E-01 }, /* 2089 Hz */
-    { 9.961069046661739E-01, -1.918122832892330E+00, 9.961069046661739E-01, -1.918122832892330E+00, 9.922138093323478E-01 }, /* 2090 Hz */
-    { 9.961050491774481E-01, -1.918048785941287E+00, 9.961050491774481E-01, -1.918048785941287E+00, 9.922100983548963E-01 }, /* 2091 Hz */
-    { 9.961031936956077E-01, -1.917974706400864E+00, 9.961031936956077E-01, -1.917974706400864E+00, 9.922063873912155E-01 }, /* 2092 Hz */
-    { 9.961013382206524E-01, -1.917900594272453E+00, 9.961013382206524E-01, -1.917900594272453E+00, 9.922026764413048E-01 }, /* 2093 Hz */
-    { 9.960994827525828E-01, -1.917826449557444E+00, 9.960994827525828E-01, -1.917826449557444E+00, 9.921989655051655E-01 }, /* 2094 Hz */
-    { 9.960976272913983E-01, -1.917752272257229E+00, 9.960976272913983E-01, -1.917752272257229E+00, 9.921952545827966E-01 }, /* 2095 Hz */
-    { 9.960957718370991E-01, -1.917678062373199E+00, 9.960957718370991E-01, -1.917678062373199E+00, 9.921915436741982E-01 }, /* 2096 Hz */
-    { 9.960939163896850E-01, -1.917603819906747E+00, 9.960939163896850E-01, -1.917603819906747E+00, 9.921878327793701E-01 }, /* 2097 Hz */
-    { 9.960920609491561E-01, -1.917529544859265E+00, 9.960920609491561E-01, -1.917529544859265E+00, 9.921841218983123E-01 }, /* 2098 Hz */
-    { 9.960902055155123E-01, -1.917455237232148E+00, 9.960902055155123E-01, -1.917455237232148E+00, 9.921804110310246E-01 }, /* 2099 Hz */
-    { 9.960883500887534E-01, -1.917380897026789E+00, 9.960883500887534E-01, -1.917380897026789E+00, 9.921767001775068E-01 }, /* 2100 Hz */
-    { 9.960864946688796E-01, -1.917306524244583E+00, 9.960864946688796E-01, -1.917306524244583E+00, 9.921729893377591E-01 }, /* 2101 Hz */
-    { 9.960846392558906E-01, -1.917232118886925E+00, 9.960846392558906E-01, -1.917232118886925E+00, 9.921692785117813E-01 }, /* 2102 Hz */
-    { 9.960827838497868E-01, -1.917157680955212E+00, 9.960827838497868E-01, -1.917157680955212E+00, 9.921655676995735E-01 }, /* 2103 Hz */
-    { 9.960809284505675E-01, -1.917083210450838E+00, 9.960809284505675E-01, -1.917083210450838E+00, 9.921618569011350E-01 }, /* 2104 Hz */
-    { 9.960790730582332E-01, -1.917008707375202E+00, 9.960790730582332E-01, -1.917008707375202E+00, 9.921581461164664E-01 }, /* 2105 Hz */
-    { 9.960772176727833E-01, -1.916934171729699E+00, 9.960772176727833E-01, -1.916934171729699E+00, 9.921544353455667E-01 }, /* 2106 Hz */
-    { 9.960753622942184E-01, -1.916859603515730E+00, 9.960753622942184E-01, -1.916859603515730E+00, 9.921507245884369E-01 }, /* 2107 Hz */
-    { 9.960735069225379E-01, -1.916785002734691E+00, 9.960735069225379E-01, -1.916785002734691E+00, 9.921470138450759E-01 }, /* 2108 Hz */
-    { 9.960716515577420E-01, -1.916710369387982E+00, 9.960716515577420E-01, -1.916710369387982E+00, 9.921433031154840E-01 }, /* 2109 Hz */
-    { 9.960697961998307E-01, -1.916635703477002E+00, 9.960697961998307E-01, -1.916635703477002E+00, 9.921395923996614E-01 }, /* 2110 Hz */
-    { 9.960679408488039E-01, -1.916561005003153E+00, 9.960679408488039E-01, -1.916561005003153E+00, 9.921358816976078E-01 }, /* 2111 Hz */
-    { 9.960660855046615E-01, -1.916486273967833E+00, 9.960660855046615E-01, -1.916486273967833E+00, 9.921321710093229E-01 }, /* 2112 Hz */
-    { 9.960642301674033E-01, -1.916411510372445E+00, 9.960642301674033E-01, -1.916411510372445E+00, 9.921284603348066E-01 }, /* 2113 Hz */
-    { 9.960623748370296E-01, -1.916336714218391E+00, 9.960623748370296E-01, -1.916336714218391E+00, 9.921247496740593E-01 }, /* 2114 Hz */
-    { 9.960605195135401E-01, -1.916261885507073E+00, 9.960605195135401E-01, -1.916261885507073E+00, 9.921210390270803E-01 }, /* 2115 Hz */
-    { 9.960586641969348E-01, -1.916187024239893E+00, 9.960586641969348E-01, -1.916187024239893E+00, 9.921173283938696E-01 }, /* 2116 Hz */
-    { 9.960568088872137E-01, -1.916112130418255E+00, 9.960568088872137E-01, -1.916112130418255E+00, 9.921136177744274E-01 }, /* 2117 Hz */
-    { 9.960549535843767E-01, -1.916037204043564E+00, 9.960549535843767E-01, -1.916037204043564E+00, 9.921099071687534E-01 }, /* 2118 Hz */
-    { 9.960530982884238E-01, -1.915962245117223E+00, 9.960530982884238E-01, -1.915962245117223E+00, 9.921061965768476E-01 }, /* 2119 Hz */
-    { 9.960512429993548E-01, -1.915887253640638E+00, 9.960512429993548E-01, -1.915887253640638E+00, 9.921024859987095E-01 }, /* 2120 Hz */
-    { 9.960493877171698E-01, -1.915812229615215E+00, 9.960493877171698E-01, -1.915812229615215E+00, 9.920987754343396E-01 }, /* 2121 Hz */
-    { 9.960475324418687E-01, -1.915737173042360E+00, 9.960475324418687E-01, -1.915737173042360E+00, 9.920950648837374E-01 }, /* 2122 Hz */
-    { 9.960456771734513E-01, -1.915662083923479E+00, 9.960456771734513E-01, -1.915662083923479E+00, 9.920913543469025E-01 }, /* 2123 Hz */
-    { 9.960438219119179E-01, -1.915586962259980E+00, 9.960438219119179E-01, -1.915586962259980E+00, 9.920876438238357E-01 }, /* 2124 Hz */
-    { 9.960419666572683E-01, -1.915511808053271E+00, 9.960419666572683E-01, -1.915511808053271E+00, 9.920839333145366E-01 }, /* 2125 Hz */
-    { 9.960401114095022E-01, -1.915436621304761E+00, 9.960401114095022E-01, -1.915436621304761E+00, 9.920802228190044E-01 }, /* 2126 Hz */
-    { 9.960382561686197E-01, -1.915361402015857E+00, 9.960382561686197E-01, -1.915361402015857E+00, 9.920765123372395E-01 }, /* 2127 Hz */
-    { 9.960364009346210E-01, -1.915286150187970E+00, 9.960364009346210E-01, -1.915286150187970E+00, 9.920728018692420E-01 }, /* 2128 Hz */
-    { 9.960345457075058E-01, -1.915210865822510E+00, 9.960345457075058E-01, -1.915210865822510E+00, 9.920690914150117E-01 }, /* 2129 Hz */
-    { 9.960326904872741E-01, -1.915135548920888E+00, 9.960326904872741E-01, -1.915135548920888E+00, 9.920653809745481E-01 }, /* 2130 Hz */
-    { 9.960308352739258E-01, -1.915060199484514E+00, 9.960308352739258E-01, -1.915060199484514E+00, 9.920616705478515E-01 }, /* 2131 Hz */
-    { 9.960289800674609E-01, -1.914984817514801E+00, 9.960289800674609E-01, -1.914984817514801E+00, 9.920579601349218E-01 }, /* 2132 Hz */
-    { 9.960271248678794E-01, -1.914909403013161E+00, 9.960271248678794E-01, -1.914909403013161E+00, 9.920542497357587E-01 }, /* 2133 Hz */
-    { 9.960252696751810E-01, -1.914833955981005E+00, 9.960252696751810E-01, -1.914833955981005E+00, 9.920505393503620E-01 }, /* 2134 Hz */
-    { 9.960234144893659E-01, -1.914758476419750E+00, 9.960234144893659E-01, -1.914758476419750E+00, 9.920468289787319E-01 }, /* 2135 Hz */
-    { 9.960215593104341E-01, -1.914682964330807E+00, 9.960215593104341E-01, -1.914682964330807E+00, 9.920431186208682E-01 }, /* 2136 Hz */
-    { 9.960197041383853E-01, -1.914607419715591E+00, 9.960197041383853E-01, -1.914607419715591E+00, 9.920394082767705E-01 }, /* 2137 Hz */
-    { 9.960178489732195E-01, -1.914531842575518E+00, 9.960178489732195E-01, -1.914531842575518E+00, 9.920356979464391E-01 }, /* 2138 Hz */
-    { 9.960159938149370E-01, -1.914456232912003E+00, 9.960159938149370E-01, -1.914456232912003E+00, 9.920319876298740E-01 }, /* 2139 Hz */
-    { 9.960141386635374E-01, -1.914380590726463E+00, 9.960141386635374E-01, -1.914380590726463E+00, 9.920282773270748E-01 }, /* 2140 Hz */
-    { 9.960122835190206E-01, -1.914304916020313E+00, 9.960122835190206E-01, -1.914304916020313E+00, 9.920245670380412E-01 }, /* 2141 Hz */
-    { 9.960104283813869E-01, -1.914229208794972E+00, 9.960104283813869E-01, -1.914229208794972E+00, 9.920208567627737E-01 }, /* 2142 Hz */
-    { 9.960085732506356E-01, -1.914153469051856E+00, 9.960085732506356E-01, -1.914153469051856E+00, 9.920171465012713E-01 }, /* 2143 Hz */
-    { 9.960067181267676E-01, -1.914077696792386E+00, 9.960067181267676E-01, -1.914077696792386E+00, 9.920134362535351E-01 }, /* 2144 Hz */
-    { 9.960048630097820E-01, -1.914001892017978E+00, 9.960048630097820E-01, -1.914001892017978E+00, 9.920097260195639E-01 }, /* 2145 Hz */
-    { 9.960030078996792E-01, -1.913926054730054E+00, 9.960030078996792E-01, -1.913926054730054E+00, 9.920060157993584E-01 }, /* 2146 Hz */
-    { 9.960011527964588E-01, -1.913850184930032E+00, 9.960011527964588E-01, -1.913850184930032E+00, 9.920023055929177E-01 }, /* 2147 Hz */
-    { 9.959992977001212E-01, -1.913774282619333E+00, 9.959992977001212E-01, -1.913774282619333E+00, 9.919985954002424E-01 }, /* 2148 Hz */
-    { 9.959974426106661E-01, -1.913698347799380E+00, 9.959974426106661E-01, -1.913698347799380E+00, 9.919948852213323E-01 }, /* 2149 Hz */
-    { 9.959955875280934E-01, -1.913622380471592E+00, 9.959955875280934E-01, -1.913622380471592E+00, 9.919911750561867E-01 }, /* 2150 Hz */
-    { 9.959937324524032E-01, -1.913546380637393E+00, 9.959937324524032E-01, -1.913546380637393E+00, 9.919874649048064E-01 }, /* 2151 Hz */
-    { 9.959918773835952E-01, -1.913470348298205E+00, 9.959918773835952E-01, -1.913470348298205E+00, 9.919837547671904E-01 }, /* 2152 Hz */
-    { 9.959900223216697E-01, -1.913394283455451E+00, 9.959900223216697E-01, -1.913394283455451E+00, 9.919800446433393E-01 }, /* 2153 Hz */
-    { 9.959881672666263E-01, -1.913318186110557E+00, 9.959881672666263E-01, -1.913318186110557E+00, 9.919763345332526E-01 }, /* 2154 Hz */
-    { 9.959863122184652E-01, -1.913242056264945E+00, 9.959863122184652E-01, -1.913242056264945E+00, 9.919726244369305E-01 }, /* 2155 Hz */
-    { 9.959844571771862E-01, -1.913165893920040E+00, 9.959844571771862E-01, -1.913165893920040E+00, 9.919689143543724E-01 }, /* 2156 Hz */
-    { 9.959826021427893E-01, -1.913089699077269E+00, 9.959826021427893E-01, -1.913089699077269E+00, 9.919652042855787E-01 }, /* 2157 Hz */
-    { 9.959807471152745E-01, -1.913013471738058E+00, 9.959807471152745E-01, -1.913013471738058E+00, 9.919614942305490E-01 }, /* 2158 Hz */
-    { 9.959788920946417E-01, -1.912937211903832E+00, 9.959788920946417E-01, -1.912937211903832E+00, 9.919577841892835E-01 }, /* 2159 Hz */
-    { 9.959770370808909E-01, -1.912860919576020E+00, 9.959770370808909E-01, -1.912860919576020E+00, 9.919540741617818E-01 }, /* 2160 Hz */
-    { 9.959751820740220E-01, -1.912784594756049E+00, 9.959751820740220E-01, -1.912784594756049E+00, 9.919503641480441E-01 }, /* 2161 Hz */
-    { 9.959733270740350E-01, -1.912708237445348E+00, 9.959733270740350E-01, -1.912708237445348E+00, 9.919466541480699E-01 }, /* 2162 Hz */
-    { 9.959714720809296E-01, -1.912631847645344E+00, 9.959714720809296E-01, -1.912631847645344E+00, 9.919429441618592E-01 }, /* 2163 Hz */
-    { 9.959696170947060E-01, -1.912555425357467E+00, 9.959696170947060E-01, -1.912555425357467E+00, 9.919392341894120E-01 }, /* 2164 Hz */
-    { 9.959677621153643E-01, -1.912478970583149E+00, 9.959677621153643E-01, -1.912478970583149E+00, 9.919355242307286E-01 }, /* 2165 Hz */
-    { 9.959659071429040E-01, -1.912402483323818E+00, 9.959659071429040E-01, -1.912402483323818E+00, 9.919318142858080E-01 }, /* 2166 Hz */
-    { 9.959640521773254E-01, -1.912325963580907E+00, 9.959640521773254E-01, -1.912325963580907E+00, 9.919281043546508E-01 }, /* 2167 Hz */
-    { 9.959621972186284E-01, -1.912249411355846E+00, 9.959621972186284E-01, -1.912249411355846E+00, 9.919243944372569E-01 }, /* 2168 Hz */
-    { 9.959603422668127E-01, -1.912172826650067E+00, 9.959603422668127E-01, -1.912172826650067E+00, 9.919206845336255E-01 }, /* 2169 Hz */
-    { 9.959584873218786E-01, -1.912096209465004E+00, 9.959584873218786E-01, -1.912096209465004E+00, 9.919169746437573E-01 }, /* 2170 Hz */
-    { 9.959566323838258E-01, -1.912019559802090E+00, 9.959566323838258E-01, -1.912019559802090E+00, 9.919132647676516E-01 }, /* 2171 Hz */
-    { 9.959547774526544E-01, -1.911942877662758E+00, 9.959547774526544E-01, -1.911942877662758E+00, 9.919095549053087E-01 }, /* 2172 Hz */
-    { 9.959529225283644E-01, -1.911866163048444E+00, 9.959529225283644E-01, -1.911866163048444E+00, 9.919058450567289E-01 }, /* 2173 Hz */
-    { 9.959510676109555E-01, -1.911789415960581E+00, 9.959510676109555E-01, -1.911789415960581E+00, 9.919021352219111E-01 }, /* 2174 Hz */
-    { 9.959492127004278E-01, -1.911712636400605E+00, 9.959492127004278E-01, -1.911712636400605E+00, 9.918984254008556E-01 }, /* 2175 Hz */
-    { 9.959473577967811E-01, -1.911635824369951E+00, 9.959473577967811E-01, -1.911635824369951E+00, 9.918947155935622E-01 }, /* 2176 Hz */
-    { 9.959455029000157E-01, -1.911558979870059E+00, 9.959455029000157E-01, -1.911558979870059E+00, 9.918910058000314E-01 }, /* 2177 Hz */
-    { 9.959436480101312E-01, -1.911482102902362E+00, 9.959436480101312E-01, -1.911482102902362E+00, 9.918872960202625E-01 }, /* 2178 Hz */
-    { 9.959417931271279E-01, -1.911405193468301E+00, 9.959417931271279E-01, -1.911405193468301E+00, 9.918835862542559E-01 }, /* 2179 Hz */
-    { 9.959399382510054E-01, -1.911328251569312E+00, 9.959399382510054E-01, -1.911328251569312E+00, 9.918798765020107E-01 }, /* 2180 Hz */
-    { 9.959380833817635E-01, -1.911251277206834E+00, 9.959380833817635E-01, -1.911251277206834E+00, 9.918761667635270E-01 }, /* 2181 Hz */
-    { 9.959362285194029E-01, -1.911174270382307E+00, 9.959362285194029E-01, -1.911174270382307E+00, 9.918724570388058E-01 }, /* 2182 Hz */
-    { 9.959343736639227E-01, -1.911097231097170E+00, 9.959343736639227E-01, -1.911097231097170E+00, 9.918687473278454E-01 }, /* 2183 Hz */
-    { 9.959325188153233E-01, -1.911020159352865E+00, 9.959325188153233E-01, -1.911020159352865E+00, 9.918650376306466E-01 }, /* 2184 Hz */
-    { 9.959306639736046E-01, -1.910943055150831E+00, 9.959306639736046E-01, -1.910943055150831E+00, 9.918613279472093E-01 }, /* 2185 Hz */
-    { 9.959288091387667E-01, -1.910865918492511E+00, 9.959288091387667E-01, -1.910865918492511E+00, 9.918576182775334E-01 }, /* 2186 Hz */
-    { 9.959269543108091E-01, -1.910788749379347E+00, 9.959269543108091E-01, -1.910788749379347E+00, 9.918539086216183E-01 }, /* 2187 Hz */
-    { 9.959250994897322E-01, -1.910711547812780E+00, 9.959250994897322E-01, -1.910711547812780E+00, 9.918501989794644E-01 }, /* 2188 Hz */
-    { 9.959232446755356E-01, -1.910634313794255E+00, 9.959232446755356E-01, -1.910634313794255E+00, 9.918464893510712E-01 }, /* 2189 Hz */
-    { 9.959213898682197E-01, -1.910557047325215E+00, 9.959213898682197E-01, -1.910557047325215E+00, 9.918427797364393E-01 }, /* 2190 Hz */
-    { 9.959195350677837E-01, -1.910479748407103E+00, 9.959195350677837E-01, -1.910479748407103E+00, 9.918390701355675E-01 }, /* 2191 Hz */
-    { 9.959176802742286E-01, -1.910402417041367E+00, 9.959176802742286E-01, -1.910402417041367E+00, 9.918353605484571E-01 }, /* 2192 Hz */
-    { 9.959158254875533E-01, -1.910325053229449E+00, 9.959158254875533E-01, -1.910325053229449E+00, 9.918316509751066E-01 }, /* 2193 Hz */
-    { 9.959139707077583E-01, -1.910247656972797E+00, 9.959139707077583E-01, -1.910247656972797E+00, 9.918279414155167E-01 }, /* 2194 Hz */
-    { 9.959121159348436E-01, -1.910170228272856E+00, 9.959121159348436E-01, -1.910170228272856E+00, 9.918242318696873E-01 }, /* 2195 Hz */
-    { 9.959102611688088E-01, -1.910092767131074E+00, 9.959102611688088E-01, -1.910092767131074E+00, 9.918205223376175E-01 }, /* 2196 Hz */
-    { 9.959084064096544E-01, -1.910015273548899E+00, 9.959084064096544E-01, -1.910015273548899E+00, 9.918168128193088E-01 }, /* 2197 Hz */
-    { 9.959065516573797E-01, -1.909937747527777E+00, 9.959065516573797E-01, -1.909937747527777E+00, 9.918131033147595E-01 }, /* 2198 Hz */
-    { 9.959046969119850E-01, -1.909860189069159E+00, 9.959046969119850E-01, -1.909860189069159E+00, 9.918093938239700E-01 }, /* 2199 Hz */
-    { 9.959028421734704E-01, -1.909782598174494E+00, 9.959028421734704E-01, -1.909782598174494E+00, 9.918056843469407E-01 }, /* 2200 Hz */
-    { 9.959009874418354E-01, -1.909704974845230E+00, 9.959009874418354E-01, -1.909704974845230E+00, 9.918019748836708E-01 }, /* 2201 Hz */
-    { 9.958991327170803E-01, -1.909627319082818E+00, 9.958991327170803E-01, -1.909627319082818E+00, 9.917982654341606E-01 }, /* 2202 Hz */
-    { 9.958972779992050E-01, -1.909549630888710E+00, 9.958972779992050E-01, -1.909549630888710E+00, 9.917945559984100E-01 }, /* 2203 Hz */
-    { 9.958954232882093E-01, -1.909471910264356E+00, 9.958954232882093E-01, -1.909471910264356E+00, 9.917908465764187E-01 }, /* 2204 Hz */
-    { 9.958935685840933E-01, -1.909394157211209E+00, 9.958935685840933E-01, -1.909394157211209E+00, 9.917871371681866E-01 }, /* 2205 Hz */
-    { 9.958917138868569E-01, -1.909316371730720E+00, 9.958917138868569E-01, -1.909316371730720E+00, 9.917834277737139E-01 }, /* 2206 Hz */
-    { 9.958898591965000E-01, -1.909238553824344E+00, 9.958898591965000E-01, -1.909238553824344E+00, 9.917797183929999E-01 }, /* 2207 Hz */
-    { 9.958880045130227E-01, -1.909160703493534E+00, 9.958880045130227E-01, -1.909160703493534E+00, 9.917760090260455E-01 }, /* 2208 Hz */
-    { 9.958861498364247E-01, -1.909082820739743E+00, 9.958861498364247E-01, -1.909082820739743E+00, 9.917722996728493E-01 }, /* 2209 Hz */
-    { 9.958842951667063E-01, -1.909004905564428E+00, 9.958842951667063E-01, -1.909004905564428E+00, 9.917685903334126E-01 }, /* 2210 Hz */
-    { 9.958824405038670E-01, -1.908926957969041E+00, 9.958824405038670E-01, -1.908926957969041E+00, 9.917648810077340E-01 }, /* 2211 Hz */
-    { 9.958805858479071E-01, -1.908848977955041E+00, 9.958805858479071E-01, -1.908848977955041E+00, 9.917611716958141E-01 }, /* 2212 Hz */
-    { 9.958787311988263E-01, -1.908770965523882E+00, 9.958787311988263E-01, -1.908770965523882E+00, 9.917574623976526E-01 }, /* 2213 Hz */
-    { 9.958768765566249E-01, -1.908692920677023E+00, 9.958768765566249E-01, -1.908692920677023E+00, 9.917537531132499E-01 }, /* 2214 Hz */
-    { 9.958750219213025E-01, -1.908614843415919E+00, 9.958750219213025E-01, -1.908614843415919E+00, 9.917500438426050E-01 }, /* 2215 Hz */
-    { 9.958731672928591E-01, -1.908536733742030E+00, 9.958731672928591E-01, -1.908536733742030E+00, 9.917463345857183E-01 }, /* 2216 Hz */
-    { 9.958713126712949E-01, -1.908458591656814E+00, 9.958713126712949E-01, -1.908458591656814E+00, 9.917426253425898E-01 }, /* 2217 Hz */
-    { 9.958694580566096E-01, -1.908380417161730E+00, 9.958694580566096E-01, -1.908380417161730E+00, 9.917389161132193E-01 }, /* 2218 Hz */
-    { 9.958676034488033E-01, -1.908302210258237E+00, 9.958676034488033E-01, -1.908302210258237E+00, 9.917352068976066E-01 }, /* 2219 Hz */
-    { 9.958657488478758E-01, -1.908223970947796E+00, 9.958657488478758E-01, -1.908223970947796E+00, 9.917314976957516E-01 }, /* 2220 Hz */
-    { 9.958638942538272E-01, -1.908145699231868E+00, 9.958638942538272E-01, -1.908145699231868E+00, 9.917277885076543E-01 }, /* 2221 Hz */
-    { 9.958620396666574E-01, -1.908067395111914E+00, 9.958620396666574E-01, -1.908067395111914E+00, 9.917240793333149E-01 }, /* 2222 Hz */
-    { 9.958601850863662E-01, -1.907989058589395E+00, 9.958601850863662E-01, -1.907989058589395E+00, 9.917203701727324E-01 }, /* 2223 Hz */
-    { 9.958583305129538E-01, -1.907910689665775E+00, 9.958583305129538E-01, -1.907910689665775E+00, 9.917166610259076E-01 }, /* 2224 Hz */
-    { 9.958564759464200E-01, -1.907832288342516E+00, 9.958564759464200E-01, -1.907832288342516E+00, 9.917129518928400E-01 }, /* 2225 Hz */
-    { 9.958546213867646E-01, -1.907753854621081E+00, 9.958546213867646E-01, -1.907753854621081E+00, 9.917092427735292E-01 }, /* 2226 Hz */
-    { 9.958527668339880E-01, -1.907675388502935E+00, 9.958527668339880E-01, -1.907675388502935E+00, 9.917055336679761E-01 }, /* 2227 Hz */
-    { 9.958509122880896E-01, -1.907596889989542E+00, 9.958509122880896E-01, -1.907596889989542E+00, 9.917018245761793E-01 }, /* 2228 Hz */
-    { 9.958490577490698E-01, -1.907518359082367E+00, 9.958490577490698E-01, -1.907518359082367E+00, 9.916981154981397E-01 }, /* 2229 Hz */
-    { 9.958472032169283E-01, -1.907439795782876E+00, 9.958472032169283E-01, -1.907439795782876E+00, 9.916944064338566E-01 }, /* 2230 Hz */
-    { 9.958453486916651E-01, -1.907361200092536E+00, 9.958453486916651E-01, -1.907361200092536E+00, 9.916906973833302E-01 }, /* 2231 Hz */
-    { 9.958434941732801E-01, -1.907282572012813E+00, 9.958434941732801E-01, -1.907282572012813E+00, 9.916869883465602E-01 }, /* 2232 Hz */
-    { 9.958416396617735E-01, -1.907203911545174E+00, 9.958416396617735E-01, -1.907203911545174E+00, 9.916832793235471E-01 }, /* 2233 Hz */
-    { 9.958397851571450E-01, -1.907125218691087E+00, 9.958397851571450E-01, -1.907125218691087E+00, 9.916795703142900E-01 }, /* 2234 Hz */
-    { 9.958379306593944E-01, -1.907046493452021E+00, 9.958379306593944E-01, -1.907046493452021E+00, 9.916758613187888E-01 }, /* 2235 Hz */
-    { 9.958360761685221E-01, -1.906967735829445E+00, 9.958360761685221E-01, -1.906967735829445E+00, 9.916721523370442E-01 }, /* 2236 Hz */
-    { 9.958342216845277E-01, -1.906888945824829E+00, 9.958342216845277E-01, -1.906888945824829E+00, 9.916684433690555E-01 }, /* 2237 Hz */
-    { 9.958323672074114E-01, -1.906810123439641E+00, 9.958323672074114E-01, -1.906810123439641E+00, 9.916647344148228E-01 }, /* 2238 Hz */
-    { 9.958305127371728E-01, -1.906731268675354E+00, 9.958305127371728E-01, -1.906731268675354E+00, 9.916610254743456E-01 }, /* 2239 Hz */
-    { 9.958286582738123E-01, -1.906652381533437E+00, 9.958286582738123E-01, -1.906652381533437E+00, 9.916573165476246E-01 }, /* 2240 Hz */
-    { 9.958268038173292E-01, -1.906573462015364E+00, 9.958268038173292E-01, -1.906573462015364E+00, 9.916536076346585E-01 }, /* 2241 Hz */
-    { 9.958249493677241E-01, -1.906494510122605E+00, 9.958249493677241E-01, -1.906494510122605E+00, 9.916498987354483E-01 }, /* 2242 Hz */
-    { 9.958230949249969E-01, -1.906415525856635E+00, 9.958230949249969E-01, -1.906415525856635E+00, 9.916461898499938E-01 }, /* 2243 Hz */
-    { 9.958212404891470E-01, -1.906336509218926E+00, 9.958212404891470E-01, -1.906336509218926E+00, 9.916424809782940E-01 }, /* 2244 Hz */
-    { 9.958193860601749E-01, -1.906257460210953E+00, 9.958193860601749E-01, -1.906257460210953E+00, 9.916387721203499E-01 }, /* 2245 Hz */
-    { 9.958175316380803E-01, -1.906178378834189E+00, 9.958175316380803E-01, -1.906178378834189E+00, 9.916350632761606E-01 }, /* 2246 Hz */
-    { 9.958156772228630E-01, -1.906099265090109E+00, 9.958156772228630E-01, -1.906099265090109E+00, 9.916313544457260E-01 }, /* 2247 Hz */
-    { 9.958138228145235E-01, -1.906020118980191E+00, 9.958138228145235E-01, -1.906020118980191E+00, 9.916276456290469E-01 }, /* 2248 Hz */
-    { 9.958119684130611E-01, -1.905940940505908E+00, 9.958119684130611E-01, -1.905940940505908E+00, 9.916239368261222E-01 }, /* 2249 Hz */
-    { 9.958101140184763E-01, -1.905861729668740E+00, 9.958101140184763E-01, -1.905861729668740E+00, 9.916202280369526E-01 }, /* 2250 Hz */
-    { 9.958082596307686E-01, -1.905782486470161E+00, 9.958082596307686E-01, -1.905782486470161E+00, 9.916165192615372E-01 }, /* 2251 Hz */
-    { 9.958064052499380E-01, -1.905703210911650E+00, 9.958064052499380E-01, -1.905703210911650E+00, 9.916128104998760E-01 }, /* 2252 Hz */
-    { 9.958045508759849E-01, -1.905623902994686E+00, 9.958045508759849E-01, -1.905623902994686E+00, 9.916091017519697E-01 }, /* 2253 Hz */
-    { 9.958026965089087E-01, -1.905544562720748E+00, 9.958026965089087E-01, -1.905544562720748E+00, 9.916053930178175E-01 }, /* 2254 Hz */
-    { 9.958008421487098E-01, -1.905465190091314E+00, 9.958008421487098E-01, -1.905465190091314E+00, 9.916016842974196E-01 }, /* 2255 Hz */
-    { 9.957989877953878E-01, -1.905385785107865E+00, 9.957989877953878E-01, -1.905385785107865E+00, 9.915979755907756E-01 }, /* 2256 Hz */
-    { 9.957971334489428E-01, -1.905306347771881E+00, 9.957971334489428E-01, -1.905306347771881E+00, 9.915942668978857E-01 }, /* 2257 Hz */
-    { 9.957952791093748E-01, -1.905226878084843E+00, 9.957952791093748E-01, -1.905226878084843E+00, 9.915905582187496E-01 }, /* 2258 Hz */
-    { 9.957934247766834E-01, -1.905147376048233E+00, 9.957934247766834E-01, -1.905147376048233E+00, 9.915868495533668E-01 }, /* 2259 Hz */
-    { 9.957915704508692E-01, -1.905067841663533E+00, 9.957915704508692E-01, -1.905067841663533E+00, 9.915831409017384E-01 }, /* 2260 Hz */
-    { 9.957897161319315E-01, -1.904988274932226E+00, 9.957897161319315E-01, -1.904988274932226E+00, 9.915794322638629E-01 }, /* 2261 Hz */
-    { 9.957878618198708E-01, -1.904908675855795E+00, 9.957878618198708E-01, -1.904908675855795E+00, 9.915757236397416E-01 }, /* 2262 Hz */
-    { 9.957860075146865E-01, -1.904829044435723E+00, 9.957860075146865E-01, -1.904829044435723E+00, 9.915720150293730E-01 }, /* 2263 Hz */
-    { 9.957841532163790E-01, -1.904749380673496E+00, 9.957841532163790E-01, -1.904749380673496E+00, 9.915683064327581E-01 }, /* 2264 Hz */
-    { 9.957822989249479E-01, -1.904669684570597E+00, 9.957822989249479E-01, -1.904669684570597E+00, 9.915645978498957E-01 }, /* 2265 Hz */
-    { 9.957804446403936E-01, -1.904589956128514E+00, 9.957804446403936E-01, -1.904589956128514E+00, 9.915608892807872E-01 }, /* 2266 Hz */
-    { 9.957785903627155E-01, -1.904510195348731E+00, 9.957785903627155E-01, -1.904510195348731E+00, 9.915571807254311E-01 }, /* 2267 Hz */
-    { 9.957767360919139E-01, -1.904430402232735E+00, 9.957767360919139E-01, -1.904430402232735E+00, 9.915534721838277E-01 }, /* 2268 Hz */
-    { 9.957748818279888E-01, -1.904350576782013E+00, 9.957748818279888E-01, -1.904350576782013E+00, 9.915497636559776E-01 }, /* 2269 Hz */
-    { 9.957730275709399E-01, -1.904270718998052E+00, 9.957730275709399E-01, -1.904270718998052E+00, 9.915460551418798E-01 }, /* 2270 Hz */
-    { 9.957711733207673E-01, -1.904190828882341E+00, 9.957711733207673E-01, -1.904190828882341E+00, 9.915423466415345E-01 }, /* 2271 Hz */
-    { 9.957693190774708E-01, -1.904110906436369E+00, 9.957693190774708E-01, -1.904110906436369E+00, 9.915386381549416E-01 }, /* 2272 Hz */
-    { 9.957674648410506E-01, -1.904030951661626E+00, 9.957674648410506E-01, -1.904030951661626E+00, 9.915349296821012E-01 }, /* 2273 Hz */
-    { 9.957656106115064E-01, -1.903950964559599E+00, 9.957656106115064E-01, -1.903950964559599E+00, 9.915312212230127E-01 }, /* 2274 Hz */
-    { 9.957637563888383E-01, -1.903870945131781E+00, 9.957637563888383E-01, -1.903870945131781E+00, 9.915275127776766E-01 }, /* 2275 Hz */
-    { 9.957619021730463E-01, -1.903790893379662E+00, 9.957619021730463E-01, -1.903790893379662E+00, 9.915238043460926E-01 }, /* 2276 Hz */
-    { 9.957600479641302E-01, -1.903710809304734E+00, 9.957600479641302E-01, -1.903710809304734E+00, 9.915200959282604E-01 }, /* 2277 Hz */
-    { 9.957581937620900E-01, -1.903630692908488E+00, 9.957581937620900E-01, -1.903630692908488E+00, 9.915163875241799E-01 }, /* 2278 Hz */
-    { 9.957563395669257E-01, -1.903550544192417E+00, 9.957563395669257E-01, -1.903550544192417E+00, 9.915126791338513E-01 }, /* 2279 Hz */
-    { 9.957544853786371E-01, -1.903470363158015E+00, 9.957544853786371E-01, -1.903470363158015E+00, 9.915089707572742E-01 }, /* 2280 Hz */
-    { 9.957526311972243E-01, -1.903390149806774E+00, 9.957526311972243E-01, -1.903390149806774E+00, 9.915052623944487E-01 }, /* 2281 Hz */
-    { 9.957507770226871E-01, -1.903309904140189E+00, 9.957507770226871E-01, -1.903309904140189E+00, 9.915015540453742E-01 }, /* 2282 Hz */
-    { 9.957489228550257E-01, -1.903229626159755E+00, 9.957489228550257E-01, -1.903229626159755E+00, 9.914978457100514E-01 }, /* 2283 Hz */
-    { 9.957470686942399E-01, -1.903149315866968E+00, 9.957470686942399E-01, -1.903149315866968E+00, 9.914941373884798E-01 }, /* 2284 Hz */
-    { 9.957452145403296E-01, -1.903068973263323E+00, 9.957452145403296E-01, -1.903068973263323E+00, 9.914904290806592E-01 }, /* 2285 Hz */
-    { 9.957433603932949E-01, -1.902988598350315E+00, 9.957433603932949E-01, -1.902988598350315E+00, 9.914867207865898E-01 }, /* 2286 Hz */
-    { 9.957415062531354E-01, -1.902908191129444E+00, 9.957415062531354E-01, -1.902908191129444E+00, 9.914830125062708E-01 }, /* 2287 Hz */
-    { 9.957396521198516E-01, -1.902827751602205E+00, 9.957396521198516E-01, -1.902827751602205E+00, 9.914793042397032E-01 }, /* 2288 Hz */
-    { 9.957377979934429E-01, -1.902747279770097E+00, 9.957377979934429E-01, -1.902747279770097E+00, 9.914755959868857E-01 }, /* 2289 Hz */
-    { 9.957359438739096E-01, -1.902666775634619E+00, 9.957359438739096E-01, -1.902666775634619E+00, 9.914718877478192E-01 }, /* 2290 Hz */
-    { 9.957340897612514E-01, -1.902586239197269E+00, 9.957340897612514E-01, -1.902586239197269E+00, 9.914681795225029E-01 }, /* 2291 Hz */
-    { 9.957322356554686E-01, -1.902505670459548E+00, 9.957322356554686E-01, -1.902505670459548E+00, 9.914644713109373E-01 }, /* 2292 Hz */
-    { 9.957303815565609E-01, -1.902425069422955E+00, 9.957303815565609E-01, -1.902425069422955E+00, 9.914607631131218E-01 }, /* 2293 Hz */
-    { 9.957285274645281E-01, -1.902344436088991E+00, 9.957285274645281E-01, -1.902344436088991E+00, 9.914570549290562E-01 }, /* 2294 Hz */
-    { 9.957266733793706E-01, -1.902263770459158E+00, 9.957266733793706E-01, -1.902263770459158E+00, 9.914533467587412E-01 }, /* 2295 Hz */
-    { 9.957248193010878E-01, -1.902183072534958E+00, 9.957248193010878E-01, -1.902183072534958E+00, 9.914496386021756E-01 }, /* 2296 Hz */
-    { 9.957229652296803E-01, -1.902102342317893E+00, 9.957229652296803E-01, -1.902102342317893E+00, 9.914459304593606E-01 }, /* 2297 Hz */
-    { 9.957211111651473E-01, -1.902021579809465E+00, 9.957211111651473E-01, -1.902021579809465E+00, 9.914422223302946E-01 }, /* 2298 Hz */
-    { 9.957192571074894E-01, -1.901940785011180E+00, 9.957192571074894E-01, -1.901940785011180E+00, 9.914385142149789E-01 }, /* 2299 Hz */
-    { 9.957174030567062E-01, -1.901859957924539E+00, 9.957174030567062E-01, -1.901859957924539E+00, 9.914348061134124E-01 }, /* 2300 Hz */
-    { 9.957155490127978E-01, -1.901779098551049E+00, 9.957155490127978E-01, -1.901779098551049E+00, 9.914310980255956E-01 }, /* 2301 Hz */
-    { 9.957136949757639E-01, -1.901698206892214E+00, 9.957136949757639E-01, -1.901698206892214E+00, 9.914273899515278E-01 }, /* 2302 Hz */
-    { 9.957118409456046E-01, -1.901617282949540E+00, 9.957118409456046E-01, -1.901617282949540E+00, 9.914236818912092E-01 }, /* 2303 Hz */
-    { 9.957099869223200E-01, -1.901536326724534E+00, 9.957099869223200E-01, -1.901536326724534E+00, 9.914199738446401E-01 }, /* 2304 Hz */
-    { 9.957081329059100E-01, -1.901455338218701E+00, 9.957081329059100E-01, -1.901455338218701E+00, 9.914162658118200E-01 }, /* 2305 Hz */
-    { 9.957062788963744E-01, -1.901374317433551E+00, 9.957062788963744E-01, -1.901374317433551E+00, 9.914125577927488E-01 }, /* 2306 Hz */
-    { 9.957044248937131E-01, -1.901293264370589E+00, 9.957044248937131E-01, -1.901293264370589E+00, 9.914088497874263E-01 }, /* 2307 Hz */
-    { 9.957025708979264E-01, -1.901212179031325E+00, 9.957025708979264E-01, -1.901212179031325E+00, 9.914051417958527E-01 }, /* 2308 Hz */
-    { 9.957007169090140E-01, -1.901131061417268E+00, 9.957007169090140E-01, -1.901131061417268E+00, 9.914014338180279E-01 }, /* 2309 Hz */
-    { 9.956988629269755E-01, -1.901049911529926E+00, 9.956988629269755E-01, -1.901049911529926E+00, 9.913977258539510E-01 }, /* 2310 Hz */
-    { 9.956970089518117E-01, -1.900968729370812E+00, 9.956970089518117E-01, -1.900968729370812E+00, 9.913940179036234E-01 }, /* 2311 Hz */
-    { 9.956951549835217E-01, -1.900887514941435E+00, 9.956951549835217E-01, -1.900887514941435E+00, 9.913903099670434E-01 }, /* 2312 Hz */
-    { 9.956933010221061E-01, -1.900806268243305E+00, 9.956933010221061E-01, -1.900806268243305E+00, 9.913866020442121E-01 }, /* 2313 Hz */
-    { 9.956914470675644E-01, -1.900724989277936E+00, 9.956914470675644E-01, -1.900724989277936E+00, 9.913828941351288E-01 }, /* 2314 Hz */
-    { 9.956895931198967E-01, -1.900643678046839E+00, 9.956895931198967E-01, -1.900643678046839E+00, 9.913791862397934E-01 }, /* 2315 Hz */
-    { 9.956877391791029E-01, -1.900562334551526E+00, 9.956877391791029E-01, -1.900562334551526E+00, 9.913754783582058E-01 }, /* 2316 Hz */
-    { 9.956858852451831E-01, -1.900480958793512E+00, 9.956858852451831E-01, -1.900480958793512E+00, 9.913717704903662E-01 }, /* 2317 Hz */
-    { 9.956840313181373E-01, -1.900399550774311E+00, 9.956840313181373E-01, -1.900399550774311E+00, 9.913680626362746E-01 }, /* 2318 Hz */
-    { 9.956821773979652E-01, -1.900318110495436E+00, 9.956821773979652E-01, -1.900318110495436E+00, 9.913643547959303E-01 }, /* 2319 Hz */
-    { 9.956803234846667E-01, -1.900236637958403E+00, 9.956803234846667E-01, -1.900236637958403E+00, 9.913606469693335E-01 }, /* 2320 Hz */
-    { 9.956784695782420E-01, -1.900155133164726E+00, 9.956784695782420E-01, -1.900155133164726E+00, 9.913569391564840E-01 }, /* 2321 Hz */
-    { 9.956766156786910E-01, -1.900073596115924E+00, 9.956766156786910E-01, -1.900073596115924E+00, 9.913532313573821E-01 }, /* 2322 Hz */
-    { 9.956747617860138E-01, -1.899992026813512E+00, 9.956747617860138E-01, -1.899992026813512E+00, 9.913495235720275E-01 }, /* 2323 Hz */
-    { 9.956729079002098E-01, -1.899910425259006E+00, 9.956729079002098E-01, -1.899910425259006E+00, 9.913458158004196E-01 }, /* 2324 Hz */
-    { 9.956710540212795E-01, -1.899828791453926E+00, 9.956710540212795E-01, -1.899828791453926E+00, 9.913421080425591E-01 }, /* 2325 Hz */
-    { 9.956692001492224E-01, -1.899747125399789E+00, 9.956692001492224E-01, -1.899747125399789E+00, 9.913384002984449E-01 }, /* 2326 Hz */
-    { 9.956673462840391E-01, -1.899665427098114E+00, 9.956673462840391E-01, -1.899665427098114E+00, 9.913346925680782E-01 }, /* 2327 Hz */
-    { 9.956654924257290E-01, -1.899583696550420E+00, 9.956654924257290E-01, -1.899583696550420E+00, 9.913309848514580E-01 }, /* 2328 Hz */
-    { 9.956636385742920E-01, -1.899501933758228E+00, 9.956636385742920E-01, -1.899501933758228E+00, 9.913272771485839E-01 }, /* 2329 Hz */
-    { 9.956617847297285E-01, -1.899420138723058E+00, 9.956617847297285E-01, -1.899420138723058E+00, 9.913235694594571E-01 }, /* 2330 Hz */
-    { 9.956599308920381E-01, -1.899338311446430E+00, 9.956599308920381E-01, -1.899338311446430E+00, 9.913198617840762E-01 }, /* 2331 Hz */
-    { 9.956580770612206E-01, -1.899256451929867E+00, 9.956580770612206E-01, -1.899256451929867E+00, 9.913161541224411E-01 }, /* 2332 Hz */
-    { 9.956562232372765E-01, -1.899174560174891E+00, 9.956562232372765E-01, -1.899174560174891E+00, 9.913124464745531E-01 }, /* 2333 Hz */
-    { 9.956543694202054E-01, -1.899092636183023E+00, 9.956543694202054E-01, -1.899092636183023E+00, 9.913087388404107E-01 }, /* 2334 Hz */
-    { 9.956525156100071E-01, -1.899010679955788E+00, 9.956525156100071E-01, -1.899010679955788E+00, 9.913050312200142E-01 }, /* 2335 Hz */
-    { 9.956506618066818E-01, -1.898928691494709E+00, 9.956506618066818E-01, -1.898928691494709E+00, 9.913013236133636E-01 }, /* 2336 Hz */
-    { 9.956488080102296E-01, -1.898846670801311E+00, 9.956488080102296E-01, -1.898846670801311E+00, 9.912976160204592E-01 }, /* 2337 Hz */
-    { 9.956469542206500E-01, -1.898764617877118E+00, 9.956469542206500E-01, -1.898764617877118E+00, 9.912939084412999E-01 }, /* 2338 Hz */
-    { 9.956451004379432E-01, -1.898682532723655E+00, 9.956451004379432E-01, -1.898682532723655E+00, 9.912902008758864E-01 }, /* 2339 Hz */
-    { 9.956432466621093E-01, -1.898600415342449E+00, 9.956432466621093E-01, -1.898600415342449E+00, 9.912864933242187E-01 }, /* 2340 Hz */
-    { 9.956413928931480E-01, -1.898518265735026E+00, 9.956413928931480E-01, -1.898518265735026E+00, 9.912827857862960E-01 }, /* 2341 Hz */
-    { 9.956395391310594E-01, -1.898436083902914E+00, 9.956395391310594E-01, -1.898436083902914E+00, 9.912790782621188E-01 }, /* 2342 Hz */
-    { 9.956376853758432E-01, -1.898353869847639E+00, 9.956376853758432E-01, -1.898353869847639E+00, 9.912753707516864E-01 }, /* 2343 Hz */
-    { 9.956358316274997E-01, -1.898271623570729E+00, 9.956358316274997E-01, -1.898271623570729E+00, 9.912716632549994E-01 }, /* 2344 Hz */
-    { 9.956339778860284E-01, -1.898189345073714E+00, 9.956339778860284E-01, -1.898189345073714E+00, 9.912679557720567E-01 }, /* 2345 Hz */
-    { 9.956321241514299E-01, -1.898107034358123E+00, 9.956321241514299E-01, -1.898107034358123E+00, 9.912642483028598E-01 }, /* 2346 Hz */
-    { 9.956302704237036E-01, -1.898024691425485E+00, 9.956302704237036E-01, -1.898024691425485E+00, 9.912605408474071E-01 }, /* 2347 Hz */
-    { 9.956284167028495E-01, -1.897942316277331E+00, 9.956284167028495E-01, -1.897942316277331E+00, 9.912568334056990E-01 }, /* 2348 Hz */
-    { 9.956265629888679E-01, -1.897859908915192E+00, 9.956265629888679E-01, -1.897859908915192E+00, 9.912531259777357E-01 }, /* 2349 Hz */
-    { 9.956247092817583E-01, -1.897777469340598E+00, 9.956247092817583E-01, -1.897777469340598E+00, 9.912494185635166E-01 }, /* 2350 Hz */
-    { 9.956228555815210E-01, -1.897694997555082E+00, 9.956228555815210E-01, -1.897694997555082E+00, 9.912457111630419E-01 }, /* 2351 Hz */
-    { 9.956210018881557E-01, -1.897612493560177E+00, 9.956210018881557E-01, -1.897612493560177E+00, 9.912420037763114E-01 }, /* 2352 Hz */
-    { 9.956191482016626E-01, -1.897529957357415E+00, 9.956191482016626E-01, -1.897529957357415E+00, 9.912382964033253E-01 }, /* 2353 Hz */
-    { 9.956172945220416E-01, -1.897447388948330E+00, 9.956172945220416E-01, -1.897447388948330E+00, 9.912345890440832E-01 }, /* 2354 Hz */
-    { 9.956154408492923E-01, -1.897364788334456E+00, 9.956154408492923E-01, -1.897364788334456E+00, 9.912308816985846E-01 }, /* 2355 Hz */
-    { 9.956135871834151E-01, -1.897282155517328E+00, 9.956135871834151E-01, -1.897282155517328E+00, 9.912271743668302E-01 }, /* 2356 Hz */
-    { 9.956117335244097E-01, -1.897199490498480E+00, 9.956117335244097E-01, -1.897199490498480E+00, 9.912234670488194E-01 }, /* 2357 Hz */
-    { 9.956098798722762E-01, -1.897116793279450E+00, 9.956098798722762E-01, -1.897116793279450E+00, 9.912197597445525E-01 }, /* 2358 Hz */
-    { 9.956080262270144E-01, -1.897034063861772E+00, 9.956080262270144E-01, -1.897034063861772E+00, 9.912160524540288E-01 }, /* 2359 Hz */
-    { 9.956061725886244E-01, -1.896951302246985E+00, 9.956061725886244E-01, -1.896951302246985E+00, 9.912123451772488E-01 }, /* 2360 Hz */
-    { 9.956043189571058E-01, -1.896868508436625E+00, 9.956043189571058E-01, -1.896868508436625E+00, 9.912086379142115E-01 }, /* 2361 Hz */
-    { 9.956024653324591E-01, -1.896785682432230E+00, 9.956024653324591E-01, -1.896785682432230E+00, 9.912049306649182E-01 }, /* 2362 Hz */
-    { 9.956006117146837E-01, -1.896702824235338E+00, 9.956006117146837E-01, -1.896702824235338E+00, 9.912012234293675E-01 }, /* 2363 Hz */
-    { 9.955987581037800E-01, -1.896619933847490E+00, 9.955987581037800E-01, -1.896619933847490E+00, 9.911975162075599E-01 }, /* 2364 Hz */
-    { 9.955969044997476E-01, -1.896537011270223E+00, 9.955969044997476E-01, -1.896537011270223E+00, 9.911938089994952E-01 }, /* 2365 Hz */
-    { 9.955950509025866E-01, -1.896454056505079E+00, 9.955950509025866E-01, -1.896454056505079E+00, 9.911901018051732E-01 }, /* 2366 Hz */
-    { 9.955931973122971E-01, -1.896371069553598E+00, 9.955931973122971E-01, -1.896371069553598E+00, 9.911863946245942E-01 }, /* 2367 Hz */
-    { 9.955913437288787E-01, -1.896288050417322E+00, 9.955913437288787E-01, -1.896288050417322E+00, 9.911826874577574E-01 }, /* 2368 Hz */
-    { 9.955894901523318E-01, -1.896204999097792E+00, 9.955894901523318E-01, -1.896204999097792E+00, 9.911789803046636E-01 }, /* 2369 Hz */
-    { 9.955876365826560E-01, -1.896121915596549E+00, 9.955876365826560E-01, -1.896121915596549E+00, 9.911752731653121E-01 }, /* 2370 Hz */
-    { 9.955857830198513E-01, -1.896038799915139E+00, 9.955857830198513E-01, -1.896038799915139E+00, 9.911715660397027E-01 }, /* 2371 Hz */
-    { 9.955839294639176E-01, -1.895955652055102E+00, 9.955839294639176E-01, -1.895955652055102E+00, 9.911678589278352E-01 }, /* 2372 Hz */
-    { 9.955820759148550E-01, -1.895872472017984E+00, 9.955820759148550E-01, -1.895872472017984E+00, 9.911641518297101E-01 }, /* 2373 Hz */
-    { 9.955802223726635E-01, -1.895789259805330E+00, 9.955802223726635E-01, -1.895789259805330E+00, 9.911604447453271E-01 }, /* 2374 Hz */
-    { 9.955783688373429E-01, -1.895706015418683E+00, 9.955783688373429E-01, -1.895706015418683E+00, 9.911567376746857E-01 }, /* 2375 Hz */
-    { 9.955765153088932E-01, -1.895622738859590E+00, 9.955765153088932E-01, -1.895622738859590E+00, 9.911530306177865E-01 }, /* 2376 Hz */
-    { 9.955746617873142E-01, -1.895539430129597E+00, 9.955746617873142E-01, -1.895539430129597E+00, 9.911493235746285E-01 }, /* 2377 Hz */
-    { 9.955728082726061E-01, -1.895456089230250E+00, 9.955728082726061E-01, -1.895456089230250E+00, 9.911456165452122E-01 }, /* 2378 Hz */
-    { 9.955709547647689E-01, -1.895372716163097E+00, 9.955709547647689E-01, -1.895372716163097E+00, 9.911419095295377E-01 }, /* 2379 Hz */
-    { 9.955691012638022E-01, -1.895289310929685E+00, 9.955691012638022E-01, -1.895289310929685E+00, 9.911382025276043E-01 }, /* 2380 Hz */
-    { 9.955672477697062E-01, -1.895205873531563E+00, 9.955672477697062E-01, -1.895205873531563E+00, 9.911344955394124E-01 }, /* 2381 Hz */
-    { 9.955653942824807E-01, -1.895122403970280E+00, 9.955653942824807E-01, -1.895122403970280E+00, 9.911307885649614E-01 }, /* 2382 Hz */
-    { 9.955635408021257E-01, -1.895038902247384E+00, 9.955635408021257E-01, -1.895038902247384E+00, 9.911270816042514E-01 }, /* 2383 Hz */
-    { 9.955616873286413E-01, -1.894955368364426E+00, 9.955616873286413E-01, -1.894955368364426E+00, 9.911233746572825E-01 }, /* 2384 Hz */
-    { 9.955598338620273E-01, -1.894871802322957E+00, 9.955598338620273E-01, -1.894871802322957E+00, 9.911196677240546E-01 }, /* 2385 Hz */
-    { 9.955579804022836E-01, -1.894788204124527E+00, 9.955579804022836E-01, -1.894788204124527E+00, 9.911159608045672E-01 }, /* 2386 Hz */
-    { 9.955561269494103E-01, -1.894704573770688E+00, 9.955561269494103E-01, -1.894704573770688E+00, 9.911122538988206E-01 }, /* 2387 Hz */
-    { 9.955542735034073E-01, -1.894620911262991E+00, 9.955542735034073E-01, -1.894620911262991E+00, 9.911085470068146E-01 }, /* 2388 Hz */
-    { 9.955524200642744E-01, -1.894537216602991E+00, 9.955524200642744E-01, -1.894537216602991E+00, 9.911048401285487E-01 }, /* 2389 Hz */
-    { 9.955505666320118E-01, -1.894453489792239E+00, 9.955505666320118E-01, -1.894453489792239E+00, 9.911011332640236E-01 }, /* 2390 Hz */
-    { 9.955487132066193E-01, -1.894369730832290E+00, 9.955487132066193E-01, -1.894369730832290E+00, 9.910974264132386E-01 }, /* 2391 Hz */
-    { 9.955468597880969E-01, -1.894285939724698E+00, 9.955468597880969E-01, -1.894285939724698E+00, 9.910937195761937E-01 }, /* 2392 Hz */
-    { 9.955450063764444E-01, -1.894202116471018E+00, 9.955450063764444E-01, -1.894202116471018E+00, 9.910900127528888E-01 }, /* 2393 Hz */
-    { 9.955431529716618E-01, -1.894118261072805E+00, 9.955431529716618E-01, -1.894118261072805E+00, 9.910863059433237E-01 }, /* 2394 Hz */
-    { 9.955412995737495E-01, -1.894034373531615E+00, 9.955412995737495E-01, -1.894034373531615E+00, 9.910825991474990E-01 }, /* 2395 Hz */
-    { 9.955394461827068E-01, -1.893950453849005E+00, 9.955394461827068E-01, -1.893950453849005E+00, 9.910788923654137E-01 }, /* 2396 Hz */
-    { 9.955375927985339E-01, -1.893866502026531E+00, 9.955375927985339E-01, -1.893866502026531E+00, 9.910751855970679E-01 }, /* 2397 Hz */
-    { 9.955357394212309E-01, -1.893782518065751E+00, 9.955357394212309E-01, -1.893782518065751E+00, 9.910714788424617E-01 }, /* 2398 Hz */
-    { 9.955338860507974E-01, -1.893698501968224E+00, 9.955338860507974E-01, -1.893698501968224E+00, 9.910677721015948E-01 }, /* 2399 Hz */
-    { 9.955320326872338E-01, -1.893614453735507E+00, 9.955320326872338E-01, -1.893614453735507E+00, 9.910640653744676E-01 }, /* 2400 Hz */
-    { 9.955301793305394E-01, -1.893530373369160E+00, 9.955301793305394E-01, -1.893530373369160E+00, 9.910603586610789E-01 }, /* 2401 Hz */
-    { 9.955283259807151E-01, -1.893446260870744E+00, 9.955283259807151E-01, -1.893446260870744E+00, 9.910566519614301E-01 }, /* 2402 Hz */
-    { 9.955264726377600E-01, -1.893362116241817E+00, 9.955264726377600E-01, -1.893362116241817E+00, 9.910529452755199E-01 }, /* 2403 Hz */
-    { 9.955246193016745E-01, -1.893277939483941E+00, 9.955246193016745E-01, -1.893277939483941E+00, 9.910492386033489E-01 }, /* 2404 Hz */
-    { 9.955227659724581E-01, -1.893193730598677E+00, 9.955227659724581E-01, -1.893193730598677E+00, 9.910455319449163E-01 }, /* 2405 Hz */
-    { 9.955209126501114E-01, -1.893109489587588E+00, 9.955209126501114E-01, -1.893109489587588E+00, 9.910418253002229E-01 }, /* 2406 Hz */
-    { 9.955190593346338E-01, -1.893025216452235E+00, 9.955190593346338E-01, -1.893025216452235E+00, 9.910381186692676E-01 }, /* 2407 Hz */
-    { 9.955172060260257E-01, -1.892940911194182E+00, 9.955172060260257E-01, -1.892940911194182E+00, 9.910344120520513E-01 }, /* 2408 Hz */
-    { 9.955153527242866E-01, -1.892856573814993E+00, 9.955153527242866E-01, -1.892856573814993E+00, 9.910307054485732E-01 }, /* 2409 Hz */
-    { 9.955134994294167E-01, -1.892772204316230E+00, 9.955134994294167E-01, -1.892772204316230E+00, 9.910269988588334E-01 }, /* 2410 Hz */
-    { 9.955116461414159E-01, -1.892687802699460E+00, 9.955116461414159E-01, -1.892687802699460E+00, 9.910232922828317E-01 }, /* 2411 Hz */
-    { 9.955097928602841E-01, -1.892603368966246E+00, 9.955097928602841E-01, -1.892603368966246E+00, 9.910195857205681E-01 }, /* 2412 Hz */
-    { 9.955079395860212E-01, -1.892518903118155E+00, 9.955079395860212E-01, -1.892518903118155E+00, 9.910158791720425E-01 }, /* 2413 Hz */
-    { 9.955060863186275E-01, -1.892434405156754E+00, 9.955060863186275E-01, -1.892434405156754E+00, 9.910121726372549E-01 }, /* 2414 Hz */
-    { 9.955042330581026E-01, -1.892349875083608E+00, 9.955042330581026E-01, -1.892349875083608E+00, 9.910084661162053E-01 }, /* 2415 Hz */
-    { 9.955023798044464E-01, -1.892265312900286E+00, 9.955023798044464E-01, -1.892265312900286E+00, 9.910047596088929E-01 }, /* 2416 Hz */
-    { 9.955005265576592E-01, -1.892180718608354E+00, 9.955005265576592E-01, -1.892180718608354E+00, 9.910010531153184E-01 }, /* 2417 Hz */
-    { 9.954986733177407E-01, -1.892096092209383E+00, 9.954986733177407E-01, -1.892096092209383E+00, 9.909973466354813E-01 }, /* 2418 Hz */
-    { 9.954968200846908E-01, -1.892011433704940E+00, 9.954968200846908E-01, -1.892011433704940E+00, 9.909936401693815E-01 }, /* 2419 Hz */
-    { 9.954949668585095E-01, -1.891926743096594E+00, 9.954949668585095E-01, -1.891926743096594E+00, 9.909899337170189E-01 }, /* 2420 Hz */
-    { 9.954931136391968E-01, -1.891842020385918E+00, 9.954931136391968E-01, -1.891842020385918E+00, 9.909862272783936E-01 }, /* 2421 Hz */
-    { 9.954912604267527E-01, -1.891757265574480E+00, 9.954912604267527E-01, -1.891757265574480E+00, 9.909825208535055E-01 }, /* 2422 Hz */
-    { 9.954894072211772E-01, -1.891672478663852E+00, 9.954894072211772E-01, -1.891672478663852E+00, 9.909788144423544E-01 }, /* 2423 Hz */
-    { 9.954875540224701E-01, -1.891587659655606E+00, 9.954875540224701E-01, -1.891587659655606E+00, 9.909751080449403E-01 }, /* 2424 Hz */
-    { 9.954857008306311E-01, -1.891502808551313E+00, 9.954857008306311E-01, -1.891502808551313E+00, 9.909714016612623E-01 }, /* 2425 Hz */
-    { 9.954838476456608E-01, -1.891417925352548E+00, 9.954838476456608E-01, -1.891417925352548E+00, 9.909676952913216E-01 }, /* 2426 Hz */
-    { 9.954819944675587E-01, -1.891333010060883E+00, 9.954819944675587E-01, -1.891333010060883E+00, 9.909639889351174E-01 }, /* 2427 Hz */
-    { 9.954801412963247E-01, -1.891248062677891E+00, 9.954801412963247E-01, -1.891248062677891E+00, 9.909602825926493E-01 }, /* 2428 Hz */
-    { 9.954782881319587E-01, -1.891163083205147E+00, 9.954782881319587E-01, -1.891163083205147E+00, 9.909565762639174E-01 }, /* 2429 Hz */
-    { 9.954764349744611E-01, -1.891078071644227E+00, 9.954764349744611E-01, -1.891078071644227E+00, 9.909528699489223E-01 }, /* 2430 Hz */
-    { 9.954745818238316E-01, -1.890993027996706E+00, 9.954745818238316E-01, -1.890993027996706E+00, 9.909491636476633E-01 }, /* 2431 Hz */
-    { 9.954727286800700E-01, -1.890907952264160E+00, 9.954727286800700E-01, -1.890907952264160E+00, 9.909454573601399E-01 }, /* 2432 Hz */
-    { 9.954708755431766E-01, -1.890822844448165E+00, 9.954708755431766E-01, -1.890822844448165E+00, 9.909417510863532E-01 }, /* 2433 Hz */
-    { 9.954690224131509E-01, -1.890737704550299E+00, 9.954690224131509E-01, -1.890737704550299E+00, 9.909380448263019E-01 }, /* 2434 Hz */
-    { 9.954671692899930E-01, -1.890652532572139E+00, 9.954671692899930E-01, -1.890652532572139E+00, 9.909343385799860E-01 }, /* 2435 Hz */
-    { 9.954653161737030E-01, -1.890567328515264E+00, 9.954653161737030E-01, -1.890567328515264E+00, 9.909306323474061E-01 }, /* 2436 Hz */
-    { 9.954634630642810E-01, -1.890482092381252E+00, 9.954634630642810E-01, -1.890482092381252E+00, 9.909269261285620E-01 }, /* 2437 Hz */
-    { 9.954616099617265E-01, -1.890396824171683E+00, 9.954616099617265E-01, -1.890396824171683E+00, 9.909232199234530E-01 }, /* 2438 Hz */
-    { 9.954597568660398E-01, -1.890311523888136E+00, 9.954597568660398E-01, -1.890311523888136E+00, 9.909195137320796E-01 }, /* 2439 Hz */
-    { 9.954579037772204E-01, -1.890226191532192E+00, 9.954579037772204E-01, -1.890226191532192E+00, 9.909158075544409E-01 }, /* 2440 Hz */
-    { 9.954560506952688E-01, -1.890140827105432E+00, 9.954560506952688E-01, -1.890140827105432E+00, 9.909121013905375E-01 }, /* 2441 Hz */
-    { 9.954541976201848E-01, -1.890055430609437E+00, 9.954541976201848E-01, -1.890055430609437E+00, 9.909083952403697E-01 }, /* 2442 Hz */
-    { 9.954523445519681E-01, -1.889970002045789E+00, 9.954523445519681E-01, -1.889970002045789E+00, 9.909046891039361E-01 }, /* 2443 Hz */
-    { 9.954504914906189E-01, -1.889884541416072E+00, 9.954504914906189E-01, -1.889884541416072E+00, 9.909009829812379E-01 }, /* 2444 Hz */
-    { 9.954486384361371E-01, -1.889799048721868E+00, 9.954486384361371E-01, -1.889799048721868E+00, 9.908972768722741E-01 }, /* 2445 Hz */
-    { 9.954467853885224E-01, -1.889713523964760E+00, 9.954467853885224E-01, -1.889713523964760E+00, 9.908935707770448E-01 }, /* 2446 Hz */
-    { 9.954449323477752E-01, -1.889627967146333E+00, 9.954449323477752E-01, -1.889627967146333E+00, 9.908898646955504E-01 }, /* 2447 Hz */
-    { 9.954430793138950E-01, -1.889542378268172E+00, 9.954430793138950E-01, -1.889542378268172E+00, 9.908861586277899E-01 }, /* 2448 Hz */
-    { 9.954412262868823E-01, -1.889456757331862E+00, 9.954412262868823E-01, -1.889456757331862E+00, 9.908824525737645E-01 }, /* 2449 Hz */
-    { 9.954393732667364E-01, -1.889371104338988E+00, 9.954393732667364E-01, -1.889371104338988E+00, 9.908787465334727E-01 }, /* 2450 Hz */
-    { 9.954375202534574E-01, -1.889285419291138E+00, 9.954375202534574E-01, -1.889285419291138E+00, 9.908750405069149E-01 }, /* 2451 Hz */
-    { 9.954356672470458E-01, -1.889199702189897E+00, 9.954356672470458E-01, -1.889199702189897E+00, 9.908713344940916E-01 }, /* 2452 Hz */
-    { 9.954338142475010E-01, -1.889113953036855E+00, 9.954338142475010E-01, -1.889113953036855E+00, 9.908676284950020E-01 }, /* 2453 Hz */
-    { 9.954319612548229E-01, -1.889028171833597E+00, 9.954319612548229E-01, -1.889028171833597E+00, 9.908639225096458E-01 }, /* 2454 Hz */
-    { 9.954301082690119E-01, -1.888942358581714E+00, 9.954301082690119E-01, -1.888942358581714E+00, 9.908602165380238E-01 }, /* 2455 Hz */
-    { 9.954282552900675E-01, -1.888856513282794E+00, 9.954282552900675E-01, -1.888856513282794E+00, 9.908565105801350E-01 }, /* 2456 Hz */
-    { 9.954264023179901E-01, -1.888770635938427E+00, 9.954264023179901E-01, -1.888770635938427E+00, 9.908528046359801E-01 }, /* 2457 Hz */
-    { 9.954245493527792E-01, -1.888684726550203E+00, 9.954245493527792E-01, -1.888684726550203E+00, 9.908490987055585E-01 }, /* 2458 Hz */
-    { 9.954226963944350E-01, -1.888598785119712E+00, 9.954226963944350E-01, -1.888598785119712E+00, 9.908453927888701E-01 }, /* 2459 Hz */
-    { 9.954208434429574E-01, -1.888512811648547E+00, 9.954208434429574E-01, -1.888512811648547E+00, 9.908416868859149E-01 }, /* 2460 Hz */
-    { 9.954189904983465E-01, -1.888426806138298E+00, 9.954189904983465E-01, -1.888426806138298E+00, 9.908379809966930E-01 }, /* 2461 Hz */
-    { 9.954171375606018E-01, -1.888340768590558E+00, 9.954171375606018E-01, -1.888340768590558E+00, 9.908342751212036E-01 }, /* 2462 Hz */
-    { 9.954152846297236E-01, -1.888254699006920E+00, 9.954152846297236E-01, -1.888254699006920E+00, 9.908305692594472E-01 }, /* 2463 Hz */
-    { 9.954134317057119E-01, -1.888168597388978E+00, 9.954134317057119E-01, -1.888168597388978E+00, 9.908268634114239E-01 }, /* 2464 Hz */
-    { 9.954115787885666E-01, -1.888082463738325E+00, 9.954115787885666E-01, -1.888082463738325E+00, 9.908231575771331E-01 }, /* 2465 Hz */
-    { 9.954097258782875E-01, -1.887996298056556E+00, 9.954097258782875E-01, -1.887996298056556E+00, 9.908194517565749E-01 }, /* 2466 Hz */
-    { 9.954078729748745E-01, -1.887910100345266E+00, 9.954078729748745E-01, -1.887910100345266E+00, 9.908157459497491E-01 }, /* 2467 Hz */
-    { 9.954060200783278E-01, -1.887823870606051E+00, 9.954060200783278E-01, -1.887823870606051E+00, 9.908120401566556E-01 }, /* 2468 Hz */
-    { 9.954041671886472E-01, -1.887737608840506E+00, 9.954041671886472E-01, -1.887737608840506E+00, 9.908083343772944E-01 }, /* 2469 Hz */
-    { 9.954023143058328E-01, -1.887651315050229E+00, 9.954023143058328E-01, -1.887651315050229E+00, 9.908046286116656E-01 }, /* 2470 Hz */
-    { 9.954004614298844E-01, -1.887564989236816E+00, 9.954004614298844E-01, -1.887564989236816E+00, 9.908009228597687E-01 }, /* 2471 Hz */
-    { 9.953986085608020E-01, -1.887478631401866E+00, 9.953986085608020E-01, -1.887478631401866E+00, 9.907972171216040E-01 }, /* 2472 Hz */
-    { 9.953967556985854E-01, -1.887392241546976E+00, 9.953967556985854E-01, -1.887392241546976E+00, 9.907935113971709E-01 }, /* 2473 Hz */
-    { 9.953949028432346E-01, -1.887305819673746E+00, 9.953949028432346E-01, -1.887305819673746E+00, 9.907898056864692E-01 }, /* 2474 Hz */
-    { 9.953930499947499E-01, -1.887219365783775E+00, 9.953930499947499E-01, -1.887219365783775E+00, 9.907860999894997E-01 }, /* 2475 Hz */
-    { 9.953911971531308E-01, -1.887132879878663E+00, 9.953911971531308E-01, -1.887132879878663E+00, 9.907823943062617E-01 }, /* 2476 Hz */
-    { 9.953893443183776E-01, -1.887046361960010E+00, 9.953893443183776E-01, -1.887046361960010E+00, 9.907786886367551E-01 }, /* 2477 Hz */
-    { 9.953874914904898E-01, -1.886959812029418E+00, 9.953874914904898E-01, -1.886959812029418E+00, 9.907749829809795E-01 }, /* 2478 Hz */
-    { 9.953856386694677E-01, -1.886873230088487E+00, 9.953856386694677E-01, -1.886873230088487E+00, 9.907712773389354E-01 }, /* 2479 Hz */
-    { 9.953837858553113E-01, -1.886786616138820E+00, 9.953837858553113E-01, -1.886786616138820E+00, 9.907675717106226E-01 }, /* 2480 Hz */
-    { 9.953819330480203E-01, -1.886699970182021E+00, 9.953819330480203E-01, -1.886699970182021E+00, 9.907638660960405E-01 }, /* 2481 Hz */
-    { 9.953800802475948E-01, -1.886613292219691E+00, 9.953800802475948E-01, -1.886613292219691E+00, 9.907601604951897E-01 }, /* 2482 Hz */
-    { 9.953782274540348E-01, -1.886526582253435E+00, 9.953782274540348E-01, -1.886526582253435E+00, 9.907564549080696E-01 }, /* 2483 Hz */
-    { 9.953763746673400E-01, -1.886439840284857E+00, 9.953763746673400E-01, -1.886439840284857E+00, 9.907527493346799E-01 }, /* 2484 Hz */
-    { 9.953745218875107E-01, -1.886353066315562E+00, 9.953745218875107E-01, -1.886353066315562E+00, 9.907490437750215E-01 }, /* 2485 Hz */
-    { 9.953726691145467E-01, -1.886266260347154E+00, 9.953726691145467E-01, -1.886266260347154E+00, 9.907453382290934E-01 }, /* 2486 Hz */
-    { 9.953708163484477E-01, -1.886179422381241E+00, 9.953708163484477E-01, -1.886179422381241E+00, 9.907416326968954E-01 }, /* 2487 Hz */
-    { 9.953689635892140E-01, -1.886092552419428E+00, 9.953689635892140E-01, -1.886092552419428E+00, 9.907379271784280E-01 }, /* 2488 Hz */
-    { 9.953671108368453E-01, -1.886005650463323E+00, 9.953671108368453E-01, -1.886005650463323E+00, 9.907342216736905E-01 }, /* 2489 Hz */
-    { 9.953652580913418E-01, -1.885918716514532E+00, 9.953652580913418E-01, -1.885918716514532E+00, 9.907305161826836E-01 }, /* 2490 Hz */
-    { 9.953634053527032E-01, -1.885831750574665E+00, 9.953634053527032E-01, -1.885831750574665E+00, 9.907268107054064E-01 }, /* 2491 Hz */
-    { 9.953615526209295E-01, -1.885744752645329E+00, 9.953615526209295E-01, -1.885744752645329E+00, 9.907231052418590E-01 }, /* 2492 Hz */
-    { 9.953596998960209E-01, -1.885657722728134E+00, 9.953596998960209E-01, -1.885657722728134E+00, 9.907193997920418E-01 }, /* 2493 Hz */
-    { 9.953578471779770E-01, -1.885570660824690E+00, 9.953578471779770E-01, -1.885570660824690E+00, 9.907156943559541E-01 }, /* 2494 Hz */
-    { 9.953559944667981E-01, -1.885483566936606E+00, 9.953559944667981E-01, -1.885483566936606E+00, 9.907119889335962E-01 }, /* 2495 Hz */
-    { 9.953541417624836E-01, -1.885396441065493E+00, 9.953541417624836E-01, -1.885396441065493E+00, 9.907082835249672E-01 }, /* 2496 Hz */
-    { 9.953522890650340E-01, -1.885309283212964E+00, 9.953522890650340E-01, -1.885309283212964E+00, 9.907045781300681E-01 }, /* 2497 Hz */
-    { 9.953504363744492E-01, -1.885222093380629E+00, 9.953504363744492E-01, -1.885222093380629E+00, 9.907008727488984E-01 }, /* 2498 Hz */
-    { 9.953485836907289E-01, -1.885134871570102E+00, 9.953485836907289E-01, -1.885134871570102E+00, 9.906971673814577E-01 }, /* 2499 Hz */
-    { 9.953467310138731E-01, -1.885047617782994E+00, 9.953467310138731E-01, -1.885047617782994E+00, 9.906934620277461E-01 }, /* 2500 Hz */
-    { 9.953448783438816E-01, -1.884960332020919E+00, 9.953448783438816E-01, -1.884960332020919E+00, 9.906897566877633E-01 }, /* 2501 Hz */
-    { 9.953430256807548E-01, -1.884873014285493E+00, 9.953430256807548E-01, -1.884873014285493E+00, 9.906860513615097E-01 }, /* 2502 Hz */
-    { 9.953411730244925E-01, -1.884785664578329E+00, 9.953411730244925E-01, -1.884785664578329E+00, 9.906823460489851E-01 }, /* 2503 Hz */
-    { 9.953393203750944E-01, -1.884698282901041E+00, 9.953393203750944E-01, -1.884698282901041E+00, 9.906786407501889E-01 }, /* 2504 Hz */
-    { 9.953374677325607E-01, -1.884610869255247E+00, 9.953374677325607E-01, -1.884610869255247E+00, 9.906749354651214E-01 }, /* 2505 Hz */
-    { 9.953356150968911E-01, -1.884523423642562E+00, 9.953356150968911E-01, -1.884523423642562E+00, 9.906712301937821E-01 }, /* 2506 Hz */
-    { 9.953337624680856E-01, -1.884435946064602E+00, 9.953337624680856E-01, -1.884435946064602E+00, 9.906675249361712E-01 }, /* 2507 Hz */
-    { 9.953319098461444E-01, -1.884348436522985E+00, 9.953319098461444E-01, -1.884348436522985E+00, 9.906638196922888E-01 }, /* 2508 Hz */
-    { 9.953300572310673E-01, -1.884260895019330E+00, 9.953300572310673E-01, -1.884260895019330E+00, 9.906601144621345E-01 }, /* 2509 Hz */
-    { 9.953282046228541E-01, -1.884173321555253E+00, 9.953282046228541E-01, -1.884173321555253E+00, 9.906564092457082E-01 }, /* 2510 Hz */
-    { 9.953263520215051E-01, -1.884085716132375E+00, 9.953263520215051E-01, -1.884085716132375E+00, 9.906527040430102E-01 }, /* 2511 Hz */
-    { 9.953244994270198E-01, -1.883998078752314E+00, 9.953244994270198E-01, -1.883998078752314E+00, 9.906489988540397E-01 }, /* 2512 Hz */
-    { 9.953226468393985E-01, -1.883910409416691E+00, 9.953226468393985E-01, -1.883910409416691E+00, 9.906452936787971E-01 }, /* 2513 Hz */
-    { 9.953207942586410E-01, -1.883822708127126E+00, 9.953207942586410E-01, -1.883822708127126E+00, 9.906415885172819E-01 }, /* 2514 Hz */
-    { 9.953189416847474E-01, -1.883734974885240E+00, 9.953189416847474E-01, -1.883734974885240E+00, 9.906378833694949E-01 }, /* 2515 Hz */
-    { 9.953170891177173E-01, -1.883647209692655E+00, 9.953170891177173E-01, -1.883647209692655E+00, 9.906341782354346E-01 }, /* 2516 Hz */
-    { 9.953152365575511E-01, -1.883559412550992E+00, 9.953152365575511E-01, -1.883559412550992E+00, 9.906304731151021E-01 }, /* 2517 Hz */
-    { 9.953133840042484E-01, -1.883471583461876E+00, 9.953133840042484E-01, -1.883471583461876E+00, 9.906267680084968E-01 }, /* 2518 Hz */
-    { 9.953115314578095E-01, -1.883383722426928E+00, 9.953115314578095E-01, -1.883383722426928E+00, 9.906230629156190E-01 }, /* 2519 Hz */
-    { 9.953096789182339E-01, -1.883295829447772E+00, 9.953096789182339E-01, -1.883295829447772E+00, 9.906193578364677E-01 }, /* 2520 Hz */
-    { 9.953078263855218E-01, -1.883207904526034E+00, 9.953078263855218E-01, -1.883207904526034E+00, 9.906156527710437E-01 }, /* 2521 Hz */
-    { 9.953059738596731E-01, -1.883119947663337E+00, 9.953059738596731E-01, -1.883119947663337E+00, 9.906119477193462E-01 }, /* 2522 Hz */
-    { 9.953041213406879E-01, -1.883031958861307E+00, 9.953041213406879E-01, -1.883031958861307E+00, 9.906082426813758E-01 }, /* 2523 Hz */
-    { 9.953022688285660E-01, -1.882943938121571E+00, 9.953022688285660E-01, -1.882943938121571E+00, 9.906045376571320E-01 }, /* 2524 Hz */
-    { 9.953004163233073E-01, -1.882855885445754E+00, 9.953004163233073E-01, -1.882855885445754E+00, 9.906008326466147E-01 }, /* 2525 Hz */
-    { 9.952985638249118E-01, -1.882767800835483E+00, 9.952985638249118E-01, -1.882767800835483E+00, 9.905971276498236E-01 }, /* 2526 Hz */
-    { 9.952967113333795E-01, -1.882679684292387E+00, 9.952967113333795E-01, -1.882679684292387E+00, 9.905934226667590E-01 }, /* 2527 Hz */
-    { 9.952948588487103E-01, -1.882591535818092E+00, 9.952948588487103E-01, -1.882591535818092E+00, 9.905897176974205E-01 }, /* 2528 Hz */
-    { 9.952930063709043E-01, -1.882503355414229E+00, 9.952930063709043E-01, -1.882503355414229E+00, 9.905860127418087E-01 }, /* 2529 Hz */
-    { 9.952911538999613E-01, -1.882415143082425E+00, 9.952911538999613E-01, -1.882415143082425E+00, 9.905823077999225E-01 }, /* 2530 Hz */
-    { 9.952893014358810E-01, -1.882326898824311E+00, 9.952893014358810E-01, -1.882326898824311E+00, 9.905786028717620E-01 }, /* 2531 Hz */
-    { 9.952874489786638E-01, -1.882238622641517E+00, 9.952874489786638E-01, -1.882238622641517E+00, 9.905748979573277E-01 }, /* 2532 Hz */
-    { 9.952855965283095E-01, -1.882150314535674E+00, 9.952855965283095E-01, -1.882150314535674E+00, 9.905711930566190E-01 }, /* 2533 Hz */
-    { 9.952837440848179E-01, -1.882061974508413E+00, 9.952837440848179E-01, -1.882061974508413E+00, 9.905674881696358E-01 }, /* 2534 Hz */
-    { 9.952818916481893E-01, -1.881973602561366E+00, 9.952818916481893E-01, -1.881973602561366E+00, 9.905637832963785E-01 }, /* 2535 Hz */
-    { 9.952800392184231E-01, -1.881885198696165E+00, 9.952800392184231E-01, -1.881885198696165E+00, 9.905600784368462E-01 }, /* 2536 Hz */
-    { 9.952781867955197E-01, -1.881796762914444E+00, 9.952781867955197E-01, -1.881796762914444E+00, 9.905563735910394E-01 }, /* 2537 Hz */
-    { 9.952763343794788E-01, -1.881708295217835E+00, 9.952763343794788E-01, -1.881708295217835E+00, 9.905526687589576E-01 }, /* 2538 Hz */
-    { 9.952744819703007E-01, -1.881619795607973E+00, 9.952744819703007E-01, -1.881619795607973E+00, 9.905489639406013E-01 }, /* 2539 Hz */
-    { 9.952726295679850E-01, -1.881531264086493E+00, 9.952726295679850E-01, -1.881531264086493E+00, 9.905452591359700E-01 }, /* 2540 Hz */
-    { 9.952707771725315E-01, -1.881442700655029E+00, 9.952707771725315E-01, -1.881442700655029E+00, 9.905415543450631E-01 }, /* 2541 Hz */
-    { 9.952689247839407E-01, -1.881354105315218E+00, 9.952689247839407E-01, -1.881354105315218E+00, 9.905378495678814E-01 }, /* 2542 Hz */
-    { 9.952670724022122E-01, -1.881265478068695E+00, 9.952670724022122E-01, -1.881265478068695E+00, 9.905341448044245E-01 }, /* 2543 Hz */
-    { 9.952652200273459E-01, -1.881176818917097E+00, 9.952652200273459E-01, -1.881176818917097E+00, 9.905304400546917E-01 }, /* 2544 Hz */
-    { 9.952633676593420E-01, -1.881088127862062E+00, 9.952633676593420E-01, -1.881088127862062E+00, 9.905267353186840E-01 }, /* 2545 Hz */
-    { 9.952615152982002E-01, -1.880999404905227E+00, 9.952615152982002E-01, -1.880999404905227E+00, 9.905230305964003E-01 }, /* 2546 Hz */
-    { 9.952596629439205E-01, -1.880910650048230E+00, 9.952596629439205E-01, -1.880910650048230E+00, 9.905193258878411E-01 }, /* 2547 Hz */
-    { 9.952578105965031E-01, -1.880821863292712E+00, 9.952578105965031E-01, -1.880821863292712E+00, 9.905156211930062E-01 }, /* 2548 Hz */
-    { 9.952559582559476E-01, -1.880733044640310E+00, 9.952559582559476E-01, -1.880733044640310E+00, 9.905119165118952E-01 }, /* 2549 Hz */
-    { 9.952541059222539E-01, -1.880644194092664E+00, 9.952541059222539E-01, -1.880644194092664E+00, 9.905082118445079E-01 }, /* 2550 Hz */
-    { 9.952522535954225E-01, -1.880555311651417E+00, 9.952522535954225E-01, -1.880555311651417E+00, 9.905045071908449E-01 }, /* 2551 Hz */
-    { 9.952504012754528E-01, -1.880466397318208E+00, 9.952504012754528E-01, -1.880466397318208E+00, 9.905008025509057E-01 }, /* 2552 Hz */
-    { 9.952485489623449E-01, -1.880377451094679E+00, 9.952485489623449E-01, -1.880377451094679E+00, 9.904970979246899E-01 }, /* 2553 Hz */
-    { 9.952466966560989E-01, -1.880288472982472E+00, 9.952466966560989E-01, -1.880288472982472E+00, 9.904933933121978E-01 }, /* 2554 Hz */
-    { 9.952448443567146E-01, -1.880199462983231E+00, 9.952448443567146E-01, -1.880199462983231E+00, 9.904896887134291E-01 }, /* 2555 Hz */
-    { 9.952429920641920E-01, -1.880110421098598E+00, 9.952429920641920E-01, -1.880110421098598E+00, 9.904859841283840E-01 }, /* 2556 Hz */
-    { 9.952411397785310E-01, -1.880021347330216E+00, 9.952411397785310E-01, -1.880021347330216E+00, 9.904822795570620E-01 }, /* 2557 Hz */
-    { 9.952392874997318E-01, -1.879932241679731E+00, 9.952392874997318E-01, -1.879932241679731E+00, 9.904785749994636E-01 }, /* 2558 Hz */
-    { 9.952374352277937E-01, -1.879843104148787E+00, 9.952374352277937E-01, -1.879843104148787E+00, 9.904748704555875E-01 }, /* 2559 Hz */
-    { 9.952355829627173E-01, -1.879753934739029E+00, 9.952355829627173E-01, -1.879753934739029E+00, 9.904711659254346E-01 }, /* 2560 Hz */
-    { 9.952337307045026E-01, -1.879664733452104E+00, 9.952337307045026E-01, -1.879664733452104E+00, 9.904674614090052E-01 }, /* 2561 Hz */
-    { 9.952318784531489E-01, -1.879575500289657E+00, 9.952318784531489E-01, -1.879575500289657E+00, 9.904637569062977E-01 }, /* 2562 Hz */
-    { 9.952300262086565E-01, -1.879486235253336E+00, 9.952300262086565E-01, -1.879486235253336E+00, 9.904600524173131E-01 }, /* 2563 Hz */
-    { 9.952281739710257E-01, -1.879396938344789E+00, 9.952281739710257E-01, -1.879396938344789E+00, 9.904563479420514E-01 }, /* 2564 Hz */
-    { 9.952263217402558E-01, -1.879307609565663E+00, 9.952263217402558E-01, -1.879307609565663E+00, 9.904526434805117E-01 }, /* 2565 Hz */
-    { 9.952244695163475E-01, -1.879218248917608E+00, 9.952244695163475E-01, -1.879218248917608E+00, 9.904489390326949E-01 }, /* 2566 Hz */
-    { 9.952226172992999E-01, -1.879128856402271E+00, 9.952226172992999E-01, -1.879128856402271E+00, 9.904452345985999E-01 }, /* 2567 Hz */
-    { 9.952207650891136E-01, -1.879039432021303E+00, 9.952207650891136E-01, -1.879039432021303E+00, 9.904415301782272E-01 }, /* 2568 Hz */
-    { 9.952189128857883E-01, -1.878949975776355E+00, 9.952189128857883E-01, -1.878949975776355E+00, 9.904378257715767E-01 }, /* 2569 Hz */
-    { 9.952170606893240E-01, -1.878860487669076E+00, 9.952170606893240E-01, -1.878860487669076E+00, 9.904341213786481E-01 }, /* 2570 Hz */
-    { 9.952152084997206E-01, -1.878770967701119E+00, 9.952152084997206E-01, -1.878770967701119E+00, 9.904304169994411E-01 }, /* 2571 Hz */
-    { 9.952133563169779E-01, -1.878681415874135E+00, 9.952133563169779E-01, -1.878681415874135E+00, 9.904267126339559E-01 }, /* 2572 Hz */
-    { 9.952115041410963E-01, -1.878591832189776E+00, 9.952115041410963E-01, -1.878591832189776E+00, 9.904230082821925E-01 }, /* 2573 Hz */
-    { 9.952096519720752E-01, -1.878502216649696E+00, 9.952096519720752E-01, -1.878502216649696E+00, 9.904193039441505E-01 }, /* 2574 Hz */
-    { 9.952077998099149E-01, -1.878412569255547E+00, 9.952077998099149E-01, -1.878412569255547E+00, 9.904155996198298E-01 }, /* 2575 Hz */
-    { 9.952059476546155E-01, -1.878322890008985E+00, 9.952059476546155E-01, -1.878322890008985E+00, 9.904118953092309E-01 }, /* 2576 Hz */
-    { 9.952040955061764E-01, -1.878233178911662E+00, 9.952040955061764E-01, -1.878233178911662E+00, 9.904081910123528E-01 }, /* 2577 Hz */
-    { 9.952022433645979E-01, -1.878143435965236E+00, 9.952022433645979E-01, -1.878143435965236E+00, 9.904044867291959E-01 }, /* 2578 Hz */
-    { 9.952003912298800E-01, -1.878053661171361E+00, 9.952003912298800E-01, -1.878053661171361E+00, 9.904007824597600E-01 }, /* 2579 Hz */
-    { 9.951985391020226E-01, -1.877963854531692E+00, 9.951985391020226E-01, -1.877963854531692E+00, 9.903970782040452E-01 }, /* 2580 Hz */
-    { 9.951966869810256E-01, -1.877874016047888E+00, 9.951966869810256E-01, -1.877874016047888E+00, 9.903933739620512E-01 }, /* 2581 Hz */
-    { 9.951948348668889E-01, -1.877784145721606E+00, 9.951948348668889E-01, -1.877784145721606E+00, 9.903896697337777E-01 }, /* 2582 Hz */
-    { 9.951929827596125E-01, -1.877694243554502E+00, 9.951929827596125E-01, -1.877694243554502E+00, 9.903859655192251E-01 }, /* 2583 Hz */
-    { 9.951911306591964E-01, -1.877604309548236E+00, 9.951911306591964E-01, -1.877604309548236E+00, 9.903822613183928E-01 }, /* 2584 Hz */
-    { 9.951892785656405E-01, -1.877514343704466E+00, 9.951892785656405E-01, -1.877514343704466E+00, 9.903785571312811E-01 }, /* 2585 Hz */
-    { 9.951874264789448E-01, -1.877424346024851E+00, 9.951874264789448E-01, -1.877424346024851E+00, 9.903748529578895E-01 }, /* 2586 Hz */
-    { 9.951855743991090E-01, -1.877334316511052E+00, 9.951855743991090E-01, -1.877334316511052E+00, 9.903711487982181E-01 }, /* 2587 Hz */
-    { 9.951837223261336E-01, -1.877244255164730E+00, 9.951837223261336E-01, -1.877244255164730E+00, 9.903674446522672E-01 }, /* 2588 Hz */
-    { 9.951818702600179E-01, -1.877154161987544E+00, 9.951818702600179E-01, -1.877154161987544E+00, 9.903637405200358E-01 }, /* 2589 Hz */
-    { 9.951800182007623E-01, -1.877064036981157E+00, 9.951800182007623E-01, -1.877064036981157E+00, 9.903600364015246E-01 }, /* 2590 Hz */
-    { 9.951781661483665E-01, -1.876973880147231E+00, 9.951781661483665E-01, -1.876973880147231E+00, 9.903563322967330E-01 }, /* 2591 Hz */
-    { 9.951763141028307E-01, -1.876883691487428E+00, 9.951763141028307E-01, -1.876883691487428E+00, 9.903526282056614E-01 }, /* 2592 Hz */
-    { 9.951744620641546E-01, -1.876793471003412E+00, 9.951744620641546E-01, -1.876793471003412E+00, 9.903489241283092E-01 }, /* 2593 Hz */
-    { 9.951726100323383E-01, -1.876703218696846E+00, 9.951726100323383E-01, -1.876703218696846E+00, 9.903452200646765E-01 }, /* 2594 Hz */
-    { 9.951707580073818E-01, -1.876612934569394E+00, 9.951707580073818E-01, -1.876612934569394E+00, 9.903415160147635E-01 }, /* 2595 Hz */
-    { 9.951689059892846E-01, -1.876522618622722E+00, 9.951689059892846E-01, -1.876522618622722E+00, 9.903378119785693E-01 }, /* 2596 Hz */
-    { 9.951670539780473E-01, -1.876432270858494E+00, 9.951670539780473E-01, -1.876432270858494E+00, 9.903341079560946E-01 }, /* 2597 Hz */
-    { 9.951652019736694E-01, -1.876341891278377E+00, 9.951652019736694E-01, -1.876341891278377E+00, 9.903304039473388E-01 }, /* 2598 Hz */
-    { 9.951633499761510E-01, -1.876251479884037E+00, 9.951633499761510E-01, -1.876251479884037E+00, 9.903266999523019E-01 }, /* 2599 Hz */
-    { 9.951614979854921E-01, -1.876161036677140E+00, 9.951614979854921E-01, -1.876161036677140E+00, 9.903229959709843E-01 }, /* 2600 Hz */
-    { 9.951596460016925E-01, -1.876070561659355E+00, 9.951596460016925E-01, -1.876070561659355E+00, 9.903192920033850E-01 }, /* 2601 Hz */
-    { 9.951577940247522E-01, -1.875980054832349E+00, 9.951577940247522E-01, -1.875980054832349E+00, 9.903155880495045E-01 }, /* 2602 Hz */
-    { 9.951559420546713E-01, -1.875889516197791E+00, 9.951559420546713E-01, -1.875889516197791E+00, 9.903118841093426E-01 }, /* 2603 Hz */
-    { 9.951540900914496E-01, -1.875798945757351E+00, 9.951540900914496E-01, -1.875798945757351E+00, 9.903081801828992E-01 }, /* 2604 Hz */
-    { 9.951522381350871E-01, -1.875708343512696E+00, 9.951522381350871E-01, -1.875708343512696E+00, 9.903044762701743E-01 }, /* 2605 Hz */
-    { 9.951503861855837E-01, -1.875617709465499E+00, 9.951503861855837E-01, -1.875617709465499E+00, 9.903007723711674E-01 }, /* 2606 Hz */
-    { 9.951485342429396E-01, -1.875527043617429E+00, 9.951485342429396E-01, -1.875527043617429E+00, 9.902970684858792E-01 }, /* 2607 Hz */
-    { 9.951466823071542E-01, -1.875436345970158E+00, 9.951466823071542E-01, -1.875436345970158E+00, 9.902933646143084E-01 }, /* 2608 Hz */
-    { 9.951448303782281E-01, -1.875345616525357E+00, 9.951448303782281E-01, -1.875345616525357E+00, 9.902896607564562E-01 }, /* 2609 Hz */
-    { 9.951429784561606E-01, -1.875254855284699E+00, 9.951429784561606E-01, -1.875254855284699E+00, 9.902859569123212E-01 }, /* 2610 Hz */
-    { 9.951411265409522E-01, -1.875164062249858E+00, 9.951411265409522E-01, -1.875164062249858E+00, 9.902822530819044E-01 }, /* 2611 Hz */
-    { 9.951392746326025E-01, -1.875073237422504E+00, 9.951392746326025E-01, -1.875073237422504E+00, 9.902785492652051E-01 }, /* 2612 Hz */
-    { 9.951374227311117E-01, -1.874982380804315E+00, 9.951374227311117E-01, -1.874982380804315E+00, 9.902748454622234E-01 }, /* 2613 Hz */
-    { 9.951355708364795E-01, -1.874891492396962E+00, 9.951355708364795E-01, -1.874891492396962E+00, 9.902711416729590E-01 }, /* 2614 Hz */
-    { 9.951337189487059E-01, -1.874800572202122E+00, 9.951337189487059E-01, -1.874800572202122E+00, 9.902674378974119E-01 }, /* 2615 Hz */
-    { 9.951318670677913E-01, -1.874709620221471E+00, 9.951318670677913E-01, -1.874709620221471E+00, 9.902637341355827E-01 }, /* 2616 Hz */
-    { 9.951300151937350E-01, -1.874618636456684E+00, 9.951300151937350E-01, -1.874618636456684E+00, 9.902600303874700E-01 }, /* 2617 Hz */
-    { 9.951281633265373E-01, -1.874527620909437E+00, 9.951281633265373E-01, -1.874527620909437E+00, 9.902563266530746E-01 }, /* 2618 Hz */
-    { 9.951263114661978E-01, -1.874436573581409E+00, 9.951263114661978E-01, -1.874436573581409E+00, 9.902526229323956E-01 }, /* 2619 Hz */
-    { 9.951244596127171E-01, -1.874345494474276E+00, 9.951244596127171E-01, -1.874345494474276E+00, 9.902489192254342E-01 }, /* 2620 Hz */
-    { 9.951226077660945E-01, -1.874254383589717E+00, 9.951226077660945E-01, -1.874254383589717E+00, 9.902452155321890E-01 }, /* 2621 Hz */
-    { 9.951207559263304E-01, -1.874163240929411E+00, 9.951207559263304E-01, -1.874163240929411E+00, 9.902415118526608E-01 }, /* 2622 Hz */
-    { 9.951189040934244E-01, -1.874072066495037E+00, 9.951189040934244E-01, -1.874072066495037E+00, 9.902378081868488E-01 }, /* 2623 Hz */
-    { 9.951170522673768E-01, -1.873980860288275E+00, 9.951170522673768E-01, -1.873980860288275E+00, 9.902341045347536E-01 }, /* 2624 Hz */
-    { 9.951152004481874E-01, -1.873889622310806E+00, 9.951152004481874E-01, -1.873889622310806E+00, 9.902304008963747E-01 }, /* 2625 Hz */
-    { 9.951133486358558E-01, -1.873798352564309E+00, 9.951133486358558E-01, -1.873798352564309E+00, 9.902266972717115E-01 }, /* 2626 Hz */
-    { 9.951114968303825E-01, -1.873707051050467E+00, 9.951114968303825E-01, -1.873707051050467E+00, 9.902229936607649E-01 }, /* 2627 Hz */
-    { 9.951096450317672E-01, -1.873615717770963E+00, 9.951096450317672E-01, -1.873615717770963E+00, 9.902192900635345E-01 }, /* 2628 Hz */
-    { 9.951077932400098E-01, -1.873524352727477E+00, 9.951077932400098E-01, -1.873524352727477E+00, 9.902155864800195E-01 }, /* 2629 Hz */
-    { 9.951059414551103E-01, -1.873432955921694E+00, 9.951059414551103E-01, -1.873432955921694E+00, 9.902118829102207E-01 }, /* 2630 Hz */
-    { 9.951040896770688E-01, -1.873341527355296E+00, 9.951040896770688E-01, -1.873341527355296E+00, 9.902081793541375E-01 }, /* 2631 Hz */
-    { 9.951022379058848E-01, -1.873250067029969E+00, 9.951022379058848E-01, -1.873250067029969E+00, 9.902044758117696E-01 }, /* 2632 Hz */
-    { 9.951003861415588E-01, -1.873158574947397E+00, 9.951003861415588E-01, -1.873158574947397E+00, 9.902007722831176E-01 }, /* 2633 Hz */
-    { 9.950985343840906E-01, -1.873067051109265E+00, 9.950985343840906E-01, -1.873067051109265E+00, 9.901970687681811E-01 }, /* 2634 Hz */
-    { 9.950966826334797E-01, -1.872975495517258E+00, 9.950966826334797E-01, -1.872975495517258E+00, 9.901933652669594E-01 }, /* 2635 Hz */
-    { 9.950948308897268E-01, -1.872883908173064E+00, 9.950948308897268E-01, -1.872883908173064E+00, 9.901896617794537E-01 }, /* 2636 Hz */
-    { 9.950929791528312E-01, -1.872792289078369E+00, 9.950929791528312E-01, -1.872792289078369E+00, 9.901859583056625E-01 }, /* 2637 Hz */
-    { 9.950911274227930E-01, -1.872700638234859E+00, 9.950911274227930E-01, -1.872700638234859E+00, 9.901822548455861E-01 }, /* 2638 Hz */
-    { 9.950892756996126E-01, -1.872608955644225E+00, 9.950892756996126E-01, -1.872608955644225E+00, 9.901785513992252E-01 }, /* 2639 Hz */
-    { 9.950874239832894E-01, -1.872517241308153E+00, 9.950874239832894E-01, -1.872517241308153E+00, 9.901748479665788E-01 }, /* 2640 Hz */
-    { 9.950855722738234E-01, -1.872425495228333E+00, 9.950855722738234E-01, -1.872425495228333E+00, 9.901711445476469E-01 }, /* 2641 Hz */
-    { 9.950837205712150E-01, -1.872333717406454E+00, 9.950837205712150E-01, -1.872333717406454E+00, 9.901674411424299E-01 }, /* 2642 Hz */
-    { 9.950818688754636E-01, -1.872241907844207E+00, 9.950818688754636E-01, -1.872241907844207E+00, 9.901637377509271E-01 }, /* 2643 Hz */
-    { 9.950800171865696E-01, -1.872150066543282E+00, 9.950800171865696E-01, -1.872150066543282E+00, 9.901600343731392E-01 }, /* 2644 Hz */
-    { 9.950781655045324E-01, -1.872058193505369E+00, 9.950781655045324E-01, -1.872058193505369E+00, 9.901563310090649E-01 }, /* 2645 Hz */
-    { 9.950763138293526E-01, -1.871966288732162E+00, 9.950763138293526E-01, -1.871966288732162E+00, 9.901526276587052E-01 }, /* 2646 Hz */
-    { 9.950744621610299E-01, -1.871874352225351E+00, 9.950744621610299E-01, -1.871874352225351E+00, 9.901489243220598E-01 }, /* 2647 Hz */
-    { 9.950726104995640E-01, -1.871782383986630E+00, 9.950726104995640E-01, -1.871782383986630E+00, 9.901452209991279E-01 }, /* 2648 Hz */
-    { 9.950707588449550E-01, -1.871690384017692E+00, 9.950707588449550E-01, -1.871690384017692E+00, 9.901415176899100E-01 }, /* 2649 Hz */
-    { 9.950689071972030E-01, -1.871598352320231E+00, 9.950689071972030E-01, -1.871598352320231E+00, 9.901378143944060E-01 }, /* 2650 Hz */
-    { 9.950670555563079E-01, -1.871506288895942E+00, 9.950670555563079E-01, -1.871506288895942E+00, 9.901341111126158E-01 }, /* 2651 Hz */
-    { 9.950652039222695E-01, -1.871414193746519E+00, 9.950652039222695E-01, -1.871414193746519E+00, 9.901304078445390E-01 }, /* 2652 Hz */
-    { 9.950633522950877E-01, -1.871322066873656E+00, 9.950633522950877E-01, -1.871322066873656E+00, 9.901267045901754E-01 }, /* 2653 Hz */
-    { 9.950615006747628E-01, -1.871229908279052E+00, 9.950615006747628E-01, -1.871229908279052E+00, 9.901230013495257E-01 }, /* 2654 Hz */
-    { 9.950596490612944E-01, -1.871137717964402E+00, 9.950596490612944E-01, -1.871137717964402E+00, 9.901192981225888E-01 }, /* 2655 Hz */
-    { 9.950577974546827E-01, -1.871045495931402E+00, 9.950577974546827E-01, -1.871045495931402E+00, 9.901155949093654E-01 }, /* 2656 Hz */
-    { 9.950559458549273E-01, -1.870953242181752E+00, 9.950559458549273E-01, -1.870953242181752E+00, 9.901118917098546E-01 }, /* 2657 Hz */
-    { 9.950540942620286E-01, -1.870860956717148E+00, 9.950540942620286E-01, -1.870860956717148E+00, 9.901081885240572E-01 }, /* 2658 Hz */
-    { 9.950522426759865E-01, -1.870768639539290E+00, 9.950522426759865E-01, -1.870768639539290E+00, 9.901044853519729E-01 }, /* 2659 Hz */
-    { 9.950503910968003E-01, -1.870676290649876E+00, 9.950503910968003E-01, -1.870676290649876E+00, 9.901007821936005E-01 }, /* 2660 Hz */
-    { 9.950485395244707E-01, -1.870583910050607E+00, 9.950485395244707E-01, -1.870583910050607E+00, 9.900970790489414E-01 }, /* 2661 Hz */
-    { 9.950466879589974E-01, -1.870491497743183E+00, 9.950466879589974E-01, -1.870491497743183E+00, 9.900933759179948E-01 }, /* 2662 Hz */
-    { 9.950448364003802E-01, -1.870399053729304E+00, 9.950448364003802E-01, -1.870399053729304E+00, 9.900896728007604E-01 }, /* 2663 Hz */
-    { 9.950429848486193E-01, -1.870306578010672E+00, 9.950429848486193E-01, -1.870306578010672E+00, 9.900859696972386E-01 }, /* 2664 Hz */
-    { 9.950411333037146E-01, -1.870214070588989E+00, 9.950411333037146E-01, -1.870214070588989E+00, 9.900822666074292E-01 }, /* 2665 Hz */
-    { 9.950392817656657E-01, -1.870121531465957E+00, 9.950392817656657E-01, -1.870121531465957E+00, 9.900785635313314E-01 }, /* 2666 Hz */
-    { 9.950374302344730E-01, -1.870028960643279E+00, 9.950374302344730E-01, -1.870028960643279E+00, 9.900748604689460E-01 }, /* 2667 Hz */
-    { 9.950355787101363E-01, -1.869936358122658E+00, 9.950355787101363E-01, -1.869936358122658E+00, 9.900711574202725E-01 }, /* 2668 Hz */
-    { 9.950337271926553E-01, -1.869843723905799E+00, 9.950337271926553E-01, -1.869843723905799E+00, 9.900674543853105E-01 }, /* 2669 Hz */
-    { 9.950318756820302E-01, -1.869751057994406E+00, 9.950318756820302E-01, -1.869751057994406E+00, 9.900637513640604E-01 }, /* 2670 Hz */
-    { 9.950300241782613E-01, -1.869658360390185E+00, 9.950300241782613E-01, -1.869658360390185E+00, 9.900600483565225E-01 }, /* 2671 Hz */
-    { 9.950281726813478E-01, -1.869565631094840E+00, 9.950281726813478E-01, -1.869565631094840E+00, 9.900563453626956E-01 }, /* 2672 Hz */
-    { 9.950263211912902E-01, -1.869472870110079E+00, 9.950263211912902E-01, -1.869472870110079E+00, 9.900526423825804E-01 }, /* 2673 Hz */
-    { 9.950244697080880E-01, -1.869380077437607E+00, 9.950244697080880E-01, -1.869380077437607E+00, 9.900489394161760E-01 }, /* 2674 Hz */
-    { 9.950226182317418E-01, -1.869287253079132E+00, 9.950226182317418E-01, -1.869287253079132E+00, 9.900452364634835E-01 }, /* 2675 Hz */
-    { 9.950207667622509E-01, -1.869194397036362E+00, 9.950207667622509E-01, -1.869194397036362E+00, 9.900415335245019E-01 }, /* 2676 Hz */
-    { 9.950189152996155E-01, -1.869101509311005E+00, 9.950189152996155E-01, -1.869101509311005E+00, 9.900378305992310E-01 }, /* 2677 Hz */
-    { 9.950170638438355E-01, -1.869008589904770E+00, 9.950170638438355E-01, -1.869008589904770E+00, 9.900341276876710E-01 }, /* 2678 Hz */
-    { 9.950152123949111E-01, -1.868915638819366E+00, 9.950152123949111E-01, -1.868915638819366E+00, 9.900304247898222E-01 }, /* 2679 Hz */
-    { 9.950133609528420E-01, -1.868822656056504E+00, 9.950133609528420E-01, -1.868822656056504E+00, 9.900267219056840E-01 }, /* 2680 Hz */
-    { 9.950115095176281E-01, -1.868729641617893E+00, 9.950115095176281E-01, -1.868729641617893E+00, 9.900230190352561E-01 }, /* 2681 Hz */
-    { 9.950096580892696E-01, -1.868636595505245E+00, 9.950096580892696E-01, -1.868636595505245E+00, 9.900193161785391E-01 }, /* 2682 Hz */
-    { 9.950078066677661E-01, -1.868543517720272E+00, 9.950078066677661E-01, -1.868543517720272E+00, 9.900156133355322E-01 }, /* 2683 Hz */
-    { 9.950059552531181E-01, -1.868450408264684E+00, 9.950059552531181E-01, -1.868450408264684E+00, 9.900119105062362E-01 }, /* 2684 Hz */
-    { 9.950041038453249E-01, -1.868357267140196E+00, 9.950041038453249E-01, -1.868357267140196E+00, 9.900082076906498E-01 }, /* 2685 Hz */
-    { 9.950022524443869E-01, -1.868264094348519E+00, 9.950022524443869E-01, -1.868264094348519E+00, 9.900045048887738E-01 }, /* 2686 Hz */
-    { 9.950004010503037E-01, -1.868170889891368E+00, 9.950004010503037E-01, -1.868170889891368E+00, 9.900008021006075E-01 }, /* 2687 Hz */
-    { 9.949985496630757E-01, -1.868077653770458E+00, 9.949985496630757E-01, -1.868077653770458E+00, 9.899970993261513E-01 }, /* 2688 Hz */
-    { 9.949966982827024E-01, -1.867984385987502E+00, 9.949966982827024E-01, -1.867984385987502E+00, 9.899933965654049E-01 }, /* 2689 Hz */
-    { 9.949948469091842E-01, -1.867891086544216E+00, 9.949948469091842E-01, -1.867891086544216E+00, 9.899896938183683E-01 }, /* 2690 Hz */
-    { 9.949929955425205E-01, -1.867797755442315E+00, 9.949929955425205E-01, -1.867797755442315E+00, 9.899859910850410E-01 }, /* 2691 Hz */
-    { 9.949911441827117E-01, -1.867704392683517E+00, 9.949911441827117E-01, -1.867704392683517E+00, 9.899822883654235E-01 }, /* 2692 Hz */
-    { 9.949892928297576E-01, -1.867610998269537E+00, 9.949892928297576E-01, -1.867610998269537E+00, 9.899785856595151E-01 }, /* 2693 Hz */
-    { 9.949874414836581E-01, -1.867517572202095E+00, 9.949874414836581E-01, -1.867517572202095E+00, 9.899748829673163E-01 }, /* 2694 Hz */
-    { 9.949855901444132E-01, -1.867424114482906E+00, 9.949855901444132E-01, -1.867424114482906E+00, 9.899711802888265E-01 }, /* 2695 Hz */
-    { 9.949837388120228E-01, -1.867330625113691E+00, 9.949837388120228E-01, -1.867330625113691E+00, 9.899674776240457E-01 }, /* 2696 Hz */
-    { 9.949818874864869E-01, -1.867237104096167E+00, 9.949818874864869E-01, -1.867237104096167E+00, 9.899637749729737E-01 }, /* 2697 Hz */
-    { 9.949800361678056E-01, -1.867143551432055E+00, 9.949800361678056E-01, -1.867143551432055E+00, 9.899600723356112E-01 }, /* 2698 Hz */
-    { 9.949781848559787E-01, -1.867049967123075E+00, 9.949781848559787E-01, -1.867049967123075E+00, 9.899563697119573E-01 }, /* 2699 Hz */
-    { 9.949763335510058E-01, -1.866956351170947E+00, 9.949763335510058E-01, -1.866956351170947E+00, 9.899526671020116E-01 }, /* 2700 Hz */
-    { 9.949744822528874E-01, -1.866862703577392E+00, 9.949744822528874E-01, -1.866862703577392E+00, 9.899489645057749E-01 }, /* 2701 Hz */
-    { 9.949726309616231E-01, -1.866769024344132E+00, 9.949726309616231E-01, -1.866769024344132E+00, 9.899452619232463E-01 }, /* 2702 Hz */
-    { 9.949707796772133E-01, -1.866675313472890E+00, 9.949707796772133E-01, -1.866675313472890E+00, 9.899415593544265E-01 }, /* 2703 Hz */
-    { 9.949689283996573E-01, -1.866581570965387E+00, 9.949689283996573E-01, -1.866581570965387E+00, 9.899378567993147E-01 }, /* 2704 Hz */
-    { 9.949670771289556E-01, -1.866487796823349E+00, 9.949670771289556E-01, -1.866487796823349E+00, 9.899341542579112E-01 }, /* 2705 Hz */
-    { 9.949652258651077E-01, -1.866393991048497E+00, 9.949652258651077E-01, -1.866393991048497E+00, 9.899304517302154E-01 }, /* 2706 Hz */
-    { 9.949633746081141E-01, -1.866300153642557E+00, 9.949633746081141E-01, -1.866300153642557E+00, 9.899267492162283E-01 }, /* 2707 Hz */
-    { 9.949615233579742E-01, -1.866206284607254E+00, 9.949615233579742E-01, -1.866206284607254E+00, 9.899230467159483E-01 }, /* 2708 Hz */
-    { 9.949596721146881E-01, -1.866112383944313E+00, 9.949596721146881E-01, -1.866112383944313E+00, 9.899193442293761E-01 }, /* 2709 Hz */
-    { 9.949578208782560E-01, -1.866018451655460E+00, 9.949578208782560E-01, -1.866018451655460E+00, 9.899156417565120E-01 }, /* 2710 Hz */
-    { 9.949559696486776E-01, -1.865924487742421E+00, 9.949559696486776E-01, -1.865924487742421E+00, 9.899119392973552E-01 }, /* 2711 Hz */
-    { 9.949541184259532E-01, -1.865830492206924E+00, 9.949541184259532E-01, -1.865830492206924E+00, 9.899082368519063E-01 }, /* 2712 Hz */
-    { 9.949522672100820E-01, -1.865736465050696E+00, 9.949522672100820E-01, -1.865736465050696E+00, 9.899045344201640E-01 }, /* 2713 Hz */
-    { 9.949504160010647E-01, -1.865642406275466E+00, 9.949504160010647E-01, -1.865642406275466E+00, 9.899008320021294E-01 }, /* 2714 Hz */
-    { 9.949485647989009E-01, -1.865548315882962E+00, 9.949485647989009E-01, -1.865548315882962E+00, 9.898971295978019E-01 }, /* 2715 Hz */
-    { 9.949467136035907E-01, -1.865454193874912E+00, 9.949467136035907E-01, -1.865454193874912E+00, 9.898934272071813E-01 }, /* 2716 Hz */
-    { 9.949448624151339E-01, -1.865360040253048E+00, 9.949448624151339E-01, -1.865360040253048E+00, 9.898897248302678E-01 }, /* 2717 Hz */
-    { 9.949430112335305E-01, -1.865265855019099E+00, 9.949430112335305E-01, -1.865265855019099E+00, 9.898860224670609E-01 }, /* 2718 Hz */
-    { 9.949411600587805E-01, -1.865171638174796E+00, 9.949411600587805E-01, -1.865171638174796E+00, 9.898823201175611E-01 }, /* 2719 Hz */
-    { 9.949393088908839E-01, -1.865077389721871E+00, 9.949393088908839E-01, -1.865077389721871E+00, 9.898786177817678E-01 }, /* 2720 Hz */
-    { 9.949374577298403E-01, -1.864983109662054E+00, 9.949374577298403E-01, -1.864983109662054E+00, 9.898749154596806E-01 }, /* 2721 Hz */
-    { 9.949356065756503E-01, -1.864888797997079E+00, 9.949356065756503E-01, -1.864888797997079E+00, 9.898712131513006E-01 }, /* 2722 Hz */
-    { 9.949337554283132E-01, -1.864794454728679E+00, 9.949337554283132E-01, -1.864794454728679E+00, 9.898675108566264E-01 }, /* 2723 Hz */
-    { 9.949319042878292E-01, -1.864700079858586E+00, 9.949319042878292E-01, -1.864700079858586E+00, 9.898638085756584E-01 }, /* 2724 Hz */
-    { 9.949300531541982E-01, -1.864605673388536E+00, 9.949300531541982E-01, -1.864605673388536E+00, 9.898601063083965E-01 }, /* 2725 Hz */
-    { 9.949282020274205E-01, -1.864511235320263E+00, 9.949282020274205E-01, -1.864511235320263E+00, 9.898564040548410E-01 }, /* 2726 Hz */
-    { 9.949263509074956E-01, -1.864416765655501E+00, 9.949263509074956E-01, -1.864416765655501E+00, 9.898527018149912E-01 }, /* 2727 Hz */
-    { 9.949244997944234E-01, -1.864322264395986E+00, 9.949244997944234E-01, -1.864322264395986E+00, 9.898489995888469E-01 }, /* 2728 Hz */
-    { 9.949226486882043E-01, -1.864227731543455E+00, 9.949226486882043E-01, -1.864227731543455E+00, 9.898452973764087E-01 }, /* 2729 Hz */
-    { 9.949207975888380E-01, -1.864133167099644E+00, 9.949207975888380E-01, -1.864133167099644E+00, 9.898415951776760E-01 }, /* 2730 Hz */
-    { 9.949189464963244E-01, -1.864038571066290E+00, 9.949189464963244E-01, -1.864038571066290E+00, 9.898378929926488E-01 }, /* 2731 Hz */
-    { 9.949170954106636E-01, -1.863943943445132E+00, 9.949170954106636E-01, -1.863943943445132E+00, 9.898341908213273E-01 }, /* 2732 Hz */
-    { 9.949152443318554E-01, -1.863849284237907E+00, 9.949152443318554E-01, -1.863849284237907E+00, 9.898304886637108E-01 }, /* 2733 Hz */
-    { 9.949133932598999E-01, -1.863754593446354E+00, 9.949133932598999E-01, -1.863754593446354E+00, 9.898267865197998E-01 }, /* 2734 Hz */
-    { 9.949115421947967E-01, -1.863659871072213E+00, 9.949115421947967E-01, -1.863659871072213E+00, 9.898230843895934E-01 }, /* 2735 Hz */
-    { 9.949096911365460E-01, -1.863565117117222E+00, 9.949096911365460E-01, -1.863565117117222E+00, 9.898193822730921E-01 }, /* 2736 Hz */
-    { 9.949078400851482E-01, -1.863470331583125E+00, 9.949078400851482E-01, -1.863470331583125E+00, 9.898156801702964E-01 }, /* 2737 Hz */
-    { 9.949059890406025E-01, -1.863375514471660E+00, 9.949059890406025E-01, -1.863375514471660E+00, 9.898119780812049E-01 }, /* 2738 Hz */
-    { 9.949041380029089E-01, -1.863280665784569E+00, 9.949041380029089E-01, -1.863280665784569E+00, 9.898082760058178E-01 }, /* 2739 Hz */
-    { 9.949022869720680E-01, -1.863185785523594E+00, 9.949022869720680E-01, -1.863185785523594E+00, 9.898045739441359E-01 }, /* 2740 Hz */
-    { 9.949004359480792E-01, -1.863090873690479E+00, 9.949004359480792E-01, -1.863090873690479E+00, 9.898008718961584E-01 }, /* 2741 Hz */
-    { 9.948985849309424E-01, -1.862995930286965E+00, 9.948985849309424E-01, -1.862995930286965E+00, 9.897971698618848E-01 }, /* 2742 Hz */
-    { 9.948967339206579E-01, -1.862900955314797E+00, 9.948967339206579E-01, -1.862900955314797E+00, 9.897934678413158E-01 }, /* 2743 Hz */
-    { 9.948948829172254E-01, -1.862805948775719E+00, 9.948948829172254E-01, -1.862805948775719E+00, 9.897897658344508E-01 }, /* 2744 Hz */
-    { 9.948930319206452E-01, -1.862710910671476E+00, 9.948930319206452E-01, -1.862710910671476E+00, 9.897860638412903E-01 }, /* 2745 Hz */
-    { 9.948911809309168E-01, -1.862615841003812E+00, 9.948911809309168E-01, -1.862615841003812E+00, 9.897823618618335E-01 }, /* 2746 Hz */
-    { 9.948893299480405E-01, -1.862520739774474E+00, 9.948893299480405E-01, -1.862520739774474E+00, 9.897786598960809E-01 }, /* 2747 Hz */
-    { 9.948874789720158E-01, -1.862425606985207E+00, 9.948874789720158E-01, -1.862425606985207E+00, 9.897749579440316E-01 }, /* 2748 Hz */
-    { 9.948856280028431E-01, -1.862330442637759E+00, 9.948856280028431E-01, -1.862330442637759E+00, 9.897712560056862E-01 }, /* 2749 Hz */
-    { 9.948837770405222E-01, -1.862235246733877E+00, 9.948837770405222E-01, -1.862235246733877E+00, 9.897675540810444E-01 }, /* 2750 Hz */
-    { 9.948819260850531E-01, -1.862140019275309E+00, 9.948819260850531E-01, -1.862140019275309E+00, 9.897638521701062E-01 }, /* 2751 Hz */
-    { 9.948800751364354E-01, -1.862044760263803E+00, 9.948800751364354E-01, -1.862044760263803E+00, 9.897601502728708E-01 }, /* 2752 Hz */
-    { 9.948782241946696E-01, -1.861949469701109E+00, 9.948782241946696E-01, -1.861949469701109E+00, 9.897564483893393E-01 }, /* 2753 Hz */
-    { 9.948763732597554E-01, -1.861854147588976E+00, 9.948763732597554E-01, -1.861854147588976E+00, 9.897527465195108E-01 }, /* 2754 Hz */
-    { 9.948745223316926E-01, -1.861758793929153E+00, 9.948745223316926E-01, -1.861758793929153E+00, 9.897490446633852E-01 }, /* 2755 Hz */
-    { 9.948726714104814E-01, -1.861663408723392E+00, 9.948726714104814E-01, -1.861663408723392E+00, 9.897453428209628E-01 }, /* 2756 Hz */
-    { 9.948708204961216E-01, -1.861567991973443E+00, 9.948708204961216E-01, -1.861567991973443E+00, 9.897416409922433E-01 }, /* 2757 Hz */
-    { 9.948689695886130E-01, -1.861472543681058E+00, 9.948689695886130E-01, -1.861472543681058E+00, 9.897379391772261E-01 }, /* 2758 Hz */
-    { 9.948671186879560E-01, -1.861377063847990E+00, 9.948671186879560E-01, -1.861377063847990E+00, 9.897342373759119E-01 }, /* 2759 Hz */
-    { 9.948652677941500E-01, -1.861281552475990E+00, 9.948652677941500E-01, -1.861281552475990E+00, 9.897305355882999E-01 }, /* 2760 Hz */
-    { 9.948634169071954E-01, -1.861186009566813E+00, 9.948634169071954E-01, -1.861186009566813E+00, 9.897268338143907E-01 }, /* 2761 Hz */
-    { 9.948615660270920E-01, -1.861090435122212E+00, 9.948615660270920E-01, -1.861090435122212E+00, 9.897231320541839E-01 }, /* 2762 Hz */
-    { 9.948597151538398E-01, -1.860994829143942E+00, 9.948597151538398E-01, -1.860994829143942E+00, 9.897194303076795E-01 }, /* 2763 Hz */
-    { 9.948578642874383E-01, -1.860899191633756E+00, 9.948578642874383E-01, -1.860899191633756E+00, 9.897157285748766E-01 }, /* 2764 Hz */
-    { 9.948560134278881E-01, -1.860803522593411E+00, 9.948560134278881E-01, -1.860803522593411E+00, 9.897120268557762E-01 }, /* 2765 Hz */
-    { 9.948541625751888E-01, -1.860707822024662E+00, 9.948541625751888E-01, -1.860707822024662E+00, 9.897083251503775E-01 }, /* 2766 Hz */
-    { 9.948523117293404E-01, -1.860612089929266E+00, 9.948523117293404E-01, -1.860612089929266E+00, 9.897046234586808E-01 }, /* 2767 Hz */
-    { 9.948504608903431E-01, -1.860516326308981E+00, 9.948504608903431E-01, -1.860516326308981E+00, 9.897009217806862E-01 }, /* 2768 Hz */
-    { 9.948486100581964E-01, -1.860420531165562E+00, 9.948486100581964E-01, -1.860420531165562E+00, 9.896972201163927E-01 }, /* 2769 Hz */
-    { 9.948467592329004E-01, -1.860324704500769E+00, 9.948467592329004E-01, -1.860324704500769E+00, 9.896935184658009E-01 }, /* 2770 Hz */
-    { 9.948449084144554E-01, -1.860228846316360E+00, 9.948449084144554E-01, -1.860228846316360E+00, 9.896898168289108E-01 }, /* 2771 Hz */
-    { 9.948430576028606E-01, -1.860132956614093E+00, 9.948430576028606E-01, -1.860132956614093E+00, 9.896861152057213E-01 }, /* 2772 Hz */
-    { 9.948412067981169E-01, -1.860037035395730E+00, 9.948412067981169E-01, -1.860037035395730E+00, 9.896824135962339E-01 }, /* 2773 Hz */
-    { 9.948393560002236E-01, -1.859941082663029E+00, 9.948393560002236E-01, -1.859941082663029E+00, 9.896787120004471E-01 }, /* 2774 Hz */
-    { 9.948375052091806E-01, -1.859845098417752E+00, 9.948375052091806E-01, -1.859845098417752E+00, 9.896750104183611E-01 }, /* 2775 Hz */
-    { 9.948356544249882E-01, -1.859749082661660E+00, 9.948356544249882E-01, -1.859749082661660E+00, 9.896713088499764E-01 }, /* 2776 Hz */
-    { 9.948338036476463E-01, -1.859653035396514E+00, 9.948338036476463E-01, -1.859653035396514E+00, 9.896676072952926E-01 }, /* 2777 Hz */
-    { 9.948319528771546E-01, -1.859556956624077E+00, 9.948319528771546E-01, -1.859556956624077E+00, 9.896639057543093E-01 }, /* 2778 Hz */
-    { 9.948301021135134E-01, -1.859460846346112E+00, 9.948301021135134E-01, -1.859460846346112E+00, 9.896602042270268E-01 }, /* 2779 Hz */
-    { 9.948282513567225E-01, -1.859364704564382E+00, 9.948282513567225E-01, -1.859364704564382E+00, 9.896565027134450E-01 }, /* 2780 Hz */
-    { 9.948264006067816E-01, -1.859268531280651E+00, 9.948264006067816E-01, -1.859268531280651E+00, 9.896528012135632E-01 }, /* 2781 Hz */
-    { 9.948245498636910E-01, -1.859172326496683E+00, 9.948245498636910E-01, -1.859172326496683E+00, 9.896490997273819E-01 }, /* 2782 Hz */
-    { 9.948226991274502E-01, -1.859076090214243E+00, 9.948226991274502E-01, -1.859076090214243E+00, 9.896453982549005E-01 }, /* 2783 Hz */
-    { 9.948208483980598E-01, -1.858979822435098E+00, 9.948208483980598E-01, -1.858979822435098E+00, 9.896416967961197E-01 }, /* 2784 Hz */
-    { 9.948189976755192E-01, -1.858883523161012E+00, 9.948189976755192E-01, -1.858883523161012E+00, 9.896379953510384E-01 }, /* 2785 Hz */
-    { 9.948171469598288E-01, -1.858787192393753E+00, 9.948171469598288E-01, -1.858787192393753E+00, 9.896342939196576E-01 }, /* 2786 Hz */
-    { 9.948152962509881E-01, -1.858690830135087E+00, 9.948152962509881E-01, -1.858690830135087E+00, 9.896305925019762E-01 }, /* 2787 Hz */
-    { 9.948134455489972E-01, -1.858594436386782E+00, 9.948134455489972E-01, -1.858594436386782E+00, 9.896268910979944E-01 }, /* 2788 Hz */
-    { 9.948115948538562E-01, -1.858498011150607E+00, 9.948115948538562E-01, -1.858498011150607E+00, 9.896231897077123E-01 }, /* 2789 Hz */
-    { 9.948097441655650E-01, -1.858401554428330E+00, 9.948097441655650E-01, -1.858401554428330E+00, 9.896194883311300E-01 }, /* 2790 Hz */
-    { 9.948078934841234E-01, -1.858305066221720E+00, 9.948078934841234E-01, -1.858305066221720E+00, 9.896157869682467E-01 }, /* 2791 Hz */
-    { 9.948060428095313E-01, -1.858208546532546E+00, 9.948060428095313E-01, -1.858208546532546E+00, 9.896120856190627E-01 }, /* 2792 Hz */
-    { 9.948041921417889E-01, -1.858111995362581E+00, 9.948041921417889E-01, -1.858111995362581E+00, 9.896083842835779E-01 }, /* 2793 Hz */
-    { 9.948023414808962E-01, -1.858015412713593E+00, 9.948023414808962E-01, -1.858015412713593E+00, 9.896046829617924E-01 }, /* 2794 Hz */
-    { 9.948004908268530E-01, -1.857918798587355E+00, 9.948004908268530E-01, -1.857918798587355E+00, 9.896009816537059E-01 }, /* 2795 Hz */
-    { 9.947986401796591E-01, -1.857822152985638E+00, 9.947986401796591E-01, -1.857822152985638E+00, 9.895972803593183E-01 }, /* 2796 Hz */
-    { 9.947967895393146E-01, -1.857725475910215E+00, 9.947967895393146E-01, -1.857725475910215E+00, 9.895935790786292E-01 }, /* 2797 Hz */
-    { 9.947949389058195E-01, -1.857628767362859E+00, 9.947949389058195E-01, -1.857628767362859E+00, 9.895898778116390E-01 }, /* 2798 Hz */
-    { 9.947930882791737E-01, -1.857532027345343E+00, 9.947930882791737E-01, -1.857532027345343E+00, 9.895861765583474E-01 }, /* 2799 Hz */
-    { 9.947912376593769E-01, -1.857435255859441E+00, 9.947912376593769E-01, -1.857435255859441E+00, 9.895824753187539E-01 }, /* 2800 Hz */
-    { 9.947893870464296E-01, -1.857338452906928E+00, 9.947893870464296E-01, -1.857338452906928E+00, 9.895787740928592E-01 }, /* 2801 Hz */
-    { 9.947875364403314E-01, -1.857241618489579E+00, 9.947875364403314E-01, -1.857241618489579E+00, 9.895750728806627E-01 }, /* 2802 Hz */
-    { 9.947856858410820E-01, -1.857144752609168E+00, 9.947856858410820E-01, -1.857144752609168E+00, 9.895713716821639E-01 }, /* 2803 Hz */
-    { 9.947838352486819E-01, -1.857047855267474E+00, 9.947838352486819E-01, -1.857047855267474E+00, 9.895676704973637E-01 }, /* 2804 Hz */
-    { 9.947819846631308E-01, -1.856950926466273E+00, 9.947819846631308E-01, -1.856950926466273E+00, 9.895639693262617E-01 }, /* 2805 Hz */
-    { 9.947801340844286E-01, -1.856853966207340E+00, 9.947801340844286E-01, -1.856853966207340E+00, 9.895602681688571E-01 }, /* 2806 Hz */
-    { 9.947782835125751E-01, -1.856756974492455E+00, 9.947782835125751E-01, -1.856756974492455E+00, 9.895565670251503E-01 }, /* 2807 Hz */
-    { 9.947764329475705E-01, -1.856659951323395E+00, 9.947764329475705E-01, -1.856659951323395E+00, 9.895528658951409E-01 }, /* 2808 Hz */
-    { 9.947745823894149E-01, -1.856562896701940E+00, 9.947745823894149E-01, -1.856562896701940E+00, 9.895491647788297E-01 }, /* 2809 Hz */
-    { 9.947727318381077E-01, -1.856465810629868E+00, 9.947727318381077E-01, -1.856465810629868E+00, 9.895454636762153E-01 }, /* 2810 Hz */
-    { 9.947708812936494E-01, -1.856368693108960E+00, 9.947708812936494E-01, -1.856368693108960E+00, 9.895417625872989E-01 }, /* 2811 Hz */
-    { 9.947690307560396E-01, -1.856271544140996E+00, 9.947690307560396E-01, -1.856271544140996E+00, 9.895380615120792E-01 }, /* 2812 Hz */
-    { 9.947671802252784E-01, -1.856174363727756E+00, 9.947671802252784E-01, -1.856174363727756E+00, 9.895343604505569E-01 }, /* 2813 Hz */
-    { 9.947653297013659E-01, -1.856077151871024E+00, 9.947653297013659E-01, -1.856077151871024E+00, 9.895306594027318E-01 }, /* 2814 Hz */
-    { 9.947634791843016E-01, -1.855979908572578E+00, 9.947634791843016E-01, -1.855979908572578E+00, 9.895269583686033E-01 }, /* 2815 Hz */
-    { 9.947616286740859E-01, -1.855882633834204E+00, 9.947616286740859E-01, -1.855882633834204E+00, 9.895232573481718E-01 }, /* 2816 Hz */
-    { 9.947597781707186E-01, -1.855785327657685E+00, 9.947597781707186E-01, -1.855785327657685E+00, 9.895195563414372E-01 }, /* 2817 Hz */
-    { 9.947579276741995E-01, -1.855687990044802E+00, 9.947579276741995E-01, -1.855687990044802E+00, 9.895158553483989E-01 }, /* 2818 Hz */
-    { 9.947560771845287E-01, -1.855590620997341E+00, 9.947560771845287E-01, -1.855590620997341E+00, 9.895121543690575E-01 }, /* 2819 Hz */
-    { 9.947542267017061E-01, -1.855493220517086E+00, 9.947542267017061E-01, -1.855493220517086E+00, 9.895084534034122E-01 }, /* 2820 Hz */
-    { 9.947523762257318E-01, -1.855395788605823E+00, 9.947523762257318E-01, -1.855395788605823E+00, 9.895047524514635E-01 }, /* 2821 Hz */
-    { 9.947505257566056E-01, -1.855298325265337E+00, 9.947505257566056E-01, -1.855298325265337E+00, 9.895010515132112E-01 }, /* 2822 Hz */
-    { 9.947486752943272E-01, -1.855200830497415E+00, 9.947486752943272E-01, -1.855200830497415E+00, 9.894973505886544E-01 }, /* 2823 Hz */
-    { 9.947468248388970E-01, -1.855103304303842E+00, 9.947468248388970E-01, -1.855103304303842E+00, 9.894936496777940E-01 }, /* 2824 Hz */
-    { 9.947449743903147E-01, -1.855005746686407E+00, 9.947449743903147E-01, -1.855005746686407E+00, 9.894899487806295E-01 }, /* 2825 Hz */
-    { 9.947431239485806E-01, -1.854908157646898E+00, 9.947431239485806E-01, -1.854908157646898E+00, 9.894862478971611E-01 }, /* 2826 Hz */
-    { 9.947412735136941E-01, -1.854810537187102E+00, 9.947412735136941E-01, -1.854810537187102E+00, 9.894825470273882E-01 }, /* 2827 Hz */
-    { 9.947394230856553E-01, -1.854712885308808E+00, 9.947394230856553E-01, -1.854712885308808E+00, 9.894788461713107E-01 }, /* 2828 Hz */
-    { 9.947375726644644E-01, -1.854615202013807E+00, 9.947375726644644E-01, -1.854615202013807E+00, 9.894751453289288E-01 }, /* 2829 Hz */
-    { 9.947357222501214E-01, -1.854517487303889E+00, 9.947357222501214E-01, -1.854517487303889E+00, 9.894714445002428E-01 }, /* 2830 Hz */
-    { 9.947338718426257E-01, -1.854419741180842E+00, 9.947338718426257E-01, -1.854419741180842E+00, 9.894677436852515E-01 }, /* 2831 Hz */
-    { 9.947320214419778E-01, -1.854321963646459E+00, 9.947320214419778E-01, -1.854321963646459E+00, 9.894640428839556E-01 }, /* 2832 Hz */
-    { 9.947301710481775E-01, -1.854224154702531E+00, 9.947301710481775E-01, -1.854224154702531E+00, 9.894603420963550E-01 }, /* 2833 Hz */
-    { 9.947283206612245E-01, -1.854126314350850E+00, 9.947283206612245E-01, -1.854126314350850E+00, 9.894566413224490E-01 }, /* 2834 Hz */
-    { 9.947264702811193E-01, -1.854028442593209E+00, 9.947264702811193E-01, -1.854028442593209E+00, 9.894529405622385E-01 }, /* 2835 Hz */
-    { 9.947246199078612E-01, -1.853930539431401E+00, 9.947246199078612E-01, -1.853930539431401E+00, 9.894492398157224E-01 }, /* 2836 Hz */
-    { 9.947227695414506E-01, -1.853832604867220E+00, 9.947227695414506E-01, -1.853832604867220E+00, 9.894455390829011E-01 }, /* 2837 Hz */
-    { 9.947209191818872E-01, -1.853734638902460E+00, 9.947209191818872E-01, -1.853734638902460E+00, 9.894418383637744E-01 }, /* 2838 Hz */
-    { 9.947190688291710E-01, -1.853636641538915E+00, 9.947190688291710E-01, -1.853636641538915E+00, 9.894381376583421E-01 }, /* 2839 Hz */
-    { 9.947172184833022E-01, -1.853538612778381E+00, 9.947172184833022E-01, -1.853538612778381E+00, 9.894344369666044E-01 }, /* 2840 Hz */
-    { 9.947153681442804E-01, -1.853440552622654E+00, 9.947153681442804E-01, -1.853440552622654E+00, 9.894307362885608E-01 }, /* 2841 Hz */
-    { 9.947135178121057E-01, -1.853342461073530E+00, 9.947135178121057E-01, -1.853342461073530E+00, 9.894270356242114E-01 }, /* 2842 Hz */
-    { 9.947116674867781E-01, -1.853244338132806E+00, 9.947116674867781E-01, -1.853244338132806E+00, 9.894233349735562E-01 }, /* 2843 Hz */
-    { 9.947098171682974E-01, -1.853146183802279E+00, 9.947098171682974E-01, -1.853146183802279E+00, 9.894196343365949E-01 }, /* 2844 Hz */
-    { 9.947079668566638E-01, -1.853047998083748E+00, 9.947079668566638E-01, -1.853047998083748E+00, 9.894159337133277E-01 }, /* 2845 Hz */
-    { 9.947061165518770E-01, -1.852949780979010E+00, 9.947061165518770E-01, -1.852949780979010E+00, 9.894122331037540E-01 }, /* 2846 Hz */
-    { 9.947042662539372E-01, -1.852851532489865E+00, 9.947042662539372E-01, -1.852851532489865E+00, 9.894085325078743E-01 }, /* 2847 Hz */
-    { 9.947024159628440E-01, -1.852753252618113E+00, 9.947024159628440E-01, -1.852753252618113E+00, 9.894048319256881E-01 }, /* 2848 Hz */
-    { 9.947005656785977E-01, -1.852654941365552E+00, 9.947005656785977E-01, -1.852654941365552E+00, 9.894011313571953E-01 }, /* 2849 Hz */
-    { 9.946987154011979E-01, -1.852556598733984E+00, 9.946987154011979E-01, -1.852556598733984E+00, 9.893974308023958E-01 }, /* 2850 Hz */
-    { 9.946968651306449E-01, -1.852458224725211E+00, 9.946968651306449E-01, -1.852458224725211E+00, 9.893937302612898E-01 }, /* 2851 Hz */
-    { 9.946950148669383E-01, -1.852359819341033E+00, 9.946950148669383E-01, -1.852359819341033E+00, 9.893900297338767E-01 }, /* 2852 Hz */
-    { 9.946931646100785E-01, -1.852261382583253E+00, 9.946931646100785E-01, -1.852261382583253E+00, 9.893863292201570E-01 }, /* 2853 Hz */
-    { 9.946913143600650E-01, -1.852162914453674E+00, 9.946913143600650E-01, -1.852162914453674E+00, 9.893826287201299E-01 }, /* 2854 Hz */
-    { 9.946894641168978E-01, -1.852064414954098E+00, 9.946894641168978E-01, -1.852064414954098E+00, 9.893789282337957E-01 }, /* 2855 Hz */
-    { 9.946876138805771E-01, -1.851965884086329E+00, 9.946876138805771E-01, -1.851965884086329E+00, 9.893752277611543E-01 }, /* 2856 Hz */
-    { 9.946857636511028E-01, -1.851867321852173E+00, 9.946857636511028E-01, -1.851867321852173E+00, 9.893715273022057E-01 }, /* 2857 Hz */
-    { 9.946839134284748E-01, -1.851768728253433E+00, 9.946839134284748E-01, -1.851768728253433E+00, 9.893678268569497E-01 }, /* 2858 Hz */
-    { 9.946820632126930E-01, -1.851670103291916E+00, 9.946820632126930E-01, -1.851670103291916E+00, 9.893641264253861E-01 }, /* 2859 Hz */
-    { 9.946802130037574E-01, -1.851571446969426E+00, 9.946802130037574E-01, -1.851571446969426E+00, 9.893604260075148E-01 }, /* 2860 Hz */
-    { 9.946783628016680E-01, -1.851472759287771E+00, 9.946783628016680E-01, -1.851472759287771E+00, 9.893567256033360E-01 }, /* 2861 Hz */
-    { 9.946765126064246E-01, -1.851374040248757E+00, 9.946765126064246E-01, -1.851374040248757E+00, 9.893530252128493E-01 }, /* 2862 Hz */
-    { 9.946746624180272E-01, -1.851275289854191E+00, 9.946746624180272E-01, -1.851275289854191E+00, 9.893493248360543E-01 }, /* 2863 Hz */
-    { 9.946728122364757E-01, -1.851176508105883E+00, 9.946728122364757E-01, -1.851176508105883E+00, 9.893456244729515E-01 }, /* 2864 Hz */
-    { 9.946709620617703E-01, -1.851077695005640E+00, 9.946709620617703E-01, -1.851077695005640E+00, 9.893419241235406E-01 }, /* 2865 Hz */
-    { 9.946691118939106E-01, -1.850978850555271E+00, 9.946691118939106E-01, -1.850978850555271E+00, 9.893382237878212E-01 }, /* 2866 Hz */
-    { 9.946672617328970E-01, -1.850879974756586E+00, 9.946672617328970E-01, -1.850879974756586E+00, 9.893345234657940E-01 }, /* 2867 Hz */
-    { 9.946654115787288E-01, -1.850781067611395E+00, 9.946654115787288E-01, -1.850781067611395E+00, 9.893308231574576E-01 }, /* 2868 Hz */
-    { 9.946635614314066E-01, -1.850682129121509E+00, 9.946635614314066E-01, -1.850682129121509E+00, 9.893271228628131E-01 }, /* 2869 Hz */
-    { 9.946617112909301E-01, -1.850583159288739E+00, 9.946617112909301E-01, -1.850583159288739E+00, 9.893234225818601E-01 }, /* 2870 Hz */
-    { 9.946598611572989E-01, -1.850484158114897E+00, 9.946598611572989E-01, -1.850484158114897E+00, 9.893197223145977E-01 }, /* 2871 Hz */
-    { 9.946580110305135E-01, -1.850385125601795E+00, 9.946580110305135E-01, -1.850385125601795E+00, 9.893160220610271E-01 }, /* 2872 Hz */
-    { 9.946561609105735E-01, -1.850286061751245E+00, 9.946561609105735E-01, -1.850286061751245E+00, 9.893123218211470E-01 }, /* 2873 Hz */
-    { 9.946543107974791E-01, -1.850186966565061E+00, 9.946543107974791E-01, -1.850186966565061E+00, 9.893086215949582E-01 }, /* 2874 Hz */
-    { 9.946524606912300E-01, -1.850087840045057E+00, 9.946524606912300E-01, -1.850087840045057E+00, 9.893049213824601E-01 }, /* 2875 Hz */
-    { 9.946506105918265E-01, -1.849988682193048E+00, 9.946506105918265E-01, -1.849988682193048E+00, 9.893012211836529E-01 }, /* 2876 Hz */
-    { 9.946487604992681E-01, -1.849889493010848E+00, 9.946487604992681E-01, -1.849889493010848E+00, 9.892975209985362E-01 }, /* 2877 Hz */
-    { 9.946469104135551E-01, -1.849790272500272E+00, 9.946469104135551E-01, -1.849790272500272E+00, 9.892938208271103E-01 }, /* 2878 Hz */
-    { 9.946450603346872E-01, -1.849691020663137E+00, 9.946450603346872E-01, -1.849691020663137E+00, 9.892901206693745E-01 }, /* 2879 Hz */
-    { 9.946432102626643E-01, -1.849591737501258E+00, 9.946432102626643E-01, -1.849591737501258E+00, 9.892864205253287E-01 }, /* 2880 Hz */
-    { 9.946413601974868E-01, -1.849492423016454E+00, 9.946413601974868E-01, -1.849492423016454E+00, 9.892827203949737E-01 }, /* 2881 Hz */
-    { 9.946395101391542E-01, -1.849393077210542E+00, 9.946395101391542E-01, -1.849393077210542E+00, 9.892790202783084E-01 }, /* 2882 Hz */
-    { 9.946376600876667E-01, -1.849293700085339E+00, 9.946376600876667E-01, -1.849293700085339E+00, 9.892753201753335E-01 }, /* 2883 Hz */
-    { 9.946358100430240E-01, -1.849194291642664E+00, 9.946358100430240E-01, -1.849194291642664E+00, 9.892716200860481E-01 }, /* 2884 Hz */
-    { 9.946339600052264E-01, -1.849094851884336E+00, 9.946339600052264E-01, -1.849094851884336E+00, 9.892679200104528E-01 }, /* 2885 Hz */
-    { 9.946321099742736E-01, -1.848995380812176E+00, 9.946321099742736E-01, -1.848995380812176E+00, 9.892642199485473E-01 }, /* 2886 Hz */
-    { 9.946302599501656E-01, -1.848895878428003E+00, 9.946302599501656E-01, -1.848895878428003E+00, 9.892605199003313E-01 }, /* 2887 Hz */
-    { 9.946284099329025E-01, -1.848796344733638E+00, 9.946284099329025E-01, -1.848796344733638E+00, 9.892568198658049E-01 }, /* 2888 Hz */
-    { 9.946265599224839E-01, -1.848696779730903E+00, 9.946265599224839E-01, -1.848696779730903E+00, 9.892531198449679E-01 }, /* 2889 Hz */
-    { 9.946247099189099E-01, -1.848597183421618E+00, 9.946247099189099E-01, -1.848597183421618E+00, 9.892494198378199E-01 }, /* 2890 Hz */
-    { 9.946228599221806E-01, -1.848497555807606E+00, 9.946228599221806E-01, -1.848497555807606E+00, 9.892457198443612E-01 }, /* 2891 Hz */
-    { 9.946210099322959E-01, -1.848397896890691E+00, 9.946210099322959E-01, -1.848397896890691E+00, 9.892420198645917E-01 }, /* 2892 Hz */
-    { 9.946191599492556E-01, -1.848298206672695E+00, 9.946191599492556E-01, -1.848298206672695E+00, 9.892383198985113E-01 }, /* 2893 Hz */
-    { 9.946173099730597E-01, -1.848198485155442E+00, 9.946173099730597E-01, -1.848198485155442E+00, 9.892346199461195E-01 }, /* 2894 Hz */
-    { 9.946154600037084E-01, -1.848098732340758E+00, 9.946154600037084E-01, -1.848098732340758E+00, 9.892309200074167E-01 }, /* 2895 Hz */
-    { 9.946136100412013E-01, -1.847998948230466E+00, 9.946136100412013E-01, -1.847998948230466E+00, 9.892272200824026E-01 }, /* 2896 Hz */
-    { 9.946117600855386E-01, -1.847899132826393E+00, 9.946117600855386E-01, -1.847899132826393E+00, 9.892235201710773E-01 }, /* 2897 Hz */
-    { 9.946099101367201E-01, -1.847799286130364E+00, 9.946099101367201E-01, -1.847799286130364E+00, 9.892198202734401E-01 }, /* 2898 Hz */
-    { 9.946080601947459E-01, -1.847699408144206E+00, 9.946080601947459E-01, -1.847699408144206E+00, 9.892161203894918E-01 }, /* 2899 Hz */
-    { 9.946062102596156E-01, -1.847599498869745E+00, 9.946062102596156E-01, -1.847599498869745E+00, 9.892124205192312E-01 }, /* 2900 Hz */
-    { 9.946043603313295E-01, -1.847499558308811E+00, 9.946043603313295E-01, -1.847499558308811E+00, 9.892087206626590E-01 }, /* 2901 Hz */
-    { 9.946025104098875E-01, -1.847399586463229E+00, 9.946025104098875E-01, -1.847399586463229E+00, 9.892050208197749E-01 }, /* 2902 Hz */
-    { 9.946006604952894E-01, -1.847299583334831E+00, 9.946006604952894E-01, -1.847299583334831E+00, 9.892013209905788E-01 }, /* 2903 Hz */
-    { 9.945988105875353E-01, -1.847199548925443E+00, 9.945988105875353E-01, -1.847199548925443E+00, 9.891976211750706E-01 }, /* 2904 Hz */
-    { 9.945969606866251E-01, -1.847099483236897E+00, 9.945969606866251E-01, -1.847099483236897E+00, 9.891939213732501E-01 }, /* 2905 Hz */
-    { 9.945951107925587E-01, -1.846999386271023E+00, 9.945951107925587E-01, -1.846999386271023E+00, 9.891902215851174E-01 }, /* 2906 Hz */
-    { 9.945932609053360E-01, -1.846899258029650E+00, 9.945932609053360E-01, -1.846899258029650E+00, 9.891865218106719E-01 }, /* 2907 Hz */
-    { 9.945914110249572E-01, -1.846799098514611E+00, 9.945914110249572E-01, -1.846799098514611E+00, 9.891828220499144E-01 }, /* 2908 Hz */
-    { 9.945895611514219E-01, -1.846698907727738E+00, 9.945895611514219E-01, -1.846698907727738E+00, 9.891791223028439E-01 }, /* 2909 Hz */
-    { 9.945877112847304E-01, -1.846598685670862E+00, 9.945877112847304E-01, -1.846598685670862E+00, 9.891754225694609E-01 }, /* 2910 Hz */
-    { 9.945858614248825E-01, -1.846498432345817E+00, 9.945858614248825E-01, -1.846498432345817E+00, 9.891717228497650E-01 }, /* 2911 Hz */
-    { 9.945840115718780E-01, -1.846398147754436E+00, 9.945840115718780E-01, -1.846398147754436E+00, 9.891680231437561E-01 }, /* 2912 Hz */
-    { 9.945821617257171E-01, -1.846297831898553E+00, 9.945821617257171E-01, -1.846297831898553E+00, 9.891643234514342E-01 }, /* 2913 Hz */
-    { 9.945803118863997E-01, -1.846197484780003E+00, 9.945803118863997E-01, -1.846197484780003E+00, 9.891606237727995E-01 }, /* 2914 Hz */
-    { 9.945784620539255E-01, -1.846097106400620E+00, 9.945784620539255E-01, -1.846097106400620E+00, 9.891569241078511E-01 }, /* 2915 Hz */
-    { 9.945766122282945E-01, -1.845996696762239E+00, 9.945766122282945E-01, -1.845996696762239E+00, 9.891532244565890E-01 }, /* 2916 Hz */
-    { 9.945747624095070E-01, -1.845896255866698E+00, 9.945747624095070E-01, -1.845896255866698E+00, 9.891495248190141E-01 }, /* 2917 Hz */
-    { 9.945729125975628E-01, -1.845795783715833E+00, 9.945729125975628E-01, -1.845795783715833E+00, 9.891458251951255E-01 }, /* 2918 Hz */
-    { 9.945710627924617E-01, -1.845695280311480E+00, 9.945710627924617E-01, -1.845695280311480E+00, 9.891421255849233E-01 }, /* 2919 Hz */
-    { 9.945692129942035E-01, -1.845594745655478E+00, 9.945692129942035E-01, -1.845594745655478E+00, 9.891384259884071E-01 }, /* 2920 Hz */
-    { 9.945673632027886E-01, -1.845494179749664E+00, 9.945673632027886E-01, -1.845494179749664E+00, 9.891347264055772E-01 }, /* 2921 Hz */
-    { 9.945655134182166E-01, -1.845393582595878E+00, 9.945655134182166E-01, -1.845393582595878E+00, 9.891310268364333E-01 }, /* 2922 Hz */
-    { 9.945636636404878E-01, -1.845292954195958E+00, 9.945636636404878E-01, -1.845292954195958E+00, 9.891273272809755E-01 }, /* 2923 Hz */
-    { 9.945618138696017E-01, -1.845192294551744E+00, 9.945618138696017E-01, -1.845192294551744E+00, 9.891236277392035E-01 }, /* 2924 Hz */
-    { 9.945599641055587E-01, -1.845091603665077E+00, 9.945599641055587E-01, -1.845091603665077E+00, 9.891199282111174E-01 }, /* 2925 Hz */
-    { 9.945581143483583E-01, -1.844990881537797E+00, 9.945581143483583E-01, -1.844990881537797E+00, 9.891162286967166E-01 }, /* 2926 Hz */
-    { 9.945562645980007E-01, -1.844890128171746E+00, 9.945562645980007E-01, -1.844890128171746E+00, 9.891125291960015E-01 }, /* 2927 Hz */
-    { 9.945544148544858E-01, -1.844789343568766E+00, 9.945544148544858E-01, -1.844789343568766E+00, 9.891088297089716E-01 }, /* 2928 Hz */
-    { 9.945525651178139E-01, -1.844688527730699E+00, 9.945525651178139E-01, -1.844688527730699E+00, 9.891051302356277E-01 }, /* 2929 Hz */
-    { 9.945507153879841E-01, -1.844587680659387E+00, 9.945507153879841E-01, -1.844587680659387E+00, 9.891014307759682E-01 }, /* 2930 Hz */
-    { 9.945488656649971E-01, -1.844486802356675E+00, 9.945488656649971E-01, -1.844486802356675E+00, 9.890977313299942E-01 }, /* 2931 Hz */
-    { 9.945470159488526E-01, -1.844385892824406E+00, 9.945470159488526E-01, -1.844385892824406E+00, 9.890940318977053E-01 }, /* 2932 Hz */
-    { 9.945451662395507E-01, -1.844284952064425E+00, 9.945451662395507E-01, -1.844284952064425E+00, 9.890903324791014E-01 }, /* 2933 Hz */
-    { 9.945433165370910E-01, -1.844183980078577E+00, 9.945433165370910E-01, -1.844183980078577E+00, 9.890866330741821E-01 }, /* 2934 Hz */
-    { 9.945414668414738E-01, -1.844082976868707E+00, 9.945414668414738E-01, -1.844082976868707E+00, 9.890829336829476E-01 }, /* 2935 Hz */
-    { 9.945396171526988E-01, -1.843981942436662E+00, 9.945396171526988E-01, -1.843981942436662E+00, 9.890792343053976E-01 }, /* 2936 Hz */
-    { 9.945377674707661E-01, -1.843880876784288E+00, 9.945377674707661E-01, -1.843880876784288E+00, 9.890755349415321E-01 }, /* 2937 Hz */
-    { 9.945359177956759E-01, -1.843779779913432E+00, 9.945359177956759E-01, -1.843779779913432E+00, 9.890718355913517E-01 }, /* 2938 Hz */
-    { 9.945340681274274E-01, -1.843678651825942E+00, 9.945340681274274E-01, -1.843678651825942E+00, 9.890681362548548E-01 }, /* 2939 Hz */
-    { 9.945322184660212E-01, -1.843577492523667E+00, 9.945322184660212E-01, -1.843577492523667E+00, 9.890644369320425E-01 }, /* 2940 Hz */
-    { 9.945303688114571E-01, -1.843476302008454E+00, 9.945303688114571E-01, -1.843476302008454E+00, 9.890607376229141E-01 }, /* 2941 Hz */
-    { 9.945285191637347E-01, -1.843375080282153E+00, 9.945285191637347E-01, -1.843375080282153E+00, 9.890570383274695E-01 }, /* 2942 Hz */
-    { 9.945266695228547E-01, -1.843273827346615E+00, 9.945266695228547E-01, -1.843273827346615E+00, 9.890533390457095E-01 }, /* 2943 Hz */
-    { 9.945248198888165E-01, -1.843172543203689E+00, 9.945248198888165E-01, -1.843172543203689E+00, 9.890496397776329E-01 }, /* 2944 Hz */
-    { 9.945229702616198E-01, -1.843071227855225E+00, 9.945229702616198E-01, -1.843071227855225E+00, 9.890459405232397E-01 }, /* 2945 Hz */
-    { 9.945211206412654E-01, -1.842969881303077E+00, 9.945211206412654E-01, -1.842969881303077E+00, 9.890422412825308E-01 }, /* 2946 Hz */
-    { 9.945192710277524E-01, -1.842868503549094E+00, 9.945192710277524E-01, -1.842868503549094E+00, 9.890385420555048E-01 }, /* 2947 Hz */
-    { 9.945174214210811E-01, -1.842767094595130E+00, 9.945174214210811E-01, -1.842767094595130E+00, 9.890348428421623E-01 }, /* 2948 Hz */
-    { 9.945155718212517E-01, -1.842665654443038E+00, 9.945155718212517E-01, -1.842665654443038E+00, 9.890311436425034E-01 }, /* 2949 Hz */
-    { 9.945137222282637E-01, -1.842564183094672E+00, 9.945137222282637E-01, -1.842564183094672E+00, 9.890274444565275E-01 }, /* 2950 Hz */
-    { 9.945118726421173E-01, -1.842462680551884E+00, 9.945118726421173E-01, -1.842462680551884E+00, 9.890237452842345E-01 }, /* 2951 Hz */
-    { 9.945100230628123E-01, -1.842361146816530E+00, 9.945100230628123E-01, -1.842361146816530E+00, 9.890200461256247E-01 }, /* 2952 Hz */
-    { 9.945081734903490E-01, -1.842259581890466E+00, 9.945081734903490E-01, -1.842259581890466E+00, 9.890163469806981E-01 }, /* 2953 Hz */
-    { 9.945063239247269E-01, -1.842157985775545E+00, 9.945063239247269E-01, -1.842157985775545E+00, 9.890126478494539E-01 }, /* 2954 Hz */
-    { 9.945044743659461E-01, -1.842056358473625E+00, 9.945044743659461E-01, -1.842056358473625E+00, 9.890089487318923E-01 }, /* 2955 Hz */
-    { 9.945026248140066E-01, -1.841954699986562E+00, 9.945026248140066E-01, -1.841954699986562E+00, 9.890052496280133E-01 }, /* 2956 Hz */
-    { 9.945007752689087E-01, -1.841853010316214E+00, 9.945007752689087E-01, -1.841853010316214E+00, 9.890015505378174E-01 }, /* 2957 Hz */
-    { 9.944989257306517E-01, -1.841751289464437E+00, 9.944989257306517E-01, -1.841751289464437E+00, 9.889978514613034E-01 }, /* 2958 Hz */
-    { 9.944970761992357E-01, -1.841649537433091E+00, 9.944970761992357E-01, -1.841649537433091E+00, 9.889941523984713E-01 }, /* 2959 Hz */
-    { 9.944952266746611E-01, -1.841547754224033E+00, 9.944952266746611E-01, -1.841547754224033E+00, 9.889904533493221E-01 }, /* 2960 Hz */
-    { 9.944933771569273E-01, -1.841445939839124E+00, 9.944933771569273E-01, -1.841445939839124E+00, 9.889867543138546E-01 }, /* 2961 Hz */
-    { 9.944915276460347E-01, -1.841344094280223E+00, 9.944915276460347E-01, -1.841344094280223E+00, 9.889830552920693E-01 }, /* 2962 Hz */
-    { 9.944896781419827E-01, -1.841242217549190E+00, 9.944896781419827E-01, -1.841242217549190E+00, 9.889793562839655E-01 }, /* 2963 Hz */
-    { 9.944878286447717E-01, -1.841140309647887E+00, 9.944878286447717E-01, -1.841140309647887E+00, 9.889756572895434E-01 }, /* 2964 Hz */
-    { 9.944859791544018E-01, -1.841038370578174E+00, 9.944859791544018E-01, -1.841038370578174E+00, 9.889719583088037E-01 }, /* 2965 Hz */
-    { 9.944841296708724E-01, -1.840936400341914E+00, 9.944841296708724E-01, -1.840936400341914E+00, 9.889682593417448E-01 }, /* 2966 Hz */
-    { 9.944822801941838E-01, -1.840834398940968E+00, 9.944822801941838E-01, -1.840834398940968E+00, 9.889645603883677E-01 }, /* 2967 Hz */
-    { 9.944804307243360E-01, -1.840732366377201E+00, 9.944804307243360E-01, -1.840732366377201E+00, 9.889608614486720E-01 }, /* 2968 Hz */
-    { 9.944785812613287E-01, -1.840630302652475E+00, 9.944785812613287E-01, -1.840630302652475E+00, 9.889571625226574E-01 }, /* 2969 Hz */
-    { 9.944767318051619E-01, -1.840528207768654E+00, 9.944767318051619E-01, -1.840528207768654E+00, 9.889534636103239E-01 }, /* 2970 Hz */
-    { 9.944748823558359E-01, -1.840426081727603E+00, 9.944748823558359E-01, -1.840426081727603E+00, 9.889497647116718E-01 }, /* 2971 Hz */
-    { 9.944730329133502E-01, -1.840323924531188E+00, 9.944730329133502E-01, -1.840323924531188E+00, 9.889460658267004E-01 }, /* 2972 Hz */
-    { 9.944711834777049E-01, -1.840221736181272E+00, 9.944711834777049E-01, -1.840221736181272E+00, 9.889423669554098E-01 }, /* 2973 Hz */
-    { 9.944693340489001E-01, -1.840119516679724E+00, 9.944693340489001E-01, -1.840119516679724E+00, 9.889386680978003E-01 }, /* 2974 Hz */
-    { 9.944674846269357E-01, -1.840017266028410E+00, 9.944674846269357E-01, -1.840017266028410E+00, 9.889349692538714E-01 }, /* 2975 Hz */
-    { 9.944656352118112E-01, -1.839914984229195E+00, 9.944656352118112E-01, -1.839914984229195E+00, 9.889312704236224E-01 }, /* 2976 Hz */
-    { 9.944637858035272E-01, -1.839812671283949E+00, 9.944637858035272E-01, -1.839812671283949E+00, 9.889275716070545E-01 }, /* 2977 Hz */
-    { 9.944619364020834E-01, -1.839710327194539E+00, 9.944619364020834E-01, -1.839710327194539E+00, 9.889238728041667E-01 }, /* 2978 Hz */
-    { 9.944600870074797E-01, -1.839607951962835E+00, 9.944600870074797E-01, -1.839607951962835E+00, 9.889201740149594E-01 }, /* 2979 Hz */
-    { 9.944582376197160E-01, -1.839505545590705E+00, 9.944582376197160E-01, -1.839505545590705E+00, 9.889164752394319E-01 }, /* 2980 Hz */
-    { 9.944563882387923E-01, -1.839403108080019E+00, 9.944563882387923E-01, -1.839403108080019E+00, 9.889127764775847E-01 }, /* 2981 Hz */
-    { 9.944545388647086E-01, -1.839300639432649E+00, 9.944545388647086E-01, -1.839300639432649E+00, 9.889090777294172E-01 }, /* 2982 Hz */
-    { 9.944526894974648E-01, -1.839198139650463E+00, 9.944526894974648E-01, -1.839198139650463E+00, 9.889053789949296E-01 }, /* 2983 Hz */
-    { 9.944508401370609E-01, -1.839095608735335E+00, 9.944508401370609E-01, -1.839095608735335E+00, 9.889016802741217E-01 }, /* 2984 Hz */
-    { 9.944489907834968E-01, -1.838993046689135E+00, 9.944489907834968E-01, -1.838993046689135E+00, 9.888979815669936E-01 }, /* 2985 Hz */
-    { 9.944471414367724E-01, -1.838890453513736E+00, 9.944471414367724E-01, -1.838890453513736E+00, 9.888942828735447E-01 }, /* 2986 Hz */
-    { 9.944452920968879E-01, -1.838787829211012E+00, 9.944452920968879E-01, -1.838787829211012E+00, 9.888905841937758E-01 }, /* 2987 Hz */
-    { 9.944434427638429E-01, -1.838685173782836E+00, 9.944434427638429E-01, -1.838685173782836E+00, 9.888868855276858E-01 }, /* 2988 Hz */
-    { 9.944415934376375E-01, -1.838582487231081E+00, 9.944415934376375E-01, -1.838582487231081E+00, 9.888831868752750E-01 }, /* 2989 Hz */
-    { 9.944397441182719E-01, -1.838479769557622E+00, 9.944397441182719E-01, -1.838479769557622E+00, 9.888794882365437E-01 }, /* 2990 Hz */
-    { 9.944378948057456E-01, -1.838377020764335E+00, 9.944378948057456E-01, -1.838377020764335E+00, 9.888757896114913E-01 }, /* 2991 Hz */
-    { 9.944360455000588E-01, -1.838274240853095E+00, 9.944360455000588E-01, -1.838274240853095E+00, 9.888720910001176E-01 }, /* 2992 Hz */
-    { 9.944341962012114E-01, -1.838171429825777E+00, 9.944341962012114E-01, -1.838171429825777E+00, 9.888683924024229E-01 }, /* 2993 Hz */
-    { 9.944323469092033E-01, -1.838068587684260E+00, 9.944323469092033E-01, -1.838068587684260E+00, 9.888646938184067E-01 }, /* 2994 Hz */
-    { 9.944304976240348E-01, -1.837965714430419E+00, 9.944304976240348E-01, -1.837965714430419E+00, 9.888609952480696E-01 }, /* 2995 Hz */
-    { 9.944286483457051E-01, -1.837862810066133E+00, 9.944286483457051E-01, -1.837862810066133E+00, 9.888572966914102E-01 }, /* 2996 Hz */
-    { 9.944267990742151E-01, -1.837759874593279E+00, 9.944267990742151E-01, -1.837759874593279E+00, 9.888535981484301E-01 }, /* 2997 Hz */
-    { 9.944249498095638E-01, -1.837656908013737E+00, 9.944249498095638E-01, -1.837656908013737E+00, 9.888498996191275E-01 }, /* 2998 Hz */
-    { 9.944231005517518E-01, -1.837553910329385E+00, 9.944231005517518E-01, -1.837553910329385E+00, 9.888462011035035E-01 }, /* 2999 Hz */
-    { 9.944212513007790E-01, -1.837450881542105E+00, 9.944212513007790E-01, -1.837450881542105E+00, 9.888425026015579E-01 }, /* 3000 Hz */
-    { 9.944194020566450E-01, -1.837347821653775E+00, 9.944194020566450E-01, -1.837347821653775E+00, 9.888388041132901E-01 }, /* 3001 Hz */
-    { 9.944175528193501E-01, -1.837244730666277E+00, 9.944175528193501E-01, -1.837244730666277E+00, 9.888351056387001E-01 }, /* 3002 Hz */
-    { 9.944157035888939E-01, -1.837141608581492E+00, 9.944157035888939E-01, -1.837141608581492E+00, 9.888314071777877E-01 }, /* 3003 Hz */
-    { 9.944138543652765E-01, -1.837038455401301E+00, 9.944138543652765E-01, -1.837038455401301E+00, 9.888277087305530E-01 }, /* 3004 Hz */
-    { 9.944120051484983E-01, -1.836935271127589E+00, 9.944120051484983E-01, -1.836935271127589E+00, 9.888240102969965E-01 }, /* 3005 Hz */
-    { 9.944101559385585E-01, -1.836832055762237E+00, 9.944101559385585E-01, -1.836832055762237E+00, 9.888203118771171E-01 }, /* 3006 Hz */
-    { 9.944083067354577E-01, -1.836728809307128E+00, 9.944083067354577E-01, -1.836728809307128E+00, 9.888166134709153E-01 }, /* 3007 Hz */
-    { 9.944064575391952E-01, -1.836625531764148E+00, 9.944064575391952E-01, -1.836625531764148E+00, 9.888129150783904E-01 }, /* 3008 Hz */
-    { 9.944046083497715E-01, -1.836522223135180E+00, 9.944046083497715E-01, -1.836522223135180E+00, 9.888092166995430E-01 }, /* 3009 Hz */
-    { 9.944027591671863E-01, -1.836418883422109E+00, 9.944027591671863E-01, -1.836418883422109E+00, 9.888055183343727E-01 }, /* 3010 Hz */
-    { 9.944009099914395E-01, -1.836315512626821E+00, 9.944009099914395E-01, -1.836315512626821E+00, 9.888018199828790E-01 }, /* 3011 Hz */
-    { 9.943990608225312E-01, -1.836212110751202E+00, 9.943990608225312E-01, -1.836212110751202E+00, 9.887981216450623E-01 }, /* 3012 Hz */
-    { 9.943972116604614E-01, -1.836108677797139E+00, 9.943972116604614E-01, -1.836108677797139E+00, 9.887944233209227E-01 }, /* 3013 Hz */
-    { 9.943953625052298E-01, -1.836005213766519E+00, 9.943953625052298E-01, -1.836005213766519E+00, 9.887907250104595E-01 }, /* 3014 Hz */
-    { 9.943935133568366E-01, -1.835901718661229E+00, 9.943935133568366E-01, -1.835901718661229E+00, 9.887870267136731E-01 }, /* 3015 Hz */
-    { 9.943916642152816E-01, -1.835798192483159E+00, 9.943916642152816E-01, -1.835798192483159E+00, 9.887833284305632E-01 }, /* 3016 Hz */
-    { 9.943898150805648E-01, -1.835694635234195E+00, 9.943898150805648E-01, -1.835694635234195E+00, 9.887796301611296E-01 }, /* 3017 Hz */
-    { 9.943879659526860E-01, -1.835591046916228E+00, 9.943879659526860E-01, -1.835591046916228E+00, 9.887759319053719E-01 }, /* 3018 Hz */
-    { 9.943861168316454E-01, -1.835487427531148E+00, 9.943861168316454E-01, -1.835487427531148E+00, 9.887722336632907E-01 }, /* 3019 Hz */
-    { 9.943842677174429E-01, -1.835383777080845E+00, 9.943842677174429E-01, -1.835383777080845E+00, 9.887685354348859E-01 }, /* 3020 Hz */
-    { 9.943824186100784E-01, -1.835280095567210E+00, 9.943824186100784E-01, -1.835280095567210E+00, 9.887648372201567E-01 }, /* 3021 Hz */
-    { 9.943805695095516E-01, -1.835176382992132E+00, 9.943805695095516E-01, -1.835176382992132E+00, 9.887611390191031E-01 }, /* 3022 Hz */
-    { 9.943787204158629E-01, -1.835072639357507E+00, 9.943787204158629E-01, -1.835072639357507E+00, 9.887574408317259E-01 }, /* 3023 Hz */
-    { 9.943768713290120E-01, -1.834968864665224E+00, 9.943768713290120E-01, -1.834968864665224E+00, 9.887537426580240E-01 }, /* 3024 Hz */
-    { 9.943750222489988E-01, -1.834865058917178E+00, 9.943750222489988E-01, -1.834865058917178E+00, 9.887500444979975E-01 }, /* 3025 Hz */
-    { 9.943731731758234E-01, -1.834761222115261E+00, 9.943731731758234E-01, -1.834761222115261E+00, 9.887463463516468E-01 }, /* 3026 Hz */
-    { 9.943713241094857E-01, -1.834657354261368E+00, 9.943713241094857E-01, -1.834657354261368E+00, 9.887426482189714E-01 }, /* 3027 Hz */
-    { 9.943694750499857E-01, -1.834553455357393E+00, 9.943694750499857E-01, -1.834553455357393E+00, 9.887389500999715E-01 }, /* 3028 Hz */
-    { 9.943676259973232E-01, -1.834449525405231E+00, 9.943676259973232E-01, -1.834449525405231E+00, 9.887352519946464E-01 }, /* 3029 Hz */
-    { 9.943657769514981E-01, -1.834345564406778E+00, 9.943657769514981E-01, -1.834345564406778E+00, 9.887315539029962E-01 }, /* 3030 Hz */
-    { 9.943639279125107E-01, -1.834241572363929E+00, 9.943639279125107E-01, -1.834241572363929E+00, 9.887278558250214E-01 }, /* 3031 Hz */
-    { 9.943620788803604E-01, -1.834137549278582E+00, 9.943620788803604E-01, -1.834137549278582E+00, 9.887241577607209E-01 }, /* 3032 Hz */
-    { 9.943602298550477E-01, -1.834033495152633E+00, 9.943602298550477E-01, -1.834033495152633E+00, 9.887204597100954E-01 }, /* 3033 Hz */
-    { 9.943583808365725E-01, -1.833929409987981E+00, 9.943583808365725E-01, -1.833929409987981E+00, 9.887167616731449E-01 }, /* 3034 Hz */
-    { 9.943565318249343E-01, -1.833825293786522E+00, 9.943565318249343E-01, -1.833825293786522E+00, 9.887130636498687E-01 }, /* 3035 Hz */
-    { 9.943546828201334E-01, -1.833721146550157E+00, 9.943546828201334E-01, -1.833721146550157E+00, 9.887093656402668E-01 }, /* 3036 Hz */
-    { 9.943528338221697E-01, -1.833616968280784E+00, 9.943528338221697E-01, -1.833616968280784E+00, 9.887056676443393E-01 }, /* 3037 Hz */
-    { 9.943509848310430E-01, -1.833512758980302E+00, 9.943509848310430E-01, -1.833512758980302E+00, 9.887019696620860E-01 }, /* 3038 Hz */
-    { 9.943491358467534E-01, -1.833408518650613E+00, 9.943491358467534E-01, -1.833408518650613E+00, 9.886982716935069E-01 }, /* 3039 Hz */
-    { 9.943472868693011E-01, -1.833304247293617E+00, 9.943472868693011E-01, -1.833304247293617E+00, 9.886945737386021E-01 }, /* 3040 Hz */
-    { 9.943454378986855E-01, -1.833199944911216E+00, 9.943454378986855E-01, -1.833199944911216E+00, 9.886908757973709E-01 }, /* 3041 Hz */
-    { 9.943435889349067E-01, -1.833095611505310E+00, 9.943435889349067E-01, -1.833095611505310E+00, 9.886871778698134E-01 }, /* 3042 Hz */
-    { 9.943417399779650E-01, -1.832991247077803E+00, 9.943417399779650E-01, -1.832991247077803E+00, 9.886834799559301E-01 }, /* 3043 Hz */
-    { 9.943398910278601E-01, -1.832886851630597E+00, 9.943398910278601E-01, -1.832886851630597E+00, 9.886797820557203E-01 }, /* 3044 Hz */
-    { 9.943380420845919E-01, -1.832782425165596E+00, 9.943380420845919E-01, -1.832782425165596E+00, 9.886760841691837E-01 }, /* 3045 Hz */
-    { 9.943361931481604E-01, -1.832677967684704E+00, 9.943361931481604E-01, -1.832677967684704E+00, 9.886723862963207E-01 }, /* 3046 Hz */
-    { 9.943343442185656E-01, -1.832573479189825E+00, 9.943343442185656E-01, -1.832573479189825E+00, 9.886686884371312E-01 }, /* 3047 Hz */
-    { 9.943324952958074E-01, -1.832468959682864E+00, 9.943324952958074E-01, -1.832468959682864E+00, 9.886649905916147E-01 }, /* 3048 Hz */
-    { 9.943306463798858E-01, -1.832364409165727E+00, 9.943306463798858E-01, -1.832364409165727E+00, 9.886612927597715E-01 }, /* 3049 Hz */
-    { 9.943287974708007E-01, -1.832259827640320E+00, 9.943287974708007E-01, -1.832259827640320E+00, 9.886575949416014E-01 }, /* 3050 Hz */
-    { 9.943269485685519E-01, -1.832155215108549E+00, 9.943269485685519E-01, -1.832155215108549E+00, 9.886538971371037E-01 }, /* 3051 Hz */
-    { 9.943250996731398E-01, -1.832050571572321E+00, 9.943250996731398E-01, -1.832050571572321E+00, 9.886501993462795E-01 }, /* 3052 Hz */
-    { 9.943232507845639E-01, -1.831945897033544E+00, 9.943232507845639E-01, -1.831945897033544E+00, 9.886465015691277E-01 }, /* 3053 Hz */
-    { 9.943214019028243E-01, -1.831841191494127E+00, 9.943214019028243E-01, -1.831841191494127E+00, 9.886428038056485E-01 }, /* 3054 Hz */
-    { 9.943195530279209E-01, -1.831736454955977E+00, 9.943195530279209E-01, -1.831736454955977E+00, 9.886391060558417E-01 }, /* 3055 Hz */
-    { 9.943177041598539E-01, -1.831631687421004E+00, 9.943177041598539E-01, -1.831631687421004E+00, 9.886354083197078E-01 }, /* 3056 Hz */
-    { 9.943158552986229E-01, -1.831526888891118E+00, 9.943158552986229E-01, -1.831526888891118E+00, 9.886317105972457E-01 }, /* 3057 Hz */
-    { 9.943140064442280E-01, -1.831422059368228E+00, 9.943140064442280E-01, -1.831422059368228E+00, 9.886280128884559E-01 }, /* 3058 Hz */
-    { 9.943121575966691E-01, -1.831317198854246E+00, 9.943121575966691E-01, -1.831317198854246E+00, 9.886243151933383E-01 }, /* 3059 Hz */
-    { 9.943103087559463E-01, -1.831212307351083E+00, 9.943103087559463E-01, -1.831212307351083E+00, 9.886206175118926E-01 }, /* 3060 Hz */
-    { 9.943084599220595E-01, -1.831107384860650E+00, 9.943084599220595E-01, -1.831107384860650E+00, 9.886169198441190E-01 }, /* 3061 Hz */
-    { 9.943066110950084E-01, -1.831002431384861E+00, 9.943066110950084E-01, -1.831002431384861E+00, 9.886132221900168E-01 }, /* 3062 Hz */
-    { 9.943047622747934E-01, -1.830897446925627E+00, 9.943047622747934E-01, -1.830897446925627E+00, 9.886095245495867E-01 }, /* 3063 Hz */
-    { 9.943029134614141E-01, -1.830792431484862E+00, 9.943029134614141E-01, -1.830792431484862E+00, 9.886058269228282E-01 }, /* 3064 Hz */
-    { 9.943010646548706E-01, -1.830687385064481E+00, 9.943010646548706E-01, -1.830687385064481E+00, 9.886021293097411E-01 }, /* 3065 Hz */
-    { 9.942992158551625E-01, -1.830582307666397E+00, 9.942992158551625E-01, -1.830582307666397E+00, 9.885984317103249E-01 }, /* 3066 Hz */
-    { 9.942973670622903E-01, -1.830477199292525E+00, 9.942973670622903E-01, -1.830477199292525E+00, 9.885947341245807E-01 }, /* 3067 Hz */
-    { 9.942955182762538E-01, -1.830372059944781E+00, 9.942955182762538E-01, -1.830372059944781E+00, 9.885910365525077E-01 }, /* 3068 Hz */
-    { 9.942936694970526E-01, -1.830266889625081E+00, 9.942936694970526E-01, -1.830266889625081E+00, 9.885873389941051E-01 }, /* 3069 Hz */
-    { 9.942918207246870E-01, -1.830161688335341E+00, 9.942918207246870E-01, -1.830161688335341E+00, 9.885836414493741E-01 }, /* 3070 Hz */
-    { 9.942899719591568E-01, -1.830056456077478E+00, 9.942899719591568E-01, -1.830056456077478E+00, 9.885799439183136E-01 }, /* 3071 Hz */
-    { 9.942881232004621E-01, -1.829951192853411E+00, 9.942881232004621E-01, -1.829951192853411E+00, 9.885762464009242E-01 }, /* 3072 Hz */
-    { 9.942862744486026E-01, -1.829845898665056E+00, 9.942862744486026E-01, -1.829845898665056E+00, 9.885725488972052E-01 }, /* 3073 Hz */
-    { 9.942844257035784E-01, -1.829740573514333E+00, 9.942844257035784E-01, -1.829740573514333E+00, 9.885688514071569E-01 }, /* 3074 Hz */
-    { 9.942825769653898E-01, -1.829635217403160E+00, 9.942825769653898E-01, -1.829635217403160E+00, 9.885651539307796E-01 }, /* 3075 Hz */
-    { 9.942807282340360E-01, -1.829529830333458E+00, 9.942807282340360E-01, -1.829529830333458E+00, 9.885614564680720E-01 }, /* 3076 Hz */
-    { 9.942788795095173E-01, -1.829424412307146E+00, 9.942788795095173E-01, -1.829424412307146E+00, 9.885577590190346E-01 }, /* 3077 Hz */
-    { 9.942770307918339E-01, -1.829318963326146E+00, 9.942770307918339E-01, -1.829318963326146E+00, 9.885540615836679E-01 }, /* 3078 Hz */
-    { 9.942751820809854E-01, -1.829213483392377E+00, 9.942751820809854E-01, -1.829213483392377E+00, 9.885503641619708E-01 }, /* 3079 Hz */
-    { 9.942733333769720E-01, -1.829107972507763E+00, 9.942733333769720E-01, -1.829107972507763E+00, 9.885466667539440E-01 }, /* 3080 Hz */
-    { 9.942714846797935E-01, -1.829002430674225E+00, 9.942714846797935E-01, -1.829002430674225E+00, 9.885429693595871E-01 }, /* 3081 Hz */
-    { 9.942696359894500E-01, -1.828896857893687E+00, 9.942696359894500E-01, -1.828896857893687E+00, 9.885392719788999E-01 }, /* 3082 Hz */
-    { 9.942677873059410E-01, -1.828791254168070E+00, 9.942677873059410E-01, -1.828791254168070E+00, 9.885355746118820E-01 }, /* 3083 Hz */
-    { 9.942659386292670E-01, -1.828685619499300E+00, 9.942659386292670E-01, -1.828685619499300E+00, 9.885318772585341E-01 }, /* 3084 Hz */
-    { 9.942640899594277E-01, -1.828579953889301E+00, 9.942640899594277E-01, -1.828579953889301E+00, 9.885281799188554E-01 }, /* 3085 Hz */
-    { 9.942622412964232E-01, -1.828474257339997E+00, 9.942622412964232E-01, -1.828474257339997E+00, 9.885244825928463E-01 }, /* 3086 Hz */
-    { 9.942603926402530E-01, -1.828368529853313E+00, 9.942603926402530E-01, -1.828368529853313E+00, 9.885207852805060E-01 }, /* 3087 Hz */
-    { 9.942585439909176E-01, -1.828262771431177E+00, 9.942585439909176E-01, -1.828262771431177E+00, 9.885170879818352E-01 }, /* 3088 Hz */
-    { 9.942566953484168E-01, -1.828156982075513E+00, 9.942566953484168E-01, -1.828156982075513E+00, 9.885133906968335E-01 }, /* 3089 Hz */
-    { 9.942548467127503E-01, -1.828051161788250E+00, 9.942548467127503E-01, -1.828051161788250E+00, 9.885096934255007E-01 }, /* 3090 Hz */
-    { 9.942529980839184E-01, -1.827945310571315E+00, 9.942529980839184E-01, -1.827945310571315E+00, 9.885059961678369E-01 }, /* 3091 Hz */
-    { 9.942511494619208E-01, -1.827839428426634E+00, 9.942511494619208E-01, -1.827839428426634E+00, 9.885022989238417E-01 }, /* 3092 Hz */
-    { 9.942493008467576E-01, -1.827733515356139E+00, 9.942493008467576E-01, -1.827733515356139E+00, 9.884986016935151E-01 }, /* 3093 Hz */
-    { 9.942474522384286E-01, -1.827627571361756E+00, 9.942474522384286E-01, -1.827627571361756E+00, 9.884949044768572E-01 }, /* 3094 Hz */
-    { 9.942456036369337E-01, -1.827521596445416E+00, 9.942456036369337E-01, -1.827521596445416E+00, 9.884912072738674E-01 }, /* 3095 Hz */
-    { 9.942437550422731E-01, -1.827415590609049E+00, 9.942437550422731E-01, -1.827415590609049E+00, 9.884875100845463E-01 }, /* 3096 Hz */
-    { 9.942419064544467E-01, -1.827309553854585E+00, 9.942419064544467E-01, -1.827309553854585E+00, 9.884838129088933E-01 }, /* 3097 Hz */
-    { 9.942400578734544E-01, -1.827203486183957E+00, 9.942400578734544E-01, -1.827203486183957E+00, 9.884801157469087E-01 }, /* 3098 Hz */
-    { 9.942382092992958E-01, -1.827097387599094E+00, 9.942382092992958E-01, -1.827097387599094E+00, 9.884764185985917E-01 }, /* 3099 Hz */
-    { 9.942363607319715E-01, -1.826991258101929E+00, 9.942363607319715E-01, -1.826991258101929E+00, 9.884727214639430E-01 }, /* 3100 Hz */
-    { 9.942345121714811E-01, -1.826885097694396E+00, 9.942345121714811E-01, -1.826885097694396E+00, 9.884690243429621E-01 }, /* 3101 Hz */
-    { 9.942326636178244E-01, -1.826778906378427E+00, 9.942326636178244E-01, -1.826778906378427E+00, 9.884653272356487E-01 }, /* 3102 Hz */
-    { 9.942308150710015E-01, -1.826672684155956E+00, 9.942308150710015E-01, -1.826672684155956E+00, 9.884616301420031E-01 }, /* 3103 Hz */
-    { 9.942289665310126E-01, -1.826566431028918E+00, 9.942289665310126E-01, -1.826566431028918E+00, 9.884579330620251E-01 }, /* 3104 Hz */
-    { 9.942271179978570E-01, -1.826460146999247E+00, 9.942271179978570E-01, -1.826460146999247E+00, 9.884542359957140E-01 }, /* 3105 Hz */
-    { 9.942252694715353E-01, -1.826353832068878E+00, 9.942252694715353E-01, -1.826353832068878E+00, 9.884505389430707E-01 }, /* 3106 Hz */
-    { 9.942234209520473E-01, -1.826247486239748E+00, 9.942234209520473E-01, -1.826247486239748E+00, 9.884468419040946E-01 }, /* 3107 Hz */
-    { 9.942215724393928E-01, -1.826141109513792E+00, 9.942215724393928E-01, -1.826141109513792E+00, 9.884431448787856E-01 }, /* 3108 Hz */
-    { 9.942197239335718E-01, -1.826034701892947E+00, 9.942197239335718E-01, -1.826034701892947E+00, 9.884394478671437E-01 }, /* 3109 Hz */
-    { 9.942178754345844E-01, -1.825928263379152E+00, 9.942178754345844E-01, -1.825928263379152E+00, 9.884357508691688E-01 }, /* 3110 Hz */
-    { 9.942160269424301E-01, -1.825821793974343E+00, 9.942160269424301E-01, -1.825821793974343E+00, 9.884320538848601E-01 }, /* 3111 Hz */
-    { 9.942141784571092E-01, -1.825715293680460E+00, 9.942141784571092E-01, -1.825715293680460E+00, 9.884283569142185E-01 }, /* 3112 Hz */
-    { 9.942123299786219E-01, -1.825608762499441E+00, 9.942123299786219E-01, -1.825608762499441E+00, 9.884246599572437E-01 }, /* 3113 Hz */
-    { 9.942104815069677E-01, -1.825502200433226E+00, 9.942104815069677E-01, -1.825502200433226E+00, 9.884209630139353E-01 }, /* 3114 Hz */
-    { 9.942086330421467E-01, -1.825395607483755E+00, 9.942086330421467E-01, -1.825395607483755E+00, 9.884172660842934E-01 }, /* 3115 Hz */
-    { 9.942067845841589E-01, -1.825288983652967E+00, 9.942067845841589E-01, -1.825288983652967E+00, 9.884135691683178E-01 }, /* 3116 Hz */
-    { 9.942049361330041E-01, -1.825182328942805E+00, 9.942049361330041E-01, -1.825182328942805E+00, 9.884098722660082E-01 }, /* 3117 Hz */
-    { 9.942030876886825E-01, -1.825075643355210E+00, 9.942030876886825E-01, -1.825075643355210E+00, 9.884061753773650E-01 }, /* 3118 Hz */
-    { 9.942012392511939E-01, -1.824968926892125E+00, 9.942012392511939E-01, -1.824968926892125E+00, 9.884024785023877E-01 }, /* 3119 Hz */
-    { 9.941993908205381E-01, -1.824862179555490E+00, 9.941993908205381E-01, -1.824862179555490E+00, 9.883987816410762E-01 }, /* 3120 Hz */
-    { 9.941975423967151E-01, -1.824755401347250E+00, 9.941975423967151E-01, -1.824755401347250E+00, 9.883950847934302E-01 }, /* 3121 Hz */
-    { 9.941956939797252E-01, -1.824648592269349E+00, 9.941956939797252E-01, -1.824648592269349E+00, 9.883913879594504E-01 }, /* 3122 Hz */
-    { 9.941938455695681E-01, -1.824541752323731E+00, 9.941938455695681E-01, -1.824541752323731E+00, 9.883876911391363E-01 }, /* 3123 Hz */
-    { 9.941919971662435E-01, -1.824434881512339E+00, 9.941919971662435E-01, -1.824434881512339E+00, 9.883839943324870E-01 }, /* 3124 Hz */
-    { 9.941901487697519E-01, -1.824327979837120E+00, 9.941901487697519E-01, -1.824327979837120E+00, 9.883802975395037E-01 }, /* 3125 Hz */
-    { 9.941883003800929E-01, -1.824221047300019E+00, 9.941883003800929E-01, -1.824221047300019E+00, 9.883766007601857E-01 }, /* 3126 Hz */
-    { 9.941864519972662E-01, -1.824114083902983E+00, 9.941864519972662E-01, -1.824114083902983E+00, 9.883729039945324E-01 }, /* 3127 Hz */
-    { 9.941846036212724E-01, -1.824007089647958E+00, 9.941846036212724E-01, -1.824007089647958E+00, 9.883692072425447E-01 }, /* 3128 Hz */
-    { 9.941827552521110E-01, -1.823900064536892E+00, 9.941827552521110E-01, -1.823900064536892E+00, 9.883655105042219E-01 }, /* 3129 Hz */
-    { 9.941809068897820E-01, -1.823793008571732E+00, 9.941809068897820E-01, -1.823793008571732E+00, 9.883618137795640E-01 }, /* 3130 Hz */
-    { 9.941790585342852E-01, -1.823685921754427E+00, 9.941790585342852E-01, -1.823685921754427E+00, 9.883581170685705E-01 }, /* 3131 Hz */
-    { 9.941772101856210E-01, -1.823578804086925E+00, 9.941772101856210E-01, -1.823578804086925E+00, 9.883544203712420E-01 }, /* 3132 Hz */
-    { 9.941753618437891E-01, -1.823471655571177E+00, 9.941753618437891E-01, -1.823471655571177E+00, 9.883507236875781E-01 }, /* 3133 Hz */
-    { 9.941735135087894E-01, -1.823364476209131E+00, 9.941735135087894E-01, -1.823364476209131E+00, 9.883470270175787E-01 }, /* 3134 Hz */
-    { 9.941716651806217E-01, -1.823257266002739E+00, 9.941716651806217E-01, -1.823257266002739E+00, 9.883433303612434E-01 }, /* 3135 Hz */
-    { 9.941698168592864E-01, -1.823150024953951E+00, 9.941698168592864E-01, -1.823150024953951E+00, 9.883396337185728E-01 }, /* 3136 Hz */
-    { 9.941679685447831E-01, -1.823042753064719E+00, 9.941679685447831E-01, -1.823042753064719E+00, 9.883359370895661E-01 }, /* 3137 Hz */
-    { 9.941661202371117E-01, -1.822935450336995E+00, 9.941661202371117E-01, -1.822935450336995E+00, 9.883322404742234E-01 }, /* 3138 Hz */
-    { 9.941642719362723E-01, -1.822828116772731E+00, 9.941642719362723E-01, -1.822828116772731E+00, 9.883285438725447E-01 }, /* 3139 Hz */
-    { 9.941624236422650E-01, -1.822720752373880E+00, 9.941624236422650E-01, -1.822720752373880E+00, 9.883248472845301E-01 }, /* 3140 Hz */
-    { 9.941605753550897E-01, -1.822613357142397E+00, 9.941605753550897E-01, -1.822613357142397E+00, 9.883211507101795E-01 }, /* 3141 Hz */
-    { 9.941587270747460E-01, -1.822505931080234E+00, 9.941587270747460E-01, -1.822505931080234E+00, 9.883174541494919E-01 }, /* 3142 Hz */
-    { 9.941568788012342E-01, -1.822398474189346E+00, 9.941568788012342E-01, -1.822398474189346E+00, 9.883137576024683E-01 }, /* 3143 Hz */
-    { 9.941550305345540E-01, -1.822290986471690E+00, 9.941550305345540E-01, -1.822290986471690E+00, 9.883100610691080E-01 }, /* 3144 Hz */
-    { 9.941531822747055E-01, -1.822183467929219E+00, 9.941531822747055E-01, -1.822183467929219E+00, 9.883063645494110E-01 }, /* 3145 Hz */
-    { 9.941513340216888E-01, -1.822075918563892E+00, 9.941513340216888E-01, -1.822075918563892E+00, 9.883026680433775E-01 }, /* 3146 Hz */
-    { 9.941494857755035E-01, -1.821968338377663E+00, 9.941494857755035E-01, -1.821968338377663E+00, 9.882989715510071E-01 }, /* 3147 Hz */
-    { 9.941476375361498E-01, -1.821860727372490E+00, 9.941476375361498E-01, -1.821860727372490E+00, 9.882952750722995E-01 }, /* 3148 Hz */
-    { 9.941457893036276E-01, -1.821753085550333E+00, 9.941457893036276E-01, -1.821753085550333E+00, 9.882915786072552E-01 }, /* 3149 Hz */
-    { 9.941439410779368E-01, -1.821645412913147E+00, 9.941439410779368E-01, -1.821645412913147E+00, 9.882878821558736E-01 }, /* 3150 Hz */
-    { 9.941420928590774E-01, -1.821537709462892E+00, 9.941420928590774E-01, -1.821537709462892E+00, 9.882841857181548E-01 }, /* 3151 Hz */
-    { 9.941402446470493E-01, -1.821429975201527E+00, 9.941402446470493E-01, -1.821429975201527E+00, 9.882804892940986E-01 }, /* 3152 Hz */
-    { 9.941383964418525E-01, -1.821322210131013E+00, 9.941383964418525E-01, -1.821322210131013E+00, 9.882767928837051E-01 }, /* 3153 Hz */
-    { 9.941365482434867E-01, -1.821214414253309E+00, 9.941365482434867E-01, -1.821214414253309E+00, 9.882730964869735E-01 }, /* 3154 Hz */
-    { 9.941347000519526E-01, -1.821106587570377E+00, 9.941347000519526E-01, -1.821106587570377E+00, 9.882694001039052E-01 }, /* 3155 Hz */
-    { 9.941328518672492E-01, -1.820998730084177E+00, 9.941328518672492E-01, -1.820998730084177E+00, 9.882657037344984E-01 }, /* 3156 Hz */
-    { 9.941310036893769E-01, -1.820890841796671E+00, 9.941310036893769E-01, -1.820890841796671E+00, 9.882620073787538E-01 }, /* 3157 Hz */
-    { 9.941291555183357E-01, -1.820782922709823E+00, 9.941291555183357E-01, -1.820782922709823E+00, 9.882583110366714E-01 }, /* 3158 Hz */
-    { 9.941273073541256E-01, -1.820674972825594E+00, 9.941273073541256E-01, -1.820674972825594E+00, 9.882546147082512E-01 }, /* 3159 Hz */
-    { 9.941254591967462E-01, -1.820566992145949E+00, 9.941254591967462E-01, -1.820566992145949E+00, 9.882509183934924E-01 }, /* 3160 Hz */
-    { 9.941236110461977E-01, -1.820458980672851E+00, 9.941236110461977E-01, -1.820458980672851E+00, 9.882472220923955E-01 }, /* 3161 Hz */
-    { 9.941217629024801E-01, -1.820350938408265E+00, 9.941217629024801E-01, -1.820350938408265E+00, 9.882435258049602E-01 }, /* 3162 Hz */
-    { 9.941199147655934E-01, -1.820242865354156E+00, 9.941199147655934E-01, -1.820242865354156E+00, 9.882398295311867E-01 }, /* 3163 Hz */
-    { 9.941180666355371E-01, -1.820134761512489E+00, 9.941180666355371E-01, -1.820134761512489E+00, 9.882361332710743E-01 }, /* 3164 Hz */
-    { 9.941162185123116E-01, -1.820026626885230E+00, 9.941162185123116E-01, -1.820026626885230E+00, 9.882324370246232E-01 }, /* 3165 Hz */
-    { 9.941143703959169E-01, -1.819918461474346E+00, 9.941143703959169E-01, -1.819918461474346E+00, 9.882287407918338E-01 }, /* 3166 Hz */
-    { 9.941125222863525E-01, -1.819810265281804E+00, 9.941125222863525E-01, -1.819810265281804E+00, 9.882250445727050E-01 }, /* 3167 Hz */
-    { 9.941106741836189E-01, -1.819702038309573E+00, 9.941106741836189E-01, -1.819702038309573E+00, 9.882213483672377E-01 }, /* 3168 Hz */
-    { 9.941088260877153E-01, -1.819593780559618E+00, 9.941088260877153E-01, -1.819593780559618E+00, 9.882176521754307E-01 }, /* 3169 Hz */
-    { 9.941069779986426E-01, -1.819485492033910E+00, 9.941069779986426E-01, -1.819485492033910E+00, 9.882139559972851E-01 }, /* 3170 Hz */
-    { 9.941051299163999E-01, -1.819377172734417E+00, 9.941051299163999E-01, -1.819377172734417E+00, 9.882102598327998E-01 }, /* 3171 Hz */
-    { 9.941032818409877E-01, -1.819268822663109E+00, 9.941032818409877E-01, -1.819268822663109E+00, 9.882065636819755E-01 }, /* 3172 Hz */
-    { 9.941014337724057E-01, -1.819160441821957E+00, 9.941014337724057E-01, -1.819160441821957E+00, 9.882028675448113E-01 }, /* 3173 Hz */
-    { 9.940995857106539E-01, -1.819052030212930E+00, 9.940995857106539E-01, -1.819052030212930E+00, 9.881991714213079E-01 }, /* 3174 Hz */
-    { 9.940977376557323E-01, -1.818943587838002E+00, 9.940977376557323E-01, -1.818943587838002E+00, 9.881954753114646E-01 }, /* 3175 Hz */
-    { 9.940958896076408E-01, -1.818835114699142E+00, 9.940958896076408E-01, -1.818835114699142E+00, 9.881917792152817E-01 }, /* 3176 Hz */
-    { 9.940940415663796E-01, -1.818726610798324E+00, 9.940940415663796E-01, -1.818726610798324E+00, 9.881880831327592E-01 }, /* 3177 Hz */
-    { 9.940921935319479E-01, -1.818618076137519E+00, 9.940921935319479E-01, -1.818618076137519E+00, 9.881843870638958E-01 }, /* 3178 Hz */
-    { 9.940903455043465E-01, -1.818509510718703E+00, 9.940903455043465E-01, -1.818509510718703E+00, 9.881806910086930E-01 }, /* 3179 Hz */
-    { 9.940884974835751E-01, -1.818400914543848E+00, 9.940884974835751E-01, -1.818400914543848E+00, 9.881769949671502E-01 }, /* 3180 Hz */
-    { 9.940866494696333E-01, -1.818292287614928E+00, 9.940866494696333E-01, -1.818292287614928E+00, 9.881732989392666E-01 }, /* 3181 Hz */
-    { 9.940848014625214E-01, -1.818183629933919E+00, 9.940848014625214E-01, -1.818183629933919E+00, 9.881696029250429E-01 }, /* 3182 Hz */
-    { 9.940829534622392E-01, -1.818074941502795E+00, 9.940829534622392E-01, -1.818074941502795E+00, 9.881659069244784E-01 }, /* 3183 Hz */
-    { 9.940811054687867E-01, -1.817966222323534E+00, 9.940811054687867E-01, -1.817966222323534E+00, 9.881622109375734E-01 }, /* 3184 Hz */
-    { 9.940792574821639E-01, -1.817857472398110E+00, 9.940792574821639E-01, -1.817857472398110E+00, 9.881585149643277E-01 }, /* 3185 Hz */
-    { 9.940774095023707E-01, -1.817748691728502E+00, 9.940774095023707E-01, -1.817748691728502E+00, 9.881548190047413E-01 }, /* 3186 Hz */
-    { 9.940755615294070E-01, -1.817639880316687E+00, 9.940755615294070E-01, -1.817639880316687E+00, 9.881511230588140E-01 }, /* 3187 Hz */
-    { 9.940737135632727E-01, -1.817531038164642E+00, 9.940737135632727E-01, -1.817531038164642E+00, 9.881474271265454E-01 }, /* 3188 Hz */
-    { 9.940718656039681E-01, -1.817422165274347E+00, 9.940718656039681E-01, -1.817422165274347E+00, 9.881437312079362E-01 }, /* 3189 Hz */
-    { 9.940700176514926E-01, -1.817313261647779E+00, 9.940700176514926E-01, -1.817313261647779E+00, 9.881400353029852E-01 }, /* 3190 Hz */
-    { 9.940681697058467E-01, -1.817204327286919E+00, 9.940681697058467E-01, -1.817204327286919E+00, 9.881363394116933E-01 }, /* 3191 Hz */
-    { 9.940663217670300E-01, -1.817095362193748E+00, 9.940663217670300E-01, -1.817095362193748E+00, 9.881326435340601E-01 }, /* 3192 Hz */
-    { 9.940644738350426E-01, -1.816986366370244E+00, 9.940644738350426E-01, -1.816986366370244E+00, 9.881289476700852E-01 }, /* 3193 Hz */
-    { 9.940626259098844E-01, -1.816877339818390E+00, 9.940626259098844E-01, -1.816877339818390E+00, 9.881252518197687E-01 }, /* 3194 Hz */
-    { 9.940607779915551E-01, -1.816768282540167E+00, 9.940607779915551E-01, -1.816768282540167E+00, 9.881215559831102E-01 }, /* 3195 Hz */
-    { 9.940589300800552E-01, -1.816659194537558E+00, 9.940589300800552E-01, -1.816659194537558E+00, 9.881178601601104E-01 }, /* 3196 Hz */
-    { 9.940570821753842E-01, -1.816550075812544E+00, 9.940570821753842E-01, -1.816550075812544E+00, 9.881141643507685E-01 }, /* 3197 Hz */
-    { 9.940552342775423E-01, -1.816440926367110E+00, 9.940552342775423E-01, -1.816440926367110E+00, 9.881104685550846E-01 }, /* 3198 Hz */
-    { 9.940533863865291E-01, -1.816331746203237E+00, 9.940533863865291E-01, -1.816331746203237E+00, 9.881067727730581E-01 }, /* 3199 Hz */
-    { 9.940515385023448E-01, -1.816222535322912E+00, 9.940515385023448E-01, -1.816222535322912E+00, 9.881030770046897E-01 }, /* 3200 Hz */
-    { 9.940496906249897E-01, -1.816113293728119E+00, 9.940496906249897E-01, -1.816113293728119E+00, 9.880993812499794E-01 }, /* 3201 Hz */
-    { 9.940478427544631E-01, -1.816004021420843E+00, 9.940478427544631E-01, -1.816004021420843E+00, 9.880956855089262E-01 }, /* 3202 Hz */
-    { 9.940459948907654E-01, -1.815894718403070E+00, 9.940459948907654E-01, -1.815894718403070E+00, 9.880919897815308E-01 }, /* 3203 Hz */
-    { 9.940441470338961E-01, -1.815785384676785E+00, 9.940441470338961E-01, -1.815785384676785E+00, 9.880882940677922E-01 }, /* 3204 Hz */
-    { 9.940422991838557E-01, -1.815676020243976E+00, 9.940422991838557E-01, -1.815676020243976E+00, 9.880845983677113E-01 }, /* 3205 Hz */
-    { 9.940404513406439E-01, -1.815566625106631E+00, 9.940404513406439E-01, -1.815566625106631E+00, 9.880809026812878E-01 }, /* 3206 Hz */
-    { 9.940386035042604E-01, -1.815457199266736E+00, 9.940386035042604E-01, -1.815457199266736E+00, 9.880772070085209E-01 }, /* 3207 Hz */
-    { 9.940367556747056E-01, -1.815347742726281E+00, 9.940367556747056E-01, -1.815347742726281E+00, 9.880735113494112E-01 }, /* 3208 Hz */
-    { 9.940349078519791E-01, -1.815238255487254E+00, 9.940349078519791E-01, -1.815238255487254E+00, 9.880698157039582E-01 }, /* 3209 Hz */
-    { 9.940330600360812E-01, -1.815128737551644E+00, 9.940330600360812E-01, -1.815128737551644E+00, 9.880661200721623E-01 }, /* 3210 Hz */
-    { 9.940312122270113E-01, -1.815019188921442E+00, 9.940312122270113E-01, -1.815019188921442E+00, 9.880624244540226E-01 }, /* 3211 Hz */
-    { 9.940293644247700E-01, -1.814909609598639E+00, 9.940293644247700E-01, -1.814909609598639E+00, 9.880587288495399E-01 }, /* 3212 Hz */
-    { 9.940275166293566E-01, -1.814799999585224E+00, 9.940275166293566E-01, -1.814799999585224E+00, 9.880550332587132E-01 }, /* 3213 Hz */
-    { 9.940256688407716E-01, -1.814690358883189E+00, 9.940256688407716E-01, -1.814690358883189E+00, 9.880513376815432E-01 }, /* 3214 Hz */
-    { 9.940238210590145E-01, -1.814580687494526E+00, 9.940238210590145E-01, -1.814580687494526E+00, 9.880476421180291E-01 }, /* 3215 Hz */
-    { 9.940219732840857E-01, -1.814470985421229E+00, 9.940219732840857E-01, -1.814470985421229E+00, 9.880439465681714E-01 }, /* 3216 Hz */
-    { 9.940201255159848E-01, -1.814361252665289E+00, 9.940201255159848E-01, -1.814361252665289E+00, 9.880402510319697E-01 }, /* 3217 Hz */
-    { 9.940182777547122E-01, -1.814251489228701E+00, 9.940182777547122E-01, -1.814251489228701E+00, 9.880365555094244E-01 }, /* 3218 Hz */
-    { 9.940164300002671E-01, -1.814141695113459E+00, 9.940164300002671E-01, -1.814141695113459E+00, 9.880328600005341E-01 }, /* 3219 Hz */
-    { 9.940145822526500E-01, -1.814031870321556E+00, 9.940145822526500E-01, -1.814031870321556E+00, 9.880291645053001E-01 }, /* 3220 Hz */
-    { 9.940127345118609E-01, -1.813922014854989E+00, 9.940127345118609E-01, -1.813922014854989E+00, 9.880254690237218E-01 }, /* 3221 Hz */
-    { 9.940108867778995E-01, -1.813812128715752E+00, 9.940108867778995E-01, -1.813812128715752E+00, 9.880217735557990E-01 }, /* 3222 Hz */
-    { 9.940090390507658E-01, -1.813702211905842E+00, 9.940090390507658E-01, -1.813702211905842E+00, 9.880180781015315E-01 }, /* 3223 Hz */
-    { 9.940071913304597E-01, -1.813592264427256E+00, 9.940071913304597E-01, -1.813592264427256E+00, 9.880143826609193E-01 }, /* 3224 Hz */
-    { 9.940053436169811E-01, -1.813482286281991E+00, 9.940053436169811E-01, -1.813482286281991E+00, 9.880106872339622E-01 }, /* 3225 Hz */
-    { 9.940034959103302E-01, -1.813372277472043E+00, 9.940034959103302E-01, -1.813372277472043E+00, 9.880069918206604E-01 }, /* 3226 Hz */
-    { 9.940016482105070E-01, -1.813262237999413E+00, 9.940016482105070E-01, -1.813262237999413E+00, 9.880032964210139E-01 }, /* 3227 Hz */
-    { 9.939998005175110E-01, -1.813152167866098E+00, 9.939998005175110E-01, -1.813152167866098E+00, 9.879996010350220E-01 }, /* 3228 Hz */
-    { 9.939979528313425E-01, -1.813042067074097E+00, 9.939979528313425E-01, -1.813042067074097E+00, 9.879959056626850E-01 }, /* 3229 Hz */
-    { 9.939961051520014E-01, -1.812931935625411E+00, 9.939961051520014E-01, -1.812931935625411E+00, 9.879922103040029E-01 }, /* 3230 Hz */
-    { 9.939942574794876E-01, -1.812821773522039E+00, 9.939942574794876E-01, -1.812821773522039E+00, 9.879885149589751E-01 }, /* 3231 Hz */
-    { 9.939924098138009E-01, -1.812711580765982E+00, 9.939924098138009E-01, -1.812711580765982E+00, 9.879848196276018E-01 }, /* 3232 Hz */
-    { 9.939905621549416E-01, -1.812601357359243E+00, 9.939905621549416E-01, -1.812601357359243E+00, 9.879811243098833E-01 }, /* 3233 Hz */
-    { 9.939887145029096E-01, -1.812491103303821E+00, 9.939887145029096E-01, -1.812491103303821E+00, 9.879774290058192E-01 }, /* 3234 Hz */
-    { 9.939868668577045E-01, -1.812380818601721E+00, 9.939868668577045E-01, -1.812380818601721E+00, 9.879737337154091E-01 }, /* 3235 Hz */
-    { 9.939850192193265E-01, -1.812270503254944E+00, 9.939850192193265E-01, -1.812270503254944E+00, 9.879700384386529E-01 }, /* 3236 Hz */
-    { 9.939831715877755E-01, -1.812160157265494E+00, 9.939831715877755E-01, -1.812160157265494E+00, 9.879663431755510E-01 }, /* 3237 Hz */
-    { 9.939813239630514E-01, -1.812049780635375E+00, 9.939813239630514E-01, -1.812049780635375E+00, 9.879626479261028E-01 }, /* 3238 Hz */
-    { 9.939794763451544E-01, -1.811939373366592E+00, 9.939794763451544E-01, -1.811939373366592E+00, 9.879589526903088E-01 }, /* 3239 Hz */
-    { 9.939776287340840E-01, -1.811828935461149E+00, 9.939776287340840E-01, -1.811828935461149E+00, 9.879552574681680E-01 }, /* 3240 Hz */
-    { 9.939757811298406E-01, -1.811718466921051E+00, 9.939757811298406E-01, -1.811718466921051E+00, 9.879515622596813E-01 }, /* 3241 Hz */
-    { 9.939739335324239E-01, -1.811607967748305E+00, 9.939739335324239E-01, -1.811607967748305E+00, 9.879478670648478E-01 }, /* 3242 Hz */
-    { 9.939720859418339E-01, -1.811497437944918E+00, 9.939720859418339E-01, -1.811497437944918E+00, 9.879441718836679E-01 }, /* 3243 Hz */
-    { 9.939702383580706E-01, -1.811386877512895E+00, 9.939702383580706E-01, -1.811386877512895E+00, 9.879404767161413E-01 }, /* 3244 Hz */
-    { 9.939683907811340E-01, -1.811276286454246E+00, 9.939683907811340E-01, -1.811276286454246E+00, 9.879367815622679E-01 }, /* 3245 Hz */
-    { 9.939665432110236E-01, -1.811165664770976E+00, 9.939665432110236E-01, -1.811165664770976E+00, 9.879330864220472E-01 }, /* 3246 Hz */
-    { 9.939646956477400E-01, -1.811055012465096E+00, 9.939646956477400E-01, -1.811055012465096E+00, 9.879293912954801E-01 }, /* 3247 Hz */
-    { 9.939628480912828E-01, -1.810944329538615E+00, 9.939628480912828E-01, -1.810944329538615E+00, 9.879256961825655E-01 }, /* 3248 Hz */
-    { 9.939610005416519E-01, -1.810833615993541E+00, 9.939610005416519E-01, -1.810833615993541E+00, 9.879220010833039E-01 }, /* 3249 Hz */
-    { 9.939591529988474E-01, -1.810722871831885E+00, 9.939591529988474E-01, -1.810722871831885E+00, 9.879183059976948E-01 }, /* 3250 Hz */
-    { 9.939573054628694E-01, -1.810612097055658E+00, 9.939573054628694E-01, -1.810612097055658E+00, 9.879146109257388E-01 }, /* 3251 Hz */
-    { 9.939554579337173E-01, -1.810501291666870E+00, 9.939554579337173E-01, -1.810501291666870E+00, 9.879109158674346E-01 }, /* 3252 Hz */
-    { 9.939536104113915E-01, -1.810390455667534E+00, 9.939536104113915E-01, -1.810390455667534E+00, 9.879072208227830E-01 }, /* 3253 Hz */
-    { 9.939517628958920E-01, -1.810279589059661E+00, 9.939517628958920E-01, -1.810279589059661E+00, 9.879035257917841E-01 }, /* 3254 Hz */
-    { 9.939499153872187E-01, -1.810168691845265E+00, 9.939499153872187E-01, -1.810168691845265E+00, 9.878998307744373E-01 }, /* 3255 Hz */
-    { 9.939480678853712E-01, -1.810057764026358E+00, 9.939480678853712E-01, -1.810057764026358E+00, 9.878961357707423E-01 }, /* 3256 Hz */
-    { 9.939462203903496E-01, -1.809946805604953E+00, 9.939462203903496E-01, -1.809946805604953E+00, 9.878924407806993E-01 }, /* 3257 Hz */
-    { 9.939443729021541E-01, -1.809835816583066E+00, 9.939443729021541E-01, -1.809835816583066E+00, 9.878887458043082E-01 }, /* 3258 Hz */
-    { 9.939425254207845E-01, -1.809724796962712E+00, 9.939425254207845E-01, -1.809724796962712E+00, 9.878850508415691E-01 }, /* 3259 Hz */
-    { 9.939406779462406E-01, -1.809613746745904E+00, 9.939406779462406E-01, -1.809613746745904E+00, 9.878813558924813E-01 }, /* 3260 Hz */
-    { 9.939388304785228E-01, -1.809502665934660E+00, 9.939388304785228E-01, -1.809502665934660E+00, 9.878776609570457E-01 }, /* 3261 Hz */
-    { 9.939369830176304E-01, -1.809391554530995E+00, 9.939369830176304E-01, -1.809391554530995E+00, 9.878739660352609E-01 }, /* 3262 Hz */
-    { 9.939351355635641E-01, -1.809280412536927E+00, 9.939351355635641E-01, -1.809280412536927E+00, 9.878702711271281E-01 }, /* 3263 Hz */
-    { 9.939332881163231E-01, -1.809169239954471E+00, 9.939332881163231E-01, -1.809169239954471E+00, 9.878665762326462E-01 }, /* 3264 Hz */
-    { 9.939314406759079E-01, -1.809058036785648E+00, 9.939314406759079E-01, -1.809058036785648E+00, 9.878628813518158E-01 }, /* 3265 Hz */
-    { 9.939295932423180E-01, -1.808946803032474E+00, 9.939295932423180E-01, -1.808946803032474E+00, 9.878591864846360E-01 }, /* 3266 Hz */
-    { 9.939277458155539E-01, -1.808835538696968E+00, 9.939277458155539E-01, -1.808835538696968E+00, 9.878554916311078E-01 }, /* 3267 Hz */
-    { 9.939258983956148E-01, -1.808724243781151E+00, 9.939258983956148E-01, -1.808724243781151E+00, 9.878517967912297E-01 }, /* 3268 Hz */
-    { 9.939240509825015E-01, -1.808612918287041E+00, 9.939240509825015E-01, -1.808612918287041E+00, 9.878481019650029E-01 }, /* 3269 Hz */
-    { 9.939222035762132E-01, -1.808501562216660E+00, 9.939222035762132E-01, -1.808501562216660E+00, 9.878444071524264E-01 }, /* 3270 Hz */
-    { 9.939203561767503E-01, -1.808390175572028E+00, 9.939203561767503E-01, -1.808390175572028E+00, 9.878407123535007E-01 }, /* 3271 Hz */
-    { 9.939185087841129E-01, -1.808278758355166E+00, 9.939185087841129E-01, -1.808278758355166E+00, 9.878370175682258E-01 }, /* 3272 Hz */
-    { 9.939166613983003E-01, -1.808167310568098E+00, 9.939166613983003E-01, -1.808167310568098E+00, 9.878333227966005E-01 }, /* 3273 Hz */
-    { 9.939148140193130E-01, -1.808055832212844E+00, 9.939148140193130E-01, -1.808055832212844E+00, 9.878296280386261E-01 }, /* 3274 Hz */
-    { 9.939129666471508E-01, -1.807944323291429E+00, 9.939129666471508E-01, -1.807944323291429E+00, 9.878259332943016E-01 }, /* 3275 Hz */
-    { 9.939111192818137E-01, -1.807832783805875E+00, 9.939111192818137E-01, -1.807832783805875E+00, 9.878222385636275E-01 }, /* 3276 Hz */
-    { 9.939092719233015E-01, -1.807721213758207E+00, 9.939092719233015E-01, -1.807721213758207E+00, 9.878185438466029E-01 }, /* 3277 Hz */
-    { 9.939074245716142E-01, -1.807609613150450E+00, 9.939074245716142E-01, -1.807609613150450E+00, 9.878148491432284E-01 }, /* 3278 Hz */
-    { 9.939055772267518E-01, -1.807497981984628E+00, 9.939055772267518E-01, -1.807497981984628E+00, 9.878111544535035E-01 }, /* 3279 Hz */
-    { 9.939037298887142E-01, -1.807386320262766E+00, 9.939037298887142E-01, -1.807386320262766E+00, 9.878074597774285E-01 }, /* 3280 Hz */
-    { 9.939018825575014E-01, -1.807274627986892E+00, 9.939018825575014E-01, -1.807274627986892E+00, 9.878037651150029E-01 }, /* 3281 Hz */
-    { 9.939000352331133E-01, -1.807162905159031E+00, 9.939000352331133E-01, -1.807162905159031E+00, 9.878000704662266E-01 }, /* 3282 Hz */
-    { 9.938981879155498E-01, -1.807051151781211E+00, 9.938981879155498E-01, -1.807051151781211E+00, 9.877963758310997E-01 }, /* 3283 Hz */
-    { 9.938963406048111E-01, -1.806939367855459E+00, 9.938963406048111E-01, -1.806939367855459E+00, 9.877926812096223E-01 }, /* 3284 Hz */
-    { 9.938944933008969E-01, -1.806827553383804E+00, 9.938944933008969E-01, -1.806827553383804E+00, 9.877889866017937E-01 }, /* 3285 Hz */
-    { 9.938926460038072E-01, -1.806715708368275E+00, 9.938926460038072E-01, -1.806715708368275E+00, 9.877852920076144E-01 }, /* 3286 Hz */
-    { 9.938907987135421E-01, -1.806603832810899E+00, 9.938907987135421E-01, -1.806603832810899E+00, 9.877815974270843E-01 }, /* 3287 Hz */
-    { 9.938889514301013E-01, -1.806491926713708E+00, 9.938889514301013E-01, -1.806491926713708E+00, 9.877779028602025E-01 }, /* 3288 Hz */
-    { 9.938871041534848E-01, -1.806379990078731E+00, 9.938871041534848E-01, -1.806379990078731E+00, 9.877742083069696E-01 }, /* 3289 Hz */
-    { 9.938852568836929E-01, -1.806268022907999E+00, 9.938852568836929E-01, -1.806268022907999E+00, 9.877705137673858E-01 }, /* 3290 Hz */
-    { 9.938834096207250E-01, -1.806156025203543E+00, 9.938834096207250E-01, -1.806156025203543E+00, 9.877668192414499E-01 }, /* 3291 Hz */
-    { 9.938815623645815E-01, -1.806043996967396E+00, 9.938815623645815E-01, -1.806043996967396E+00, 9.877631247291629E-01 }, /* 3292 Hz */
-    { 9.938797151152621E-01, -1.805931938201589E+00, 9.938797151152621E-01, -1.805931938201589E+00, 9.877594302305241E-01 }, /* 3293 Hz */
-    { 9.938778678727666E-01, -1.805819848908154E+00, 9.938778678727666E-01, -1.805819848908154E+00, 9.877557357455331E-01 }, /* 3294 Hz */
-    { 9.938760206370955E-01, -1.805707729089127E+00, 9.938760206370955E-01, -1.805707729089127E+00, 9.877520412741909E-01 }, /* 3295 Hz */
-    { 9.938741734082482E-01, -1.805595578746540E+00, 9.938741734082482E-01, -1.805595578746540E+00, 9.877483468164965E-01 }, /* 3296 Hz */
-    { 9.938723261862249E-01, -1.805483397882427E+00, 9.938723261862249E-01, -1.805483397882427E+00, 9.877446523724498E-01 }, /* 3297 Hz */
-    { 9.938704789710257E-01, -1.805371186498824E+00, 9.938704789710257E-01, -1.805371186498824E+00, 9.877409579420513E-01 }, /* 3298 Hz */
-    { 9.938686317626502E-01, -1.805258944597766E+00, 9.938686317626502E-01, -1.805258944597766E+00, 9.877372635253003E-01 }, /* 3299 Hz */
-    { 9.938667845610983E-01, -1.805146672181288E+00, 9.938667845610983E-01, -1.805146672181288E+00, 9.877335691221967E-01 }, /* 3300 Hz */
-    { 9.938649373663705E-01, -1.805034369251428E+00, 9.938649373663705E-01, -1.805034369251428E+00, 9.877298747327410E-01 }, /* 3301 Hz */
-    { 9.938630901784663E-01, -1.804922035810222E+00, 9.938630901784663E-01, -1.804922035810222E+00, 9.877261803569326E-01 }, /* 3302 Hz */
-    { 9.938612429973858E-01, -1.804809671859707E+00, 9.938612429973858E-01, -1.804809671859707E+00, 9.877224859947715E-01 }, /* 3303 Hz */
-    { 9.938593958231288E-01, -1.804697277401922E+00, 9.938593958231288E-01, -1.804697277401922E+00, 9.877187916462575E-01 }, /* 3304 Hz */
-    { 9.938575486556954E-01, -1.804584852438905E+00, 9.938575486556954E-01, -1.804584852438905E+00, 9.877150973113908E-01 }, /* 3305 Hz */
-    { 9.938557014950856E-01, -1.804472396972694E+00, 9.938557014950856E-01, -1.804472396972694E+00, 9.877114029901712E-01 }, /* 3306 Hz */
-    { 9.938538543412992E-01, -1.804359911005330E+00, 9.938538543412992E-01, -1.804359911005330E+00, 9.877077086825985E-01 }, /* 3307 Hz */
-    { 9.938520071943362E-01, -1.804247394538852E+00, 9.938520071943362E-01, -1.804247394538852E+00, 9.877040143886724E-01 }, /* 3308 Hz */
-    { 9.938501600541965E-01, -1.804134847575301E+00, 9.938501600541965E-01, -1.804134847575301E+00, 9.877003201083929E-01 }, /* 3309 Hz */
-    { 9.938483129208802E-01, -1.804022270116719E+00, 9.938483129208802E-01, -1.804022270116719E+00, 9.876966258417603E-01 }, /* 3310 Hz */
-    { 9.938464657943872E-01, -1.803909662165145E+00, 9.938464657943872E-01, -1.803909662165145E+00, 9.876929315887744E-01 }, /* 3311 Hz */
-    { 9.938446186747172E-01, -1.803797023722623E+00, 9.938446186747172E-01, -1.803797023722623E+00, 9.876892373494344E-01 }, /* 3312 Hz */
-    { 9.938427715618704E-01, -1.803684354791195E+00, 9.938427715618704E-01, -1.803684354791195E+00, 9.876855431237408E-01 }, /* 3313 Hz */
-    { 9.938409244558468E-01, -1.803571655372905E+00, 9.938409244558468E-01, -1.803571655372905E+00, 9.876818489116936E-01 }, /* 3314 Hz */
-    { 9.938390773566462E-01, -1.803458925469795E+00, 9.938390773566462E-01, -1.803458925469795E+00, 9.876781547132925E-01 }, /* 3315 Hz */
-    { 9.938372302642687E-01, -1.803346165083910E+00, 9.938372302642687E-01, -1.803346165083910E+00, 9.876744605285375E-01 }, /* 3316 Hz */
-    { 9.938353831787141E-01, -1.803233374217295E+00, 9.938353831787141E-01, -1.803233374217295E+00, 9.876707663574282E-01 }, /* 3317 Hz */
-    { 9.938335360999824E-01, -1.803120552871994E+00, 9.938335360999824E-01, -1.803120552871994E+00, 9.876670721999647E-01 }, /* 3318 Hz */
-    { 9.938316890280736E-01, -1.803007701050054E+00, 9.938316890280736E-01, -1.803007701050054E+00, 9.876633780561472E-01 }, /* 3319 Hz */
-    { 9.938298419629875E-01, -1.802894818753521E+00, 9.938298419629875E-01, -1.802894818753521E+00, 9.876596839259750E-01 }, /* 3320 Hz */
-    { 9.938279949047242E-01, -1.802781905984441E+00, 9.938279949047242E-01, -1.802781905984441E+00, 9.876559898094484E-01 }, /* 3321 Hz */
-    { 9.938261478532836E-01, -1.802668962744861E+00, 9.938261478532836E-01, -1.802668962744861E+00, 9.876522957065672E-01 }, /* 3322 Hz */
-    { 9.938243008086656E-01, -1.802555989036829E+00, 9.938243008086656E-01, -1.802555989036829E+00, 9.876486016173311E-01 }, /* 3323 Hz */
-    { 9.938224537708703E-01, -1.802442984862394E+00, 9.938224537708703E-01, -1.802442984862394E+00, 9.876449075417406E-01 }, /* 3324 Hz */
-    { 9.938206067398974E-01, -1.802329950223603E+00, 9.938206067398974E-01, -1.802329950223603E+00, 9.876412134797947E-01 }, /* 3325 Hz */
-    { 9.938187597157471E-01, -1.802216885122508E+00, 9.938187597157471E-01, -1.802216885122508E+00, 9.876375194314941E-01 }, /* 3326 Hz */
-    { 9.938169126984191E-01, -1.802103789561156E+00, 9.938169126984191E-01, -1.802103789561156E+00, 9.876338253968382E-01 }, /* 3327 Hz */
-    { 9.938150656879137E-01, -1.801990663541599E+00, 9.938150656879137E-01, -1.801990663541599E+00, 9.876301313758273E-01 }, /* 3328 Hz */
-    { 9.938132186842306E-01, -1.801877507065888E+00, 9.938132186842306E-01, -1.801877507065888E+00, 9.876264373684611E-01 }, /* 3329 Hz */
-    { 9.938113716873694E-01, -1.801764320136072E+00, 9.938113716873694E-01, -1.801764320136072E+00, 9.876227433747389E-01 }, /* 3330 Hz */
-    { 9.938095246973310E-01, -1.801651102754205E+00, 9.938095246973310E-01, -1.801651102754205E+00, 9.876190493946619E-01 }, /* 3331 Hz */
-    { 9.938076777141144E-01, -1.801537854922339E+00, 9.938076777141144E-01, -1.801537854922339E+00, 9.876153554282288E-01 }, /* 3332 Hz */
-    { 9.938058307377202E-01, -1.801424576642527E+00, 9.938058307377202E-01, -1.801424576642527E+00, 9.876116614754404E-01 }, /* 3333 Hz */
-    { 9.938039837681478E-01, -1.801311267916822E+00, 9.938039837681478E-01, -1.801311267916822E+00, 9.876079675362957E-01 }, /* 3334 Hz */
-    { 9.938021368053978E-01, -1.801197928747277E+00, 9.938021368053978E-01, -1.801197928747277E+00, 9.876042736107955E-01 }, /* 3335 Hz */
-    { 9.938002898494696E-01, -1.801084559135948E+00, 9.938002898494696E-01, -1.801084559135948E+00, 9.876005796989391E-01 }, /* 3336 Hz */
-    { 9.937984429003632E-01, -1.800971159084889E+00, 9.937984429003632E-01, -1.800971159084889E+00, 9.875968858007265E-01 }, /* 3337 Hz */
-    { 9.937965959580789E-01, -1.800857728596156E+00, 9.937965959580789E-01, -1.800857728596156E+00, 9.875931919161578E-01 }, /* 3338 Hz */
-    { 9.937947490226164E-01, -1.800744267671804E+00, 9.937947490226164E-01, -1.800744267671804E+00, 9.875894980452329E-01 }, /* 3339 Hz */
-    { 9.937929020939755E-01, -1.800630776313890E+00, 9.937929020939755E-01, -1.800630776313890E+00, 9.875858041879511E-01 }, /* 3340 Hz */
-    { 9.937910551721566E-01, -1.800517254524472E+00, 9.937910551721566E-01, -1.800517254524472E+00, 9.875821103443132E-01 }, /* 3341 Hz */
-    { 9.937892082571592E-01, -1.800403702305605E+00, 9.937892082571592E-01, -1.800403702305605E+00, 9.875784165143184E-01 }, /* 3342 Hz */
-    { 9.937873613489836E-01, -1.800290119659350E+00, 9.937873613489836E-01, -1.800290119659350E+00, 9.875747226979672E-01 }, /* 3343 Hz */
-    { 9.937855144476294E-01, -1.800176506587763E+00, 9.937855144476294E-01, -1.800176506587763E+00, 9.875710288952588E-01 }, /* 3344 Hz */
-    { 9.937836675530970E-01, -1.800062863092904E+00, 9.937836675530970E-01, -1.800062863092904E+00, 9.875673351061940E-01 }, /* 3345 Hz */
-    { 9.937818206653858E-01, -1.799949189176833E+00, 9.937818206653858E-01, -1.799949189176833E+00, 9.875636413307716E-01 }, /* 3346 Hz */
-    { 9.937799737844960E-01, -1.799835484841609E+00, 9.937799737844960E-01, -1.799835484841609E+00, 9.875599475689920E-01 }, /* 3347 Hz */
-    { 9.937781269104277E-01, -1.799721750089294E+00, 9.937781269104277E-01, -1.799721750089294E+00, 9.875562538208553E-01 }, /* 3348 Hz */
-    { 9.937762800431807E-01, -1.799607984921947E+00, 9.937762800431807E-01, -1.799607984921947E+00, 9.875525600863615E-01 }, /* 3349 Hz */
-    { 9.937744331827550E-01, -1.799494189341632E+00, 9.937744331827550E-01, -1.799494189341632E+00, 9.875488663655101E-01 }, /* 3350 Hz */
-    { 9.937725863291506E-01, -1.799380363350409E+00, 9.937725863291506E-01, -1.799380363350409E+00, 9.875451726583011E-01 }, /* 3351 Hz */
-    { 9.937707394823673E-01, -1.799266506950342E+00, 9.937707394823673E-01, -1.799266506950342E+00, 9.875414789647345E-01 }, /* 3352 Hz */
-    { 9.937688926424052E-01, -1.799152620143494E+00, 9.937688926424052E-01, -1.799152620143494E+00, 9.875377852848104E-01 }, /* 3353 Hz */
-    { 9.937670458092641E-01, -1.799038702931927E+00, 9.937670458092641E-01, -1.799038702931927E+00, 9.875340916185282E-01 }, /* 3354 Hz */
-    { 9.937651989829439E-01, -1.798924755317707E+00, 9.937651989829439E-01, -1.798924755317707E+00, 9.875303979658878E-01 }, /* 3355 Hz */
-    { 9.937633521634448E-01, -1.798810777302898E+00, 9.937633521634448E-01, -1.798810777302898E+00, 9.875267043268896E-01 }, /* 3356 Hz */
-    { 9.937615053507666E-01, -1.798696768889566E+00, 9.937615053507666E-01, -1.798696768889566E+00, 9.875230107015331E-01 }, /* 3357 Hz */
-    { 9.937596585449094E-01, -1.798582730079775E+00, 9.937596585449094E-01, -1.798582730079775E+00, 9.875193170898189E-01 }, /* 3358 Hz */
-    { 9.937578117458727E-01, -1.798468660875593E+00, 9.937578117458727E-01, -1.798468660875593E+00, 9.875156234917455E-01 }, /* 3359 Hz */
-    { 9.937559649536571E-01, -1.798354561279085E+00, 9.937559649536571E-01, -1.798354561279085E+00, 9.875119299073143E-01 }, /* 3360 Hz */
-    { 9.937541181682621E-01, -1.798240431292319E+00, 9.937541181682621E-01, -1.798240431292319E+00, 9.875082363365242E-01 }, /* 3361 Hz */
-    { 9.937522713896878E-01, -1.798126270917364E+00, 9.937522713896878E-01, -1.798126270917364E+00, 9.875045427793756E-01 }, /* 3362 Hz */
-    { 9.937504246179342E-01, -1.798012080156286E+00, 9.937504246179342E-01, -1.798012080156286E+00, 9.875008492358683E-01 }, /* 3363 Hz */
-    { 9.937485778530010E-01, -1.797897859011156E+00, 9.937485778530010E-01, -1.797897859011156E+00, 9.874971557060019E-01 }, /* 3364 Hz */
-    { 9.937467310948882E-01, -1.797783607484041E+00, 9.937467310948882E-01, -1.797783607484041E+00, 9.874934621897764E-01 }, /* 3365 Hz */
-    { 9.937448843435962E-01, -1.797669325577012E+00, 9.937448843435962E-01, -1.797669325577012E+00, 9.874897686871924E-01 }, /* 3366 Hz */
-    { 9.937430375991244E-01, -1.797555013292140E+00, 9.937430375991244E-01, -1.797555013292140E+00, 9.874860751982488E-01 }, /* 3367 Hz */
-    { 9.937411908614731E-01, -1.797440670631494E+00, 9.937411908614731E-01, -1.797440670631494E+00, 9.874823817229461E-01 }, /* 3368 Hz */
-    { 9.937393441306419E-01, -1.797326297597147E+00, 9.937393441306419E-01, -1.797326297597147E+00, 9.874786882612838E-01 }, /* 3369 Hz */
-    { 9.937374974066311E-01, -1.797211894191170E+00, 9.937374974066311E-01, -1.797211894191170E+00, 9.874749948132622E-01 }, /* 3370 Hz */
-    { 9.937356506894406E-01, -1.797097460415636E+00, 9.937356506894406E-01, -1.797097460415636E+00, 9.874713013788812E-01 }, /* 3371 Hz */
-    { 9.937338039790702E-01, -1.796982996272617E+00, 9.937338039790702E-01, -1.796982996272617E+00, 9.874676079581404E-01 }, /* 3372 Hz */
-    { 9.937319572755198E-01, -1.796868501764187E+00, 9.937319572755198E-01, -1.796868501764187E+00, 9.874639145510395E-01 }, /* 3373 Hz */
-    { 9.937301105787896E-01, -1.796753976892420E+00, 9.937301105787896E-01, -1.796753976892420E+00, 9.874602211575791E-01 }, /* 3374 Hz */
-    { 9.937282638888794E-01, -1.796639421659389E+00, 9.937282638888794E-01, -1.796639421659389E+00, 9.874565277777587E-01 }, /* 3375 Hz */
-    { 9.937264172057890E-01, -1.796524836067171E+00, 9.937264172057890E-01, -1.796524836067171E+00, 9.874528344115781E-01 }, /* 3376 Hz */
-    { 9.937245705295186E-01, -1.796410220117840E+00, 9.937245705295186E-01, -1.796410220117840E+00, 9.874491410590371E-01 }, /* 3377 Hz */
-    { 9.937227238600680E-01, -1.796295573813472E+00, 9.937227238600680E-01, -1.796295573813472E+00, 9.874454477201360E-01 }, /* 3378 Hz */
-    { 9.937208771974374E-01, -1.796180897156145E+00, 9.937208771974374E-01, -1.796180897156145E+00, 9.874417543948748E-01 }, /* 3379 Hz */
-    { 9.937190305416264E-01, -1.796066190147933E+00, 9.937190305416264E-01, -1.796066190147933E+00, 9.874380610832527E-01 }, /* 3380 Hz */
-    { 9.937171838926350E-01, -1.795951452790916E+00, 9.937171838926350E-01, -1.795951452790916E+00, 9.874343677852699E-01 }, /* 3381 Hz */
-    { 9.937153372504633E-01, -1.795836685087172E+00, 9.937153372504633E-01, -1.795836685087172E+00, 9.874306745009267E-01 }, /* 3382 Hz */
-    { 9.937134906151114E-01, -1.795721887038778E+00, 9.937134906151114E-01, -1.795721887038778E+00, 9.874269812302228E-01 }, /* 3383 Hz */
-    { 9.937116439865791E-01, -1.795607058647814E+00, 9.937116439865791E-01, -1.795607058647814E+00, 9.874232879731581E-01 }, /* 3384 Hz */
-    { 9.937097973648660E-01, -1.795492199916359E+00, 9.937097973648660E-01, -1.795492199916359E+00, 9.874195947297320E-01 }, /* 3385 Hz */
-    { 9.937079507499725E-01, -1.795377310846493E+00, 9.937079507499725E-01, -1.795377310846493E+00, 9.874159014999451E-01 }, /* 3386 Hz */
-    { 9.937061041418985E-01, -1.795262391440298E+00, 9.937061041418985E-01, -1.795262391440298E+00, 9.874122082837971E-01 }, /* 3387 Hz */
-    { 9.937042575406438E-01, -1.795147441699853E+00, 9.937042575406438E-01, -1.795147441699853E+00, 9.874085150812877E-01 }, /* 3388 Hz */
-    { 9.937024109462083E-01, -1.795032461627240E+00, 9.937024109462083E-01, -1.795032461627240E+00, 9.874048218924165E-01 }, /* 3389 Hz */
-    { 9.937005643585921E-01, -1.794917451224543E+00, 9.937005643585921E-01, -1.794917451224543E+00, 9.874011287171842E-01 }, /* 3390 Hz */
-    { 9.936987177777951E-01, -1.794802410493842E+00, 9.936987177777951E-01, -1.794802410493842E+00, 9.873974355555901E-01 }, /* 3391 Hz */
-    { 9.936968712038172E-01, -1.794687339437221E+00, 9.936968712038172E-01, -1.794687339437221E+00, 9.873937424076344E-01 }, /* 3392 Hz */
-    { 9.936950246366585E-01, -1.794572238056764E+00, 9.936950246366585E-01, -1.794572238056764E+00, 9.873900492733170E-01 }, /* 3393 Hz */
-    { 9.936931780763189E-01, -1.794457106354556E+00, 9.936931780763189E-01, -1.794457106354556E+00, 9.873863561526377E-01 }, /* 3394 Hz */
-    { 9.936913315227980E-01, -1.794341944332679E+00, 9.936913315227980E-01, -1.794341944332679E+00, 9.873826630455960E-01 }, /* 3395 Hz */
-    { 9.936894849760962E-01, -1.794226751993221E+00, 9.936894849760962E-01, -1.794226751993221E+00, 9.873789699521924E-01 }, /* 3396 Hz */
-    { 9.936876384362134E-01, -1.794111529338266E+00, 9.936876384362134E-01, -1.794111529338266E+00, 9.873752768724269E-01 }, /* 3397 Hz */
-    { 9.936857919031494E-01, -1.793996276369901E+00, 9.936857919031494E-01, -1.793996276369901E+00, 9.873715838062989E-01 }, /* 3398 Hz */
-    { 9.936839453769041E-01, -1.793880993090211E+00, 9.936839453769041E-01, -1.793880993090211E+00, 9.873678907538082E-01 }, /* 3399 Hz */
-    { 9.936820988574775E-01, -1.793765679501285E+00, 9.936820988574775E-01, -1.793765679501285E+00, 9.873641977149550E-01 }, /* 3400 Hz */
-    { 9.936802523448699E-01, -1.793650335605211E+00, 9.936802523448699E-01, -1.793650335605211E+00, 9.873605046897398E-01 }, /* 3401 Hz */
-    { 9.936784058390806E-01, -1.793534961404076E+00, 9.936784058390806E-01, -1.793534961404076E+00, 9.873568116781613E-01 }, /* 3402 Hz */
-    { 9.936765593401102E-01, -1.793419556899969E+00, 9.936765593401102E-01, -1.793419556899969E+00, 9.873531186802205E-01 }, /* 3403 Hz */
-    { 9.936747128479582E-01, -1.793304122094979E+00, 9.936747128479582E-01, -1.793304122094979E+00, 9.873494256959163E-01 }, /* 3404 Hz */
-    { 9.936728663626245E-01, -1.793188656991196E+00, 9.936728663626245E-01, -1.793188656991196E+00, 9.873457327252491E-01 }, /* 3405 Hz */
-    { 9.936710198841094E-01, -1.793073161590711E+00, 9.936710198841094E-01, -1.793073161590711E+00, 9.873420397682189E-01 }, /* 3406 Hz */
-    { 9.936691734124127E-01, -1.792957635895613E+00, 9.936691734124127E-01, -1.792957635895613E+00, 9.873383468248254E-01 }, /* 3407 Hz */
-    { 9.936673269475345E-01, -1.792842079907996E+00, 9.936673269475345E-01, -1.792842079907996E+00, 9.873346538950689E-01 }, /* 3408 Hz */
-    { 9.936654804894741E-01, -1.792726493629948E+00, 9.936654804894741E-01, -1.792726493629948E+00, 9.873309609789482E-01 }, /* 3409 Hz */
-    { 9.936636340382323E-01, -1.792610877063565E+00, 9.936636340382323E-01, -1.792610877063565E+00, 9.873272680764646E-01 }, /* 3410 Hz */
-    { 9.936617875938086E-01, -1.792495230210938E+00, 9.936617875938086E-01, -1.792495230210938E+00, 9.873235751876173E-01 }, /* 3411 Hz */
-    { 9.936599411562033E-01, -1.792379553074161E+00, 9.936599411562033E-01, -1.792379553074161E+00, 9.873198823124065E-01 }, /* 3412 Hz */
-    { 9.936580947254157E-01, -1.792263845655327E+00, 9.936580947254157E-01, -1.792263845655327E+00, 9.873161894508313E-01 }, /* 3413 Hz */
-    { 9.936562483014463E-01, -1.792148107956531E+00, 9.936562483014463E-01, -1.792148107956531E+00, 9.873124966028926E-01 }, /* 3414 Hz */
-    { 9.936544018842948E-01, -1.792032339979867E+00, 9.936544018842948E-01, -1.792032339979867E+00, 9.873088037685895E-01 }, /* 3415 Hz */
-    { 9.936525554739613E-01, -1.791916541727432E+00, 9.936525554739613E-01, -1.791916541727432E+00, 9.873051109479225E-01 }, /* 3416 Hz */
-    { 9.936507090704457E-01, -1.791800713201321E+00, 9.936507090704457E-01, -1.791800713201321E+00, 9.873014181408915E-01 }, /* 3417 Hz */
-    { 9.936488626737477E-01, -1.791684854403629E+00, 9.936488626737477E-01, -1.791684854403629E+00, 9.872977253474955E-01 }, /* 3418 Hz */
-    { 9.936470162838680E-01, -1.791568965336456E+00, 9.936470162838680E-01, -1.791568965336456E+00, 9.872940325677360E-01 }, /* 3419 Hz */
-    { 9.936451699008054E-01, -1.791453046001896E+00, 9.936451699008054E-01, -1.791453046001896E+00, 9.872903398016109E-01 }, /* 3420 Hz */
-    { 9.936433235245610E-01, -1.791337096402049E+00, 9.936433235245610E-01, -1.791337096402049E+00, 9.872866470491219E-01 }, /* 3421 Hz */
-    { 9.936414771551338E-01, -1.791221116539013E+00, 9.936414771551338E-01, -1.791221116539013E+00, 9.872829543102677E-01 }, /* 3422 Hz */
-    { 9.936396307925246E-01, -1.791105106414887E+00, 9.936396307925246E-01, -1.791105106414887E+00, 9.872792615850492E-01 }, /* 3423 Hz */
-    { 9.936377844367326E-01, -1.790989066031770E+00, 9.936377844367326E-01, -1.790989066031770E+00, 9.872755688734651E-01 }, /* 3424 Hz */
-    { 9.936359380877582E-01, -1.790872995391763E+00, 9.936359380877582E-01, -1.790872995391763E+00, 9.872718761755164E-01 }, /* 3425 Hz */
-    { 9.936340917456011E-01, -1.790756894496965E+00, 9.936340917456011E-01, -1.790756894496965E+00, 9.872681834912023E-01 }, /* 3426 Hz */
-    { 9.936322454102616E-01, -1.790640763349478E+00, 9.936322454102616E-01, -1.790640763349478E+00, 9.872644908205233E-01 }, /* 3427 Hz */
-    { 9.936303990817392E-01, -1.790524601951403E+00, 9.936303990817392E-01, -1.790524601951403E+00, 9.872607981634784E-01 }, /* 3428 Hz */
-    { 9.936285527600344E-01, -1.790408410304843E+00, 9.936285527600344E-01, -1.790408410304843E+00, 9.872571055200687E-01 }, /* 3429 Hz */
-    { 9.936267064451466E-01, -1.790292188411899E+00, 9.936267064451466E-01, -1.790292188411899E+00, 9.872534128902932E-01 }, /* 3430 Hz */
-    { 9.936248601370758E-01, -1.790175936274675E+00, 9.936248601370758E-01, -1.790175936274675E+00, 9.872497202741517E-01 }, /* 3431 Hz */
-    { 9.936230138358224E-01, -1.790059653895274E+00, 9.936230138358224E-01, -1.790059653895274E+00, 9.872460276716448E-01 }, /* 3432 Hz */
-    { 9.936211675413860E-01, -1.789943341275801E+00, 9.936211675413860E-01, -1.789943341275801E+00, 9.872423350827719E-01 }, /* 3433 Hz */
-    { 9.936193212537665E-01, -1.789826998418360E+00, 9.936193212537665E-01, -1.789826998418360E+00, 9.872386425075330E-01 }, /* 3434 Hz */
-    { 9.936174749729640E-01, -1.789710625325055E+00, 9.936174749729640E-01, -1.789710625325055E+00, 9.872349499459281E-01 }, /* 3435 Hz */
-    { 9.936156286989787E-01, -1.789594221997994E+00, 9.936156286989787E-01, -1.789594221997994E+00, 9.872312573979574E-01 }, /* 3436 Hz */
-    { 9.936137824318100E-01, -1.789477788439280E+00, 9.936137824318100E-01, -1.789477788439280E+00, 9.872275648636200E-01 }, /* 3437 Hz */
-    { 9.936119361714579E-01, -1.789361324651022E+00, 9.936119361714579E-01, -1.789361324651022E+00, 9.872238723429159E-01 }, /* 3438 Hz */
-    { 9.936100899179231E-01, -1.789244830635327E+00, 9.936100899179231E-01, -1.789244830635327E+00, 9.872201798358462E-01 }, /* 3439 Hz */
-    { 9.936082436712046E-01, -1.789128306394300E+00, 9.936082436712046E-01, -1.789128306394300E+00, 9.872164873424092E-01 }, /* 3440 Hz */
-    { 9.936063974313029E-01, -1.789011751930053E+00, 9.936063974313029E-01, -1.789011751930053E+00, 9.872127948626057E-01 }, /* 3441 Hz */
-    { 9.936045511982179E-01, -1.788895167244692E+00, 9.936045511982179E-01, -1.788895167244692E+00, 9.872091023964358E-01 }, /* 3442 Hz */
-    { 9.936027049719492E-01, -1.788778552340326E+00, 9.936027049719492E-01, -1.788778552340326E+00, 9.872054099438985E-01 }, /* 3443 Hz */
-    { 9.936008587524974E-01, -1.788661907219067E+00, 9.936008587524974E-01, -1.788661907219067E+00, 9.872017175049947E-01 }, /* 3444 Hz */
-    { 9.935990125398618E-01, -1.788545231883022E+00, 9.935990125398618E-01, -1.788545231883022E+00, 9.871980250797237E-01 }, /* 3445 Hz */
-    { 9.935971663340427E-01, -1.788428526334304E+00, 9.935971663340427E-01, -1.788428526334304E+00, 9.871943326680854E-01 }, /* 3446 Hz */
-    { 9.935953201350399E-01, -1.788311790575024E+00, 9.935953201350399E-01, -1.788311790575024E+00, 9.871906402700799E-01 }, /* 3447 Hz */
-    { 9.935934739428535E-01, -1.788195024607292E+00, 9.935934739428535E-01, -1.788195024607292E+00, 9.871869478857069E-01 }, /* 3448 Hz */
-    { 9.935916277574832E-01, -1.788078228433222E+00, 9.935916277574832E-01, -1.788078228433222E+00, 9.871832555149664E-01 }, /* 3449 Hz */
-    { 9.935897815789291E-01, -1.787961402054926E+00, 9.935897815789291E-01, -1.787961402054926E+00, 9.871795631578582E-01 }, /* 3450 Hz */
-    { 9.935879354071914E-01, -1.787844545474517E+00, 9.935879354071914E-01, -1.787844545474517E+00, 9.871758708143827E-01 }, /* 3451 Hz */
-    { 9.935860892422695E-01, -1.787727658694110E+00, 9.935860892422695E-01, -1.787727658694110E+00, 9.871721784845391E-01 }, /* 3452 Hz */
-    { 9.935842430841639E-01, -1.787610741715817E+00, 9.935842430841639E-01, -1.787610741715817E+00, 9.871684861683279E-01 }, /* 3453 Hz */
-    { 9.935823969328741E-01, -1.787493794541754E+00, 9.935823969328741E-01, -1.787493794541754E+00, 9.871647938657482E-01 }, /* 3454 Hz */
-    { 9.935805507884005E-01, -1.787376817174037E+00, 9.935805507884005E-01, -1.787376817174037E+00, 9.871611015768009E-01 }, /* 3455 Hz */
-    { 9.935787046507427E-01, -1.787259809614781E+00, 9.935787046507427E-01, -1.787259809614781E+00, 9.871574093014854E-01 }, /* 3456 Hz */
-    { 9.935768585199007E-01, -1.787142771866101E+00, 9.935768585199007E-01, -1.787142771866101E+00, 9.871537170398015E-01 }, /* 3457 Hz */
-    { 9.935750123958745E-01, -1.787025703930116E+00, 9.935750123958745E-01, -1.787025703930116E+00, 9.871500247917491E-01 }, /* 3458 Hz */
-    { 9.935731662786642E-01, -1.786908605808943E+00, 9.935731662786642E-01, -1.786908605808943E+00, 9.871463325573284E-01 }, /* 3459 Hz */
-    { 9.935713201682695E-01, -1.786791477504698E+00, 9.935713201682695E-01, -1.786791477504698E+00, 9.871426403365391E-01 }, /* 3460 Hz */
-    { 9.935694740646904E-01, -1.786674319019500E+00, 9.935694740646904E-01, -1.786674319019500E+00, 9.871389481293809E-01 }, /* 3461 Hz */
-    { 9.935676279679270E-01, -1.786557130355469E+00, 9.935676279679270E-01, -1.786557130355469E+00, 9.871352559358539E-01 }, /* 3462 Hz */
-    { 9.935657818779792E-01, -1.786439911514724E+00, 9.935657818779792E-01, -1.786439911514724E+00, 9.871315637559583E-01 }, /* 3463 Hz */
-    { 9.935639357948467E-01, -1.786322662499384E+00, 9.935639357948467E-01, -1.786322662499384E+00, 9.871278715896934E-01 }, /* 3464 Hz */
-    { 9.935620897185297E-01, -1.786205383311569E+00, 9.935620897185297E-01, -1.786205383311569E+00, 9.871241794370593E-01 }, /* 3465 Hz */
-    { 9.935602436490283E-01, -1.786088073953401E+00, 9.935602436490283E-01, -1.786088073953401E+00, 9.871204872980566E-01 }, /* 3466 Hz */
-    { 9.935583975863421E-01, -1.785970734427002E+00, 9.935583975863421E-01, -1.785970734427002E+00, 9.871167951726842E-01 }, /* 3467 Hz */
-    { 9.935565515304710E-01, -1.785853364734491E+00, 9.935565515304710E-01, -1.785853364734491E+00, 9.871131030609419E-01 }, /* 3468 Hz */
-    { 9.935547054814154E-01, -1.785735964877993E+00, 9.935547054814154E-01, -1.785735964877993E+00, 9.871094109628309E-01 }, /* 3469 Hz */
-    { 9.935528594391749E-01, -1.785618534859630E+00, 9.935528594391749E-01, -1.785618534859630E+00, 9.871057188783499E-01 }, /* 3470 Hz */
-    { 9.935510134037496E-01, -1.785501074681526E+00, 9.935510134037496E-01, -1.785501074681526E+00, 9.871020268074993E-01 }, /* 3471 Hz */
-    { 9.935491673751393E-01, -1.785383584345803E+00, 9.935491673751393E-01, -1.785383584345803E+00, 9.870983347502786E-01 }, /* 3472 Hz */
-    { 9.935473213533441E-01, -1.785266063854588E+00, 9.935473213533441E-01, -1.785266063854588E+00, 9.870946427066882E-01 }, /* 3473 Hz */
-    { 9.935454753383641E-01, -1.785148513210005E+00, 9.935454753383641E-01, -1.785148513210005E+00, 9.870909506767283E-01 }, /* 3474 Hz */
-    { 9.935436293301987E-01, -1.785030932414178E+00, 9.935436293301987E-01, -1.785030932414178E+00, 9.870872586603974E-01 }, /* 3475 Hz */
-    { 9.935417833288483E-01, -1.784913321469234E+00, 9.935417833288483E-01, -1.784913321469234E+00, 9.870835666576967E-01 }, /* 3476 Hz */
-    { 9.935399373343130E-01, -1.784795680377300E+00, 9.935399373343130E-01, -1.784795680377300E+00, 9.870798746686260E-01 }, /* 3477 Hz */
-    { 9.935380913465922E-01, -1.784678009140502E+00, 9.935380913465922E-01, -1.784678009140502E+00, 9.870761826931844E-01 }, /* 3478 Hz */
-    { 9.935362453656863E-01, -1.784560307760969E+00, 9.935362453656863E-01, -1.784560307760969E+00, 9.870724907313726E-01 }, /* 3479 Hz */
-    { 9.935343993915948E-01, -1.784442576240826E+00, 9.935343993915948E-01, -1.784442576240826E+00, 9.870687987831896E-01 }, /* 3480 Hz */
-    { 9.935325534243182E-01, -1.784324814582205E+00, 9.935325534243182E-01, -1.784324814582205E+00, 9.870651068486365E-01 }, /* 3481 Hz */
-    { 9.935307074638563E-01, -1.784207022787233E+00, 9.935307074638563E-01, -1.784207022787233E+00, 9.870614149277126E-01 }, /* 3482 Hz */
-    { 9.935288615102086E-01, -1.784089200858039E+00, 9.935288615102086E-01, -1.784089200858039E+00, 9.870577230204172E-01 }, /* 3483 Hz */
-    { 9.935270155633755E-01, -1.783971348796754E+00, 9.935270155633755E-01, -1.783971348796754E+00, 9.870540311267511E-01 }, /* 3484 Hz */
-    { 9.935251696233571E-01, -1.783853466605509E+00, 9.935251696233571E-01, -1.783853466605509E+00, 9.870503392467143E-01 }, /* 3485 Hz */
-    { 9.935233236901526E-01, -1.783735554286434E+00, 9.935233236901526E-01, -1.783735554286434E+00, 9.870466473803052E-01 }, /* 3486 Hz */
-    { 9.935214777637629E-01, -1.783617611841660E+00, 9.935214777637629E-01, -1.783617611841660E+00, 9.870429555275257E-01 }, /* 3487 Hz */
-    { 9.935196318441872E-01, -1.783499639273321E+00, 9.935196318441872E-01, -1.783499639273321E+00, 9.870392636883745E-01 }, /* 3488 Hz */
-    { 9.935177859314259E-01, -1.783381636583548E+00, 9.935177859314259E-01, -1.783381636583548E+00, 9.870355718628518E-01 }, /* 3489 Hz */
-    { 9.935159400254787E-01, -1.783263603774475E+00, 9.935159400254787E-01, -1.783263603774475E+00, 9.870318800509574E-01 }, /* 3490 Hz */
-    { 9.935140941263457E-01, -1.783145540848235E+00, 9.935140941263457E-01, -1.783145540848235E+00, 9.870281882526915E-01 }, /* 3491 Hz */
-    { 9.935122482340267E-01, -1.783027447806961E+00, 9.935122482340267E-01, -1.783027447806961E+00, 9.870244964680535E-01 }, /* 3492 Hz */
-    { 9.935104023485217E-01, -1.782909324652790E+00, 9.935104023485217E-01, -1.782909324652790E+00, 9.870208046970435E-01 }, /* 3493 Hz */
-    { 9.935085564698308E-01, -1.782791171387855E+00, 9.935085564698308E-01, -1.782791171387855E+00, 9.870171129396617E-01 }, /* 3494 Hz */
-    { 9.935067105979536E-01, -1.782672988014292E+00, 9.935067105979536E-01, -1.782672988014292E+00, 9.870134211959072E-01 }, /* 3495 Hz */
-    { 9.935048647328905E-01, -1.782554774534238E+00, 9.935048647328905E-01, -1.782554774534238E+00, 9.870097294657809E-01 }, /* 3496 Hz */
-    { 9.935030188746412E-01, -1.782436530949829E+00, 9.935030188746412E-01, -1.782436530949829E+00, 9.870060377492824E-01 }, /* 3497 Hz */
-    { 9.935011730232056E-01, -1.782318257263201E+00, 9.935011730232056E-01, -1.782318257263201E+00, 9.870023460464112E-01 }, /* 3498 Hz */
-    { 9.934993271785838E-01, -1.782199953476494E+00, 9.934993271785838E-01, -1.782199953476494E+00, 9.869986543571676E-01 }, /* 3499 Hz */
-    { 9.934974813407758E-01, -1.782081619591845E+00, 9.934974813407758E-01, -1.782081619591845E+00, 9.869949626815515E-01 }, /* 3500 Hz */
-    { 9.934956355097810E-01, -1.781963255611391E+00, 9.934956355097810E-01, -1.781963255611391E+00, 9.869912710195621E-01 }, /* 3501 Hz */
-    { 9.934937896856002E-01, -1.781844861537274E+00, 9.934937896856002E-01, -1.781844861537274E+00, 9.869875793712004E-01 }, /* 3502 Hz */
-    { 9.934919438682327E-01, -1.781726437371632E+00, 9.934919438682327E-01, -1.781726437371632E+00, 9.869838877364654E-01 }, /* 3503 Hz */
-    { 9.934900980576788E-01, -1.781607983116606E+00, 9.934900980576788E-01, -1.781607983116606E+00, 9.869801961153577E-01 }, /* 3504 Hz */
-    { 9.934882522539382E-01, -1.781489498774335E+00, 9.934882522539382E-01, -1.781489498774335E+00, 9.869765045078764E-01 }, /* 3505 Hz */
-    { 9.934864064570110E-01, -1.781370984346961E+00, 9.934864064570110E-01, -1.781370984346961E+00, 9.869728129140221E-01 }, /* 3506 Hz */
-    { 9.934845606668973E-01, -1.781252439836627E+00, 9.934845606668973E-01, -1.781252439836627E+00, 9.869691213337946E-01 }, /* 3507 Hz */
-    { 9.934827148835967E-01, -1.781133865245474E+00, 9.934827148835967E-01, -1.781133865245474E+00, 9.869654297671935E-01 }, /* 3508 Hz */
-    { 9.934808691071093E-01, -1.781015260575644E+00, 9.934808691071093E-01, -1.781015260575644E+00, 9.869617382142186E-01 }, /* 3509 Hz */
-    { 9.934790233374353E-01, -1.780896625829282E+00, 9.934790233374353E-01, -1.780896625829282E+00, 9.869580466748706E-01 }, /* 3510 Hz */
-    { 9.934771775745740E-01, -1.780777961008530E+00, 9.934771775745740E-01, -1.780777961008530E+00, 9.869543551491480E-01 }, /* 3511 Hz */
-    { 9.934753318185261E-01, -1.780659266115533E+00, 9.934753318185261E-01, -1.780659266115533E+00, 9.869506636370522E-01 }, /* 3512 Hz */
-    { 9.934734860692913E-01, -1.780540541152436E+00, 9.934734860692913E-01, -1.780540541152436E+00, 9.869469721385826E-01 }, /* 3513 Hz */
-    { 9.934716403268692E-01, -1.780421786121384E+00, 9.934716403268692E-01, -1.780421786121384E+00, 9.869432806537384E-01 }, /* 3514 Hz */
-    { 9.934697945912601E-01, -1.780303001024522E+00, 9.934697945912601E-01, -1.780303001024522E+00, 9.869395891825201E-01 }, /* 3515 Hz */
-    { 9.934679488624638E-01, -1.780184185863996E+00, 9.934679488624638E-01, -1.780184185863996E+00, 9.869358977249276E-01 }, /* 3516 Hz */
-    { 9.934661031404803E-01, -1.780065340641955E+00, 9.934661031404803E-01, -1.780065340641955E+00, 9.869322062809607E-01 }, /* 3517 Hz */
-    { 9.934642574253097E-01, -1.779946465360544E+00, 9.934642574253097E-01, -1.779946465360544E+00, 9.869285148506195E-01 }, /* 3518 Hz */
-    { 9.934624117169519E-01, -1.779827560021912E+00, 9.934624117169519E-01, -1.779827560021912E+00, 9.869248234339039E-01 }, /* 3519 Hz */
-    { 9.934605660154066E-01, -1.779708624628207E+00, 9.934605660154066E-01, -1.779708624628207E+00, 9.869211320308131E-01 }, /* 3520 Hz */
-    { 9.934587203206738E-01, -1.779589659181577E+00, 9.934587203206738E-01, -1.779589659181577E+00, 9.869174406413477E-01 }, /* 3521 Hz */
-    { 9.934568746327538E-01, -1.779470663684172E+00, 9.934568746327538E-01, -1.779470663684172E+00, 9.869137492655076E-01 }, /* 3522 Hz */
-    { 9.934550289516462E-01, -1.779351638138141E+00, 9.934550289516462E-01, -1.779351638138141E+00, 9.869100579032923E-01 }, /* 3523 Hz */
-    { 9.934531832773511E-01, -1.779232582545636E+00, 9.934531832773511E-01, -1.779232582545636E+00, 9.869063665547022E-01 }, /* 3524 Hz */
-    { 9.934513376098684E-01, -1.779113496908806E+00, 9.934513376098684E-01, -1.779113496908806E+00, 9.869026752197367E-01 }, /* 3525 Hz */
-    { 9.934494919491982E-01, -1.778994381229804E+00, 9.934494919491982E-01, -1.778994381229804E+00, 9.868989838983964E-01 }, /* 3526 Hz */
-    { 9.934476462953402E-01, -1.778875235510781E+00, 9.934476462953402E-01, -1.778875235510781E+00, 9.868952925906804E-01 }, /* 3527 Hz */
-    { 9.934458006482944E-01, -1.778756059753888E+00, 9.934458006482944E-01, -1.778756059753888E+00, 9.868916012965887E-01 }, /* 3528 Hz */
-    { 9.934439550080607E-01, -1.778636853961279E+00, 9.934439550080607E-01, -1.778636853961279E+00, 9.868879100161214E-01 }, /* 3529 Hz */
-    { 9.934421093746393E-01, -1.778517618135108E+00, 9.934421093746393E-01, -1.778517618135108E+00, 9.868842187492786E-01 }, /* 3530 Hz */
-    { 9.934402637480301E-01, -1.778398352277528E+00, 9.934402637480301E-01, -1.778398352277528E+00, 9.868805274960601E-01 }, /* 3531 Hz */
-    { 9.934384181282327E-01, -1.778279056390693E+00, 9.934384181282327E-01, -1.778279056390693E+00, 9.868768362564655E-01 }, /* 3532 Hz */
-    { 9.934365725152475E-01, -1.778159730476758E+00, 9.934365725152475E-01, -1.778159730476758E+00, 9.868731450304951E-01 }, /* 3533 Hz */
-    { 9.934347269090742E-01, -1.778040374537880E+00, 9.934347269090742E-01, -1.778040374537880E+00, 9.868694538181484E-01 }, /* 3534 Hz */
-    { 9.934328813097127E-01, -1.777920988576213E+00, 9.934328813097127E-01, -1.777920988576213E+00, 9.868657626194255E-01 }, /* 3535 Hz */
-    { 9.934310357171633E-01, -1.777801572593914E+00, 9.934310357171633E-01, -1.777801572593914E+00, 9.868620714343266E-01 }, /* 3536 Hz */
-    { 9.934291901314256E-01, -1.777682126593139E+00, 9.934291901314256E-01, -1.777682126593139E+00, 9.868583802628512E-01 }, /* 3537 Hz */
-    { 9.934273445524996E-01, -1.777562650576047E+00, 9.934273445524996E-01, -1.777562650576047E+00, 9.868546891049992E-01 }, /* 3538 Hz */
-    { 9.934254989803852E-01, -1.777443144544794E+00, 9.934254989803852E-01, -1.777443144544794E+00, 9.868509979607705E-01 }, /* 3539 Hz */
-    { 9.934236534150828E-01, -1.777323608501541E+00, 9.934236534150828E-01, -1.777323608501541E+00, 9.868473068301655E-01 }, /* 3540 Hz */
-    { 9.934218078565917E-01, -1.777204042448444E+00, 9.934218078565917E-01, -1.777204042448444E+00, 9.868436157131835E-01 }, /* 3541 Hz */
-    { 9.934199623049123E-01, -1.777084446387664E+00, 9.934199623049123E-01, -1.777084446387664E+00, 9.868399246098245E-01 }, /* 3542 Hz */
-    { 9.934181167600443E-01, -1.776964820321361E+00, 9.934181167600443E-01, -1.776964820321361E+00, 9.868362335200886E-01 }, /* 3543 Hz */
-    { 9.934162712219877E-01, -1.776845164251694E+00, 9.934162712219877E-01, -1.776845164251694E+00, 9.868325424439754E-01 }, /* 3544 Hz */
-    { 9.934144256907426E-01, -1.776725478180826E+00, 9.934144256907426E-01, -1.776725478180826E+00, 9.868288513814851E-01 }, /* 3545 Hz */
-    { 9.934125801663088E-01, -1.776605762110917E+00, 9.934125801663088E-01, -1.776605762110917E+00, 9.868251603326177E-01 }, /* 3546 Hz */
-    { 9.934107346486862E-01, -1.776486016044130E+00, 9.934107346486862E-01, -1.776486016044130E+00, 9.868214692973725E-01 }, /* 3547 Hz */
-    { 9.934088891378751E-01, -1.776366239982626E+00, 9.934088891378751E-01, -1.776366239982626E+00, 9.868177782757501E-01 }, /* 3548 Hz */
-    { 9.934070436338751E-01, -1.776246433928568E+00, 9.934070436338751E-01, -1.776246433928568E+00, 9.868140872677502E-01 }, /* 3549 Hz */
-    { 9.934051981366860E-01, -1.776126597884121E+00, 9.934051981366860E-01, -1.776126597884121E+00, 9.868103962733721E-01 }, /* 3550 Hz */
-    { 9.934033526463083E-01, -1.776006731851448E+00, 9.934033526463083E-01, -1.776006731851448E+00, 9.868067052926166E-01 }, /* 3551 Hz */
-    { 9.934015071627414E-01, -1.775886835832713E+00, 9.934015071627414E-01, -1.775886835832713E+00, 9.868030143254829E-01 }, /* 3552 Hz */
-    { 9.933996616859857E-01, -1.775766909830083E+00, 9.933996616859857E-01, -1.775766909830083E+00, 9.867993233719714E-01 }, /* 3553 Hz */
-    { 9.933978162160408E-01, -1.775646953845720E+00, 9.933978162160408E-01, -1.775646953845720E+00, 9.867956324320817E-01 }, /* 3554 Hz */
-    { 9.933959707529071E-01, -1.775526967881793E+00, 9.933959707529071E-01, -1.775526967881793E+00, 9.867919415058142E-01 }, /* 3555 Hz */
-    { 9.933941252965839E-01, -1.775406951940467E+00, 9.933941252965839E-01, -1.775406951940467E+00, 9.867882505931678E-01 }, /* 3556 Hz */
-    { 9.933922798470717E-01, -1.775286906023910E+00, 9.933922798470717E-01, -1.775286906023910E+00, 9.867845596941434E-01 }, /* 3557 Hz */
-    { 9.933904344043701E-01, -1.775166830134288E+00, 9.933904344043701E-01, -1.775166830134288E+00, 9.867808688087403E-01 }, /* 3558 Hz */
-    { 9.933885889684791E-01, -1.775046724273770E+00, 9.933885889684791E-01, -1.775046724273770E+00, 9.867771779369583E-01 }, /* 3559 Hz */
-    { 9.933867435393988E-01, -1.774926588444524E+00, 9.933867435393988E-01, -1.774926588444524E+00, 9.867734870787976E-01 }, /* 3560 Hz */
-    { 9.933848981171294E-01, -1.774806422648721E+00, 9.933848981171294E-01, -1.774806422648721E+00, 9.867697962342588E-01 }, /* 3561 Hz */
-    { 9.933830527016702E-01, -1.774686226888527E+00, 9.933830527016702E-01, -1.774686226888527E+00, 9.867661054033403E-01 }, /* 3562 Hz */
-    { 9.933812072930216E-01, -1.774566001166115E+00, 9.933812072930216E-01, -1.774566001166115E+00, 9.867624145860432E-01 }, /* 3563 Hz */
-    { 9.933793618911835E-01, -1.774445745483654E+00, 9.933793618911835E-01, -1.774445745483654E+00, 9.867587237823670E-01 }, /* 3564 Hz */
-    { 9.933775164961557E-01, -1.774325459843316E+00, 9.933775164961557E-01, -1.774325459843316E+00, 9.867550329923114E-01 }, /* 3565 Hz */
-    { 9.933756711079382E-01, -1.774205144247271E+00, 9.933756711079382E-01, -1.774205144247271E+00, 9.867513422158765E-01 }, /* 3566 Hz */
-    { 9.933738257265309E-01, -1.774084798697692E+00, 9.933738257265309E-01, -1.774084798697692E+00, 9.867476514530618E-01 }, /* 3567 Hz */
-    { 9.933719803519340E-01, -1.773964423196752E+00, 9.933719803519340E-01, -1.773964423196752E+00, 9.867439607038679E-01 }, /* 3568 Hz */
-    { 9.933701349841473E-01, -1.773844017746623E+00, 9.933701349841473E-01, -1.773844017746623E+00, 9.867402699682946E-01 }, /* 3569 Hz */
-    { 9.933682896231706E-01, -1.773723582349479E+00, 9.933682896231706E-01, -1.773723582349479E+00, 9.867365792463412E-01 }, /* 3570 Hz */
-    { 9.933664442690040E-01, -1.773603117007495E+00, 9.933664442690040E-01, -1.773603117007495E+00, 9.867328885380080E-01 }, /* 3571 Hz */
-    { 9.933645989216476E-01, -1.773482621722844E+00, 9.933645989216476E-01, -1.773482621722844E+00, 9.867291978432953E-01 }, /* 3572 Hz */
-    { 9.933627535811009E-01, -1.773362096497702E+00, 9.933627535811009E-01, -1.773362096497702E+00, 9.867255071622019E-01 }, /* 3573 Hz */
-    { 9.933609082473644E-01, -1.773241541334245E+00, 9.933609082473644E-01, -1.773241541334245E+00, 9.867218164947289E-01 }, /* 3574 Hz */
-    { 9.933590629204376E-01, -1.773120956234647E+00, 9.933590629204376E-01, -1.773120956234647E+00, 9.867181258408753E-01 }, /* 3575 Hz */
-    { 9.933572176003207E-01, -1.773000341201087E+00, 9.933572176003207E-01, -1.773000341201087E+00, 9.867144352006414E-01 }, /* 3576 Hz */
-    { 9.933553722870136E-01, -1.772879696235740E+00, 9.933553722870136E-01, -1.772879696235740E+00, 9.867107445740273E-01 }, /* 3577 Hz */
-    { 9.933535269805164E-01, -1.772759021340786E+00, 9.933535269805164E-01, -1.772759021340786E+00, 9.867070539610328E-01 }, /* 3578 Hz */
-    { 9.933516816808284E-01, -1.772638316518401E+00, 9.933516816808284E-01, -1.772638316518401E+00, 9.867033633616569E-01 }, /* 3579 Hz */
-    { 9.933498363879504E-01, -1.772517581770764E+00, 9.933498363879504E-01, -1.772517581770764E+00, 9.866996727759008E-01 }, /* 3580 Hz */
-    { 9.933479911018819E-01, -1.772396817100055E+00, 9.933479911018819E-01, -1.772396817100055E+00, 9.866959822037638E-01 }, /* 3581 Hz */
-    { 9.933461458226229E-01, -1.772276022508452E+00, 9.933461458226229E-01, -1.772276022508452E+00, 9.866922916452459E-01 }, /* 3582 Hz */
-    { 9.933443005501734E-01, -1.772155197998137E+00, 9.933443005501734E-01, -1.772155197998137E+00, 9.866886011003468E-01 }, /* 3583 Hz */
-    { 9.933424552845335E-01, -1.772034343571290E+00, 9.933424552845335E-01, -1.772034343571290E+00, 9.866849105690669E-01 }, /* 3584 Hz */
-    { 9.933406100257026E-01, -1.771913459230091E+00, 9.933406100257026E-01, -1.771913459230091E+00, 9.866812200514052E-01 }, /* 3585 Hz */
-    { 9.933387647736812E-01, -1.771792544976722E+00, 9.933387647736812E-01, -1.771792544976722E+00, 9.866775295473624E-01 }, /* 3586 Hz */
-    { 9.933369195284693E-01, -1.771671600813367E+00, 9.933369195284693E-01, -1.771671600813367E+00, 9.866738390569385E-01 }, /* 3587 Hz */
-    { 9.933350742900663E-01, -1.771550626742206E+00, 9.933350742900663E-01, -1.771550626742206E+00, 9.866701485801326E-01 }, /* 3588 Hz */
-    { 9.933332290584725E-01, -1.771429622765424E+00, 9.933332290584725E-01, -1.771429622765424E+00, 9.866664581169451E-01 }, /* 3589 Hz */
-    { 9.933313838336879E-01, -1.771308588885204E+00, 9.933313838336879E-01, -1.771308588885204E+00, 9.866627676673758E-01 }, /* 3590 Hz */
-    { 9.933295386157124E-01, -1.771187525103729E+00, 9.933295386157124E-01, -1.771187525103729E+00, 9.866590772314248E-01 }, /* 3591 Hz */
-    { 9.933276934045460E-01, -1.771066431423186E+00, 9.933276934045460E-01, -1.771066431423186E+00, 9.866553868090919E-01 }, /* 3592 Hz */
-    { 9.933258482001884E-01, -1.770945307845758E+00, 9.933258482001884E-01, -1.770945307845758E+00, 9.866516964003769E-01 }, /* 3593 Hz */
-    { 9.933240030026397E-01, -1.770824154373632E+00, 9.933240030026397E-01, -1.770824154373632E+00, 9.866480060052794E-01 }, /* 3594 Hz */
-    { 9.933221578119000E-01, -1.770702971008993E+00, 9.933221578119000E-01, -1.770702971008993E+00, 9.866443156238001E-01 }, /* 3595 Hz */
-    { 9.933203126279692E-01, -1.770581757754029E+00, 9.933203126279692E-01, -1.770581757754029E+00, 9.866406252559383E-01 }, /* 3596 Hz */
-    { 9.933184674508470E-01, -1.770460514610926E+00, 9.933184674508470E-01, -1.770460514610926E+00, 9.866369349016939E-01 }, /* 3597 Hz */
-    { 9.933166222805335E-01, -1.770339241581872E+00, 9.933166222805335E-01, -1.770339241581872E+00, 9.866332445610670E-01 }, /* 3598 Hz */
-    { 9.933147771170286E-01, -1.770217938669056E+00, 9.933147771170286E-01, -1.770217938669056E+00, 9.866295542340573E-01 }, /* 3599 Hz */
-    { 9.933129319603324E-01, -1.770096605874665E+00, 9.933129319603324E-01, -1.770096605874665E+00, 9.866258639206649E-01 }, /* 3600 Hz */
-    { 9.933110868104448E-01, -1.769975243200890E+00, 9.933110868104448E-01, -1.769975243200890E+00, 9.866221736208896E-01 }, /* 3601 Hz */
-    { 9.933092416673657E-01, -1.769853850649919E+00, 9.933092416673657E-01, -1.769853850649919E+00, 9.866184833347313E-01 }, /* 3602 Hz */
-    { 9.933073965310950E-01, -1.769732428223943E+00, 9.933073965310950E-01, -1.769732428223943E+00, 9.866147930621900E-01 }, /* 3603 Hz */
-    { 9.933055514016329E-01, -1.769610975925154E+00, 9.933055514016329E-01, -1.769610975925154E+00, 9.866111028032658E-01 }, /* 3604 Hz */
-    { 9.933037062789789E-01, -1.769489493755740E+00, 9.933037062789789E-01, -1.769489493755740E+00, 9.866074125579578E-01 }, /* 3605 Hz */
-    { 9.933018611631333E-01, -1.769367981717896E+00, 9.933018611631333E-01, -1.769367981717896E+00, 9.866037223262667E-01 }, /* 3606 Hz */
-    { 9.933000160540961E-01, -1.769246439813812E+00, 9.933000160540961E-01, -1.769246439813812E+00, 9.866000321081922E-01 }, /* 3607 Hz */
-    { 9.932981709518670E-01, -1.769124868045681E+00, 9.932981709518670E-01, -1.769124868045681E+00, 9.865963419037340E-01 }, /* 3608 Hz */
-    { 9.932963258564462E-01, -1.769003266415698E+00, 9.932963258564462E-01, -1.769003266415698E+00, 9.865926517128925E-01 }, /* 3609 Hz */
-    { 9.932944807678333E-01, -1.768881634926054E+00, 9.932944807678333E-01, -1.768881634926054E+00, 9.865889615356667E-01 }, /* 3610 Hz */
-    { 9.932926356860285E-01, -1.768759973578945E+00, 9.932926356860285E-01, -1.768759973578945E+00, 9.865852713720571E-01 }, /* 3611 Hz */
-    { 9.932907906110319E-01, -1.768638282376566E+00, 9.932907906110319E-01, -1.768638282376566E+00, 9.865815812220637E-01 }, /* 3612 Hz */
-    { 9.932889455428431E-01, -1.768516561321110E+00, 9.932889455428431E-01, -1.768516561321110E+00, 9.865778910856862E-01 }, /* 3613 Hz */
-    { 9.932871004814622E-01, -1.768394810414775E+00, 9.932871004814622E-01, -1.768394810414775E+00, 9.865742009629244E-01 }, /* 3614 Hz */
-    { 9.932852554268891E-01, -1.768273029659756E+00, 9.932852554268891E-01, -1.768273029659756E+00, 9.865705108537781E-01 }, /* 3615 Hz */
-    { 9.932834103791239E-01, -1.768151219058251E+00, 9.932834103791239E-01, -1.768151219058251E+00, 9.865668207582479E-01 }, /* 3616 Hz */
-    { 9.932815653381665E-01, -1.768029378612455E+00, 9.932815653381665E-01, -1.768029378612455E+00, 9.865631306763329E-01 }, /* 3617 Hz */
-    { 9.932797203040166E-01, -1.767907508324568E+00, 9.932797203040166E-01, -1.767907508324568E+00, 9.865594406080331E-01 }, /* 3618 Hz */
-    { 9.932778752766747E-01, -1.767785608196787E+00, 9.932778752766747E-01, -1.767785608196787E+00, 9.865557505533493E-01 }, /* 3619 Hz */
-    { 9.932760302561402E-01, -1.767663678231311E+00, 9.932760302561402E-01, -1.767663678231311E+00, 9.865520605122804E-01 }, /* 3620 Hz */
-    { 9.932741852424131E-01, -1.767541718430339E+00, 9.932741852424131E-01, -1.767541718430339E+00, 9.865483704848261E-01 }, /* 3621 Hz */
-    { 9.932723402354937E-01, -1.767419728796072E+00, 9.932723402354937E-01, -1.767419728796072E+00, 9.865446804709874E-01 }, /* 3622 Hz */
-    { 9.932704952353817E-01, -1.767297709330708E+00, 9.932704952353817E-01, -1.767297709330708E+00, 9.865409904707634E-01 }, /* 3623 Hz */
-    { 9.932686502420771E-01, -1.767175660036449E+00, 9.932686502420771E-01, -1.767175660036449E+00, 9.865373004841542E-01 }, /* 3624 Hz */
-    { 9.932668052555798E-01, -1.767053580915497E+00, 9.932668052555798E-01, -1.767053580915497E+00, 9.865336105111595E-01 }, /* 3625 Hz */
-    { 9.932649602758900E-01, -1.766931471970052E+00, 9.932649602758900E-01, -1.766931471970052E+00, 9.865299205517799E-01 }, /* 3626 Hz */
-    { 9.932631153030071E-01, -1.766809333202318E+00, 9.932631153030071E-01, -1.766809333202318E+00, 9.865262306060143E-01 }, /* 3627 Hz */
-    { 9.932612703369316E-01, -1.766687164614496E+00, 9.932612703369316E-01, -1.766687164614496E+00, 9.865225406738631E-01 }, /* 3628 Hz */
-    { 9.932594253776632E-01, -1.766564966208791E+00, 9.932594253776632E-01, -1.766564966208791E+00, 9.865188507553264E-01 }, /* 3629 Hz */
-    { 9.932575804252020E-01, -1.766442737987406E+00, 9.932575804252020E-01, -1.766442737987406E+00, 9.865151608504039E-01 }, /* 3630 Hz */
-    { 9.932557354795479E-01, -1.766320479952545E+00, 9.932557354795479E-01, -1.766320479952545E+00, 9.865114709590959E-01 }, /* 3631 Hz */
-    { 9.932538905407006E-01, -1.766198192106413E+00, 9.932538905407006E-01, -1.766198192106413E+00, 9.865077810814011E-01 }, /* 3632 Hz */
-    { 9.932520456086602E-01, -1.766075874451215E+00, 9.932520456086602E-01, -1.766075874451215E+00, 9.865040912173204E-01 }, /* 3633 Hz */
-    { 9.932502006834270E-01, -1.765953526989157E+00, 9.932502006834270E-01, -1.765953526989157E+00, 9.865004013668539E-01 }, /* 3634 Hz */
-    { 9.932483557650004E-01, -1.765831149722445E+00, 9.932483557650004E-01, -1.765831149722445E+00, 9.864967115300007E-01 }, /* 3635 Hz */
-    { 9.932465108533808E-01, -1.765708742653287E+00, 9.932465108533808E-01, -1.765708742653287E+00, 9.864930217067616E-01 }, /* 3636 Hz */
-    { 9.932446659485678E-01, -1.765586305783889E+00, 9.932446659485678E-01, -1.765586305783889E+00, 9.864893318971355E-01 }, /* 3637 Hz */
-    { 9.932428210505613E-01, -1.765463839116458E+00, 9.932428210505613E-01, -1.765463839116458E+00, 9.864856421011226E-01 }, /* 3638 Hz */
-    { 9.932409761593617E-01, -1.765341342653205E+00, 9.932409761593617E-01, -1.765341342653205E+00, 9.864819523187234E-01 }, /* 3639 Hz */
-    { 9.932391312749687E-01, -1.765218816396336E+00, 9.932391312749687E-01, -1.765218816396336E+00, 9.864782625499373E-01 }, /* 3640 Hz */
-    { 9.932372863973822E-01, -1.765096260348062E+00, 9.932372863973822E-01, -1.765096260348062E+00, 9.864745727947644E-01 }, /* 3641 Hz */
-    { 9.932354415266020E-01, -1.764973674510592E+00, 9.932354415266020E-01, -1.764973674510592E+00, 9.864708830532041E-01 }, /* 3642 Hz */
-    { 9.932335966626284E-01, -1.764851058886136E+00, 9.932335966626284E-01, -1.764851058886136E+00, 9.864671933252569E-01 }, /* 3643 Hz */
-    { 9.932317518054614E-01, -1.764728413476906E+00, 9.932317518054614E-01, -1.764728413476906E+00, 9.864635036109228E-01 }, /* 3644 Hz */
-    { 9.932299069551004E-01, -1.764605738285112E+00, 9.932299069551004E-01, -1.764605738285112E+00, 9.864598139102008E-01 }, /* 3645 Hz */
-    { 9.932280621115459E-01, -1.764483033312967E+00, 9.932280621115459E-01, -1.764483033312967E+00, 9.864561242230918E-01 }, /* 3646 Hz */
-    { 9.932262172747974E-01, -1.764360298562682E+00, 9.932262172747974E-01, -1.764360298562682E+00, 9.864524345495949E-01 }, /* 3647 Hz */
-    { 9.932243724448555E-01, -1.764237534036471E+00, 9.932243724448555E-01, -1.764237534036471E+00, 9.864487448897110E-01 }, /* 3648 Hz */
-    { 9.932225276217194E-01, -1.764114739736546E+00, 9.932225276217194E-01, -1.764114739736546E+00, 9.864450552434387E-01 }, /* 3649 Hz */
-    { 9.932206828053896E-01, -1.763991915665122E+00, 9.932206828053896E-01, -1.763991915665122E+00, 9.864413656107791E-01 }, /* 3650 Hz */
-    { 9.932188379958655E-01, -1.763869061824412E+00, 9.932188379958655E-01, -1.763869061824412E+00, 9.864376759917310E-01 }, /* 3651 Hz */
-    { 9.932169931931475E-01, -1.763746178216632E+00, 9.932169931931475E-01, -1.763746178216632E+00, 9.864339863862950E-01 }, /* 3652 Hz */
-    { 9.932151483972357E-01, -1.763623264843997E+00, 9.932151483972357E-01, -1.763623264843997E+00, 9.864302967944714E-01 }, /* 3653 Hz */
-    { 9.932133036081295E-01, -1.763500321708723E+00, 9.932133036081295E-01, -1.763500321708723E+00, 9.864266072162591E-01 }, /* 3654 Hz */
-    { 9.932114588258293E-01, -1.763377348813026E+00, 9.932114588258293E-01, -1.763377348813026E+00, 9.864229176516586E-01 }, /* 3655 Hz */
-    { 9.932096140503349E-01, -1.763254346159123E+00, 9.932096140503349E-01, -1.763254346159123E+00, 9.864192281006698E-01 }, /* 3656 Hz */
-    { 9.932077692816461E-01, -1.763131313749230E+00, 9.932077692816461E-01, -1.763131313749230E+00, 9.864155385632922E-01 }, /* 3657 Hz */
-    { 9.932059245197631E-01, -1.763008251585567E+00, 9.932059245197631E-01, -1.763008251585567E+00, 9.864118490395262E-01 }, /* 3658 Hz */
-    { 9.932040797646855E-01, -1.762885159670350E+00, 9.932040797646855E-01, -1.762885159670350E+00, 9.864081595293710E-01 }, /* 3659 Hz */
-    { 9.932022350164137E-01, -1.762762038005800E+00, 9.932022350164137E-01, -1.762762038005800E+00, 9.864044700328274E-01 }, /* 3660 Hz */
-    { 9.932003902749473E-01, -1.762638886594135E+00, 9.932003902749473E-01, -1.762638886594135E+00, 9.864007805498947E-01 }, /* 3661 Hz */
-    { 9.931985455402865E-01, -1.762515705437576E+00, 9.931985455402865E-01, -1.762515705437576E+00, 9.863970910805731E-01 }, /* 3662 Hz */
-    { 9.931967008124311E-01, -1.762392494538341E+00, 9.931967008124311E-01, -1.762392494538341E+00, 9.863934016248621E-01 }, /* 3663 Hz */
-    { 9.931948560913810E-01, -1.762269253898653E+00, 9.931948560913810E-01, -1.762269253898653E+00, 9.863897121827621E-01 }, /* 3664 Hz */
-    { 9.931930113771364E-01, -1.762145983520733E+00, 9.931930113771364E-01, -1.762145983520733E+00, 9.863860227542729E-01 }, /* 3665 Hz */
-    { 9.931911666696969E-01, -1.762022683406802E+00, 9.931911666696969E-01, -1.762022683406802E+00, 9.863823333393937E-01 }, /* 3666 Hz */
-    { 9.931893219690627E-01, -1.761899353559082E+00, 9.931893219690627E-01, -1.761899353559082E+00, 9.863786439381255E-01 }, /* 3667 Hz */
-    { 9.931874772752336E-01, -1.761775993979797E+00, 9.931874772752336E-01, -1.761775993979797E+00, 9.863749545504672E-01 }, /* 3668 Hz */
-    { 9.931856325882098E-01, -1.761652604671170E+00, 9.931856325882098E-01, -1.761652604671170E+00, 9.863712651764196E-01 }, /* 3669 Hz */
-    { 9.931837879079909E-01, -1.761529185635425E+00, 9.931837879079909E-01, -1.761529185635425E+00, 9.863675758159818E-01 }, /* 3670 Hz */
-    { 9.931819432345771E-01, -1.761405736874786E+00, 9.931819432345771E-01, -1.761405736874786E+00, 9.863638864691542E-01 }, /* 3671 Hz */
-    { 9.931800985679682E-01, -1.761282258391477E+00, 9.931800985679682E-01, -1.761282258391477E+00, 9.863601971359364E-01 }, /* 3672 Hz */
-    { 9.931782539081644E-01, -1.761158750187725E+00, 9.931782539081644E-01, -1.761158750187725E+00, 9.863565078163288E-01 }, /* 3673 Hz */
-    { 9.931764092551653E-01, -1.761035212265754E+00, 9.931764092551653E-01, -1.761035212265754E+00, 9.863528185103305E-01 }, /* 3674 Hz */
-    { 9.931745646089710E-01, -1.760911644627792E+00, 9.931745646089710E-01, -1.760911644627792E+00, 9.863491292179420E-01 }, /* 3675 Hz */
-    { 9.931727199695818E-01, -1.760788047276065E+00, 9.931727199695818E-01, -1.760788047276065E+00, 9.863454399391636E-01 }, /* 3676 Hz */
-    { 9.931708753369970E-01, -1.760664420212800E+00, 9.931708753369970E-01, -1.760664420212800E+00, 9.863417506739940E-01 }, /* 3677 Hz */
-    { 9.931690307112169E-01, -1.760540763440225E+00, 9.931690307112169E-01, -1.760540763440225E+00, 9.863380614224337E-01 }, /* 3678 Hz */
-    { 9.931671860922415E-01, -1.760417076960569E+00, 9.931671860922415E-01, -1.760417076960569E+00, 9.863343721844831E-01 }, /* 3679 Hz */
-    { 9.931653414800706E-01, -1.760293360776060E+00, 9.931653414800706E-01, -1.760293360776060E+00, 9.863306829601413E-01 }, /* 3680 Hz */
-    { 9.931634968747043E-01, -1.760169614888928E+00, 9.931634968747043E-01, -1.760169614888928E+00, 9.863269937494086E-01 }, /* 3681 Hz */
-    { 9.931616522761423E-01, -1.760045839301402E+00, 9.931616522761423E-01, -1.760045839301402E+00, 9.863233045522846E-01 }, /* 3682 Hz */
-    { 9.931598076843849E-01, -1.759922034015714E+00, 9.931598076843849E-01, -1.759922034015714E+00, 9.863196153687699E-01 }, /* 3683 Hz */
-    { 9.931579630994317E-01, -1.759798199034093E+00, 9.931579630994317E-01, -1.759798199034093E+00, 9.863159261988634E-01 }, /* 3684 Hz */
-    { 9.931561185212830E-01, -1.759674334358771E+00, 9.931561185212830E-01, -1.759674334358771E+00, 9.863122370425661E-01 }, /* 3685 Hz */
-    { 9.931542739499384E-01, -1.759550439991979E+00, 9.931542739499384E-01, -1.759550439991979E+00, 9.863085478998768E-01 }, /* 3686 Hz */
-    { 9.931524293853982E-01, -1.759426515935951E+00, 9.931524293853982E-01, -1.759426515935951E+00, 9.863048587707963E-01 }, /* 3687 Hz */
-    { 9.931505848276621E-01, -1.759302562192919E+00, 9.931505848276621E-01, -1.759302562192919E+00, 9.863011696553241E-01 }, /* 3688 Hz */
-    { 9.931487402767299E-01, -1.759178578765116E+00, 9.931487402767299E-01, -1.759178578765116E+00, 9.862974805534599E-01 }, /* 3689 Hz */
-    { 9.931468957326021E-01, -1.759054565654776E+00, 9.931468957326021E-01, -1.759054565654776E+00, 9.862937914652041E-01 }, /* 3690 Hz */
-    { 9.931450511952781E-01, -1.758930522864134E+00, 9.931450511952781E-01, -1.758930522864134E+00, 9.862901023905561E-01 }, /* 3691 Hz */
-    { 9.931432066647581E-01, -1.758806450395423E+00, 9.931432066647581E-01, -1.758806450395423E+00, 9.862864133295162E-01 }, /* 3692 Hz */
-    { 9.931413621410422E-01, -1.758682348250881E+00, 9.931413621410422E-01, -1.758682348250881E+00, 9.862827242820844E-01 }, /* 3693 Hz */
-    { 9.931395176241298E-01, -1.758558216432741E+00, 9.931395176241298E-01, -1.758558216432741E+00, 9.862790352482596E-01 }, /* 3694 Hz */
-    { 9.931376731140215E-01, -1.758434054943242E+00, 9.931376731140215E-01, -1.758434054943242E+00, 9.862753462280429E-01 }, /* 3695 Hz */
-    { 9.931358286107167E-01, -1.758309863784619E+00, 9.931358286107167E-01, -1.758309863784619E+00, 9.862716572214334E-01 }, /* 3696 Hz */
-    { 9.931339841142157E-01, -1.758185642959109E+00, 9.931339841142157E-01, -1.758185642959109E+00, 9.862679682284314E-01 }, /* 3697 Hz */
-    { 9.931321396245186E-01, -1.758061392468952E+00, 9.931321396245186E-01, -1.758061392468952E+00, 9.862642792490373E-01 }, /* 3698 Hz */
-    { 9.931302951416249E-01, -1.757937112316384E+00, 9.931302951416249E-01, -1.757937112316384E+00, 9.862605902832497E-01 }, /* 3699 Hz */
-    { 9.931284506655349E-01, -1.757812802503646E+00, 9.931284506655349E-01, -1.757812802503646E+00, 9.862569013310698E-01 }, /* 3700 Hz */
-    { 9.931266061962482E-01, -1.757688463032975E+00, 9.931266061962482E-01, -1.757688463032975E+00, 9.862532123924963E-01 }, /* 3701 Hz */
-    { 9.931247617337652E-01, -1.757564093906612E+00, 9.931247617337652E-01, -1.757564093906612E+00, 9.862495234675304E-01 }, /* 3702 Hz */
-    { 9.931229172780853E-01, -1.757439695126798E+00, 9.931229172780853E-01, -1.757439695126798E+00, 9.862458345561707E-01 }, /* 3703 Hz */
-    { 9.931210728292090E-01, -1.757315266695773E+00, 9.931210728292090E-01, -1.757315266695773E+00, 9.862421456584181E-01 }, /* 3704 Hz */
-    { 9.931192283871360E-01, -1.757190808615778E+00, 9.931192283871360E-01, -1.757190808615778E+00, 9.862384567742719E-01 }, /* 3705 Hz */
-    { 9.931173839518661E-01, -1.757066320889055E+00, 9.931173839518661E-01, -1.757066320889055E+00, 9.862347679037322E-01 }, /* 3706 Hz */
-    { 9.931155395233996E-01, -1.756941803517847E+00, 9.931155395233996E-01, -1.756941803517847E+00, 9.862310790467992E-01 }, /* 3707 Hz */
-    { 9.931136951017361E-01, -1.756817256504396E+00, 9.931136951017361E-01, -1.756817256504396E+00, 9.862273902034722E-01 }, /* 3708 Hz */
-    { 9.931118506868757E-01, -1.756692679850946E+00, 9.931118506868757E-01, -1.756692679850946E+00, 9.862237013737514E-01 }, /* 3709 Hz */
-    { 9.931100062788183E-01, -1.756568073559741E+00, 9.931100062788183E-01, -1.756568073559741E+00, 9.862200125576366E-01 }, /* 3710 Hz */
-    { 9.931081618775640E-01, -1.756443437633024E+00, 9.931081618775640E-01, -1.756443437633024E+00, 9.862163237551280E-01 }, /* 3711 Hz */
-    { 9.931063174831128E-01, -1.756318772073041E+00, 9.931063174831128E-01, -1.756318772073041E+00, 9.862126349662257E-01 }, /* 3712 Hz */
-    { 9.931044730954642E-01, -1.756194076882037E+00, 9.931044730954642E-01, -1.756194076882037E+00, 9.862089461909285E-01 }, /* 3713 Hz */
-    { 9.931026287146186E-01, -1.756069352062257E+00, 9.931026287146186E-01, -1.756069352062257E+00, 9.862052574292373E-01 }, /* 3714 Hz */
-    { 9.931007843405758E-01, -1.755944597615949E+00, 9.931007843405758E-01, -1.755944597615949E+00, 9.862015686811516E-01 }, /* 3715 Hz */
-    { 9.930989399733359E-01, -1.755819813545358E+00, 9.930989399733359E-01, -1.755819813545358E+00, 9.861978799466717E-01 }, /* 3716 Hz */
-    { 9.930970956128985E-01, -1.755694999852733E+00, 9.930970956128985E-01, -1.755694999852733E+00, 9.861941912257970E-01 }, /* 3717 Hz */
-    { 9.930952512592638E-01, -1.755570156540320E+00, 9.930952512592638E-01, -1.755570156540320E+00, 9.861905025185276E-01 }, /* 3718 Hz */
-    { 9.930934069124316E-01, -1.755445283610369E+00, 9.930934069124316E-01, -1.755445283610369E+00, 9.861868138248633E-01 }, /* 3719 Hz */
-    { 9.930915625724022E-01, -1.755320381065128E+00, 9.930915625724022E-01, -1.755320381065128E+00, 9.861831251448043E-01 }, /* 3720 Hz */
-    { 9.930897182391750E-01, -1.755195448906846E+00, 9.930897182391750E-01, -1.755195448906846E+00, 9.861794364783500E-01 }, /* 3721 Hz */
-    { 9.930878739127503E-01, -1.755070487137774E+00, 9.930878739127503E-01, -1.755070487137774E+00, 9.861757478255007E-01 }, /* 3722 Hz */
-    { 9.930860295931282E-01, -1.754945495760161E+00, 9.930860295931282E-01, -1.754945495760161E+00, 9.861720591862564E-01 }, /* 3723 Hz */
-    { 9.930841852803084E-01, -1.754820474776258E+00, 9.930841852803084E-01, -1.754820474776258E+00, 9.861683705606168E-01 }, /* 3724 Hz */
-    { 9.930823409742907E-01, -1.754695424188317E+00, 9.930823409742907E-01, -1.754695424188317E+00, 9.861646819485814E-01 }, /* 3725 Hz */
-    { 9.930804966750755E-01, -1.754570343998589E+00, 9.930804966750755E-01, -1.754570343998589E+00, 9.861609933501509E-01 }, /* 3726 Hz */
-    { 9.930786523826625E-01, -1.754445234209327E+00, 9.930786523826625E-01, -1.754445234209327E+00, 9.861573047653249E-01 }, /* 3727 Hz */
-    { 9.930768080970512E-01, -1.754320094822783E+00, 9.930768080970512E-01, -1.754320094822783E+00, 9.861536161941025E-01 }, /* 3728 Hz */
-    { 9.930749638182425E-01, -1.754194925841212E+00, 9.930749638182425E-01, -1.754194925841212E+00, 9.861499276364849E-01 }, /* 3729 Hz */
-    { 9.930731195462354E-01, -1.754069727266865E+00, 9.930731195462354E-01, -1.754069727266865E+00, 9.861462390924709E-01 }, /* 3730 Hz */
-    { 9.930712752810307E-01, -1.753944499101998E+00, 9.930712752810307E-01, -1.753944499101998E+00, 9.861425505620613E-01 }, /* 3731 Hz */
-    { 9.930694310226277E-01, -1.753819241348866E+00, 9.930694310226277E-01, -1.753819241348866E+00, 9.861388620452554E-01 }, /* 3732 Hz */
-    { 9.930675867710268E-01, -1.753693954009724E+00, 9.930675867710268E-01, -1.753693954009724E+00, 9.861351735420536E-01 }, /* 3733 Hz */
-    { 9.930657425262275E-01, -1.753568637086828E+00, 9.930657425262275E-01, -1.753568637086828E+00, 9.861314850524550E-01 }, /* 3734 Hz */
-    { 9.930638982882302E-01, -1.753443290582434E+00, 9.930638982882302E-01, -1.753443290582434E+00, 9.861277965764603E-01 }, /* 3735 Hz */
-    { 9.930620540570344E-01, -1.753317914498798E+00, 9.930620540570344E-01, -1.753317914498798E+00, 9.861241081140688E-01 }, /* 3736 Hz */
-    { 9.930602098326405E-01, -1.753192508838178E+00, 9.930602098326405E-01, -1.753192508838178E+00, 9.861204196652811E-01 }, /* 3737 Hz */
-    { 9.930583656150481E-01, -1.753067073602832E+00, 9.930583656150481E-01, -1.753067073602832E+00, 9.861167312300962E-01 }, /* 3738 Hz */
-    { 9.930565214042574E-01, -1.752941608795018E+00, 9.930565214042574E-01, -1.752941608795018E+00, 9.861130428085148E-01 }, /* 3739 Hz */
-    { 9.930546772002682E-01, -1.752816114416995E+00, 9.930546772002682E-01, -1.752816114416995E+00, 9.861093544005364E-01 }, /* 3740 Hz */
-    { 9.930528330030806E-01, -1.752690590471022E+00, 9.930528330030806E-01, -1.752690590471022E+00, 9.861056660061611E-01 }, /* 3741 Hz */
-    { 9.930509888126942E-01, -1.752565036959359E+00, 9.930509888126942E-01, -1.752565036959359E+00, 9.861019776253883E-01 }, /* 3742 Hz */
-    { 9.930491446291093E-01, -1.752439453884266E+00, 9.930491446291093E-01, -1.752439453884266E+00, 9.860982892582186E-01 }, /* 3743 Hz */
-    { 9.930473004523257E-01, -1.752313841248004E+00, 9.930473004523257E-01, -1.752313841248004E+00, 9.860946009046514E-01 }, /* 3744 Hz */
-    { 9.930454562823434E-01, -1.752188199052834E+00, 9.930454562823434E-01, -1.752188199052834E+00, 9.860909125646868E-01 }, /* 3745 Hz */
-    { 9.930436121191623E-01, -1.752062527301018E+00, 9.930436121191623E-01, -1.752062527301018E+00, 9.860872242383245E-01 }, /* 3746 Hz */
-    { 9.930417679627823E-01, -1.751936825994818E+00, 9.930417679627823E-01, -1.751936825994818E+00, 9.860835359255646E-01 }, /* 3747 Hz */
-    { 9.930399238132036E-01, -1.751811095136497E+00, 9.930399238132036E-01, -1.751811095136497E+00, 9.860798476264072E-01 }, /* 3748 Hz */
-    { 9.930380796704259E-01, -1.751685334728318E+00, 9.930380796704259E-01, -1.751685334728318E+00, 9.860761593408518E-01 }, /* 3749 Hz */
-    { 9.930362355344494E-01, -1.751559544772545E+00, 9.930362355344494E-01, -1.751559544772545E+00, 9.860724710688988E-01 }, /* 3750 Hz */
-    { 9.930343914052737E-01, -1.751433725271442E+00, 9.930343914052737E-01, -1.751433725271442E+00, 9.860687828105474E-01 }, /* 3751 Hz */
-    { 9.930325472828989E-01, -1.751307876227274E+00, 9.930325472828989E-01, -1.751307876227274E+00, 9.860650945657978E-01 }, /* 3752 Hz */
-    { 9.930307031673252E-01, -1.751181997642306E+00, 9.930307031673252E-01, -1.751181997642306E+00, 9.860614063346504E-01 }, /* 3753 Hz */
-    { 9.930288590585521E-01, -1.751056089518804E+00, 9.930288590585521E-01, -1.751056089518804E+00, 9.860577181171042E-01 }, /* 3754 Hz */
-    { 9.930270149565799E-01, -1.750930151859034E+00, 9.930270149565799E-01, -1.750930151859034E+00, 9.860540299131597E-01 }, /* 3755 Hz */
-    { 9.930251708614083E-01, -1.750804184665263E+00, 9.930251708614083E-01, -1.750804184665263E+00, 9.860503417228166E-01 }, /* 3756 Hz */
-    { 9.930233267730375E-01, -1.750678187939758E+00, 9.930233267730375E-01, -1.750678187939758E+00, 9.860466535460750E-01 }, /* 3757 Hz */
-    { 9.930214826914674E-01, -1.750552161684787E+00, 9.930214826914674E-01, -1.750552161684787E+00, 9.860429653829348E-01 }, /* 3758 Hz */
-    { 9.930196386166977E-01, -1.750426105902618E+00, 9.930196386166977E-01, -1.750426105902618E+00, 9.860392772333955E-01 }, /* 3759 Hz */
-    { 9.930177945487287E-01, -1.750300020595520E+00, 9.930177945487287E-01, -1.750300020595520E+00, 9.860355890974575E-01 }, /* 3760 Hz */
-    { 9.930159504875601E-01, -1.750173905765761E+00, 9.930159504875601E-01, -1.750173905765761E+00, 9.860319009751202E-01 }, /* 3761 Hz */
-    { 9.930141064331919E-01, -1.750047761415612E+00, 9.930141064331919E-01, -1.750047761415612E+00, 9.860282128663838E-01 }, /* 3762 Hz */
-    { 9.930122623856241E-01, -1.749921587547344E+00, 9.930122623856241E-01, -1.749921587547344E+00, 9.860245247712482E-01 }, /* 3763 Hz */
-    { 9.930104183448565E-01, -1.749795384163225E+00, 9.930104183448565E-01, -1.749795384163225E+00, 9.860208366897130E-01 }, /* 3764 Hz */
-    { 9.930085743108893E-01, -1.749669151265528E+00, 9.930085743108893E-01, -1.749669151265528E+00, 9.860171486217786E-01 }, /* 3765 Hz */
-    { 9.930067302837223E-01, -1.749542888856525E+00, 9.930067302837223E-01, -1.749542888856525E+00, 9.860134605674447E-01 }, /* 3766 Hz */
-    { 9.930048862633555E-01, -1.749416596938487E+00, 9.930048862633555E-01, -1.749416596938487E+00, 9.860097725267110E-01 }, /* 3767 Hz */
-    { 9.930030422497887E-01, -1.749290275513688E+00, 9.930030422497887E-01, -1.749290275513688E+00, 9.860060844995775E-01 }, /* 3768 Hz */
-    { 9.930011982430222E-01, -1.749163924584401E+00, 9.930011982430222E-01, -1.749163924584401E+00, 9.860023964860445E-01 }, /* 3769 Hz */
-    { 9.929993542430555E-01, -1.749037544152898E+00, 9.929993542430555E-01, -1.749037544152898E+00, 9.859987084861110E-01 }, /* 3770 Hz */
-    { 9.929975102498888E-01, -1.748911134221455E+00, 9.929975102498888E-01, -1.748911134221455E+00, 9.859950204997776E-01 }, /* 3771 Hz */
-    { 9.929956662635221E-01, -1.748784694792347E+00, 9.929956662635221E-01, -1.748784694792347E+00, 9.859913325270442E-01 }, /* 3772 Hz */
-    { 9.929938222839553E-01, -1.748658225867848E+00, 9.929938222839553E-01, -1.748658225867848E+00, 9.859876445679105E-01 }, /* 3773 Hz */
-    { 9.929919783111884E-01, -1.748531727450233E+00, 9.929919783111884E-01, -1.748531727450233E+00, 9.859839566223767E-01 }, /* 3774 Hz */
-    { 9.929901343452210E-01, -1.748405199541780E+00, 9.929901343452210E-01, -1.748405199541780E+00, 9.859802686904420E-01 }, /* 3775 Hz */
-    { 9.929882903860534E-01, -1.748278642144764E+00, 9.929882903860534E-01, -1.748278642144764E+00, 9.859765807721068E-01 }, /* 3776 Hz */
-    { 9.929864464336856E-01, -1.748152055261464E+00, 9.929864464336856E-01, -1.748152055261464E+00, 9.859728928673712E-01 }, /* 3777 Hz */
-    { 9.929846024881174E-01, -1.748025438894156E+00, 9.929846024881174E-01, -1.748025438894156E+00, 9.859692049762347E-01 }, /* 3778 Hz */
-    { 9.929827585493487E-01, -1.747898793045119E+00, 9.929827585493487E-01, -1.747898793045119E+00, 9.859655170986974E-01 }, /* 3779 Hz */
-    { 9.929809146173796E-01, -1.747772117716632E+00, 9.929809146173796E-01, -1.747772117716632E+00, 9.859618292347592E-01 }, /* 3780 Hz */
-    { 9.929790706922098E-01, -1.747645412910973E+00, 9.929790706922098E-01, -1.747645412910973E+00, 9.859581413844196E-01 }, /* 3781 Hz */
-    { 9.929772267738396E-01, -1.747518678630422E+00, 9.929772267738396E-01, -1.747518678630422E+00, 9.859544535476792E-01 }, /* 3782 Hz */
-    { 9.929753828622687E-01, -1.747391914877260E+00, 9.929753828622687E-01, -1.747391914877260E+00, 9.859507657245374E-01 }, /* 3783 Hz */
-    { 9.929735389574971E-01, -1.747265121653767E+00, 9.929735389574971E-01, -1.747265121653767E+00, 9.859470779149941E-01 }, /* 3784 Hz */
-    { 9.929716950595247E-01, -1.747138298962224E+00, 9.929716950595247E-01, -1.747138298962224E+00, 9.859433901190493E-01 }, /* 3785 Hz */
-    { 9.929698511683515E-01, -1.747011446804912E+00, 9.929698511683515E-01, -1.747011446804912E+00, 9.859397023367029E-01 }, /* 3786 Hz */
-    { 9.929680072839775E-01, -1.746884565184115E+00, 9.929680072839775E-01, -1.746884565184115E+00, 9.859360145679550E-01 }, /* 3787 Hz */
-    { 9.929661634064025E-01, -1.746757654102114E+00, 9.929661634064025E-01, -1.746757654102114E+00, 9.859323268128051E-01 }, /* 3788 Hz */
-    { 9.929643195356268E-01, -1.746630713561193E+00, 9.929643195356268E-01, -1.746630713561193E+00, 9.859286390712536E-01 }, /* 3789 Hz */
-    { 9.929624756716501E-01, -1.746503743563636E+00, 9.929624756716501E-01, -1.746503743563636E+00, 9.859249513433002E-01 }, /* 3790 Hz */
-    { 9.929606318144720E-01, -1.746376744111725E+00, 9.929606318144720E-01, -1.746376744111725E+00, 9.859212636289441E-01 }, /* 3791 Hz */
-    { 9.929587879640933E-01, -1.746249715207747E+00, 9.929587879640933E-01, -1.746249715207747E+00, 9.859175759281866E-01 }, /* 3792 Hz */
-    { 9.929569441205133E-01, -1.746122656853986E+00, 9.929569441205133E-01, -1.746122656853986E+00, 9.859138882410265E-01 }, /* 3793 Hz */
-    { 9.929551002837319E-01, -1.745995569052727E+00, 9.929551002837319E-01, -1.745995569052727E+00, 9.859102005674638E-01 }, /* 3794 Hz */
-    { 9.929532564537494E-01, -1.745868451806257E+00, 9.929532564537494E-01, -1.745868451806257E+00, 9.859065129074989E-01 }, /* 3795 Hz */
-    { 9.929514126305657E-01, -1.745741305116863E+00, 9.929514126305657E-01, -1.745741305116863E+00, 9.859028252611315E-01 }, /* 3796 Hz */
-    { 9.929495688141804E-01, -1.745614128986831E+00, 9.929495688141804E-01, -1.745614128986831E+00, 9.858991376283608E-01 }, /* 3797 Hz */
-    { 9.929477250045941E-01, -1.745486923418449E+00, 9.929477250045941E-01, -1.745486923418449E+00, 9.858954500091881E-01 }, /* 3798 Hz */
-    { 9.929458812018060E-01, -1.745359688414005E+00, 9.929458812018060E-01, -1.745359688414005E+00, 9.858917624036121E-01 }, /* 3799 Hz */
-    { 9.929440374058166E-01, -1.745232423975789E+00, 9.929440374058166E-01, -1.745232423975789E+00, 9.858880748116332E-01 }, /* 3800 Hz */
-    { 9.929421936166256E-01, -1.745105130106087E+00, 9.929421936166256E-01, -1.745105130106087E+00, 9.858843872332512E-01 }, /* 3801 Hz */
-    { 9.929403498342331E-01, -1.744977806807192E+00, 9.929403498342331E-01, -1.744977806807192E+00, 9.858806996684661E-01 }, /* 3802 Hz */
-    { 9.929385060586388E-01, -1.744850454081391E+00, 9.929385060586388E-01, -1.744850454081391E+00, 9.858770121172775E-01 }, /* 3803 Hz */
-    { 9.929366622898429E-01, -1.744723071930977E+00, 9.929366622898429E-01, -1.744723071930977E+00, 9.858733245796858E-01 }, /* 3804 Hz */
-    { 9.929348185278452E-01, -1.744595660358239E+00, 9.929348185278452E-01, -1.744595660358239E+00, 9.858696370556903E-01 }, /* 3805 Hz */
-    { 9.929329747726455E-01, -1.744468219365470E+00, 9.929329747726455E-01, -1.744468219365470E+00, 9.858659495452911E-01 }, /* 3806 Hz */
-    { 9.929311310242442E-01, -1.744340748954961E+00, 9.929311310242442E-01, -1.744340748954961E+00, 9.858622620484885E-01 }, /* 3807 Hz */
-    { 9.929292872826410E-01, -1.744213249129006E+00, 9.929292872826410E-01, -1.744213249129006E+00, 9.858585745652819E-01 }, /* 3808 Hz */
-    { 9.929274435478360E-01, -1.744085719889897E+00, 9.929274435478360E-01, -1.744085719889897E+00, 9.858548870956720E-01 }, /* 3809 Hz */
-    { 9.929255998198286E-01, -1.743958161239927E+00, 9.929255998198286E-01, -1.743958161239927E+00, 9.858511996396573E-01 }, /* 3810 Hz */
-    { 9.929237560986196E-01, -1.743830573181392E+00, 9.929237560986196E-01, -1.743830573181392E+00, 9.858475121972392E-01 }, /* 3811 Hz */
-    { 9.929219123842081E-01, -1.743702955716584E+00, 9.929219123842081E-01, -1.743702955716584E+00, 9.858438247684163E-01 }, /* 3812 Hz */
-    { 9.929200686765948E-01, -1.743575308847800E+00, 9.929200686765948E-01, -1.743575308847800E+00, 9.858401373531895E-01 }, /* 3813 Hz */
-    { 9.929182249757790E-01, -1.743447632577334E+00, 9.929182249757790E-01, -1.743447632577334E+00, 9.858364499515579E-01 }, /* 3814 Hz */
-    { 9.929163812817610E-01, -1.743319926907483E+00, 9.929163812817610E-01, -1.743319926907483E+00, 9.858327625635219E-01 }, /* 3815 Hz */
-    { 9.929145375945410E-01, -1.743192191840544E+00, 9.929145375945410E-01, -1.743192191840544E+00, 9.858290751890819E-01 }, /* 3816 Hz */
-    { 9.929126939141182E-01, -1.743064427378812E+00, 9.929126939141182E-01, -1.743064427378812E+00, 9.858253878282364E-01 }, /* 3817 Hz */
-    { 9.929108502404933E-01, -1.742936633524586E+00, 9.929108502404933E-01, -1.742936633524586E+00, 9.858217004809866E-01 }, /* 3818 Hz */
-    { 9.929090065736659E-01, -1.742808810280164E+00, 9.929090065736659E-01, -1.742808810280164E+00, 9.858180131473318E-01 }, /* 3819 Hz */
-    { 9.929071629136360E-01, -1.742680957647844E+00, 9.929071629136360E-01, -1.742680957647844E+00, 9.858143258272720E-01 }, /* 3820 Hz */
-    { 9.929053192604034E-01, -1.742553075629924E+00, 9.929053192604034E-01, -1.742553075629924E+00, 9.858106385208067E-01 }, /* 3821 Hz */
-    { 9.929034756139683E-01, -1.742425164228706E+00, 9.929034756139683E-01, -1.742425164228706E+00, 9.858069512279366E-01 }, /* 3822 Hz */
-    { 9.929016319743306E-01, -1.742297223446488E+00, 9.929016319743306E-01, -1.742297223446488E+00, 9.858032639486611E-01 }, /* 3823 Hz */
-    { 9.928997883414901E-01, -1.742169253285571E+00, 9.928997883414901E-01, -1.742169253285571E+00, 9.857995766829801E-01 }, /* 3824 Hz */
-    { 9.928979447154470E-01, -1.742041253748256E+00, 9.928979447154470E-01, -1.742041253748256E+00, 9.857958894308940E-01 }, /* 3825 Hz */
-    { 9.928961010962007E-01, -1.741913224836844E+00, 9.928961010962007E-01, -1.741913224836844E+00, 9.857922021924015E-01 }, /* 3826 Hz */
-    { 9.928942574837520E-01, -1.741785166553638E+00, 9.928942574837520E-01, -1.741785166553638E+00, 9.857885149675041E-01 }, /* 3827 Hz */
-    { 9.928924138781002E-01, -1.741657078900939E+00, 9.928924138781002E-01, -1.741657078900939E+00, 9.857848277562005E-01 }, /* 3828 Hz */
-    { 9.928905702792455E-01, -1.741528961881051E+00, 9.928905702792455E-01, -1.741528961881051E+00, 9.857811405584911E-01 }, /* 3829 Hz */
-    { 9.928887266871878E-01, -1.741400815496277E+00, 9.928887266871878E-01, -1.741400815496277E+00, 9.857774533743755E-01 }, /* 3830 Hz */
-    { 9.928868831019269E-01, -1.741272639748921E+00, 9.928868831019269E-01, -1.741272639748921E+00, 9.857737662038537E-01 }, /* 3831 Hz */
-    { 9.928850395234630E-01, -1.741144434641287E+00, 9.928850395234630E-01, -1.741144434641287E+00, 9.857700790469259E-01 }, /* 3832 Hz */
-    { 9.928831959517959E-01, -1.741016200175681E+00, 9.928831959517959E-01, -1.741016200175681E+00, 9.857663919035917E-01 }, /* 3833 Hz */
-    { 9.928813523869257E-01, -1.740887936354407E+00, 9.928813523869257E-01, -1.740887936354407E+00, 9.857627047738513E-01 }, /* 3834 Hz */
-    { 9.928795088288520E-01, -1.740759643179772E+00, 9.928795088288520E-01, -1.740759643179772E+00, 9.857590176577040E-01 }, /* 3835 Hz */
-    { 9.928776652775753E-01, -1.740631320654082E+00, 9.928776652775753E-01, -1.740631320654082E+00, 9.857553305551505E-01 }, /* 3836 Hz */
-    { 9.928758217330949E-01, -1.740502968779643E+00, 9.928758217330949E-01, -1.740502968779643E+00, 9.857516434661897E-01 }, /* 3837 Hz */
-    { 9.928739781954113E-01, -1.740374587558764E+00, 9.928739781954113E-01, -1.740374587558764E+00, 9.857479563908227E-01 }, /* 3838 Hz */
-    { 9.928721346645241E-01, -1.740246176993752E+00, 9.928721346645241E-01, -1.740246176993752E+00, 9.857442693290481E-01 }, /* 3839 Hz */
-    { 9.928702911404336E-01, -1.740117737086915E+00, 9.928702911404336E-01, -1.740117737086915E+00, 9.857405822808671E-01 }, /* 3840 Hz */
-    { 9.928684476231393E-01, -1.739989267840563E+00, 9.928684476231393E-01, -1.739989267840563E+00, 9.857368952462786E-01 }, /* 3841 Hz */
-    { 9.928666041126416E-01, -1.739860769257004E+00, 9.928666041126416E-01, -1.739860769257004E+00, 9.857332082252832E-01 }, /* 3842 Hz */
-    { 9.928647606089401E-01, -1.739732241338548E+00, 9.928647606089401E-01, -1.739732241338548E+00, 9.857295212178803E-01 }, /* 3843 Hz */
-    { 9.928629171120349E-01, -1.739603684087506E+00, 9.928629171120349E-01, -1.739603684087506E+00, 9.857258342240698E-01 }, /* 3844 Hz */
-    { 9.928610736219260E-01, -1.739475097506189E+00, 9.928610736219260E-01, -1.739475097506189E+00, 9.857221472438520E-01 }, /* 3845 Hz */
-    { 9.928592301386132E-01, -1.739346481596908E+00, 9.928592301386132E-01, -1.739346481596908E+00, 9.857184602772264E-01 }, /* 3846 Hz */
-    { 9.928573866620966E-01, -1.739217836361975E+00, 9.928573866620966E-01, -1.739217836361975E+00, 9.857147733241931E-01 }, /* 3847 Hz */
-    { 9.928555431923762E-01, -1.739089161803702E+00, 9.928555431923762E-01, -1.739089161803702E+00, 9.857110863847525E-01 }, /* 3848 Hz */
-    { 9.928536997294516E-01, -1.738960457924401E+00, 9.928536997294516E-01, -1.738960457924401E+00, 9.857073994589032E-01 }, /* 3849 Hz */
-    { 9.928518562733231E-01, -1.738831724726386E+00, 9.928518562733231E-01, -1.738831724726386E+00, 9.857037125466461E-01 }, /* 3850 Hz */
-    { 9.928500128239904E-01, -1.738702962211972E+00, 9.928500128239904E-01, -1.738702962211972E+00, 9.857000256479809E-01 }, /* 3851 Hz */
-    { 9.928481693814536E-01, -1.738574170383471E+00, 9.928481693814536E-01, -1.738574170383471E+00, 9.856963387629072E-01 }, /* 3852 Hz */
-    { 9.928463259457129E-01, -1.738445349243200E+00, 9.928463259457129E-01, -1.738445349243200E+00, 9.856926518914257E-01 }, /* 3853 Hz */
-    { 9.928444825167677E-01, -1.738316498793473E+00, 9.928444825167677E-01, -1.738316498793473E+00, 9.856889650335354E-01 }, /* 3854 Hz */
-    { 9.928426390946185E-01, -1.738187619036606E+00, 9.928426390946185E-01, -1.738187619036606E+00, 9.856852781892369E-01 }, /* 3855 Hz */
-    { 9.928407956792646E-01, -1.738058709974915E+00, 9.928407956792646E-01, -1.738058709974915E+00, 9.856815913585293E-01 }, /* 3856 Hz */
-    { 9.928389522707066E-01, -1.737929771610717E+00, 9.928389522707066E-01, -1.737929771610717E+00, 9.856779045414132E-01 }, /* 3857 Hz */
-    { 9.928371088689441E-01, -1.737800803946330E+00, 9.928371088689441E-01, -1.737800803946330E+00, 9.856742177378881E-01 }, /* 3858 Hz */
-    { 9.928352654739772E-01, -1.737671806984070E+00, 9.928352654739772E-01, -1.737671806984070E+00, 9.856705309479543E-01 }, /* 3859 Hz */
-    { 9.928334220858056E-01, -1.737542780726257E+00, 9.928334220858056E-01, -1.737542780726257E+00, 9.856668441716112E-01 }, /* 3860 Hz */
-    { 9.928315787044295E-01, -1.737413725175208E+00, 9.928315787044295E-01, -1.737413725175208E+00, 9.856631574088590E-01 }, /* 3861 Hz */
-    { 9.928297353298490E-01, -1.737284640333244E+00, 9.928297353298490E-01, -1.737284640333244E+00, 9.856594706596979E-01 }, /* 3862 Hz */
-    { 9.928278919620636E-01, -1.737155526202683E+00, 9.928278919620636E-01, -1.737155526202683E+00, 9.856557839241271E-01 }, /* 3863 Hz */
-    { 9.928260486010735E-01, -1.737026382785847E+00, 9.928260486010735E-01, -1.737026382785847E+00, 9.856520972021470E-01 }, /* 3864 Hz */
-    { 9.928242052468786E-01, -1.736897210085055E+00, 9.928242052468786E-01, -1.736897210085055E+00, 9.856484104937573E-01 }, /* 3865 Hz */
-    { 9.928223618994789E-01, -1.736768008102629E+00, 9.928223618994789E-01, -1.736768008102629E+00, 9.856447237989578E-01 }, /* 3866 Hz */
-    { 9.928205185588744E-01, -1.736638776840891E+00, 9.928205185588744E-01, -1.736638776840891E+00, 9.856410371177489E-01 }, /* 3867 Hz */
-    { 9.928186752250650E-01, -1.736509516302163E+00, 9.928186752250650E-01, -1.736509516302163E+00, 9.856373504501299E-01 }, /* 3868 Hz */
-    { 9.928168318980505E-01, -1.736380226488766E+00, 9.928168318980505E-01, -1.736380226488766E+00, 9.856336637961010E-01 }, /* 3869 Hz */
-    { 9.928149885778310E-01, -1.736250907403026E+00, 9.928149885778310E-01, -1.736250907403026E+00, 9.856299771556620E-01 }, /* 3870 Hz */
-    { 9.928131452644064E-01, -1.736121559047265E+00, 9.928131452644064E-01, -1.736121559047265E+00, 9.856262905288129E-01 }, /* 3871 Hz */
-    { 9.928113019577767E-01, -1.735992181423807E+00, 9.928113019577767E-01, -1.735992181423807E+00, 9.856226039155533E-01 }, /* 3872 Hz */
-    { 9.928094586579418E-01, -1.735862774534977E+00, 9.928094586579418E-01, -1.735862774534977E+00, 9.856189173158836E-01 }, /* 3873 Hz */
-    { 9.928076153649017E-01, -1.735733338383100E+00, 9.928076153649017E-01, -1.735733338383100E+00, 9.856152307298034E-01 }, /* 3874 Hz */
-    { 9.928057720786564E-01, -1.735603872970502E+00, 9.928057720786564E-01, -1.735603872970502E+00, 9.856115441573128E-01 }, /* 3875 Hz */
-    { 9.928039287992055E-01, -1.735474378299508E+00, 9.928039287992055E-01, -1.735474378299508E+00, 9.856078575984111E-01 }, /* 3876 Hz */
-    { 9.928020855265496E-01, -1.735344854372447E+00, 9.928020855265496E-01, -1.735344854372447E+00, 9.856041710530992E-01 }, /* 3877 Hz */
-    { 9.928002422606880E-01, -1.735215301191643E+00, 9.928002422606880E-01, -1.735215301191643E+00, 9.856004845213759E-01 }, /* 3878 Hz */
-    { 9.927983990016210E-01, -1.735085718759426E+00, 9.927983990016210E-01, -1.735085718759426E+00, 9.855967980032421E-01 }, /* 3879 Hz */
-    { 9.927965557493486E-01, -1.734956107078123E+00, 9.927965557493486E-01, -1.734956107078123E+00, 9.855931114986971E-01 }, /* 3880 Hz */
-    { 9.927947125038703E-01, -1.734826466150062E+00, 9.927947125038703E-01, -1.734826466150062E+00, 9.855894250077406E-01 }, /* 3881 Hz */
-    { 9.927928692651866E-01, -1.734696795977574E+00, 9.927928692651866E-01, -1.734696795977574E+00, 9.855857385303732E-01 }, /* 3882 Hz */
-    { 9.927910260332972E-01, -1.734567096562987E+00, 9.927910260332972E-01, -1.734567096562987E+00, 9.855820520665943E-01 }, /* 3883 Hz */
-    { 9.927891828082019E-01, -1.734437367908631E+00, 9.927891828082019E-01, -1.734437367908631E+00, 9.855783656164039E-01 }, /* 3884 Hz */
-    { 9.927873395899011E-01, -1.734307610016838E+00, 9.927873395899011E-01, -1.734307610016838E+00, 9.855746791798021E-01 }, /* 3885 Hz */
-    { 9.927854963783941E-01, -1.734177822889936E+00, 9.927854963783941E-01, -1.734177822889936E+00, 9.855709927567882E-01 }, /* 3886 Hz */
-    { 9.927836531736814E-01, -1.734048006530260E+00, 9.927836531736814E-01, -1.734048006530260E+00, 9.855673063473629E-01 }, /* 3887 Hz */
-    { 9.927818099757629E-01, -1.733918160940141E+00, 9.927818099757629E-01, -1.733918160940141E+00, 9.855636199515259E-01 }, /* 3888 Hz */
-    { 9.927799667846383E-01, -1.733788286121910E+00, 9.927799667846383E-01, -1.733788286121910E+00, 9.855599335692766E-01 }, /* 3889 Hz */
-    { 9.927781236003077E-01, -1.733658382077901E+00, 9.927781236003077E-01, -1.733658382077901E+00, 9.855562472006154E-01 }, /* 3890 Hz */
-    { 9.927762804227709E-01, -1.733528448810448E+00, 9.927762804227709E-01, -1.733528448810448E+00, 9.855525608455418E-01 }, /* 3891 Hz */
-    { 9.927744372520281E-01, -1.733398486321885E+00, 9.927744372520281E-01, -1.733398486321885E+00, 9.855488745040561E-01 }, /* 3892 Hz */
-    { 9.927725940880791E-01, -1.733268494614545E+00, 9.927725940880791E-01, -1.733268494614545E+00, 9.855451881761581E-01 }, /* 3893 Hz */
-    { 9.927707509309237E-01, -1.733138473690764E+00, 9.927707509309237E-01, -1.733138473690764E+00, 9.855415018618474E-01 }, /* 3894 Hz */
-    { 9.927689077805623E-01, -1.733008423552878E+00, 9.927689077805623E-01, -1.733008423552878E+00, 9.855378155611245E-01 }, /* 3895 Hz */
-    { 9.927670646369944E-01, -1.732878344203222E+00, 9.927670646369944E-01, -1.732878344203222E+00, 9.855341292739888E-01 }, /* 3896 Hz */
-    { 9.927652215002200E-01, -1.732748235644133E+00, 9.927652215002200E-01, -1.732748235644133E+00, 9.855304430004399E-01 }, /* 3897 Hz */
-    { 9.927633783702392E-01, -1.732618097877947E+00, 9.927633783702392E-01, -1.732618097877947E+00, 9.855267567404784E-01 }, /* 3898 Hz */
-    { 9.927615352470520E-01, -1.732487930907003E+00, 9.927615352470520E-01, -1.732487930907003E+00, 9.855230704941040E-01 }, /* 3899 Hz */
-    { 9.927596921306583E-01, -1.732357734733638E+00, 9.927596921306583E-01, -1.732357734733638E+00, 9.855193842613166E-01 }, /* 3900 Hz */
-    { 9.927578490210579E-01, -1.732227509360189E+00, 9.927578490210579E-01, -1.732227509360189E+00, 9.855156980421158E-01 }, /* 3901 Hz */
-    { 9.927560059182509E-01, -1.732097254788998E+00, 9.927560059182509E-01, -1.732097254788998E+00, 9.855120118365017E-01 }, /* 3902 Hz */
-    { 9.927541628222371E-01, -1.731966971022402E+00, 9.927541628222371E-01, -1.731966971022402E+00, 9.855083256444741E-01 }, /* 3903 Hz */
-    { 9.927523197330167E-01, -1.731836658062742E+00, 9.927523197330167E-01, -1.731836658062742E+00, 9.855046394660334E-01 }, /* 3904 Hz */
-    { 9.927504766505894E-01, -1.731706315912357E+00, 9.927504766505894E-01, -1.731706315912357E+00, 9.855009533011787E-01 }, /* 3905 Hz */
-    { 9.927486335749554E-01, -1.731575944573590E+00, 9.927486335749554E-01, -1.731575944573590E+00, 9.854972671499107E-01 }, /* 3906 Hz */
-    { 9.927467905061143E-01, -1.731445544048780E+00, 9.927467905061143E-01, -1.731445544048780E+00, 9.854935810122285E-01 }, /* 3907 Hz */
-    { 9.927449474440665E-01, -1.731315114340271E+00, 9.927449474440665E-01, -1.731315114340271E+00, 9.854898948881330E-01 }, /* 3908 Hz */
-    { 9.927431043888115E-01, -1.731184655450404E+00, 9.927431043888115E-01, -1.731184655450404E+00, 9.854862087776231E-01 }, /* 3909 Hz */
-    { 9.927412613403496E-01, -1.731054167381522E+00, 9.927412613403496E-01, -1.731054167381522E+00, 9.854825226806991E-01 }, /* 3910 Hz */
-    { 9.927394182986804E-01, -1.730923650135969E+00, 9.927394182986804E-01, -1.730923650135969E+00, 9.854788365973608E-01 }, /* 3911 Hz */
-    { 9.927375752638044E-01, -1.730793103716088E+00, 9.927375752638044E-01, -1.730793103716088E+00, 9.854751505276087E-01 }, /* 3912 Hz */
-    { 9.927357322357208E-01, -1.730662528124223E+00, 9.927357322357208E-01, -1.730662528124223E+00, 9.854714644714415E-01 }, /* 3913 Hz */
-    { 9.927338892144303E-01, -1.730531923362720E+00, 9.927338892144303E-01, -1.730531923362720E+00, 9.854677784288606E-01 }, /* 3914 Hz */
-    { 9.927320461999322E-01, -1.730401289433924E+00, 9.927320461999322E-01, -1.730401289433924E+00, 9.854640923998643E-01 }, /* 3915 Hz */
-    { 9.927302031922269E-01, -1.730270626340180E+00, 9.927302031922269E-01, -1.730270626340180E+00, 9.854604063844539E-01 }, /* 3916 Hz */
-    { 9.927283601913143E-01, -1.730139934083834E+00, 9.927283601913143E-01, -1.730139934083834E+00, 9.854567203826285E-01 }, /* 3917 Hz */
-    { 9.927265171971942E-01, -1.730009212667235E+00, 9.927265171971942E-01, -1.730009212667235E+00, 9.854530343943884E-01 }, /* 3918 Hz */
-    { 9.927246742098665E-01, -1.729878462092727E+00, 9.927246742098665E-01, -1.729878462092727E+00, 9.854493484197331E-01 }, /* 3919 Hz */
-    { 9.927228312293314E-01, -1.729747682362661E+00, 9.927228312293314E-01, -1.729747682362661E+00, 9.854456624586627E-01 }, /* 3920 Hz */
-    { 9.927209882555885E-01, -1.729616873479382E+00, 9.927209882555885E-01, -1.729616873479382E+00, 9.854419765111770E-01 }, /* 3921 Hz */
-    { 9.927191452886380E-01, -1.729486035445241E+00, 9.927191452886380E-01, -1.729486035445241E+00, 9.854382905772761E-01 }, /* 3922 Hz */
-    { 9.927173023284799E-01, -1.729355168262587E+00, 9.927173023284799E-01, -1.729355168262587E+00, 9.854346046569598E-01 }, /* 3923 Hz */
-    { 9.927154593751139E-01, -1.729224271933769E+00, 9.927154593751139E-01, -1.729224271933769E+00, 9.854309187502277E-01 }, /* 3924 Hz */
-    { 9.927136164285402E-01, -1.729093346461137E+00, 9.927136164285402E-01, -1.729093346461137E+00, 9.854272328570803E-01 }, /* 3925 Hz */
-    { 9.927117734887587E-01, -1.728962391847043E+00, 9.927117734887587E-01, -1.728962391847043E+00, 9.854235469775174E-01 }, /* 3926 Hz */
-    { 9.927099305557693E-01, -1.728831408093837E+00, 9.927099305557693E-01, -1.728831408093837E+00, 9.854198611115386E-01 }, /* 3927 Hz */
-    { 9.927080876295719E-01, -1.728700395203870E+00, 9.927080876295719E-01, -1.728700395203870E+00, 9.854161752591437E-01 }, /* 3928 Hz */
-    { 9.927062447101664E-01, -1.728569353179496E+00, 9.927062447101664E-01, -1.728569353179496E+00, 9.854124894203329E-01 }, /* 3929 Hz */
-    { 9.927044017975529E-01, -1.728438282023066E+00, 9.927044017975529E-01, -1.728438282023066E+00, 9.854088035951059E-01 }, /* 3930 Hz */
-    { 9.927025588917313E-01, -1.728307181736934E+00, 9.927025588917313E-01, -1.728307181736934E+00, 9.854051177834626E-01 }, /* 3931 Hz */
-    { 9.927007159927017E-01, -1.728176052323454E+00, 9.927007159927017E-01, -1.728176052323454E+00, 9.854014319854034E-01 }, /* 3932 Hz */
-    { 9.926988731004637E-01, -1.728044893784979E+00, 9.926988731004637E-01, -1.728044893784979E+00, 9.853977462009273E-01 }, /* 3933 Hz */
-    { 9.926970302150177E-01, -1.727913706123864E+00, 9.926970302150177E-01, -1.727913706123864E+00, 9.853940604300353E-01 }, /* 3934 Hz */
-    { 9.926951873363631E-01, -1.727782489342464E+00, 9.926951873363631E-01, -1.727782489342464E+00, 9.853903746727262E-01 }, /* 3935 Hz */
-    { 9.926933444645001E-01, -1.727651243443135E+00, 9.926933444645001E-01, -1.727651243443135E+00, 9.853866889290002E-01 }, /* 3936 Hz */
-    { 9.926915015994289E-01, -1.727519968428233E+00, 9.926915015994289E-01, -1.727519968428233E+00, 9.853830031988577E-01 }, /* 3937 Hz */
-    { 9.926896587411491E-01, -1.727388664300114E+00, 9.926896587411491E-01, -1.727388664300114E+00, 9.853793174822982E-01 }, /* 3938 Hz */
-    { 9.926878158896609E-01, -1.727257331061136E+00, 9.926878158896609E-01, -1.727257331061136E+00, 9.853756317793219E-01 }, /* 3939 Hz */
-    { 9.926859730449642E-01, -1.727125968713656E+00, 9.926859730449642E-01, -1.727125968713656E+00, 9.853719460899284E-01 }, /* 3940 Hz */
-    { 9.926841302070588E-01, -1.726994577260031E+00, 9.926841302070588E-01, -1.726994577260031E+00, 9.853682604141176E-01 }, /* 3941 Hz */
-    { 9.926822873759447E-01, -1.726863156702622E+00, 9.926822873759447E-01, -1.726863156702622E+00, 9.853645747518893E-01 }, /* 3942 Hz */
-    { 9.926804445516220E-01, -1.726731707043785E+00, 9.926804445516220E-01, -1.726731707043785E+00, 9.853608891032439E-01 }, /* 3943 Hz */
-    { 9.926786017340904E-01, -1.726600228285882E+00, 9.926786017340904E-01, -1.726600228285882E+00, 9.853572034681808E-01 }, /* 3944 Hz */
-    { 9.926767589233502E-01, -1.726468720431271E+00, 9.926767589233502E-01, -1.726468720431271E+00, 9.853535178467003E-01 }, /* 3945 Hz */
-    { 9.926749161194008E-01, -1.726337183482314E+00, 9.926749161194008E-01, -1.726337183482314E+00, 9.853498322388017E-01 }, /* 3946 Hz */
-    { 9.926730733222426E-01, -1.726205617441371E+00, 9.926730733222426E-01, -1.726205617441371E+00, 9.853461466444853E-01 }, /* 3947 Hz */
-    { 9.926712305318757E-01, -1.726074022310805E+00, 9.926712305318757E-01, -1.726074022310805E+00, 9.853424610637513E-01 }, /* 3948 Hz */
-    { 9.926693877482996E-01, -1.725942398092976E+00, 9.926693877482996E-01, -1.725942398092976E+00, 9.853387754965992E-01 }, /* 3949 Hz */
-    { 9.926675449715143E-01, -1.725810744790247E+00, 9.926675449715143E-01, -1.725810744790247E+00, 9.853350899430287E-01 }, /* 3950 Hz */
-    { 9.926657022015202E-01, -1.725679062404982E+00, 9.926657022015202E-01, -1.725679062404982E+00, 9.853314044030403E-01 }, /* 3951 Hz */
-    { 9.926638594383167E-01, -1.725547350939542E+00, 9.926638594383167E-01, -1.725547350939542E+00, 9.853277188766334E-01 }, /* 3952 Hz */
-    { 9.926620166819040E-01, -1.725415610396293E+00, 9.926620166819040E-01, -1.725415610396293E+00, 9.853240333638080E-01 }, /* 3953 Hz */
-    { 9.926601739322822E-01, -1.725283840777600E+00, 9.926601739322822E-01, -1.725283840777600E+00, 9.853203478645645E-01 }, /* 3954 Hz */
-    { 9.926583311894509E-01, -1.725152042085825E+00, 9.926583311894509E-01, -1.725152042085825E+00, 9.853166623789018E-01 }, /* 3955 Hz */
-    { 9.926564884534103E-01, -1.725020214323336E+00, 9.926564884534103E-01, -1.725020214323336E+00, 9.853129769068205E-01 }, /* 3956 Hz */
-    { 9.926546457241604E-01, -1.724888357492498E+00, 9.926546457241604E-01, -1.724888357492498E+00, 9.853092914483208E-01 }, /* 3957 Hz */
-    { 9.926528030017008E-01, -1.724756471595676E+00, 9.926528030017008E-01, -1.724756471595676E+00, 9.853056060034016E-01 }, /* 3958 Hz */
-    { 9.926509602860319E-01, -1.724624556635240E+00, 9.926509602860319E-01, -1.724624556635240E+00, 9.853019205720639E-01 }, /* 3959 Hz */
-    { 9.926491175771534E-01, -1.724492612613554E+00, 9.926491175771534E-01, -1.724492612613554E+00, 9.852982351543067E-01 }, /* 3960 Hz */
-    { 9.926472748750651E-01, -1.724360639532987E+00, 9.926472748750651E-01, -1.724360639532987E+00, 9.852945497501302E-01 }, /* 3961 Hz */
-    { 9.926454321797673E-01, -1.724228637395908E+00, 9.926454321797673E-01, -1.724228637395908E+00, 9.852908643595346E-01 }, /* 3962 Hz */
-    { 9.926435894912597E-01, -1.724096606204685E+00, 9.926435894912597E-01, -1.724096606204685E+00, 9.852871789825195E-01 }, /* 3963 Hz */
-    { 9.926417468095424E-01, -1.723964545961688E+00, 9.926417468095424E-01, -1.723964545961688E+00, 9.852834936190848E-01 }, /* 3964 Hz */
-    { 9.926399041346153E-01, -1.723832456669286E+00, 9.926399041346153E-01, -1.723832456669286E+00, 9.852798082692307E-01 }, /* 3965 Hz */
-    { 9.926380614664781E-01, -1.723700338329849E+00, 9.926380614664781E-01, -1.723700338329849E+00, 9.852761229329563E-01 }, /* 3966 Hz */
-    { 9.926362188051312E-01, -1.723568190945749E+00, 9.926362188051312E-01, -1.723568190945749E+00, 9.852724376102624E-01 }, /* 3967 Hz */
-    { 9.926343761505745E-01, -1.723436014519356E+00, 9.926343761505745E-01, -1.723436014519356E+00, 9.852687523011490E-01 }, /* 3968 Hz */
-    { 9.926325335028073E-01, -1.723303809053043E+00, 9.926325335028073E-01, -1.723303809053043E+00, 9.852650670056147E-01 }, /* 3969 Hz */
-    { 9.926306908618304E-01, -1.723171574549180E+00, 9.926306908618304E-01, -1.723171574549180E+00, 9.852613817236608E-01 }, /* 3970 Hz */
-    { 9.926288482276433E-01, -1.723039311010142E+00, 9.926288482276433E-01, -1.723039311010142E+00, 9.852576964552866E-01 }, /* 3971 Hz */
-    { 9.926270056002460E-01, -1.722907018438302E+00, 9.926270056002460E-01, -1.722907018438302E+00, 9.852540112004919E-01 }, /* 3972 Hz */
-    { 9.926251629796384E-01, -1.722774696836032E+00, 9.926251629796384E-01, -1.722774696836032E+00, 9.852503259592769E-01 }, /* 3973 Hz */
-    { 9.926233203658207E-01, -1.722642346205707E+00, 9.926233203658207E-01, -1.722642346205707E+00, 9.852466407316414E-01 }, /* 3974 Hz */
-    { 9.926214777587925E-01, -1.722509966549702E+00, 9.926214777587925E-01, -1.722509966549702E+00, 9.852429555175850E-01 }, /* 3975 Hz */
-    { 9.926196351585541E-01, -1.722377557870392E+00, 9.926196351585541E-01, -1.722377557870392E+00, 9.852392703171082E-01 }, /* 3976 Hz */
-    { 9.926177925651052E-01, -1.722245120170152E+00, 9.926177925651052E-01, -1.722245120170152E+00, 9.852355851302104E-01 }, /* 3977 Hz */
-    { 9.926159499784457E-01, -1.722112653451359E+00, 9.926159499784457E-01, -1.722112653451359E+00, 9.852318999568914E-01 }, /* 3978 Hz */
-    { 9.926141073985758E-01, -1.721980157716389E+00, 9.926141073985758E-01, -1.721980157716389E+00, 9.852282147971516E-01 }, /* 3979 Hz */
-    { 9.926122648254954E-01, -1.721847632967620E+00, 9.926122648254954E-01, -1.721847632967620E+00, 9.852245296509907E-01 }, /* 3980 Hz */
-    { 9.926104222592043E-01, -1.721715079207428E+00, 9.926104222592043E-01, -1.721715079207428E+00, 9.852208445184085E-01 }, /* 3981 Hz */
-    { 9.926085796997025E-01, -1.721582496438192E+00, 9.926085796997025E-01, -1.721582496438192E+00, 9.852171593994050E-01 }, /* 3982 Hz */
-    { 9.926067371469899E-01, -1.721449884662291E+00, 9.926067371469899E-01, -1.721449884662291E+00, 9.852134742939798E-01 }, /* 3983 Hz */
-    { 9.926048946010667E-01, -1.721317243882103E+00, 9.926048946010667E-01, -1.721317243882103E+00, 9.852097892021334E-01 }, /* 3984 Hz */
-    { 9.926030520619324E-01, -1.721184574100008E+00, 9.926030520619324E-01, -1.721184574100008E+00, 9.852061041238649E-01 }, /* 3985 Hz */
-    { 9.926012095295875E-01, -1.721051875318387E+00, 9.926012095295875E-01, -1.721051875318387E+00, 9.852024190591750E-01 }, /* 3986 Hz */
-    { 9.925993670040315E-01, -1.720919147539618E+00, 9.925993670040315E-01, -1.720919147539618E+00, 9.851987340080630E-01 }, /* 3987 Hz */
-    { 9.925975244852647E-01, -1.720786390766085E+00, 9.925975244852647E-01, -1.720786390766085E+00, 9.851950489705295E-01 }, /* 3988 Hz */
-    { 9.925956819732866E-01, -1.720653605000167E+00, 9.925956819732866E-01, -1.720653605000167E+00, 9.851913639465733E-01 }, /* 3989 Hz */
-    { 9.925938394680978E-01, -1.720520790244247E+00, 9.925938394680978E-01, -1.720520790244247E+00, 9.851876789361955E-01 }, /* 3990 Hz */
-    { 9.925919969696975E-01, -1.720387946500708E+00, 9.925919969696975E-01, -1.720387946500708E+00, 9.851839939393949E-01 }, /* 3991 Hz */
-    { 9.925901544780862E-01, -1.720255073771932E+00, 9.925901544780862E-01, -1.720255073771932E+00, 9.851803089561724E-01 }, /* 3992 Hz */
-    { 9.925883119932636E-01, -1.720122172060303E+00, 9.925883119932636E-01, -1.720122172060303E+00, 9.851766239865272E-01 }, /* 3993 Hz */
-    { 9.925864695152299E-01, -1.719989241368204E+00, 9.925864695152299E-01, -1.719989241368204E+00, 9.851729390304598E-01 }, /* 3994 Hz */
-    { 9.925846270439845E-01, -1.719856281698021E+00, 9.925846270439845E-01, -1.719856281698021E+00, 9.851692540879691E-01 }, /* 3995 Hz */
-    { 9.925827845795280E-01, -1.719723293052137E+00, 9.925827845795280E-01, -1.719723293052137E+00, 9.851655691590560E-01 }, /* 3996 Hz */
-    { 9.925809421218600E-01, -1.719590275432939E+00, 9.925809421218600E-01, -1.719590275432939E+00, 9.851618842437200E-01 }, /* 3997 Hz */
-    { 9.925790996709806E-01, -1.719457228842812E+00, 9.925790996709806E-01, -1.719457228842812E+00, 9.851581993419611E-01 }, /* 3998 Hz */
-    { 9.925772572268895E-01, -1.719324153284143E+00, 9.925772572268895E-01, -1.719324153284143E+00, 9.851545144537790E-01 }, /* 3999 Hz */
-    { 9.925754147895869E-01, -1.719191048759317E+00, 9.925754147895869E-01, -1.719191048759317E+00, 9.851508295791738E-01 }  /* 4000 Hz */
-};
-
-
 
 
 // externs
@@ -4012,8 +55,12 @@ extern char do_log;
     char* sw; // used for command-line arguments
 
     int fhertz = 0;
-    int fhertz1 = 40;
-    int fhertz2 = 40;
+    double fhertz1 = 40;
+    double fhertz2 = 40;
+    double q = BIQUAD_NOTCH_Q;
+    double depth = 0; // complete notch
+    double coeff1[5], coeff2[5];
+    unsigned char words1[20], words2[20];
     double amp = 0;
     char do_freq=0;
     char do_freq1=0;
@@ -4023,8 +70,8 @@ extern char do_log;
     // read in the command-line arguments
     sw = getCmdOption(argv, argv + argc, "-n");
     if (sw) {
-        sscanf(sw, "%d", &fhertz1);
-        if (do_log) printf("Setting notch to %d Hz\n", fhertz1);
+        sscanf(sw, "%lf", &fhertz1);
+        if (do_log) printf("Setting notch to %g Hz\n", fhertz1);
         fhertz2 = fhertz1;
         do_freq1=1;
         do_freq2=1;
@@ -4032,18 +79,30 @@ extern char do_log;
 
     sw = getCmdOption(argv, argv + argc, "-n1");
     if (sw) {
-        sscanf(sw, "%d", &fhertz1);
-        if (do_log) printf("Setting notch #1 to %d Hz\n", fhertz1);
+        sscanf(sw, "%lf", &fhertz1);
+        if (do_log) printf("Setting notch #1 to %g Hz\n", fhertz1);
         do_freq1=1;
     }
 
     sw = getCmdOption(argv, argv + argc, "-n2");
     if (sw) {
-        sscanf(sw, "%d", &fhertz2);
-        if (do_log) printf("Setting notch #2 to %d Hz\n", fhertz2);
+        sscanf(sw, "%lf", &fhertz2);
+        if (do_log) printf("Setting notch #2 to %g Hz\n", fhertz2);
         do_freq2=1;
     }
 
+    sw = getCmdOption(argv, argv + argc, "-q");
+    if (sw) {
+        sscanf(sw, "%lf", &q);
+        if (do_log) printf("Setting Q to %g\n", q);
+    }
+
+    sw = getCmdOption(argv, argv + argc, "-d");
+    if (sw) {
+        sscanf(sw, "%lf", &depth);
+        if (do_log) printf("Setting depth to %g dB\n", depth);
+    }
+
     sw = getCmdOption(argv, argv + argc, "-g");
     if (sw) {
         sscanf(sw, "%d", &fhertz);
@@ -4062,36 +121,38 @@ extern char do_log;
     if ((do_freq2==0) && (do_freq1==1)) {
         do_freq2=1;
         fhertz2 = fhertz1;
-        if (do_log) printf("Setting notch #2 to %d Hz\n", fhertz2);
+        if (do_log) printf("Setting notch #2 to %g Hz\n", fhertz2);
     } else if ((do_freq1==0) && (do_freq2==1)) {
         do_freq1=1;
         fhertz1 = fhertz2;
-        if (do_log) printf("Setting notch #1 to %d Hz\n", fhertz1);
+        if (do_log) printf("Setting notch #1 to %g Hz\n", fhertz1);
     }
 
-    fhertz1 = fhertz1 - 40;
-    fhertz2 = fhertz2 - 40;
-
-    if ((fhertz1<0) || (fhertz2<0) || (fhertz1>4000) || (fhertz2>4000)) {
-        printf("*** Error - out of range (40-4000 Hz notch is supported) ***\n");
+    if ((biquad_notch(coeff1, BIQUAD_FS, fhertz1, q, depth) != 0) ||
+        (biquad_notch(coeff2, BIQUAD_FS, fhertz2, q, depth) != 0)) {
+        printf("*** Error - out of range (notch below 24000 Hz with Q above 0 is supported) ***\n");
         exit(1);
     }
+    biquad_words(coeff1, words1);
+    biquad_words(coeff2, words2);
 
     dsp_open(); // create I2C handle for the DSP
+    dsp_batch_begin(); // send all of the settings in one go
 
     if (do_freq) set_freq(SIN_ADDR, fhertz);
 
     if (do_amp) set_amp(AMP_ADDR, amp);
 
     if (do_freq1) {
-        set_gen_2nd_order_filter(FILTER_NODE+0, (double*)(&notchfiltcoeff[fhertz1][0]));
-        set_gen_2nd_order_filter(FILTER_NODE+5, (double*)(&notchfiltcoeff[fhertz1][0]));
+        set_gen_2nd_order_filter_words_safeload(FILTER_NODE+0, words1);
+        set_gen_2nd_order_filter_words_safeload(FILTER_NODE+5, words1);
     }
     if (do_freq2) {
-        set_gen_2nd_order_filter(FILTER_NODE+10, (double*)(&notchfiltcoeff[fhertz2][0]));
-        set_gen_2nd_order_filter(FILTER_NODE+15, (double*)(&notchfiltcoeff[fhertz2][0]));
+        set_gen_2nd_order_filter_words_safeload(FILTER_NODE+10, words2);
+        set_gen_2nd_order_filter_words_safeload(FILTER_NODE+15, words2);
     }
 
+    dsp_batch_end();
     dsp_close(); // close the I2C resource for the DSP
 
     if (do_log) printf("Applied.\n");
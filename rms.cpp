@@ -1,6 +1,7 @@
 /*****************************************************
  * rms - RMS Tool
  * rev 1 - april 2022 - shabaz
+ * rev 2 - october 2026 - calculated filters
  *
  * uses rms.bin
  * The rms tool can be used for AC RMS
@@ -9,6 +10,15 @@
  * 0=Bypass, 1=10 Hz, 2=20 Hz, 3=100 Hz 
  * The available low pass filters are:
  * 1=100 Hz, 2=1000 Hz, 3=10000 Hz, 4=20000 Hz, 0=Bypass.
+ * Any other cutoff below 24000 Hz can be set with -hf
+ * and -lf instead; those filters are calculated (see
+ * iir.h) with the order given by -ho and -lo (1 to 6,
+ * default 6), as Butterworth filters unless -t is used
+ * (butter, cheby1, cheby2, bessel or ellip, with 1 dB
+ * passband ripple and 60 dB stopband attenuation).
+ * Filters that the DSP's 5.23 coefficients can't hold
+ * precisely enough (high orders at cutoffs below about
+ * 20 Hz) are refused.
  * First program the DSP board EEPROM using:
  * ./eeload -p rms.bin
  * then power-cycle the DSP board for the EEPROM
@@ -16,6 +26,8 @@
  *
  * Example to configure high-pass at 10 Hz, and low-pass at 10000 Hz:
  *      ./rms -h 1 -l 3
+ * Example to configure a 3rd order high-pass at 3 Hz, and low-pass at 8000 Hz:
+ *      ./rms -hf 3 -ho 3 -lf 8000
  * Example to read the RMS value in mV:
  *      ./rms -v
  * Example to read the RMS value in mV in M2M mode (less output):
@@ -28,10 +40,15 @@
  #include <stdio.h>
  #include "options.h"
  #include "dsputil.h"
+ #include "biquad.h"
+ #include "iir.h"
 
 // defines
 #define LOW 0
 #define HIGH 1
+#define SECTIONS 3 // biquads in each Nth order filter of rms.bin
+#define RIPPLE_DB 1.0
+#define ATTEN_DB 60.0
 
 // consts used by rms.bin
 // const int SIN_ADDR = 0x0000; // future option to adjust the frequency
@@ -67,6 +84,38 @@ error_oor(void)
     exit(1);
 }
 
+// designs a filter of the given order at fhertz, in the layout of buttercoeff
+void
+design_dfilter6(double* dcoeff, int type, int pass, int order, double fhertz)
+{
+    double coeff[IIR_MAX_SECTIONS][5];
+    int nsec, i;
+
+    if ((order<1) || (order>(2*SECTIONS))) error_oor();
+    nsec = iir_design(coeff, type, pass, order, BIQUAD_FS, fhertz, RIPPLE_DB, ATTEN_DB);
+    if (nsec==IIR_ROUNDING) {
+        dsp_close(); // close the I2C resource for the DSP
+        printf("error - the filter doesn't work with the DSP's 5.23 coefficients, try a lower order or a higher cutoff\n");
+        exit(1);
+    }
+    if (nsec<0) error_oor();
+    for (i=0; i<SECTIONS; i++) {
+        if (i<nsec) {
+            dcoeff[i*5+0] = coeff[i][0];
+            dcoeff[i*5+1] = coeff[i][1];
+            dcoeff[i*5+2] = coeff[i][2];
+            dcoeff[i*5+3] = 0-coeff[i][3]; // as stored by the DSP
+            dcoeff[i*5+4] = 0-coeff[i][4];
+        } else { // unused, passes the signal through
+            dcoeff[i*5+0] = 1;
+            dcoeff[i*5+1] = 0;
+            dcoeff[i*5+2] = 0;
+            dcoeff[i*5+3] = 0;
+            dcoeff[i*5+4] = 0;
+        }
+    }
+}
+
 // ************* main program **********************
  int
  main(int argc, char **argv)
@@ -77,6 +126,12 @@ error_oor(void)
     int fhertz2idx = 0;
     char do_freq1=0;
     char do_freq2=0;
+    double fhertz1=0;
+    double fhertz2=0;
+    int order1=2*SECTIONS;
+    int order2=2*SECTIONS;
+    int type=IIR_BUTTERWORTH;
+    double dcoeff1[SECTIONS*5], dcoeff2[SECTIONS*5];
     double v, converted;
 
     if (cmdOptionExists(argv, argv + argc, "-m")) {
@@ -88,12 +143,12 @@ error_oor(void)
     if (cmdOptionExists(argv, argv + argc, "-v")) {
         if (do_log) printf("RMS requested\n");
         // read channel, divide by square of gain
-        v = readback(LEVEL_ADDR, LEVEL_NODE_AMP) / (100.0*100.0);
+        v = readback_fast(LEVEL_ADDR, LEVEL_NODE_AMP) / (100.0*100.0);
         converted = ms_to_rms(v);
         if (converted<0.06) {
             // low value
         } else { // need to use the larger value
-            v = readback(LEVEL_ADDR, LEVEL_NODE);
+            v = readback_fast(LEVEL_ADDR, LEVEL_NODE);
             converted = ms_to_rms(v);
         }
 
@@ -128,8 +183,42 @@ error_oor(void)
         do_freq2=1;
     }
 
+    sw = getCmdOption(argv, argv + argc, "-t");
+    if (sw) {
+        type = iir_type(sw);
+        if (type<0) error_oor();
+    }
+
+    sw = getCmdOption(argv, argv + argc, "-ho");
+    if (sw) {
+        sscanf(sw, "%d", &order1);
+    }
+
+    sw = getCmdOption(argv, argv + argc, "-lo");
+    if (sw) {
+        sscanf(sw, "%d", &order2);
+    }
+
+    sw = getCmdOption(argv, argv + argc, "-hf");
+    if (sw) {
+        sscanf(sw, "%lf", &fhertz1);
+        if (do_log) printf("Setting highpass to %g Hz, order %d\n", fhertz1, order1);
+        design_dfilter6(dcoeff1, type, IIR_HIGHPASS, order1, fhertz1);
+        do_freq1=1;
+    }
+
+    sw = getCmdOption(argv, argv + argc, "-lf");
+    if (sw) {
+        sscanf(sw, "%lf", &fhertz2);
+        if (do_log) printf("Setting lowpass to %g Hz, order %d\n", fhertz2, order2);
+        design_dfilter6(dcoeff2, type, IIR_LOWPASS, order2, fhertz2);
+        do_freq2=1;
+    }
+
     if (do_freq1) {
-        if (fhertz1idx>0) {
+        if (fhertz1>0) {
+            set_dfilter6(DFILTER_NODE1, dcoeff1);
+        } else if (fhertz1idx>0) {
             set_dfilter6(DFILTER_NODE1, (double*)(&buttercoeff[fhertz1idx-1][0]));  
         } else { // bypass
             set_dfilter6_bypass(DFILTER_NODE1);
@@ -137,7 +226,9 @@ error_oor(void)
     }
 
     if (do_freq2) {
-        if (fhertz2idx>0) {
+        if (fhertz2>0) {
+            set_dfilter6(DFILTER_NODE2, dcoeff2);
+        } else if (fhertz2idx>0) {
             set_dfilter6(DFILTER_NODE2, (double*)(&buttercoeff[fhertz2idx+2][0]));  
         } else { // bypass
             set_dfilter6_bypass(DFILTER_NODE2);
@@ -0,0 +1,132 @@
+/**********************************************************
+ * shadow.cpp - shadow copy of the DSP parameter RAM
+ *
+ * The file is shared by every process that uses dsputil
+ * with WAVEMINER_SHADOW set. There is no locking, see
+ * shadow.h.
+ **********************************************************/
+
+// includes
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <errno.h>
+ #include <fcntl.h>
+ #include <unistd.h>
+ #include <sys/mman.h>
+ #include "shadow.h"
+
+ // globals
+ shadow_t* shadow = NULL;
+ uint64_t shadow_hits = 0;   // this process only
+ uint64_t shadow_misses = 0;
+
+// map the shadow file
+int
+shadow_open(void) {
+    const char* path;
+    int fd;
+    void* addr;
+
+    if (shadow) return(0);
+    path = getenv("WAVEMINER_SHADOW");
+    if ((path == NULL) || (strcmp(path, "off") == 0)) return(-1);
+    if (strcmp(path, "on") == 0) path = SHADOW_PATH;
+
+    fd = open(path, O_RDWR | O_CREAT, 0666);
+    if (fd < 0) {
+        fprintf(stderr, "shadow_open error: %s\n", strerror(errno));
+        return(-1);
+    }
+    if (ftruncate(fd, sizeof(shadow_t)) != 0) {
+        fprintf(stderr, "shadow_open ftruncate error: %s\n", strerror(errno));
+        close(fd);
+        return(-1);
+    }
+    addr = mmap(NULL, sizeof(shadow_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        fprintf(stderr, "shadow_open mmap error: %s\n", strerror(errno));
+        return(-1);
+    }
+    shadow = (shadow_t*)addr;
+    if ((shadow->magic != SHADOW_MAGIC) || (shadow->version != SHADOW_VERSION)) {
+        // new (zero-filled) or old format file
+        memset(shadow, 0, sizeof(shadow_t));
+        shadow->magic = SHADOW_MAGIC;
+        shadow->version = SHADOW_VERSION;
+    }
+    return(0);
+}
+
+void
+shadow_close(void) {
+    if (shadow == NULL) return;
+    munmap(shadow, sizeof(shadow_t));
+    shadow = NULL;
+}
+
+// are the words already in the DSP?
+int
+shadow_known(int addr, const char* words, int nwords) {
+    int i;
+
+    if (shadow == NULL) return(0);
+    if ((addr < 0) || (addr+nwords > PARAM_RAM_WORDS)) return(0);
+    for (i=0; i<nwords; i++) {
+        if (!shadow->valid[addr+i] || (memcmp(shadow->data[addr+i], &words[i*4], 4) != 0)) return(0);
+    }
+    return(1);
+}
+
+int
+shadow_check(int addr, const char* words, int nwords) {
+    if (shadow == NULL) return(0);
+    if (!shadow_known(addr, words, nwords)) {
+        shadow->misses++;
+        shadow_misses++;
+        return(0);
+    }
+    shadow->hits++;
+    shadow_hits++;
+    return(1);
+}
+
+// remember the words written
+void
+shadow_update(int addr, const char* words, int nwords) {
+    int i;
+
+    if (shadow == NULL) return;
+    if ((addr < 0) || (addr+nwords > PARAM_RAM_WORDS)) return;
+    for (i=0; i<nwords; i++) {
+        memcpy(shadow->data[addr+i], &words[i*4], 4);
+        shadow->valid[addr+i] = 1;
+    }
+}
+
+void
+shadow_invalidate(void) {
+    if (shadow == NULL) return;
+    memset(shadow->valid, 0, sizeof(shadow->valid));
+}
+
+int
+shadow_run(int addr, char* words, int max) {
+    int n = 0;
+
+    if (shadow == NULL) return(0);
+    while ((n < max) && (addr+n < PARAM_RAM_WORDS) && shadow->valid[addr+n]) {
+        memcpy(&words[n*4], shadow->data[addr+n], 4);
+        n++;
+    }
+    return(n);
+}
+
+void
+shadow_counts(uint64_t* hits, uint64_t* misses, uint64_t* total_hits, uint64_t* total_misses) {
+    *hits = shadow_hits;
+    *misses = shadow_misses;
+    *total_hits = shadow ? shadow->hits : 0;
+    *total_misses = shadow ? shadow->misses : 0;
+}
@@ -0,0 +1,69 @@
+#ifndef __SHADOW_HEADER_FILE__
+#define __SHADOW_HEADER_FILE__
+
+/**********************************************************
+ * shadow.h - shadow copy of the DSP parameter RAM
+ *
+ * Holds the last 4-byte word written to each parameter
+ * address, in a small memory-mapped file so that separate
+ * tool invocations share it. Writes of unchanged words
+ * can then be skipped.
+ *
+ * It is off unless WAVEMINER_SHADOW is set, to "on" for
+ * SHADOW_PATH or to another file name. dsp_open() reads
+ * back every word the shadow holds and forgets them all if
+ * any differs (after a power cycle, or an app loaded by a
+ * process without the shadow), so it costs a read of the
+ * remembered words each time, and pays off for tools that
+ * send the same coefficient sets again and again.
+ *
+ * There is no locking. Two processes writing the DSP at
+ * the same time (e.g. dspd and a tool) can leave a word
+ * stale in the shadow, and a later write of that word is
+ * then skipped. Only turn it on when one process at a time
+ * writes the DSP.
+ **********************************************************/
+
+#include <stdint.h>
+
+#define SHADOW_PATH "/dev/shm/waveminer-shadow" // WAVEMINER_SHADOW=on
+#define SHADOW_MAGIC 0x57534844 // "WSHD"
+#define SHADOW_VERSION 2
+#define PARAM_RAM_WORDS 1024    // ADAU1401 parameter RAM is at 0x0000-0x03ff
+#define SHADOW_VERIFY_WORDS 32  // words read back at a time by dsp_shadow_verify
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t hits;      // writes skipped, over all processes
+    uint64_t misses;    // writes sent
+    uint8_t valid[PARAM_RAM_WORDS];
+    uint8_t data[PARAM_RAM_WORDS][4];
+} shadow_t;
+
+// maps the shadow file, creating it if needed. returns 0 on success,
+// or -1 if the shadow is disabled or cannot be used (it is then ignored)
+int shadow_open(void);
+void shadow_close(void);
+
+// returns 1 if all nwords words starting at addr are known to hold the
+// given values already (and counts a hit), otherwise 0 (and counts a miss)
+int shadow_check(int addr, const char* words, int nwords);
+
+// the same without counting, e.g. to decide what to log
+int shadow_known(int addr, const char* words, int nwords);
+
+// records that the words have been written
+void shadow_update(int addr, const char* words, int nwords);
+
+// forget all values, for instance after loading a new app into the DSP
+void shadow_invalidate(void);
+
+// copies the known words from addr on into words, up to max of them and
+// stopping at the first unknown one. returns the number copied
+int shadow_run(int addr, char* words, int max);
+
+// hit and miss counts for this process, and for all processes
+void shadow_counts(uint64_t* hits, uint64_t* misses, uint64_t* total_hits, uint64_t* total_misses);
+
+#endif // __SHADOW_HEADER_FILE__
@@ -0,0 +1,151 @@
+/*******************************
+ * stats.c
+ * latency histograms and counters
+ * for the I2C functions, readback
+ * and delays
+ * rev 1 october 2026
+ *******************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "i2cfunc.h"
+#include "stats.h"
+
+char stats_on=0;
+stats_t stats;
+
+static const char* stats_path=NULL;
+static const char* hist_name[STATS_NUM_HIST]={
+  "i2c_write", "i2c_read", "i2c_write_read", "i2c_trans_submit",
+  "readback", "readback_fast", "delay_ms", "delay_us"
+};
+
+static int bucket_index(uint64_t v)
+{
+  int e;
+  if (v<STATS_SUB_COUNT) return((int)v);
+  e=63-__builtin_clzll(v); // position of the top bit, STATS_SUB_BITS or more
+  return((e-STATS_SUB_BITS+1)*STATS_SUB_COUNT + (int)((v>>(e-STATS_SUB_BITS)) & (STATS_SUB_COUNT-1)));
+}
+
+// middle of the range of values in a bucket
+static uint64_t bucket_value(int i)
+{
+  int e;
+  uint64_t lo;
+  if (i<STATS_SUB_COUNT) return(i);
+  e=i/STATS_SUB_COUNT+STATS_SUB_BITS-1;
+  lo=((uint64_t)(STATS_SUB_COUNT+(i%STATS_SUB_COUNT)))<<(e-STATS_SUB_BITS);
+  return(lo+(1ULL<<(e-STATS_SUB_BITS))/2);
+}
+
+void stats_record(int hist, uint64_t ns)
+{
+  stats_hist_add(&stats.hist[hist], ns);
+}
+
+void stats_hist_add(stats_hist_t* h, uint64_t ns)
+{
+  if ((h->count==0) || (ns<h->min)) h->min=ns;
+  if (ns>h->max) h->max=ns;
+  h->count++;
+  h->sum+=ns;
+  h->bucket[bucket_index(ns)]++;
+}
+
+void stats_record_since(int hist, unsigned long long t_start)
+{
+  stats_record(hist, monotonic_ns()-t_start);
+}
+
+void stats_io(int ret, unsigned int written, unsigned int read, int err)
+{
+  if (ret<0)
+  {
+    if ((err<0) || (err>=STATS_MAX_ERRNO)) err=STATS_MAX_ERRNO-1;
+    stats.errors[err]++;
+    return;
+  }
+  stats.bytes_written+=written;
+  stats.bytes_read+=read;
+}
+
+uint64_t stats_percentile(const stats_hist_t* h, double p)
+{
+  uint64_t want, seen=0, v;
+  int i;
+
+  if (h->count==0) return(0);
+  want=(uint64_t)((p/100.0)*h->count+0.999999);
+  if (want<1) want=1;
+  for (i=0; i<STATS_BUCKETS; i++)
+  {
+    seen+=h->bucket[i];
+    if (seen>=want) break;
+  }
+  v=bucket_value(i);
+  // the bucket may be wider than the values that are actually in it
+  if (v<h->min) v=h->min;
+  if (v>h->max) v=h->max;
+  return(v);
+}
+
+void stats_print(FILE* fp)
+{
+  const stats_hist_t* h;
+  int i;
+
+  fprintf(fp, "%-16s %8s %10s %10s %10s %10s %10s %10s %10s\n", "usec", "count",
+          "min", "mean", "p50", "p90", "p99", "p99.9", "max");
+  for (i=0; i<STATS_NUM_HIST; i++)
+  {
+    h=&stats.hist[i];
+    if (h->count==0) continue;
+    fprintf(fp, "%-16s %8llu %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", hist_name[i],
+            (unsigned long long)h->count, h->min/1e3, (double)h->sum/h->count/1e3,
+            stats_percentile(h, 50)/1e3, stats_percentile(h, 90)/1e3,
+            stats_percentile(h, 99)/1e3, stats_percentile(h, 99.9)/1e3, h->max/1e3);
+  }
+  fprintf(fp, "i2c bytes written %llu, read %llu\n",
+          (unsigned long long)stats.bytes_written, (unsigned long long)stats.bytes_read);
+  for (i=0; i<STATS_MAX_ERRNO; i++)
+  {
+    if (stats.errors[i]) fprintf(fp, "i2c errors %s: %llu\n", strerror(i), (unsigned long long)stats.errors[i]);
+  }
+}
+
+static void stats_exit(void)
+{
+  FILE* fp=stderr;
+  if (stats_path && ((fp=fopen(stats_path, "a"))==NULL)) return;
+  stats_print(fp);
+  if (fp!=stderr) fclose(fp);
+}
+
+void stats_enable(const char* path)
+{
+  if (stats_on) return;
+  stats_path=path;
+  stats_on=1;
+  atexit(stats_exit);
+}
+
+// runs before main(). glibc passes the program arguments to constructors,
+// which saves every tool from looking for --stats itself
+__attribute__((constructor)) static void stats_init(int argc, char** argv, char** envp)
+{
+  const char* env=getenv("WAVEMINER_STATS");
+  int i;
+
+  if (env && env[0] && (strcmp(env, "0")!=0))
+  {
+    stats_enable(strcmp(env, "1")==0 ? NULL : env);
+    return;
+  }
+  for (i=1; i<argc; i++)
+  {
+    if (strcmp(argv[i], "--stats")==0) stats_enable(NULL);
+  }
+}
@@ -0,0 +1,75 @@
+/************************************
+ * stats.h
+ * latency histograms and counters
+ * for the I2C functions, readback
+ * and delays
+ *
+ * rev 1 october 2026
+ ************************************/
+
+#ifndef __STATS_HEADER_FILE__
+#define __STATS_HEADER_FILE__
+
+#include <stdio.h>
+#include <stdint.h>
+
+// Collection is turned on by running a tool with --stats, or with
+// WAVEMINER_STATS set (to 1 for stderr, or to a file name to append to).
+// The results are printed at exit. While it is off the hooks cost a test
+// of stats_on (see i2cfunc.h).
+
+// Histograms are log-linear, as in HdrHistogram: values (in nsec) below
+// 2^STATS_SUB_BITS have a bucket each, and every power of two above that
+// is split into 2^STATS_SUB_BITS buckets, so a value is known to within
+// 1/16 (about 6%) whatever its size
+#define STATS_SUB_BITS 4
+#define STATS_SUB_COUNT (1<<STATS_SUB_BITS)
+#define STATS_BUCKETS ((64-STATS_SUB_BITS+1)*STATS_SUB_COUNT)
+#define STATS_MAX_ERRNO 256 // errors with a larger errno are counted as STATS_MAX_ERRNO-1
+
+// the histograms
+#define STATS_I2C_WRITE 0
+#define STATS_I2C_READ 1
+#define STATS_I2C_WRITE_READ 2
+#define STATS_I2C_TRANS_SUBMIT 3
+#define STATS_READBACK 4
+#define STATS_READBACK_FAST 5
+#define STATS_DELAY_MS 6
+#define STATS_DELAY_US 7
+#define STATS_NUM_HIST 8
+
+typedef struct {
+  uint64_t count;
+  uint64_t min;
+  uint64_t max;
+  uint64_t sum;
+  uint64_t bucket[STATS_BUCKETS];
+} stats_hist_t;
+
+typedef struct {
+  stats_hist_t hist[STATS_NUM_HIST];
+  uint64_t bytes_written;
+  uint64_t bytes_read;
+  uint64_t errors[STATS_MAX_ERRNO]; // I2C errors, by errno
+} stats_t;
+
+extern char stats_on;
+extern stats_t stats;
+
+// turns collection on. The results are written to path at exit,
+// or to stderr if path is NULL
+void stats_enable(const char* path);
+// adds one value (in nsec) to a histogram
+void stats_record(int hist, uint64_t ns);
+// adds one value to a histogram of the caller's own (zeroed before first use)
+void stats_hist_add(stats_hist_t* h, uint64_t ns);
+// adds the time since t_start (a monotonic_ns() value) to a histogram
+void stats_record_since(int hist, unsigned long long t_start);
+// counts the bytes of an I2C call, or its errno if ret is negative
+void stats_io(int ret, unsigned int written, unsigned int read, int err);
+// value at percentile p (0-100) of a histogram
+uint64_t stats_percentile(const stats_hist_t* h, double p);
+// prints everything collected so far
+void stats_print(FILE* fp);
+
+#endif // __STATS_HEADER_FILE__
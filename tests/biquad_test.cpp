@@ -0,0 +1,58 @@
+/*****************************************************
+ * biquad_test - notch design against the old table
+ * rev 1 - october 2026
+ *
+ * notch.cpp used to take its coefficients from the
+ * table in notch.h. biquad_notch() replaced it, and
+ * for every row of the table (40 to 4000 Hz in whole
+ * Hz, Q of BIQUAD_NOTCH_Q) the 5.23 words that
+ * biquad_words() makes have to be the same, bit for
+ * bit, as the words made from the row.
+ *
+ * Run with make check.
+ *****************************************************/
+
+// includes
+ #include <stdio.h>
+ #include <string.h>
+ #include "biquad.h"
+ #include "notch.h"
+
+// defines
+#define NOTCH_FIRST_HZ 40
+#define NOTCH_ROWS 3961    // 40 to 4000 Hz
+#define MAX_REPORTED 10    // differing rows that are printed
+
+// ************* main program **********************
+int main(void) {
+    double coeff[5];
+    unsigned char words[20];
+    unsigned char table_words[20];
+    int i, j;
+    int ndiff = 0;
+
+    for (i=0; i<NOTCH_ROWS; i++) {
+        if (biquad_notch(coeff, BIQUAD_FS, NOTCH_FIRST_HZ+i, BIQUAD_NOTCH_Q, 0) != 0) {
+            printf("biquad_notch refused %d Hz\n", NOTCH_FIRST_HZ+i);
+            ndiff++;
+            continue;
+        }
+        biquad_words(coeff, words);
+        biquad_words(notchfiltcoeff[i], table_words);
+        if (memcmp(words, table_words, sizeof(words)) != 0) {
+            if (ndiff < MAX_REPORTED) {
+                for (j=0; memcmp(&words[j*4], &table_words[j*4], 4) == 0; j++);
+                printf("%d Hz differs in word %d: 0x%02x%02x%02x%02x, table 0x%02x%02x%02x%02x\n",
+                       NOTCH_FIRST_HZ+i, j, words[j*4], words[j*4+1], words[j*4+2], words[j*4+3],
+                       table_words[j*4], table_words[j*4+1], table_words[j*4+2], table_words[j*4+3]);
+            }
+            ndiff++;
+        }
+    }
+    if (ndiff) {
+        printf("biquad_test: %d of %d rows differ\n", ndiff, NOTCH_ROWS);
+        return(1);
+    }
+    printf("biquad_test: ok, %d rows\n", NOTCH_ROWS);
+    return(0);
+}
@@ -0,0 +1,181 @@
+/*****************************************************
+ * dspd_test - dspd request dispatch test
+ * rev 1 - october 2026
+ *
+ * Runs dspd_dispatch() in this process against the fake
+ * DSP (see i2cfake.h), with no socket: a set command has
+ * to reach the fake parameter RAM, a readback has to
+ * return the value the fake captures, and a command
+ * whose I2C transfer fails has to answer DSPD_ERR_BUS.
+ * The shadow cache is on, so that a failed write that
+ * is sent again is not skipped as unchanged.
+ *
+ * Run with make check.
+ *****************************************************/
+
+// includes
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <errno.h>
+ #include <unistd.h>
+ #include "dsputil.h"
+ #include "dspd.h"
+ #include "i2cfunc.h"
+ #include "i2cfake.h"
+ #include "fixedpoint.h"
+
+// defines
+#define DC_NODE 0x0010       // any parameter RAM word will do
+#define FILTER_NODE 0x0020
+#define LEVEL_ADDR 0x081a
+#define LEVEL_NODE 0x00fe
+#define LEVEL_VALUE 0.75     // exact in 5.19
+
+#define CHECK(cond) do { if (!(cond)) { \
+    printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+    nfailed++; } } while (0)
+
+// externs
+extern char do_log;
+
+// globals
+int nfailed = 0;
+char fail = 0;          // when set, every transfer is refused
+
+// transport in front of the fake bus that can be made to fail
+static int fail_open(i2c_transport_t* tp, unsigned char bus, unsigned char addr) {
+    return(tp->inner->open(tp->inner, bus, addr));
+}
+
+static int fail_close(i2c_transport_t* tp, int handle) {
+    return(tp->inner->close(tp->inner, handle));
+}
+
+static int fail_write(i2c_transport_t* tp, int handle, const unsigned char* buf, unsigned int length) {
+    if (fail) {
+        errno = EREMOTEIO;
+        return(-1);
+    }
+    return(tp->inner->write(tp->inner, handle, buf, length));
+}
+
+static int fail_read(i2c_transport_t* tp, int handle, unsigned char* buf, unsigned int length) {
+    if (fail) {
+        errno = EREMOTEIO;
+        return(-1);
+    }
+    return(tp->inner->read(tp->inner, handle, buf, length));
+}
+
+static int fail_rdwr(i2c_transport_t* tp, int handle, struct i2c_msg* msgs, int nmsgs) {
+    if (fail) {
+        errno = EREMOTEIO;
+        return(-1);
+    }
+    return(tp->inner->rdwr(tp->inner, handle, msgs, nmsgs));
+}
+
+i2c_transport_t fail_transport = {
+    "fail", fail_open, fail_close, fail_write, fail_read, fail_rdwr, &i2c_fake_transport, NULL
+};
+
+// what the fake's data capture registers see
+static double probe(int node) {
+    return((node == LEVEL_NODE) ? LEVEL_VALUE : 0.0);
+}
+
+// send a request with a payload of plen bytes, returns the response status
+int send_req(int cmd, int addr, const void* payload, int plen, dspd_resp_t* resp) {
+    unsigned char pkt[sizeof(dspd_req_t)];
+    dspd_hdr_t hdr;
+    static uint8_t seq = 0;
+
+    hdr.cmd = cmd;
+    hdr.seq = ++seq;
+    hdr.addr = addr;
+    memcpy(pkt, &hdr, sizeof(hdr));
+    if (plen > 0) memcpy(&pkt[sizeof(hdr)], payload, plen);
+    CHECK(dspd_dispatch(pkt, DSPD_REQ_LEN(plen), resp) == (int)sizeof(dspd_resp_t));
+    CHECK(resp->seq == seq);
+    return(resp->status);
+}
+
+// value of a parameter RAM word in the fake DSP
+double param(int addr) {
+    return(fixed_5_23::decode(fake_state()->param[addr]));
+}
+
+int main(void) {
+    char shadow_path[32];
+    dspd_resp_t resp;
+    unsigned char pkt[sizeof(dspd_hdr_t)];
+    double d;
+    int32_t node = LEVEL_NODE;
+    double coeff[5] = { 0.5, 0.25, 0.125, -0.5, 0.25 };
+    int i;
+
+    unsetenv("WAVEMINER_FAKE_STATE"); // the fake devices live in memory
+    strcpy(shadow_path, "/tmp/dspd_test-XXXXXX");
+    close(mkstemp(shadow_path));
+    unlink(shadow_path); // only the name is wanted, the shadow makes the file
+    setenv("WAVEMINER_SHADOW", shadow_path, 1);
+    i2c_set_transport(&fail_transport);
+    fake_dsp_probe = probe;
+    do_log = 0;
+    dsp_open();
+
+    // set commands reach the parameter RAM
+    CHECK(send_req(DSPD_PING, 0, NULL, 0, &resp) == DSPD_OK);
+    d = 1.25;
+    CHECK(send_req(DSPD_SET_DC_FLOAT, DC_NODE, &d, sizeof(d), &resp) == DSPD_OK);
+    CHECK(param(DC_NODE) == 1.25);
+    d = -2.5;
+    CHECK(send_req(DSPD_SET_DC_FLOAT_SAFELOAD, DC_NODE, &d, sizeof(d), &resp) == DSPD_OK);
+    CHECK(param(DC_NODE) == -2.5);
+    CHECK(send_req(DSPD_SET_GEN_2ND_ORDER_FILTER, FILTER_NODE, coeff, sizeof(coeff), &resp) == DSPD_OK);
+    for (i=0; i<5; i++) {
+        CHECK(param(FILTER_NODE+i) == ((i < 3) ? coeff[i] : -coeff[i])); // a1, a2 are stored negated
+    }
+
+    // readbacks return what the fake captures
+    CHECK(send_req(DSPD_READBACK_FAST, LEVEL_ADDR, &node, sizeof(node), &resp) == DSPD_OK);
+    CHECK(resp.value == LEVEL_VALUE);
+    CHECK(send_req(DSPD_READBACK, LEVEL_ADDR, &node, sizeof(node), &resp) == DSPD_OK);
+    CHECK(resp.value == LEVEL_VALUE);
+
+    // malformed requests
+    CHECK(send_req(DSPD_NUM_CMDS, 0, NULL, 0, &resp) == DSPD_ERR_CMD);
+    CHECK(send_req(DSPD_SET_DC_FLOAT, DC_NODE, &node, sizeof(node), &resp) == DSPD_ERR_LEN);
+    memset(pkt, 0, sizeof(pkt));
+    CHECK(dspd_dispatch(pkt, 2, &resp) == (int)sizeof(dspd_resp_t));
+    CHECK(resp.status == DSPD_ERR_LEN);
+
+    // failed transfers are reported and nothing reaches the DSP. Sent again
+    // once the bus is back, they are not skipped as unchanged
+    fail = 1;
+    d = 3.0;
+    CHECK(send_req(DSPD_SET_DC_FLOAT_SAFELOAD, DC_NODE, &d, sizeof(d), &resp) == DSPD_ERR_BUS);
+    CHECK(param(DC_NODE) == -2.5);
+    fail = 0;
+    CHECK(send_req(DSPD_SET_DC_FLOAT_SAFELOAD, DC_NODE, &d, sizeof(d), &resp) == DSPD_OK);
+    CHECK(param(DC_NODE) == 3.0);
+    fail = 1;
+    d = 4.0;
+    CHECK(send_req(DSPD_SET_DC_FLOAT, DC_NODE, &d, sizeof(d), &resp) == DSPD_ERR_BUS);
+    CHECK(send_req(DSPD_READBACK_FAST, LEVEL_ADDR, &node, sizeof(node), &resp) == DSPD_ERR_BUS);
+    CHECK(send_req(DSPD_PING, 0, NULL, 0, &resp) == DSPD_OK);
+    CHECK(param(DC_NODE) == 3.0);
+    fail = 0;
+    CHECK(send_req(DSPD_SET_DC_FLOAT, DC_NODE, &d, sizeof(d), &resp) == DSPD_OK);
+    CHECK(param(DC_NODE) == 4.0);
+
+    dsp_close();
+    unlink(shadow_path);
+    if (nfailed) {
+        printf("dspd_test: %d checks failed\n", nfailed);
+        return(1);
+    }
+    printf("dspd_test: ok\n");
+    return(0);
+}
@@ -0,0 +1,184 @@
+/*****************************************************
+ * eeprog_test - ee_prog diff test
+ * rev 1 - october 2026
+ *
+ * Programs one image into the fake 24xx256 EEPROM (see
+ * i2cfake.h), then programs a second image that differs
+ * in a few pages with do_diff set, and checks that only
+ * those pages were written and that the EEPROM then
+ * holds the second image.
+ *
+ * Run with make check.
+ *****************************************************/
+
+// includes
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <unistd.h>
+ #include "dsputil.h"
+ #include "dsplog.h"
+ #include "i2cfunc.h"
+ #include "i2cfake.h"
+
+// defines
+#define IMG_LEN (40*BLOCKSIZE + 10)  // the last page is a partial one
+#define IMG_PAGES 41
+#define MAX_WRITES IMG_PAGES
+
+#define CHECK(cond) do { if (!(cond)) { \
+    printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+    nfailed++; } } while (0)
+
+// externs
+extern char do_log;
+
+// globals
+int nfailed = 0;
+int nwrites = 0;              // page writes seen so far
+int write_addr[MAX_WRITES];   // address of each page write
+
+// transport in front of the fake bus that records the page writes,
+// which are the only writes of a subaddress and a full page
+static int page_open(i2c_transport_t* tp, unsigned char bus, unsigned char addr) {
+    return(tp->inner->open(tp->inner, bus, addr));
+}
+
+static int page_close(i2c_transport_t* tp, int handle) {
+    return(tp->inner->close(tp->inner, handle));
+}
+
+static int page_write(i2c_transport_t* tp, int handle, const unsigned char* buf, unsigned int length) {
+    if (length == BLOCKSIZE+2) {
+        if (nwrites < MAX_WRITES) write_addr[nwrites] = (buf[0]<<8) | buf[1];
+        nwrites++;
+    }
+    return(tp->inner->write(tp->inner, handle, buf, length));
+}
+
+static int page_read(i2c_transport_t* tp, int handle, unsigned char* buf, unsigned int length) {
+    return(tp->inner->read(tp->inner, handle, buf, length));
+}
+
+static int page_rdwr(i2c_transport_t* tp, int handle, struct i2c_msg* msgs, int nmsgs) {
+    return(tp->inner->rdwr(tp->inner, handle, msgs, nmsgs));
+}
+
+i2c_transport_t page_transport = {
+    "pages", page_open, page_close, page_write, page_read, page_rdwr, &i2c_fake_transport, NULL
+};
+
+// write an image to a temporary file, whose name is put in fname
+void write_image(char* fname, const unsigned char* img, int len) {
+    int fd;
+
+    strcpy(fname, "/tmp/eeprog_test-XXXXXX");
+    fd = mkstemp(fname);
+    CHECK(fd >= 0);
+    CHECK(write(fd, img, len) == len);
+    close(fd);
+}
+
+// run ee_prog with logging on, and return the number of pages it
+// reports as skipped, or -1
+int prog_skipped(char* fname) {
+    char out[32];
+    char line[128];
+    FILE* fptr;
+    int saved;
+    int nwritten = -1;
+    int nskipped = -1;
+
+    strcpy(out, "/tmp/eeprog_test-XXXXXX");
+    fflush(stdout);
+    saved = dup(1);
+    fptr = fdopen(mkstemp(out), "w+");
+    dup2(fileno(fptr), 1);
+    do_log = 1;
+    CHECK(ee_prog(fname, 1) == 0);
+    dsp_log_flush();
+    fflush(stdout);
+    do_log = 0;
+    dup2(saved, 1);
+    close(saved);
+    rewind(fptr);
+    while (fgets(line, sizeof(line), fptr) != NULL) {
+        if (sscanf(line, "wrote %d pages, skipped %d", &nwritten, &nskipped) == 2) break;
+    }
+    CHECK(nwritten == nwrites);
+    fclose(fptr);
+    unlink(out);
+    return(nskipped);
+}
+
+int main(void) {
+    static unsigned char img_a[IMG_LEN];
+    static unsigned char img_b[IMG_LEN];
+    static unsigned char padded_a[IMG_PAGES*BLOCKSIZE];
+    static unsigned char padded_b[IMG_PAGES*BLOCKSIZE];
+    char dirty[IMG_PAGES];
+    char fname_a[32];
+    char fname_b[32];
+    int i;
+
+    unsetenv("WAVEMINER_FAKE_STATE"); // the fake devices live in memory
+    unsetenv("WAVEMINER_SHADOW");
+    setenv("WAVEMINER_FAKE_EE_TWR_US", "500", 1);
+    i2c_set_transport(&page_transport);
+    do_log = 0;
+
+    for (i=0; i<IMG_LEN; i++) {
+        img_a[i] = (unsigned char)(i*7 + (i>>8));
+    }
+    memcpy(img_b, img_a, IMG_LEN);
+    img_b[3*BLOCKSIZE] ^= 0x01;       // first byte of a page
+    img_b[18*BLOCKSIZE-1] ^= 0x80;    // last byte of page 17
+    img_b[IMG_LEN-1] ^= 0xff;         // in the partial page
+    write_image(fname_a, img_a, IMG_LEN);
+    write_image(fname_b, img_b, IMG_LEN);
+
+    // the pages compared include the 0xff padding of the partial page
+    memset(padded_a, 0xff, sizeof(padded_a));
+    memset(padded_b, 0xff, sizeof(padded_b));
+    memcpy(padded_a, img_a, IMG_LEN);
+    memcpy(padded_b, img_b, IMG_LEN);
+    CHECK(ee_diff_pages(padded_a, padded_a, sizeof(padded_a), dirty) == 0);
+    CHECK(ee_diff_pages(padded_a, padded_b, sizeof(padded_b), dirty) == 3);
+    for (i=0; i<IMG_PAGES; i++) {
+        CHECK(dirty[i] == ((i == 3) || (i == 17) || (i == 40)));
+    }
+
+    // image A, every page
+    CHECK(ee_prog(fname_a, 0) == 0);
+    CHECK(nwrites == IMG_PAGES);
+    CHECK(memcmp(fake_state()->ee, img_a, IMG_LEN) == 0);
+
+    // image B, only the pages that changed
+    nwrites = 0;
+    CHECK(prog_skipped(fname_b) == 38);
+    CHECK(nwrites == 3);
+    if (nwrites == 3) {
+        CHECK(write_addr[0] == 3*BLOCKSIZE);
+        CHECK(write_addr[1] == 17*BLOCKSIZE);
+        CHECK(write_addr[2] == 40*BLOCKSIZE);
+    }
+    CHECK(memcmp(fake_state()->ee, img_b, IMG_LEN) == 0);
+    for (i=IMG_LEN; i<IMG_PAGES*BLOCKSIZE; i++) {
+        CHECK(fake_state()->ee[i] == 0xff);
+    }
+
+    // image B again, nothing to write
+    nwrites = 0;
+    CHECK(prog_skipped(fname_b) == IMG_PAGES);
+    CHECK(nwrites == 0);
+    CHECK(memcmp(fake_state()->ee, img_b, IMG_LEN) == 0);
+
+    unlink(fname_a);
+    unlink(fname_b);
+    if (nfailed) {
+        printf("eeprog_test: %d checks failed\n", nfailed);
+        return(1);
+    }
+    printf("eeprog_test: ok\n");
+    return(0);
+}
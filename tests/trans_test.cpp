@@ -0,0 +1,153 @@
+/*****************************************************
+ * trans_test - i2c_trans_submit test
+ * rev 1 - october 2026
+ *
+ * Queues more messages than one I2C_RDWR ioctl can
+ * carry and submits them through a transport that
+ * only counts the rdwr calls, then checks how the
+ * messages were split up, the status of each message,
+ * and that a failed group stops the submit.
+ *
+ * Run with make check.
+ *****************************************************/
+
+// includes
+ #include <stdio.h>
+ #include <string.h>
+ #include <errno.h>
+ #include "i2cfunc.h"
+
+// defines
+#define NMSGS 100         // more than two I2C_RDWR_MAX_MSGS groups
+#define MAX_CALLS 8
+#define TEST_ADDR 0x34
+#define TEST_HANDLE 3
+
+#define CHECK(cond) do { if (!(cond)) { \
+    printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+    nfailed++; } } while (0)
+
+// globals
+int nfailed = 0;
+int ncalls = 0;                  // rdwr calls so far
+int call_nmsgs[MAX_CALLS];       // messages in each call
+struct i2c_msg* call_msgs[MAX_CALLS];
+int fail_call = -1;              // rdwr call that fails, or -1
+
+// counting transport, only rdwr is used by i2c_trans_submit
+static int count_rdwr(i2c_transport_t* tp, int handle, struct i2c_msg* msgs, int nmsgs) {
+    int i;
+
+    if (ncalls < MAX_CALLS) {
+        call_nmsgs[ncalls] = nmsgs;
+        call_msgs[ncalls] = msgs;
+    }
+    if (ncalls++ == fail_call) {
+        errno = EREMOTEIO;
+        return(-1);
+    }
+    for (i=0; i<nmsgs; i++) {
+        // reads get the length of the message, so the caller can tell them apart
+        if (msgs[i].flags & I2C_M_RD) memset(msgs[i].buf, msgs[i].len, msgs[i].len);
+    }
+    return(nmsgs);
+}
+
+i2c_transport_t count_transport = {
+    "test", NULL, NULL, NULL, NULL, count_rdwr, NULL, NULL
+};
+
+// queue NMSGS messages, alternating writes and reads of 1 to 7 bytes
+void fill(i2c_transaction_t* t, unsigned char rbuf[][8]) {
+    unsigned char wbuf[8];
+    int i;
+    int len;
+
+    i2c_trans_init(t);
+    for (i=0; i<NMSGS; i++) {
+        len = (i % 7) + 1;
+        memset(wbuf, i, sizeof(wbuf));
+        memset(rbuf[i], 0, 8);
+        if (i % 3 == 2) {
+            CHECK(i2c_trans_read(t, TEST_ADDR, rbuf[i], len) == i);
+        } else {
+            CHECK(i2c_trans_write(t, TEST_ADDR, wbuf, len) == i);
+        }
+    }
+    ncalls = 0;
+}
+
+// all messages sent, in groups of at most I2C_RDWR_MAX_MSGS
+void test_split(void) {
+    static i2c_transaction_t t;
+    static unsigned char rbuf[NMSGS][8];
+    int i;
+    int first = 0;
+    int len;
+
+    fill(&t, rbuf);
+    fail_call = -1;
+    CHECK(i2c_trans_submit(TEST_HANDLE, &t) == 0);
+    CHECK(ncalls == (NMSGS + I2C_RDWR_MAX_MSGS - 1) / I2C_RDWR_MAX_MSGS);
+    for (i=0; (i<ncalls) && (i<MAX_CALLS); i++) {
+        CHECK(call_msgs[i] == &t.msgs[first]);
+        CHECK(call_nmsgs[i] == ((NMSGS-first > I2C_RDWR_MAX_MSGS) ? I2C_RDWR_MAX_MSGS : NMSGS-first));
+        first += call_nmsgs[i];
+    }
+    CHECK(first == NMSGS);
+    for (i=0; i<NMSGS; i++) {
+        len = (i % 7) + 1;
+        CHECK(t.status[i] == len);
+        if (i % 3 == 2) {
+            CHECK(rbuf[i][0] == len);
+            CHECK(rbuf[i][len-1] == len);
+            CHECK(rbuf[i][len] == 0);
+        } else {
+            CHECK(t.msgs[i].len == (unsigned int)len);
+            CHECK(t.msgs[i].buf[0] == i);
+        }
+    }
+}
+
+// the second group fails: the first keeps its status, nothing after it is sent
+void test_failure(void) {
+    static i2c_transaction_t t;
+    static unsigned char rbuf[NMSGS][8];
+    int i;
+
+    fill(&t, rbuf);
+    fail_call = 1;
+    CHECK(i2c_trans_submit(TEST_HANDLE, &t) == -1);
+    CHECK(ncalls == 2);
+    for (i=0; i<NMSGS; i++) {
+        if (i < I2C_RDWR_MAX_MSGS) {
+            CHECK(t.status[i] == (i % 7) + 1);
+        } else {
+            CHECK(t.status[i] == -1);
+        }
+    }
+    for (i=I2C_RDWR_MAX_MSGS; i<NMSGS; i++) {
+        if (i % 3 == 2) CHECK(rbuf[i][0] == 0);
+    }
+
+    // the transaction is left intact, so it can be submitted again
+    fail_call = -1;
+    ncalls = 0;
+    CHECK(i2c_trans_submit(TEST_HANDLE, &t) == 0);
+    CHECK(ncalls == 3);
+    for (i=0; i<NMSGS; i++) {
+        CHECK(t.status[i] == (i % 7) + 1);
+    }
+}
+
+int main(void) {
+    i2c_set_transport(&count_transport);
+    test_split();
+    test_failure();
+    if (nfailed) {
+        printf("trans_test: %d checks failed\n", nfailed);
+        return(1);
+    }
+    printf("trans_test: ok\n");
+    return(0);
+}
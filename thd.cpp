@@ -196,14 +196,14 @@ extern char do_log;
 
     if (do_test) {
         for (j=0; j<4; j++) { // there are 4 identical filters
-            set_gen_2nd_order_filter(FILTER_NODE+(j*5), (double*)(&peakfiltcoeff[fidx][testharmonic*5]));
+            set_gen_2nd_order_filter_safeload(FILTER_NODE+(j*5), (double*)(&peakfiltcoeff[fidx][testharmonic*5]));
         }
         delay_ms(900); // wait some time before we take the level reading
-        delay_ms(900); // wait some time before we take the level reading
+        delay_ms(1000); // readback_fast does not wait, so this includes its 100 msec
         if (testharmonic==0) {
-            v[testharmonic] = readback(LEVEL_ADDR, LEVEL_NODE);
+            v[testharmonic] = readback_fast(LEVEL_ADDR, LEVEL_NODE);
         } else {
-            v[testharmonic] = readback(LEVEL_ADDR, LEVEL_NODE2) / 10000.0;
+            v[testharmonic] = readback_fast(LEVEL_ADDR, LEVEL_NODE2) / 10000.0;
         }
         converted[testharmonic] = ms_to_rms(v[testharmonic]);
         printf("value (RMS) of harmonic # %d is %lf\n", testharmonic+1, converted[testharmonic]);
@@ -214,24 +214,26 @@ extern char do_log;
     logstate = do_log;
     if (do_db || do_percent) {
         for (i=0; i<TOTHARM; i++) { // do fundamental and each harmonic
+            dsp_batch_begin(); // all 4 filters go out together
             for (j=0; j<4; j++) { // there are 4 identical filters
                 if (j>0) do_log=0; // too much output so lets reduce it
-                set_gen_2nd_order_filter(FILTER_NODE+(j*5), (double*)(&peakfiltcoeff[fidx][i*5]));
+                set_gen_2nd_order_filter_safeload(FILTER_NODE+(j*5), (double*)(&peakfiltcoeff[fidx][i*5]));
                 do_log=logstate;
             }
-            delay_ms(900); // wait some time before we take the level reading
+            dsp_batch_end();
+            delay_ms(1000); // wait some time before we take the level reading
             if (i==0) { 
-                v[i] = readback(LEVEL_ADDR, LEVEL_NODE);
+                v[i] = readback_fast(LEVEL_ADDR, LEVEL_NODE);
                 converted[i] = ms_to_rms(v[i]); // store the RMS for fundamental
             } else {
                 for (k=0; k<10; k++) {
-                    v[i] = readback(LEVEL_ADDR, LEVEL_NODE2) / 10000.0;
+                    v[i] = readback_fast(LEVEL_ADDR, LEVEL_NODE2) / 10000.0;
                     converted[i] = ms_to_rms(v[i]); // store the RMS for each harmonic
                     if (converted[i]<0.07999) {
                         break;
                     } else {
                         if (do_log) printf("Out of range. Reattempt..");
-                        delay_ms(900);
+                        delay_ms(1000);
                     }
                 }
             }
@@ -0,0 +1,78 @@
+/*******************************
+ * timeline.c
+ * Chrome trace-event (JSON) output of
+ * the set_* calls, I2C transactions,
+ * delays and readbacks
+ * rev 1 october 2026
+ *******************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "i2cfunc.h"
+#include "timeline.h"
+
+char timeline_on=0;
+
+static FILE* timeline_fp=NULL;
+static char timeline_tried=0;
+static int timeline_pid;
+static const char* timeline_prog="tool";
+
+static void timeline_finish(void)
+{
+  if (timeline_fp==NULL) return;
+  timeline_on=0;
+  fprintf(timeline_fp, "\n");
+  fclose(timeline_fp);
+  timeline_fp=NULL;
+}
+
+int timeline_init(void)
+{
+  const char* path;
+
+  if (timeline_tried) return(timeline_on);
+  timeline_tried=1;
+  path=getenv("WAVEMINER_TIMELINE");
+  if ((path==NULL) || (path[0]==0)) return(0);
+  if ((timeline_fp=fopen(path, "a"))==NULL)
+  {
+    fprintf(stderr, "timeline_init error: can't create %s\n", path);
+    return(0);
+  }
+  // the JSON array form of the format, whose closing bracket is optional, so
+  // later runs can keep adding to the same array
+  fseek(timeline_fp, 0, SEEK_END);
+  fprintf(timeline_fp, (ftell(timeline_fp)==0) ? "[\n" : ",\n");
+  timeline_pid=getpid();
+  fprintf(timeline_fp, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %d, \"tid\": 1, "
+          "\"args\": {\"name\": \"%s (%d)\"}}", timeline_pid, timeline_prog, timeline_pid);
+  timeline_on=1;
+  atexit(timeline_finish);
+  return(1);
+}
+
+void timeline_span(const char* name, const char* cat, unsigned long long t_start, const char* args)
+{
+  unsigned long long t_end=monotonic_ns();
+
+  if (timeline_fp==NULL) return;
+  fprintf(timeline_fp, ",\n{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, "
+          "\"pid\": %d, \"tid\": 1", name, cat, t_start/1e3, (t_end-t_start)/1e3, timeline_pid);
+  if (args) fprintf(timeline_fp, ", \"args\": {%s}", args);
+  fprintf(timeline_fp, "}");
+}
+
+// runs before main(), with the arguments from glibc, to name the process
+__attribute__((constructor)) static void timeline_start(int argc, char** argv, char** envp)
+{
+  const char* p;
+  if ((argc>0) && argv[0])
+  {
+    p=strrchr(argv[0], '/');
+    timeline_prog=p ? p+1 : argv[0];
+  }
+  timeline_init();
+}
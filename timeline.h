@@ -0,0 +1,36 @@
+/************************************
+ * timeline.h
+ * Chrome trace-event (JSON) output of
+ * the set_* calls, I2C transactions,
+ * delays and readbacks
+ *
+ * rev 1 october 2026
+ ************************************/
+
+#ifndef __TIMELINE_HEADER_FILE__
+#define __TIMELINE_HEADER_FILE__
+
+// Set WAVEMINER_TIMELINE to a file name to record a timeline of a tool's
+// run, which can be opened in Perfetto (ui.perfetto.dev) or chrome://tracing.
+// Each call is a span ("X" event) with its start and duration; the I2C
+// transactions and delays made by a set_* call or a readback are shown
+// nested inside it. Times are CLOCK_MONOTONIC, so the timelines of several
+// tools run one after the other can be added to the same file and line up.
+// While it is off the hooks cost a test of timeline_on (see i2cfunc.h).
+
+// span categories
+#define TIMELINE_DSP "dsp"      // set_* and readback
+#define TIMELINE_I2C "i2c"      // transport calls
+#define TIMELINE_SLEEP "sleep"  // delay_ms and delay_us
+
+extern char timeline_on;
+
+// opens the file named by WAVEMINER_TIMELINE, if it is set and hasn't been
+// opened already. Called before main(), and by i2c_transport().
+// returns 1 if the timeline is being recorded, otherwise 0
+int timeline_init(void);
+// records a span that started at t_start (a monotonic_ns() value) and ends now.
+// args is NULL, or the inside of a JSON object, e.g. "\"addr\": 52"
+void timeline_span(const char* name, const char* cat, unsigned long long t_start, const char* args);
+
+#endif // __TIMELINE_HEADER_FILE__